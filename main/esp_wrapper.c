@@ -15,6 +15,8 @@
 static long s_led_state = 0;
 static long s_dig_state = 0;
 static led_strip_handle_t s_led_handle = NULL;
+static temperature_sensor_handle_t s_temp_sensor = NULL;
+static esp_err_t s_temp_sensor_err = ESP_ERR_INVALID_STATE;  // See wrap_init()
 static char g_sysinfo[64];
 const char* chip_info();
 const struct chip_info_t {
@@ -60,26 +62,131 @@ static void configure_led(void)
   led_strip_clear(s_led_handle);
 }
 
-bool wrap_gpio_config(struct mg_str in, struct mg_str* out) {
+// Installing the sensor is slow: it is done once, by wrap_init()
+static esp_err_t configure_temp_sensor(void)
+{
+  temperature_sensor_config_t cfg = TEMPERATURE_SENSOR_CONFIG_DEFAULT(10, 50);
+  esp_err_t err = temperature_sensor_install(&cfg, &s_temp_sensor);
+  RETURN_IF_FAIL(err, err);
+  err = temperature_sensor_enable(s_temp_sensor);
+  if (err != ESP_OK) {
+    temperature_sensor_uninstall(s_temp_sensor);
+    s_temp_sensor = NULL;
+  }
+  return err;
+}
+
+void wrap_init(void) {
+  s_temp_sensor_err = configure_temp_sensor();
+}
+
+#define NUM_FIELDS(a) (sizeof(a) / sizeof((a)[0]))
+
+// Request parameters. Each wrapper decodes its fields with mg_json_decode()
+struct gpio_req {
+  uint32_t pin, mode, level;
+};
+
+struct pwm_req {
+  uint32_t pin, channel, freq, timer, resolution, duty;
+};
+
+struct led_req {
+  uint32_t state, red, green, blue;
+};
+
+static const struct mg_json_field s_gpio_config_fields[] = {
+    MG_JSON_FIELD("pins", MG_JSON_FIELD_BITS, gpio_config_t, pin_bit_mask,
+                  true, 0, GPIO_NUM_MAX - 1),
+    MG_JSON_FIELD("mode", MG_JSON_FIELD_UINT, gpio_config_t, mode, false, 0,
+                  GPIO_MODE_INPUT_OUTPUT_OD),
+    MG_JSON_FIELD("pull_up_en", MG_JSON_FIELD_UINT, gpio_config_t, pull_up_en,
+                  false, 0, 1),
+    MG_JSON_FIELD("pull_down_en", MG_JSON_FIELD_UINT, gpio_config_t,
+                  pull_down_en, false, 0, 1),
+    MG_JSON_FIELD("intr_type", MG_JSON_FIELD_UINT, gpio_config_t, intr_type,
+                  false, 0, GPIO_INTR_MAX - 1),
+};
+
+static const struct mg_json_field s_gpio_mode_fields[] = {
+    MG_JSON_FIELD("pin", MG_JSON_FIELD_UINT, struct gpio_req, pin, true, 0,
+                  GPIO_NUM_MAX - 1),
+    MG_JSON_FIELD("mode", MG_JSON_FIELD_UINT, struct gpio_req, mode, true, 0,
+                  GPIO_MODE_INPUT_OUTPUT_OD),
+};
+
+static const struct mg_json_field s_gpio_level_fields[] = {
+    MG_JSON_FIELD("pin", MG_JSON_FIELD_UINT, struct gpio_req, pin, true, 0,
+                  GPIO_NUM_MAX - 1),
+    MG_JSON_FIELD("level", MG_JSON_FIELD_UINT, struct gpio_req, level, true,
+                  0, 1),
+};
+
+static const struct mg_json_field s_pwm_config_fields[] = {
+    MG_JSON_FIELD("pin", MG_JSON_FIELD_UINT, struct pwm_req, pin, true, 0,
+                  GPIO_NUM_MAX - 1),
+    MG_JSON_FIELD("channel", MG_JSON_FIELD_UINT, struct pwm_req, channel, true,
+                  0, LEDC_CHANNEL_MAX - 1),
+    MG_JSON_FIELD("freq", MG_JSON_FIELD_UINT, struct pwm_req, freq, true, 1,
+                  40000000),
+    MG_JSON_FIELD("timer", MG_JSON_FIELD_UINT, struct pwm_req, timer, true, 0,
+                  LEDC_TIMER_MAX - 1),
+    MG_JSON_FIELD("resolution", MG_JSON_FIELD_UINT, struct pwm_req, resolution,
+                  true, 1, LEDC_TIMER_BIT_MAX - 1),
+};
+
+static const struct mg_json_field s_pwm_duty_fields[] = {
+    MG_JSON_FIELD("channel", MG_JSON_FIELD_UINT, struct pwm_req, channel, true,
+                  0, LEDC_CHANNEL_MAX - 1),
+    MG_JSON_FIELD("duty", MG_JSON_FIELD_UINT, struct pwm_req, duty, true, 0,
+                  UINT32_MAX),
+};
+
+static const struct mg_json_field s_led_fields[] = {
+    MG_JSON_FIELD("state", MG_JSON_FIELD_UINT, struct led_req, state, false,
+                  0, 1),
+    MG_JSON_FIELD("red", MG_JSON_FIELD_UINT, struct led_req, red, false, 0,
+                  255),
+    MG_JSON_FIELD("green", MG_JSON_FIELD_UINT, struct led_req, green, false,
+                  0, 255),
+    MG_JSON_FIELD("blue", MG_JSON_FIELD_UINT, struct led_req, blue, false, 0,
+                  255),
+};
+
+static const struct mg_json_field s_wifi_connect_fields[] = {
+    MG_JSON_FIELD("ssid", MG_JSON_FIELD_STR, struct wifi_prov_cfg, ssid, true,
+                  1, MAX_SSID_LEN - 1),
+    MG_JSON_FIELD("password", MG_JSON_FIELD_STR, struct wifi_prov_cfg, pass,
+                  true, 0, 0),
+};
+
+// Responses, encoded by mg_print_fields()
+static const struct mg_json_field s_gpio_info_fields[] = {
+    MG_JSON_FIELD("pu", MG_JSON_FIELD_BOOL, gpio_io_config_t, pu, 0, 0, 0),
+    MG_JSON_FIELD("pd", MG_JSON_FIELD_BOOL, gpio_io_config_t, pd, 0, 0, 0),
+    MG_JSON_FIELD("ie", MG_JSON_FIELD_BOOL, gpio_io_config_t, ie, 0, 0, 0),
+    MG_JSON_FIELD("oe", MG_JSON_FIELD_BOOL, gpio_io_config_t, oe, 0, 0, 0),
+    MG_JSON_FIELD("oe_ctrl_by_periph", MG_JSON_FIELD_BOOL, gpio_io_config_t,
+                  oe_ctrl_by_periph, 0, 0, 0),
+    MG_JSON_FIELD("oe_inv", MG_JSON_FIELD_BOOL, gpio_io_config_t, oe_inv, 0, 0,
+                  0),
+    MG_JSON_FIELD("od", MG_JSON_FIELD_BOOL, gpio_io_config_t, od, 0, 0, 0),
+    MG_JSON_FIELD("slp_sel", MG_JSON_FIELD_BOOL, gpio_io_config_t, slp_sel, 0,
+                  0, 0),
+};
+
+static const struct mg_json_field s_wifi_info_fields[] = {
+    MG_JSON_FIELD("ssid", MG_JSON_FIELD_STR, struct wifi_prov_info, ssid, 0, 0,
+                  0),
+    MG_JSON_FIELD("ipv4", MG_JSON_FIELD_STR, struct wifi_prov_info, ipv4, 0, 0,
+                  0),
+};
+
+bool wrap_gpio_config(const struct mg_json_tape* in, struct mg_str* out) {
   gpio_config_t cfg = {};
-  struct mg_str pins = mg_json_get_tok(in, "$.pins");
-  if (!pins.buf)
+  if (mg_json_decode(in, s_gpio_config_fields,
+                     NUM_FIELDS(s_gpio_config_fields), &cfg) < 0)
     goto ERR;
-  size_t ofs = 0;
-  struct mg_str val;
-  while ((ofs = mg_json_next(pins, ofs, NULL, &val)) > 0) {
-    uint8_t pin;
-    if (mg_str_to_num(val, 10, &pin, sizeof(pin))) {
-      cfg.pin_bit_mask |= (1ULL << pin);
-    } else
-      goto ERR;
-  }
-
-  cfg.mode = mg_json_get_long(in, "$.mode", GPIO_MODE_DISABLE);
-  cfg.pull_up_en = mg_json_get_long(in, "$.pull_up_en", GPIO_PULLUP_DISABLE);
-  cfg.pull_down_en =
-      mg_json_get_long(in, "$.pull_down_en", GPIO_PULLDOWN_DISABLE);
-  cfg.intr_type = mg_json_get_long(in, "$.intr_type", GPIO_INTR_DISABLE);
   esp_err_t r = gpio_config(&cfg);
   if (ESP_OK != r)
     goto ERR;
@@ -91,32 +198,24 @@ ERR:
   return false;
 }
 
-bool wrap_gpio_info(struct mg_str in, struct mg_str* out) {
+bool wrap_gpio_info(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
   gpio_io_config_t cfg = {};
-  long pin = mg_json_get_long(in, "$.pin", -1);
-  if (pin == -1) {
+  struct gpio_req req = {};
+  // "pin" only
+  if (mg_json_decode(in, s_gpio_mode_fields, 1, &req) < 0) {
     msg = JSON_INVALID_PARAMS;
     goto ERR;
   }
-  esp_err_t r = gpio_get_io_config(pin, &cfg);
+  esp_err_t r = gpio_get_io_config(req.pin, &cfg);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
   }
-  out->len = mg_snprintf(out->buf, out->len,
-                         "{\"cause\":\"success\", \
-    \"info\": { \
-    \"pu\":%d,\
-    \"pd\":%d,\
-      \"ie\":%d,\
-      \"oe\":%d,\
-      \"oe_ctrl_by_periph\":%d,\
-      \"oe_inv\":%d,\
-      \"od\":%d,\
-      \"slp_sel\":%d}}",
-                         cfg.pu, cfg.pd, cfg.ie, cfg.oe, cfg.oe_ctrl_by_periph,
-                         cfg.oe_inv, cfg.od, cfg.slp_sel);
+  out->len = mg_snprintf(out->buf, out->len, "{%m:%m,%m:{%M}}",
+                         MG_ESC("cause"), MG_ESC("success"), MG_ESC("info"),
+                         mg_print_fields, s_gpio_info_fields,
+                         NUM_FIELDS(s_gpio_info_fields), &cfg);
   return true;
 
 ERR:
@@ -124,19 +223,14 @@ ERR:
   return false;
 }
 
-bool wrap_gpio_mode(struct mg_str in, struct mg_str* out) {
+bool wrap_gpio_mode(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
-  long pin = mg_json_get_long(in, "$.pin", -1);
-  if (pin == -1) {
+  struct gpio_req req = {};
+  if (mg_json_decode(in, s_gpio_mode_fields, NUM_FIELDS(s_gpio_mode_fields), &req) < 0) {
     msg = JSON_INVALID_PARAMS;
     goto ERR;
   }
-  long mode = mg_json_get_long(in, "$.mode", -1);
-  if (mode == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  }
-  esp_err_t r = gpio_set_direction(pin, mode);
+  esp_err_t r = gpio_set_direction(req.pin, req.mode);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
@@ -149,19 +243,14 @@ ERR:
   return false;
 }
 
-bool wrap_gpio_level(struct mg_str in, struct mg_str* out) {
+bool wrap_gpio_level(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
-  long pin = mg_json_get_long(in, "$.pin", -1);
-  if (pin == -1) {
+  struct gpio_req req = {};
+  if (mg_json_decode(in, s_gpio_level_fields, NUM_FIELDS(s_gpio_level_fields), &req) < 0) {
     msg = JSON_INVALID_PARAMS;
     goto ERR;
   }
-  long level = mg_json_get_long(in, "$.level", -1);
-  if (level == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  }
-  esp_err_t r = gpio_set_level(pin, level);
+  esp_err_t r = gpio_set_level(req.pin, req.level);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
@@ -174,58 +263,29 @@ ERR:
   return false;
 }
 
-bool wrap_pwm_config(struct mg_str in, struct mg_str* out) {
+bool wrap_pwm_config(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
+  struct pwm_req req = {};
+  if (mg_json_decode(in, s_pwm_config_fields, NUM_FIELDS(s_pwm_config_fields),
+                     &req) < 0) {
+    msg = JSON_INVALID_PARAMS;
+    goto ERR;
+  }
   ledc_timer_config_t timer_cfg = {
       .speed_mode = LEDC_LOW_SPEED_MODE,
       .clk_cfg = LEDC_AUTO_CLK,
+      .freq_hz = req.freq,
+      .timer_num = req.timer,
+      .duty_resolution = req.resolution,
   };
   ledc_channel_config_t ch_cfg = {
       .speed_mode = LEDC_LOW_SPEED_MODE,
       .intr_type = LEDC_INTR_DISABLE,
+      .gpio_num = req.pin,
+      .channel = req.channel,
+      .timer_sel = req.timer,
   };
 
-  long pin = mg_json_get_long(in, "$.pin", -1);
-  if (pin == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  } else {
-    ch_cfg.gpio_num = pin;
-  }
-
-  long ch = mg_json_get_long(in, "$.channel", -1);
-  if (ch == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  } else {
-    ch_cfg.channel = ch;
-  }
-
-  long freq = mg_json_get_long(in, "$.freq", -1);
-  if (freq == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  } else {
-    timer_cfg.freq_hz = freq;
-  }
-
-  long timer = mg_json_get_long(in, "$.timer", -1);
-  if (timer == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  } else {
-    ch_cfg.timer_sel = timer;
-    timer_cfg.timer_num = timer;
-  }
-
-  long resolution = mg_json_get_long(in, "$.resolution", -1);
-  if (resolution == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  } else {
-    timer_cfg.duty_resolution = resolution;
-  }
-
   esp_err_t r = ledc_timer_config(&timer_cfg);
   if (ESP_OK != r) {
     ESP_LOGE(MODULE_TAG, "ledc_timer_config failed(%d)", r);
@@ -246,24 +306,20 @@ ERR:
   return false;
 }
 
-bool wrap_pwm_set_duty(struct mg_str in, struct mg_str* out) {
+bool wrap_pwm_set_duty(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
-  long ch = mg_json_get_long(in, "$.channel", -1);
-  if (ch == -1) {
+  struct pwm_req req = {};
+  if (mg_json_decode(in, s_pwm_duty_fields, NUM_FIELDS(s_pwm_duty_fields),
+                     &req) < 0) {
     msg = JSON_INVALID_PARAMS;
     goto ERR;
   }
-  long duty = mg_json_get_long(in, "$.duty", -1);
-  if (duty == -1) {
-    msg = JSON_INVALID_PARAMS;
-    goto ERR;
-  }
-  esp_err_t r = ledc_set_duty(LEDC_LOW_SPEED_MODE, ch, duty);
+  esp_err_t r = ledc_set_duty(LEDC_LOW_SPEED_MODE, req.channel, req.duty);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
   }
-  r = ledc_update_duty(LEDC_LOW_SPEED_MODE, ch);
+  r = ledc_update_duty(LEDC_LOW_SPEED_MODE, req.channel);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
@@ -276,15 +332,16 @@ ERR:
   return false;
 }
 
-bool wrap_pwm_stop(struct mg_str in, struct mg_str* out) {
+bool wrap_pwm_stop(const struct mg_json_tape* in, struct mg_str* out) {
   const char* msg = JSON_SUCCESS;
-  long ch = mg_json_get_long(in, "$.channel", -1);
-  if (ch == -1) {
+  struct pwm_req req = {};
+  // "channel" only
+  if (mg_json_decode(in, s_pwm_duty_fields, 1, &req) < 0) {
     msg = JSON_INVALID_PARAMS;
     goto ERR;
   }
 
-  esp_err_t r = ledc_stop(LEDC_LOW_SPEED_MODE, ch, 0);
+  esp_err_t r = ledc_stop(LEDC_LOW_SPEED_MODE, req.channel, 0);
   if (ESP_OK != r) {
     msg = JSON_ESP32_ERROR;
     goto ERR;
@@ -297,7 +354,7 @@ ERR:
   return false;
 }
 
-bool wrap_sys_info(struct mg_str in, struct mg_str* out) {
+bool wrap_sys_info(const struct mg_json_tape* in, struct mg_str* out) {
   out->len =
       mg_snprintf(out->buf, out->len,
                   "{\"cause\":\"success\", \"info\":\"%s\"}", chip_info());
@@ -365,74 +422,70 @@ const char* chip_info() {
   return g_sysinfo;
 }
 
-bool wrap_wifi_provisioned(struct mg_str in, struct mg_str* out) {
+bool wrap_wifi_provisioned(const struct mg_json_tape* in, struct mg_str* out) {
   struct wifi_prov_info info = {};
   bool provisioned = wifi_provisioned(&info);
-  out->len = mg_snprintf(out->buf, out->len,
-                         "{\"cause\":\"success\", \"provisioned\": %s, \"ssid\": \"%s\", \"ipv4\": \"%s\"}",
-                         provisioned ? "true" : "false", provisioned ? info.ssid : "", provisioned ? info.ipv4 : "");
+  if (!provisioned) memset(&info, 0, sizeof(info));
+  out->len = mg_snprintf(out->buf, out->len, "{%m:%m,%m:%s,%M}",
+                         MG_ESC("cause"), MG_ESC("success"),
+                         MG_ESC("provisioned"), provisioned ? "true" : "false",
+                         mg_print_fields, s_wifi_info_fields,
+                         NUM_FIELDS(s_wifi_info_fields), &info);
   MG_INFO(("%s info: %s", __func__, out->buf));
   return true;
 }
 
-bool wrap_wifi_scan(struct mg_str in, struct mg_str* out) {
-  wifi_scan_start();
+bool wrap_wifi_scan(const struct mg_json_tape* in, struct mg_str* out) {
   wifi_scan_result(out);
   return true;
 }
 
-bool wrap_wifi_connect(struct mg_str in, struct mg_str* out) {
-  const char* ssid = mg_json_get_str(in, "$.ssid");
-  const char* password = mg_json_get_str(in, "$.password");
-  if (ssid == NULL || password == NULL) {
+bool wrap_wifi_connect(const struct mg_json_tape* in, struct mg_str* out) {
+  struct wifi_prov_cfg cfg = {};
+  if (mg_json_decode(in, s_wifi_connect_fields,
+                     NUM_FIELDS(s_wifi_connect_fields), &cfg) < 0) {
     out->len = mg_snprintf(out->buf, out->len, JSON_INVALID_PARAMS);
     return false;
   }
-  MG_INFO(("%s connecting to SSID=%s PASS=%s", __func__, ssid, password));
-  struct wifi_prov_cfg cfg = {};
-  strncpy(cfg.ssid, ssid, sizeof(cfg.ssid) - 1);
-  strncpy(cfg.pass, password, sizeof(cfg.pass) - 1);
+  MG_INFO(("%s connecting to SSID=%s PASS=%s", __func__, cfg.ssid, cfg.pass));
   wifi_provision(&cfg);
   out->len = mg_snprintf(out->buf, out->len, JSON_SUCCESS);
   return true;
 }
 
-bool wrap_sys_stats(struct mg_str in, struct mg_str* out)
+bool wrap_sys_stats(const struct mg_json_tape* in, struct mg_str* out)
 {
-  temperature_sensor_handle_t temp_sensor = NULL;
-  temperature_sensor_config_t temp_sensor_config = TEMPERATURE_SENSOR_CONFIG_DEFAULT(10, 50);
-  esp_err_t err = temperature_sensor_install(&temp_sensor_config, &temp_sensor);
-  if (ESP_OK != err) goto ERR;
-  err = temperature_sensor_enable(temp_sensor);
+  esp_err_t err = s_temp_sensor_err;  // Not retried here, on the loop
   if (ESP_OK != err) goto ERR;
   float tsens_out;
-  err = temperature_sensor_get_celsius(temp_sensor, &tsens_out);
+  err = temperature_sensor_get_celsius(s_temp_sensor, &tsens_out);
   if (ESP_OK != err) goto ERR;
   MG_INFO(("%s temperature in %f °C", __func__, tsens_out));
   out->len = mg_snprintf(out->buf, out->len,
                   "{\"cause\":\"success\", \
                     \"temperature\":%f,    \
                     \"humidity\": 0}", tsens_out);
-  temperature_sensor_disable(temp_sensor);
-  temperature_sensor_uninstall(temp_sensor);
   return true;
 ERR:
   out->len = mg_snprintf(out->buf, out->len, JSON_ESP32_ERROR);
   return false;
 }
 
-bool wrap_sys_led(struct mg_str in, struct mg_str* out)
+bool wrap_sys_led(const struct mg_json_tape* in, struct mg_str* out)
 {
+  struct led_req req = {};
   if (!s_led_handle) {
     configure_led();
   }
-  s_led_state = mg_json_get_long(in, "$.state", 0);
-  long red = mg_json_get_long(in, "$.red", 0);
-  long green = mg_json_get_long(in, "$.green", 0);
-  long blue = mg_json_get_long(in, "$.blue", 0);
-  MG_INFO(("%s json=%.*s state = %d", __func__, in.len, in.buf, s_led_state));
+  if (mg_json_decode(in, s_led_fields, NUM_FIELDS(s_led_fields), &req) < 0) {
+    out->len = mg_snprintf(out->buf, out->len, JSON_INVALID_PARAMS);
+    return false;
+  }
+  s_led_state = req.state;
+  struct mg_str json = mg_json_tape_get_tok(in, "$");
+  MG_INFO(("%s json=%.*s state = %d", __func__, json.len, json.buf, s_led_state));
   if (s_led_state) {
-    led_strip_set_pixel(s_led_handle, 0, red, green, blue);
+    led_strip_set_pixel(s_led_handle, 0, req.red, req.green, req.blue);
     /* Refresh the strip to send data */
     led_strip_refresh(s_led_handle);
   } else {
@@ -442,9 +495,16 @@ bool wrap_sys_led(struct mg_str in, struct mg_str* out)
   return true;
 }
 
-bool wrap_sys_digits(struct mg_str in, struct mg_str* out) {
-  s_dig_state = mg_json_get_long(in, "$.state", 0);
-  MG_INFO(("%s json=%.*s state = %d", __func__, in.len, in.buf, s_dig_state));
+bool wrap_sys_digits(const struct mg_json_tape* in, struct mg_str* out) {
+  struct led_req req = {};
+  // "state" only
+  if (mg_json_decode(in, s_led_fields, 1, &req) < 0) {
+    out->len = mg_snprintf(out->buf, out->len, JSON_INVALID_PARAMS);
+    return false;
+  }
+  s_dig_state = req.state;
+  struct mg_str json = mg_json_tape_get_tok(in, "$");
+  MG_INFO(("%s json=%.*s state = %d", __func__, json.len, json.buf, s_dig_state));
   if (s_dig_state) {
     _3461_as_start();
     four_digit digs = {
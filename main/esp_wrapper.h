@@ -15,21 +15,26 @@
 #define JSON_INVALID_API "{\"cause\":\"invalid rest api\"}"
 #define JSON_ESP32_ERROR "{\"cause\":\"esp32 internal error\"}"
 
-typedef bool(*wrap_func)(struct mg_str, struct mg_str*);
+// Wrappers read their parameters from a tokenized request, see mg_json_tape
+typedef bool(*wrap_func)(const struct mg_json_tape*, struct mg_str*);
 
-bool wrap_gpio_config(struct mg_str in, struct mg_str* out);
-bool wrap_gpio_info(struct mg_str in, struct mg_str* out);
-bool wrap_gpio_mode(struct mg_str in, struct mg_str* out);
-bool wrap_gpio_level(struct mg_str in, struct mg_str* out);
-bool wrap_pwm_config(struct mg_str in, struct mg_str* out);
-bool wrap_pwm_set_duty(struct mg_str in, struct mg_str* out);
-bool wrap_pwm_stop(struct mg_str in, struct mg_str* out);
-bool wrap_sys_info(struct mg_str in, struct mg_str* out);
-bool wrap_wifi_scan(struct mg_str in, struct mg_str* out);
-bool wrap_wifi_connect(struct mg_str in, struct mg_str* out);
-bool wrap_wifi_provisioned(struct mg_str in, struct mg_str* out);
-bool wrap_sys_stats(struct mg_str in, struct mg_str* out);
-bool wrap_sys_led(struct mg_str in, struct mg_str* out);
-bool wrap_sys_digits(struct mg_str in, struct mg_str* out);
+// Set up hardware that is slow to initialise, before the loops start
+void wrap_init(void);
+
+bool wrap_gpio_config(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_gpio_info(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_gpio_mode(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_gpio_level(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_pwm_config(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_pwm_set_duty(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_pwm_stop(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_sys_info(const struct mg_json_tape* in, struct mg_str* out);
+// Results of the last scan. Start one with wifi_scan_start()
+bool wrap_wifi_scan(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_wifi_connect(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_wifi_provisioned(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_sys_stats(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_sys_led(const struct mg_json_tape* in, struct mg_str* out);
+bool wrap_sys_digits(const struct mg_json_tape* in, struct mg_str* out);
 
 #endif
\ No newline at end of file
@@ -1,9 +1,32 @@
+#include <stddef.h>
 #include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_mac.h"
 #include "nvs_flash.h"
 #include "esp_wrapper.h"
+#include "mqtt_rpc.h"
 
 #define JSON_HEADERS "Content-Type: application/json\r\n"
 #define JSON_MAX_SIZE 512
+#define DEFER_TIMEOUT_MS 15000  // Longest wait for a deferred operation
+#define SCHED_QUEUE_LEN 8       // Low priority calls waiting, per loop
+#define RATE_TOKEN_MS 50        // A connection earns a token this often
+#define RATE_BURST 40           // and saves up to this many
+// Number of event loops. Loop 0 accepts, the rest serve handed-off conns
+#ifndef MG_LOOPS
+#define MG_LOOPS portNUM_PROCESSORS
+#endif
+// MQTT broker for fleet control, e.g. mqtt://10.0.0.1:1883. Empty disables
+#ifndef MQTT_URL
+#define MQTT_URL ""
+#endif
+#ifndef MQTT_USER
+#define MQTT_USER NULL
+#define MQTT_PASS NULL
+#endif
 #define SDK_VOID
 #ifndef RETURN_IF
 #define RETURN_IF(COND, RC, DO) \
@@ -20,6 +43,60 @@ static const char* s_ca_path = "ca.pem";
 static const char* s_cert_path = "cert.pem";
 static const char* s_key_path = "key.pem";
 static struct mg_str s_ca, s_cert, s_key;
+static struct mg_mgr s_mgrs[MG_LOOPS];
+static SemaphoreHandle_t s_hw_lock;  // Serialises wrap_* calls across loops
+static SemaphoreHandle_t s_hw_state;  // Guards s_hw_urgent and HW_CLEAR
+static EventGroupHandle_t s_hw_events;
+static int s_hw_urgent;  // High priority calls waiting for s_hw_lock
+#define HW_CLEAR BIT0    // Set while s_hw_urgent is 0
+// Slow or stalled clients are closed instead of holding a connection slot
+static const struct mg_deadlines s_deadlines = {
+    .handshake_ms = 10000,
+    .header_ms = 10000,
+    .body_ms = 10000,
+    .idle_ms = 60000,
+    .write_ms = 20000,
+};
+
+// Cost and urgency of a call. High priority calls run as soon as they are
+// read. Low priority ones wait in the loop's queue: see sched_run()
+enum { PRIO_HIGH, PRIO_LOW };
+struct method {
+  wrap_func func;
+  uint8_t prio;
+  uint8_t cost;  // Rate limiter tokens, see bucket_take()
+};
+
+static const struct method s_gpio_config = {wrap_gpio_config, PRIO_LOW, 2};
+static const struct method s_gpio_info = {wrap_gpio_info, PRIO_LOW, 1};
+static const struct method s_gpio_mode = {wrap_gpio_mode, PRIO_HIGH, 1};
+static const struct method s_gpio_level = {wrap_gpio_level, PRIO_HIGH, 1};
+static const struct method s_pwm_config = {wrap_pwm_config, PRIO_LOW, 2};
+static const struct method s_pwm_duty = {wrap_pwm_set_duty, PRIO_HIGH, 1};
+static const struct method s_pwm_stop = {wrap_pwm_stop, PRIO_HIGH, 1};
+static const struct method s_sys_info = {wrap_sys_info, PRIO_LOW, 4};
+static const struct method s_sys_stats = {wrap_sys_stats, PRIO_LOW, 8};
+static const struct method s_sys_led = {wrap_sys_led, PRIO_HIGH, 1};
+static const struct method s_sys_digits = {wrap_sys_digits, PRIO_LOW, 2};
+static const struct method s_wifi_provisioned = {wrap_wifi_provisioned,
+                                                 PRIO_LOW, 2};
+static const struct method s_wifi_connect = {wrap_wifi_connect, PRIO_LOW, 20};
+
+// Low priority call waiting for its turn. in is a copy of the request: the
+// JSON-RPC frame, or the HTTP body
+struct job {
+  unsigned long id;  // Connection ID. It may close meanwhile
+  const struct method* m;
+  struct mg_str in;
+  bool rpc;
+};
+
+// Queue of a loop, a ring of jobs in order of arrival
+struct sched {
+  struct job jobs[SCHED_QUEUE_LEN];
+  size_t head, len;
+};
+static struct sched s_scheds[MG_LOOPS];
 
 // Authenticated user.
 // A user can be authenticated by:
@@ -31,58 +108,295 @@ struct user {
   const char *name, *pass, *access_token;
 };
 
-static void rpc_call(struct mg_rpc_req* r, wrap_func func) {
+// Long-running operation. start() asks another task to do it, without
+// waiting. That task posts done_ev or fail_ev to the loops when it finishes,
+// then result() prints the outcome. See defer_start()
+struct deferred_op {
+  bool (*start)(void);
+  int done_ev, fail_ev;
+  wrap_func result;  // Called with no parameters, in is NULL
+  uint8_t cost;      // Rate limiter tokens, see bucket_take()
+};
+
+static const struct deferred_op s_wifi_scan_op = {
+    wifi_scan_start, MG_EV_WIFI_SCAN_DONE, MG_EV_WIFI_SCAN_FAILED,
+    wrap_wifi_scan, 20};
+
+// Tokens a connection may spend on calls. Filled on accept, see fn()
+struct bucket {
+  uint32_t ms;  // When the last token was earned
+  uint16_t tokens;
+};
+
+// Connection state, kept in c->data. Mongoose keeps a size_t at the end of
+// c->data while it serves a static file, see static_start(): stop short of it
+#define CONN_DATA_SIZE (MG_DATA_SIZE - sizeof(size_t))
+struct conn_state {
+  struct bucket bucket;
+  // Request waiting for an operation. One per connection
+  uint64_t expire_ms;            // Give up at this time
+  const struct deferred_op* op;  // NULL if nothing is pending
+  char token[];                  // RPC: see mg_rpc_defer(). HTTP: empty
+};
+#define CONN_TOKEN_SIZE (CONN_DATA_SIZE - offsetof(struct conn_state, token))
+_Static_assert(sizeof(struct conn_state) + 16 <= CONN_DATA_SIZE,
+               "MG_DATA_SIZE leaves no room for a request id token");
+
+// Charge cost tokens, if there are that many. A client can burst, then gets
+// one token per RATE_TOKEN_MS
+static bool bucket_take(struct bucket* b, unsigned cost) {
+  uint32_t now = (uint32_t) mg_millis(), n = (now - b->ms) / RATE_TOKEN_MS;
+  if (n >= RATE_BURST) {
+    b->tokens = RATE_BURST, b->ms = now;
+  } else {
+    b->tokens = b->tokens + n > RATE_BURST ? RATE_BURST : b->tokens + n;
+    b->ms += n * RATE_TOKEN_MS;
+  }
+  if (b->tokens < cost) return false;
+  b->tokens -= cost;
+  return true;
+}
+
+// Per loop timer for the deadlines of pending operations. Armed only while
+// there are some, so that idle loops sleep
+static struct mg_timer* s_defer_timers[MG_LOOPS];
+
+// Earliest deadline of the operations pending on mgr, 0 if there are none
+static uint64_t defer_next(struct mg_mgr* mgr) {
+  uint64_t next = 0;
+  for (struct mg_connection* c = mgr->conns; c != NULL; c = c->next) {
+    struct conn_state* p = (struct conn_state*) c->data;
+    if (c->is_accepted && p->op != NULL &&
+        (next == 0 || p->expire_ms < next)) {
+      next = p->expire_ms;
+    }
+  }
+  return next;
+}
+
+static void defer_timer_fn(void* arg);
+
+// Set the timer of mgr to the earliest deadline, or drop it
+static void defer_arm(struct mg_mgr* mgr) {
+  struct mg_timer** t = &s_defer_timers[mgr - s_mgrs];
+  uint64_t next = defer_next(mgr), now = mg_millis();
+  if (*t != NULL) mg_timer_free(&mgr->timers, *t), mg_free(*t), *t = NULL;
+  if (next == 0) return;
+  *t = mg_timer_add(mgr, next > now ? next - now : 1, MG_TIMER_ONCE,
+                    defer_timer_fn, mgr);
+}
+
+// Answer the pending request of c, with the result of its operation or with
+// an error. HTTP requests get a reply, RPC requests a response frame
+static void defer_done(struct mg_connection* c, bool ok) {
+  struct conn_state* p = (struct conn_state*) c->data;
   char buf[JSON_MAX_SIZE] = {};
   struct mg_str out = {.buf = buf, .len = sizeof(buf)};
-  struct mg_str params = mg_json_get_tok(r->frame, "$.params");
-  if (!params.buf) {
+  ok = ok && p->op->result(NULL, &out);
+  if (p->token[0] == '\0') {
+    if (ok) {
+      mg_http_reply(c, 200, JSON_HEADERS, "%.*s", out.len, out.buf);
+    } else {
+      mg_http_reply(c, 503, "", "%s", JSON_ESP32_ERROR);
+    }
+  } else {
+    size_t ofs = c->send.len;
+    struct mg_rpc_req r = {NULL, 0, mg_pfn_iobuf, &c->send, 0, mg_str(p->token)};
+    if (ok) {
+      mg_rpc_ok(&r, "%.*s", out.len, out.buf);
+    } else {
+      mg_rpc_err(&r, -32000, "%m", MG_ESC("Operation failed"));
+    }
+    if (c->send.len > ofs)
+      mg_ws_wrap(c, c->send.len - ofs, WEBSOCKET_OP_TEXT);
+  }
+  p->op = NULL;
+}
+
+// Start op for a request on c, and answer it when op completes. r is the RPC
+// request, or NULL for HTTP. The loop does not wait: see defer_event()
+static void defer_start(struct mg_connection* c, struct mg_rpc_req* r,
+                        const struct deferred_op* op) {
+  struct conn_state* p = (struct conn_state*) c->data;
+  const char* err = NULL;
+  int status = 503;
+  if (p->op != NULL) {
+    err = "Busy";
+  } else if (!bucket_take(&p->bucket, op->cost)) {
+    err = "Rate limited", status = 429;
+  } else if (r == NULL) {
+    p->token[0] = '\0';
+  } else if (!mg_rpc_defer(r, p->token, CONN_TOKEN_SIZE)) {
+    err = "Invalid request id";
+  }
+  if (err == NULL && !op->start()) err = "Operation failed";
+  if (err == NULL) {
+    p->op = op;
+    p->expire_ms = mg_millis() + DEFER_TIMEOUT_MS;
+    // Deadlines only grow, so an armed timer fires before this one
+    if (s_defer_timers[c->mgr - s_mgrs] == NULL) defer_arm(c->mgr);
+  } else if (r == NULL) {
+    mg_http_reply(c, status, "", "{%m:%m}\n", MG_ESC("cause"), MG_ESC(err));
+  } else {
+    mg_rpc_err(r, -32000, "%m", MG_ESC(err));
+  }
+}
+
+// Completion events are posted to all connections of all loops
+static void defer_event(struct mg_connection* c, int ev) {
+  struct conn_state* p = (struct conn_state*) c->data;
+  if (p->op != NULL && (ev == p->op->done_ev || ev == p->op->fail_ev)) {
+    defer_done(c, ev == p->op->done_ev);
+    defer_arm(c->mgr);
+  }
+}
+
+// Fail requests whose operation never reported back
+static void defer_timer_fn(void* arg) {
+  struct mg_mgr* mgr = (struct mg_mgr*) arg;
+  uint64_t now = mg_millis();
+  s_defer_timers[mgr - s_mgrs] = NULL;  // Deleted when this returns
+  for (struct mg_connection* c = mgr->conns; c != NULL; c = c->next) {
+    struct conn_state* p = (struct conn_state*) c->data;
+    if (c->is_accepted && p->op != NULL && now >= p->expire_ms) {
+      defer_done(c, false);
+    }
+  }
+  defer_arm(mgr);
+}
+
+// Admission of a call read from c. Calls are charged to the connection, then
+// high priority ones run now and low priority ones are queued
+enum { ADMIT_RUN, ADMIT_QUEUED, ADMIT_LIMITED, ADMIT_FULL };
+static int admit(struct mg_connection* c, const struct method* m,
+                 struct mg_str in, bool rpc) {
+  struct sched* s = &s_scheds[c->mgr - s_mgrs];
+  struct job* j = &s->jobs[(s->head + s->len) % SCHED_QUEUE_LEN];
+  if (m->prio == PRIO_LOW && s->len >= SCHED_QUEUE_LEN) return ADMIT_FULL;
+  if (!bucket_take(&((struct conn_state*) c->data)->bucket, m->cost)) {
+    return ADMIT_LIMITED;
+  }
+  if (m->prio == PRIO_HIGH) return ADMIT_RUN;
+  j->in = mg_strdup(in);
+  if (j->in.buf == NULL && in.len > 0) return ADMIT_FULL;
+  j->id = c->id, j->m = m, j->rpc = rpc;
+  s->len++;
+  return ADMIT_QUEUED;
+}
+
+// High priority calls get the lock first. Low priority ones sleep on
+// HW_CLEAR while any wait, and hand the lock back if one arrived as they
+// took it. s_hw_lock is a mutex: its holder inherits the waiter's priority
+static void hw_lock(uint8_t prio) {
+  if (prio == PRIO_HIGH) {
+    xSemaphoreTake(s_hw_state, portMAX_DELAY);
+    if (s_hw_urgent++ == 0) xEventGroupClearBits(s_hw_events, HW_CLEAR);
+    xSemaphoreGive(s_hw_state);
+    xSemaphoreTake(s_hw_lock, portMAX_DELAY);
+    xSemaphoreTake(s_hw_state, portMAX_DELAY);
+    if (--s_hw_urgent == 0) xEventGroupSetBits(s_hw_events, HW_CLEAR);
+    xSemaphoreGive(s_hw_state);
+    return;
+  }
+  for (;;) {
+    xEventGroupWaitBits(s_hw_events, HW_CLEAR, pdFALSE, pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(s_hw_lock, portMAX_DELAY);
+    if (xEventGroupGetBits(s_hw_events) & HW_CLEAR) break;
+    xSemaphoreGive(s_hw_lock);
+  }
+}
+
+// Parameters are looked up in the tape mg_rpc_process() built for the frame
+static void rpc_run(struct mg_rpc_req* r, const struct method* m) {
+  char buf[JSON_MAX_SIZE] = {};
+  struct mg_str out = {.buf = buf, .len = sizeof(buf)};
+  int i = r->tape ? mg_json_tape_find(r->tape, "$.params") : MG_JSON_TOO_BIG;
+  if (i < 0) {
     mg_rpc_err(r, -32602, "Invalid method parameter(s).");
     return;
   }
-  if (!func(params, &out)) {
+  struct mg_json_tape params = *r->tape;
+  params.root = i;
+  hw_lock(m->prio);
+  bool ok = m->func(&params, &out);
+  xSemaphoreGive(s_hw_lock);
+  if (!ok) {
     mg_rpc_err(r, -32602, "Invalid method parameter(s).");
     return;
   }
   mg_rpc_ok(r, "%.*s", out.len, out.buf);
 }
 
+// Requests over MQTT have no connection to charge, see mqtt_rpc.c. They
+// run now, the publish window is their limit
+static void rpc_call(struct mg_rpc_req* r, const struct method* m) {
+  struct mg_connection* c = (struct mg_connection*) r->req_data;
+  int rc = c == NULL ? ADMIT_RUN : admit(c, m, r->frame, true);
+  if (rc == ADMIT_RUN) {
+    rpc_run(r, m);
+  } else if (rc == ADMIT_LIMITED) {
+    mg_rpc_err(r, -32000, "%m", MG_ESC("Rate limited"));
+  } else if (rc == ADMIT_FULL) {
+    mg_rpc_err(r, -32000, "%m", MG_ESC("Overloaded"));
+  }
+}
+
 static void rpc_gpio_config(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_gpio_config);
+  rpc_call(r, &s_gpio_config);
 }
 
 static void rpc_gpio_info(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_gpio_info);
+  rpc_call(r, &s_gpio_info);
 }
 
 static void rpc_gpio_mode(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_gpio_mode);
+  rpc_call(r, &s_gpio_mode);
 }
 
 static void rpc_gpio_level(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_gpio_level);
+  rpc_call(r, &s_gpio_level);
 }
 
 static void rpc_pwm_config(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_pwm_config);
+  rpc_call(r, &s_pwm_config);
 }
 
 static void rpc_pwm_duty(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_pwm_set_duty);
+  rpc_call(r, &s_pwm_duty);
 }
 
 static void rpc_pwm_stop(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_pwm_stop);
+  rpc_call(r, &s_pwm_stop);
 }
 
 static void rpc_sys_info(struct mg_rpc_req* r) {
-  rpc_call(r, wrap_sys_info);
+  rpc_call(r, &s_sys_info);
 }
 
-static void rest_call(struct mg_connection* c, struct mg_http_message* hm,
-                      wrap_func func) {
+// Answered when the scan is done, see defer_start(). WebSocket only: there,
+// req_data is the connection
+static void rpc_wifi_scan(struct mg_rpc_req* r) {
+  struct mg_connection* c = (struct mg_connection*) r->req_data;
+  if (c == NULL) {
+    mg_rpc_err(r, -32000, "%m", MG_ESC("Not available over this transport"));
+  } else {
+    defer_start(c, r, &s_wifi_scan_op);
+  }
+}
+
+static void rest_run(struct mg_connection* c, struct mg_str body,
+                     const struct method* m) {
   char buf[JSON_MAX_SIZE] = {};
   struct mg_str out = {.buf = buf, .len = sizeof(buf)};
-  if (func(hm->body, &out)) {
+  struct mg_json_tok toks[MG_JSON_TAPE_SIZE];
+  struct mg_json_tape in;
+  // An empty or unparsable body leaves the tape empty: lookups find nothing
+  mg_json_tape_init_alloc(&in, body, toks, MG_JSON_TAPE_SIZE);
+  hw_lock(m->prio);
+  bool ok = m->func(&in, &out);
+  xSemaphoreGive(s_hw_lock);
+  mg_json_tape_free(&in, toks);
+  if (ok) {
     MG_INFO(("%s http reply success", __func__));
     mg_http_reply(c, 200, JSON_HEADERS, "%.*s", out.len, out.buf);
   } else {
@@ -91,16 +405,61 @@ static void rest_call(struct mg_connection* c, struct mg_http_message* hm,
   }
 }
 
+// Shed calls are answered with 429 when the client is over its rate, and 503
+// when the loop has too much queued
+static void rest_call(struct mg_connection* c, struct mg_http_message* hm,
+                      const struct method* m) {
+  int rc = admit(c, m, hm->body, false);
+  if (rc == ADMIT_RUN) {
+    rest_run(c, hm->body, m);
+  } else if (rc == ADMIT_LIMITED) {
+    mg_http_reply(c, 429, "", "{%m:%m}\n", MG_ESC("cause"),
+                  MG_ESC("Rate limited"));
+  } else if (rc == ADMIT_FULL) {
+    mg_http_reply(c, 503, "", "{%m:%m}\n", MG_ESC("cause"),
+                  MG_ESC("Overloaded"));
+  }
+}
+
+// Run the oldest queued call, if its connection is still there. Called by
+// the loop between polls, so that every high priority call read meanwhile
+// has run first
+static void sched_run(struct mg_mgr* mgr) {
+  struct sched* s = &s_scheds[mgr - s_mgrs];
+  struct mg_connection* c = mgr->conns;
+  struct job j;
+  if (s->len == 0) return;
+  j = s->jobs[s->head];
+  s->head = (s->head + 1) % SCHED_QUEUE_LEN, s->len--;
+  while (c != NULL && c->id != j.id) c = c->next;
+  if (c != NULL && j.rpc) {
+    size_t ofs = c->send.len;
+    struct mg_json_tok toks[MG_JSON_TAPE_SIZE];
+    struct mg_json_tape tape;
+    struct mg_rpc_req r = {&s_rpc_head, 0, mg_pfn_iobuf, &c->send, c, j.in};
+    if (mg_json_tape_init_alloc(&tape, j.in, toks, MG_JSON_TAPE_SIZE) > 0) {
+      r.tape = &tape;
+    }
+    rpc_run(&r, j.m);
+    mg_json_tape_free(&tape, toks);
+    if (c->send.len > ofs)
+      mg_ws_wrap(c, c->send.len - ofs, WEBSOCKET_OP_TEXT);
+  } else if (c != NULL) {
+    rest_run(c, j.in, j.m);
+  }
+  mg_free((void*) j.in.buf);
+}
+
 static void rest_gpio_handler(struct mg_connection* c,
                               struct mg_http_message* hm, struct mg_str func) {
   if (mg_match(func, mg_str("cfg"), NULL)) {
-    rest_call(c, hm, wrap_gpio_config);
+    rest_call(c, hm, &s_gpio_config);
   } else if (mg_match(func, mg_str("info"), NULL)) {
-    rest_call(c, hm, wrap_gpio_info);
+    rest_call(c, hm, &s_gpio_info);
   } else if (mg_match(func, mg_str("mode"), NULL)) {
-    rest_call(c, hm, wrap_gpio_mode);
+    rest_call(c, hm, &s_gpio_mode);
   } else if (mg_match(func, mg_str("level"), NULL)) {
-    rest_call(c, hm, wrap_gpio_level);
+    rest_call(c, hm, &s_gpio_level);
   } else {
     mg_http_reply(c, 400, "", "%s", JSON_INVALID_API);
   }
@@ -109,26 +468,69 @@ static void rest_gpio_handler(struct mg_connection* c,
 static void rest_pwm_handler(struct mg_connection* c,
                              struct mg_http_message* hm, struct mg_str func) {
   if (mg_match(func, mg_str("cfg"), NULL)) {
-    rest_call(c, hm, wrap_pwm_config);
+    rest_call(c, hm, &s_pwm_config);
   } else if (mg_match(func, mg_str("duty"), NULL)) {
-    rest_call(c, hm, wrap_pwm_set_duty);
+    rest_call(c, hm, &s_pwm_duty);
   } else if (mg_match(func, mg_str("stop"), NULL)) {
-    rest_call(c, hm, wrap_pwm_stop);
+    rest_call(c, hm, &s_pwm_stop);
   } else {
     mg_http_reply(c, 400, "", "{\"cause\": \"the rest api is not exist\"}\n");
   }
 }
 
+// Wakeups per loop and deadline timeouts per class, summed over the loops
+static size_t print_loops(void (*out)(char, void*), void* arg, va_list* ap) {
+  size_t n = mg_xprintf(out, arg, "%m:[", MG_ESC("wakeups"));
+  for (int i = 0; i < MG_LOOPS; i++) {
+    n += mg_xprintf(out, arg, "%s%lu", i ? "," : "", s_mgrs[i].wakeups);
+  }
+  n += mg_xprintf(out, arg, "],%m:[", MG_ESC("timeouts"));
+  for (int j = 0; j < MG_DL_CLASSES; j++) {
+    unsigned long sum = 0;
+    for (int i = 0; i < MG_LOOPS; i++) sum += s_mgrs[i].timeouts[j];
+    n += mg_xprintf(out, arg, "%s%lu", j ? "," : "", sum);
+  }
+  (void) ap;
+  return n + mg_xprintf(out, arg, "]");
+}
+
+static void rest_loop_handler(struct mg_connection* c) {
+  mg_http_reply(c, 200, JSON_HEADERS, "{%M}", print_loops);
+}
+
+static size_t print_slabs(void (*out)(char, void*), void* arg, va_list* ap) {
+  struct mg_slab_stats st[MG_SLAB_CLASSES];
+  size_t i, n = 0, count = mg_slab_stats(st, MG_SLAB_CLASSES);
+  for (i = 0; i < count && i < MG_SLAB_CLASSES; i++) {
+    n += mg_xprintf(out, arg, "%s{%m:%lu,%m:%lu,%m:%lu,%m:%lu,%m:%lu}",
+                    i ? "," : "", MG_ESC("size"), (unsigned long) st[i].size,
+                    MG_ESC("count"), (unsigned long) st[i].count,
+                    MG_ESC("used"), (unsigned long) st[i].used,
+                    MG_ESC("peak"), (unsigned long) st[i].peak,
+                    MG_ESC("fails"), (unsigned long) st[i].fails);
+  }
+  (void) ap;
+  return n;
+}
+
+static void rest_slab_handler(struct mg_connection* c) {
+  mg_http_reply(c, 200, JSON_HEADERS, "[%M]", print_slabs);
+}
+
 static void rest_system_handler(struct mg_connection* c, struct mg_http_message* hm,
                          struct mg_str func) {
   if (mg_match(func, mg_str("info"), NULL)) {
-    rest_call(c, hm, wrap_sys_info);
+    rest_call(c, hm, &s_sys_info);
   } else if (mg_match(func, mg_str("stats"), NULL)) {
-    rest_call(c, hm, wrap_sys_stats);
+    rest_call(c, hm, &s_sys_stats);
   } else if (mg_match(func, mg_str("led"), NULL)) {
-    rest_call(c, hm, wrap_sys_led);
+    rest_call(c, hm, &s_sys_led);
   } else if (mg_match(func, mg_str("digs"), NULL)) {
-    rest_call(c, hm, wrap_sys_digits);
+    rest_call(c, hm, &s_sys_digits);
+  } else if (mg_match(func, mg_str("loop"), NULL)) {
+    rest_loop_handler(c);
+  } else if (mg_match(func, mg_str("slab"), NULL)) {
+    rest_slab_handler(c);
   } else {
     mg_http_reply(c, 400, "", "{\"cause\": \"the rest api is not exist\"}\n");
   }
@@ -156,11 +558,11 @@ static void rest_logout_handler(struct mg_connection *c) {
 static void rest_wifi_handler(struct mg_connection* c,
                              struct mg_http_message* hm, struct mg_str func) {
   if (mg_match(func, mg_str("provisioned"), NULL)) {
-    rest_call(c, hm, wrap_wifi_provisioned);
+    rest_call(c, hm, &s_wifi_provisioned);
   } else if (mg_match(func, mg_str("scan"), NULL)) {
-    rest_call(c, hm, wrap_wifi_scan);
+    defer_start(c, NULL, &s_wifi_scan_op);
   } else if (mg_match(func, mg_str("connect"), NULL)) {
-    rest_call(c, hm, wrap_wifi_connect);
+    rest_call(c, hm, &s_wifi_connect);
   } else {
     mg_http_reply(c, 400, "", "{\"cause\": \"the rest api is not exist\"}\n");
   }
@@ -219,9 +621,12 @@ static void rest_handler(struct mg_connection* c, struct mg_http_message* hm,
 }
 
 static void fn(struct mg_connection* c, int ev, void* ev_data) {
+  defer_event(c, ev);
   if (ev == MG_EV_OPEN) {
     // c->is_hexdumping = 1;
   } else if (ev == MG_EV_ACCEPT) {
+    struct bucket* b = &((struct conn_state*) c->data)->bucket;
+    b->tokens = RATE_BURST, b->ms = (uint32_t) mg_millis();
     if (c->is_tls) {  // TLS listener!
       struct mg_tls_opts opts = {0};
       opts.cert = mg_unpacked("/certs/server_cert.pem");
@@ -250,13 +655,22 @@ static void fn(struct mg_connection* c, int ev, void* ev_data) {
       mg_http_serve_dir(c, ev_data, &opts);
     }
   } else if (ev == MG_EV_WS_MSG) {
+    // Print the response straight into the send buffer, then frame it
     struct mg_ws_message* wm = (struct mg_ws_message*)ev_data;
-    struct mg_iobuf io = {0, 0, 0, 512};
-    struct mg_rpc_req r = {&s_rpc_head, 0, mg_pfn_iobuf, &io, 0, wm->data};
+    size_t ofs = c->send.len;
+    struct mg_rpc_req r = {&s_rpc_head, 0, mg_pfn_iobuf, &c->send, c, wm->data};
     mg_rpc_process(&r);
-    if (io.buf)
-      mg_ws_send(c, (char*)io.buf, io.len, WEBSOCKET_OP_TEXT);
-    mg_iobuf_free(&io);
+    if (c->send.len > ofs)
+      mg_ws_wrap(c, c->send.len - ofs, WEBSOCKET_OP_TEXT);
+  } else if (ev > MG_EV_WIFI && ev <= MG_EV_WIFI_SCAN_FAILED &&
+             c->is_websocket) {
+    // Posted by wifi.c from the WiFi event task. Tell the web UI
+    static const char* names[] = {"sta_start", "sta_connected",
+                                  "sta_disconnected", "sta_got_ip",
+                                  "scan_done", "scan_failed"};
+    mg_ws_printf(c, WEBSOCKET_OP_TEXT, "{%m:%m,%m:{%m:%m}}", MG_ESC("method"),
+                 MG_ESC("wifi"), MG_ESC("params"), MG_ESC("event"),
+                 MG_ESC(names[ev - MG_EV_WIFI - 1]));
   } else if (ev == MG_EV_CLOSE && c->is_tls) {
     mg_free(s_ca.buf);
     mg_free(s_cert.buf);
@@ -275,6 +689,21 @@ static void timer_fn(void *arg) {
   }
 }
 
+// Serve I/O, and run a queued call between polls. Responses are sent by the
+// poll after the one that read the request: that poll goes first, so they do
+// not wait for the queued call
+static void loop_task(void *arg) {
+  struct mg_mgr *mgr = (struct mg_mgr *) arg;
+  struct sched *s = &s_scheds[mgr - s_mgrs];
+  for (;;) {
+    mg_mgr_poll(mgr, s->len > 0 ? 0 : -1);
+    if (s->len > 0) {
+      mg_mgr_poll(mgr, 0);
+      sched_run(mgr);
+    }
+  }
+}
+
 void app_main() {
   esp_err_t ret = nvs_flash_init();
   if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -282,12 +711,23 @@ void app_main() {
     ret = nvs_flash_init();
   }
   ESP_ERROR_CHECK(ret);
-  wifi_init();
 
-  struct mg_mgr mgr;
-  mg_mgr_init(&mgr);
+  struct mg_mgr *shards[MG_LOOPS];
+  s_hw_lock = xSemaphoreCreateMutex();
+  s_hw_state = xSemaphoreCreateMutex();
+  s_hw_events = xEventGroupCreate();
+  xEventGroupSetBits(s_hw_events, HW_CLEAR);
+  wrap_init();
+  for (int i = 0; i < MG_LOOPS; i++) {
+    mg_mgr_init(&s_mgrs[i]);
+    mg_wakeup_init(&s_mgrs[i]);
+    shards[i] = &s_mgrs[i];
+  }
+  wifi_init(s_mgrs, MG_LOOPS);
+  mg_mgr_shard(&s_mgrs[0], shards, MG_LOOPS);
+  struct mg_mgr *mgr = &s_mgrs[0];
 
-  //mg_timer_add(&mgr, 5000, MG_TIMER_REPEAT, timer_fn, &mgr);  // Init timer
+  //mg_timer_add(mgr, 5000, MG_TIMER_REPEAT, timer_fn, mgr);  // Init timer
   mg_rpc_add(&s_rpc_head, mg_str("gpio_config"), rpc_gpio_config, NULL);
   mg_rpc_add(&s_rpc_head, mg_str("gpio_info"), rpc_gpio_info, NULL);
   mg_rpc_add(&s_rpc_head, mg_str("gpio_mode"), rpc_gpio_mode, NULL);
@@ -296,15 +736,40 @@ void app_main() {
   mg_rpc_add(&s_rpc_head, mg_str("pwm_duty"), rpc_pwm_duty, NULL);
   mg_rpc_add(&s_rpc_head, mg_str("pwm_stop"), rpc_pwm_stop, NULL);
   mg_rpc_add(&s_rpc_head, mg_str("sys_info"), rpc_sys_info, NULL);
+  mg_rpc_add(&s_rpc_head, mg_str("wifi_scan"), rpc_wifi_scan, NULL);
   mg_rpc_add(&s_rpc_head, mg_str("rpc.list"), mg_rpc_list, &s_rpc_head);
 
+  if (MQTT_URL[0] != '\0') {
+    static char device[20];
+    uint8_t mac[6] = {};
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    mg_snprintf(device, sizeof(device), "esp32-%02x%02x%02x%02x%02x%02x",
+                mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    struct mqtt_rpc_opts opts = {
+        .url = MQTT_URL,
+        .user = MQTT_USER,
+        .pass = MQTT_PASS,
+        .prefix = "devices",
+        .device = device,
+        .group = "all",
+        .head = &s_rpc_head,
+    };
+    mqtt_rpc_init(mgr, &opts);
+  }
+
   MG_INFO(("Starting http listener on %s", s_http_url));
   MG_INFO(("Starting https listener on %s", s_https_url));
 
-  mg_http_listen(&mgr, s_http_url, fn, NULL);
-  mg_http_listen(&mgr, s_https_url, fn, NULL);
-  for (;;)
-    mg_mgr_poll(&mgr, 10);
-  mg_mgr_free(&mgr);
+  const char *urls[] = {s_http_url, s_https_url};
+  for (size_t i = 0; i < sizeof(urls) / sizeof(urls[0]); i++) {
+    struct mg_connection *lsn = mg_http_listen(mgr, urls[i], fn, NULL);
+    if (lsn != NULL) lsn->deadlines = &s_deadlines;
+  }
+  for (int i = 1; i < MG_LOOPS; i++) {
+    xTaskCreatePinnedToCore(loop_task, "mg_loop", 8192, &s_mgrs[i], 5, NULL,
+                            i % portNUM_PROCESSORS);
+  }
+  loop_task(mgr);
+  mg_mgr_free(mgr);
   mg_rpc_del(&s_rpc_head, NULL);
 }
@@ -0,0 +1,179 @@
+#include "mqtt_rpc.h"
+
+#define MQTT_RPC_TOPIC_LEN 96
+#define MQTT_RPC_TICK_MS 1000
+#define MQTT_RPC_KEEPALIVE 60          // Seconds, pings go at half of that
+#define MQTT_RPC_CONNECT_MS 10000      // Wait for CONNACK
+#define MQTT_RPC_ACK_MS 10000          // Wait for PUBACK of a response
+#define MQTT_RPC_BACKOFF_MIN_MS 1000   // First reconnect delay, doubles on
+#define MQTT_RPC_BACKOFF_MAX_MS 64000  // each failure up to this
+
+static struct mqtt_rpc {
+  struct mg_mgr *mgr;
+  struct mqtt_rpc_opts opts;
+  struct mg_connection *conn;  // NULL if there is none
+  bool online;                 // Got CONNACK, subscribed
+  uint64_t retry_ms;           // Next connection attempt
+  unsigned backoff_ms;         // Delay before the attempt after that
+  uint64_t rx_ms;              // Last data from the broker
+  uint64_t ping_ms;            // Last PINGREQ
+  struct mg_iobuf resp;        // Response being printed, reused
+  struct {
+    uint16_t id;  // Packet ID, 0 if the slot is free
+    uint64_t ms;  // Published at
+  } inflight[MQTT_RPC_WINDOW];
+  char req_topic[MQTT_RPC_TOPIC_LEN];
+  char group_topic[MQTT_RPC_TOPIC_LEN];
+  char reply_topic[MQTT_RPC_TOPIC_LEN];
+  char status_topic[MQTT_RPC_TOPIC_LEN];
+} s_mq;
+
+static int inflight_slot(uint16_t id) {
+  for (int i = 0; i < MQTT_RPC_WINDOW; i++) {
+    if (s_mq.inflight[i].id == id) return i;
+  }
+  return -1;
+}
+
+// Jitter spreads the reconnects of a fleet after a broker restart
+static void mq_retry_later(void) {
+  unsigned ms = s_mq.backoff_ms, r = 0;
+  mg_random(&r, sizeof(r));
+  s_mq.retry_ms = mg_millis() + ms / 2 + r % (ms / 2 + 1);
+  s_mq.backoff_ms = ms * 2 > MQTT_RPC_BACKOFF_MAX_MS ? MQTT_RPC_BACKOFF_MAX_MS
+                                                     : ms * 2;
+  MG_INFO(("MQTT reconnect in %lu ms",
+           (unsigned long) (s_mq.retry_ms - mg_millis())));
+}
+
+static void mq_pub(struct mg_connection *c, const char *topic,
+                   struct mg_str msg, uint8_t qos, bool retain) {
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.topic = mg_str(topic);
+  opts.message = msg;
+  opts.qos = qos;
+  opts.retain = retain;
+  mg_mqtt_pub(c, &opts);
+}
+
+static void mq_sub(struct mg_connection *c, const char *topic) {
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.topic = mg_str(topic);
+  opts.qos = 1;
+  mg_mqtt_sub(c, &opts);
+}
+
+// Responses are published at QoS 1, at most MQTT_RPC_WINDOW unacknowledged.
+// With the window full, the request is refused by a QoS 0 error response
+static void mq_request(struct mg_connection *c, struct mg_str frame) {
+  struct mg_rpc_req r = {s_mq.opts.head, 0, mg_pfn_iobuf, &s_mq.resp, 0, frame};
+  struct mg_mqtt_opts opts;
+  int slot = inflight_slot(0);
+  s_mq.resp.len = 0;
+  if (slot < 0) {
+    mg_rpc_err(&r, -32000, "%m", MG_ESC("Busy"));
+  } else {
+    mg_rpc_process(&r);
+  }
+  if (s_mq.resp.len == 0) return;  // Notification: nothing to answer
+  memset(&opts, 0, sizeof(opts));
+  opts.topic = mg_str(s_mq.reply_topic);
+  opts.message = mg_str_n((char *) s_mq.resp.buf, s_mq.resp.len);
+  opts.qos = slot < 0 ? 0 : 1;
+  if (slot >= 0) {
+    s_mq.inflight[slot].id = mg_mqtt_pub(c, &opts);
+    s_mq.inflight[slot].ms = mg_millis();
+  } else {
+    mg_mqtt_pub(c, &opts);
+  }
+}
+
+static void mq_fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_READ) {
+    s_mq.rx_ms = mg_millis();
+  } else if (ev == MG_EV_MQTT_OPEN && *(uint8_t *) ev_data == 0) {
+    MG_INFO(("MQTT %s connected, serving %s", s_mq.opts.url, s_mq.req_topic));
+    s_mq.online = true;
+    s_mq.backoff_ms = MQTT_RPC_BACKOFF_MIN_MS;
+    memset(s_mq.inflight, 0, sizeof(s_mq.inflight));
+    mq_sub(c, s_mq.req_topic);
+    mq_sub(c, s_mq.group_topic);
+    mq_pub(c, s_mq.status_topic, mg_str("online"), 1, true);
+  } else if (ev == MG_EV_MQTT_OPEN) {
+    mg_error(c, "CONNACK code %d", *(uint8_t *) ev_data);  // Refused
+  } else if (ev == MG_EV_MQTT_MSG) {
+    struct mg_mqtt_message *mm = (struct mg_mqtt_message *) ev_data;
+    mq_request(c, mm->data);
+  } else if (ev == MG_EV_MQTT_CMD) {
+    struct mg_mqtt_message *mm = (struct mg_mqtt_message *) ev_data;
+    int slot = mm->id == 0 ? -1 : inflight_slot(mm->id);
+    if (mm->cmd == MQTT_CMD_PUBACK && slot >= 0) s_mq.inflight[slot].id = 0;
+  } else if (ev == MG_EV_ERROR) {
+    MG_ERROR(("MQTT %s: %s", s_mq.opts.url, (char *) ev_data));
+  } else if (ev == MG_EV_CLOSE) {
+    s_mq.conn = NULL;
+    s_mq.online = false;
+    mq_retry_later();
+  }
+}
+
+static void mq_connect(void) {
+  struct mg_mqtt_opts opts;
+  memset(&opts, 0, sizeof(opts));
+  opts.user = mg_str(s_mq.opts.user);
+  opts.pass = mg_str(s_mq.opts.pass);
+  opts.client_id = mg_str(s_mq.opts.device);
+  opts.keepalive = MQTT_RPC_KEEPALIVE;
+  opts.clean = true;
+  opts.topic = mg_str(s_mq.status_topic);  // Last will
+  opts.message = mg_str("offline");
+  opts.qos = 1;
+  opts.retain = true;
+  s_mq.rx_ms = s_mq.ping_ms = mg_millis();
+  s_mq.conn = mg_mqtt_connect(s_mq.mgr, s_mq.opts.url, &opts, mq_fn, NULL);
+  if (s_mq.conn == NULL) mq_retry_later();
+}
+
+// Reconnect, ping, and notice a broker that went away without closing
+static void mq_timer_fn(void *arg) {
+  uint64_t now = mg_millis();
+  struct mg_connection *c = s_mq.conn;
+  unsigned dead_ms =
+      s_mq.online ? MQTT_RPC_KEEPALIVE * 1500 : MQTT_RPC_CONNECT_MS;
+  if (c == NULL) {
+    if (now >= s_mq.retry_ms) mq_connect();
+  } else if (now - s_mq.rx_ms > dead_ms) {
+    mg_error(c, "no response");
+  } else if (s_mq.online) {
+    for (int i = 0; i < MQTT_RPC_WINDOW; i++) {  // Lost with a broker crash
+      if (now - s_mq.inflight[i].ms > MQTT_RPC_ACK_MS) s_mq.inflight[i].id = 0;
+    }
+    if (now - s_mq.ping_ms >= MQTT_RPC_KEEPALIVE * 500) {
+      mg_mqtt_ping(c);
+      s_mq.ping_ms = now;
+    }
+  }
+  (void) arg;
+}
+
+bool mqtt_rpc_init(struct mg_mgr *mgr, const struct mqtt_rpc_opts *opts) {
+  const char *p = opts->prefix, *d = opts->device, *g = opts->group;
+  size_t n = sizeof(s_mq.req_topic);
+  if (mg_snprintf(s_mq.req_topic, n, "%s/%s/rpc", p, d) >= n ||
+      mg_snprintf(s_mq.group_topic, n, "%s/%s/rpc", p, g) >= n ||
+      mg_snprintf(s_mq.reply_topic, n, "%s/%s/rpc/reply", p, d) >= n ||
+      mg_snprintf(s_mq.status_topic, n, "%s/%s/status", p, d) >= n) {
+    MG_ERROR(("MQTT topic prefix or device ID is too long"));
+    return false;
+  }
+  s_mq.mgr = mgr;
+  s_mq.opts = *opts;
+  s_mq.resp.align = 64;
+  s_mq.backoff_ms = MQTT_RPC_BACKOFF_MIN_MS;
+  s_mq.retry_ms = 0;  // Connect on the first tick
+  mg_timer_add(mgr, MQTT_RPC_TICK_MS, MG_TIMER_REPEAT | MG_TIMER_RUN_NOW,
+               mq_timer_fn, NULL);
+  return true;
+}
@@ -0,0 +1,29 @@
+#ifndef MQTT_RPC_H
+#define MQTT_RPC_H
+
+#include "mongoose.h"
+
+// JSON-RPC over MQTT, for devices behind NAT. Topics:
+//   <prefix>/<device>/rpc        requests to this device
+//   <prefix>/<group>/rpc         requests to every device of the group
+//   <prefix>/<device>/rpc/reply  responses, matched to requests by JSON-RPC id
+//   <prefix>/<device>/status     "online", or "offline" as the last will
+#ifndef MQTT_RPC_WINDOW
+#define MQTT_RPC_WINDOW 8  // Responses published and not yet acknowledged
+#endif
+
+struct mqtt_rpc_opts {
+  const char *url;     // Broker, e.g. mqtt://10.0.0.1:1883
+  const char *user;    // Credentials, NULL for none
+  const char *pass;
+  const char *prefix;  // Topic prefix, e.g. "devices"
+  const char *device;  // Device ID, unique within the fleet. Also client ID
+  const char *group;   // Group of devices for broadcasts, e.g. "all"
+  struct mg_rpc **head;  // RPC methods, see mg_rpc_add()
+};
+
+// Keep a connection to the broker on manager mgr, reconnecting with backoff.
+// Requests are served by mg_rpc_process() on that manager's loop
+bool mqtt_rpc_init(struct mg_mgr *mgr, const struct mqtt_rpc_opts *opts);
+
+#endif
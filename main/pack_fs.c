@@ -1,7 +1,8 @@
 // DO NOT EDIT. This file is generated using this command:
-// /usr/bin/node /home/wanch/Project/esp32_mg_server/tool/pack.js web_root/bundle.js::gzip web_root/components.js::gzip web_root/history.min.js::gzip web_root/index.html::gzip web_root/main.js::gzip web_root/tailwind.css::gzip certs/server_cert.pem certs/server_key.pem
+// node tool/pack.js web_root/bundle.js::br,gzip,identity,immutable web_root/components.js::br,gzip,identity,immutable web_root/history.min.js::br,gzip,identity,immutable web_root/index.html::br,gzip,identity web_root/main.js::br,gzip,identity,immutable web_root/tailwind.css::br,gzip,identity,immutable certs/server_cert.pem certs/server_key.pem
 
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 
@@ -11,47 +12,156 @@ extern "C" {
 
 const char *mg_unlist(size_t no);
 const char *mg_unpack(const char *, size_t *, time_t *);
+const char *mg_unpack_http(const char *, size_t *, const char **,
+                           const char **);
+int mg_unpack_dir(const char *);
 
 #if defined(__cplusplus)
 }
 #endif
 
-static const unsigned char v0[] = {31,139,8,0,0,0,0,0,0,3,157,92,11,119,219,182,146,254,43,17,215,199,151,168,96,217,114,154,238,45,21,68,39,117,210,58,110,234,228,58,143,62,84,85,71,166,32,139,53,69,170,124,248,81,75,251,219,247,155,1,64,82,54,157,189,123,207,73,68,16,0,129,193,204,96,158,128,175,166,217,147,68,22,82,203,137,204,100,42,75,25,201,88,134,114,42,231,50,151,43,117,183,145,11,53,26,203,153,218,159,134,81,177,214,55,254,48,200,215,23,235,100,189,90,239,136,117,182,90,172,47,178,104,182,78,175,243,245,50,9,215,73,113,189,142,18,61,10,23,227,245,223,105,186,254,35,205,102,235,168,208,217,116,63,146,87,234,101,150,77,111,123,81,206,207,193,188,76,194,34,74,147,39,75,31,64,136,187,121,154,249,87,128,72,63,137,146,39,133,72,70,122,172,10,252,12,50,93,148,89,242,36,217,84,95,220,250,137,184,75,118,119,147,222,106,154,233,164,56,77,103,122,251,173,151,233,101,122,165,143,22,81,60,67,231,250,211,11,159,215,43,238,104,42,187,104,44,116,64,179,151,52,179,22,222,165,190,245,148,42,135,153,210,163,114,28,120,153,158,243,123,106,222,35,252,112,105,16,205,253,105,118,81,46,49,105,222,139,117,114,81,44,94,28,238,238,250,81,47,164,137,1,140,122,208,254,116,152,244,194,105,28,215,95,202,67,17,76,132,244,28,140,152,171,184,93,233,116,254,164,192,162,202,56,238,168,162,55,211,243,105,25,23,239,179,116,149,139,10,216,123,245,87,105,52,123,114,160,148,34,16,9,14,130,116,187,15,106,132,195,232,57,112,17,49,229,105,150,6,146,206,65,17,203,18,6,81,64,17,129,20,36,114,69,131,4,19,9,28,5,153,4,102,130,84,78,38,151,1,141,128,130,123,158,7,7,248,213,238,53,52,133,48,77,242,34,43,195,34,205,2,3,43,218,174,184,141,240,219,237,234,160,68,77,20,236,245,241,40,131,131,77,69,124,211,165,198,199,85,194,52,183,5,63,18,50,170,225,191,244,197,157,249,240,46,44,51,226,9,158,99,83,247,56,34,14,114,99,87,212,170,219,111,12,79,22,139,40,239,241,146,21,222,233,5,75,40,244,77,161,138,186,239,181,233,11,102,48,80,22,162,26,120,50,25,162,21,15,73,63,81,183,47,24,144,65,197,235,131,226,57,181,92,90,238,24,20,221,174,176,3,117,148,175,21,55,142,138,177,112,43,215,168,208,110,2,126,177,40,106,97,159,164,71,5,130,192,76,91,131,252,137,150,79,0,96,51,12,234,249,18,158,175,154,139,94,66,179,49,169,104,160,9,123,231,211,28,69,162,103,161,14,254,195,5,220,61,24,208,172,229,60,211,211,203,141,93,30,65,217,160,217,49,1,237,119,232,155,25,152,155,159,170,115,128,145,179,222,170,204,23,104,222,221,237,188,71,117,214,237,174,215,169,217,54,231,41,190,215,103,58,153,233,44,74,46,208,197,247,211,214,150,245,186,20,254,251,198,54,120,239,215,82,41,97,41,73,226,130,37,164,234,15,50,183,100,225,74,47,166,4,74,158,102,5,241,99,162,80,94,68,243,194,23,232,239,250,72,7,254,68,217,29,144,186,66,169,0,24,161,76,160,203,21,253,104,25,147,252,13,233,135,240,243,158,128,159,168,165,15,201,156,10,238,166,82,250,237,246,229,131,45,1,145,242,179,207,95,49,224,84,74,204,40,189,100,186,212,249,106,26,234,79,103,111,228,211,195,93,26,163,28,146,108,99,178,198,210,237,200,107,63,21,216,146,157,142,239,122,9,25,10,57,169,103,230,50,211,152,126,163,177,154,200,239,125,108,121,234,150,50,141,233,215,176,11,245,208,29,218,197,159,0,157,16,3,166,149,58,168,49,254,218,111,213,71,134,87,73,41,205,228,149,92,202,91,121,33,207,213,100,119,151,103,94,175,23,242,18,20,181,228,32,138,197,234,131,175,49,210,57,190,191,20,114,14,62,157,63,191,28,204,193,156,150,51,103,204,112,151,163,57,113,166,159,171,189,190,82,51,90,193,112,21,156,143,184,52,94,175,87,146,75,106,46,111,213,207,128,109,6,16,182,33,131,90,155,49,165,102,80,57,243,221,221,156,30,29,101,223,252,220,60,223,153,2,227,85,206,192,15,134,97,185,23,79,17,174,215,87,104,16,22,243,75,183,91,174,48,198,82,93,9,233,95,40,80,225,235,221,25,19,1,188,154,19,248,202,0,125,57,140,213,75,127,70,132,147,23,34,104,17,5,51,22,5,187,187,134,213,58,74,221,226,147,219,128,134,143,213,85,47,129,72,251,16,157,199,180,13,24,158,114,87,237,253,119,165,40,120,111,170,165,108,72,144,15,53,165,12,117,26,72,1,106,45,179,207,213,84,230,132,124,43,66,46,85,162,175,159,176,254,247,51,48,8,154,210,231,217,32,173,233,82,66,231,167,68,19,239,60,77,99,61,77,188,142,91,3,248,166,94,89,93,59,244,61,40,21,64,94,175,182,92,175,189,164,92,158,235,108,187,238,60,186,136,146,98,171,174,236,53,148,146,82,31,120,164,97,105,229,86,58,86,231,44,203,176,56,126,84,63,34,184,242,75,177,221,241,72,222,57,77,18,148,155,7,31,216,77,213,156,112,119,183,196,231,231,47,14,182,7,42,153,90,178,52,170,7,79,104,91,252,130,89,134,252,107,182,105,201,98,34,168,190,131,104,82,105,55,231,122,168,43,30,153,71,61,135,120,216,235,3,185,161,42,153,157,95,249,37,72,23,203,185,32,230,159,239,237,73,63,130,69,19,242,94,136,136,252,107,117,88,49,99,180,94,219,2,77,56,244,105,171,132,232,152,189,152,14,243,189,189,32,123,14,185,151,131,132,178,141,60,150,241,252,210,12,251,181,16,65,216,81,49,106,66,165,226,189,62,15,65,197,46,138,221,110,224,135,47,98,174,195,139,172,63,106,172,147,53,40,116,204,156,237,32,195,67,211,38,15,209,90,152,135,96,10,249,135,187,188,32,183,50,173,72,110,64,136,94,67,70,11,249,167,31,73,60,29,163,79,106,6,127,233,24,188,50,21,105,206,71,181,172,209,20,153,161,34,51,54,136,11,222,118,82,137,192,203,0,21,225,13,15,67,162,2,187,150,222,236,68,21,24,197,38,49,162,178,32,80,241,159,12,65,139,200,78,177,101,244,250,133,34,253,46,32,217,163,36,215,89,241,157,6,32,218,40,108,89,24,210,161,185,96,200,180,24,204,210,187,130,198,45,154,155,126,115,13,190,213,86,107,163,241,159,88,93,143,180,200,71,90,90,13,86,133,157,83,99,243,184,6,133,137,160,163,12,155,36,180,211,236,230,173,177,180,94,251,87,0,20,214,111,158,46,181,239,187,161,72,169,155,209,54,32,114,225,52,57,32,174,103,123,245,128,22,108,182,39,188,47,98,101,80,3,53,73,238,2,196,143,89,70,232,232,31,50,253,7,149,125,70,45,21,103,131,117,35,212,208,72,187,187,49,149,152,154,78,240,209,87,147,23,254,116,216,15,14,132,48,36,214,176,78,225,10,116,97,2,188,80,7,48,52,158,87,186,167,97,250,16,52,165,162,30,195,12,220,12,250,215,28,25,90,142,252,194,204,165,69,250,94,191,70,195,71,131,6,113,231,237,17,98,71,7,99,194,166,102,195,30,148,191,133,57,111,214,165,135,158,23,104,108,25,24,94,170,81,229,132,98,181,59,245,122,13,205,160,243,194,47,196,80,7,186,235,173,110,188,122,194,179,22,33,63,72,2,218,7,121,113,27,107,130,66,152,183,109,1,172,5,0,163,30,189,48,207,63,146,189,172,7,58,206,245,93,91,231,9,27,115,219,221,39,202,243,96,103,48,198,11,242,116,38,130,76,27,118,208,214,235,143,174,63,160,67,63,34,146,174,187,106,129,17,53,45,93,77,240,187,221,157,234,197,134,96,121,66,176,164,22,145,80,45,204,172,163,254,88,192,58,4,253,192,211,16,181,171,24,86,18,236,25,111,167,239,129,39,161,157,122,69,250,54,189,214,217,17,140,86,159,246,21,59,98,196,243,105,242,125,26,150,249,187,146,53,76,93,241,134,71,134,228,206,227,8,131,29,18,151,187,34,204,193,24,59,3,191,112,66,249,109,84,116,33,227,180,212,195,201,80,247,74,53,233,149,129,79,133,16,173,211,217,236,245,21,246,254,219,40,47,116,162,177,96,153,14,231,193,148,172,65,8,72,227,244,62,214,163,166,192,162,40,86,193,254,254,245,245,117,239,250,105,47,205,46,246,15,15,14,14,246,243,43,162,74,38,154,75,223,191,129,124,184,244,143,215,193,66,236,75,111,225,137,186,41,63,133,29,185,131,218,220,51,131,51,74,175,163,89,177,240,88,140,120,11,29,93,44,10,247,66,126,180,41,198,128,206,22,65,182,165,45,22,211,243,55,48,198,111,236,235,44,189,78,226,116,58,179,175,89,122,253,97,101,236,1,188,133,105,220,120,203,32,109,108,113,149,174,128,131,204,188,49,63,36,162,200,110,239,238,239,5,235,107,60,73,54,225,180,8,73,228,220,109,90,164,187,38,234,152,175,214,235,14,52,159,2,31,98,255,97,248,209,215,180,255,12,206,95,22,96,234,243,178,208,216,72,1,111,202,70,141,172,128,82,4,84,191,218,160,77,239,230,167,134,71,90,201,70,205,110,37,59,158,177,217,129,19,101,222,70,154,197,69,55,25,215,130,13,85,2,255,85,216,237,86,228,192,251,115,176,144,21,43,149,158,243,139,158,38,54,25,218,39,102,2,60,155,6,60,100,238,126,193,16,95,201,5,172,97,152,225,242,82,94,203,79,242,88,190,151,31,228,75,121,42,95,201,143,242,76,25,240,106,223,82,55,205,30,209,240,234,7,253,195,127,178,29,95,178,73,96,92,141,137,113,53,74,53,138,141,99,168,216,119,24,195,14,158,131,57,97,210,64,122,210,166,183,210,232,33,221,206,152,232,104,187,196,0,198,140,186,86,30,10,69,74,61,60,240,197,217,238,238,89,175,170,1,33,201,17,148,159,20,166,56,115,126,62,235,63,120,117,163,57,25,233,99,121,172,230,195,79,195,79,102,196,222,213,52,46,117,64,77,65,198,222,77,56,60,87,112,38,8,228,144,65,14,201,73,83,100,171,191,14,252,235,161,105,200,217,10,62,243,47,229,177,8,252,102,221,13,215,201,124,203,40,61,147,185,5,78,125,22,242,19,188,167,94,94,158,251,57,245,203,139,105,65,44,106,75,44,68,104,54,56,159,114,197,243,146,139,204,85,28,202,67,33,63,71,65,200,107,167,4,169,45,103,87,5,79,101,7,170,218,59,192,197,133,46,94,193,69,190,210,179,15,212,246,125,150,46,57,150,84,125,228,190,170,42,216,67,229,34,132,230,210,84,202,199,7,194,170,109,103,33,23,202,70,92,228,204,13,203,141,87,144,137,43,81,65,253,37,168,12,220,132,196,229,42,77,192,221,63,71,113,252,19,188,253,130,252,179,135,181,126,99,181,141,246,87,209,172,250,8,232,51,150,73,75,123,45,88,255,45,232,46,225,125,45,30,1,242,76,135,26,223,216,158,95,104,52,124,162,25,47,204,104,87,144,78,4,166,174,71,206,23,105,25,207,142,220,16,159,86,51,38,17,11,177,71,90,29,33,48,184,49,104,121,134,142,153,129,169,107,130,97,151,142,245,12,247,72,203,104,125,3,146,221,173,92,190,228,242,165,41,183,152,126,137,141,228,40,77,246,159,124,15,195,249,253,115,230,82,103,83,189,135,229,188,69,0,180,141,222,143,197,192,241,178,225,110,219,29,70,149,237,39,42,1,223,138,106,135,142,214,234,6,30,30,99,141,250,251,10,180,122,97,226,174,173,179,207,34,147,214,185,1,179,212,177,196,99,217,196,235,100,242,30,174,1,211,18,24,149,31,88,222,101,242,165,58,144,215,134,40,237,184,151,31,118,119,63,64,36,194,233,118,242,194,209,75,214,27,201,206,41,228,41,48,125,186,141,233,211,54,76,159,54,48,109,236,38,120,16,255,225,156,91,128,91,159,35,55,241,176,110,247,229,243,195,103,52,85,115,109,14,241,216,77,28,202,63,50,35,145,19,5,25,195,82,38,163,97,239,181,251,36,72,64,183,206,170,166,29,186,124,72,166,43,176,189,117,145,28,1,253,139,199,91,137,98,24,234,149,154,91,80,230,80,59,172,217,176,135,142,220,110,159,27,27,222,127,165,222,248,115,171,26,92,32,0,95,199,138,194,90,87,254,43,49,124,21,140,94,141,91,212,42,150,80,7,65,121,175,80,0,166,255,77,255,49,222,150,231,86,214,190,102,76,41,19,192,175,44,25,86,252,36,27,76,216,221,120,129,29,85,178,127,210,43,22,128,171,218,222,240,175,195,97,255,155,131,0,138,120,16,179,239,23,87,190,31,60,147,166,159,56,16,177,218,174,40,71,37,28,79,24,109,239,230,126,44,140,133,101,133,64,204,236,194,243,124,84,165,99,178,143,123,123,3,113,235,151,163,143,96,172,183,224,29,195,84,143,201,13,3,237,122,77,61,7,180,19,180,177,75,236,103,85,94,160,41,10,135,254,125,201,99,71,22,129,51,39,118,124,59,85,131,20,68,8,107,32,177,149,49,139,230,115,61,179,134,134,36,51,133,209,53,52,49,180,160,17,12,123,91,229,163,160,202,173,64,11,205,6,62,128,81,111,26,46,237,163,7,132,188,158,130,78,111,27,161,230,239,237,170,170,120,115,70,17,4,88,110,22,107,25,182,230,59,127,50,202,198,114,50,234,118,171,135,193,73,72,238,60,30,190,150,9,57,17,247,196,44,172,72,182,128,121,237,11,70,8,27,3,109,174,184,77,78,177,52,174,249,169,66,60,135,156,54,212,86,129,254,166,54,92,189,244,252,79,29,22,181,127,153,184,208,17,21,200,108,51,56,160,128,87,18,216,112,192,114,186,242,223,136,128,55,115,51,83,183,227,127,193,252,36,73,186,52,230,167,202,204,150,163,104,237,17,232,108,164,207,13,74,206,2,245,140,99,115,51,44,213,151,92,159,192,91,78,225,185,60,218,177,255,237,183,255,220,255,9,93,248,231,167,183,94,80,194,242,122,172,235,183,251,55,139,98,25,123,194,74,142,136,29,84,19,137,142,170,88,181,201,150,248,75,21,153,72,180,215,244,28,200,72,93,42,152,196,55,224,169,155,225,178,23,167,32,14,57,93,128,49,120,170,212,178,142,209,136,59,10,208,210,40,38,62,102,18,41,181,107,208,200,79,221,56,243,123,6,239,148,50,144,189,16,157,11,77,142,55,5,149,252,35,88,52,234,94,227,235,88,211,219,233,7,191,148,55,242,168,23,193,62,57,18,146,184,157,152,99,105,56,112,233,79,100,132,90,54,5,34,134,100,211,152,151,226,213,71,235,117,72,219,21,226,117,202,111,190,45,31,213,118,84,164,34,98,20,195,137,70,148,18,96,16,123,157,208,73,116,131,207,75,74,82,27,164,234,222,212,33,46,111,226,247,114,4,244,54,27,9,211,156,2,25,3,129,108,194,115,124,122,78,190,226,37,145,99,169,40,47,32,61,39,195,193,18,243,134,131,59,155,38,23,58,75,203,60,190,253,160,139,55,9,188,236,227,143,96,7,234,181,80,203,170,99,199,12,121,36,24,247,30,207,68,157,200,181,53,25,217,207,92,69,125,214,107,204,166,195,75,61,219,238,113,100,43,121,28,210,163,81,2,112,207,176,53,108,50,97,41,75,236,25,7,254,145,88,170,163,7,176,15,103,106,25,124,9,236,97,78,29,42,0,135,23,244,218,128,7,94,205,50,8,91,195,239,203,245,154,144,5,194,162,100,224,90,74,70,159,9,185,229,2,218,103,97,149,21,109,8,24,191,182,100,114,24,166,142,162,151,22,32,193,44,81,189,42,215,201,164,157,46,33,184,42,12,211,184,205,174,20,51,122,237,123,133,94,174,98,240,172,167,172,16,24,106,99,131,36,69,160,161,136,103,98,56,11,70,179,177,21,47,20,130,208,209,69,242,206,8,47,218,255,95,222,210,129,17,72,209,48,26,29,140,131,204,200,246,107,63,147,16,246,172,205,183,119,124,189,219,141,234,227,173,62,0,90,208,102,145,46,201,51,189,200,116,158,211,244,206,174,184,24,234,7,225,5,251,129,201,38,116,212,5,217,47,112,40,52,198,4,15,109,143,210,185,160,32,212,202,58,198,168,64,79,155,241,50,148,186,112,148,194,22,170,232,109,161,135,168,62,239,240,184,174,247,185,235,45,92,130,86,215,210,250,157,83,96,214,237,110,11,148,219,232,173,106,13,162,67,179,82,200,156,11,112,200,50,135,4,14,192,80,165,34,69,230,212,126,207,230,245,149,126,168,164,38,205,176,202,159,14,174,70,16,191,232,149,201,210,120,118,85,17,3,72,14,223,103,122,78,185,130,204,205,64,41,93,91,52,25,113,0,244,14,180,54,134,142,112,196,182,161,255,208,108,246,236,158,83,97,230,224,144,68,123,147,223,166,108,129,103,99,22,102,198,41,176,210,212,38,25,26,217,143,150,44,195,159,38,177,128,165,131,7,30,110,91,155,180,24,160,245,214,228,10,4,103,166,67,30,219,172,211,230,165,107,92,126,118,241,103,23,246,183,7,34,92,164,194,192,92,117,255,203,127,152,30,28,76,84,165,89,56,13,83,169,25,87,176,138,70,72,66,131,209,42,52,142,48,233,241,22,214,201,96,68,0,51,65,70,148,226,116,176,177,251,34,50,113,56,127,254,51,180,146,86,126,39,69,15,180,10,22,35,23,254,145,161,225,136,194,74,37,89,15,43,72,152,173,212,56,127,49,132,209,21,148,102,142,73,111,30,101,185,241,53,220,57,158,73,83,65,153,204,92,100,191,204,240,29,165,176,244,214,135,16,57,16,102,223,251,17,229,224,26,248,250,206,228,84,254,98,44,127,215,104,248,177,229,204,18,86,198,22,83,97,236,29,49,104,156,9,50,137,34,243,220,58,252,67,57,48,213,82,15,183,253,255,60,245,20,211,89,162,234,128,145,230,3,70,86,206,13,233,156,81,192,39,162,44,103,180,158,138,138,255,147,83,81,231,190,129,23,242,22,180,43,56,227,147,82,193,165,211,27,120,250,155,118,79,245,86,184,51,46,64,221,160,201,177,247,156,69,82,55,28,124,131,86,148,224,200,187,141,24,177,53,61,230,80,171,108,251,70,53,60,253,42,117,232,14,8,61,220,221,205,238,230,232,140,237,220,26,132,81,77,123,188,62,129,100,76,21,146,65,92,32,27,202,121,18,247,44,120,227,120,72,58,47,67,150,186,157,170,60,223,26,88,83,50,1,133,1,31,3,194,168,109,128,15,218,171,183,214,195,198,156,142,53,148,19,100,40,203,84,166,36,157,221,33,161,82,29,174,114,52,96,49,227,225,231,200,235,82,146,183,176,201,208,30,120,241,42,162,48,39,213,196,10,148,7,186,115,176,67,214,128,188,145,118,172,199,246,41,123,216,140,217,170,66,22,155,4,166,6,39,90,100,161,238,104,23,54,71,185,231,110,209,174,26,20,60,51,103,241,124,3,69,72,71,138,72,172,184,112,50,100,80,182,21,202,118,187,32,109,11,249,189,206,50,74,242,67,31,192,174,231,90,255,241,126,156,245,44,89,216,207,156,90,201,182,194,72,71,164,34,140,114,186,95,75,122,111,189,166,240,111,53,130,11,250,63,201,56,78,144,89,13,3,252,37,170,216,20,139,44,189,126,146,108,54,16,141,7,114,178,197,27,141,240,60,248,205,105,226,164,185,238,141,188,105,196,206,221,234,238,209,201,28,113,211,54,33,203,108,200,177,102,87,178,117,28,241,25,186,202,192,21,172,128,171,122,180,30,145,228,248,33,76,3,238,139,46,245,126,17,236,121,47,173,79,236,150,98,7,191,50,73,117,243,150,159,155,176,10,148,206,49,39,91,104,211,52,151,7,46,9,245,99,155,211,14,102,138,188,241,234,105,22,46,157,253,200,192,54,172,127,36,51,210,83,101,155,122,195,166,88,70,185,30,218,103,227,99,10,140,244,206,163,100,230,187,54,152,126,105,124,165,125,33,2,80,228,99,180,212,105,89,64,17,62,178,123,0,57,57,227,123,133,43,109,164,61,145,5,237,178,239,191,79,35,236,167,236,104,186,66,127,45,118,214,182,180,179,31,193,195,59,144,83,245,147,79,126,222,156,158,48,125,233,160,15,81,252,7,121,34,255,37,127,145,191,162,207,111,28,103,72,104,59,130,74,236,251,75,109,75,153,156,112,201,196,89,100,102,171,67,153,114,201,26,102,178,180,245,245,129,225,216,46,132,171,41,148,206,79,255,68,38,242,87,168,6,65,51,51,36,90,157,160,229,24,18,158,159,36,4,2,192,131,206,120,108,170,115,13,201,11,142,140,84,81,54,126,97,194,209,126,162,183,81,50,174,213,76,216,220,35,191,170,190,156,38,254,251,100,43,118,49,77,156,169,100,114,118,128,248,7,72,186,67,118,137,224,147,64,220,117,38,54,88,68,79,53,130,143,66,169,195,247,137,111,79,3,98,25,77,86,51,82,154,250,158,14,249,151,92,15,42,224,41,41,188,85,80,246,95,12,138,14,103,40,121,212,83,12,203,78,211,168,63,30,155,252,84,45,135,238,72,53,216,90,117,34,59,132,161,185,112,38,250,182,164,100,155,214,0,76,120,180,114,165,99,144,156,169,170,129,240,54,143,98,48,205,182,74,178,253,249,232,102,136,121,7,108,34,235,43,157,221,182,118,164,126,167,232,231,38,130,194,79,141,82,97,141,108,96,226,201,75,59,57,239,120,44,189,202,112,102,237,202,145,227,159,24,220,33,52,49,24,28,84,86,239,41,155,193,167,238,76,38,161,211,246,161,51,76,20,207,163,232,151,132,121,247,16,162,245,186,220,12,24,143,202,226,38,5,3,182,234,120,236,245,147,182,196,195,160,181,182,141,28,78,224,56,22,75,7,213,65,210,204,118,147,169,154,108,74,58,99,118,31,210,141,124,4,46,104,9,103,207,16,26,140,45,93,243,245,188,41,216,29,87,63,21,131,14,111,65,72,246,227,132,99,175,199,232,196,190,57,107,118,58,189,80,200,19,203,33,86,38,234,102,12,49,111,27,247,235,127,127,220,182,49,87,219,219,244,153,156,37,91,25,154,251,7,196,201,90,25,141,27,3,44,42,116,255,170,190,145,249,246,215,95,116,113,161,241,124,74,66,12,238,231,243,33,179,56,24,6,169,210,140,166,212,167,13,32,124,224,10,114,204,172,62,69,238,124,93,74,84,62,52,60,235,118,115,198,93,84,135,128,116,192,113,15,168,125,50,45,234,133,205,218,176,93,159,246,108,195,181,111,228,224,49,240,109,194,199,137,169,168,7,189,218,214,46,191,170,127,182,35,28,38,135,160,195,94,245,245,143,134,124,59,113,54,220,136,69,5,73,54,11,222,183,141,195,168,33,89,139,195,234,208,3,185,137,6,76,232,222,130,115,227,39,116,126,172,105,54,155,227,131,141,27,36,181,10,41,115,253,74,159,151,23,159,141,85,125,191,198,47,134,5,31,160,111,94,34,105,128,108,225,235,67,1,106,5,213,80,159,150,51,76,122,242,208,86,99,125,244,160,182,185,201,39,38,10,96,221,95,122,151,26,66,156,13,122,56,172,36,243,155,38,56,53,153,189,15,145,222,184,198,65,141,124,120,189,130,178,207,178,151,5,108,109,252,22,172,38,175,6,198,72,162,35,42,29,27,211,117,53,108,21,91,235,216,112,13,119,192,66,248,169,70,7,242,96,44,140,20,245,222,123,93,130,176,235,237,81,161,63,238,118,55,13,147,163,113,75,35,105,158,175,31,36,234,55,119,94,222,156,163,235,241,129,247,132,53,14,231,47,42,1,226,68,251,117,98,162,22,219,181,159,154,181,148,181,52,118,239,68,220,53,107,37,139,22,237,155,171,25,148,212,48,230,201,150,129,119,98,239,57,144,69,71,21,27,243,213,61,131,42,49,116,186,180,15,131,58,134,127,169,170,26,216,227,232,87,154,79,236,56,217,182,71,134,118,77,37,249,131,181,95,10,229,159,216,176,18,65,62,160,144,201,191,224,125,159,12,25,239,188,140,19,87,40,88,251,62,230,17,158,186,60,187,81,127,88,180,57,113,236,52,29,105,219,192,140,186,133,222,226,1,106,171,153,1,37,182,217,191,212,9,175,198,88,113,91,11,154,96,65,147,164,233,99,98,37,131,194,160,233,216,102,14,12,237,156,233,229,247,193,110,191,57,115,124,119,247,23,172,54,161,160,220,95,165,206,139,151,73,180,156,210,232,223,103,211,37,5,6,253,95,30,109,133,54,190,73,132,127,201,71,73,43,227,164,29,61,165,69,206,49,64,44,13,110,106,172,208,10,173,207,110,236,211,123,212,47,90,178,104,142,93,31,178,234,66,217,250,199,205,36,234,176,94,127,74,172,251,110,184,55,109,159,200,90,192,126,98,137,194,135,40,138,6,123,167,21,123,163,33,3,65,178,6,7,150,247,221,121,140,152,162,79,90,19,77,218,75,58,3,109,236,226,99,43,107,31,71,39,173,253,154,129,175,35,154,42,225,249,141,10,113,166,149,53,220,233,128,156,201,43,138,13,207,121,148,180,134,249,218,136,92,251,4,55,181,72,150,186,25,159,8,99,61,205,172,43,68,119,98,142,176,190,112,154,132,58,222,30,138,188,191,218,105,226,189,62,81,141,10,45,159,62,19,3,250,218,47,84,43,48,219,230,199,117,83,173,85,88,108,215,249,38,97,236,16,67,254,155,60,105,222,48,251,212,28,107,80,199,105,253,123,253,142,183,116,112,135,147,174,102,103,177,16,55,69,10,158,221,99,164,173,160,46,89,188,35,61,222,202,241,190,223,26,184,237,166,162,81,146,197,134,128,124,157,220,51,88,171,216,229,128,206,218,218,251,32,198,62,238,15,26,199,167,41,124,125,103,204,250,98,68,39,166,225,187,210,117,16,136,59,124,183,86,229,176,31,28,210,17,94,110,28,99,190,81,183,155,142,7,79,21,5,42,201,72,87,81,240,181,125,233,143,149,201,232,244,166,121,30,65,101,83,21,133,72,100,36,130,103,220,137,171,148,171,23,35,51,28,13,242,77,53,136,171,236,170,168,235,121,1,62,162,248,251,116,181,138,111,253,72,190,166,21,82,32,119,228,153,196,201,88,80,158,138,229,87,38,36,37,136,134,6,246,67,72,215,81,186,119,136,229,75,90,147,202,32,112,109,207,168,202,168,76,54,242,67,194,209,200,159,166,171,154,187,95,54,24,224,67,66,17,36,19,78,168,108,13,210,196,238,51,140,64,110,158,177,247,11,192,131,38,192,105,94,249,219,68,176,230,166,78,116,9,161,185,123,43,155,128,168,6,223,54,83,88,88,74,63,165,34,179,35,218,234,77,71,201,248,248,54,198,203,84,86,31,13,254,227,247,252,171,223,19,252,172,93,97,103,255,130,206,106,11,49,44,205,162,15,224,139,100,130,210,216,110,136,76,12,125,219,248,148,27,1,193,161,8,14,77,15,175,215,235,129,225,20,101,134,220,24,95,163,219,65,213,3,45,157,170,233,153,60,144,176,7,49,195,228,133,122,70,23,231,178,245,186,131,237,75,164,167,59,142,110,170,9,58,102,228,45,77,212,55,28,50,170,27,48,184,107,16,140,137,141,140,193,189,241,115,183,173,6,49,113,44,93,102,177,152,136,176,37,35,63,22,162,98,241,16,31,132,207,147,81,60,118,223,132,248,6,196,66,205,8,22,46,127,56,244,158,211,210,96,212,210,0,192,116,9,207,92,61,21,65,214,85,5,115,52,186,236,237,217,229,123,47,108,103,71,32,244,83,69,55,163,144,64,58,44,208,150,14,137,100,230,235,127,120,255,80,230,60,250,63,204,103,41,42,171,33,104,62,12,3,44,97,17,158,170,6,126,6,145,149,217,193,189,125,174,166,168,194,243,103,24,135,191,53,240,119,251,99,97,6,113,116,44,85,9,56,104,208,82,186,23,131,207,67,96,115,66,13,160,152,247,196,179,64,253,94,84,165,164,42,101,91,208,29,26,60,84,115,120,157,10,21,128,244,107,105,103,113,123,136,81,184,49,119,72,132,172,19,10,208,142,194,229,27,250,195,34,160,125,201,242,234,52,81,47,109,36,237,194,168,189,87,9,223,9,175,46,94,36,255,239,43,234,103,219,17,32,96,114,223,31,6,191,15,253,209,31,255,53,254,10,187,192,255,175,222,87,98,184,179,143,205,69,103,96,72,83,102,68,122,204,11,227,151,226,11,116,23,193,205,24,41,122,237,229,171,56,42,124,111,215,19,150,17,163,45,70,52,252,22,17,175,217,158,202,19,131,114,52,211,97,58,163,140,86,229,237,251,33,97,108,172,218,90,236,229,132,190,232,253,153,70,9,143,33,54,137,122,139,21,85,27,60,227,189,12,217,129,90,162,152,87,51,252,84,209,241,24,44,233,198,119,219,68,58,9,239,174,98,78,221,201,151,130,243,203,94,192,244,70,185,23,46,166,217,203,194,63,176,145,168,220,212,86,114,197,255,35,88,143,186,95,13,199,221,29,97,4,138,92,41,30,197,226,112,223,182,238,67,196,189,74,4,137,94,64,39,23,234,127,86,213,57,53,175,139,207,102,91,53,95,121,116,147,51,49,89,116,143,125,164,43,72,19,186,168,219,232,53,244,196,243,131,245,122,1,224,224,108,246,235,67,54,229,40,111,197,229,149,144,208,183,51,113,199,29,18,139,217,185,224,67,79,15,251,59,140,239,123,246,240,234,166,186,169,66,75,100,205,60,31,111,77,110,207,171,117,56,41,231,146,122,116,83,161,99,164,92,217,184,97,112,63,254,155,77,147,75,40,95,122,64,177,154,247,23,246,125,143,42,120,225,123,133,121,54,174,6,220,31,136,219,85,33,205,16,173,169,4,235,140,91,0,135,7,1,179,147,169,92,129,95,12,74,190,79,28,10,60,65,59,88,218,46,141,163,118,219,163,54,24,227,247,253,238,26,255,29,95,184,29,0,92,54,142,217,53,190,102,166,75,106,134,27,246,187,222,87,221,161,87,145,187,106,115,108,188,215,167,139,183,95,7,207,88,106,188,33,25,33,119,18,50,182,223,241,239,159,137,113,23,63,163,165,204,226,224,71,216,159,27,249,87,162,254,246,63,195,158,174,19,189,181,95,190,76,252,191,18,115,55,13,4,252,92,41,121,10,36,96,195,15,230,173,33,148,119,73,149,176,104,109,164,165,3,41,239,146,106,45,232,217,23,46,194,101,58,142,18,249,119,51,172,253,99,5,149,251,139,2,94,215,7,88,127,66,37,254,153,240,217,51,234,55,108,148,3,219,70,217,81,19,131,122,219,232,245,176,214,135,224,47,1,209,60,74,244,172,62,140,80,13,93,141,251,6,124,64,92,145,176,155,7,106,118,233,10,23,12,121,10,158,120,77,138,254,189,205,139,85,130,186,96,59,157,210,19,238,190,89,167,145,50,130,235,147,197,220,163,98,33,73,127,252,0,181,219,97,247,58,68,178,83,233,252,130,142,241,128,98,59,116,165,168,7,95,226,44,45,57,249,89,199,197,109,161,191,225,191,73,112,47,41,182,13,162,71,148,132,244,49,168,196,136,67,254,37,107,186,13,87,48,226,138,52,187,221,221,181,133,81,209,245,56,160,239,141,219,234,252,198,37,100,218,81,178,24,122,118,193,224,127,59,245,15,201,214,159,72,249,225,222,202,59,125,74,17,14,244,243,26,5,26,210,123,135,212,95,47,163,181,127,76,121,157,132,240,131,182,219,162,39,85,236,157,80,127,209,56,226,88,199,225,155,181,190,185,43,38,216,109,218,110,40,160,207,117,97,238,252,113,36,193,138,125,108,255,125,254,227,14,29,48,140,174,106,39,195,92,199,243,157,253,168,74,38,16,199,20,205,19,66,255,218,150,40,192,224,234,205,114,169,103,17,16,72,167,35,166,23,204,147,4,249,99,109,62,31,186,69,99,75,255,251,221,86,25,95,184,122,101,4,33,170,58,141,27,158,191,56,68,117,72,250,20,89,252,163,190,37,39,110,169,139,169,45,78,227,194,150,56,88,102,203,64,78,145,38,162,70,167,193,19,221,246,165,72,245,148,245,107,125,126,148,16,215,134,112,147,89,232,45,166,121,163,137,78,103,238,37,88,193,149,246,4,121,143,219,205,174,197,93,49,195,8,39,132,98,135,111,198,239,198,158,246,167,24,98,125,125,25,213,4,239,175,9,233,179,10,9,191,217,200,70,197,234,62,9,86,247,42,26,25,97,35,102,121,219,174,215,44,109,55,48,213,126,75,234,36,169,185,85,37,239,90,147,29,193,67,69,213,57,224,132,15,141,30,209,177,121,26,154,124,231,250,20,6,207,149,244,210,228,104,65,7,42,183,27,93,237,70,58,177,176,53,135,33,206,169,223,248,162,186,39,48,216,146,96,110,216,11,206,234,109,164,221,102,91,163,25,60,84,249,60,70,197,198,197,218,204,89,148,90,54,109,157,128,89,129,138,244,108,228,181,233,42,43,160,126,112,55,42,104,40,24,243,45,246,120,163,163,187,4,213,236,103,84,27,245,30,252,74,158,33,209,247,0,2,110,189,126,112,127,149,110,70,50,41,61,217,212,115,16,65,68,78,142,102,61,252,38,132,118,187,244,228,47,100,225,239,56,85,72,238,48,11,81,131,221,82,145,158,226,79,154,129,14,151,244,40,42,29,6,84,12,146,74,140,145,206,211,247,85,143,110,170,30,193,49,65,135,138,254,61,156,217,3,50,77,108,180,69,75,24,66,123,74,128,78,59,238,84,58,123,167,161,179,121,73,80,219,178,37,37,248,111,208,229,241,142,128,250,34,216,214,74,180,195,108,76,242,103,40,95,254,35,54,63,37,181,85,111,52,192,150,2,176,137,71,82,3,112,111,206,40,140,52,105,88,116,238,197,100,123,173,52,24,193,19,26,111,192,207,124,240,225,30,12,246,176,150,164,0,139,219,73,146,254,86,15,88,155,174,94,51,75,83,72,200,236,140,83,191,62,0,36,232,126,51,157,28,103,151,240,71,159,2,47,18,178,0,255,120,99,164,146,53,130,206,3,13,255,168,63,230,179,34,119,244,71,172,92,206,84,207,131,70,204,55,197,6,244,57,117,74,38,129,184,195,56,159,147,10,6,101,199,36,89,30,165,101,30,184,158,210,101,19,39,146,80,16,76,134,77,140,152,195,129,21,32,116,86,199,48,94,102,78,154,149,189,105,72,178,20,206,254,104,50,14,70,227,10,251,177,122,87,135,28,200,252,120,71,238,55,229,240,219,34,138,116,18,210,47,43,127,248,2,38,102,117,182,74,222,153,75,171,229,134,207,201,26,113,113,47,4,92,125,7,189,65,72,188,3,49,104,203,5,191,36,116,69,131,78,148,61,242,65,227,184,24,137,173,129,190,89,129,145,238,110,158,76,243,39,149,240,149,71,244,250,125,54,189,88,114,191,130,94,223,70,201,37,134,165,34,139,44,249,91,82,149,51,249,35,149,195,24,159,219,227,161,242,111,174,225,171,9,246,76,158,188,168,171,92,175,203,186,234,76,207,229,25,143,169,111,116,40,127,228,98,109,162,126,2,241,120,128,133,60,229,38,58,233,45,191,227,210,237,44,163,148,253,132,94,162,252,243,52,142,102,110,2,6,216,28,177,206,229,95,244,98,175,17,255,205,131,48,117,229,41,21,139,148,15,16,242,223,190,145,87,220,90,230,250,104,26,199,231,211,240,82,46,171,26,187,154,91,87,81,167,34,229,220,213,189,158,207,117,136,21,87,239,116,126,236,59,72,158,217,52,187,149,231,174,250,205,76,46,170,242,114,165,51,86,213,199,211,100,22,107,153,187,150,183,211,91,128,105,135,156,185,218,159,244,50,149,83,247,118,166,103,101,136,101,173,234,138,185,252,174,122,49,84,10,221,59,107,164,205,224,127,1,41,29,234,230,96,80,0,0,0};
+static const unsigned char v0[] = {27,95,80,32,44,10,108,99,244,162,63,33,218,19,159,189,187,185,157,143,109,136,149,18,166,132,17,146,204,222,247,107,214,215,55,204,5,115,130,199,222,61,151,57,73,98,140,49,39,235,212,83,40,180,67,83,109,138,42,53,113,179,254,191,63,247,223,215,175,201,184,242,246,185,28,11,51,61,188,35,175,148,238,45,11,33,42,22,112,5,176,140,17,190,82,237,51,74,143,23,160,166,133,94,202,101,224,190,15,153,36,68,65,158,95,126,86,119,94,18,8,149,140,153,210,165,41,92,233,94,126,178,70,214,1,210,66,164,182,176,170,209,250,201,79,136,118,99,185,40,131,221,203,1,162,243,254,165,170,95,229,25,128,148,37,187,251,23,114,119,185,252,115,229,85,63,164,242,174,41,175,232,204,247,222,238,14,119,23,224,8,11,80,35,128,20,191,8,73,14,116,24,147,146,127,112,224,2,160,111,64,241,2,101,249,207,208,242,5,94,202,250,190,228,239,234,66,138,85,21,82,81,37,117,99,72,250,140,208,224,223,183,7,16,180,13,83,191,212,237,159,187,97,94,33,64,8,9,156,212,219,32,183,127,81,100,49,26,152,237,173,182,118,46,60,115,229,214,43,118,47,46,201,167,150,124,201,126,46,219,176,248,136,111,182,93,171,117,92,231,85,166,229,255,89,134,213,235,178,8,167,15,77,56,100,30,142,111,15,97,147,110,90,252,118,179,254,127,212,97,88,191,46,194,230,173,243,217,104,227,53,167,87,207,216,55,63,141,4,186,75,155,32,139,54,4,124,125,124,97,179,39,250,60,112,118,153,188,202,174,208,21,200,121,58,84,27,21,42,68,231,88,216,167,6,100,138,20,218,44,34,203,84,246,44,223,93,118,47,9,128,212,196,127,73,212,241,250,60,105,140,246,43,56,116,70,232,207,185,213,194,169,110,61,238,156,76,251,12,92,179,206,228,210,201,149,6,236,142,232,221,197,75,247,234,56,238,197,105,5,190,134,59,4,144,33,152,109,141,233,163,99,41,180,201,77,37,217,75,12,38,245,173,52,4,111,158,19,244,148,221,4,99,160,140,155,129,41,47,120,45,41,106,110,111,30,98,91,248,144,144,192,19,184,249,84,43,8,87,177,101,7,85,215,146,87,241,252,34,22,184,62,79,150,205,231,220,122,195,221,186,189,213,98,126,89,157,181,196,124,103,163,115,179,160,99,73,237,45,184,224,175,186,7,20,255,38,17,185,166,134,187,178,125,138,133,187,174,37,5,45,243,101,161,196,172,179,216,153,249,147,96,165,205,66,179,14,130,224,157,27,8,38,83,186,120,146,131,74,196,163,23,5,102,121,209,219,106,137,100,20,115,157,8,121,159,53,189,41,17,239,11,155,150,125,6,160,43,162,184,207,192,93,122,8,147,228,45,45,107,2,75,35,169,238,241,33,119,199,198,122,105,216,166,212,160,184,122,74,17,114,221,26,50,201,124,29,115,190,75,3,247,23,142,162,26,20,208,110,6,32,40,101,11,106,231,138,202,118,78,140,71,146,85,18,201,185,164,243,182,9,123,218,217,201,157,246,40,41,210,15,134,144,228,97,247,45,78,202,14,210,68,125,201,20,2,106,23,91,229,40,136,130,31,167,80,48,110,39,24,211,140,39,231,117,66,203,234,3,179,205,215,8,161,110,57,184,132,43,204,221,161,211,86,203,106,161,186,61,34,239,120,232,10,157,118,163,150,48,53,10,194,164,136,80,194,134,219,22,105,114,174,253,120,39,152,60,131,6,250,87,168,146,9,193,231,163,164,30,151,240,205,231,28,68,32,141,192,247,230,84,137,60,214,234,26,114,255,231,91,56,59,242,169,5,160,72,126,128,255,114,144,38,118,47,122,249,12,240,134,131,107,218,42,28,48,55,17,16,97,135,29,93,69,36,247,158,3,187,139,254,175,227,151,118,175,152,45,232,58,121,195,146,109,58,55,202,245,87,120,141,181,64,193,227,33,178,144,144,56,238,98,49,195,207,55,40,103,7,62,8,103,240,233,250,170,163,26,3,159,129,219,26,242,224,215,0,130,44,174,41,18,164,239,191,31,93,18,85,87,232,151,126,88,233,181,27,63,121,225,57,96,76,226,59,151,151,174,17,28,67,243,250,179,224,184,12,180,120,110,231,90,86,36,89,221,235,163,170,65,151,151,148,96,165,122,22,90,62,197,221,148,153,232,245,115,155,143,157,215,205,21,118,254,183,81,249,137,155,32,151,110,129,51,174,67,214,157,182,143,207,185,161,49,69,74,22,33,218,79,253,254,69,49,38,54,74,57,171,179,232,17,83,89,207,151,247,156,7,242,253,166,193,252,224,117,1,13,107,25,45,8,20,122,205,127,95,39,86,104,114,160,129,187,127,221,247,252,136,178,236,62,146,23,10,106,80,45,67,67,109,91,223,100,158,170,130,167,150,130,227,224,14,132,116,63,151,211,77,75,80,166,242,60,69,159,254,33,73,205,44,141,137,72,233,178,176,168,128,108,188,52,193,250,126,166,98,230,22,255,140,138,56,107,115,30,238,101,193,105,176,244,243,147,252,157,15,95,52,103,20,25,190,88,190,131,158,61,234,141,203,42,189,101,163,163,133,204,217,14,173,94,11,239,225,97,131,173,181,172,249,157,183,242,14,103,191,47,202,170,157,238,246,126,41,20,195,64,71,233,131,116,189,214,207,62,143,132,213,38,177,221,1,197,58,84,126,215,6,222,117,38,7,91,189,194,80,233,102,211,92,53,116,111,56,96,246,116,233,83,105,129,133,172,189,79,45,92,173,207,147,189,134,207,121,170,45,84,72,41,26,17,116,80,237,240,245,230,100,132,76,241,12,186,124,131,154,126,138,143,20,21,216,255,17,37,123,161,70,59,87,162,25,84,183,22,71,22,28,69,115,144,182,6,116,150,58,245,177,109,151,205,144,102,208,107,173,229,255,180,40,128,159,158,245,219,173,101,249,62,43,52,53,200,18,98,117,47,132,198,236,244,78,71,177,201,181,129,2,227,110,25,11,236,57,181,182,122,54,42,158,62,90,215,112,137,195,217,89,5,120,160,223,82,21,43,68,213,232,65,179,151,90,176,246,36,81,167,229,137,103,46,117,24,32,192,223,117,19,86,248,16,214,86,117,189,4,117,124,241,135,224,22,33,217,209,58,90,234,44,52,23,36,214,237,85,46,92,172,49,32,132,241,247,225,25,51,48,81,41,37,194,15,11,150,150,128,164,37,215,103,106,233,136,4,196,181,208,171,112,185,87,181,124,111,12,161,139,111,33,158,170,13,26,121,81,159,29,90,74,175,71,40,88,246,41,203,199,89,162,30,107,219,189,186,140,98,168,227,6,247,51,255,118,35,123,71,2,67,25,27,50,129,160,202,80,48,81,137,32,107,194,89,149,113,72,180,223,69,106,249,126,172,131,52,170,179,32,227,71,177,65,191,78,215,243,5,33,157,249,52,38,232,238,21,113,238,138,154,70,232,192,142,225,98,196,208,114,70,78,252,162,10,84,103,141,100,209,192,81,84,238,254,172,80,98,138,200,78,0,119,131,223,130,199,130,128,223,2,38,187,89,207,72,160,148,239,143,183,212,131,53,79,61,245,100,249,90,20,155,251,1,128,2,197,211,191,97,92,111,45,235,107,220,0,212,232,137,123,138,247,39,12,178,50,249,198,70,109,225,64,139,145,145,76,132,54,207,246,28,48,122,82,8,255,60,246,162,182,168,160,33,179,219,114,186,184,184,57,168,139,65,255,63,35,26,174,97,45,238,62,234,52,39,141,233,124,124,80,107,10,56,182,132,55,200,117,62,13,158,67,125,222,87,232,195,210,147,88,240,24,76,79,60,251,135,58,158,251,61,8,18,106,18,144,46,101,176,115,6,244,170,176,3,96,251,95,130,244,88,28,234,210,45,161,239,251,80,79,164,203,253,178,129,32,39,4,56,5,20,56,149,158,87,227,50,109,70,87,123,223,53,157,124,65,54,69,130,200,14,254,101,231,176,31,31,11,21,25,101,67,211,194,177,24,84,123,83,167,136,37,126,175,247,119,203,78,189,140,220,244,199,137,225,57,217,33,100,239,98,105,119,203,8,18,118,47,215,95,108,72,61,205,142,198,62,74,221,174,192,176,107,209,245,224,194,52,221,248,114,177,239,203,54,179,167,145,52,238,29,201,147,85,8,76,10,11,66,23,179,249,82,148,2,210,180,120,116,123,95,48,123,88,185,15,190,28,69,26,255,20,142,214,255,82,23,57,92,190,148,171,108,132,53,245,62,225,52,141,196,42,30,206,28,41,137,214,66,25,190,223,126,237,230,27,8,54,142,128,116,226,72,210,254,56,91,226,196,190,185,124,227,136,227,97,93,23,187,188,109,254,216,56,222,115,79,209,238,241,219,196,226,35,213,153,59,36,253,124,125,58,55,7,54,220,136,122,36,168,253,80,210,246,66,224,69,35,241,16,240,27,46,171,184,27,131,5,61,72,97,107,244,230,64,123,244,80,68,75,41,68,209,46,109,203,134,225,170,208,136,219,104,102,128,83,62,27,148,114,123,3,28,89,226,216,83,187,70,24,2,22,102,32,197,152,137,142,147,182,213,178,67,122,181,11,69,141,18,169,221,155,119,24,118,148,69,116,117,38,228,126,34,121,169,241,112,160,2,85,32,57,55,35,243,226,103,86,94,186,220,126,85,215,222,248,202,71,30,249,210,63,60,244,158,39,30,3,33,127,115,84,134,243,41,211,192,62,77,210,43,255,178,242,170,227,10,104,180,177,48,218,80,114,55,54,12,0,67,255,196,168,66,184,154,88,205,180,123,34,72,69,69,167,198,229,94,163,219,53,200,73,117,54,132,71,203,31,250,61,123,227,194,167,221,146,78,174,201,165,124,69,84,49,30,234,99,23,120,166,25,63,42,62,253,202,233,17,85,239,245,94,164,120,159,154,164,117,237,90,54,120,234,245,41,81,11,117,53,95,206,229,143,75,123,246,105,139,54,221,77,181,140,240,11,140,163,246,145,34,178,174,110,247,218,242,165,237,177,91,248,126,128,92,203,171,194,215,253,246,110,134,214,43,138,247,218,193,216,65,58,2,9,238,172,96,175,104,71,201,104,11,210,60,48,31,111,126,106,227,166,31,68,127,105,83,128,209,35,46,225,229,7,41,141,247,213,217,62,113,215,114,239,138,207,206,176,200,16,197,73,34,28,127,225,118,52,72,197,189,13,97,99,255,46,58,174,38,106,255,231,112,73,91,100,126,25,51,186,239,216,131,94,9,176,71,46,4,122,163,189,119,87,176,174,18,151,209,238,107,112,104,32,195,217,128,237,39,229,252,130,24,36,230,164,200,139,69,91,175,31,192,207,102,189,201,44,225,100,199,168,103,158,71,117,167,170,162,16,53,88,215,186,251,101,181,149,92,228,36,218,22,107,92,233,224,239,198,64,199,70,241,192,203,162,229,35,241,180,152,200,194,214,46,160,116,94,38,181,181,132,96,117,109,54,198,6,139,187,213,245,194,186,136,251,243,72,152,19,8,178,128,131,142,72,114,116,175,168,156,173,154,31,213,160,50,64,231,243,211,209,36,171,179,246,155,66,180,13,165,215,134,104,124,49,182,57,70,10,93,108,84,140,86,59,200,111,246,51,163,190,40,244,175,64,53,33,171,115,245,238,25,226,196,233,35,163,22,100,52,6,50,14,56,130,216,75,146,183,221,251,7,137,155,114,41,66,63,122,190,182,240,57,80,86,144,12,94,100,124,107,112,178,119,66,14,73,114,136,236,135,29,62,112,72,172,211,7,163,124,156,159,178,176,179,97,135,110,69,98,247,16,69,15,239,157,235,148,217,99,184,135,6,133,210,124,253,56,50,24,71,37,52,65,104,14,102,233,37,65,76,209,205,171,93,33,150,157,159,171,108,215,44,235,81,18,47,195,253,177,240,32,10,109,135,112,143,10,154,180,42,204,59,183,45,49,102,208,224,117,197,198,111,195,30,199,81,33,64,72,149,255,159,8,29,251,65,94,199,158,198,147,150,239,205,158,117,218,86,14,26,25,101,48,239,83,124,35,174,222,145,115,114,187,246,148,86,196,86,34,102,38,180,207,141,23,157,54,184,88,206,128,210,33,10,220,155,53,171,133,255,144,110,169,232,121,99,108,211,43,255,38,110,248,183,228,110,49,108,134,138,31,38,137,63,98,55,163,67,143,65,21,58,49,89,140,14,40,87,99,48,169,181,9,90,207,126,236,228,214,74,226,127,161,99,50,201,211,64,126,124,36,210,65,0,7,193,158,131,20,31,196,154,176,144,66,53,144,161,134,123,122,45,18,59,242,166,130,163,48,175,241,154,41,13,220,24,143,132,140,70,246,222,39,121,197,187,148,83,169,44,116,23,163,149,155,60,204,59,37,102,112,1,225,8,26,169,13,183,199,232,230,173,77,221,189,122,248,179,116,58,117,170,72,188,131,140,9,145,179,100,33,66,243,14,111,46,127,183,187,1,83,158,194,244,67,100,2,180,96,178,248,116,199,129,38,57,200,118,16,153,96,204,254,218,210,200,15,20,142,198,153,126,74,226,213,170,82,2,247,40,117,154,173,2,250,210,49,239,170,181,246,211,26,98,58,36,196,2,40,140,106,23,42,153,87,116,108,18,129,193,230,199,29,142,21,237,185,76,81,223,228,235,224,64,113,211,205,99,8,183,58,16,216,182,6,192,254,73,222,2,76,168,14,199,54,31,245,182,63,24,253,4,45,212,119,143,232,23,230,28,200,209,33,49,240,207,123,120,251,70,55,93,198,119,209,188,26,79,196,67,217,49,42,9,163,27,86,92,77,10,147,141,168,193,62,149,245,224,1,249,212,111,218,96,2,117,44,96,219,15,247,237,14,15,50,114,152,217,182,110,55,141,152,166,143,13,105,28,17,182,66,166,75,177,70,7,182,138,106,113,43,244,225,164,58,134,177,55,200,149,62,43,12,148,168,162,255,129,239,62,67,189,245,96,223,188,49,60,150,21,222,149,100,91,48,13,6,176,149,5,55,160,44,48,229,75,210,242,3,225,140,151,243,22,11,106,104,180,240,176,149,6,172,212,121,139,45,84,70,162,166,0,219,122,67,6,229,25,148,202,90,79,77,120,45,225,253,253,203,160,120,249,195,232,25,119,64,54,106,65,90,55,189,225,226,85,82,58,48,92,172,215,95,164,214,221,186,105,72,198,231,53,166,26,227,10,109,251,133,205,233,179,187,31,94,6,61,118,222,210,188,235,32,86,51,16,250,85,152,24,248,107,23,180,82,86,125,179,5,111,237,101,61,85,38,103,243,30,219,99,84,124,10,194,185,100,28,104,125,194,185,198,170,202,1,120,59,177,31,122,240,89,245,57,77,131,28,253,184,55,130,17,109,220,21,7,9,191,221,233,228,66,2,31,55,203,248,90,237,198,0,2,205,52,198,32,73,221,118,180,122,177,188,236,175,160,77,180,197,44,119,166,130,173,203,120,32,200,121,90,1,54,190,248,51,36,73,239,144,79,145,12,81,219,190,81,108,180,182,31,225,77,157,121,208,129,40,93,156,243,160,111,111,209,235,40,53,138,150,151,147,194,120,225,20,26,154,105,129,36,224,58,90,181,110,52,233,10,219,55,35,153,193,228,125,224,16,236,4,66,149,215,232,173,6,79,189,31,254,172,103,177,76,51,188,55,29,206,223,0,8,56,107,113,240,162,47,36,12,44,76,168,72,70,46,88,152,123,219,100,112,84,115,133,136,150,213,34,75,115,84,104,171,137,153,210,139,10,107,113,209,177,162,200,89,6,122,243,194,108,139,154,7,88,156,251,232,104,75,72,176,253,243,62,140,70,222,197,178,114,38,192,157,136,51,116,174,32,53,71,115,28,177,175,92,242,162,96,47,233,203,120,207,207,206,123,209,62,130,253,212,24,72,86,156,135,124,57,254,49,217,245,118,112,39,246,82,144,148,224,95,195,231,156,154,1,39,178,98,120,34,165,248,54,183,252,62,184,1,54,81,229,205,164,255,58,111,239,187,241,184,130,146,65,169,196,8,174,19,209,223,182,84,223,57,67,151,253,15,4,149,235,25,132,2,164,248,83,173,94,32,247,251,132,208,114,185,222,162,158,2,125,82,23,24,153,5,140,158,158,152,106,218,66,167,119,45,130,22,146,255,189,191,149,194,10,2,91,132,216,231,49,52,132,157,3,164,115,65,77,140,232,105,184,153,125,7,36,38,168,99,129,168,52,105,200,139,106,79,204,26,200,169,219,165,189,70,24,73,197,178,237,73,42,244,175,123,19,192,72,20,212,5,47,144,244,178,193,34,6,197,216,151,227,68,101,32,14,88,25,180,227,24,232,196,118,88,107,50,10,238,54,37,14,55,248,84,158,49,232,163,72,57,231,217,192,245,171,201,7,54,179,159,255,60,123,59,121,16,214,104,135,50,253,83,173,162,30,17,93,254,233,54,233,100,218,82,104,39,103,209,194,242,148,104,14,147,39,186,34,50,102,231,255,128,26,108,18,78,207,145,156,248,84,113,98,142,145,139,162,51,14,250,198,143,139,92,196,88,60,49,234,49,119,225,60,64,30,100,103,94,110,149,62,210,155,185,70,221,70,149,124,110,64,194,194,17,66,218,28,26,146,74,155,63,94,132,30,7,229,111,125,151,231,157,35,144,162,153,131,8,252,100,15,49,145,131,101,166,224,9,237,33,121,46,106,224,217,16,52,123,134,125,21,203,97,172,207,6,77,66,18,2,199,150,18,153,215,12,110,48,145,203,196,211,216,35,245,40,136,145,103,169,237,125,55,139,91,162,62,33,4,77,237,188,189,64,176,63,183,132,178,132,176,208,252,200,20,36,201,42,22,166,164,161,66,217,249,85,188,24,144,210,212,67,31,127,171,171,158,215,19,125,168,191,31,250,77,138,229,125,27,34,126,80,54,27,248,253,44,115,183,36,20,136,25,177,237,178,200,106,125,102,169,107,233,178,176,107,136,153,136,236,17,23,111,88,230,144,196,81,145,167,35,64,100,62,171,200,245,92,162,252,161,145,135,165,217,188,33,76,244,82,63,60,12,27,118,40,73,123,182,14,239,34,188,162,226,83,41,189,247,139,158,101,156,37,73,120,12,62,136,177,192,33,0,17,251,233,243,75,36,190,178,250,138,69,5,30,119,50,142,252,39,9,185,126,254,230,235,67,143,174,18,73,4,36,139,141,160,240,169,51,30,163,172,207,94,220,138,207,121,6,243,138,138,102,185,81,165,63,174,196,196,205,124,135,172,73,232,227,167,159,126,51,51,26,39,60,21,207,146,116,168,7,130,194,251,12,202,38,163,104,240,173,183,195,98,145,27,244,66,242,76,95,44,194,230,39,201,138,35,193,81,216,222,128,200,33,206,183,45,110,159,34,62,122,163,182,199,83,18,194,180,119,133,226,230,146,253,120,96,238,170,38,106,15,199,110,81,213,75,141,86,120,148,141,192,105,165,227,206,108,126,249,60,98,226,0,224,55,195,182,1,1,240,48,30,111,222,238,59,209,229,164,172,115,58,190,224,6,176,217,109,155,182,233,52,60,254,224,126,167,116,65,226,140,179,8,98,172,54,103,156,180,36,244,228,153,135,206,124,225,91,223,201,212,189,168,225,178,20,177,164,208,240,63,50,238,188,196,27,72,212,18,49,187,188,56,183,231,188,89,196,250,105,205,25,246,92,94,208,165,181,44,24,191,70,100,38,223,45,183,50,6,204,42,146,145,233,139,101,24,129,14,172,219,124,170,190,22,53,106,106,131,161,39,225,136,16,180,225,62,94,161,73,129,197,204,148,102,79,51,86,52,147,23,190,35,117,150,24,165,248,194,155,81,25,174,182,187,220,37,14,107,112,135,41,5,59,135,45,228,224,78,94,228,66,42,57,118,237,97,123,148,152,16,120,139,200,218,70,132,26,188,155,119,221,0,163,15,23,106,107,89,228,190,109,27,98,82,202,38,131,17,215,223,13,101,111,105,58,167,73,138,198,10,185,139,40,135,46,153,3,36,53,231,226,210,179,196,146,228,7,4,51,160,146,145,22,173,240,188,194,184,1,234,104,154,121,78,175,196,130,168,66,9,155,11,68,40,190,123,188,133,126,241,226,190,227,105,109,156,150,235,126,5,59,101,2,11,211,95,80,106,244,29,37,163,228,156,200,253,35,102,5,227,231,56,213,132,196,70,50,190,230,157,13,62,5,209,220,228,109,176,25,40,193,88,0,246,17,244,5,160,122,43,116,87,162,210,3,61,239,131,39,235,230,63,34,43,153,238,97,114,226,80,88,34,156,230,240,90,182,230,15,15,183,199,62,239,93,15,92,126,21,58,96,111,166,4,173,41,220,83,99,29,34,118,218,170,218,213,138,182,69,116,186,173,160,74,226,254,170,23,9,28,120,97,81,51,123,82,4,135,169,34,110,133,22,89,28,67,49,226,196,54,234,199,166,87,28,237,46,171,150,58,215,183,204,234,80,52,71,28,24,150,233,124,26,71,99,137,241,19,251,237,127,179,189,142,81,238,33,8,133,196,148,46,59,168,161,224,91,63,146,88,136,162,70,164,46,226,18,155,177,250,111,15,119,231,37,98,99,203,247,66,211,220,27,204,3,50,139,38,250,248,148,60,107,65,200,153,88,34,220,154,240,89,248,149,68,172,117,132,72,144,53,253,88,241,86,215,54,206,171,127,20,129,60,127,161,0,84,110,72,156,159,177,113,225,148,84,238,2,194,165,63,135,112,47,32,75,159,247,208,132,59,72,211,96,172,168,199,63,37,19,10,231,124,43,5,1,92,122,234,69,18,125,227,14,166,172,191,49,214,185,150,49,164,99,112,60,214,145,88,80,243,167,225,244,18,137,20,9,80,25,103,59,33,99,215,110,23,12,135,76,59,159,5,218,70,192,21,74,113,164,147,167,143,205,145,236,219,184,69,87,106,254,211,170,190,202,153,211,115,131,0,85,151,201,47,210,88,139,255,85,210,83,134,251,131,79,58,103,164,160,196,186,220,18,25,99,253,211,72,21,7,253,36,203,120,218,78,158,152,76,8,105,55,252,240,178,2,25,239,245,192,236,164,126,68,86,114,138,193,169,45,48,206,211,65,220,79,153,167,169,116,52,231,29,158,244,139,73,60,156,134,8,234,254,17,54,73,58,60,232,170,77,62,101,125,29,200,60,6,146,197,57,23,192,164,215,192,107,206,56,201,203,150,58,0,83,7,207,186,2,230,241,84,154,138,202,91,155,8,123,6,132,28,97,57,40,53,13,93,40,30,213,184,79,175,142,77,186,157,200,67,22,102,83,136,50,201,18,60,126,231,67,10,184,192,152,172,215,36,39,126,102,118,101,196,65,161,247,14,40,37,251,128,163,61,74,103,119,231,23,16,145,96,120,119,193,46,79,28,0,29,2,47,200,46,25,185,108,158,92,168,220,81,126,232,13,242,33,219,12,213,12,141,89,29,231,37,72,143,100,238,57,242,171,154,249,129,49,148,167,179,45,125,72,229,118,181,32,46,47,252,236,130,17,221,122,248,150,180,194,49,105,87,39,97,82,35,98,200,211,173,254,98,104,221,56,98,40,147,108,216,78,44,106,94,5,152,36,138,52,170,177,133,181,213,44,49,140,202,41,225,37,14,225,171,173,165,135,155,236,211,162,116,48,3,84,46,16,104,90,169,225,75,126,8,228,52,248,74,40,184,236,108,185,185,254,1,117,100,124,117,240,168,155,136,24,205,102,95,110,118,108,161,166,129,64,192,176,130,187,138,10,96,190,68,140,134,74,118,223,65,14,133,138,203,217,26,22,184,91,177,170,41,35,162,200,156,196,158,231,3,114,144,134,19,67,147,19,219,28,68,142,155,176,185,79,131,216,245,161,187,215,41,35,184,61,4,120,114,56,144,177,77,207,38,16,57,66,183,175,224,206,113,115,23,140,24,51,36,186,7,93,149,14,81,237,110,240,58,126,212,13,43,165,119,165,198,133,116,156,246,110,28,92,151,50,114,93,100,122,111,29,56,213,188,227,163,184,139,242,193,250,201,64,46,56,247,238,103,43,177,197,151,242,152,110,203,150,132,16,139,108,210,156,65,45,36,216,228,247,152,82,195,241,141,214,28,207,129,160,223,98,137,246,140,142,56,220,239,155,196,51,62,68,245,204,110,55,93,142,162,111,219,214,219,119,82,250,221,217,248,125,34,149,176,5,41,73,79,171,232,251,83,181,23,238,20,114,136,17,226,89,250,141,219,191,249,94,108,45,106,155,214,24,58,171,143,177,245,126,38,93,27,230,161,238,100,243,6,28,63,198,44,117,68,122,128,255,13,59,17,201,240,183,191,217,19,179,117,174,179,8,207,51,86,37,72,52,151,41,144,156,57,251,241,92,193,31,240,35,230,50,31,217,170,122,22,242,141,178,12,169,179,232,104,123,154,69,200,70,251,105,131,193,3,82,16,244,119,3,50,5,224,133,131,5,247,108,73,101,66,205,254,207,64,225,60,198,109,128,48,237,43,42,14,163,101,48,60,59,248,162,219,235,230,147,126,229,125,155,191,85,121,180,112,168,9,70,151,239,187,36,146,89,209,141,101,211,107,192,189,218,125,82,144,142,104,161,115,90,15,135,67,141,28,246,171,104,220,94,35,121,170,145,13,245,210,215,55,49,24,39,114,127,152,244,126,3,17,119,85,85,40,253,45,160,102,82,187,15,56,9,140,175,243,191,33,185,65,252,252,81,129,140,107,47,58,146,116,119,170,180,21,87,119,101,236,105,184,140,88,27,78,212,242,122,81,227,20,107,195,205,103,183,8,126,98,153,30,138,105,216,56,213,247,115,215,39,189,102,35,70,182,163,223,10,164,75,112,149,180,158,175,104,48,192,64,164,39,254,121,25,93,76,193,72,189,246,111,29,190,223,49,198,247,19,161,142,96,227,157,190,39,83,210,245,189,144,245,83,158,98,161,36,161,168,3,162,24,86,66,137,251,92,95,132,227,55,225,200,5,4,11,233,253,254,114,112,150,133,141,154,147,120,120,81,198,138,158,73,241,45,16,245,62,161,180,222,177,10,236,72,136,176,167,225,90,185,110,119,150,170,113,15,160,238,160,66,36,179,162,213,245,28,64,122,126,243,102,132,88,212,215,50,146,41,169,83,216,202,167,160,114,232,94,30,247,214,52,145,100,57,67,239,135,48,77,47,122,190,79,218,75,217,189,180,64,103,242,78,93,165,190,203,88,8,244,103,154,249,130,111,246,223,20,249,175,223,110,206,17,3,175,134,87,52,250,35,246,208,209,34,186,44,53,233,216,62,67,196,0,203,17,120,162,129,197,134,31,227,160,109,52,213,197,7,91,170,114,29,59,156,103,71,158,149,58,202,51,175,11,165,150,24,240,7,40,144,182,239,236,142,108,125,66,144,242,203,7,96,52,67,212,103,78,19,212,198,21,55,231,64,113,128,66,43,233,58,191,119,198,93,204,62,215,252,120,4,189,70,44,102,190,26,179,58,3,65,6,170,152,141,182,69,94,131,234,194,237,76,110,62,20,36,194,40,221,58,8,210,242,45,241,203,254,55,253,112,149,222,236,251,68,83,18,87,68,196,208,232,125,241,112,241,136,86,120,146,244,247,5,0,63,137,151,252,191,59,86,194,167,70,154,44,45,221,171,222,26,26,85,8,28,38,221,117,95,80,69,1,30,157,244,159,186,147,44,47,197,6,18,196,243,108,110,175,163,69,231,229,107,185,92,46,180,249,241,8,185,166,210,188,167,130,32,28,233,206,136,69,79,26,111,134,43,115,36,64,102,211,167,202,103,16,232,229,184,94,15,22,43,232,35,66,87,238,22,25,228,138,128,225,240,23,230,190,152,90,105,134,213,209,137,108,189,96,222,195,193,221,104,197,245,80,55,228,165,37,226,88,138,181,9,52,30,231,48,38,105,55,106,20,217,195,225,45,8,43,205,131,196,66,160,169,17,123,250,178,103,219,101,35,206,212,141,245,235,81,20,28,255,224,141,192,25,89,17,60,240,0,235,93,137,234,220,208,136,247,197,171,40,213,37,206,157,69,77,190,124,144,176,194,159,209,39,28,242,152,76,92,230,235,138,124,234,185,193,121,192,17,99,253,154,252,79,232,235,141,61,73,196,229,99,202,115,92,39,165,174,215,26,154,59,77,248,152,203,211,182,48,230,186,159,71,89,2,28,158,102,114,37,69,89,57,79,157,69,161,59,230,126,53,119,0,60,59,231,69,166,8,185,200,239,135,76,201,207,146,237,198,9,96,222,129,163,239,248,50,66,68,60,164,97,149,191,125,68,57,221,213,214,25,21,164,36,134,242,223,120,44,118,152,67,28,225,209,100,196,124,4,17,187,120,75,142,147,42,6,40,228,145,192,180,247,160,163,37,161,141,173,246,205,169,142,196,69,179,14,75,201,76,52,190,228,108,113,115,168,87,237,250,122,227,73,212,162,132,9,135,253,73,142,104,133,215,221,126,34,183,150,140,226,242,215,213,144,121,33,255,177,58,155,252,83,36,209,56,51,203,172,198,55,104,102,200,152,7,165,12,11,51,209,18,155,16,169,26,134,253,119,132,46,118,219,174,145,225,154,78,165,22,207,241,230,196,105,93,222,173,67,14,84,48,68,189,152,231,166,110,169,239,61,204,163,164,236,118,152,249,187,5,177,72,146,120,199,194,25,172,65,167,61,32,254,34,29,203,95,234,34,194,249,196,241,130,81,63,19,191,35,246,51,199,174,225,85,62,199,65,99,185,216,193,18,175,244,11,237,97,171,65,97,2,82,126,224,57,227,209,104,1,198,133,192,45,59,135,225,187,180,57,55,243,126,167,212,39,64,165,25,147,73,66,187,92,16,21,56,228,143,184,205,50,152,32,97,178,69,181,188,73,131,115,11,177,47,69,65,242,124,230,30,170,103,46,54,136,193,241,111,113,37,3,2,244,99,222,250,205,107,247,9,174,246,230,108,179,189,214,236,175,246,130,242,50,190,75,135,12,42,17,70,9,85,73,82,62,132,213,42,235,98,173,41,164,128,187,66,156,147,114,97,126,95,254,216,124,227,225,174,232,247,70,60,80,43,248,96,142,28,197,80,54,50,187,146,21,123,246,106,194,255,30,97,5,179,161,34,166,206,221,84,16,83,72,239,94,184,33,106,187,4,109,229,54,101,82,10,19,165,197,150,107,130,9,238,33,245,40,113,159,122,82,90,88,181,191,119,250,142,73,86,254,34,187,253,44,38,144,150,121,240,91,45,105,41,150,225,3,156,66,159,7,149,202,186,139,175,230,69,202,48,193,234,241,166,135,17,72,44,21,24,79,34,198,99,86,11,197,94,84,182,180,108,132,232,71,168,244,8,27,254,37,110,67,119,155,60,241,20,40,117,179,108,180,85,219,95,4,98,229,114,121,148,149,40,187,164,43,130,177,95,33,192,206,255,0,32,170,20,36,119,131,67,40,226,213,177,15,40,127,9,43,44,142,196,210,156,213,142,34,137,15,19,37,138,2,173,130,96,120,47,188,118,250,54,9,95,247,134,144,32,209,81,66,112,160,116,85,24,202,238,68,133,222,163,33,221,216,133,224,246,32,74,6,221,222,174,216,251,60,16,17,172,38,98,195,137,139,230,200,100,175,69,2,19,2,50,44,24,85,100,132,117,219,75,175,241,27,175,147,212,10,94,111,209,140,232,215,137,111,180,104,98,236,38,36,150,108,221,36,29,199,102,234,44,25,123,234,4,50,23,174,123,132,158,224,238,50,227,132,24,152,58,190,79,10,95,79,124,199,118,96,158,85,206,125,200,130,33,230,107,205,48,211,196,142,177,135,102,23,177,214,234,166,109,227,152,25,6,181,32,163,79,74,217,81,225,234,73,88,219,230,36,49,201,182,17,121,255,189,65,255,68,196,142,116,150,40,119,245,121,178,106,211,217,115,110,197,190,103,252,38,19,105,79,33,249,33,98,155,36,174,19,12,143,104,249,41,158,225,158,125,86,40,6,192,88,184,197,66,138,20,154,31,40,96,129,233,58,84,247,148,143,58,100,61,111,155,195,2,233,20,110,34,159,22,64,199,113,254,38,29,7,34,239,142,192,65,141,95,40,84,116,184,227,67,135,196,39,23,241,152,211,171,66,222,173,91,221,161,151,64,69,49,242,164,192,60,40,116,29,210,72,52,62,79,92,77,239,54,47,210,164,178,81,194,88,51,198,144,114,121,121,223,127,159,122,222,190,152,189,233,13,28,229,192,166,119,240,58,91,108,189,202,183,143,112,54,251,149,236,33,213,234,240,125,126,190,216,243,201,86,241,87,93,45,69,48,252,108,137,171,19,216,180,188,21,94,216,10,143,15,168,123,159,220,146,199,209,62,137,31,93,110,184,103,113,169,173,175,188,137,35,89,122,232,10,147,189,13,255,220,89,253,183,240,71,192,112,53,246,205,77,133,242,52,92,97,183,184,31,240,227,35,85,238,132,159,243,17,115,35,135,23,35,143,57,132,120,248,27,195,107,15,107,250,198,253,93,223,122,141,165,200,144,247,244,97,107,35,155,92,93,233,191,18,154,191,176,194,41,100,120,99,165,231,51,127,226,185,203,201,151,37,47,119,211,102,231,124,111,77,255,115,210,252,214,145,238,54,24,139,117,177,188,228,173,59,212,60,179,184,219,39,55,239,114,231,121,245,222,89,242,207,15,42,40,191,184,98,167,20,92,18,0};
 
-static const unsigned char v1[] = {31,139,8,0,0,0,0,0,0,3,237,93,109,115,219,70,146,254,238,95,49,97,249,150,212,90,128,240,78,64,178,148,114,156,77,57,85,246,94,42,78,244,37,151,59,67,36,40,34,6,1,30,0,81,146,21,254,247,235,167,103,0,12,64,74,182,19,223,222,157,110,83,49,48,24,204,107,191,119,79,131,26,95,85,137,168,234,50,157,213,227,147,39,233,106,93,148,181,184,19,203,67,81,38,249,60,41,15,5,53,120,91,199,117,194,165,191,45,22,201,172,230,226,143,201,226,80,44,235,85,118,40,126,44,174,234,164,20,91,177,40,139,149,16,99,243,232,226,42,159,103,137,249,91,69,131,62,57,58,18,175,146,108,77,45,22,87,249,172,78,139,92,212,203,184,166,25,234,171,50,175,68,44,214,212,47,165,133,168,234,170,200,54,9,213,47,48,234,60,201,226,219,39,179,34,175,106,241,45,202,226,84,76,86,213,161,216,196,217,129,56,61,19,121,114,45,126,144,3,76,84,95,84,87,73,253,83,186,74,104,105,77,237,161,104,186,29,208,170,146,27,222,171,28,248,123,220,104,224,187,39,66,44,147,184,172,143,177,166,117,133,129,176,199,119,207,171,205,165,152,101,113,85,157,62,189,227,87,38,63,109,197,205,42,203,171,211,209,178,174,215,199,71,71,215,215,215,230,181,107,22,229,229,145,99,89,214,17,117,27,137,69,154,101,167,163,188,200,147,145,216,164,201,245,55,197,205,233,200,18,150,112,60,250,127,116,246,124,29,215,75,96,161,120,159,24,89,154,39,179,120,125,58,42,11,2,226,72,175,254,173,72,243,97,253,117,58,175,151,167,35,103,36,230,167,163,55,158,233,218,161,8,112,141,61,211,23,248,71,19,89,22,234,2,239,181,237,8,199,66,41,155,154,65,232,24,124,237,181,52,184,161,209,54,167,22,110,144,25,54,134,148,215,61,205,133,245,129,118,113,132,109,208,141,246,124,246,238,144,32,57,47,174,243,23,101,89,96,195,255,72,128,14,96,99,155,126,83,117,58,154,93,149,68,217,245,203,34,43,202,209,153,248,67,160,7,164,35,17,154,142,255,106,106,250,177,67,5,193,23,134,72,251,184,137,6,175,218,167,229,190,55,220,113,99,12,95,25,237,187,87,182,79,211,218,78,230,10,119,69,175,50,215,112,87,6,61,156,227,237,72,28,209,118,58,224,95,173,255,9,250,47,9,250,149,101,184,153,1,144,3,244,0,251,138,30,206,237,29,192,207,138,203,71,7,113,211,143,60,225,154,145,55,51,173,200,48,125,207,49,253,192,160,103,97,155,182,141,194,146,106,34,119,102,250,0,157,109,18,88,221,40,228,183,244,50,51,29,219,165,7,39,180,105,128,192,53,221,41,36,149,75,210,39,48,3,207,55,195,169,105,81,149,229,153,182,71,197,208,53,29,199,180,157,169,233,58,84,21,5,230,20,88,152,98,224,169,79,47,188,140,6,179,167,134,233,249,65,76,147,16,194,228,149,224,66,51,186,83,211,139,208,36,10,128,77,111,186,211,198,48,157,128,30,61,215,134,108,179,44,215,12,157,233,140,106,35,154,218,163,113,221,208,12,108,23,5,218,64,228,196,180,4,63,18,242,138,1,44,65,11,242,169,135,101,209,42,167,161,105,83,15,90,155,71,80,194,212,150,69,187,114,194,153,233,209,14,92,223,244,93,207,140,124,175,153,22,179,58,4,160,123,86,71,91,8,34,218,3,175,174,217,40,77,230,250,190,65,51,209,186,166,84,176,166,14,22,63,13,0,17,90,33,1,136,47,106,131,128,96,136,78,180,5,59,164,62,126,72,83,71,212,49,240,60,51,12,162,204,104,241,130,141,16,150,61,180,10,8,99,88,2,163,206,94,26,192,172,71,13,128,90,204,231,24,192,173,209,96,94,142,98,72,236,210,48,1,222,79,9,134,174,77,37,194,48,207,103,16,142,177,68,71,240,165,89,162,1,44,99,141,14,54,22,81,91,218,19,80,45,55,102,48,174,37,12,246,226,90,66,202,0,186,25,162,83,99,63,68,9,238,134,68,55,80,131,213,208,180,212,30,147,121,84,79,16,38,116,155,216,191,196,118,228,98,165,184,50,182,13,198,54,144,141,205,133,64,66,40,145,32,187,72,42,226,113,195,189,196,198,179,103,15,45,17,100,107,48,206,177,221,128,49,78,8,15,128,111,154,9,240,112,68,7,21,198,62,113,12,88,134,106,44,98,33,9,206,144,16,142,2,49,145,79,42,30,24,87,8,32,140,211,200,158,68,213,7,41,183,254,168,72,176,105,233,78,76,82,16,236,110,27,1,221,228,131,101,7,48,7,6,66,145,172,177,58,205,47,171,87,143,77,52,218,22,89,66,193,50,34,12,169,50,33,22,104,245,37,96,8,36,43,250,167,87,90,168,124,3,156,138,0,90,140,222,219,14,143,176,50,112,237,181,182,246,13,97,241,16,164,251,185,53,143,17,25,193,210,229,33,220,207,26,66,78,200,179,223,135,179,243,199,134,51,18,193,196,27,231,12,46,75,96,235,61,104,89,48,175,12,183,7,44,174,19,232,113,78,172,233,175,72,180,185,127,106,0,35,48,162,102,0,247,211,7,136,120,0,203,220,69,214,44,206,31,27,158,136,174,25,54,175,130,23,125,195,76,242,206,134,38,125,3,96,202,70,118,216,111,101,147,167,227,168,102,128,220,249,78,3,114,149,184,205,210,64,19,131,20,251,112,38,155,103,178,195,141,193,115,125,178,204,19,210,255,73,170,247,117,177,126,108,104,33,31,100,10,123,25,26,111,26,55,16,128,130,143,4,108,14,231,53,16,231,216,75,24,24,129,99,243,229,69,211,14,64,132,253,62,61,231,81,86,164,25,29,178,162,251,166,183,221,153,242,175,124,186,12,177,34,108,255,28,245,43,66,161,53,32,14,27,118,152,112,247,244,179,92,209,118,58,39,76,126,230,148,14,79,57,100,188,56,75,254,177,225,130,127,136,86,35,251,16,230,54,108,113,130,19,89,199,30,241,138,188,1,144,100,231,250,30,135,3,94,132,102,20,76,133,188,42,166,130,144,218,144,117,116,30,189,8,68,192,29,2,17,109,32,229,134,173,9,232,100,38,146,165,101,57,206,204,54,167,100,234,4,240,52,124,152,201,86,232,11,204,4,33,232,218,43,223,156,218,30,41,49,178,125,200,24,19,234,198,163,168,87,109,147,150,71,85,5,105,91,50,153,4,209,37,175,55,18,242,138,190,62,172,64,146,173,176,254,192,198,241,176,1,145,116,16,34,224,49,196,252,69,146,101,255,68,252,255,67,196,151,201,162,76,170,229,163,195,61,144,225,18,18,93,47,92,122,240,131,54,112,111,237,55,142,25,17,66,236,8,110,196,198,224,55,8,130,200,54,43,174,112,17,142,34,159,195,22,184,186,49,36,60,135,105,164,72,38,2,178,92,88,166,111,200,111,113,109,154,35,12,252,126,35,187,107,164,141,68,19,241,248,246,6,215,29,13,123,17,151,149,247,216,240,192,54,7,84,205,82,90,138,108,226,16,25,126,194,227,142,136,34,248,184,143,18,62,136,196,240,150,229,35,57,80,26,56,90,224,13,225,145,21,151,197,213,227,211,214,14,131,192,207,186,232,36,21,72,20,46,13,18,124,111,28,27,102,107,36,34,41,25,97,253,8,249,196,66,123,143,179,30,111,146,71,7,163,198,79,96,247,11,39,27,54,212,8,52,131,64,141,244,197,224,2,220,239,71,56,247,248,15,247,121,13,231,195,250,128,87,176,132,183,65,51,45,141,104,8,249,100,21,167,143,206,166,112,236,134,97,55,240,92,239,53,187,201,13,219,251,146,47,231,232,191,34,29,228,239,26,252,145,146,128,59,253,181,19,1,213,117,99,58,158,59,156,4,65,53,178,52,34,59,200,192,48,52,86,176,111,37,46,25,9,175,93,211,117,96,35,216,251,6,49,120,16,94,234,14,102,111,214,113,62,127,108,168,101,66,199,133,212,179,207,170,218,95,162,100,240,249,224,107,146,50,178,9,179,9,76,7,120,226,59,141,108,146,81,204,99,204,29,220,138,95,117,131,190,38,175,49,90,65,172,147,4,99,82,233,26,117,163,162,213,238,121,76,181,44,211,252,253,99,131,60,129,246,156,182,140,251,43,117,127,221,98,3,46,58,163,132,11,175,154,66,102,48,4,113,65,44,35,2,22,184,112,222,20,50,188,51,154,6,182,223,180,176,53,4,103,237,32,67,72,23,159,1,229,47,5,66,17,151,105,108,44,211,249,60,33,0,213,229,85,242,39,67,27,208,165,175,153,200,4,111,156,157,154,207,215,161,139,71,40,200,57,86,140,75,166,82,0,20,65,24,234,241,243,161,116,181,206,138,248,241,73,69,182,40,54,206,110,0,138,89,199,177,151,136,63,15,94,1,118,97,23,30,70,11,35,130,157,34,77,186,6,196,168,216,224,229,110,180,177,184,206,255,9,205,125,208,148,198,159,237,176,213,23,176,182,176,56,70,105,59,43,5,215,115,119,215,183,44,178,71,231,41,72,195,148,192,149,193,18,51,88,204,49,84,232,105,9,79,252,53,243,184,180,216,80,79,77,95,161,211,14,231,46,139,213,163,243,17,152,122,108,39,11,113,82,111,224,234,207,76,143,179,1,34,28,212,250,78,83,244,35,155,72,168,1,211,27,16,81,164,236,91,219,241,103,150,64,200,219,244,45,79,232,167,188,124,125,37,131,100,158,25,78,169,161,209,52,52,180,38,178,188,196,114,102,120,207,25,21,84,51,28,240,156,104,223,227,9,245,86,70,215,76,14,116,206,26,44,84,204,18,246,21,183,164,245,236,17,90,72,68,187,54,194,121,65,216,75,89,3,205,123,200,107,115,60,175,213,92,189,6,122,10,92,6,20,195,174,167,43,34,133,46,178,39,28,71,175,190,55,125,110,239,232,150,54,253,14,26,170,101,154,100,143,78,128,223,103,84,173,12,151,220,45,203,13,94,32,211,196,143,132,186,73,15,218,143,66,17,112,85,164,174,242,4,135,122,122,17,113,24,113,3,194,183,102,72,27,33,182,115,96,103,80,187,192,193,33,143,61,69,194,133,75,174,90,68,184,64,47,131,223,57,156,193,226,34,35,3,30,157,63,165,18,77,196,103,230,246,210,0,139,207,12,208,13,185,122,212,17,94,157,227,133,6,120,134,170,157,208,223,61,228,67,136,13,170,247,177,97,205,149,65,69,4,73,168,28,201,12,7,151,53,130,204,85,160,215,32,240,141,237,168,152,19,210,97,216,251,224,131,61,146,53,175,161,133,167,251,228,77,140,212,196,199,8,53,210,153,12,19,182,49,50,4,2,140,128,65,226,32,126,78,166,114,91,181,31,38,87,143,238,180,88,237,124,99,40,152,240,230,69,3,20,184,15,109,197,208,198,184,142,203,199,72,32,209,198,85,185,62,46,73,38,36,67,34,181,47,12,112,242,229,35,211,141,235,160,194,35,47,148,101,240,225,212,230,115,50,172,214,12,57,225,46,108,26,25,220,232,181,141,12,205,136,123,132,114,68,164,45,208,75,203,117,84,41,36,169,74,134,139,25,68,83,152,194,182,19,124,96,12,249,136,188,224,60,127,67,151,240,149,45,143,126,194,29,179,47,205,23,197,163,67,137,221,198,149,50,211,242,72,37,88,78,140,92,206,105,99,48,32,101,53,244,157,204,48,167,22,114,54,67,55,208,26,88,77,3,183,237,110,127,220,21,38,252,179,180,4,212,195,6,234,231,208,52,59,64,79,110,8,158,171,24,95,78,252,84,166,113,126,153,61,58,211,251,255,56,91,212,203,171,213,197,207,143,78,118,7,102,224,186,236,28,206,204,208,10,216,195,240,145,125,236,121,72,172,182,92,14,123,135,113,4,186,23,242,42,79,206,195,0,246,149,55,51,167,14,53,119,67,96,4,182,115,196,231,251,129,15,60,77,109,88,198,94,132,51,118,92,193,74,166,235,0,39,193,212,57,119,117,30,228,84,219,233,48,41,167,57,251,156,89,141,123,230,200,132,111,36,72,59,32,34,199,14,81,73,237,252,208,180,57,204,239,132,100,141,178,11,69,165,37,242,3,130,25,178,154,229,246,34,207,39,42,240,176,59,31,139,166,69,210,182,124,211,115,168,38,8,137,203,113,227,206,126,204,6,171,52,91,155,67,130,128,40,109,106,250,14,82,161,221,48,52,61,164,224,70,225,148,166,140,176,49,203,71,233,21,146,14,64,140,94,72,148,75,13,200,103,48,173,41,146,170,61,0,204,193,167,6,166,205,185,186,150,7,255,193,178,133,188,178,151,209,54,123,229,155,145,229,189,145,103,89,17,187,140,111,184,74,134,63,102,50,151,222,130,69,76,51,34,98,50,165,53,56,100,225,78,77,57,37,104,159,140,96,135,153,128,76,224,200,98,38,9,35,54,149,167,200,129,247,249,211,159,136,179,205,221,32,140,193,25,77,10,55,237,148,86,234,91,211,25,154,251,62,205,22,73,222,10,72,76,218,100,33,186,81,248,146,120,47,156,178,153,110,193,174,180,131,41,123,0,66,58,2,75,218,164,239,146,171,61,197,168,100,223,147,109,239,19,202,8,44,72,202,240,67,33,175,106,235,174,5,187,33,8,20,218,35,218,59,25,250,14,153,251,46,81,150,199,140,190,43,68,47,226,217,123,50,40,30,157,119,5,69,67,160,182,109,68,29,66,208,81,4,158,5,178,65,111,132,254,104,58,197,185,150,109,133,132,13,43,112,118,50,207,1,212,136,180,151,214,230,197,176,13,77,195,174,244,134,216,200,113,63,52,74,243,203,204,252,154,12,68,34,9,98,18,123,79,90,188,26,73,205,188,243,185,205,50,125,116,114,151,99,53,46,231,183,34,108,192,159,59,185,156,182,200,169,170,92,105,59,122,213,138,204,107,153,6,171,183,227,113,96,125,159,147,69,34,35,199,28,253,180,81,177,98,135,205,14,123,117,6,132,20,49,228,206,57,173,213,63,137,189,255,75,169,96,71,76,91,88,238,61,199,191,221,135,89,31,86,188,28,103,25,109,162,165,17,109,140,104,23,213,241,42,41,227,199,134,236,0,223,162,16,124,108,134,155,107,11,190,200,12,53,59,12,16,42,114,89,153,64,35,65,9,18,67,217,16,197,182,235,161,211,75,199,140,34,86,58,161,4,107,8,113,44,139,132,250,169,119,110,135,247,126,13,103,239,6,206,85,238,2,119,101,161,110,5,83,254,212,5,65,24,40,164,208,114,12,228,198,69,177,55,69,30,151,80,55,37,158,105,89,6,214,37,250,155,129,72,96,117,230,147,23,76,91,102,101,98,7,49,116,17,164,55,174,106,132,169,11,11,205,114,35,225,145,18,35,107,78,221,248,181,207,210,222,18,251,251,9,238,199,19,216,156,60,24,252,217,239,92,228,209,1,72,190,139,226,145,65,15,75,94,15,26,210,51,9,69,78,61,230,96,122,107,213,47,217,98,228,156,253,29,130,102,151,191,122,108,4,45,179,191,95,187,195,179,22,117,146,195,199,53,43,139,79,184,16,33,154,170,70,10,210,111,100,21,62,106,25,130,107,94,204,30,27,172,56,43,133,173,183,13,140,71,199,143,217,122,145,54,140,164,107,46,202,43,75,245,29,213,12,64,18,200,108,140,65,239,31,28,225,21,84,194,74,114,59,217,142,52,225,204,144,135,7,70,123,196,160,31,69,108,56,126,247,224,129,198,146,185,227,35,71,16,108,46,40,119,152,86,20,41,233,174,7,123,210,69,250,63,128,221,97,58,65,31,231,206,232,51,145,170,190,229,7,106,89,108,248,112,18,72,94,96,219,194,6,166,45,210,206,163,35,173,29,108,121,17,197,54,201,174,64,53,35,80,163,220,107,70,82,157,249,199,182,99,149,91,77,13,3,246,60,208,14,11,17,55,54,145,41,173,249,150,238,142,53,18,55,14,158,77,203,166,42,135,171,52,144,111,135,63,130,80,167,107,6,66,243,67,8,151,101,146,228,199,98,124,113,105,112,209,176,45,75,212,201,77,173,30,35,122,44,211,188,121,235,90,214,24,136,188,77,178,172,184,150,253,100,185,235,168,158,219,158,234,185,233,90,38,115,217,143,10,93,39,60,180,61,240,32,155,107,235,111,127,87,226,155,171,186,46,242,201,93,157,214,89,114,40,138,124,150,165,179,247,135,98,158,86,241,69,150,204,15,137,154,170,67,145,210,134,241,11,23,11,122,230,29,31,138,101,177,73,74,126,232,90,243,227,246,128,129,33,65,244,75,181,78,169,103,149,212,111,169,240,43,1,170,249,121,140,201,34,206,170,228,224,164,109,58,187,160,183,205,194,38,201,70,14,211,188,45,19,64,89,173,79,124,221,148,38,7,226,88,228,87,89,118,194,109,211,133,192,143,87,136,191,252,69,212,183,235,164,144,143,230,44,174,103,203,3,113,122,122,42,198,205,12,227,102,124,209,172,110,130,100,152,131,19,85,217,246,155,76,248,87,51,228,114,205,122,153,228,170,166,233,38,223,168,142,91,186,110,81,196,82,190,146,192,58,80,64,163,13,0,87,23,217,85,98,4,132,31,6,225,113,83,227,83,77,3,200,182,210,35,204,157,48,162,241,211,31,146,201,159,60,191,96,172,241,22,79,71,242,97,164,216,126,148,230,160,108,99,145,37,55,226,183,171,170,78,23,183,198,140,216,53,41,69,90,39,171,170,121,184,140,215,134,35,152,9,147,185,88,223,224,116,71,172,111,33,16,37,21,85,43,177,40,114,186,39,171,244,162,200,230,178,246,122,73,163,136,106,25,207,137,12,169,201,211,59,185,183,45,74,89,181,29,201,116,127,18,63,116,221,54,104,162,199,217,197,182,221,30,61,54,69,241,251,239,2,52,178,21,103,212,243,169,36,68,0,241,249,211,59,212,19,170,249,183,70,76,245,13,1,161,27,196,184,109,182,123,109,120,162,109,57,142,243,116,69,180,101,224,121,76,77,199,227,45,164,230,147,231,71,71,103,239,246,50,192,223,11,130,80,58,227,88,225,228,174,32,210,199,54,65,246,69,149,244,72,153,107,46,234,92,210,240,143,201,98,2,186,211,8,152,127,204,133,80,92,151,113,94,101,88,198,45,65,184,88,199,179,180,190,53,44,81,173,142,245,87,131,10,66,192,184,27,171,46,134,35,89,237,72,224,243,65,87,75,235,250,75,93,50,195,253,84,246,217,141,86,199,139,109,127,149,102,210,50,91,195,10,220,107,82,23,7,39,162,125,86,63,9,147,108,64,242,45,12,136,193,154,178,169,244,129,41,89,243,222,55,147,131,67,242,153,44,139,23,177,61,20,191,252,170,193,14,116,66,157,104,193,114,162,59,181,22,185,106,125,33,220,238,80,184,24,72,114,90,159,55,230,233,70,166,184,101,233,134,184,131,136,36,41,107,42,182,12,242,129,0,40,214,164,130,136,11,140,100,67,235,171,12,40,61,17,95,84,69,118,69,212,157,230,52,31,1,156,121,72,50,77,146,51,143,120,224,144,0,208,151,213,85,29,19,49,209,227,218,8,70,32,96,158,94,77,196,221,175,141,5,81,9,15,101,16,167,244,121,176,34,140,2,183,94,55,98,2,157,200,192,215,135,26,44,55,190,34,250,80,35,175,226,27,131,57,17,194,100,1,229,32,115,251,26,214,54,178,75,65,210,164,199,183,84,197,186,193,150,183,139,44,38,196,113,177,161,49,146,1,32,175,69,81,174,68,18,87,137,65,160,23,243,171,146,249,4,250,68,190,79,153,135,136,107,203,173,90,245,96,221,134,215,214,239,1,142,6,68,173,217,110,67,67,166,164,26,86,175,21,203,136,226,125,43,33,168,120,172,138,72,38,108,69,196,146,48,118,77,255,84,227,177,166,145,33,94,33,38,90,181,137,10,41,50,180,89,142,142,238,91,220,10,191,107,114,173,72,133,192,185,38,178,33,171,119,176,202,117,211,188,39,87,87,201,60,189,90,53,246,65,124,11,149,61,58,35,88,82,197,246,249,209,250,190,65,20,122,87,53,205,215,12,216,13,226,99,144,23,249,45,8,250,58,37,83,40,230,92,21,49,139,115,145,23,215,108,216,137,122,153,86,48,247,18,115,48,207,195,91,245,36,71,60,136,145,189,170,73,42,132,70,44,232,90,65,241,253,118,159,246,106,8,120,53,239,8,184,219,168,215,42,208,222,230,9,182,179,171,234,152,200,149,7,98,107,182,191,68,90,36,241,93,222,204,88,149,70,145,103,183,163,179,151,88,8,25,123,244,110,183,67,107,86,19,53,249,132,113,127,104,34,227,255,198,132,254,104,190,237,96,120,33,58,171,53,48,157,16,185,194,250,129,154,140,41,192,83,15,94,135,252,27,50,50,123,0,217,28,83,173,161,109,117,237,108,56,221,84,200,238,109,103,200,118,178,139,197,237,140,126,59,53,177,209,12,200,115,183,11,252,48,96,147,61,244,179,75,80,250,163,246,208,22,85,129,111,172,180,79,246,106,237,215,197,37,25,94,119,25,110,223,145,125,137,207,148,190,103,27,85,25,178,100,154,255,4,62,234,217,162,164,249,164,106,252,153,10,61,229,56,30,107,186,232,151,53,33,154,219,253,64,133,251,219,209,229,234,98,149,214,15,153,173,36,169,151,203,121,9,101,254,77,92,165,51,49,22,207,196,69,93,196,19,44,134,202,227,99,212,96,70,101,64,202,126,203,36,158,39,210,177,120,65,67,20,101,250,129,69,239,113,51,226,86,182,86,186,111,145,192,80,29,147,129,84,31,49,80,198,135,226,78,141,177,85,70,171,2,214,129,185,72,243,56,203,110,39,165,50,98,177,75,236,76,42,230,253,26,181,37,254,86,155,245,53,217,192,210,36,126,149,166,137,99,89,59,122,241,162,40,105,93,173,233,217,242,54,185,57,129,88,27,254,30,253,183,130,70,90,195,156,250,232,212,176,107,111,52,181,67,58,162,161,14,77,35,216,78,227,144,206,110,227,156,173,113,245,108,107,100,253,124,105,183,106,8,34,187,51,131,111,50,22,213,32,54,88,176,99,38,200,241,118,72,199,59,187,112,187,117,101,241,69,146,181,48,201,10,82,193,141,56,95,93,144,108,159,199,229,251,227,206,230,30,157,129,106,243,120,69,50,138,187,182,3,165,249,154,148,179,148,184,104,63,2,141,20,179,98,181,206,146,186,243,215,13,80,28,100,241,127,94,165,164,234,90,54,212,55,152,147,190,143,179,14,37,45,142,36,202,228,77,202,90,216,0,202,4,105,135,106,180,224,45,180,32,251,20,125,245,38,214,100,105,36,75,130,98,79,108,147,40,239,134,216,17,223,108,235,42,192,80,49,35,170,134,165,18,116,206,18,109,176,42,74,106,92,27,49,220,99,109,115,186,67,197,115,217,186,151,213,87,155,109,167,34,103,144,146,122,146,198,168,146,24,196,220,38,153,42,151,73,109,110,98,114,206,14,182,130,239,212,14,160,221,10,241,223,136,124,48,233,53,129,255,33,228,175,85,155,251,8,160,123,255,223,64,4,127,28,247,95,8,231,95,12,215,44,15,119,112,221,246,104,112,190,230,184,26,25,48,203,56,191,76,216,150,145,250,96,251,48,29,212,198,84,23,78,50,2,179,149,138,235,116,244,54,189,204,197,247,100,51,193,203,165,65,165,61,43,63,195,237,27,78,205,100,228,117,247,125,141,190,64,28,125,108,53,141,187,207,242,218,107,98,72,55,149,20,112,82,141,126,162,90,102,139,39,153,79,238,100,188,72,121,210,50,62,208,104,98,14,132,252,254,187,12,133,200,73,219,192,149,124,140,246,198,60,116,155,77,183,18,119,130,26,182,140,99,52,118,248,83,94,12,220,82,25,33,149,207,90,252,192,23,75,131,35,231,239,56,236,176,103,30,201,159,186,209,174,153,166,76,233,136,155,52,112,235,185,86,236,74,118,65,18,205,190,127,24,146,48,55,218,168,156,132,163,194,5,23,26,91,71,197,31,7,64,190,87,125,119,230,59,92,209,150,193,21,99,119,65,157,102,123,55,153,20,68,45,166,192,199,178,70,19,2,225,30,29,223,58,163,236,170,238,115,69,27,111,218,17,123,244,253,126,204,18,164,59,206,217,113,170,200,180,206,103,113,207,71,144,254,64,139,182,209,89,27,96,18,173,227,115,31,91,216,123,76,141,157,69,44,221,222,42,8,94,237,42,6,177,179,146,92,108,16,68,157,94,46,59,130,96,219,161,91,111,216,128,183,171,114,216,33,237,140,102,69,63,67,187,121,64,184,187,75,111,121,153,167,148,238,72,111,96,98,12,197,190,91,134,224,105,199,253,141,44,82,132,183,85,212,38,107,94,170,240,223,31,182,229,49,197,57,100,234,228,142,69,43,91,222,139,92,143,65,107,170,227,144,117,221,161,136,231,243,34,255,17,192,84,229,215,201,2,197,26,209,175,21,98,206,171,248,134,134,170,147,53,21,175,178,129,43,112,113,201,211,124,115,217,55,239,27,234,28,15,34,101,50,224,123,199,65,93,204,47,16,73,206,175,86,23,73,57,62,16,179,101,50,123,79,107,159,60,227,137,159,241,204,207,164,222,56,209,66,93,88,140,20,125,246,88,46,138,159,108,45,6,174,70,210,93,138,110,51,27,45,78,247,205,229,112,181,50,228,76,173,33,235,54,226,57,160,112,160,53,109,142,8,20,235,226,17,196,165,247,141,111,100,223,51,204,247,169,125,183,221,242,17,254,196,38,205,21,7,206,143,254,221,124,246,111,230,196,124,118,112,164,185,77,243,244,50,173,225,217,172,196,215,98,245,139,253,171,153,37,249,101,141,200,174,213,11,8,178,94,237,34,130,188,76,50,104,104,125,168,235,169,231,110,15,187,216,105,162,252,247,96,169,13,248,99,216,103,147,117,92,86,201,119,89,65,226,151,192,125,196,88,34,7,170,248,46,189,33,197,38,215,174,133,250,133,36,214,201,166,3,197,254,85,240,50,121,6,89,250,235,253,35,63,44,190,149,146,239,49,247,192,66,211,163,243,23,151,91,165,6,91,46,233,116,225,125,58,85,55,3,91,129,198,58,174,33,0,209,83,222,189,197,12,237,195,129,41,232,247,45,140,118,85,172,18,223,49,80,117,163,150,100,12,96,217,200,201,241,222,67,132,206,16,231,187,66,12,17,34,213,224,182,5,47,80,121,133,115,6,194,59,138,241,205,86,58,46,61,11,78,22,183,194,52,77,90,27,9,19,57,150,130,17,131,179,15,29,165,124,26,12,124,138,49,60,253,92,99,248,75,25,189,250,172,48,96,187,39,37,190,21,58,88,172,126,1,42,201,190,8,149,116,129,237,106,86,22,89,134,163,228,91,152,202,132,77,121,236,124,44,124,235,95,78,90,106,226,229,183,228,244,144,145,149,100,36,220,247,234,158,98,141,22,85,167,132,122,234,163,46,190,207,17,246,185,129,96,186,1,163,179,216,160,202,9,137,205,175,123,79,199,226,230,1,169,38,165,7,143,183,227,114,236,17,6,21,175,120,63,201,182,6,45,83,96,67,144,61,143,78,138,135,142,42,109,13,226,193,126,218,107,8,252,1,26,28,237,101,73,73,79,10,142,164,16,214,147,77,151,166,32,171,59,174,253,197,250,117,43,228,230,120,20,84,0,172,146,157,207,80,97,255,42,81,122,240,17,156,94,167,164,122,246,224,180,135,192,230,28,185,143,134,175,148,202,110,155,93,92,82,139,175,100,53,78,14,180,195,91,62,54,104,120,206,177,244,3,184,186,236,247,210,15,234,124,121,220,176,115,116,247,9,231,187,253,160,57,149,182,125,177,164,179,166,60,242,176,237,126,172,94,40,220,169,211,164,214,44,103,130,81,12,233,52,5,94,35,17,50,177,171,118,214,99,40,187,181,61,10,162,173,203,3,34,98,70,156,17,237,33,33,89,197,238,144,202,73,32,81,68,156,76,123,171,24,91,42,70,206,10,154,209,175,128,199,52,36,197,207,110,16,189,219,60,9,233,189,231,121,61,239,77,133,237,181,99,173,254,238,251,39,100,106,153,253,165,107,39,94,247,109,31,127,212,65,30,32,60,63,146,120,187,95,246,240,111,5,79,56,73,71,146,38,108,27,169,249,78,59,163,184,177,40,100,50,79,107,87,72,192,145,93,209,116,208,232,254,190,46,204,94,122,151,78,252,61,100,118,116,137,68,210,93,185,44,211,185,192,5,180,80,17,193,200,76,130,21,9,254,177,196,88,47,184,181,235,138,236,30,90,65,35,174,64,123,186,143,221,204,219,5,89,59,175,165,247,174,141,78,60,228,64,162,207,114,194,91,63,148,73,83,7,31,117,194,127,136,47,211,92,101,6,144,204,175,227,236,123,140,120,40,7,254,33,41,169,1,137,23,21,94,147,15,28,63,186,76,112,40,161,88,101,160,57,104,20,52,128,1,252,38,174,151,230,44,73,179,73,55,56,153,156,250,232,154,48,34,139,5,53,63,42,253,225,116,111,178,164,170,126,34,45,240,246,118,69,206,38,189,27,61,31,117,111,47,203,132,36,77,217,111,112,166,53,96,194,127,139,163,104,188,17,218,27,172,4,104,39,234,41,19,146,87,233,38,17,247,198,94,72,159,184,90,32,132,143,57,193,61,31,136,73,100,209,216,164,85,74,202,161,17,15,251,107,153,12,246,213,23,139,133,58,151,223,251,186,149,204,39,187,113,38,237,93,187,57,0,19,32,199,159,199,185,35,149,13,236,165,213,139,25,239,114,203,14,223,132,141,63,169,178,226,39,77,192,240,165,18,195,109,22,144,68,248,4,67,180,113,194,86,58,41,24,34,63,166,29,253,107,241,174,203,155,233,162,188,239,160,27,6,50,186,207,36,187,161,37,149,79,166,172,168,54,163,72,25,81,227,173,140,116,54,190,57,162,150,151,202,62,126,126,20,159,189,163,210,1,195,164,199,253,31,15,199,52,49,198,139,164,190,78,146,188,23,214,97,42,112,246,230,3,84,171,99,30,75,221,105,43,109,226,67,147,18,177,58,30,142,45,179,36,16,46,226,41,228,99,94,92,151,241,90,217,12,187,199,188,123,194,67,93,128,113,39,44,212,59,178,172,150,197,53,1,117,16,80,233,31,255,200,113,166,242,192,126,162,9,0,97,8,251,128,156,59,157,135,197,51,97,111,149,94,160,247,187,227,54,203,120,122,199,18,129,236,218,222,144,127,29,200,155,78,88,28,180,195,22,11,194,109,199,200,219,222,142,62,121,39,221,200,237,192,101,82,145,159,90,245,206,112,181,148,1,32,183,7,247,60,110,145,157,86,5,6,239,73,12,163,65,230,90,63,223,87,6,0,235,141,211,81,39,118,135,201,5,113,239,241,33,94,148,128,140,111,134,184,57,36,244,28,108,7,195,168,245,238,21,113,76,207,187,234,171,117,215,62,151,35,17,250,211,150,244,213,169,176,97,35,246,185,94,165,174,237,8,208,29,81,184,147,74,240,244,174,175,12,6,132,64,44,255,164,95,243,244,174,145,131,91,150,129,4,75,123,219,202,193,211,254,106,145,64,105,111,135,199,254,253,54,103,125,69,245,76,56,180,191,93,71,82,19,140,31,3,161,70,167,46,232,148,124,115,69,157,239,36,156,6,171,121,81,82,79,19,153,99,147,59,25,90,58,22,45,99,117,10,248,176,191,208,191,210,66,137,81,15,182,135,98,242,31,164,9,152,160,90,50,114,122,106,158,40,73,239,123,64,29,211,3,246,113,214,12,166,51,6,37,129,194,134,23,205,229,231,186,234,215,14,35,118,160,207,2,250,33,4,200,6,240,132,134,27,215,91,246,230,51,56,182,167,35,197,62,248,71,99,69,91,206,25,211,252,189,16,232,90,62,8,7,189,217,81,59,233,159,19,24,3,201,251,12,2,163,155,231,127,155,228,208,64,250,69,69,200,142,197,184,71,138,232,143,36,243,245,172,30,77,37,104,15,178,120,143,165,253,51,255,172,221,119,105,150,168,132,116,205,45,106,146,119,184,137,76,223,225,98,47,114,47,83,113,133,56,58,82,99,53,127,34,177,27,160,162,134,87,50,175,231,45,23,119,50,123,176,76,26,224,165,132,178,250,173,61,33,251,117,49,129,7,50,128,27,207,170,255,246,9,143,250,22,41,164,177,200,16,225,225,220,59,49,91,94,229,239,197,197,173,44,180,131,84,212,16,144,248,54,174,99,253,28,224,170,204,14,185,227,223,227,85,34,75,104,114,40,187,191,77,63,36,77,172,91,217,114,250,223,121,108,71,105,255,180,99,153,252,70,150,147,22,30,151,57,204,105,158,86,75,100,218,191,239,130,238,248,175,5,123,183,103,189,159,76,207,151,78,89,145,43,200,125,61,168,152,32,189,122,119,7,42,254,223,207,228,199,127,127,44,155,95,66,224,99,201,251,156,10,170,128,193,31,17,72,120,76,14,180,173,109,69,66,221,122,3,223,219,77,235,165,74,219,147,30,100,129,214,151,140,113,13,167,146,9,245,181,111,226,82,17,198,105,7,160,234,234,34,134,82,83,237,15,133,188,147,124,210,112,15,15,121,124,210,27,168,88,243,65,203,221,42,169,151,5,190,20,249,225,95,223,254,52,62,20,23,197,252,246,88,246,221,246,123,32,24,242,115,9,23,145,200,13,233,105,95,203,169,78,145,165,214,204,170,193,99,252,23,22,66,252,122,128,79,49,104,136,212,37,110,151,228,179,98,158,252,252,227,247,47,139,213,154,12,247,188,158,52,68,113,48,88,255,251,19,157,0,37,219,78,198,146,16,97,163,55,211,162,47,86,75,91,187,37,15,65,232,171,21,99,211,28,247,214,50,233,131,175,165,63,106,10,67,122,207,94,180,117,201,84,59,5,39,14,20,87,7,218,216,146,198,116,118,235,83,102,75,213,72,87,70,174,188,182,2,82,140,214,65,71,40,247,44,243,164,55,26,248,84,200,225,250,47,148,16,192,43,232,157,73,175,223,246,129,37,163,245,190,53,127,85,188,63,208,177,240,183,178,44,202,99,134,22,119,57,84,194,131,184,156,68,41,73,188,239,226,52,219,25,101,119,191,114,161,220,227,77,81,42,177,88,225,11,8,64,162,239,154,181,179,171,200,59,144,43,190,37,26,130,60,83,127,126,75,204,147,77,58,75,200,30,25,15,96,53,88,223,139,44,107,38,163,153,234,30,120,78,134,76,220,97,197,106,142,255,154,35,191,125,209,253,61,9,161,12,195,46,198,15,10,171,126,177,126,109,1,208,158,111,34,124,12,217,13,37,240,35,231,112,226,211,137,69,239,212,179,233,173,178,64,77,210,216,243,23,21,91,190,223,92,45,22,212,101,113,208,188,43,248,87,78,245,69,245,62,125,82,98,93,87,59,42,116,40,53,142,153,179,180,198,138,126,38,211,34,228,73,38,152,18,158,33,173,204,177,188,176,19,155,131,83,12,196,142,198,218,187,117,201,33,218,111,147,69,76,189,59,170,84,31,149,232,95,141,92,196,85,210,124,58,162,64,190,7,226,42,142,191,7,224,128,229,34,63,209,246,200,84,179,128,254,190,209,142,189,191,90,228,42,40,58,252,96,69,26,20,127,47,26,83,32,205,161,209,200,60,226,252,224,101,113,45,21,249,60,141,179,226,82,87,189,139,188,91,233,189,199,185,189,179,180,38,41,167,255,217,166,204,171,145,102,69,47,253,127,164,14,7,48,127,147,95,207,205,182,251,15,135,226,217,44,89,215,109,44,87,62,42,79,110,39,9,173,31,93,237,103,162,53,63,154,59,76,226,231,243,8,185,14,78,241,111,83,68,212,118,244,44,145,222,23,34,117,115,238,215,143,209,192,66,198,225,45,184,125,39,248,43,171,135,241,219,255,2,154,17,39,181,155,123,0,0,0};
+static const unsigned char v1[] = {31,139,8,0,0,0,0,0,2,3,157,124,251,119,219,54,178,240,191,18,241,230,112,129,106,76,75,233,227,238,82,65,120,82,39,109,146,166,78,54,143,110,91,85,203,67,83,144,197,154,2,85,16,244,163,166,190,191,253,59,51,0,72,202,150,123,239,221,95,68,16,0,129,193,96,48,111,232,50,211,143,20,24,144,144,130,134,10,26,40,160,132,28,50,88,65,13,91,113,187,131,181,152,47,96,41,142,179,188,48,173,188,102,73,92,183,231,173,106,183,237,99,222,234,237,186,61,215,197,178,173,174,234,118,163,242,86,153,171,182,80,114,158,175,23,237,159,85,213,254,187,210,203,182,48,82,103,199,5,92,138,231,90,103,55,81,81,211,115,182,106,84,110,138,74,61,218,48,5,134,223,174,42,205,46,51,253,72,62,42,212,35,195,213,92,46,132,153,203,197,76,75,211,104,245,72,237,186,47,110,152,226,183,42,12,85,180,205,180,84,230,180,90,202,253,183,72,203,77,117,41,79,214,69,185,100,138,247,159,158,51,90,47,191,197,169,220,162,197,237,110,134,179,55,56,179,228,193,133,188,9,132,104,18,45,228,188,89,196,129,150,43,122,175,236,123,49,111,22,84,154,21,43,150,233,243,102,35,149,169,163,82,170,115,179,126,246,36,12,89,17,229,56,177,150,74,220,107,255,50,81,81,158,149,101,255,37,60,225,113,202,33,240,48,6,66,152,155,173,172,86,143,76,24,170,166,44,71,194,68,75,185,202,154,210,188,215,213,182,230,29,176,119,234,47,171,98,249,104,34,132,64,16,17,14,132,116,191,207,188,89,112,143,209,51,102,160,160,157,199,89,6,72,58,99,202,147,132,69,84,33,110,17,164,88,193,22,7,137,83,184,144,55,177,6,45,87,113,5,105,122,17,227,8,144,166,254,121,22,79,32,77,165,127,205,109,33,175,84,109,116,147,155,74,199,22,86,72,211,75,106,67,252,142,199,50,110,32,77,139,248,104,10,105,218,196,147,93,183,249,182,75,143,143,75,69,123,238,10,172,224,80,244,240,95,48,126,107,63,188,205,27,141,52,65,115,236,250,30,39,72,65,126,236,110,183,250,246,107,75,147,102,93,212,17,45,89,40,160,151,188,82,70,94,27,97,250,190,87,182,111,177,98,22,74,195,187,129,211,52,185,98,248,0,252,41,198,83,78,128,204,58,90,159,153,167,216,114,225,168,99,102,198,99,238,6,26,9,38,5,53,206,205,130,251,149,203,40,77,165,159,128,94,28,138,14,144,143,138,176,128,16,216,105,123,144,63,227,242,17,0,3,114,214,207,167,104,190,110,46,124,201,237,193,196,162,133,38,143,206,178,90,10,218,79,35,38,255,225,2,110,239,13,104,215,114,166,101,118,177,115,203,67,40,7,123,246,10,129,102,35,252,102,25,134,4,210,82,140,38,60,12,117,180,109,234,53,83,60,12,71,239,163,52,213,227,113,219,86,246,216,156,85,141,202,229,7,169,150,82,23,234,156,135,33,99,213,193,150,182,109,56,123,63,56,6,239,89,207,149,20,113,73,100,23,196,33,197,116,166,253,146,185,47,61,203,16,148,186,210,6,233,81,9,29,213,235,98,101,24,135,76,248,62,224,193,79,133,59,1,149,47,52,130,85,132,50,30,165,233,37,254,72,40,145,255,230,248,131,248,121,143,192,167,98,195,110,119,80,113,234,38,42,252,29,79,225,222,145,72,57,252,139,209,87,4,56,150,148,29,37,82,217,70,214,219,44,151,159,63,188,134,47,159,132,56,70,147,32,111,163,109,45,193,159,200,43,86,241,184,129,209,136,249,94,28,114,14,105,63,51,149,105,143,241,183,88,136,20,190,99,37,164,216,173,162,61,198,95,75,46,216,67,142,240,20,127,102,41,231,124,70,123,37,38,61,198,95,178,131,242,200,210,42,10,165,37,92,194,6,110,224,28,206,68,26,134,52,115,219,174,225,66,24,191,29,184,99,165,248,200,36,24,56,131,18,46,56,172,196,100,182,122,122,49,91,141,199,220,81,230,146,8,238,98,190,66,202,100,181,56,154,10,177,196,21,36,219,248,108,78,165,69,219,110,129,74,98,5,55,226,95,76,193,18,234,59,144,193,37,125,38,97,25,105,185,10,195,26,31,35,225,222,88,109,159,239,108,129,240,10,75,14,153,37,88,234,69,83,228,109,123,9,75,206,29,230,55,254,180,92,134,33,219,136,75,14,236,92,140,70,236,171,112,73,155,192,219,182,70,240,133,5,250,34,41,197,115,182,196,141,131,115,30,31,96,5,75,98,5,97,104,73,109,36,196,77,82,138,155,24,135,47,197,101,164,228,181,249,88,156,149,120,12,8,158,38,20,71,255,221,9,10,58,155,98,3,3,14,242,177,223,41,187,59,3,164,8,233,137,125,37,50,168,17,249,142,133,92,8,37,175,30,145,252,103,154,67,37,38,179,234,169,158,85,253,190,52,194,204,43,220,147,224,172,170,74,153,169,96,228,215,208,132,97,191,178,190,54,97,65,109,240,0,247,171,109,218,54,80,205,230,76,234,253,186,179,226,188,80,102,175,174,137,6,66,73,136,143,52,82,210,56,190,85,45,196,25,241,50,104,236,222,117,63,60,190,100,13,223,239,120,2,183,94,146,196,205,238,222,7,238,80,13,39,12,195,38,74,211,179,103,147,253,129,26,218,45,104,172,232,129,38,186,144,55,208,32,177,36,244,107,143,105,67,108,34,238,190,107,160,20,213,184,166,122,161,232,113,70,163,158,141,167,112,52,29,9,150,139,134,200,249,5,107,64,66,9,43,142,196,191,58,58,2,86,8,57,207,233,44,20,184,253,173,120,210,17,99,209,182,174,128,19,38,12,143,74,30,134,76,63,203,146,250,232,40,214,79,179,48,172,199,227,161,10,211,111,143,35,60,214,216,97,191,226,60,206,71,162,12,67,150,11,81,30,77,105,8,44,142,167,73,61,30,199,44,127,86,82,93,61,30,67,255,209,96,157,36,65,139,21,91,145,30,100,105,40,27,210,16,174,133,104,104,34,4,123,18,210,130,252,202,164,64,190,193,82,113,197,10,206,225,119,86,64,193,59,66,79,123,2,127,238,9,188,83,21,113,206,7,165,172,149,20,218,238,34,17,182,14,195,234,105,39,36,16,60,61,175,80,43,195,135,221,34,35,158,211,155,155,168,3,195,236,148,101,149,6,65,13,67,134,138,160,67,228,200,236,41,189,204,8,148,239,28,100,84,168,90,106,243,173,92,85,90,90,129,13,198,110,29,231,96,8,50,201,103,203,234,214,224,184,102,120,232,119,87,235,162,148,78,106,155,48,252,187,16,38,66,41,242,9,151,214,131,213,97,231,212,234,60,190,65,152,182,157,47,28,189,40,60,105,238,240,246,88,106,91,118,201,20,79,84,84,87,27,201,152,31,10,133,186,29,109,199,121,108,188,36,231,48,152,237,197,189,189,32,181,93,209,185,40,133,69,13,228,100,46,64,38,236,50,114,191,255,57,237,255,172,211,207,176,165,163,236,44,12,11,33,114,28,41,12,75,44,209,110,122,198,135,95,165,207,88,150,76,227,9,231,118,139,229,209,20,42,33,199,211,153,126,38,38,109,91,61,237,100,207,64,245,65,104,26,129,61,18,125,116,20,87,227,113,79,145,185,163,200,191,152,185,113,72,63,154,246,104,248,100,209,192,111,131,35,68,236,124,178,64,108,74,82,236,165,54,55,204,184,29,144,73,16,196,146,199,106,110,236,113,113,85,158,41,118,167,83,182,237,50,50,178,54,204,240,68,198,114,28,108,175,131,126,194,15,7,152,252,76,197,120,14,106,115,83,74,132,130,219,183,125,6,44,185,138,168,71,148,215,245,39,212,151,229,76,150,181,188,61,212,57,37,101,110,191,123,42,130,128,67,74,24,55,104,233,164,28,85,27,50,208,218,246,147,239,15,6,130,128,182,86,246,93,37,79,195,80,226,210,69,58,55,139,253,238,88,207,119,8,203,35,132,165,114,136,12,195,128,136,117,62,93,240,74,152,145,96,70,152,72,203,109,153,229,146,149,16,60,158,6,156,67,35,76,100,170,183,213,149,212,39,89,45,25,158,43,50,196,144,230,43,245,93,149,55,245,187,134,36,76,95,241,154,70,78,154,168,46,139,92,178,39,72,229,190,8,42,42,219,150,169,168,20,183,59,122,155,155,113,181,16,18,100,146,38,50,106,68,26,53,49,195,66,14,42,202,150,203,151,151,82,153,183,69,109,164,146,154,25,168,146,85,156,161,54,24,43,103,244,62,212,163,223,129,181,49,219,248,248,248,234,234,42,186,250,50,170,244,249,241,147,201,100,114,92,95,226,174,104,62,92,250,241,117,89,168,11,246,170,141,215,252,24,130,117,192,251,166,250,52,219,200,199,199,16,212,129,29,156,80,122,85,44,205,58,32,54,18,172,101,113,190,54,254,5,237,104,91,44,139,218,215,174,42,189,113,69,147,157,189,86,75,121,237,94,151,213,149,42,171,108,233,94,117,117,245,113,107,245,129,48,12,242,170,28,188,233,170,148,174,184,173,182,213,165,165,113,71,48,138,27,125,115,123,247,44,56,91,227,145,218,229,153,201,145,229,220,238,14,112,119,137,187,99,191,106,219,209,84,8,33,195,48,56,194,225,231,95,225,249,179,56,127,110,140,46,206,26,35,153,193,141,168,165,25,212,64,7,148,64,160,166,221,1,29,90,55,63,14,44,210,142,55,74,50,43,201,240,44,237,9,76,133,125,155,75,98,23,99,181,232,25,155,140,12,151,145,17,249,120,220,109,135,140,204,211,52,106,28,91,233,228,28,51,145,68,50,73,220,147,73,30,75,190,27,192,131,234,238,95,40,226,91,88,195,18,213,112,184,128,43,248,12,175,224,61,124,132,231,112,10,47,224,19,124,16,22,188,222,182,148,67,181,135,15,172,250,217,244,201,223,73,143,111,72,37,176,166,70,106,77,141,70,204,75,107,24,10,178,29,22,28,216,74,24,84,105,120,24,226,161,119,220,232,254,190,125,160,77,47,86,236,66,72,167,70,93,137,96,171,43,83,97,143,160,80,143,62,132,225,135,168,171,137,52,25,130,240,89,176,149,248,224,237,124,146,127,97,168,231,43,84,210,23,240,74,172,146,207,201,103,59,98,116,153,149,141,140,177,41,214,100,221,228,201,153,96,53,129,156,19,200,57,26,105,2,117,245,151,49,187,74,108,67,77,90,240,7,118,1,175,120,204,134,117,215,84,7,245,158,82,250,1,106,7,156,248,137,195,231,48,252,28,213,205,25,171,177,95,109,50,131,36,234,74,196,68,112,54,37,52,108,105,94,52,145,169,138,92,121,117,148,214,103,98,190,224,112,229,133,32,182,213,100,170,164,105,45,220,64,93,251,72,124,136,206,165,121,33,117,113,41,151,31,177,237,59,93,109,200,151,212,125,228,191,234,42,200,66,165,34,231,176,177,149,240,240,64,236,194,119,230,176,22,206,227,2,75,63,44,53,94,10,9,91,222,65,253,87,80,89,184,17,137,155,109,165,164,50,255,42,202,242,199,170,81,6,237,179,251,181,108,176,218,65,251,139,98,217,125,148,166,107,171,153,28,104,239,25,235,255,10,186,139,145,16,235,7,128,252,32,115,89,92,74,215,243,47,26,45,157,72,194,11,17,218,101,219,142,16,76,217,143,92,175,171,166,92,158,248,33,62,111,151,180,69,196,196,30,104,245,27,1,175,184,85,104,105,134,145,157,129,118,215,58,195,46,60,233,89,234,1,71,104,83,11,146,59,173,84,190,160,242,133,45,31,80,253,148,243,228,8,137,250,31,188,23,147,217,251,167,68,165,94,167,122,63,30,243,189,13,72,235,179,249,251,5,159,121,90,182,212,237,186,135,97,225,250,241,142,193,31,68,181,71,199,193,234,1,30,30,34,141,254,251,14,180,126,97,252,246,80,103,70,44,19,215,185,43,86,172,247,37,190,130,33,94,211,244,189,80,244,148,98,52,133,143,196,239,52,60,23,19,184,178,155,114,24,247,240,49,12,63,50,137,222,14,207,47,252,126,65,127,144,220,156,28,78,197,100,118,186,143,233,211,67,152,62,29,96,218,234,77,203,234,246,63,156,115,15,112,103,115,212,214,31,54,30,63,127,250,228,107,156,106,184,54,143,248,115,105,200,149,127,98,71,66,35,74,108,24,113,25,141,195,222,105,103,200,72,174,194,112,180,237,247,238,92,154,143,42,219,214,235,202,153,72,126,3,217,249,195,173,184,99,156,195,11,177,114,160,172,194,112,69,146,77,8,113,226,79,251,202,234,240,236,133,120,205,86,78,52,120,71,0,231,80,10,116,107,93,178,23,60,121,17,207,95,44,14,136,85,168,7,78,80,58,43,232,128,153,126,51,125,136,182,225,204,241,218,151,132,41,97,29,248,157,38,67,130,31,121,131,117,187,91,43,112,36,26,178,79,34,179,150,170,63,222,77,43,242,100,250,205,36,158,62,249,251,172,36,219,175,236,108,191,48,44,135,118,226,140,151,98,191,162,153,55,81,129,74,219,187,21,43,185,213,176,28,19,40,137,92,104,158,79,162,241,68,246,233,232,104,198,111,88,51,255,180,224,179,183,76,58,101,252,33,190,97,161,109,91,236,57,195,147,32,173,94,226,62,235,226,2,67,86,152,176,187,156,199,141,204,99,175,78,60,102,110,170,193,86,224,70,56,5,137,180,140,101,177,90,201,165,83,52,0,213,20,66,87,98,125,104,241,192,25,246,182,139,71,165,105,238,24,90,110,15,240,132,131,107,184,112,143,104,85,233,151,89,190,102,111,7,174,230,239,220,170,58,127,179,70,15,194,211,212,99,77,143,199,252,29,75,231,122,1,233,124,60,238,30,22,39,57,154,243,105,154,51,9,10,141,136,59,108,86,242,91,210,128,105,237,107,66,8,41,3,135,76,113,23,156,34,110,220,211,83,135,120,114,57,237,176,173,3,253,117,175,184,6,213,217,239,50,55,189,125,169,188,235,8,11,168,182,89,28,160,195,75,197,206,29,176,201,182,236,53,143,233,48,15,35,117,143,217,95,168,159,200,73,55,86,253,20,218,30,57,244,214,158,136,212,113,159,107,145,118,26,104,96,13,155,235,164,17,127,101,250,196,193,38,51,235,135,59,78,255,241,143,191,31,255,152,153,53,253,252,248,54,136,155,182,101,15,117,253,199,241,245,218,108,202,128,59,206,81,144,129,106,61,209,69,231,171,182,209,18,182,17,133,245,68,7,67,203,1,149,212,141,16,163,209,117,24,178,235,100,19,149,85,158,149,104,116,9,113,29,127,41,196,166,247,209,240,91,116,208,226,40,214,63,102,3,41,189,105,48,136,79,93,123,245,123,89,229,20,129,140,114,45,51,35,209,240,70,167,18,59,225,51,41,238,52,190,44,37,190,157,126,100,13,92,195,73,84,212,97,120,194,1,169,29,137,99,99,41,112,195,82,40,56,228,164,10,20,4,201,110,48,47,250,171,79,218,54,199,227,186,204,76,70,111,204,149,79,122,61,170,16,5,18,138,165,68,203,74,17,176,154,195,40,247,28,221,226,243,2,131,212,22,169,50,202,60,226,234,33,126,47,230,108,35,134,141,136,105,10,129,44,196,198,170,240,228,159,94,161,173,120,129,219,177,17,24,23,128,192,243,240,64,136,213,192,192,93,102,234,92,234,170,169,203,155,143,210,188,86,74,234,87,159,126,124,75,189,214,98,211,117,28,217,33,79,56,225,62,160,153,176,19,154,182,54,34,251,19,85,97,159,182,13,242,181,204,47,228,114,191,199,137,171,164,113,80,142,22,170,145,179,15,76,130,11,38,108,160,225,187,14,252,19,190,17,39,247,96,79,150,98,19,255,21,216,73,141,29,58,0,147,115,124,29,192,147,156,137,77,156,31,116,191,111,218,22,145,37,132,216,180,173,133,107,3,132,62,235,114,171,121,222,182,107,39,172,240,64,8,177,118,37,27,195,176,117,232,189,116,0,113,34,137,238,85,248,78,54,236,116,33,230,139,14,195,56,238,176,43,250,140,94,178,192,200,205,182,204,12,174,197,50,129,68,90,29,68,153,88,194,37,91,242,100,25,207,151,11,199,94,208,5,33,139,115,245,206,50,47,60,255,127,125,164,99,203,144,138,164,152,79,22,177,182,188,253,138,105,152,112,43,205,247,79,124,127,218,173,232,163,163,62,203,219,150,173,132,67,58,160,101,122,174,101,93,227,244,94,175,56,79,228,61,247,130,251,192,70,19,70,226,28,245,151,145,16,114,190,90,180,237,157,81,70,231,232,132,218,58,195,248,58,12,207,71,194,69,188,236,78,157,251,157,130,149,232,246,219,65,127,22,134,103,35,26,215,247,62,243,189,185,15,208,202,158,91,191,243,2,204,153,221,135,28,229,206,123,43,14,58,209,211,180,65,151,57,21,24,7,237,145,64,14,24,172,20,40,200,188,216,143,92,92,95,200,251,66,42,29,186,85,126,247,112,13,156,248,38,106,212,198,90,118,93,145,41,14,228,190,215,114,133,177,2,237,103,192,144,174,43,218,136,184,108,219,119,76,219,211,39,185,223,108,231,250,207,237,97,215,119,140,10,59,7,185,36,14,55,177,67,194,150,239,180,85,11,181,53,10,28,55,117,65,134,65,244,227,64,148,225,119,27,88,144,144,182,237,129,99,235,130,22,179,180,109,111,108,172,128,83,100,58,167,177,237,58,93,92,186,199,229,79,222,255,236,221,254,46,33,194,123,42,44,204,93,247,63,216,253,240,224,44,21,157,100,161,48,76,39,102,124,193,9,26,14,136,6,43,85,112,28,110,195,227,7,72,71,243,4,49,19,107,220,41,10,7,91,189,175,64,21,135,226,231,255,98,41,72,193,70,85,24,234,182,77,57,177,145,115,118,98,247,112,142,110,165,6,181,135,45,164,251,161,113,250,34,153,235,69,220,216,57,210,104,85,232,218,218,26,62,143,39,29,10,40,27,153,43,220,151,58,110,18,12,97,201,189,15,161,130,146,195,119,172,192,24,220,0,95,223,218,152,202,31,132,229,111,7,13,63,28,200,89,130,210,58,89,140,213,119,248,108,144,19,100,3,69,246,185,151,252,131,49,48,113,160,158,195,255,156,245,84,98,46,81,151,96,36,41,193,200,241,185,4,243,140,98,202,136,114,148,113,48,43,170,252,79,178,162,206,152,133,23,74,208,109,107,40,226,83,97,193,135,211,7,120,250,19,79,79,247,102,124,142,139,132,116,54,164,216,59,198,34,138,27,114,190,125,148,6,88,138,46,180,57,105,211,11,114,181,194,161,111,196,192,210,239,66,135,62,65,232,254,233,30,118,183,169,51,174,243,65,39,140,24,234,227,125,6,146,85,85,144,7,81,1,117,40,111,73,220,209,224,173,225,1,152,47,131,154,186,155,170,57,219,27,88,98,48,129,41,62,163,52,32,161,14,2,62,83,255,243,122,72,153,147,165,52,18,121,40,241,84,218,73,204,221,65,166,210,37,87,249,61,32,54,19,164,105,126,18,140,49,200,107,92,48,52,122,175,171,203,2,221,156,88,83,10,102,162,147,74,213,205,70,234,1,228,131,176,99,63,54,195,232,225,208,103,43,12,152,157,18,107,27,104,1,35,110,241,20,14,71,185,99,110,225,169,154,25,154,153,162,120,204,66,145,99,74,17,178,21,239,78,102,149,208,123,174,108,127,10,170,67,46,191,151,90,99,144,159,105,140,8,80,45,123,184,31,69,61,27,98,246,75,47,86,244,158,27,233,4,69,132,21,78,119,107,81,238,181,45,186,127,187,17,188,211,255,145,38,63,129,118,18,198,240,91,37,204,206,172,117,117,245,72,237,118,32,197,4,210,61,218,24,184,231,71,66,121,73,172,134,235,222,193,245,192,119,238,87,119,103,159,108,138,155,116,1,89,34,67,242,53,251,146,171,35,143,79,226,43,99,95,112,12,174,235,113,48,69,146,252,135,66,89,95,144,228,208,159,23,78,150,247,198,217,196,126,41,110,240,75,27,84,183,111,245,153,117,171,24,14,175,40,216,130,135,102,184,188,85,165,115,249,208,225,116,131,217,34,29,188,126,154,181,15,103,63,48,176,115,235,159,128,70,57,213,28,18,111,239,117,181,41,106,153,184,231,224,99,116,140,68,103,133,90,50,223,166,101,93,149,151,146,113,30,215,210,124,42,54,178,106,12,20,15,157,158,52,189,68,99,252,200,248,210,14,92,70,22,148,226,152,189,175,10,101,48,208,185,53,141,150,252,113,235,74,143,143,11,200,197,4,50,241,35,67,59,111,133,207,9,167,68,31,220,241,239,225,13,252,19,126,134,95,196,4,126,37,63,131,194,227,168,132,34,219,31,164,43,105,72,169,100,253,44,160,93,117,14,21,149,156,98,6,141,171,239,19,134,75,183,16,170,70,87,58,61,217,27,80,240,75,219,26,142,51,19,36,82,188,137,210,244,85,219,50,122,34,19,136,231,11,72,211,117,60,95,236,186,188,6,245,140,60,35,157,151,141,94,104,227,240,60,225,219,92,45,122,49,147,15,207,200,47,98,10,153,98,239,213,158,239,34,83,94,85,178,49,187,82,177,239,199,99,120,66,38,81,26,25,161,96,148,58,103,17,62,197,92,38,20,58,124,175,152,203,6,52,28,134,164,102,185,52,246,61,77,232,23,77,15,44,204,39,11,64,247,150,193,232,63,159,153,17,69,40,105,212,83,49,151,100,52,205,167,139,133,141,79,245,124,232,22,69,131,171,21,111,96,132,24,90,113,175,162,239,115,74,210,105,45,192,136,71,199,87,70,22,201,90,116,13,136,183,85,81,26,169,247,69,146,235,79,169,155,249,142,19,22,52,6,30,245,205,193,142,216,239,116,199,185,159,168,106,219,202,10,21,146,200,22,38,154,188,113,147,211,137,31,9,209,69,56,245,97,225,72,254,207,52,61,245,8,85,22,131,179,78,235,61,37,53,248,212,231,100,34,58,93,31,204,97,66,127,30,122,191,160,10,195,251,16,181,109,179,155,17,30,133,195,77,37,222,28,150,241,208,136,55,135,2,15,179,131,181,135,182,195,51,28,79,98,213,172,75,36,213,174,27,84,34,221,53,152,99,118,23,210,29,60,0,151,208,94,76,19,1,89,93,186,167,235,213,144,177,123,170,254,146,207,70,116,4,235,48,124,165,200,247,250,10,12,39,219,156,36,59,102,47,24,120,227,40,196,241,68,57,244,33,214,135,198,253,234,127,63,238,161,49,183,251,199,244,107,88,170,189,8,205,221,4,113,212,86,230,139,193,0,235,14,221,191,136,111,160,222,255,250,47,77,92,41,20,195,32,196,236,110,60,159,223,42,114,134,113,144,67,111,74,159,109,16,134,146,241,29,249,204,250,44,114,111,235,98,160,242,190,226,217,183,219,28,119,222,37,1,201,152,252,30,121,134,170,240,96,97,203,67,216,238,179,61,15,225,154,89,62,248,74,24,231,62,86,182,162,31,244,114,95,186,252,34,254,126,24,225,143,212,142,99,178,87,127,253,99,192,223,222,120,29,110,174,108,188,189,3,239,31,131,100,212,28,181,197,164,75,122,64,51,209,130,57,154,128,161,216,248,27,204,31,27,170,205,54,125,112,112,131,164,23,33,77,45,95,200,179,230,252,39,171,85,223,173,97,38,49,148,64,63,188,68,50,0,217,193,55,157,112,144,34,87,172,207,150,179,68,250,230,190,174,70,242,232,94,237,240,144,167,214,11,224,204,95,124,7,57,159,46,72,161,135,185,68,158,63,84,193,177,201,158,125,190,27,8,170,51,108,164,228,245,14,202,41,241,94,98,176,189,242,107,72,76,94,206,172,146,132,41,42,35,231,211,245,53,164,21,59,237,216,82,13,117,104,91,235,252,21,243,9,76,22,220,114,209,224,125,48,70,8,199,193,17,22,166,139,241,120,55,80,57,6,183,52,212,48,191,126,166,196,175,62,95,222,230,209,217,132,119,69,18,135,226,23,29,3,241,172,253,74,89,175,197,126,237,231,97,45,70,45,173,222,155,242,219,97,45,16,107,145,204,94,205,192,160,134,85,79,246,20,188,55,238,158,3,106,116,88,177,179,95,221,81,168,148,221,167,11,247,176,168,35,248,55,162,171,225,208,168,48,108,236,39,110,28,189,111,145,169,48,148,88,130,239,157,254,98,4,123,227,220,74,8,249,12,93,38,255,20,66,188,73,8,239,180,140,55,190,96,72,250,62,100,17,158,250,56,187,21,127,160,34,155,113,236,37,29,74,219,216,142,186,135,94,115,15,181,221,204,223,139,9,231,240,79,241,134,86,99,181,184,189,5,165,42,12,83,53,180,49,211,52,159,25,139,166,87,46,114,240,106,47,192,201,166,35,33,126,245,234,120,24,254,44,4,106,127,90,254,209,200,218,60,87,197,38,195,209,191,211,217,6,29,131,236,231,7,91,121,219,94,43,206,46,40,149,180,83,78,14,163,167,113,200,121,37,84,212,88,220,244,88,193,21,58,155,221,234,167,119,118,223,28,136,162,121,114,189,79,170,107,225,234,31,86,147,176,67,219,126,86,206,124,183,212,91,29,158,200,105,192,76,185,77,161,36,10,51,32,239,170,35,111,206,65,171,48,212,3,10,108,238,154,243,138,223,86,42,12,171,126,211,192,93,210,153,73,171,23,191,114,188,246,97,116,226,218,175,8,248,222,163,41,20,205,111,69,136,87,173,156,226,142,9,114,54,174,200,119,52,231,137,58,232,230,59,180,201,189,77,112,173,6,87,154,134,254,137,188,148,153,118,166,16,222,137,57,81,97,152,103,42,151,229,254,80,104,253,245,70,19,157,245,84,12,42,36,124,249,53,159,225,215,204,136,131,192,236,171,31,87,67,177,214,97,241,176,204,183,1,99,143,24,180,223,224,205,240,134,217,231,225,88,179,222,79,203,238,244,123,181,39,131,71,20,116,181,39,139,152,184,45,162,243,236,14,33,237,57,117,81,227,157,203,197,94,140,247,253,222,192,135,110,42,90,33,105,118,8,228,75,37,238,123,90,200,84,152,97,174,173,187,15,98,245,227,233,108,144,62,141,238,235,91,171,214,155,57,102,76,67,65,215,65,18,134,223,181,162,73,166,241,19,76,225,165,198,5,143,205,124,60,174,22,179,47,5,58,42,81,73,23,69,252,149,123,153,46,132,141,232,68,89,93,23,231,138,97,21,186,72,160,224,241,215,212,137,170,132,175,231,115,59,28,14,242,77,55,136,175,28,139,98,28,4,113,147,144,255,61,219,110,203,27,86,192,75,92,33,58,114,231,129,13,156,44,56,198,169,136,127,105,14,24,32,74,44,236,79,98,102,230,213,209,147,133,152,0,174,73,104,206,99,215,179,232,34,42,233,14,62,42,242,70,254,152,109,123,234,126,62,32,128,143,10,61,72,214,157,208,233,26,40,137,253,103,240,145,18,80,173,190,111,56,7,102,196,75,229,94,233,91,197,73,114,99,39,188,132,48,60,189,157,78,128,187,38,166,160,69,16,64,133,63,141,64,181,163,216,235,141,169,100,148,190,221,182,76,11,221,167,6,255,251,183,250,139,223,212,111,245,23,173,47,60,62,62,199,92,109,206,147,198,46,122,2,10,52,199,48,182,31,66,243,132,185,198,47,169,17,82,241,132,199,79,108,143,32,138,162,64,8,129,145,33,63,198,87,160,96,210,245,208,97,56,234,154,190,134,9,140,38,56,67,250,76,124,141,23,231,116,219,142,84,24,226,214,227,29,71,63,85,10,19,208,104,45,165,226,27,114,25,245,13,10,38,190,129,19,38,118,80,138,201,172,124,234,143,213,172,68,138,197,203,44,14,19,5,227,80,176,146,243,142,196,115,49,153,229,79,213,188,92,248,111,242,241,152,27,129,53,243,124,1,244,97,18,60,197,165,153,132,225,0,141,152,55,11,72,197,151,60,214,99,97,136,162,211,36,56,58,114,203,15,158,185,206,126,131,120,172,133,25,107,116,9,84,137,17,66,84,9,110,153,253,250,111,193,223,132,205,71,255,155,253,172,18,38,238,134,192,249,82,49,229,49,238,65,32,186,129,191,6,41,180,27,60,56,166,106,244,42,60,253,186,109,237,183,22,254,241,116,193,237,32,126,31,27,209,204,39,11,28,180,1,255,98,241,249,4,38,168,200,166,98,194,227,224,81,224,128,250,205,116,37,213,149,244,30,116,79,44,30,186,57,130,81,135,10,150,138,175,192,205,226,207,16,161,112,103,239,144,112,232,3,10,243,5,231,62,222,48,77,76,140,231,146,248,213,169,18,207,157,39,237,220,138,189,23,138,238,132,119,23,47,212,255,249,138,250,135,125,15,16,104,113,204,146,248,183,132,205,255,253,95,139,47,56,79,216,127,69,95,240,228,241,49,84,2,115,96,80,82,106,220,250,219,29,106,232,232,95,192,187,8,126,198,66,224,107,84,111,203,194,176,32,12,184,35,196,98,143,16,45,189,21,72,107,174,167,8,248,172,153,47,101,94,45,49,162,213,89,251,44,71,140,45,196,161,22,119,57,97,202,163,223,171,66,209,24,124,167,196,91,197,84,119,192,53,157,101,48,88,139,59,22,244,4,159,9,76,143,137,54,217,53,243,199,4,60,135,247,87,49,51,159,249,98,40,190,28,196,180,223,243,213,34,202,215,153,126,110,216,196,121,162,106,91,219,241,21,246,239,184,157,143,191,72,22,227,199,220,50,20,216,10,26,197,225,240,216,181,30,243,182,125,161,56,178,222,54,8,96,45,254,223,182,203,83,11,198,1,135,229,94,205,23,1,222,228,84,54,138,30,144,141,116,25,134,35,188,168,59,232,149,4,252,233,164,109,215,156,223,166,98,52,237,147,108,154,121,125,16,151,151,28,214,109,187,228,183,212,65,57,204,174,56,37,61,221,239,239,49,126,28,184,228,213,93,119,83,5,151,72,146,121,181,216,155,220,229,171,141,40,40,231,131,122,120,83,97,100,185,92,51,184,97,112,215,255,171,51,117,241,212,208,35,153,198,246,253,153,123,63,194,10,90,248,145,177,207,193,213,128,187,3,81,187,48,96,135,56,24,74,112,198,184,3,48,153,196,68,78,182,114,155,153,181,69,201,119,202,163,32,224,120,130,193,117,25,164,218,237,143,58,32,140,223,142,199,237,111,199,29,93,248,19,112,28,12,211,236,6,95,19,209,169,158,224,146,233,56,248,98,156,4,221,118,119,109,158,140,143,166,120,241,246,171,248,107,226,26,175,145,71,192,99,133,202,246,59,250,253,93,89,115,241,39,37,110,27,93,198,63,40,198,119,240,135,18,127,178,159,20,239,217,201,183,189,93,190,81,236,15,101,239,166,9,33,126,234,132,60,58,18,230,211,197,108,117,208,133,242,78,117,1,139,131,141,184,244,92,178,119,170,91,139,225,48,229,222,195,101,59,206,21,252,57,116,107,255,208,65,229,255,81,32,24,51,166,196,239,42,12,127,87,148,123,134,253,146,65,57,118,109,24,29,181,62,168,183,131,94,247,107,25,143,131,70,45,229,170,80,114,217,39,35,116,67,119,227,190,86,156,168,66,145,153,23,4,124,140,87,184,100,166,209,121,18,12,119,244,207,125,90,236,2,212,134,244,116,12,79,248,251,102,163,65,200,72,69,141,46,169,71,71,66,128,127,126,208,232,114,223,237,222,187,72,30,119,50,223,96,26,79,177,98,143,241,74,81,148,103,234,67,213,80,240,179,247,139,187,194,116,71,255,73,112,39,40,182,15,98,128,59,25,112,176,168,156,155,69,66,191,168,77,31,194,213,186,168,77,165,111,194,208,21,230,102,28,144,67,63,88,28,170,99,131,75,200,120,162,192,36,129,91,112,16,251,169,191,87,123,127,145,242,253,157,149,143,166,24,34,156,201,167,61,10,228,120,204,31,163,248,139,52,174,253,83,69,235,68,132,79,14,221,22,125,211,249,222,17,245,231,131,20,199,222,15,63,172,101,246,174,24,39,179,105,191,193,100,250,92,26,123,231,143,60,9,142,237,255,251,183,227,99,250,115,135,145,108,91,217,213,166,73,45,203,213,227,227,162,11,38,32,197,152,97,134,208,63,247,57,74,109,170,237,235,205,70,46,139,204,208,93,139,236,156,104,18,33,127,168,141,81,210,173,169,182,7,250,223,237,182,213,116,225,234,133,101,132,140,195,104,112,195,243,103,143,168,17,114,31,163,203,31,228,13,26,113,27,105,50,87,204,74,227,74,228,44,115,229,179,198,152,74,241,30,157,22,79,120,219,23,61,213,25,201,215,62,127,20,17,119,8,225,54,178,16,173,179,122,208,132,217,153,71,42,51,197,165,12,56,90,143,251,205,190,197,95,49,43,86,236,13,162,216,227,155,240,187,115,217,254,232,67,236,175,47,243,29,113,210,95,20,202,179,14,9,191,58,207,70,71,234,12,25,171,127,229,131,136,176,101,179,116,108,219,150,184,237,238,147,98,191,170,62,72,106,111,85,193,237,193,96,71,124,192,249,50,161,128,15,142,94,96,218,60,14,141,182,115,159,133,65,115,169,168,82,39,107,76,168,220,111,244,181,59,240,108,33,190,31,196,59,101,131,47,186,123,2,179,61,14,230,135,61,167,168,222,14,220,49,139,239,69,159,251,120,30,161,98,231,125,109,54,23,165,231,77,123,25,48,219,182,165,231,32,174,141,87,89,119,112,255,110,84,60,16,48,246,91,49,154,12,58,250,75,80,195,126,86,180,97,239,217,47,104,25,226,254,78,224,119,213,182,247,238,175,226,205,72,218,202,0,134,114,238,123,197,112,59,201,155,117,255,155,188,44,242,139,0,126,70,13,255,177,23,133,104,14,19,19,181,216,109,4,202,41,250,100,232,232,240,65,15,211,201,176,182,197,44,23,207,198,80,230,201,187,162,71,14,69,15,39,159,160,71,197,244,14,206,92,130,204,16,27,135,188,37,4,161,203,18,192,108,199,199,157,204,126,60,144,217,180,164,41,191,59,197,29,218,125,112,95,30,238,56,221,193,121,124,199,135,45,148,247,73,254,75,113,251,39,54,63,170,94,171,183,18,96,79,0,184,192,35,138,1,208,226,3,186,145,210,129,70,231,95,108,180,215,113,131,121,10,122,177,219,129,77,124,136,15,164,139,96,202,160,232,207,23,224,127,245,52,186,196,171,215,68,210,232,18,178,39,227,148,245,9,64,28,239,55,99,230,56,153,132,63,48,116,188,192,39,197,62,41,123,48,42,32,137,32,235,88,138,98,62,93,80,174,200,45,254,137,149,143,153,202,85,60,240,249,86,35,33,24,133,78,81,37,224,183,159,20,251,73,117,48,8,55,38,242,242,162,106,234,216,247,4,31,77,76,1,81,16,167,201,16,35,54,57,176,3,4,115,117,44,225,105,155,105,214,68,89,142,188,84,164,201,60,93,196,243,69,135,253,82,188,235,93,14,168,126,188,67,243,27,99,248,135,60,138,152,9,201,154,206,30,62,103,127,168,46,183,10,110,237,165,213,102,71,121,178,150,93,220,113,1,119,223,5,89,128,72,188,173,212,9,30,185,248,103,133,87,52,48,163,236,129,15,6,233,98,200,182,102,242,122,91,105,115,123,253,40,171,31,117,204,23,78,240,245,59,157,157,111,168,159,193,215,183,133,186,0,67,69,98,89,240,171,234,202,26,126,192,114,94,86,202,223,67,128,63,169,134,174,38,184,156,60,56,239,171,124,175,139,190,234,131,92,193,7,26,83,94,203,28,126,160,98,175,162,126,214,165,29,96,13,167,212,132,153,222,240,45,149,110,150,26,67,246,41,190,20,245,79,89,89,44,253,4,4,176,77,177,174,225,15,124,113,215,136,255,164,65,104,119,225,20,139,166,162,4,66,250,239,27,184,164,214,166,150,39,89,89,158,101,249,5,108,186,26,183,154,27,95,209,135,34,97,229,235,94,174,86,50,55,112,222,189,99,254,216,183,85,163,150,153,190,129,51,95,253,122,9,235,174,188,217,74,77,162,250,85,166,150,165,132,218,183,188,205,110,170,198,184,33,151,190,246,71,185,169,32,243,111,31,228,178,201,165,134,109,95,177,130,111,187,23,187,75,185,127,39,137,180,155,253,127,41,29,234,230,96,80,0,0,0};
 
-static const unsigned char v2[] = {31,139,8,0,0,0,0,0,0,3,237,91,109,111,219,186,146,254,43,182,47,214,144,96,86,181,123,206,61,187,43,151,215,72,211,52,9,144,32,65,147,246,124,8,140,3,197,166,109,181,50,233,82,146,147,192,214,127,223,25,190,72,148,45,167,233,222,158,189,7,187,251,37,150,248,50,28,14,135,51,207,67,49,237,89,206,39,89,44,184,151,17,238,111,58,226,254,11,155,100,29,74,179,167,21,19,179,22,123,92,9,153,165,221,238,94,205,82,76,243,132,141,244,79,96,218,81,238,249,97,199,202,172,26,79,217,44,230,172,219,213,191,65,180,156,142,244,163,119,55,134,113,195,67,227,142,204,111,112,22,167,153,144,79,74,126,230,190,21,94,182,136,83,82,78,195,223,72,150,229,146,183,170,137,249,27,251,220,226,158,240,55,241,204,99,119,98,236,155,134,248,108,245,31,174,35,217,146,20,139,232,198,148,133,155,130,196,211,80,144,68,68,83,54,13,219,131,98,104,186,102,216,117,18,37,137,39,173,4,34,73,245,204,125,120,209,221,104,187,95,85,20,56,12,163,155,82,16,15,150,20,22,32,152,80,6,127,87,180,211,33,220,235,195,228,238,220,245,33,12,86,40,79,89,43,205,100,12,214,26,150,243,18,56,75,171,84,183,155,5,127,252,193,210,75,189,66,89,184,1,91,71,121,146,133,89,81,112,167,10,117,130,49,37,139,50,118,29,101,11,10,67,71,50,181,207,137,152,68,40,61,61,146,236,228,91,30,37,212,54,190,48,53,101,193,37,91,194,122,148,203,98,74,207,162,116,177,91,246,78,138,135,148,73,91,188,22,241,180,213,183,102,247,222,248,195,43,229,9,129,118,143,107,41,86,76,102,79,30,39,157,250,208,29,178,97,60,95,50,25,221,39,44,132,137,204,89,22,238,123,129,220,209,184,40,124,114,112,132,189,9,191,120,144,189,158,48,142,154,84,12,147,26,60,51,169,210,222,47,28,42,174,86,232,217,169,84,139,250,98,193,85,23,171,124,4,202,255,187,79,38,84,120,145,79,114,120,251,15,159,164,240,150,251,100,6,111,255,233,147,4,222,102,254,240,192,234,78,2,227,121,164,201,37,210,189,218,186,27,37,182,190,32,59,81,202,221,3,59,14,13,239,209,116,122,193,162,105,204,231,55,9,12,71,221,72,160,103,219,121,13,145,134,102,193,100,17,201,163,12,54,26,108,18,40,235,193,72,60,64,193,171,31,23,16,164,249,61,116,133,213,14,43,49,215,18,86,230,145,214,213,55,22,239,43,9,49,159,178,199,171,153,199,29,17,176,245,24,159,103,11,87,210,173,140,226,228,229,26,101,70,196,171,129,146,155,196,19,230,245,201,43,171,92,181,205,93,73,184,230,156,102,219,45,8,35,12,131,144,192,63,18,54,175,85,179,243,183,142,63,148,109,74,95,13,186,93,79,64,141,209,89,250,132,87,111,16,235,124,187,1,156,206,35,236,108,252,205,202,96,85,175,120,71,70,236,99,193,148,77,196,148,125,250,120,14,54,34,155,21,40,205,163,37,11,57,73,89,36,39,139,16,164,194,204,217,168,211,9,25,89,128,117,66,80,18,74,4,150,136,162,168,135,184,134,249,6,86,38,204,25,108,165,164,194,204,179,0,133,193,236,25,47,21,80,166,41,231,0,9,13,6,135,137,192,131,39,123,212,104,226,120,5,67,237,122,204,39,2,154,254,13,155,10,211,84,171,232,52,21,168,118,79,64,198,40,234,254,254,231,68,253,23,4,247,90,108,54,145,38,74,211,120,14,102,168,101,87,33,61,109,202,193,144,191,141,228,28,162,13,135,156,173,61,112,200,123,61,109,106,70,203,186,59,62,30,218,110,162,21,131,41,125,51,192,74,138,76,32,8,64,235,95,61,112,27,212,116,154,101,68,248,96,64,204,187,42,73,251,133,157,62,228,104,12,181,125,159,68,16,146,98,140,90,240,58,192,176,37,188,9,134,45,21,136,247,38,89,183,52,136,223,104,175,53,147,55,155,11,77,207,231,21,60,201,70,94,76,193,67,211,106,39,249,96,10,18,195,102,5,233,20,32,13,52,144,30,64,7,40,213,178,96,189,227,210,213,96,18,213,11,108,50,213,85,121,222,72,187,148,125,173,60,68,117,209,133,232,105,61,251,226,135,85,113,7,196,160,215,142,180,179,233,151,29,17,88,132,254,215,211,143,216,93,23,117,140,162,208,145,119,187,142,210,106,78,122,120,51,59,84,247,43,123,2,180,34,106,51,25,193,246,104,187,243,220,25,187,156,49,216,46,178,225,221,119,42,136,40,31,125,212,172,236,224,148,147,184,104,116,224,198,40,91,237,110,152,10,119,236,111,119,186,42,214,143,88,168,76,129,69,248,128,5,56,77,124,135,95,152,66,159,228,149,218,153,182,135,10,209,240,235,127,111,227,42,111,167,78,238,45,134,89,137,156,197,159,190,235,75,148,245,11,152,144,122,2,99,182,163,12,214,102,148,231,73,66,156,109,225,88,146,114,183,121,70,149,155,120,186,11,206,157,57,189,112,43,65,14,64,172,141,213,109,154,217,141,213,192,14,178,81,134,61,32,55,13,247,118,90,60,106,232,32,70,176,197,65,124,40,189,118,31,255,98,54,105,15,252,130,37,96,49,85,88,64,4,7,110,33,27,2,62,196,63,230,174,2,71,35,70,171,85,242,228,105,167,39,101,156,242,75,132,14,254,151,167,11,143,213,76,6,178,6,48,142,8,102,113,146,49,233,237,167,229,86,134,233,161,64,243,196,238,152,54,248,101,116,55,94,130,241,143,164,140,158,48,156,48,218,31,178,183,217,144,65,8,229,119,108,236,4,80,54,30,194,176,66,158,68,147,69,227,184,245,25,113,191,40,231,178,73,89,6,97,117,185,202,32,137,78,4,159,197,114,9,240,130,167,49,202,184,21,144,70,161,47,227,211,11,0,98,140,51,25,74,194,69,22,207,158,108,65,26,198,136,17,185,221,10,52,254,65,136,54,137,248,167,148,189,191,186,164,109,175,147,115,141,95,167,213,2,63,0,100,16,15,219,109,91,63,4,83,49,81,243,222,47,49,241,252,36,97,248,6,120,1,225,223,201,26,158,173,178,116,119,91,85,22,218,105,57,218,47,82,158,220,70,216,20,68,89,6,182,86,181,94,7,188,177,135,194,48,18,73,64,173,107,246,194,49,27,26,143,26,75,157,145,167,236,192,200,0,229,143,245,250,237,39,179,114,76,238,25,147,153,165,6,39,81,157,211,124,165,34,143,133,219,123,161,192,116,227,209,58,158,71,208,36,128,53,149,71,115,208,194,56,146,87,193,215,206,17,159,74,116,181,55,65,199,167,26,218,53,212,254,26,244,77,245,118,235,84,95,138,251,56,97,173,155,104,22,201,184,169,193,241,2,252,149,117,252,246,94,205,239,74,201,180,117,189,16,220,54,192,92,99,148,95,232,201,1,250,194,237,123,131,97,186,3,112,163,94,91,51,199,181,88,169,102,87,28,185,202,241,34,226,243,90,180,48,86,61,108,156,74,183,91,25,79,161,192,76,200,29,228,84,252,30,103,11,145,103,31,25,30,15,124,74,33,230,157,213,128,253,15,13,244,33,6,158,33,30,157,129,226,244,228,49,131,61,205,68,142,51,82,249,73,57,80,3,117,104,149,169,62,179,169,254,217,209,142,101,124,117,99,199,250,177,148,103,64,22,145,36,38,17,153,168,252,208,54,129,57,31,194,75,169,10,247,115,202,217,67,235,68,74,8,149,157,203,152,199,179,152,77,91,236,113,194,86,58,15,78,38,185,148,108,58,108,225,128,217,130,181,184,224,175,150,182,225,148,173,91,140,175,99,41,56,70,134,22,196,74,213,104,6,233,168,197,80,106,107,201,210,52,154,179,86,196,167,45,216,248,42,252,69,73,107,193,146,21,180,106,61,68,146,195,186,164,224,209,67,76,44,74,203,148,222,57,19,24,3,15,238,15,93,77,49,28,172,146,8,232,214,235,127,75,95,207,27,14,166,210,187,89,175,55,46,0,67,229,129,70,127,231,28,36,199,17,40,249,57,22,137,62,222,40,50,112,249,135,86,30,204,36,180,73,111,5,172,34,29,144,188,248,151,96,6,175,33,9,223,60,45,239,69,2,59,43,85,15,187,21,65,12,25,17,93,104,212,148,157,76,226,47,194,166,74,144,121,120,184,12,227,24,76,48,159,128,108,112,148,178,188,109,159,43,14,49,178,186,133,229,128,228,47,79,100,124,197,100,126,65,34,227,41,38,195,188,223,252,218,41,204,27,75,103,212,41,204,175,246,20,134,76,225,237,239,62,1,40,191,50,91,30,32,61,237,32,146,157,168,56,214,33,43,55,194,100,242,105,39,202,152,128,168,195,192,118,187,41,10,0,217,0,48,202,197,129,146,130,52,228,138,93,99,253,163,111,25,4,44,75,101,173,254,120,228,190,132,128,128,167,21,24,24,233,30,33,160,236,73,133,178,33,7,14,245,170,212,149,36,138,69,76,119,243,152,239,1,219,6,88,225,86,53,197,116,108,23,67,196,131,213,155,176,143,108,38,25,144,253,136,150,74,199,221,110,12,246,205,48,201,130,122,210,77,180,196,30,92,130,255,205,70,211,221,60,28,206,200,156,42,230,112,161,33,221,178,106,62,31,253,22,206,201,3,84,223,71,41,83,156,73,241,200,253,67,30,223,83,21,59,167,89,200,58,108,79,96,72,64,218,174,155,207,112,54,8,200,21,109,33,234,152,70,49,149,216,218,208,178,39,152,177,67,190,38,37,237,4,63,211,180,16,76,16,245,38,189,220,226,224,7,240,218,25,173,84,214,39,92,190,55,35,15,224,164,138,241,238,242,98,240,204,141,26,62,20,4,212,9,17,14,147,251,134,84,119,9,205,3,72,90,83,177,244,252,32,19,55,138,11,120,191,252,230,219,51,161,55,100,9,125,175,112,252,164,242,16,159,60,214,211,154,119,138,180,251,212,248,34,181,231,105,228,42,216,193,177,222,105,101,137,211,32,82,18,96,128,139,154,56,229,74,7,19,42,242,254,237,246,200,187,182,116,16,209,213,141,59,59,172,91,121,62,150,159,32,97,56,170,73,135,164,119,226,171,242,71,207,201,51,156,118,174,175,174,59,195,171,160,1,161,171,96,255,84,197,126,136,251,108,244,232,109,244,4,0,213,219,73,65,68,247,195,63,96,24,197,64,254,104,240,20,199,0,140,94,86,199,145,232,56,160,14,45,79,233,250,190,73,230,85,163,76,55,18,180,60,14,52,141,128,100,190,18,67,9,69,39,200,182,142,129,105,194,228,191,82,109,7,114,73,239,190,98,215,49,185,109,130,35,15,61,229,65,213,161,29,154,184,32,103,46,140,48,231,52,18,172,244,233,230,172,67,212,105,76,190,115,184,227,99,67,114,239,41,87,176,101,7,44,10,116,210,181,168,94,24,99,37,65,111,245,137,146,58,244,80,91,67,173,52,2,22,230,35,197,13,74,116,233,109,208,197,39,68,59,124,14,88,12,9,181,128,104,238,239,108,189,96,1,91,135,10,23,90,84,166,173,20,86,54,134,93,120,89,158,226,166,202,222,163,126,152,246,32,52,206,52,49,141,117,187,75,58,35,149,35,200,202,17,226,194,176,227,102,45,10,220,147,95,154,45,252,241,228,250,226,232,248,228,95,111,100,131,172,126,212,206,22,144,9,255,69,182,30,166,246,104,250,242,46,29,83,99,216,31,51,106,53,164,50,236,113,205,205,129,183,9,229,209,159,26,98,224,177,7,252,165,32,31,27,171,176,230,156,246,201,183,154,188,243,30,205,200,0,156,226,124,228,169,88,181,75,98,125,195,134,200,130,92,168,163,232,231,91,173,201,13,100,22,76,86,231,208,84,181,109,224,167,205,66,159,107,168,228,22,228,29,198,186,15,255,4,132,232,118,221,55,194,233,85,80,158,104,128,61,108,166,122,183,221,122,223,16,36,193,128,125,191,1,136,191,3,157,149,50,223,208,230,62,193,175,201,5,121,223,16,36,175,130,250,129,136,51,138,26,193,145,173,100,25,81,167,116,163,167,18,150,25,200,248,144,138,237,149,31,125,37,230,235,24,236,197,240,150,224,134,14,207,136,113,162,240,11,153,139,240,24,254,188,139,38,95,195,79,240,240,65,72,32,39,211,240,35,185,7,25,95,195,15,36,81,154,133,239,203,243,170,211,194,57,158,121,250,159,226,9,127,121,112,253,19,176,181,11,167,215,116,131,175,247,240,22,110,244,119,34,76,88,13,172,166,211,110,248,228,216,126,221,233,85,80,106,7,230,193,86,209,159,190,94,46,177,246,13,18,66,162,72,81,86,77,179,134,177,220,97,246,240,102,65,154,100,236,52,122,94,66,81,103,29,181,195,165,90,26,34,220,249,32,170,191,52,154,35,44,157,241,58,192,227,204,20,17,23,242,30,198,195,167,70,8,177,43,29,207,86,96,245,231,13,155,187,73,147,186,22,135,162,123,99,79,155,165,249,63,104,127,196,195,190,223,195,111,45,184,154,203,191,12,109,170,145,163,67,103,81,136,171,27,217,15,242,171,146,207,176,6,250,195,20,177,66,155,223,194,22,45,73,21,126,75,2,70,142,62,209,9,53,183,250,89,28,8,8,214,93,52,6,90,181,12,42,63,5,102,180,12,42,207,172,83,14,109,127,13,72,173,155,205,212,231,140,125,110,147,145,25,4,137,253,207,125,47,97,34,159,145,137,124,126,1,19,249,92,1,241,207,46,19,129,252,116,163,191,202,156,236,235,15,218,195,166,121,192,124,132,72,10,191,220,249,176,49,28,160,195,232,189,34,196,149,120,108,217,190,48,223,178,246,190,162,249,158,128,244,96,238,70,97,211,27,88,182,61,60,94,181,48,186,29,121,234,243,215,30,181,185,240,47,254,27,212,70,252,20,106,243,217,165,54,103,1,120,78,118,110,182,245,222,132,184,223,76,118,190,211,45,243,159,167,63,23,72,127,62,90,250,131,171,117,9,171,245,213,31,126,133,165,186,236,118,231,222,165,238,114,171,150,233,140,222,237,13,113,235,143,107,192,188,12,255,16,85,30,188,89,19,87,218,65,156,248,45,64,187,130,33,75,242,16,142,55,31,139,204,207,231,239,226,121,169,14,115,155,241,60,223,247,26,137,142,136,58,115,60,122,1,107,224,125,8,244,177,216,223,128,31,145,39,132,232,250,226,209,119,236,238,168,134,217,251,172,140,186,145,229,70,17,114,163,137,230,70,28,45,59,113,32,60,171,188,72,90,8,255,232,105,172,254,169,217,114,37,9,250,139,25,15,156,12,77,55,7,211,85,182,139,95,98,183,97,100,121,206,25,196,78,8,28,135,13,84,212,25,137,203,97,206,27,136,202,71,205,97,190,53,86,13,20,5,232,187,12,0,228,189,179,28,230,221,232,123,20,230,68,115,147,119,47,96,28,216,24,17,61,68,160,211,63,159,112,188,7,194,241,1,145,227,251,3,132,227,61,168,172,148,249,224,18,142,223,127,140,112,124,216,33,28,31,28,194,241,249,165,132,227,214,37,28,95,52,225,56,46,9,7,82,12,224,22,134,112,156,59,132,227,155,33,28,167,150,112,252,94,18,142,207,46,225,88,254,255,135,137,255,19,31,38,6,190,190,104,245,70,147,167,95,157,235,161,7,190,128,171,51,222,101,204,61,253,16,61,170,40,171,190,103,39,63,17,31,43,42,209,116,114,207,20,197,128,24,28,37,39,28,188,145,165,117,52,123,215,121,221,25,27,4,107,218,169,44,4,243,115,80,108,31,240,107,82,59,226,159,86,213,201,232,183,48,1,166,168,162,175,3,13,215,59,208,240,8,161,225,145,133,134,71,128,92,149,62,118,231,46,246,32,226,81,5,104,142,42,136,184,106,8,179,47,57,73,159,106,242,228,229,164,79,68,117,93,20,56,146,128,117,89,53,92,42,105,186,6,135,156,227,96,46,68,112,29,62,223,68,217,112,187,197,150,224,96,75,26,57,249,10,240,188,227,69,204,158,19,186,40,166,73,50,195,113,201,145,147,128,23,7,18,176,32,252,96,2,62,210,89,20,63,162,244,6,224,14,213,250,24,172,1,144,219,122,37,27,197,65,186,82,197,224,57,214,150,12,111,40,197,26,130,64,246,94,151,217,85,56,217,149,168,81,192,225,140,116,117,166,136,249,246,186,121,238,117,28,242,115,167,15,241,205,43,167,121,103,12,48,166,242,128,234,5,46,89,237,75,78,102,195,208,204,51,189,123,25,120,215,174,107,163,151,9,77,2,96,26,213,136,108,252,114,85,71,207,155,19,184,193,218,83,234,93,53,108,143,123,13,80,30,27,171,6,123,31,128,106,14,209,203,202,83,9,96,248,221,46,127,187,59,189,157,207,63,255,20,216,176,99,45,106,136,163,112,185,96,149,159,22,251,168,1,41,153,197,4,243,231,49,193,252,238,105,108,204,247,84,122,227,220,5,10,75,13,20,30,74,160,112,141,64,225,222,2,133,43,7,40,60,146,73,196,79,69,120,97,0,195,141,5,12,39,37,96,56,114,1,67,242,236,5,50,227,84,223,191,134,143,183,254,234,114,108,14,132,109,12,117,12,182,178,164,246,114,252,80,188,149,67,214,163,3,34,224,143,159,225,13,59,76,124,67,72,146,2,54,81,209,120,125,112,119,37,223,210,193,118,91,6,255,106,241,6,99,60,176,114,223,113,104,117,241,20,66,69,230,225,77,242,237,246,14,108,142,247,40,249,110,105,132,109,25,222,2,156,96,61,67,22,147,211,104,187,157,40,170,175,235,70,49,149,161,52,138,232,27,182,168,56,136,140,113,35,193,202,34,247,36,109,27,147,252,210,110,67,253,21,196,92,115,70,14,102,155,168,105,206,104,124,87,6,178,193,120,152,210,78,128,182,158,109,183,157,160,124,82,191,154,62,165,128,107,75,192,145,0,190,159,82,219,127,56,133,141,50,156,190,122,165,69,47,64,244,116,60,212,242,22,234,38,231,212,15,141,212,197,200,211,5,36,1,80,19,38,72,171,205,59,244,47,240,232,34,247,113,152,33,188,15,19,63,14,114,158,46,226,25,24,46,192,123,58,237,220,168,21,195,230,217,110,99,181,161,152,135,191,96,86,167,117,71,179,165,53,104,249,69,0,28,113,239,245,227,191,187,169,123,204,107,155,45,245,157,178,117,143,98,51,178,118,239,224,200,31,186,250,104,216,228,255,26,208,90,109,183,22,222,225,213,255,93,135,199,181,194,184,90,91,57,23,158,17,81,10,168,86,63,148,149,3,172,84,215,93,131,56,213,215,94,185,61,90,106,123,237,122,141,128,21,180,188,6,201,175,117,88,220,60,108,205,228,83,5,89,106,119,46,81,47,216,218,126,97,79,103,154,110,156,242,145,83,26,170,221,22,55,54,20,59,13,133,58,122,195,127,137,137,107,179,170,254,165,145,74,237,248,17,229,193,58,74,114,6,204,92,125,115,168,222,176,3,210,113,176,208,164,93,217,7,116,199,91,114,74,237,220,126,92,1,188,148,162,122,105,173,64,148,222,155,91,68,73,105,90,70,134,124,215,66,53,251,128,117,172,137,10,59,7,55,58,139,66,89,239,191,0,255,82,202,232,45,58,0,0,0};
+static const unsigned char v2[] = {118,97,114,32,110,44,116,44,101,44,95,44,114,44,111,44,117,44,105,44,108,44,99,44,97,44,102,44,115,44,112,61,123,125,44,104,61,91,93,44,100,61,47,97,99,105,116,124,101,120,40,63,58,115,124,103,124,110,124,112,124,36,41,124,114,112,104,124,103,114,105,100,124,111,119,115,124,109,110,99,124,110,116,119,124,105,110,101,91,99,104,93,124,122,111,111,124,94,111,114,100,124,105,116,101,114,97,47,105,44,118,61,65,114,114,97,121,46,105,115,65,114,114,97,121,59,102,117,110,99,116,105,111,110,32,109,40,110,44,116,41,123,102,111,114,40,118,97,114,32,101,32,105,110,32,116,41,110,91,101,93,61,116,91,101,93,59,114,101,116,117,114,110,32,110,125,102,117,110,99,116,105,111,110,32,121,40,110,41,123,110,38,38,110,46,112,97,114,101,110,116,78,111,100,101,38,38,110,46,112,97,114,101,110,116,78,111,100,101,46,114,101,109,111,118,101,67,104,105,108,100,40,110,41,125,102,117,110,99,116,105,111,110,32,103,40,116,44,101,44,95,41,123,118,97,114,32,114,44,111,44,117,44,105,61,123,125,59,102,111,114,40,117,32,105,110,32,101,41,34,107,101,121,34,61,61,117,63,114,61,101,91,117,93,58,34,114,101,102,34,61,61,117,63,111,61,101,91,117,93,58,105,91,117,93,61,101,91,117,93,59,105,102,40,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,50,38,38,40,105,46,99,104,105,108,100,114,101,110,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,51,63,110,46,99,97,108,108,40,97,114,103,117,109,101,110,116,115,44,50,41,58,95,41,44,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,116,38,38,110,117,108,108,33,61,116,46,100,101,102,97,117,108,116,80,114,111,112,115,41,102,111,114,40,117,32,105,110,32,116,46,100,101,102,97,117,108,116,80,114,111,112,115,41,118,111,105,100,32,48,61,61,61,105,91,117,93,38,38,40,105,91,117,93,61,116,46,100,101,102,97,117,108,116,80,114,111,112,115,91,117,93,41,59,114,101,116,117,114,110,32,98,40,116,44,105,44,114,44,111,44,110,117,108,108,41,125,102,117,110,99,116,105,111,110,32,98,40,110,44,95,44,114,44,111,44,117,41,123,118,97,114,32,105,61,123,116,121,112,101,58,110,44,112,114,111,112,115,58,95,44,107,101,121,58,114,44,114,101,102,58,111,44,95,95,107,58,110,117,108,108,44,95,95,58,110,117,108,108,44,95,95,98,58,48,44,95,95,101,58,110,117,108,108,44,95,95,99,58,110,117,108,108,44,99,111,110,115,116,114,117,99,116,111,114,58,118,111,105,100,32,48,44,95,95,118,58,110,117,108,108,61,61,117,63,43,43,101,58,117,44,95,95,105,58,45,49,44,95,95,117,58,48,125,59,114,101,116,117,114,110,32,110,117,108,108,61,61,117,38,38,110,117,108,108,33,61,116,46,118,110,111,100,101,38,38,116,46,118,110,111,100,101,40,105,41,44,105,125,102,117,110,99,116,105,111,110,32,107,40,41,123,114,101,116,117,114,110,123,99,117,114,114,101,110,116,58,110,117,108,108,125,125,102,117,110,99,116,105,111,110,32,67,40,110,41,123,114,101,116,117,114,110,32,110,46,99,104,105,108,100,114,101,110,125,102,117,110,99,116,105,111,110,32,120,40,110,44,116,41,123,116,104,105,115,46,112,114,111,112,115,61,110,44,116,104,105,115,46,99,111,110,116,101,120,116,61,116,125,102,117,110,99,116,105,111,110,32,119,40,110,44,116,41,123,105,102,40,110,117,108,108,61,61,116,41,114,101,116,117,114,110,32,110,46,95,95,63,119,40,110,46,95,95,44,110,46,95,95,105,43,49,41,58,110,117,108,108,59,102,111,114,40,118,97,114,32,101,59,116,60,110,46,95,95,107,46,108,101,110,103,116,104,59,116,43,43,41,105,102,40,110,117,108,108,33,61,40,101,61,110,46,95,95,107,91,116,93,41,38,38,110,117,108,108,33,61,101,46,95,95,101,41,114,101,116,117,114,110,32,101,46,95,95,101,59,114,101,116,117,114,110,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,46,116,121,112,101,63,119,40,110,41,58,110,117,108,108,125,102,117,110,99,116,105,111,110,32,85,40,110,41,123,118,97,114,32,116,44,101,59,105,102,40,110,117,108,108,33,61,40,110,61,110,46,95,95,41,38,38,110,117,108,108,33,61,110,46,95,95,99,41,123,102,111,114,40,110,46,95,95,101,61,110,46,95,95,99,46,98,97,115,101,61,110,117,108,108,44,116,61,48,59,116,60,110,46,95,95,107,46,108,101,110,103,116,104,59,116,43,43,41,105,102,40,110,117,108,108,33,61,40,101,61,110,46,95,95,107,91,116,93,41,38,38,110,117,108,108,33,61,101,46,95,95,101,41,123,110,46,95,95,101,61,110,46,95,95,99,46,98,97,115,101,61,101,46,95,95,101,59,98,114,101,97,107,125,114,101,116,117,114,110,32,85,40,110,41,125,125,102,117,110,99,116,105,111,110,32,72,40,110,41,123,40,33,110,46,95,95,100,38,38,40,110,46,95,95,100,61,33,48,41,38,38,114,46,112,117,115,104,40,110,41,38,38,33,80,46,95,95,114,43,43,124,124,111,33,61,116,46,100,101,98,111,117,110,99,101,82,101,110,100,101,114,105,110,103,41,38,38,40,40,111,61,116,46,100,101,98,111,117,110,99,101,82,101,110,100,101,114,105,110,103,41,124,124,117,41,40,80,41,125,102,117,110,99,116,105,111,110,32,80,40,41,123,102,111,114,40,118,97,114,32,110,44,101,44,95,44,111,44,117,44,108,44,99,44,97,61,49,59,114,46,108,101,110,103,116,104,59,41,114,46,108,101,110,103,116,104,62,97,38,38,114,46,115,111,114,116,40,105,41,44,110,61,114,46,115,104,105,102,116,40,41,44,97,61,114,46,108,101,110,103,116,104,44,110,46,95,95,100,38,38,40,95,61,118,111,105,100,32,48,44,111,61,118,111,105,100,32,48,44,117,61,40,111,61,40,101,61,110,41,46,95,95,118,41,46,95,95,101,44,108,61,91,93,44,99,61,91,93,44,101,46,95,95,80,38,38,40,40,95,61,109,40,123,125,44,111,41,41,46,95,95,118,61,111,46,95,95,118,43,49,44,116,46,118,110,111,100,101,38,38,116,46,118,110,111,100,101,40,95,41,44,87,40,101,46,95,95,80,44,95,44,111,44,101,46,95,95,110,44,101,46,95,95,80,46,110,97,109,101,115,112,97,99,101,85,82,73,44,51,50,38,111,46,95,95,117,63,91,117,93,58,110,117,108,108,44,108,44,110,117,108,108,61,61,117,63,119,40,111,41,58,117,44,33,33,40,51,50,38,111,46,95,95,117,41,44,99,41,44,95,46,95,95,118,61,111,46,95,95,118,44,95,46,95,95,46,95,95,107,91,95,46,95,95,105,93,61,95,44,70,40,108,44,95,44,99,41,44,111,46,95,95,101,61,111,46,95,95,61,110,117,108,108,44,95,46,95,95,101,33,61,117,38,38,85,40,95,41,41,41,59,80,46,95,95,114,61,48,125,102,117,110,99,116,105,111,110,32,69,40,110,44,116,44,101,44,95,44,114,44,111,44,117,44,105,44,108,44,99,44,97,41,123,118,97,114,32,102,44,115,44,100,44,118,44,109,44,121,44,103,44,98,61,95,38,38,95,46,95,95,107,124,124,104,44,107,61,116,46,108,101,110,103,116,104,59,102,111,114,40,108,61,83,40,101,44,116,44,98,44,108,44,107,41,44,102,61,48,59,102,60,107,59,102,43,43,41,110,117,108,108,33,61,40,100,61,101,46,95,95,107,91,102,93,41,38,38,40,115,61,45,49,61,61,100,46,95,95,105,63,112,58,98,91,100,46,95,95,105,93,124,124,112,44,100,46,95,95,105,61,102,44,121,61,87,40,110,44,100,44,115,44,114,44,111,44,117,44,105,44,108,44,99,44,97,41,44,118,61,100,46,95,95,101,44,100,46,114,101,102,38,38,115,46,114,101,102,33,61,100,46,114,101,102,38,38,40,115,46,114,101,102,38,38,79,40,115,46,114,101,102,44,110,117,108,108,44,100,41,44,97,46,112,117,115,104,40,100,46,114,101,102,44,100,46,95,95,99,124,124,118,44,100,41,41,44,110,117,108,108,61,61,109,38,38,110,117,108,108,33,61,118,38,38,40,109,61,118,41,44,40,103,61,33,33,40,52,38,100,46,95,95,117,41,41,124,124,115,46,95,95,107,61,61,61,100,46,95,95,107,63,108,61,65,40,100,44,108,44,110,44,103,41,58,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,100,46,116,121,112,101,38,38,118,111,105,100,32,48,33,61,61,121,63,108,61,121,58,118,38,38,40,108,61,118,46,110,101,120,116,83,105,98,108,105,110,103,41,44,100,46,95,95,117,38,61,45,55,41,59,114,101,116,117,114,110,32,101,46,95,95,101,61,109,44,108,125,102,117,110,99,116,105,111,110,32,83,40,110,44,116,44,101,44,95,44,114,41,123,118,97,114,32,111,44,117,44,105,44,108,44,99,44,97,61,101,46,108,101,110,103,116,104,44,102,61,97,44,115,61,48,59,102,111,114,40,110,46,95,95,107,61,110,101,119,32,65,114,114,97,121,40,114,41,44,111,61,48,59,111,60,114,59,111,43,43,41,110,117,108,108,33,61,40,117,61,116,91,111,93,41,38,38,34,98,111,111,108,101,97,110,34,33,61,116,121,112,101,111,102,32,117,38,38,34,102,117,110,99,116,105,111,110,34,33,61,116,121,112,101,111,102,32,117,63,40,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,117,124,124,34,110,117,109,98,101,114,34,61,61,116,121,112,101,111,102,32,117,124,124,34,98,105,103,105,110,116,34,61,61,116,121,112,101,111,102,32,117,124,124,117,46,99,111,110,115,116,114,117,99,116,111,114,61,61,83,116,114,105,110,103,63,117,61,110,46,95,95,107,91,111,93,61,98,40,110,117,108,108,44,117,44,110,117,108,108,44,110,117,108,108,44,110,117,108,108,41,58,118,40,117,41,63,117,61,110,46,95,95,107,91,111,93,61,98,40,67,44,123,99,104,105,108,100,114,101,110,58,117,125,44,110,117,108,108,44,110,117,108,108,44,110,117,108,108,41,58,110,117,108,108,61,61,117,46,99,111,110,115,116,114,117,99,116,111,114,38,38,117,46,95,95,98,62,48,63,117,61,110,46,95,95,107,91,111,93,61,98,40,117,46,116,121,112,101,44,117,46,112,114,111,112,115,44,117,46,107,101,121,44,117,46,114,101,102,63,117,46,114,101,102,58,110,117,108,108,44,117,46,95,95,118,41,58,110,46,95,95,107,91,111,93,61,117,44,108,61,111,43,115,44,117,46,95,95,61,110,44,117,46,95,95,98,61,110,46,95,95,98,43,49,44,45,49,33,61,40,99,61,117,46,95,95,105,61,68,40,117,44,101,44,108,44,102,41,41,38,38,40,102,45,45,44,40,105,61,101,91,99,93,41,38,38,40,105,46,95,95,117,124,61,50,41,41,44,110,117,108,108,61,61,105,124,124,110,117,108,108,61,61,105,46,95,95,118,63,40,45,49,61,61,99,38,38,40,114,62,97,63,115,45,45,58,114,60,97,38,38,115,43,43,41,44,34,102,117,110,99,116,105,111,110,34,33,61,116,121,112,101,111,102,32,117,46,116,121,112,101,38,38,40,117,46,95,95,117,124,61,52,41,41,58,99,33,61,108,38,38,40,99,61,61,108,45,49,63,115,45,45,58,99,61,61,108,43,49,63,115,43,43,58,40,99,62,108,63,115,45,45,58,115,43,43,44,117,46,95,95,117,124,61,52,41,41,41,58,110,46,95,95,107,91,111,93,61,110,117,108,108,59,105,102,40,102,41,102,111,114,40,111,61,48,59,111,60,97,59,111,43,43,41,110,117,108,108,33,61,40,105,61,101,91,111,93,41,38,38,48,61,61,40,50,38,105,46,95,95,117,41,38,38,40,105,46,95,95,101,61,61,95,38,38,40,95,61,119,40,105,41,41,44,106,40,105,44,105,41,41,59,114,101,116,117,114,110,32,95,125,102,117,110,99,116,105,111,110,32,65,40,110,44,116,44,101,44,95,41,123,118,97,114,32,114,44,111,59,105,102,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,46,116,121,112,101,41,123,102,111,114,40,114,61,110,46,95,95,107,44,111,61,48,59,114,38,38,111,60,114,46,108,101,110,103,116,104,59,111,43,43,41,114,91,111,93,38,38,40,114,91,111,93,46,95,95,61,110,44,116,61,65,40,114,91,111,93,44,116,44,101,44,95,41,41,59,114,101,116,117,114,110,32,116,125,110,46,95,95,101,33,61,116,38,38,40,95,38,38,40,116,38,38,110,46,116,121,112,101,38,38,33,116,46,112,97,114,101,110,116,78,111,100,101,38,38,40,116,61,119,40,110,41,41,44,101,46,105,110,115,101,114,116,66,101,102,111,114,101,40,110,46,95,95,101,44,116,124,124,110,117,108,108,41,41,44,116,61,110,46,95,95,101,41,59,100,111,123,116,61,116,38,38,116,46,110,101,120,116,83,105,98,108,105,110,103,125,119,104,105,108,101,40,110,117,108,108,33,61,116,38,38,56,61,61,116,46,110,111,100,101,84,121,112,101,41,59,114,101,116,117,114,110,32,116,125,102,117,110,99,116,105,111,110,32,78,40,110,44,116,41,123,114,101,116,117,114,110,32,116,61,116,124,124,91,93,44,110,117,108,108,61,61,110,124,124,34,98,111,111,108,101,97,110,34,61,61,116,121,112,101,111,102,32,110,124,124,40,118,40,110,41,63,110,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,110,41,123,78,40,110,44,116,41,125,41,41,58,116,46,112,117,115,104,40,110,41,41,44,116,125,102,117,110,99,116,105,111,110,32,68,40,110,44,116,44,101,44,95,41,123,118,97,114,32,114,44,111,44,117,44,105,61,110,46,107,101,121,44,108,61,110,46,116,121,112,101,44,99,61,116,91,101,93,44,97,61,110,117,108,108,33,61,99,38,38,48,61,61,40,50,38,99,46,95,95,117,41,59,105,102,40,110,117,108,108,61,61,61,99,38,38,110,117,108,108,61,61,105,124,124,97,38,38,105,61,61,99,46,107,101,121,38,38,108,61,61,99,46,116,121,112,101,41,114,101,116,117,114,110,32,101,59,105,102,40,95,62,40,97,63,49,58,48,41,41,102,111,114,40,114,61,101,45,49,44,111,61,101,43,49,59,114,62,61,48,124,124,111,60,116,46,108,101,110,103,116,104,59,41,105,102,40,110,117,108,108,33,61,40,99,61,116,91,117,61,114,62,61,48,63,114,45,45,58,111,43,43,93,41,38,38,48,61,61,40,50,38,99,46,95,95,117,41,38,38,105,61,61,99,46,107,101,121,38,38,108,61,61,99,46,116,121,112,101,41,114,101,116,117,114,110,32,117,59,114,101,116,117,114,110,45,49,125,102,117,110,99,116,105,111,110,32,84,40,110,44,116,44,101,41,123,34,45,34,61,61,116,91,48,93,63,110,46,115,101,116,80,114,111,112,101,114,116,121,40,116,44,110,117,108,108,61,61,101,63,34,34,58,101,41,58,110,91,116,93,61,110,117,108,108,61,61,101,63,34,34,58,34,110,117,109,98,101,114,34,33,61,116,121,112,101,111,102,32,101,124,124,100,46,116,101,115,116,40,116,41,63,101,58,101,43,34,112,120,34,125,102,117,110,99,116,105,111,110,32,82,40,110,44,116,44,101,44,95,44,114,41,123,118,97,114,32,111,44,117,59,110,58,105,102,40,34,115,116,121,108,101,34,61,61,116,41,105,102,40,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,101,41,110,46,115,116,121,108,101,46,99,115,115,84,101,120,116,61,101,59,101,108,115,101,123,105,102,40,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,95,38,38,40,110,46,115,116,121,108,101,46,99,115,115,84,101,120,116,61,95,61,34,34,41,44,95,41,102,111,114,40,116,32,105,110,32,95,41,101,38,38,116,32,105,110,32,101,124,124,84,40,110,46,115,116,121,108,101,44,116,44,34,34,41,59,105,102,40,101,41,102,111,114,40,116,32,105,110,32,101,41,95,38,38,101,91,116,93,61,61,95,91,116,93,124,124,84,40,110,46,115,116,121,108,101,44,116,44,101,91,116,93,41,125,101,108,115,101,32,105,102,40,34,111,34,61,61,116,91,48,93,38,38,34,110,34,61,61,116,91,49,93,41,111,61,116,33,61,40,116,61,116,46,114,101,112,108,97,99,101,40,108,44,34,36,49,34,41,41,44,117,61,116,46,116,111,76,111,119,101,114,67,97,115,101,40,41,44,116,61,117,32,105,110,32,110,124,124,34,111,110,70,111,99,117,115,79,117,116,34,61,61,116,124,124,34,111,110,70,111,99,117,115,73,110,34,61,61,116,63,117,46,115,108,105,99,101,40,50,41,58,116,46,115,108,105,99,101,40,50,41,44,110,46,108,124,124,40,110,46,108,61,123,125,41,44,110,46,108,91,116,43,111,93,61,101,44,101,63,95,63,101,46,117,61,95,46,117,58,40,101,46,117,61,99,44,110,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,116,44,111,63,102,58,97,44,111,41,41,58,110,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,40,116,44,111,63,102,58,97,44,111,41,59,101,108,115,101,123,105,102,40,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,61,61,114,41,116,61,116,46,114,101,112,108,97,99,101,40,47,120,108,105,110,107,40,72,124,58,104,41,47,44,34,104,34,41,46,114,101,112,108,97,99,101,40,47,115,78,97,109,101,36,47,44,34,115,34,41,59,101,108,115,101,32,105,102,40,34,119,105,100,116,104,34,33,61,116,38,38,34,104,101,105,103,104,116,34,33,61,116,38,38,34,104,114,101,102,34,33,61,116,38,38,34,108,105,115,116,34,33,61,116,38,38,34,102,111,114,109,34,33,61,116,38,38,34,116,97,98,73,110,100,101,120,34,33,61,116,38,38,34,100,111,119,110,108,111,97,100,34,33,61,116,38,38,34,114,111,119,83,112,97,110,34,33,61,116,38,38,34,99,111,108,83,112,97,110,34,33,61,116,38,38,34,114,111,108,101,34,33,61,116,38,38,34,112,111,112,111,118,101,114,34,33,61,116,38,38,116,32,105,110,32,110,41,116,114,121,123,110,91,116,93,61,110,117,108,108,61,61,101,63,34,34,58,101,59,98,114,101,97,107,32,110,125,99,97,116,99,104,40,110,41,123,125,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,101,124,124,40,110,117,108,108,61,61,101,124,124,33,49,61,61,61,101,38,38,34,45,34,33,61,116,91,52,93,63,110,46,114,101,109,111,118,101,65,116,116,114,105,98,117,116,101,40,116,41,58,110,46,115,101,116,65,116,116,114,105,98,117,116,101,40,116,44,34,112,111,112,111,118,101,114,34,61,61,116,38,38,49,61,61,101,63,34,34,58,101,41,41,125,125,102,117,110,99,116,105,111,110,32,77,40,110,41,123,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,101,41,123,105,102,40,116,104,105,115,46,108,41,123,118,97,114,32,95,61,116,104,105,115,46,108,91,101,46,116,121,112,101,43,110,93,59,105,102,40,110,117,108,108,61,61,101,46,116,41,101,46,116,61,99,43,43,59,101,108,115,101,32,105,102,40,101,46,116,60,95,46,117,41,114,101,116,117,114,110,59,114,101,116,117,114,110,32,95,40,116,46,101,118,101,110,116,63,116,46,101,118,101,110,116,40,101,41,58,101,41,125,125,125,102,117,110,99,116,105,111,110,32,87,40,110,44,101,44,95,44,114,44,111,44,117,44,105,44,108,44,99,44,97,41,123,118,97,114,32,102,44,115,44,112,44,104,44,100,44,103,44,98,44,107,44,119,44,85,44,72,44,80,44,83,44,65,44,78,44,68,44,84,44,82,61,101,46,116,121,112,101,59,105,102,40,110,117,108,108,33,61,101,46,99,111,110,115,116,114,117,99,116,111,114,41,114,101,116,117,114,110,32,110,117,108,108,59,49,50,56,38,95,46,95,95,117,38,38,40,99,61,33,33,40,51,50,38,95,46,95,95,117,41,44,117,61,91,108,61,101,46,95,95,101,61,95,46,95,95,101,93,41,44,40,102,61,116,46,95,95,98,41,38,38,102,40,101,41,59,110,58,105,102,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,82,41,116,114,121,123,105,102,40,107,61,101,46,112,114,111,112,115,44,119,61,34,112,114,111,116,111,116,121,112,101,34,105,110,32,82,38,38,82,46,112,114,111,116,111,116,121,112,101,46,114,101,110,100,101,114,44,85,61,40,102,61,82,46,99,111,110,116,101,120,116,84,121,112,101,41,38,38,114,91,102,46,95,95,99,93,44,72,61,102,63,85,63,85,46,112,114,111,112,115,46,118,97,108,117,101,58,102,46,95,95,58,114,44,95,46,95,95,99,63,98,61,40,115,61,101,46,95,95,99,61,95,46,95,95,99,41,46,95,95,61,115,46,95,95,69,58,40,119,63,101,46,95,95,99,61,115,61,110,101,119,32,82,40,107,44,72,41,58,40,101,46,95,95,99,61,115,61,110,101,119,32,120,40,107,44,72,41,44,115,46,99,111,110,115,116,114,117,99,116,111,114,61,82,44,115,46,114,101,110,100,101,114,61,86,41,44,85,38,38,85,46,115,117,98,40,115,41,44,115,46,115,116,97,116,101,124,124,40,115,46,115,116,97,116,101,61,123,125,41,44,115,46,95,95,110,61,114,44,112,61,115,46,95,95,100,61,33,48,44,115,46,95,95,104,61,91,93,44,115,46,95,115,98,61,91,93,41,44,119,38,38,110,117,108,108,61,61,115,46,95,95,115,38,38,40,115,46,95,95,115,61,115,46,115,116,97,116,101,41,44,119,38,38,110,117,108,108,33,61,82,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,80,114,111,112,115,38,38,40,115,46,95,95,115,61,61,115,46,115,116,97,116,101,38,38,40,115,46,95,95,115,61,109,40,123,125,44,115,46,95,95,115,41,41,44,109,40,115,46,95,95,115,44,82,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,80,114,111,112,115,40,107,44,115,46,95,95,115,41,41,41,44,104,61,115,46,112,114,111,112,115,44,100,61,115,46,115,116,97,116,101,44,115,46,95,95,118,61,101,44,112,41,119,38,38,110,117,108,108,61,61,82,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,80,114,111,112,115,38,38,110,117,108,108,33,61,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,77,111,117,110,116,38,38,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,77,111,117,110,116,40,41,44,119,38,38,110,117,108,108,33,61,115,46,99,111,109,112,111,110,101,110,116,68,105,100,77,111,117,110,116,38,38,115,46,95,95,104,46,112,117,115,104,40,115,46,99,111,109,112,111,110,101,110,116,68,105,100,77,111,117,110,116,41,59,101,108,115,101,123,105,102,40,119,38,38,110,117,108,108,61,61,82,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,80,114,111,112,115,38,38,107,33,61,61,104,38,38,110,117,108,108,33,61,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,82,101,99,101,105,118,101,80,114,111,112,115,38,38,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,82,101,99,101,105,118,101,80,114,111,112,115,40,107,44,72,41,44,101,46,95,95,118,61,61,95,46,95,95,118,124,124,33,115,46,95,95,101,38,38,110,117,108,108,33,61,115,46,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,38,38,33,49,61,61,61,115,46,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,40,107,44,115,46,95,95,115,44,72,41,41,123,102,111,114,40,101,46,95,95,118,33,61,95,46,95,95,118,38,38,40,115,46,112,114,111,112,115,61,107,44,115,46,115,116,97,116,101,61,115,46,95,95,115,44,115,46,95,95,100,61,33,49,41,44,101,46,95,95,101,61,95,46,95,95,101,44,101,46,95,95,107,61,95,46,95,95,107,44,101,46,95,95,107,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,38,38,40,110,46,95,95,61,101,41,125,41,41,44,80,61,48,59,80,60,115,46,95,115,98,46,108,101,110,103,116,104,59,80,43,43,41,115,46,95,95,104,46,112,117,115,104,40,115,46,95,115,98,91,80,93,41,59,115,46,95,115,98,61,91,93,44,115,46,95,95,104,46,108,101,110,103,116,104,38,38,105,46,112,117,115,104,40,115,41,59,98,114,101,97,107,32,110,125,110,117,108,108,33,61,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,112,100,97,116,101,38,38,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,112,100,97,116,101,40,107,44,115,46,95,95,115,44,72,41,44,119,38,38,110,117,108,108,33,61,115,46,99,111,109,112,111,110,101,110,116,68,105,100,85,112,100,97,116,101,38,38,115,46,95,95,104,46,112,117,115,104,40,40,102,117,110,99,116,105,111,110,40,41,123,115,46,99,111,109,112,111,110,101,110,116,68,105,100,85,112,100,97,116,101,40,104,44,100,44,103,41,125,41,41,125,105,102,40,115,46,99,111,110,116,101,120,116,61,72,44,115,46,112,114,111,112,115,61,107,44,115,46,95,95,80,61,110,44,115,46,95,95,101,61,33,49,44,83,61,116,46,95,95,114,44,65,61,48,44,119,41,123,102,111,114,40,115,46,115,116,97,116,101,61,115,46,95,95,115,44,115,46,95,95,100,61,33,49,44,83,38,38,83,40,101,41,44,102,61,115,46,114,101,110,100,101,114,40,115,46,112,114,111,112,115,44,115,46,115,116,97,116,101,44,115,46,99,111,110,116,101,120,116,41,44,78,61,48,59,78,60,115,46,95,115,98,46,108,101,110,103,116,104,59,78,43,43,41,115,46,95,95,104,46,112,117,115,104,40,115,46,95,115,98,91,78,93,41,59,115,46,95,115,98,61,91,93,125,101,108,115,101,32,100,111,123,115,46,95,95,100,61,33,49,44,83,38,38,83,40,101,41,44,102,61,115,46,114,101,110,100,101,114,40,115,46,112,114,111,112,115,44,115,46,115,116,97,116,101,44,115,46,99,111,110,116,101,120,116,41,44,115,46,115,116,97,116,101,61,115,46,95,95,115,125,119,104,105,108,101,40,115,46,95,95,100,38,38,43,43,65,60,50,53,41,59,115,46,115,116,97,116,101,61,115,46,95,95,115,44,110,117,108,108,33,61,115,46,103,101,116,67,104,105,108,100,67,111,110,116,101,120,116,38,38,40,114,61,109,40,109,40,123,125,44,114,41,44,115,46,103,101,116,67,104,105,108,100,67,111,110,116,101,120,116,40,41,41,41,44,119,38,38,33,112,38,38,110,117,108,108,33,61,115,46,103,101,116,83,110,97,112,115,104,111,116,66,101,102,111,114,101,85,112,100,97,116,101,38,38,40,103,61,115,46,103,101,116,83,110,97,112,115,104,111,116,66,101,102,111,114,101,85,112,100,97,116,101,40,104,44,100,41,41,44,68,61,102,44,110,117,108,108,33,61,102,38,38,102,46,116,121,112,101,61,61,61,67,38,38,110,117,108,108,61,61,102,46,107,101,121,38,38,40,68,61,73,40,102,46,112,114,111,112,115,46,99,104,105,108,100,114,101,110,41,41,44,108,61,69,40,110,44,118,40,68,41,63,68,58,91,68,93,44,101,44,95,44,114,44,111,44,117,44,105,44,108,44,99,44,97,41,44,115,46,98,97,115,101,61,101,46,95,95,101,44,101,46,95,95,117,38,61,45,49,54,49,44,115,46,95,95,104,46,108,101,110,103,116,104,38,38,105,46,112,117,115,104,40,115,41,44,98,38,38,40,115,46,95,95,69,61,115,46,95,95,61,110,117,108,108,41,125,99,97,116,99,104,40,110,41,123,105,102,40,101,46,95,95,118,61,110,117,108,108,44,99,124,124,110,117,108,108,33,61,117,41,105,102,40,110,46,116,104,101,110,41,123,102,111,114,40,101,46,95,95,117,124,61,99,63,49,54,48,58,49,50,56,59,108,38,38,56,61,61,108,46,110,111,100,101,84,121,112,101,38,38,108,46,110,101,120,116,83,105,98,108,105,110,103,59,41,108,61,108,46,110,101,120,116,83,105,98,108,105,110,103,59,117,91,117,46,105,110,100,101,120,79,102,40,108,41,93,61,110,117,108,108,44,101,46,95,95,101,61,108,125,101,108,115,101,123,102,111,114,40,84,61,117,46,108,101,110,103,116,104,59,84,45,45,59,41,121,40,117,91,84,93,41,59,76,40,101,41,125,101,108,115,101,32,101,46,95,95,101,61,95,46,95,95,101,44,101,46,95,95,107,61,95,46,95,95,107,44,110,46,116,104,101,110,124,124,76,40,101,41,59,116,46,95,95,101,40,110,44,101,44,95,41,125,101,108,115,101,32,110,117,108,108,61,61,117,38,38,101,46,95,95,118,61,61,95,46,95,95,118,63,40,101,46,95,95,107,61,95,46,95,95,107,44,101,46,95,95,101,61,95,46,95,95,101,41,58,108,61,101,46,95,95,101,61,36,40,95,46,95,95,101,44,101,44,95,44,114,44,111,44,117,44,105,44,99,44,97,41,59,114,101,116,117,114,110,40,102,61,116,46,100,105,102,102,101,100,41,38,38,102,40,101,41,44,49,50,56,38,101,46,95,95,117,63,118,111,105,100,32,48,58,108,125,102,117,110,99,116,105,111,110,32,76,40,110,41,123,110,38,38,110,46,95,95,99,38,38,40,110,46,95,95,99,46,95,95,101,61,33,48,41,44,110,38,38,110,46,95,95,107,38,38,110,46,95,95,107,46,102,111,114,69,97,99,104,40,76,41,125,102,117,110,99,116,105,111,110,32,70,40,110,44,101,44,95,41,123,102,111,114,40,118,97,114,32,114,61,48,59,114,60,95,46,108,101,110,103,116,104,59,114,43,43,41,79,40,95,91,114,93,44,95,91,43,43,114,93,44,95,91,43,43,114,93,41,59,116,46,95,95,99,38,38,116,46,95,95,99,40,101,44,110,41,44,110,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,101,41,123,116,114,121,123,110,61,101,46,95,95,104,44,101,46,95,95,104,61,91,93,44,110,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,46,99,97,108,108,40,101,41,125,41,41,125,99,97,116,99,104,40,110,41,123,116,46,95,95,101,40,110,44,101,46,95,95,118,41,125,125,41,41,125,102,117,110,99,116,105,111,110,32,73,40,110,41,123,114,101,116,117,114,110,34,111,98,106,101,99,116,34,33,61,116,121,112,101,111,102,32,110,124,124,110,117,108,108,61,61,110,124,124,110,46,95,95,98,38,38,110,46,95,95,98,62,48,63,110,58,118,40,110,41,63,110,46,109,97,112,40,73,41,58,109,40,123,125,44,110,41,125,102,117,110,99,116,105,111,110,32,36,40,101,44,95,44,114,44,111,44,117,44,105,44,108,44,99,44,97,41,123,118,97,114,32,102,44,115,44,104,44,100,44,109,44,103,44,98,44,107,61,114,46,112,114,111,112,115,124,124,112,44,67,61,95,46,112,114,111,112,115,44,120,61,95,46,116,121,112,101,59,105,102,40,34,115,118,103,34,61,61,120,63,117,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,58,34,109,97,116,104,34,61,61,120,63,117,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,49,57,57,56,47,77,97,116,104,47,77,97,116,104,77,76,34,58,117,124,124,40,117,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,49,57,57,57,47,120,104,116,109,108,34,41,44,110,117,108,108,33,61,105,41,102,111,114,40,102,61,48,59,102,60,105,46,108,101,110,103,116,104,59,102,43,43,41,105,102,40,40,109,61,105,91,102,93,41,38,38,34,115,101,116,65,116,116,114,105,98,117,116,101,34,105,110,32,109,61,61,33,33,120,38,38,40,120,63,109,46,108,111,99,97,108,78,97,109,101,61,61,120,58,51,61,61,109,46,110,111,100,101,84,121,112,101,41,41,123,101,61,109,44,105,91,102,93,61,110,117,108,108,59,98,114,101,97,107,125,105,102,40,110,117,108,108,61,61,101,41,123,105,102,40,110,117,108,108,61,61,120,41,114,101,116,117,114,110,32,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,84,101,120,116,78,111,100,101,40,67,41,59,101,61,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,78,83,40,117,44,120,44,67,46,105,115,38,38,67,41,44,99,38,38,40,116,46,95,95,109,38,38,116,46,95,95,109,40,95,44,105,41,44,99,61,33,49,41,44,105,61,110,117,108,108,125,105,102,40,110,117,108,108,61,61,120,41,107,61,61,61,67,124,124,99,38,38,101,46,100,97,116,97,61,61,67,124,124,40,101,46,100,97,116,97,61,67,41,59,101,108,115,101,123,105,102,40,105,61,105,38,38,110,46,99,97,108,108,40,101,46,99,104,105,108,100,78,111,100,101,115,41,44,33,99,38,38,110,117,108,108,33,61,105,41,102,111,114,40,107,61,123,125,44,102,61,48,59,102,60,101,46,97,116,116,114,105,98,117,116,101,115,46,108,101,110,103,116,104,59,102,43,43,41,107,91,40,109,61,101,46,97,116,116,114,105,98,117,116,101,115,91,102,93,41,46,110,97,109,101,93,61,109,46,118,97,108,117,101,59,102,111,114,40,102,32,105,110,32,107,41,105,102,40,109,61,107,91,102,93,44,34,99,104,105,108,100,114,101,110,34,61,61,102,41,59,101,108,115,101,32,105,102,40,34,100,97,110,103,101,114,111,117,115,108,121,83,101,116,73,110,110,101,114,72,84,77,76,34,61,61,102,41,104,61,109,59,101,108,115,101,32,105,102,40,33,40,102,32,105,110,32,67,41,41,123,105,102,40,34,118,97,108,117,101,34,61,61,102,38,38,34,100,101,102,97,117,108,116,86,97,108,117,101,34,105,110,32,67,124,124,34,99,104,101,99,107,101,100,34,61,61,102,38,38,34,100,101,102,97,117,108,116,67,104,101,99,107,101,100,34,105,110,32,67,41,99,111,110,116,105,110,117,101,59,82,40,101,44,102,44,110,117,108,108,44,109,44,117,41,125,102,111,114,40,102,32,105,110,32,67,41,109,61,67,91,102,93,44,34,99,104,105,108,100,114,101,110,34,61,61,102,63,100,61,109,58,34,100,97,110,103,101,114,111,117,115,108,121,83,101,116,73,110,110,101,114,72,84,77,76,34,61,61,102,63,115,61,109,58,34,118,97,108,117,101,34,61,61,102,63,103,61,109,58,34,99,104,101,99,107,101,100,34,61,61,102,63,98,61,109,58,99,38,38,34,102,117,110,99,116,105,111,110,34,33,61,116,121,112,101,111,102,32,109,124,124,107,91,102,93,61,61,61,109,124,124,82,40,101,44,102,44,109,44,107,91,102,93,44,117,41,59,105,102,40,115,41,99,124,124,104,38,38,40,115,46,95,95,104,116,109,108,61,61,104,46,95,95,104,116,109,108,124,124,115,46,95,95,104,116,109,108,61,61,101,46,105,110,110,101,114,72,84,77,76,41,124,124,40,101,46,105,110,110,101,114,72,84,77,76,61,115,46,95,95,104,116,109,108,41,44,95,46,95,95,107,61,91,93,59,101,108,115,101,32,105,102,40,104,38,38,40,101,46,105,110,110,101,114,72,84,77,76,61,34,34,41,44,69,40,34,116,101,109,112,108,97,116,101,34,61,61,95,46,116,121,112,101,63,101,46,99,111,110,116,101,110,116,58,101,44,118,40,100,41,63,100,58,91,100,93,44,95,44,114,44,111,44,34,102,111,114,101,105,103,110,79,98,106,101,99,116,34,61,61,120,63,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,49,57,57,57,47,120,104,116,109,108,34,58,117,44,105,44,108,44,105,63,105,91,48,93,58,114,46,95,95,107,38,38,119,40,114,44,48,41,44,99,44,97,41,44,110,117,108,108,33,61,105,41,102,111,114,40,102,61,105,46,108,101,110,103,116,104,59,102,45,45,59,41,121,40,105,91,102,93,41,59,99,124,124,40,102,61,34,118,97,108,117,101,34,44,34,112,114,111,103,114,101,115,115,34,61,61,120,38,38,110,117,108,108,61,61,103,63,101,46,114,101,109,111,118,101,65,116,116,114,105,98,117,116,101,40,34,118,97,108,117,101,34,41,58,110,117,108,108,33,61,103,38,38,40,103,33,61,61,101,91,102,93,124,124,34,112,114,111,103,114,101,115,115,34,61,61,120,38,38,33,103,124,124,34,111,112,116,105,111,110,34,61,61,120,38,38,103,33,61,107,91,102,93,41,38,38,82,40,101,44,102,44,103,44,107,91,102,93,44,117,41,44,102,61,34,99,104,101,99,107,101,100,34,44,110,117,108,108,33,61,98,38,38,98,33,61,101,91,102,93,38,38,82,40,101,44,102,44,98,44,107,91,102,93,44,117,41,41,125,114,101,116,117,114,110,32,101,125,102,117,110,99,116,105,111,110,32,79,40,110,44,101,44,95,41,123,116,114,121,123,105,102,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,41,123,118,97,114,32,114,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,46,95,95,117,59,114,38,38,110,46,95,95,117,40,41,44,114,38,38,110,117,108,108,61,61,101,124,124,40,110,46,95,95,117,61,110,40,101,41,41,125,101,108,115,101,32,110,46,99,117,114,114,101,110,116,61,101,125,99,97,116,99,104,40,110,41,123,116,46,95,95,101,40,110,44,95,41,125,125,102,117,110,99,116,105,111,110,32,106,40,110,44,101,44,95,41,123,118,97,114,32,114,44,111,59,105,102,40,116,46,117,110,109,111,117,110,116,38,38,116,46,117,110,109,111,117,110,116,40,110,41,44,40,114,61,110,46,114,101,102,41,38,38,40,114,46,99,117,114,114,101,110,116,38,38,114,46,99,117,114,114,101,110,116,33,61,110,46,95,95,101,124,124,79,40,114,44,110,117,108,108,44,101,41,41,44,110,117,108,108,33,61,40,114,61,110,46,95,95,99,41,41,123,105,102,40,114,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,41,116,114,121,123,114,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,40,41,125,99,97,116,99,104,40,110,41,123,116,46,95,95,101,40,110,44,101,41,125,114,46,98,97,115,101,61,114,46,95,95,80,61,110,117,108,108,125,105,102,40,114,61,110,46,95,95,107,41,102,111,114,40,111,61,48,59,111,60,114,46,108,101,110,103,116,104,59,111,43,43,41,114,91,111,93,38,38,106,40,114,91,111,93,44,101,44,95,124,124,34,102,117,110,99,116,105,111,110,34,33,61,116,121,112,101,111,102,32,110,46,116,121,112,101,41,59,95,124,124,121,40,110,46,95,95,101,41,44,110,46,95,95,99,61,110,46,95,95,61,110,46,95,95,101,61,118,111,105,100,32,48,125,102,117,110,99,116,105,111,110,32,86,40,110,44,116,44,101,41,123,114,101,116,117,114,110,32,116,104,105,115,46,99,111,110,115,116,114,117,99,116,111,114,40,110,44,101,41,125,102,117,110,99,116,105,111,110,32,113,40,101,44,95,44,114,41,123,118,97,114,32,111,44,117,44,105,44,108,59,95,61,61,100,111,99,117,109,101,110,116,38,38,40,95,61,100,111,99,117,109,101,110,116,46,100,111,99,117,109,101,110,116,69,108,101,109,101,110,116,41,44,116,46,95,95,38,38,116,46,95,95,40,101,44,95,41,44,117,61,40,111,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,114,41,63,110,117,108,108,58,114,38,38,114,46,95,95,107,124,124,95,46,95,95,107,44,105,61,91,93,44,108,61,91,93,44,87,40,95,44,101,61,40,33,111,38,38,114,124,124,95,41,46,95,95,107,61,103,40,67,44,110,117,108,108,44,91,101,93,41,44,117,124,124,112,44,112,44,95,46,110,97,109,101,115,112,97,99,101,85,82,73,44,33,111,38,38,114,63,91,114,93,58,117,63,110,117,108,108,58,95,46,102,105,114,115,116,67,104,105,108,100,63,110,46,99,97,108,108,40,95,46,99,104,105,108,100,78,111,100,101,115,41,58,110,117,108,108,44,105,44,33,111,38,38,114,63,114,58,117,63,117,46,95,95,101,58,95,46,102,105,114,115,116,67,104,105,108,100,44,111,44,108,41,44,70,40,105,44,101,44,108,41,125,102,117,110,99,116,105,111,110,32,66,40,110,44,116,41,123,113,40,110,44,116,44,66,41,125,102,117,110,99,116,105,111,110,32,75,40,116,44,101,44,95,41,123,118,97,114,32,114,44,111,44,117,44,105,44,108,61,109,40,123,125,44,116,46,112,114,111,112,115,41,59,102,111,114,40,117,32,105,110,32,116,46,116,121,112,101,38,38,116,46,116,121,112,101,46,100,101,102,97,117,108,116,80,114,111,112,115,38,38,40,105,61,116,46,116,121,112,101,46,100,101,102,97,117,108,116,80,114,111,112,115,41,44,101,41,34,107,101,121,34,61,61,117,63,114,61,101,91,117,93,58,34,114,101,102,34,61,61,117,63,111,61,101,91,117,93,58,108,91,117,93,61,118,111,105,100,32,48,61,61,61,101,91,117,93,38,38,110,117,108,108,33,61,105,63,105,91,117,93,58,101,91,117,93,59,114,101,116,117,114,110,32,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,50,38,38,40,108,46,99,104,105,108,100,114,101,110,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,51,63,110,46,99,97,108,108,40,97,114,103,117,109,101,110,116,115,44,50,41,58,95,41,44,98,40,116,46,116,121,112,101,44,108,44,114,124,124,116,46,107,101,121,44,111,124,124,116,46,114,101,102,44,110,117,108,108,41,125,102,117,110,99,116,105,111,110,32,122,40,110,41,123,102,117,110,99,116,105,111,110,32,116,40,110,41,123,118,97,114,32,101,44,95,59,114,101,116,117,114,110,32,116,104,105,115,46,103,101,116,67,104,105,108,100,67,111,110,116,101,120,116,124,124,40,101,61,110,101,119,32,83,101,116,44,40,95,61,123,125,41,91,116,46,95,95,99,93,61,116,104,105,115,44,116,104,105,115,46,103,101,116,67,104,105,108,100,67,111,110,116,101,120,116,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,95,125,44,116,104,105,115,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,61,102,117,110,99,116,105,111,110,40,41,123,101,61,110,117,108,108,125,44,116,104,105,115,46,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,61,102,117,110,99,116,105,111,110,40,110,41,123,116,104,105,115,46,112,114,111,112,115,46,118,97,108,117,101,33,61,110,46,118,97,108,117,101,38,38,101,46,102,111,114,69,97,99,104,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,46,95,95,101,61,33,48,44,72,40,110,41,125,41,41,125,44,116,104,105,115,46,115,117,98,61,102,117,110,99,116,105,111,110,40,110,41,123,101,46,97,100,100,40,110,41,59,118,97,114,32,116,61,110,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,59,110,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,61,102,117,110,99,116,105,111,110,40,41,123,101,38,38,101,46,100,101,108,101,116,101,40,110,41,44,116,38,38,116,46,99,97,108,108,40,110,41,125,125,41,44,110,46,99,104,105,108,100,114,101,110,125,114,101,116,117,114,110,32,116,46,95,95,99,61,34,95,95,99,67,34,43,115,43,43,44,116,46,95,95,61,110,44,116,46,80,114,111,118,105,100,101,114,61,116,46,95,95,108,61,40,116,46,67,111,110,115,117,109,101,114,61,102,117,110,99,116,105,111,110,40,110,44,116,41,123,114,101,116,117,114,110,32,110,46,99,104,105,108,100,114,101,110,40,116,41,125,41,46,99,111,110,116,101,120,116,84,121,112,101,61,116,44,116,125,110,61,104,46,115,108,105,99,101,44,116,61,123,95,95,101,58,102,117,110,99,116,105,111,110,40,110,44,116,44,101,44,95,41,123,102,111,114,40,118,97,114,32,114,44,111,44,117,59,116,61,116,46,95,95,59,41,105,102,40,40,114,61,116,46,95,95,99,41,38,38,33,114,46,95,95,41,116,114,121,123,105,102,40,40,111,61,114,46,99,111,110,115,116,114,117,99,116,111,114,41,38,38,110,117,108,108,33,61,111,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,69,114,114,111,114,38,38,40,114,46,115,101,116,83,116,97,116,101,40,111,46,103,101,116,68,101,114,105,118,101,100,83,116,97,116,101,70,114,111,109,69,114,114,111,114,40,110,41,41,44,117,61,114,46,95,95,100,41,44,110,117,108,108,33,61,114,46,99,111,109,112,111,110,101,110,116,68,105,100,67,97,116,99,104,38,38,40,114,46,99,111,109,112,111,110,101,110,116,68,105,100,67,97,116,99,104,40,110,44,95,124,124,123,125,41,44,117,61,114,46,95,95,100,41,44,117,41,114,101,116,117,114,110,32,114,46,95,95,69,61,114,125,99,97,116,99,104,40,116,41,123,110,61,116,125,116,104,114,111,119,32,110,125,125,44,101,61,48,44,95,61,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,32,110,117,108,108,33,61,110,38,38,110,117,108,108,61,61,110,46,99,111,110,115,116,114,117,99,116,111,114,125,44,120,46,112,114,111,116,111,116,121,112,101,46,115,101,116,83,116,97,116,101,61,102,117,110,99,116,105,111,110,40,110,44,116,41,123,118,97,114,32,101,59,101,61,110,117,108,108,33,61,116,104,105,115,46,95,95,115,38,38,116,104,105,115,46,95,95,115,33,61,116,104,105,115,46,115,116,97,116,101,63,116,104,105,115,46,95,95,115,58,116,104,105,115,46,95,95,115,61,109,40,123,125,44,116,104,105,115,46,115,116,97,116,101,41,44,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,38,38,40,110,61,110,40,109,40,123,125,44,101,41,44,116,104,105,115,46,112,114,111,112,115,41,41,44,110,38,38,109,40,101,44,110,41,44,110,117,108,108,33,61,110,38,38,116,104,105,115,46,95,95,118,38,38,40,116,38,38,116,104,105,115,46,95,115,98,46,112,117,115,104,40,116,41,44,72,40,116,104,105,115,41,41,125,44,120,46,112,114,111,116,111,116,121,112,101,46,102,111,114,99,101,85,112,100,97,116,101,61,102,117,110,99,116,105,111,110,40,110,41,123,116,104,105,115,46,95,95,118,38,38,40,116,104,105,115,46,95,95,101,61,33,48,44,110,38,38,116,104,105,115,46,95,95,104,46,112,117,115,104,40,110,41,44,72,40,116,104,105,115,41,41,125,44,120,46,112,114,111,116,111,116,121,112,101,46,114,101,110,100,101,114,61,67,44,114,61,91,93,44,117,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,80,114,111,109,105,115,101,63,80,114,111,109,105,115,101,46,112,114,111,116,111,116,121,112,101,46,116,104,101,110,46,98,105,110,100,40,80,114,111,109,105,115,101,46,114,101,115,111,108,118,101,40,41,41,58,115,101,116,84,105,109,101,111,117,116,44,105,61,102,117,110,99,116,105,111,110,40,110,44,116,41,123,114,101,116,117,114,110,32,110,46,95,95,118,46,95,95,98,45,116,46,95,95,118,46,95,95,98,125,44,80,46,95,95,114,61,48,44,108,61,47,40,80,111,105,110,116,101,114,67,97,112,116,117,114,101,41,36,124,67,97,112,116,117,114,101,36,47,105,44,99,61,48,44,97,61,77,40,33,49,41,44,102,61,77,40,33,48,41,44,115,61,48,59,118,97,114,32,71,44,74,44,81,44,88,44,89,61,48,44,90,61,91,93,44,110,110,61,116,44,116,110,61,110,110,46,95,95,98,44,101,110,61,110,110,46,95,95,114,44,95,110,61,110,110,46,100,105,102,102,101,100,44,114,110,61,110,110,46,95,95,99,44,111,110,61,110,110,46,117,110,109,111,117,110,116,44,117,110,61,110,110,46,95,95,59,102,117,110,99,116,105,111,110,32,108,110,40,110,44,116,41,123,110,110,46,95,95,104,38,38,110,110,46,95,95,104,40,74,44,110,44,89,124,124,116,41,44,89,61,48,59,118,97,114,32,101,61,74,46,95,95,72,124,124,40,74,46,95,95,72,61,123,95,95,58,91,93,44,95,95,104,58,91,93,125,41,59,114,101,116,117,114,110,32,110,62,61,101,46,95,95,46,108,101,110,103,116,104,38,38,101,46,95,95,46,112,117,115,104,40,123,125,41,44,101,46,95,95,91,110,93,125,102,117,110,99,116,105,111,110,32,99,110,40,110,41,123,114,101,116,117,114,110,32,89,61,49,44,97,110,40,80,110,44,110,41,125,102,117,110,99,116,105,111,110,32,97,110,40,110,44,116,44,101,41,123,118,97,114,32,95,61,108,110,40,71,43,43,44,50,41,59,105,102,40,95,46,116,61,110,44,33,95,46,95,95,99,38,38,40,95,46,95,95,61,91,101,63,101,40,116,41,58,80,110,40,118,111,105,100,32,48,44,116,41,44,102,117,110,99,116,105,111,110,40,110,41,123,118,97,114,32,116,61,95,46,95,95,78,63,95,46,95,95,78,91,48,93,58,95,46,95,95,91,48,93,44,101,61,95,46,116,40,116,44,110,41,59,116,33,61,61,101,38,38,40,95,46,95,95,78,61,91,101,44,95,46,95,95,91,49,93,93,44,95,46,95,95,99,46,115,101,116,83,116,97,116,101,40,123,125,41,41,125,93,44,95,46,95,95,99,61,74,44,33,74,46,95,95,102,41,41,123,118,97,114,32,114,61,102,117,110,99,116,105,111,110,40,110,44,116,44,101,41,123,105,102,40,33,95,46,95,95,99,46,95,95,72,41,114,101,116,117,114,110,33,48,59,118,97,114,32,114,61,95,46,95,95,99,46,95,95,72,46,95,95,46,102,105,108,116,101,114,40,40,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,33,33,110,46,95,95,99,125,41,41,59,105,102,40,114,46,101,118,101,114,121,40,40,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,33,110,46,95,95,78,125,41,41,41,114,101,116,117,114,110,33,111,124,124,111,46,99,97,108,108,40,116,104,105,115,44,110,44,116,44,101,41,59,118,97,114,32,117,61,95,46,95,95,99,46,112,114,111,112,115,33,61,61,110,59,114,101,116,117,114,110,32,114,46,102,111,114,69,97,99,104,40,40,102,117,110,99,116,105,111,110,40,110,41,123,105,102,40,110,46,95,95,78,41,123,118,97,114,32,116,61,110,46,95,95,91,48,93,59,110,46,95,95,61,110,46,95,95,78,44,110,46,95,95,78,61,118,111,105,100,32,48,44,116,33,61,61,110,46,95,95,91,48,93,38,38,40,117,61,33,48,41,125,125,41,41,44,111,38,38,111,46,99,97,108,108,40,116,104,105,115,44,110,44,116,44,101,41,124,124,117,125,59,74,46,95,95,102,61,33,48,59,118,97,114,32,111,61,74,46,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,44,117,61,74,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,112,100,97,116,101,59,74,46,99,111,109,112,111,110,101,110,116,87,105,108,108,85,112,100,97,116,101,61,102,117,110,99,116,105,111,110,40,110,44,116,44,101,41,123,105,102,40,116,104,105,115,46,95,95,101,41,123,118,97,114,32,95,61,111,59,111,61,118,111,105,100,32,48,44,114,40,110,44,116,44,101,41,44,111,61,95,125,117,38,38,117,46,99,97,108,108,40,116,104,105,115,44,110,44,116,44,101,41,125,44,74,46,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,61,114,125,114,101,116,117,114,110,32,95,46,95,95,78,124,124,95,46,95,95,125,102,117,110,99,116,105,111,110,32,102,110,40,110,44,116,41,123,118,97,114,32,101,61,108,110,40,71,43,43,44,51,41,59,33,110,110,46,95,95,115,38,38,72,110,40,101,46,95,95,72,44,116,41,38,38,40,101,46,95,95,61,110,44,101,46,117,61,116,44,74,46,95,95,72,46,95,95,104,46,112,117,115,104,40,101,41,41,125,102,117,110,99,116,105,111,110,32,115,110,40,110,44,116,41,123,118,97,114,32,101,61,108,110,40,71,43,43,44,52,41,59,33,110,110,46,95,95,115,38,38,72,110,40,101,46,95,95,72,44,116,41,38,38,40,101,46,95,95,61,110,44,101,46,117,61,116,44,74,46,95,95,104,46,112,117,115,104,40,101,41,41,125,102,117,110,99,116,105,111,110,32,112,110,40,110,41,123,114,101,116,117,114,110,32,89,61,53,44,100,110,40,40,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,123,99,117,114,114,101,110,116,58,110,125,125,41,44,91,93,41,125,102,117,110,99,116,105,111,110,32,104,110,40,110,44,116,44,101,41,123,89,61,54,44,115,110,40,40,102,117,110,99,116,105,111,110,40,41,123,105,102,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,110,41,123,118,97,114,32,101,61,110,40,116,40,41,41,59,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,41,123,110,40,110,117,108,108,41,44,101,38,38,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,101,38,38,101,40,41,125,125,105,102,40,110,41,114,101,116,117,114,110,32,110,46,99,117,114,114,101,110,116,61,116,40,41,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,110,46,99,117,114,114,101,110,116,61,110,117,108,108,125,125,41,44,110,117,108,108,61,61,101,63,101,58,101,46,99,111,110,99,97,116,40,110,41,41,125,102,117,110,99,116,105,111,110,32,100,110,40,110,44,116,41,123,118,97,114,32,101,61,108,110,40,71,43,43,44,55,41,59,114,101,116,117,114,110,32,72,110,40,101,46,95,95,72,44,116,41,38,38,40,101,46,95,95,61,110,40,41,44,101,46,95,95,72,61,116,44,101,46,95,95,104,61,110,41,44,101,46,95,95,125,102,117,110,99,116,105,111,110,32,118,110,40,110,44,116,41,123,114,101,116,117,114,110,32,89,61,56,44,100,110,40,40,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,110,125,41,44,116,41,125,102,117,110,99,116,105,111,110,32,109,110,40,110,41,123,118,97,114,32,116,61,74,46,99,111,110,116,101,120,116,91,110,46,95,95,99,93,44,101,61,108,110,40,71,43,43,44,57,41,59,114,101,116,117,114,110,32,101,46,99,61,110,44,116,63,40,110,117,108,108,61,61,101,46,95,95,38,38,40,101,46,95,95,61,33,48,44,116,46,115,117,98,40,74,41,41,44,116,46,112,114,111,112,115,46,118,97,108,117,101,41,58,110,46,95,95,125,102,117,110,99,116,105,111,110,32,121,110,40,110,44,116,41,123,110,110,46,117,115,101,68,101,98,117,103,86,97,108,117,101,38,38,110,110,46,117,115,101,68,101,98,117,103,86,97,108,117,101,40,116,63,116,40,110,41,58,110,41,125,102,117,110,99,116,105,111,110,32,103,110,40,110,41,123,118,97,114,32,116,61,108,110,40,71,43,43,44,49,48,41,44,101,61,99,110,40,41,59,114,101,116,117,114,110,32,116,46,95,95,61,110,44,74,46,99,111,109,112,111,110,101,110,116,68,105,100,67,97,116,99,104,124,124,40,74,46,99,111,109,112,111,110,101,110,116,68,105,100,67,97,116,99,104,61,102,117,110,99,116,105,111,110,40,110,44,95,41,123,116,46,95,95,38,38,116,46,95,95,40,110,44,95,41,44,101,91,49,93,40,110,41,125,41,44,91,101,91,48,93,44,102,117,110,99,116,105,111,110,40,41,123,101,91,49,93,40,118,111,105,100,32,48,41,125,93,125,102,117,110,99,116,105,111,110,32,98,110,40,41,123,118,97,114,32,110,61,108,110,40,71,43,43,44,49,49,41,59,105,102,40,33,110,46,95,95,41,123,102,111,114,40,118,97,114,32,116,61,74,46,95,95,118,59,110,117,108,108,33,61,61,116,38,38,33,116,46,95,95,109,38,38,110,117,108,108,33,61,61,116,46,95,95,59,41,116,61,116,46,95,95,59,118,97,114,32,101,61,116,46,95,95,109,124,124,40,116,46,95,95,109,61,91,48,44,48,93,41,59,110,46,95,95,61,34,80,34,43,101,91,48,93,43,34,45,34,43,101,91,49,93,43,43,125,114,101,116,117,114,110,32,110,46,95,95,125,102,117,110,99,116,105,111,110,32,107,110,40,41,123,102,111,114,40,118,97,114,32,110,59,110,61,90,46,115,104,105,102,116,40,41,59,41,105,102,40,110,46,95,95,80,38,38,110,46,95,95,72,41,116,114,121,123,110,46,95,95,72,46,95,95,104,46,102,111,114,69,97,99,104,40,119,110,41,44,110,46,95,95,72,46,95,95,104,46,102,111,114,69,97,99,104,40,85,110,41,44,110,46,95,95,72,46,95,95,104,61,91,93,125,99,97,116,99,104,40,95,41,123,110,46,95,95,72,46,95,95,104,61,91,93,44,110,110,46,95,95,101,40,95,44,110,46,95,95,118,41,125,125,110,110,46,95,95,98,61,102,117,110,99,116,105,111,110,40,110,41,123,74,61,110,117,108,108,44,116,110,38,38,116,110,40,110,41,125,44,110,110,46,95,95,61,102,117,110,99,116,105,111,110,40,110,44,116,41,123,110,38,38,116,46,95,95,107,38,38,116,46,95,95,107,46,95,95,109,38,38,40,110,46,95,95,109,61,116,46,95,95,107,46,95,95,109,41,44,117,110,38,38,117,110,40,110,44,116,41,125,44,110,110,46,95,95,114,61,102,117,110,99,116,105,111,110,40,110,41,123,101,110,38,38,101,110,40,110,41,44,71,61,48,59,118,97,114,32,116,61,40,74,61,110,46,95,95,99,41,46,95,95,72,59,116,38,38,40,81,61,61,61,74,63,40,116,46,95,95,104,61,91,93,44,74,46,95,95,104,61,91,93,44,116,46,95,95,46,102,111,114,69,97,99,104,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,46,95,95,78,38,38,40,110,46,95,95,61,110,46,95,95,78,41,44,110,46,117,61,110,46,95,95,78,61,118,111,105,100,32,48,125,41,41,41,58,40,116,46,95,95,104,46,102,111,114,69,97,99,104,40,119,110,41,44,116,46,95,95,104,46,102,111,114,69,97,99,104,40,85,110,41,44,116,46,95,95,104,61,91,93,44,71,61,48,41,41,44,81,61,74,125,44,110,110,46,100,105,102,102,101,100,61,102,117,110,99,116,105,111,110,40,110,41,123,95,110,38,38,95,110,40,110,41,59,118,97,114,32,116,61,110,46,95,95,99,59,116,38,38,116,46,95,95,72,38,38,40,116,46,95,95,72,46,95,95,104,46,108,101,110,103,116,104,38,38,40,49,33,61,61,90,46,112,117,115,104,40,116,41,38,38,88,61,61,61,110,110,46,114,101,113,117,101,115,116,65,110,105,109,97,116,105,111,110,70,114,97,109,101,124,124,40,40,88,61,110,110,46,114,101,113,117,101,115,116,65,110,105,109,97,116,105,111,110,70,114,97,109,101,41,124,124,120,110,41,40,107,110,41,41,44,116,46,95,95,72,46,95,95,46,102,111,114,69,97,99,104,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,46,117,38,38,40,110,46,95,95,72,61,110,46,117,41,44,110,46,117,61,118,111,105,100,32,48,125,41,41,41,44,81,61,74,61,110,117,108,108,125,44,110,110,46,95,95,99,61,102,117,110,99,116,105,111,110,40,110,44,116,41,123,116,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,110,41,123,116,114,121,123,110,46,95,95,104,46,102,111,114,69,97,99,104,40,119,110,41,44,110,46,95,95,104,61,110,46,95,95,104,46,102,105,108,116,101,114,40,40,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,33,110,46,95,95,124,124,85,110,40,110,41,125,41,41,125,99,97,116,99,104,40,111,41,123,116,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,110,41,123,110,46,95,95,104,38,38,40,110,46,95,95,104,61,91,93,41,125,41,41,44,116,61,91,93,44,110,110,46,95,95,101,40,111,44,110,46,95,95,118,41,125,125,41,41,44,114,110,38,38,114,110,40,110,44,116,41,125,44,110,110,46,117,110,109,111,117,110,116,61,102,117,110,99,116,105,111,110,40,110,41,123,111,110,38,38,111,110,40,110,41,59,118,97,114,32,116,44,101,61,110,46,95,95,99,59,101,38,38,101,46,95,95,72,38,38,40,101,46,95,95,72,46,95,95,46,102,111,114,69,97,99,104,40,40,102,117,110,99,116,105,111,110,40,110,41,123,116,114,121,123,119,110,40,110,41,125,99,97,116,99,104,40,110,41,123,116,61,110,125,125,41,41,44,101,46,95,95,72,61,118,111,105,100,32,48,44,116,38,38,110,110,46,95,95,101,40,116,44,101,46,95,95,118,41,41,125,59,118,97,114,32,67,110,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,114,101,113,117,101,115,116,65,110,105,109,97,116,105,111,110,70,114,97,109,101,59,102,117,110,99,116,105,111,110,32,120,110,40,110,41,123,118,97,114,32,116,44,101,61,102,117,110,99,116,105,111,110,40,41,123,99,108,101,97,114,84,105,109,101,111,117,116,40,95,41,44,67,110,38,38,99,97,110,99,101,108,65,110,105,109,97,116,105,111,110,70,114,97,109,101,40,116,41,44,115,101,116,84,105,109,101,111,117,116,40,110,41,125,44,95,61,115,101,116,84,105,109,101,111,117,116,40,101,44,51,53,41,59,67,110,38,38,40,116,61,114,101,113,117,101,115,116,65,110,105,109,97,116,105,111,110,70,114,97,109,101,40,101,41,41,125,102,117,110,99,116,105,111,110,32,119,110,40,110,41,123,118,97,114,32,116,61,74,44,101,61,110,46,95,95,99,59,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,101,38,38,40,110,46,95,95,99,61,118,111,105,100,32,48,44,101,40,41,41,44,74,61,116,125,102,117,110,99,116,105,111,110,32,85,110,40,110,41,123,118,97,114,32,116,61,74,59,110,46,95,95,99,61,110,46,95,95,40,41,44,74,61,116,125,102,117,110,99,116,105,111,110,32,72,110,40,110,44,116,41,123,114,101,116,117,114,110,33,110,124,124,110,46,108,101,110,103,116,104,33,61,61,116,46,108,101,110,103,116,104,124,124,116,46,115,111,109,101,40,40,102,117,110,99,116,105,111,110,40,116,44,101,41,123,114,101,116,117,114,110,32,116,33,61,61,110,91,101,93,125,41,41,125,102,117,110,99,116,105,111,110,32,80,110,40,110,44,116,41,123,114,101,116,117,114,110,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,116,63,116,40,110,41,58,116,125,118,97,114,32,69,110,61,102,117,110,99,116,105,111,110,40,110,44,116,44,101,44,95,41,123,118,97,114,32,114,59,116,91,48,93,61,48,59,102,111,114,40,118,97,114,32,111,61,49,59,111,60,116,46,108,101,110,103,116,104,59,111,43,43,41,123,118,97,114,32,117,61,116,91,111,43,43,93,44,105,61,116,91,111,93,63,40,116,91,48,93,124,61,117,63,49,58,50,44,101,91,116,91,111,43,43,93,93,41,58,116,91,43,43,111,93,59,51,61,61,61,117,63,95,91,48,93,61,105,58,52,61,61,61,117,63,95,91,49,93,61,79,98,106,101,99,116,46,97,115,115,105,103,110,40,95,91,49,93,124,124,123,125,44,105,41,58,53,61,61,61,117,63,40,95,91,49,93,61,95,91,49,93,124,124,123,125,41,91,116,91,43,43,111,93,93,61,105,58,54,61,61,61,117,63,95,91,49,93,91,116,91,43,43,111,93,93,43,61,105,43,34,34,58,117,63,40,114,61,110,46,97,112,112,108,121,40,105,44,69,110,40,110,44,105,44,101,44,91,34,34,44,110,117,108,108,93,41,41,44,95,46,112,117,115,104,40,114,41,44,105,91,48,93,63,116,91,48,93,124,61,50,58,40,116,91,111,45,50,93,61,48,44,116,91,111,93,61,114,41,41,58,95,46,112,117,115,104,40,105,41,125,114,101,116,117,114,110,32,95,125,44,83,110,61,110,101,119,32,77,97,112,59,102,117,110,99,116,105,111,110,32,65,110,40,110,41,123,118,97,114,32,116,61,83,110,46,103,101,116,40,116,104,105,115,41,59,114,101,116,117,114,110,32,116,124,124,40,116,61,110,101,119,32,77,97,112,44,83,110,46,115,101,116,40,116,104,105,115,44,116,41,41,44,40,116,61,69,110,40,116,104,105,115,44,116,46,103,101,116,40,110,41,124,124,40,116,46,115,101,116,40,110,44,116,61,102,117,110,99,116,105,111,110,40,110,41,123,102,111,114,40,118,97,114,32,116,44,101,44,95,61,49,44,114,61,34,34,44,111,61,34,34,44,117,61,91,48,93,44,105,61,102,117,110,99,116,105,111,110,40,110,41,123,49,61,61,61,95,38,38,40,110,124,124,40,114,61,114,46,114,101,112,108,97,99,101,40,47,94,92,115,42,92,110,92,115,42,124,92,115,42,92,110,92,115,42,36,47,103,44,34,34,41,41,41,63,117,46,112,117,115,104,40,48,44,110,44,114,41,58,51,61,61,61,95,38,38,40,110,124,124,114,41,63,40,117,46,112,117,115,104,40,51,44,110,44,114,41,44,95,61,50,41,58,50,61,61,61,95,38,38,34,46,46,46,34,61,61,61,114,38,38,110,63,117,46,112,117,115,104,40,52,44,110,44,48,41,58,50,61,61,61,95,38,38,114,38,38,33,110,63,117,46,112,117,115,104,40,53,44,48,44,33,48,44,114,41,58,95,62,61,53,38,38,40,40,114,124,124,33,110,38,38,53,61,61,61,95,41,38,38,40,117,46,112,117,115,104,40,95,44,48,44,114,44,101,41,44,95,61,54,41,44,110,38,38,40,117,46,112,117,115,104,40,95,44,110,44,48,44,101,41,44,95,61,54,41,41,44,114,61,34,34,125,44,108,61,48,59,108,60,110,46,108,101,110,103,116,104,59,108,43,43,41,123,108,38,38,40,49,61,61,61,95,38,38,105,40,41,44,105,40,108,41,41,59,102,111,114,40,118,97,114,32,99,61,48,59,99,60,110,91,108,93,46,108,101,110,103,116,104,59,99,43,43,41,116,61,110,91,108,93,91,99,93,44,49,61,61,61,95,63,34,60,34,61,61,61,116,63,40,105,40,41,44,117,61,91,117,93,44,95,61,51,41,58,114,43,61,116,58,52,61,61,61,95,63,34,45,45,34,61,61,61,114,38,38,34,62,34,61,61,61,116,63,40,95,61,49,44,114,61,34,34,41,58,114,61,116,43,114,91,48,93,58,111,63,116,61,61,61,111,63,111,61,34,34,58,114,43,61,116,58,39,34,39,61,61,61,116,124,124,34,39,34,61,61,61,116,63,111,61,116,58,34,62,34,61,61,61,116,63,40,105,40,41,44,95,61,49,41,58,95,38,38,40,34,61,34,61,61,61,116,63,40,95,61,53,44,101,61,114,44,114,61,34,34,41,58,34,47,34,61,61,61,116,38,38,40,95,60,53,124,124,34,62,34,61,61,61,110,91,108,93,91,99,43,49,93,41,63,40,105,40,41,44,51,61,61,61,95,38,38,40,117,61,117,91,48,93,41,44,95,61,117,44,40,117,61,117,91,48,93,41,46,112,117,115,104,40,50,44,48,44,95,41,44,95,61,48,41,58,34,32,34,61,61,61,116,124,124,34,92,116,34,61,61,61,116,124,124,34,92,110,34,61,61,61,116,124,124,34,92,114,34,61,61,61,116,63,40,105,40,41,44,95,61,50,41,58,114,43,61,116,41,44,51,61,61,61,95,38,38,34,33,45,45,34,61,61,61,114,38,38,40,95,61,52,44,117,61,117,91,48,93,41,125,114,101,116,117,114,110,32,105,40,41,44,117,125,40,110,41,41,44,116,41,44,97,114,103,117,109,101,110,116,115,44,91,93,41,41,46,108,101,110,103,116,104,62,49,63,116,58,116,91,48,93,125,118,97,114,32,78,110,61,65,110,46,98,105,110,100,40,103,41,59,118,97,114,32,68,110,61,123,125,59,102,117,110,99,116,105,111,110,32,84,110,40,110,44,116,41,123,102,111,114,40,118,97,114,32,101,32,105,110,32,116,41,110,91,101,93,61,116,91,101,93,59,114,101,116,117,114,110,32,110,125,102,117,110,99,116,105,111,110,32,82,110,40,110,44,116,44,101,41,123,118,97,114,32,95,44,114,61,47,40,63,58,92,63,40,91,94,35,93,42,41,41,63,40,35,46,42,41,63,36,47,44,111,61,110,46,109,97,116,99,104,40,114,41,44,117,61,123,125,59,105,102,40,111,38,38,111,91,49,93,41,102,111,114,40,118,97,114,32,105,61,111,91,49,93,46,115,112,108,105,116,40,34,38,34,41,44,108,61,48,59,108,60,105,46,108,101,110,103,116,104,59,108,43,43,41,123,118,97,114,32,99,61,105,91,108,93,46,115,112,108,105,116,40,34,61,34,41,59,117,91,100,101,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,40,99,91,48,93,41,93,61,100,101,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,40,99,46,115,108,105,99,101,40,49,41,46,106,111,105,110,40,34,61,34,41,41,125,110,61,76,110,40,110,46,114,101,112,108,97,99,101,40,114,44,34,34,41,41,44,116,61,76,110,40,116,124,124,34,34,41,59,102,111,114,40,118,97,114,32,97,61,77,97,116,104,46,109,97,120,40,110,46,108,101,110,103,116,104,44,116,46,108,101,110,103,116,104,41,44,102,61,48,59,102,60,97,59,102,43,43,41,105,102,40,116,91,102,93,38,38,34,58,34,61,61,61,116,91,102,93,46,99,104,97,114,65,116,40,48,41,41,123,118,97,114,32,115,61,116,91,102,93,46,114,101,112,108,97,99,101,40,47,40,94,58,124,91,43,42,63,93,43,36,41,47,103,44,34,34,41,44,112,61,40,116,91,102,93,46,109,97,116,99,104,40,47,91,43,42,63,93,43,36,47,41,124,124,68,110,41,91,48,93,124,124,34,34,44,104,61,126,112,46,105,110,100,101,120,79,102,40,34,43,34,41,44,100,61,126,112,46,105,110,100,101,120,79,102,40,34,42,34,41,44,118,61,110,91,102,93,124,124,34,34,59,105,102,40,33,118,38,38,33,100,38,38,40,112,46,105,110,100,101,120,79,102,40,34,63,34,41,60,48,124,124,104,41,41,123,95,61,33,49,59,98,114,101,97,107,125,105,102,40,117,91,115,93,61,100,101,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,40,118,41,44,104,124,124,100,41,123,117,91,115,93,61,110,46,115,108,105,99,101,40,102,41,46,109,97,112,40,100,101,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,41,46,106,111,105,110,40,34,47,34,41,59,98,114,101,97,107,125,125,101,108,115,101,32,105,102,40,116,91,102,93,33,61,61,110,91,102,93,41,123,95,61,33,49,59,98,114,101,97,107,125,114,101,116,117,114,110,40,33,48,61,61,61,101,46,100,101,102,97,117,108,116,124,124,33,49,33,61,61,95,41,38,38,117,125,102,117,110,99,116,105,111,110,32,77,110,40,110,44,116,41,123,114,101,116,117,114,110,32,110,46,114,97,110,107,60,116,46,114,97,110,107,63,49,58,110,46,114,97,110,107,62,116,46,114,97,110,107,63,45,49,58,110,46,105,110,100,101,120,45,116,46,105,110,100,101,120,125,102,117,110,99,116,105,111,110,32,87,110,40,110,44,116,41,123,114,101,116,117,114,110,32,110,46,105,110,100,101,120,61,116,44,110,46,114,97,110,107,61,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,32,110,46,112,114,111,112,115,46,100,101,102,97,117,108,116,63,48,58,76,110,40,110,46,112,114,111,112,115,46,112,97,116,104,41,46,109,97,112,40,70,110,41,46,106,111,105,110,40,34,34,41,125,40,110,41,44,110,46,112,114,111,112,115,125,102,117,110,99,116,105,111,110,32,76,110,40,110,41,123,114,101,116,117,114,110,32,110,46,114,101,112,108,97,99,101,40,47,40,94,92,47,43,124,92,47,43,36,41,47,103,44,34,34,41,46,115,112,108,105,116,40,34,47,34,41,125,102,117,110,99,116,105,111,110,32,70,110,40,110,41,123,114,101,116,117,114,110,34,58,34,61,61,110,46,99,104,97,114,65,116,40,48,41,63,49,43,34,42,43,63,34,46,105,110,100,101,120,79,102,40,110,46,99,104,97,114,65,116,40,110,46,108,101,110,103,116,104,45,49,41,41,124,124,52,58,53,125,118,97,114,32,73,110,61,123,125,44,36,110,61,91,93,44,79,110,61,91,93,44,106,110,61,110,117,108,108,44,86,110,61,123,117,114,108,58,75,110,40,41,125,44,113,110,61,122,40,86,110,41,59,102,117,110,99,116,105,111,110,32,66,110,40,41,123,118,97,114,32,110,61,109,110,40,113,110,41,59,105,102,40,110,61,61,61,86,110,41,123,118,97,114,32,116,61,99,110,40,41,91,49,93,59,102,110,40,40,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,79,110,46,112,117,115,104,40,116,41,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,79,110,46,115,112,108,105,99,101,40,79,110,46,105,110,100,101,120,79,102,40,116,41,44,49,41,125,125,41,44,91,93,41,125,114,101,116,117,114,110,91,110,44,122,110,93,125,102,117,110,99,116,105,111,110,32,75,110,40,41,123,118,97,114,32,110,59,114,101,116,117,114,110,34,34,43,40,40,110,61,106,110,38,38,106,110,46,108,111,99,97,116,105,111,110,63,106,110,46,108,111,99,97,116,105,111,110,58,106,110,38,38,106,110,46,103,101,116,67,117,114,114,101,110,116,76,111,99,97,116,105,111,110,63,106,110,46,103,101,116,67,117,114,114,101,110,116,76,111,99,97,116,105,111,110,40,41,58,34,117,110,100,101,102,105,110,101,100,34,33,61,116,121,112,101,111,102,32,108,111,99,97,116,105,111,110,63,108,111,99,97,116,105,111,110,58,73,110,41,46,112,97,116,104,110,97,109,101,124,124,34,34,41,43,40,110,46,115,101,97,114,99,104,124,124,34,34,41,125,102,117,110,99,116,105,111,110,32,122,110,40,110,44,116,41,123,114,101,116,117,114,110,32,118,111,105,100,32,48,61,61,61,116,38,38,40,116,61,33,49,41,44,34,115,116,114,105,110,103,34,33,61,116,121,112,101,111,102,32,110,38,38,110,46,117,114,108,38,38,40,116,61,110,46,114,101,112,108,97,99,101,44,110,61,110,46,117,114,108,41,44,102,117,110,99,116,105,111,110,40,110,41,123,102,111,114,40,118,97,114,32,116,61,36,110,46,108,101,110,103,116,104,59,116,45,45,59,41,105,102,40,36,110,91,116,93,46,99,97,110,82,111,117,116,101,40,110,41,41,114,101,116,117,114,110,33,48,59,114,101,116,117,114,110,33,49,125,40,110,41,38,38,102,117,110,99,116,105,111,110,40,110,44,116,41,123,118,111,105,100,32,48,61,61,61,116,38,38,40,116,61,34,112,117,115,104,34,41,44,106,110,38,38,106,110,91,116,93,63,106,110,91,116,93,40,110,41,58,34,117,110,100,101,102,105,110,101,100,34,33,61,116,121,112,101,111,102,32,104,105,115,116,111,114,121,38,38,104,105,115,116,111,114,121,91,116,43,34,83,116,97,116,101,34,93,38,38,104,105,115,116,111,114,121,91,116,43,34,83,116,97,116,101,34,93,40,110,117,108,108,44,110,117,108,108,44,110,41,125,40,110,44,116,63,34,114,101,112,108,97,99,101,34,58,34,112,117,115,104,34,41,44,71,110,40,110,41,125,102,117,110,99,116,105,111,110,32,71,110,40,110,41,123,102,111,114,40,118,97,114,32,116,61,33,49,44,101,61,48,59,101,60,36,110,46,108,101,110,103,116,104,59,101,43,43,41,36,110,91,101,93,46,114,111,117,116,101,84,111,40,110,41,38,38,40,116,61,33,48,41,59,114,101,116,117,114,110,32,116,125,102,117,110,99,116,105,111,110,32,74,110,40,110,41,123,105,102,40,110,38,38,110,46,103,101,116,65,116,116,114,105,98,117,116,101,41,123,118,97,114,32,116,61,110,46,103,101,116,65,116,116,114,105,98,117,116,101,40,34,104,114,101,102,34,41,44,101,61,110,46,103,101,116,65,116,116,114,105,98,117,116,101,40,34,116,97,114,103,101,116,34,41,59,105,102,40,116,38,38,116,46,109,97,116,99,104,40,47,94,92,47,47,103,41,38,38,40,33,101,124,124,101,46,109,97,116,99,104,40,47,94,95,63,115,101,108,102,36,47,105,41,41,41,114,101,116,117,114,110,32,122,110,40,116,41,125,125,102,117,110,99,116,105,111,110,32,81,110,40,110,41,123,114,101,116,117,114,110,32,110,46,115,116,111,112,73,109,109,101,100,105,97,116,101,80,114,111,112,97,103,97,116,105,111,110,38,38,110,46,115,116,111,112,73,109,109,101,100,105,97,116,101,80,114,111,112,97,103,97,116,105,111,110,40,41,44,110,46,115,116,111,112,80,114,111,112,97,103,97,116,105,111,110,38,38,110,46,115,116,111,112,80,114,111,112,97,103,97,116,105,111,110,40,41,44,110,46,112,114,101,118,101,110,116,68,101,102,97,117,108,116,40,41,44,33,49,125,102,117,110,99,116,105,111,110,32,88,110,40,110,41,123,105,102,40,33,40,110,46,99,116,114,108,75,101,121,124,124,110,46,109,101,116,97,75,101,121,124,124,110,46,97,108,116,75,101,121,124,124,110,46,115,104,105,102,116,75,101,121,124,124,110,46,98,117,116,116,111,110,41,41,123,118,97,114,32,116,61,110,46,116,97,114,103,101,116,59,100,111,123,105,102,40,34,97,34,61,61,61,116,46,108,111,99,97,108,78,97,109,101,38,38,116,46,103,101,116,65,116,116,114,105,98,117,116,101,40,34,104,114,101,102,34,41,41,123,105,102,40,116,46,104,97,115,65,116,116,114,105,98,117,116,101,40,34,100,97,116,97,45,110,97,116,105,118,101,34,41,124,124,116,46,104,97,115,65,116,116,114,105,98,117,116,101,40,34,110,97,116,105,118,101,34,41,41,114,101,116,117,114,110,59,105,102,40,74,110,40,116,41,41,114,101,116,117,114,110,32,81,110,40,110,41,125,125,119,104,105,108,101,40,116,61,116,46,112,97,114,101,110,116,78,111,100,101,41,125,125,118,97,114,32,89,110,61,33,49,59,102,117,110,99,116,105,111,110,32,90,110,40,110,41,123,110,46,104,105,115,116,111,114,121,38,38,40,106,110,61,110,46,104,105,115,116,111,114,121,41,44,116,104,105,115,46,115,116,97,116,101,61,123,117,114,108,58,110,46,117,114,108,124,124,75,110,40,41,125,125,84,110,40,90,110,46,112,114,111,116,111,116,121,112,101,61,110,101,119,32,120,44,123,115,104,111,117,108,100,67,111,109,112,111,110,101,110,116,85,112,100,97,116,101,58,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,33,48,33,61,61,110,46,115,116,97,116,105,99,124,124,110,46,117,114,108,33,61,61,116,104,105,115,46,112,114,111,112,115,46,117,114,108,124,124,110,46,111,110,67,104,97,110,103,101,33,61,61,116,104,105,115,46,112,114,111,112,115,46,111,110,67,104,97,110,103,101,125,44,99,97,110,82,111,117,116,101,58,102,117,110,99,116,105,111,110,40,110,41,123,118,97,114,32,116,61,78,40,116,104,105,115,46,112,114,111,112,115,46,99,104,105,108,100,114,101,110,41,59,114,101,116,117,114,110,32,118,111,105,100,32,48,33,61,61,116,104,105,115,46,103,40,116,44,110,41,125,44,114,111,117,116,101,84,111,58,102,117,110,99,116,105,111,110,40,110,41,123,116,104,105,115,46,115,101,116,83,116,97,116,101,40,123,117,114,108,58,110,125,41,59,118,97,114,32,116,61,116,104,105,115,46,99,97,110,82,111,117,116,101,40,110,41,59,114,101,116,117,114,110,32,116,104,105,115,46,112,124,124,116,104,105,115,46,102,111,114,99,101,85,112,100,97,116,101,40,41,44,116,125,44,99,111,109,112,111,110,101,110,116,87,105,108,108,77,111,117,110,116,58,102,117,110,99,116,105,111,110,40,41,123,116,104,105,115,46,112,61,33,48,125,44,99,111,109,112,111,110,101,110,116,68,105,100,77,111,117,110,116,58,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,110,61,116,104,105,115,59,89,110,124,124,40,89,110,61,33,48,44,106,110,124,124,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,112,111,112,115,116,97,116,101,34,44,40,102,117,110,99,116,105,111,110,40,41,123,71,110,40,75,110,40,41,41,125,41,41,44,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,99,108,105,99,107,34,44,88,110,41,41,44,36,110,46,112,117,115,104,40,116,104,105,115,41,44,106,110,38,38,40,116,104,105,115,46,117,61,106,110,46,108,105,115,116,101,110,40,40,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,101,61,116,46,108,111,99,97,116,105,111,110,124,124,116,59,110,46,114,111,117,116,101,84,111,40,34,34,43,40,101,46,112,97,116,104,110,97,109,101,124,124,34,34,41,43,40,101,46,115,101,97,114,99,104,124,124,34,34,41,41,125,41,41,41,44,116,104,105,115,46,112,61,33,49,125,44,99,111,109,112,111,110,101,110,116,87,105,108,108,85,110,109,111,117,110,116,58,102,117,110,99,116,105,111,110,40,41,123,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,116,104,105,115,46,117,38,38,116,104,105,115,46,117,40,41,44,36,110,46,115,112,108,105,99,101,40,36,110,46,105,110,100,101,120,79,102,40,116,104,105,115,41,44,49,41,125,44,99,111,109,112,111,110,101,110,116,87,105,108,108,85,112,100,97,116,101,58,102,117,110,99,116,105,111,110,40,41,123,116,104,105,115,46,112,61,33,48,125,44,99,111,109,112,111,110,101,110,116,68,105,100,85,112,100,97,116,101,58,102,117,110,99,116,105,111,110,40,41,123,116,104,105,115,46,112,61,33,49,125,44,103,58,102,117,110,99,116,105,111,110,40,110,44,116,41,123,110,61,110,46,102,105,108,116,101,114,40,87,110,41,46,115,111,114,116,40,77,110,41,59,102,111,114,40,118,97,114,32,101,61,48,59,101,60,110,46,108,101,110,103,116,104,59,101,43,43,41,123,118,97,114,32,95,61,110,91,101,93,44,114,61,82,110,40,116,44,95,46,112,114,111,112,115,46,112,97,116,104,44,95,46,112,114,111,112,115,41,59,105,102,40,114,41,114,101,116,117,114,110,91,95,44,114,93,125,125,44,114,101,110,100,101,114,58,102,117,110,99,116,105,111,110,40,110,44,116,41,123,118,97,114,32,101,44,95,44,114,61,110,46,111,110,67,104,97,110,103,101,44,111,61,116,46,117,114,108,44,117,61,116,104,105,115,46,99,44,105,61,116,104,105,115,46,103,40,78,40,110,46,99,104,105,108,100,114,101,110,41,44,111,41,59,105,102,40,105,38,38,40,95,61,75,40,105,91,48,93,44,84,110,40,84,110,40,123,117,114,108,58,111,44,109,97,116,99,104,101,115,58,101,61,105,91,49,93,125,44,101,41,44,123,107,101,121,58,118,111,105,100,32,48,44,114,101,102,58,118,111,105,100,32,48,125,41,41,41,44,111,33,61,61,40,117,38,38,117,46,117,114,108,41,41,123,84,110,40,86,110,44,117,61,116,104,105,115,46,99,61,123,117,114,108,58,111,44,112,114,101,118,105,111,117,115,58,117,38,38,117,46,117,114,108,44,99,117,114,114,101,110,116,58,95,44,112,97,116,104,58,95,63,95,46,112,114,111,112,115,46,112,97,116,104,58,110,117,108,108,44,109,97,116,99,104,101,115,58,101,125,41,44,117,46,114,111,117,116,101,114,61,116,104,105,115,44,117,46,97,99,116,105,118,101,61,95,63,91,95,93,58,91,93,59,102,111,114,40,118,97,114,32,108,61,79,110,46,108,101,110,103,116,104,59,108,45,45,59,41,79,110,91,108,93,40,123,125,41,59,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,114,38,38,114,40,117,41,125,114,101,116,117,114,110,32,103,40,113,110,46,80,114,111,118,105,100,101,114,44,123,118,97,108,117,101,58,117,125,44,95,41,125,125,41,59,118,97,114,32,110,116,61,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,32,103,40,34,97,34,44,84,110,40,123,111,110,67,108,105,99,107,58,88,110,125,44,110,41,41,125,44,116,116,61,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,32,103,40,110,46,99,111,109,112,111,110,101,110,116,44,110,41,125,59,101,120,112,111,114,116,123,120,32,97,115,32,67,111,109,112,111,110,101,110,116,44,67,32,97,115,32,70,114,97,103,109,101,110,116,44,110,116,32,97,115,32,76,105,110,107,44,116,116,32,97,115,32,82,111,117,116,101,44,90,110,32,97,115,32,82,111,117,116,101,114,44,75,32,97,115,32,99,108,111,110,101,69,108,101,109,101,110,116,44,122,32,97,115,32,99,114,101,97,116,101,67,111,110,116,101,120,116,44,103,32,97,115,32,99,114,101,97,116,101,69,108,101,109,101,110,116,44,107,32,97,115,32,99,114,101,97,116,101,82,101,102,44,82,110,32,97,115,32,101,120,101,99,44,75,110,32,97,115,32,103,101,116,67,117,114,114,101,110,116,85,114,108,44,103,32,97,115,32,104,44,78,110,32,97,115,32,104,116,109,108,44,66,32,97,115,32,104,121,100,114,97,116,101,44,95,32,97,115,32,105,115,86,97,108,105,100,69,108,101,109,101,110,116,44,116,32,97,115,32,111,112,116,105,111,110,115,44,113,32,97,115,32,114,101,110,100,101,114,44,122,110,32,97,115,32,114,111,117,116,101,44,78,32,97,115,32,116,111,67,104,105,108,100,65,114,114,97,121,44,118,110,32,97,115,32,117,115,101,67,97,108,108,98,97,99,107,44,109,110,32,97,115,32,117,115,101,67,111,110,116,101,120,116,44,121,110,32,97,115,32,117,115,101,68,101,98,117,103,86,97,108,117,101,44,102,110,32,97,115,32,117,115,101,69,102,102,101,99,116,44,103,110,32,97,115,32,117,115,101,69,114,114,111,114,66,111,117,110,100,97,114,121,44,98,110,32,97,115,32,117,115,101,73,100,44,104,110,32,97,115,32,117,115,101,73,109,112,101,114,97,116,105,118,101,72,97,110,100,108,101,44,115,110,32,97,115,32,117,115,101,76,97,121,111,117,116,69,102,102,101,99,116,44,100,110,32,97,115,32,117,115,101,77,101,109,111,44,97,110,32,97,115,32,117,115,101,82,101,100,117,99,101,114,44,112,110,32,97,115,32,117,115,101,82,101,102,44,66,110,32,97,115,32,117,115,101,82,111,117,116,101,114,44,99,110,32,97,115,32,117,115,101,83,116,97,116,101,125,59,0};
 
-static const unsigned char v3[] = {31,139,8,0,0,0,0,0,0,3,101,83,75,111,219,48,12,190,247,87,176,186,248,176,74,126,63,82,88,1,178,172,135,29,134,237,176,13,219,81,181,149,88,173,44,101,146,18,55,255,190,178,157,52,105,7,24,34,77,126,228,71,137,100,125,251,229,251,250,231,223,31,15,208,185,94,46,111,234,81,128,100,106,75,17,87,8,26,201,172,165,168,195,155,189,148,240,184,197,67,39,28,71,203,27,128,186,227,172,29,21,175,58,225,36,95,214,225,44,103,91,207,29,131,166,99,198,114,71,209,222,109,112,133,32,188,118,118,206,237,48,255,183,23,7,138,254,224,95,43,188,214,253,142,57,241,40,185,103,214,202,113,229,35,191,62,80,222,110,249,135,88,197,122,78,209,65,240,97,167,141,187,130,15,162,117,29,109,249,65,52,28,79,63,119,32,148,112,130,73,108,27,38,57,141,73,116,73,38,133,122,6,195,37,69,194,167,64,224,142,59,159,87,244,108,203,67,123,216,126,122,233,37,130,206,240,13,69,45,115,236,254,157,231,174,246,10,120,69,89,26,140,183,185,15,195,97,24,200,144,18,109,182,97,18,69,209,8,13,96,35,164,164,129,210,138,7,48,214,252,89,191,208,32,130,8,146,204,127,1,88,103,244,243,169,92,26,196,36,63,155,104,208,236,141,241,23,91,107,169,77,176,132,218,63,80,119,198,251,226,121,195,118,52,48,122,175,218,224,218,252,164,133,122,179,183,52,248,22,103,164,202,75,136,75,18,85,9,75,82,82,101,21,156,132,175,36,202,73,150,103,56,38,105,188,170,200,162,40,97,62,189,43,142,43,88,144,50,63,96,82,254,94,172,10,40,166,128,2,22,7,111,101,31,209,56,241,57,18,40,72,148,36,77,76,202,52,37,69,6,41,201,11,240,47,95,229,48,50,229,48,50,245,57,41,227,12,34,150,100,36,241,182,147,152,178,156,92,111,144,20,82,239,136,223,28,129,111,33,212,227,243,46,47,221,188,197,120,106,232,220,176,177,35,214,183,196,216,222,146,158,135,194,143,136,153,79,210,88,139,230,190,91,119,148,220,118,156,251,41,10,49,158,70,59,60,207,118,253,168,219,227,251,45,64,126,206,71,235,228,246,132,182,49,98,231,192,154,230,194,216,180,138,56,38,228,32,84,235,153,72,163,251,49,108,134,158,56,46,147,119,93,193,92,249,57,118,42,115,66,191,99,17,214,105,115,36,189,80,228,201,94,18,95,3,231,57,238,117,187,31,151,105,10,235,217,127,120,127,209,105,237,95,1,96,102,109,31,7,4,0,0,0};
+static const unsigned char v3[] = {27,163,123,81,148,140,90,198,72,132,125,228,164,32,160,245,129,118,132,101,187,224,191,96,160,36,84,56,117,103,232,114,207,90,35,226,136,114,44,26,11,246,242,199,214,247,240,156,16,214,216,114,132,38,167,136,213,132,39,156,243,125,140,122,197,12,210,228,10,188,101,194,76,216,207,22,241,46,117,89,159,166,210,229,65,246,41,50,5,80,246,164,123,174,8,87,62,25,230,69,3,166,87,78,245,247,134,188,4,61,64,126,20,59,113,134,84,241,77,143,119,239,43,124,249,219,247,41,91,89,95,39,116,223,47,242,101,13,98,198,226,9,6,1,22,49,222,96,243,66,42,208,102,58,110,132,147,175,22,43,117,85,148,246,161,71,85,106,93,200,144,113,8,111,94,208,203,46,75,187,60,80,230,70,82,237,77,182,41,208,24,129,18,47,48,127,101,106,249,242,75,224,173,139,229,162,151,50,107,40,103,146,72,65,166,140,219,102,154,152,197,2,226,46,205,29,192,123,3,158,37,223,147,111,252,244,236,146,196,45,120,95,71,188,119,212,69,38,147,113,60,57,207,123,185,80,186,80,161,42,247,38,9,165,36,161,4,101,140,100,236,69,138,125,18,196,210,53,214,161,3,77,123,25,193,254,216,219,127,167,189,173,157,249,239,86,20,196,16,146,240,105,130,190,121,12,87,23,186,139,102,138,206,129,129,177,251,248,24,246,35,214,240,97,24,151,41,91,141,72,181,49,162,225,236,76,67,132,73,216,131,8,231,72,129,17,254,107,125,136,198,14,19,3,251,82,53,6,28,101,143,149,32,235,115,62,133,202,215,142,243,99,166,97,186,211,169,221,48,33,88,35,30,171,7,19,170,124,224,143,124,240,168,156,87,176,185,19,181,82,27,85,234,248,2,245,135,195,72,148,183,204,224,13,44,162,197,2,127,125,114,236,31,22,185,128,96,235,155,198,43,144,6,182,78,81,69,224,208,37,171,47,78,196,19,56,4,28,104,68,179,49,48,216,225,37,255,30,250,185,213,142,159,230,113,113,228,92,218,245,88,251,71,46,83,254,6,232,156,46,231,72,10,116,170,18,74,237,238,153,108,4,253,117,150,106,228,207,186,59,179,220,203,22,20,84,29,85,151,198,3,155,129,37,173,110,90,147,113,83,101,222,95,166,223,104,167,172,32,78,120,181,249,90,193,101,57,176,244,169,120,7,99,106,161,201,35,201,153,38,45,47,139,249,229,170,126,152,154,101,110,250,253,176,147,134,52,118,100,85,183,147,19,143,109,220,224,45,65,89,135,155,203,191,63,206,1,86,101,192,133,245,158,172,175,157,161,171,169,245,232,254,230,252,235,66,84,47,125,78,215,98,60,16,224,116,131,255,67,151,107,27,242,19,181,223,107,245,35,109,71,94,144,88,1,68,21,49,234,246,142,181,168,151,123,149,220,245,101,95,183,254,34,54,182,111,69,222,173,60,37,223,237,124,33,39,251,201,252,142,181,237,48,224,143,8,147,157,158,233,41,231,51,185,78,75,78,158,118,49,167,131,139,214,244,17,254,255,254,100,171,66,243,12,214,74,38,41,171,41,32,172,230,181,200,150,51,145,44,0,241,78,1,65,243,142,80,4,154,56,131,42,184,43,70,97,167,179,217,248,6,93,65,194,28,96,10,34,228,192,172,112,59,71,164,33,64,55,200,122,139,48,172,81,63,0,217,4,100,147,229,8,220,204,222,162,237,26,148,3,239,75,102,169,4,19,113,131,193,11,207,113,34,109,65,105,77,76,22,197,211,190,232,230,81,156,86,65,232,201,5,22,73,106,85,79,11,31,184,39,28,58,89,8,123,123,219,215,62,241,60,51,172,88,36,42,85,93,116,114,19,194,87,104,62,17,115,173,229,53,43,27,238,47,222,106,22,163,88,39,11,157,198,208,29,178,30,69,90,0,222,170,166,162,157,14,183,69,192,193,195,200,4,179,205,218,172,124,173,55,188,65,212,73,44,73,117,145,162,25,102,95,35,46,184,219,172,39,186,100,107,93,51,247,201,167,146,109,232,70,165,121,92,177,38,105,141,203,172,248,130,96,150,120,4,43,214,210,176,92,185,163,182,7,60,85,26,214,154,233,0,42,15,181,42,86,162,234,27,48,188,17,149,89,14,42,173,222,63,41,218,244,147,153,24,14,229,48,79,52,82,16,237,203,6,101,189,183,214,196,8,114,54,118,227,119,231,25,225,74,238,116,7,83,71,221,200,124,7,21,117,21,194,118,21,162,20,109,162,12,198,128,134,144,201,102,168,91,251,134,53,219,67,75,210,250,201,100,210,200,4,220,135,253,232,234,36,126,121,215,60,101,11,251,195,38,242,8,69,22,225,61,150,193,144,3,133,191,140,209,200,167,107,138,87,217,227,251,226,66,206,94,195,233,0,241,20,38,152,2,246,148,227,167,101,139,210,98,191,124,77,180,66,68,152,147,146,190,36,15,144,118,209,209,222,148,157,62,232,178,167,198,251,190,247,175,186,148,139,33,200,197,183,53,197,231,221,244,21,133,220,72,150,148,86,95,95,27,139,82,224,235,43,154,91,185,250,46,183,179,147,47,166,227,201,227,217,171,175,162,148,27,44,126,134,29,84,180,160,121,53,120,179,116,110,101,219,63,225,140,210,207,145,175,167,63,103,71,236,194,169,207,137,92,144,6,234,21,239,72,205,152,186,36,23,234,94,233,241,210,202,209,96,190,215,185,202,247,34,52,183,2,244,20,83,171,98,200,204,231,8,124,144,36,240,202,245,189,106,32,243,115,228,76,92,115,163,101,0,181,63,92,27,52,157,66,26,187,79,123,247,220,134,59,107,82,253,98,104,139,121,57,211,18,109,183,219,213,227,148,35,72,18,83,119,138,219,96,145,243,157,186,51,23,91,78,111,226,195,182,173,158,66,239,31,43,175,33,6,152,60,88,248,156,2,145,152,31,187,49,170,198,140,191,167,53,4,81,194,194,140,106,31,47,186,91,255,86,235,168,213,213,55,167,243,62,191,146,30,51,82,11,152,167,92,20,54,21,82,2,76,211,199,168,9,140,231,226,80,229,131,21,169,9,36,159,216,90,208,36,157,162,33,150,184,211,201,170,35,97,46,175,229,213,54,73,240,27,170,60,22,6,93,62,144,246,62,97,77,189,108,23,6,72,255,246,149,249,169,19,141,199,189,197,229,128,119,192,162,226,156,215,166,155,47,130,199,87,116,154,88,217,172,47,207,186,249,148,124,205,161,225,50,69,190,27,78,8,186,70,57,6,73,127,182,252,139,81,120,47,142,221,243,1,17,42,95,13,177,95,184,190,53,243,169,101,36,241,66,254,82,22,186,67,214,20,23,19,202,29,246,147,77,142,182,3,116,135,207,195,200,37,146,168,181,199,249,238,212,229,232,176,136,188,11,1,189,52,129,254,149,53,198,84,98,219,124,220,140,118,183,80,246,93,203,40,23,103,121,174,16,93,79,93,245,106,140,172,170,71,253,64,5,29,89,61,197,25,227,134,84,193,62,225,51,166,168,72,58,114,232,53,194,219,59,114,93,98,33,89,135,200,85,115,40,220,237,146,174,83,243,146,165,221,234,69,169,143,93,141,61,133,30,85,36,218,251,249,186,32,237,223,246,5,8,37,219,221,143,19,31,87,191,208,143,22,221,31,7,221,33,195,206,119,245,70,89,22,132,205,141,167,17,20,61,58,255,58,110,104,126,136,46,249,99,76,253,20,30,149,141,193,245,114,151,186,106,123,10,109,189,47,165,185,73,113,157,228,253,28,168,105,199,159,170,104,148,84,210,151,199,203,86,147,246,69,162,20,130,152,104,109,60,134,52,59,217,212,231,210,247,32,16,162,248,76,183,14,180,142,252,83,49,184,81,255,59,93,184,234,62,4,62,108,171,125,56,2,38,22,182,208,204,225,91,122,67,69,0,236,151,168,192,9,156,57,124,183,183,125,205,72,163,52,221,14,147,241,209,81,213,225,107,201,80,122,117,144,113,1,140,189,157,63,202,98,121,218,252,48,162,27,126,220,217,229,202,209,181,70,151,153,219,170,190,218,59,245,57,145,34,198,104,142,41,69,67,91,122,138,83,100,169,226,58,254,174,70,168,168,153,236,50,46,11,214,75,50,196,108,34,6,172,228,170,172,66,98,157,33,51,24,218,23,65,213,135,100,196,69,15,74,81,18,0,19,114,15,55,120,165,159,51,142,31,218,94,199,205,245,203,131,15,35,131,2,146,237,235,179,11,185,0,18,101,130,37,121,127,12,48,157,167,19,184,81,94,236,35,135,254,212,11,35,204,122,138,9,99,208,229,201,251,80,85,67,159,176,157,153,180,38,86,1,149,179,23,203,134,252,33,149,253,70,164,184,50,238,199,33,219,89,210,50,136,215,62,94,23,138,54,228,39,241,236,251,112,247,119,217,246,10,146,61,113,154,178,38,175,167,123,183,43,174,13,49,219,172,15,53,150,98,241,39,24,128,253,241,125,173,33,165,164,175,147,5,174,126,118,134,173,125,208,8,148,169,67,89,75,47,141,164,134,193,217,155,205,233,48,244,245,60,22,44,107,153,86,249,134,208,101,47,161,125,9,130,159,21,255,52,248,97,20,50,19,207,47,88,125,252,135,92,103,136,254,199,160,90,5,82,45,122,42,59,181,198,100,137,42,89,138,235,149,230,122,150,62,178,169,240,172,98,65,43,220,149,47,139,62,216,221,152,35,85,175,33,84,219,55,82,62,254,42,135,37,120,44,29,86,118,58,118,138,11,81,121,18,227,118,217,107,188,48,229,244,111,146,99,154,246,107,134,132,226,183,183,120,81,195,98,165,94,33,175,118,148,67,228,82,1,15,80,122,246,93,205,191,166,144,130,116,68,96,252,203,145,223,76,124,20,154,247,19,206,194,200,208,158,227,214,100,138,46,229,102,111,85,222,86,138,85,92,22,227,28,199,63,52,38,59,13,177,106,204,1,159,53,221,42,175,129,122,89,66,197,127,106,103,175,113,222,208,183,199,251,172,212,94,20,220,253,68,95,93,16,19,134,249,204,42,104,206,121,72,139,233,161,147,20,66,124,53,30,197,216,35,150,189,254,195,18,56,122,85,117,250,218,231,139,92,49,68,62,27,191,83,120,217,39,187,67,116,200,254,227,210,199,108,156,174,192,199,27,248,220,216,253,83,56,69,63,248,14,163,222,130,45,245,104,91,250,68,119,144,97,129,135,157,56,161,225,103,137,42,188,242,70,231,83,195,71,71,58,124,169,23,47,118,48,170,195,231,124,180,87,40,127,248,220,245,254,72,202,253,211,145,83,80,91,203,252,111,251,232,126,160,123,41,126,247,236,73,3,191,105,108,109,241,41,255,62,192,203,70,17,11,121,149,247,46,11,18,197,154,236,26,16,97,12,115,44,200,16,68,189,231,7,248,43,60,54,175,114,44,150,167,10,44,171,234,130,85,49,118,104,71,50,59,181,135,228,244,117,97,166,177,237,220,157,14,113,184,109,225,13,204,49,253,159,163,175,170,138,86,213,160,239,164,120,225,23,82,16,166,197,254,116,162,9,125,8,52,201,177,205,37,87,51,252,236,83,192,85,188,112,179,177,91,85,83,85,1,13,215,178,141,97,130,154,188,64,244,32,109,135,208,106,5,73,71,193,87,243,230,170,35,140,19,121,38,51,105,117,6,199,213,216,122,227,184,110,44,204,156,104,166,200,86,171,90,232,105,108,88,44,197,77,140,168,198,144,71,18,15,237,129,82,14,234,244,45,212,235,87,84,11,237,196,133,208,152,154,64,170,231,120,250,253,244,6,187,48,222,80,179,158,112,7,139,133,248,63,105,133,101,102,242,66,245,176,157,244,179,94,30,59,20,43,208,73,155,59,87,116,205,3,41,242,12,142,215,135,211,147,113,158,103,68,5,109,250,250,242,116,62,194,207,188,243,191,241,12,177,32,47,122,176,134,202,73,31,120,0,46,129,202,153,233,148,165,203,70,212,137,181,142,161,154,82,188,250,87,177,167,30,91,172,127,138,173,40,242,27,238,40,172,170,130,59,35,133,175,190,59,184,88,192,213,176,126,9,43,68,231,17,103,73,95,213,106,20,193,120,51,182,83,104,143,155,51,250,244,51,84,142,62,7,194,222,189,42,55,222,203,252,27,206,168,78,207,124,15,100,249,21,156,171,98,233,223,232,79,73,13,29,7,52,241,141,15,254,77,110,14,38,134,209,106,106,175,137,50,198,181,50,0,163,116,243,208,197,209,11,139,69,228,52,254,5,186,127,212,1,253,66,9,124,195,77,209,122,140,45,160,22,67,251,56,185,165,153,87,66,29,119,120,223,87,91,176,244,198,230,220,90,170,120,179,234,219,183,84,186,128,235,139,74,127,95,144,190,145,188,230,157,139,254,165,236,166,31,13,214,83,156,174,184,60,135,22,210,174,105,8,160,81,106,87,224,116,29,138,2,229,0,0,85,235,52,32,210,24,163,194,110,255,69,119,213,145,33,237,212,79,124,156,223,113,42,233,186,115,110,140,216,193,198,115,30,191,128,206,49,99,159,64,13,243,103,197,214,173,198,222,211,99,172,245,200,193,87,19,72,94,80,208,172,117,129,86,40,236,118,213,10,161,118,163,103,26,51,250,65,184,41,200,248,210,184,232,200,87,141,85,111,114,93,65,66,137,190,28,255,122,88,110,203,194,133,28,19,154,215,109,93,168,251,96,17,215,146,183,59,194,61,150,225,144,3,233,239,45,119,169,65,93,36,251,228,2,186,247,157,11,47,170,246,175,41,188,162,17,224,93,63,238,111,225,222,156,198,123,139,149,53,8,173,68,241,33,14,179,107,50,190,142,71,55,130,235,224,226,96,218,243,248,74,70,35,125,140,151,177,101,59,2,119,19,132,113,27,103,233,128,57,187,191,120,6,98,134,211,210,159,27,128,77,118,43,22,170,79,138,79,182,44,116,248,164,3,161,108,111,119,196,3,121,29,116,106,216,43,133,204,170,27,2,69,6,172,18,99,168,226,230,240,174,250,199,90,198,110,156,252,236,244,111,90,63,151,140,165,237,249,145,189,152,117,4,121,106,132,8,25,184,189,91,140,252,47,224,158,143,12,85,4,253,176,254,198,38,96,53,159,164,161,115,137,163,244,216,184,84,71,8,204,58,169,196,90,182,109,101,147,178,249,71,86,146,172,21,231,110,235,61,234,163,92,185,96,47,84,69,8,205,48,246,128,48,202,16,240,68,115,76,129,111,123,206,182,8,17,109,210,236,20,44,232,232,102,167,32,172,77,76,82,109,65,126,105,94,62,141,155,124,210,69,62,199,95,69,245,22,18,249,65,7,243,131,23,252,81,251,32,186,37,232,239,124,33,138,150,176,121,28,231,198,54,118,171,149,209,30,128,135,117,234,44,104,144,212,168,22,4,29,28,31,248,157,234,22,32,4,166,179,126,120,59,174,62,203,139,244,73,206,248,129,233,202,136,69,61,143,172,190,184,229,186,182,135,197,60,40,243,72,156,128,52,199,113,20,205,92,75,82,238,148,177,67,88,22,117,231,176,246,200,203,210,118,51,56,225,1,89,92,220,192,142,71,240,86,106,217,84,35,134,45,9,110,22,41,90,32,126,83,73,52,103,80,148,225,248,38,200,85,188,210,82,254,174,168,103,117,22,162,19,237,128,18,68,122,158,130,165,23,40,57,25,98,41,158,89,17,227,26,72,128,41,191,65,90,27,34,169,255,160,140,190,248,193,65,153,9,57,136,226,18,61,58,106,115,132,184,108,226,55,166,238,44,212,153,114,24,207,233,161,39,53,29,31,105,215,43,251,96,55,194,7,147,110,229,151,194,56,223,27,226,255,88,173,12,45,65,149,72,164,103,5,86,27,126,254,183,127,86,231,54,202,168,105,151,255,193,203,72,232,213,52,169,194,208,25,45,215,93,12,197,204,182,240,244,143,240,100,166,82,27,200,145,17,0,57,120,224,176,108,24,141,190,145,216,189,142,32,197,29,66,214,116,151,183,44,52,89,59,198,154,106,44,221,42,217,110,96,123,164,156,131,70,7,115,203,206,4,234,68,240,183,162,153,218,195,63,65,221,47,10,157,201,245,156,34,5,48,213,46,86,112,207,65,98,212,236,2,201,236,88,149,157,193,255,148,24,229,63,187,161,227,213,217,98,191,227,221,238,148,54,188,174,193,76,71,120,119,136,247,178,115,182,75,131,155,22,127,185,9,98,136,31,162,162,166,46,31,60,145,207,117,18,76,110,140,155,168,133,73,196,28,237,13,28,32,147,153,249,216,241,132,200,165,118,206,165,87,144,212,81,246,34,17,89,170,142,31,191,224,55,32,232,113,28,140,141,197,49,62,20,115,245,131,70,249,237,121,96,215,193,49,127,140,31,198,121,55,55,56,159,191,60,98,216,144,74,38,217,244,159,66,44,214,87,169,224,199,146,241,25,181,132,116,42,135,38,18,157,124,68,25,103,0,152,79,108,78,182,82,128,22,161,218,32,112,218,213,51,173,52,106,16,194,32,146,133,42,25,131,31,58,41,69,158,124,136,134,136,33,125,227,12,149,54,134,129,121,30,190,40,131,46,53,14,125,66,193,146,185,209,232,141,226,254,125,38,123,239,145,159,123,240,62,239,130,51,242,135,42,158,162,162,35,154,53,120,86,151,202,196,19,69,30,167,125,155,37,28,38,29,90,200,189,28,99,9,144,115,83,167,49,247,63,198,104,46,203,2,144,11,72,89,53,243,81,101,183,212,197,244,31,164,19,99,102,58,133,244,176,187,45,29,140,253,231,182,129,22,203,151,61,180,99,174,28,36,146,10,97,157,65,34,217,80,219,2,2,146,39,130,23,81,146,193,130,46,111,43,129,13,116,159,152,214,172,23,77,91,73,201,36,199,104,153,124,197,21,73,99,30,39,171,26,205,242,4,196,73,124,142,10,4,129,186,215,146,200,84,24,235,117,4,77,123,211,91,8,208,102,33,220,129,174,76,24,138,155,108,107,214,187,91,205,92,145,63,85,178,217,19,49,5,67,26,20,103,224,188,223,73,57,152,32,241,9,95,14,238,206,214,147,137,106,0,68,156,221,23,214,68,134,153,219,23,205,2,244,7,39,142,35,253,67,107,127,172,80,206,239,137,68,107,194,168,62,21,74,76,134,255,35,49,122,182,125,110,101,19,242,16,201,245,173,173,215,196,165,87,211,102,102,171,187,229,201,204,243,251,118,148,61,8,142,106,112,87,222,169,148,91,133,33,184,45,236,254,122,104,69,222,34,185,148,43,239,198,107,85,160,248,43,145,44,250,205,42,130,67,121,29,245,68,147,158,104,162,137,24,119,231,251,59,158,135,178,36,202,235,89,79,218,50,108,119,150,216,80,134,128,171,237,237,56,122,228,81,80,7,247,40,176,11,249,188,160,228,207,89,23,20,210,61,10,44,83,190,112,238,40,220,115,139,174,250,24,120,166,143,170,1,12,172,185,254,242,24,2,15,93,46,17,10,121,130,23,87,216,42,134,110,30,164,39,16,11,23,52,88,173,116,188,62,249,55,38,84,228,126,242,72,58,33,172,90,172,107,47,58,2,204,166,204,17,195,137,85,112,101,128,197,230,175,227,204,58,102,203,123,10,123,135,247,60,92,85,50,128,112,52,205,205,124,210,38,228,89,18,79,110,157,34,188,145,244,237,82,22,119,223,222,174,133,238,128,165,226,129,21,37,192,126,23,206,205,139,108,27,221,89,143,240,9,131,33,46,87,24,69,83,40,157,120,181,229,65,34,103,183,118,160,182,171,146,16,201,182,35,10,39,119,73,174,17,225,64,138,77,241,25,240,133,138,203,254,61,105,139,184,161,154,82,94,140,106,9,133,164,183,20,39,236,36,17,125,195,97,72,2,230,130,38,67,81,176,122,155,128,158,79,165,201,80,72,146,229,104,232,140,165,35,201,138,106,39,73,1,162,36,139,164,19,39,27,61,37,122,27,132,17,67,76,112,194,9,75,27,150,43,60,44,174,157,19,172,163,201,185,4,147,65,194,81,222,37,224,192,44,171,131,220,137,85,96,242,141,208,40,44,24,73,84,192,41,65,170,66,21,110,47,128,179,192,195,58,197,99,250,20,192,218,188,204,163,64,106,168,198,184,136,249,73,34,165,179,141,154,42,207,195,92,0,239,95,171,130,16,192,152,178,125,161,99,187,94,46,36,144,117,86,27,34,204,87,250,175,134,116,95,29,233,13,224,206,184,136,47,147,238,0,209,118,29,203,48,56,26,158,176,3,138,11,183,8,108,2,69,181,48,53,213,156,10,166,75,154,175,195,110,73,119,240,50,133,100,90,122,41,174,22,158,120,131,240,141,62,61,229,13,31,81,220,161,221,24,81,145,159,105,118,144,76,228,202,158,89,233,92,176,102,148,122,222,92,87,15,172,51,194,192,204,167,112,99,172,12,25,126,250,127,208,134,15,7,57,117,220,122,15,37,183,105,73,209,95,177,17,161,46,67,100,113,155,71,8,11,173,84,75,138,110,170,14,97,66,12,180,246,220,94,167,115,230,182,48,143,42,193,221,21,79,17,219,177,238,196,192,78,23,175,176,56,233,84,148,136,140,63,43,104,130,200,33,53,115,4,75,74,15,154,33,121,71,234,32,21,160,115,179,112,4,154,20,71,37,147,115,230,150,138,29,217,197,225,187,36,70,146,90,193,146,171,34,4,157,134,207,75,129,20,168,81,230,151,148,168,19,18,64,206,18,162,102,237,101,230,40,88,237,49,184,89,40,243,114,66,32,149,116,99,187,177,146,9,44,70,230,207,26,55,20,68,100,241,112,126,63,225,46,125,245,103,70,17,113,68,253,213,130,20,40,63,56,113,174,13,136,29,231,136,133,82,103,98,28,242,202,206,140,188,57,97,40,249,25,55,75,69,18,9,156,201,17,103,225,72,161,216,118,73,1,12,61,98,228,139,21,227,200,149,176,240,166,81,228,121,216,12,158,3,191,40,146,87,148,190,23,53,161,30,218,29,151,17,12,66,105,10,170,170,11,138,170,121,30,206,212,96,2,169,6,108,189,26,131,115,36,44,97,160,75,183,166,38,95,28,72,121,63,117,185,235,39,131,161,69,89,109,25,85,250,238,20,209,49,103,88,212,38,147,158,232,208,80,17,245,212,60,247,66,54,30,145,123,149,240,142,182,181,186,11,35,68,228,111,184,182,17,67,151,122,89,172,144,208,212,197,217,33,41,95,96,236,85,140,165,6,28,124,192,165,49,163,7,72,212,205,234,210,76,192,57,30,191,3,106,255,199,194,210,214,219,156,147,75,155,238,66,83,33,182,163,172,211,253,107,202,127,103,228,103,150,100,36,13,233,141,79,229,89,37,218,213,20,106,80,63,202,139,83,39,53,70,177,166,240,86,169,21,164,189,15,238,83,204,238,154,69,211,126,100,167,16,123,94,16,41,101,42,253,49,232,148,108,20,190,239,227,73,118,121,146,57,37,191,78,24,31,204,127,104,20,138,191,91,221,95,5,97,195,124,6,71,174,152,96,84,113,43,52,183,192,125,232,249,73,56,51,122,157,193,125,82,154,174,161,223,192,123,101,133,146,83,132,31,230,227,171,74,20,52,68,13,174,117,32,193,118,136,129,171,8,249,101,68,175,56,88,32,41,67,98,134,223,246,26,176,90,176,77,242,248,84,104,101,231,172,33,193,17,198,241,57,132,67,57,46,140,194,83,171,249,33,228,161,23,174,163,97,121,36,44,113,93,45,197,209,245,194,74,70,246,60,18,20,10,143,225,132,32,213,16,98,6,36,169,48,107,129,248,85,217,171,67,240,85,91,6,33,214,113,97,18,142,73,66,164,117,222,49,229,213,255,217,169,220,38,157,252,94,211,222,3,55,182,26,213,186,148,98,197,40,217,5,249,204,205,125,200,36,66,246,131,143,13,200,128,83,179,144,101,131,121,213,9,140,21,177,248,164,126,52,83,124,207,53,165,113,185,189,119,172,148,141,40,8,134,233,47,118,100,17,4,50,160,144,141,182,38,149,8,11,5,41,85,66,17,220,93,204,236,143,206,133,127,130,228,121,241,176,243,110,182,36,156,98,88,238,198,41,232,101,238,170,64,139,156,156,187,229,71,113,161,54,42,216,17,64,75,89,218,198,235,112,121,145,172,59,144,222,105,40,167,47,72,39,34,151,165,124,73,17,239,216,182,172,58,131,247,96,236,22,237,140,166,1,23,155,14,208,77,4,53,199,231,235,8,78,53,214,89,125,107,215,57,105,227,85,229,63,154,43,80,210,164,178,39,53,123,116,65,93,95,31,147,126,220,162,100,240,132,144,134,51,101,141,51,174,233,11,183,189,39,166,236,42,205,65,1,169,145,40,249,16,222,51,209,136,156,177,72,52,236,60,141,83,203,37,100,120,131,235,201,145,73,35,10,48,0,17,143,144,4,101,85,164,27,0,96,3,84,118,155,158,46,193,97,213,189,106,218,210,16,240,182,146,113,84,117,244,93,72,228,3,129,123,248,69,117,99,4,38,23,174,146,190,224,72,222,16,61,81,190,33,238,215,198,4,99,150,42,104,221,186,147,45,8,120,161,24,79,132,251,185,191,41,139,57,23,69,2,243,137,30,186,51,17,21,89,192,112,21,60,1,124,216,16,201,222,4,147,106,35,108,170,113,5,87,206,226,8,147,21,31,87,188,167,114,100,57,219,108,27,11,109,190,146,139,94,46,53,20,185,11,145,224,47,29,146,209,222,17,224,103,87,16,167,241,77,83,239,0,52,41,143,103,157,19,3,111,188,137,97,40,122,92,197,70,14,169,23,51,208,48,193,217,69,17,31,10,9,205,155,177,209,168,37,173,24,123,217,192,34,228,119,151,32,129,236,2,174,241,7,15,169,87,75,193,84,62,12,141,133,134,210,177,132,113,122,56,93,131,77,15,121,222,251,71,68,126,180,2,4,255,250,129,177,73,75,223,119,197,24,2,203,85,255,2,60,165,61,42,67,70,126,169,143,141,191,148,50,27,211,190,142,33,17,57,150,92,31,242,65,6,125,22,194,0,29,234,92,188,214,53,169,229,178,131,0,80,0,123,184,146,36,30,7,236,240,24,7,4,18,29,11,125,81,34,0,18,219,138,96,190,141,195,144,10,31,42,24,74,162,91,9,70,234,10,133,66,17,28,177,143,140,108,225,140,134,191,213,66,110,215,26,251,143,63,248,232,180,206,40,25,213,75,52,43,146,148,244,42,162,15,168,62,192,219,104,52,191,16,81,186,128,193,166,202,53,192,236,159,166,0,179,172,146,145,122,70,54,243,164,171,118,202,129,55,239,163,233,213,217,59,63,79,136,135,10,28,220,188,191,212,83,162,239,142,155,33,39,50,56,73,132,77,53,245,230,171,34,146,74,70,111,213,144,246,28,99,203,154,152,79,118,19,16,135,85,237,70,251,246,132,8,236,25,148,114,203,62,31,159,3,66,169,188,161,43,52,108,137,10,4,135,84,225,22,106,12,193,250,66,108,183,212,168,110,130,94,98,26,60,255,203,204,219,233,94,205,209,222,56,161,203,141,173,97,233,118,220,178,149,4,214,176,31,211,144,224,141,49,118,27,208,84,163,70,19,116,187,239,109,252,109,187,255,149,200,28,210,235,237,96,80,7,167,89,229,71,2,102,87,88,166,79,197,29,110,125,190,206,175,153,100,14,113,90,161,191,202,149,175,234,132,234,63,55,90,123,185,59,82,210,228,124,238,190,230,39,162,126,114,168,129,68,153,220,195,16,138,180,69,62,0,111,47,26,67,11,39,20,11,197,138,177,82,47,5,151,49,30,98,71,45,212,166,127,207,122,5,53,179,10,72,87,154,194,164,38,142,179,2,163,194,213,82,212,252,113,1,87,175,97,229,139,17,142,77,9,206,239,124,53,254,149,23,212,201,92,14,19,46,176,145,237,219,239,147,80,110,213,145,252,57,99,68,42,65,165,91,86,142,119,237,191,98,102,58,154,114,14,128,17,174,248,188,81,83,150,164,113,190,253,129,253,75,241,58,51,5,224,105,254,95,90,9,74,67,11,213,164,208,219,188,53,74,146,48,191,83,229,246,238,70,201,214,120,159,11,10,106,237,252,176,80,63,245,124,195,243,70,52,252,212,215,146,139,179,173,223,36,212,195,141,221,42,34,35,44,53,230,254,117,111,116,130,141,28,39,97,11,226,32,83,46,105,155,70,108,14,131,195,162,38,81,46,26,233,14,60,184,26,125,227,172,254,166,238,184,155,64,33,132,103,204,36,58,129,144,41,71,234,143,142,179,254,222,61,41,232,31,27,181,166,173,86,225,87,194,202,219,11,152,74,87,254,53,172,9,25,70,198,203,38,82,193,10,246,149,218,97,22,166,224,219,140,4,212,244,34,64,3,70,159,165,218,2,78,156,6,15,158,97,224,175,113,183,90,213,6,1,163,220,34,152,137,60,167,108,61,74,72,98,222,145,143,91,204,120,51,17,32,67,232,91,24,102,90,241,14,239,14,232,157,253,238,10,93,244,169,96,54,98,2,244,138,26,199,219,20,51,221,11,110,3,208,189,249,225,125,238,239,115,210,129,31,187,131,50,64,240,133,4,244,59,48,235,238,158,216,9,149,176,243,121,85,55,158,171,170,179,74,90,123,159,90,234,135,50,162,138,63,216,85,141,219,85,5,72,77,63,21,6,87,217,15,29,217,92,59,73,127,44,37,47,178,247,129,129,109,254,113,70,252,147,104,72,192,167,183,33,113,156,229,64,242,95,160,190,160,66,164,241,237,60,30,135,222,70,2,62,109,110,232,210,14,179,101,23,38,169,45,9,17,174,226,75,211,34,172,140,38,127,225,150,101,97,213,32,70,145,217,135,182,169,155,100,221,97,193,200,8,114,58,109,154,252,67,140,223,132,131,111,169,142,120,75,176,207,112,124,10,54,32,52,56,8,171,135,149,157,176,63,110,220,168,187,29,195,42,178,96,110,55,225,35,158,233,44,39,41,236,193,236,134,51,211,119,21,139,37,168,41,182,200,146,29,85,138,142,70,202,18,219,206,193,203,33,4,184,24,120,15,97,169,60,242,70,27,124,100,126,14,238,206,219,153,148,192,129,179,69,103,111,232,45,118,4,164,34,185,118,165,122,48,204,58,127,72,254,125,230,200,162,47,24,135,7,174,53,17,17,12,52,84,32,110,12,168,246,29,19,24,78,34,254,136,19,131,14,160,211,4,115,43,89,134,225,229,141,227,134,71,239,55,8,111,253,83,93,61,75,22,113,82,38,42,86,160,21,113,37,127,13,127,118,167,80,130,163,83,207,143,198,145,193,146,62,3,65,218,56,3,135,244,27,24,1,253,193,169,3,128,195,63,25,33,144,79,251,122,184,227,233,173,151,126,249,172,189,133,247,104,151,46,39,67,209,42,98,60,105,210,174,88,15,87,31,18,215,73,50,61,97,172,166,62,141,67,58,217,80,83,92,86,58,132,164,223,82,73,55,145,78,111,235,108,2,70,153,100,185,215,254,178,120,229,23,150,168,87,142,128,229,102,186,212,4,236,25,55,92,199,255,33,240,188,89,167,207,247,147,48,199,118,60,60,94,67,197,132,25,233,116,197,168,247,69,43,36,84,140,127,48,56,162,116,51,122,100,168,43,32,102,78,166,180,117,159,220,88,199,54,119,147,174,18,24,165,99,142,231,165,155,40,160,121,140,111,155,177,193,114,3,1,196,193,244,177,199,85,59,107,3,17,13,16,86,234,115,201,137,75,115,254,142,104,158,26,86,79,111,52,163,56,183,163,182,73,80,92,22,241,208,77,132,119,73,253,234,87,137,220,87,32,169,167,233,203,225,231,127,242,151,191,2,152,22,121,235,112,1,0};
 
-static const unsigned char v4[] = {31,139,8,0,0,0,0,0,0,3,189,60,237,118,219,54,178,255,243,20,136,54,91,73,169,72,137,178,100,39,142,237,61,249,106,227,61,110,146,19,59,185,119,215,199,39,165,68,72,98,77,145,60,36,101,73,117,245,78,247,25,238,147,221,153,193,7,1,138,82,220,109,123,83,215,38,9,96,48,51,24,12,102,6,3,116,187,140,189,255,112,245,246,152,189,252,120,206,198,126,20,229,108,190,200,11,150,23,126,86,176,101,88,204,88,211,79,195,110,147,133,49,75,178,128,103,172,72,88,206,179,59,206,138,25,103,126,154,50,191,96,126,188,102,159,63,157,63,122,212,92,228,28,26,103,225,184,104,190,120,20,206,211,4,192,220,179,89,135,101,60,134,214,29,6,21,46,11,191,224,244,244,118,50,225,227,130,30,63,241,73,135,205,138,121,212,97,159,146,69,1,29,109,216,36,75,230,140,53,221,238,104,17,7,17,119,127,201,77,160,231,227,36,206,59,236,34,153,134,113,135,93,242,162,8,227,105,135,189,90,20,69,130,31,160,151,14,43,194,244,117,18,37,25,84,164,191,60,232,176,247,73,17,78,194,177,95,132,88,239,163,15,237,229,243,231,52,74,252,224,135,48,226,10,202,21,95,21,95,252,104,193,21,58,128,205,56,1,20,98,30,23,185,192,232,17,34,82,32,34,9,59,101,105,150,164,57,59,61,35,98,126,62,201,239,166,108,28,249,121,126,250,228,158,138,92,122,219,176,213,60,138,243,211,198,172,40,210,227,110,119,185,92,186,203,3,55,201,166,221,126,175,215,235,66,179,6,187,11,249,242,85,178,58,109,244,88,143,121,125,247,217,17,253,30,54,206,78,2,62,201,207,78,242,98,29,241,51,55,138,156,113,148,59,222,253,36,140,162,227,24,112,123,1,99,144,220,242,227,191,1,44,249,236,204,67,224,106,20,194,159,99,79,127,92,134,65,49,59,238,185,195,116,245,98,115,210,21,0,79,186,2,252,148,133,193,105,227,194,95,243,236,107,191,193,2,191,240,157,216,159,115,249,141,245,27,118,29,207,169,171,229,65,173,212,7,73,18,108,104,40,108,161,234,105,227,39,32,232,176,223,241,220,103,253,47,207,220,231,222,75,207,29,62,235,208,175,30,252,231,117,60,248,233,185,131,103,239,6,190,231,14,6,29,250,69,69,142,231,184,7,71,47,221,195,231,240,35,107,3,119,160,74,47,114,92,40,244,250,190,251,12,32,123,178,190,235,13,29,128,244,101,232,14,143,160,228,8,126,100,51,247,217,161,3,255,191,27,184,71,7,95,142,220,254,51,40,62,132,31,42,238,117,232,101,248,238,185,59,64,136,67,248,209,5,0,241,217,240,203,129,59,24,190,180,154,0,206,222,65,231,160,227,30,29,194,143,254,72,8,250,110,255,57,252,136,143,136,38,252,143,116,61,23,191,196,103,34,238,93,223,61,120,254,5,153,131,124,57,234,208,47,129,242,160,227,246,135,239,60,111,171,160,100,232,191,27,221,189,156,71,182,10,230,126,241,182,25,15,163,65,176,222,213,118,15,157,195,208,0,225,207,7,219,24,64,3,32,20,208,7,24,190,77,152,135,109,15,142,34,160,218,245,124,131,59,240,217,243,92,111,96,112,17,63,13,220,193,145,26,17,205,120,207,17,47,0,223,59,80,195,89,50,223,17,195,114,248,14,135,197,28,104,44,193,106,95,96,36,77,209,128,129,244,134,192,6,192,138,132,166,148,40,44,57,112,61,175,99,203,94,79,80,65,12,238,78,229,255,48,101,207,126,6,109,48,89,196,99,84,39,236,29,247,65,229,181,238,35,80,12,11,161,229,64,1,230,188,184,156,37,203,203,48,224,35,31,223,203,151,77,155,221,63,98,160,42,139,69,22,11,253,241,232,36,8,239,212,248,141,166,206,114,6,179,24,52,108,56,190,93,131,42,78,157,30,251,213,185,30,60,187,97,171,165,51,89,68,17,27,145,154,118,70,44,93,59,125,246,228,222,128,207,190,251,142,53,211,200,57,234,55,55,172,200,252,56,15,17,81,7,244,62,11,22,25,41,65,231,160,215,19,101,147,36,155,55,206,0,31,19,133,116,5,64,101,79,208,65,143,205,241,215,36,226,43,6,136,205,115,103,12,122,145,103,212,14,90,142,72,141,178,98,157,130,58,16,47,13,150,196,227,8,240,7,133,200,239,80,81,218,28,105,209,183,199,119,237,141,234,179,0,29,236,228,17,44,26,206,160,215,147,160,1,248,147,123,90,2,92,104,148,31,232,218,51,231,176,193,186,178,255,174,122,48,72,32,100,241,151,227,177,169,159,58,43,103,0,40,68,19,7,84,34,47,198,51,22,77,143,197,247,195,178,47,163,125,198,1,149,16,22,64,3,16,168,56,213,85,77,103,38,103,116,151,53,189,64,211,60,245,99,155,238,57,171,210,15,242,52,229,1,174,200,126,126,12,35,140,114,181,49,250,183,49,152,133,65,192,99,236,110,20,37,227,91,124,152,137,238,151,78,186,162,239,83,103,154,249,32,45,0,156,249,89,232,59,162,13,96,144,45,184,69,26,113,93,172,141,32,65,97,17,161,150,39,241,110,176,16,6,227,84,141,137,144,249,141,49,214,234,75,201,166,174,61,74,244,7,127,193,36,218,152,243,72,9,198,253,34,139,196,124,145,19,69,172,187,239,253,187,139,48,190,133,165,183,117,79,40,117,8,21,176,38,50,180,41,160,17,84,87,235,177,20,103,217,177,79,117,78,27,127,123,114,143,15,155,134,98,154,120,103,167,167,216,156,253,131,53,129,71,98,4,134,61,49,30,35,176,9,156,67,152,43,211,44,89,164,77,118,204,154,244,157,56,121,4,223,103,201,29,207,142,237,186,226,155,226,247,80,53,222,8,81,18,226,112,192,224,27,216,74,129,51,15,88,10,179,77,137,65,4,234,4,44,28,231,144,77,146,24,190,240,121,56,74,162,192,156,15,72,183,158,8,75,168,137,147,65,51,252,137,96,207,70,49,93,115,29,24,190,95,235,220,133,73,196,11,199,67,18,114,7,137,136,252,181,241,232,36,41,143,143,73,107,16,147,86,78,79,11,12,254,115,204,34,210,29,15,210,62,22,140,73,184,2,161,23,42,47,226,147,2,254,140,18,16,196,185,80,129,135,189,27,208,75,71,125,166,149,164,84,132,153,5,69,126,84,242,206,144,128,73,148,44,157,181,227,47,208,180,29,103,73,20,129,180,57,107,171,157,208,163,164,64,45,50,97,236,178,112,58,43,68,107,133,208,150,218,44,85,197,56,137,216,28,230,31,14,246,90,207,253,173,186,51,96,54,136,122,6,130,13,244,213,42,16,146,2,148,0,33,33,171,200,84,20,67,91,81,226,28,53,52,36,14,1,200,5,251,87,178,200,216,43,160,39,120,152,186,84,20,152,160,229,244,211,234,224,141,159,207,70,137,159,5,21,141,48,75,230,124,35,231,91,183,129,243,10,138,112,114,26,26,97,27,154,52,235,243,10,176,113,50,213,176,114,93,229,129,48,255,43,252,33,4,111,32,158,132,211,10,216,37,248,5,26,46,190,60,24,230,15,97,54,95,250,25,7,23,2,12,96,94,129,27,36,203,24,61,11,13,123,33,107,61,16,250,219,59,244,54,42,64,253,136,103,133,134,200,101,149,109,136,223,82,175,2,120,235,222,82,170,215,2,30,153,43,162,194,13,40,88,229,188,181,174,111,218,47,202,186,169,63,229,84,19,124,41,110,213,243,160,154,174,7,136,102,60,159,161,162,70,133,76,200,77,112,197,109,145,143,41,122,236,78,121,209,236,16,38,226,223,156,23,179,36,0,245,250,241,195,229,21,148,140,146,96,125,204,254,121,249,225,189,139,142,102,60,13,39,235,214,61,162,112,204,240,247,166,221,145,109,55,109,23,124,212,184,149,161,246,207,192,87,75,226,86,187,173,1,27,133,154,200,86,214,22,24,107,231,180,37,177,238,8,50,111,170,197,68,138,68,87,114,160,69,200,165,96,149,240,22,44,185,126,116,89,36,25,124,119,129,180,115,152,201,173,38,66,106,182,219,196,67,194,20,160,239,133,108,129,201,45,48,29,162,218,45,146,75,226,70,75,64,221,216,248,138,1,184,154,109,251,167,224,29,228,227,4,205,51,156,215,106,210,87,12,76,175,87,154,149,242,65,168,25,84,215,165,194,157,194,58,224,143,195,2,22,192,33,90,135,224,19,176,20,85,21,41,38,84,218,122,49,179,150,48,83,113,61,71,136,254,248,54,0,52,113,225,204,202,55,240,110,201,180,84,142,180,88,205,78,186,197,76,172,96,146,200,160,134,200,64,47,138,136,41,24,89,99,238,196,201,50,243,211,29,132,225,218,64,6,52,225,159,102,176,44,215,152,99,207,81,203,106,116,224,59,98,19,152,216,124,204,194,132,44,147,20,30,54,198,136,138,98,108,3,197,215,205,25,44,34,48,148,205,57,15,194,197,28,159,96,81,106,222,92,99,179,155,23,70,139,49,69,51,176,141,14,109,184,20,213,40,95,215,60,130,198,230,151,105,198,121,108,1,51,87,123,80,56,50,54,178,145,224,65,131,136,135,13,97,8,175,68,28,147,166,194,198,144,41,154,55,68,33,55,205,172,147,34,35,165,243,228,254,42,208,64,174,155,105,178,228,25,82,55,131,5,2,245,37,62,23,33,207,14,212,195,0,136,6,105,6,135,225,70,106,48,27,134,194,24,25,187,97,72,17,250,17,46,177,23,208,171,109,3,240,194,57,7,51,174,21,243,37,123,131,138,73,126,122,202,192,166,233,181,65,81,36,23,56,197,184,154,68,104,207,121,207,143,122,78,207,131,159,230,46,176,146,43,74,175,62,218,105,68,225,146,15,175,96,201,58,107,245,176,109,132,144,17,33,205,63,61,175,182,141,9,107,238,108,123,24,165,29,138,54,103,138,38,229,47,11,152,209,147,181,51,226,197,18,68,129,109,77,131,58,59,228,247,116,83,235,41,205,51,103,208,56,123,251,229,237,251,43,118,241,225,199,147,110,105,121,27,143,48,150,58,4,7,2,184,200,50,128,143,122,20,35,102,168,208,149,94,253,1,215,62,249,12,131,144,20,126,132,122,48,63,5,175,72,160,246,145,103,212,176,223,99,229,154,103,227,20,198,81,24,115,71,248,66,243,48,118,164,51,235,71,225,52,118,230,224,248,68,176,46,83,28,12,8,240,87,206,140,163,125,119,204,158,245,239,102,47,244,80,29,51,28,171,23,138,109,133,63,138,184,38,187,132,170,116,10,135,213,192,47,109,82,228,60,154,242,6,219,96,49,242,3,195,205,18,243,71,191,130,224,205,180,57,112,5,179,163,193,186,187,43,224,228,216,91,225,10,132,127,111,133,55,28,44,225,48,197,49,177,234,129,126,211,136,161,230,53,144,62,41,112,105,46,171,62,185,111,137,37,221,245,179,12,38,159,241,114,140,203,157,59,247,211,22,39,149,209,34,45,2,171,62,232,144,246,166,4,95,2,132,23,100,241,94,67,230,53,40,149,162,117,143,1,72,203,150,137,65,61,225,71,55,226,241,20,214,187,238,83,6,189,101,33,207,217,211,110,135,45,161,24,5,70,124,93,51,10,137,82,73,132,122,214,27,66,9,173,93,52,95,160,160,212,238,184,158,162,83,4,53,96,34,164,51,38,132,133,26,175,113,9,69,0,67,44,254,23,243,87,97,206,196,55,44,30,17,108,106,42,188,134,26,240,107,144,63,68,110,104,124,66,93,27,34,211,90,51,230,0,148,54,235,170,174,158,178,86,200,190,103,158,97,154,141,104,197,183,170,63,133,247,46,98,253,130,117,187,236,149,159,73,164,203,54,235,173,54,240,123,214,74,13,184,224,50,76,57,106,125,218,40,0,219,47,252,21,45,192,130,167,180,6,188,204,64,45,184,24,47,111,221,11,166,31,83,21,176,74,90,95,193,61,167,74,33,34,140,77,216,111,191,1,210,128,57,1,163,94,0,51,236,8,188,78,140,36,180,130,188,189,215,69,157,175,255,108,245,26,209,56,46,210,148,103,99,63,231,15,209,178,3,50,24,8,220,21,159,67,67,31,176,5,174,0,212,130,245,7,179,122,125,164,162,73,74,147,148,251,5,232,120,139,165,220,89,13,123,58,232,6,42,213,222,24,120,114,31,63,93,126,31,193,90,13,171,227,70,107,148,39,247,52,72,173,158,18,69,49,225,66,51,20,34,39,26,106,68,182,242,78,123,108,237,129,138,93,23,173,176,189,97,171,62,70,109,242,239,1,250,134,173,251,101,129,185,117,112,218,115,15,74,163,145,190,107,203,176,161,106,6,224,18,250,40,18,167,13,175,227,217,250,132,44,160,21,118,173,58,112,250,118,228,239,250,48,93,221,48,220,218,48,131,96,80,25,181,51,254,234,10,250,158,182,194,239,189,182,25,8,251,89,235,18,131,25,177,224,195,170,134,15,25,152,221,128,11,81,189,34,170,225,121,180,110,161,242,184,94,221,60,133,73,211,197,14,129,7,130,120,175,47,39,15,214,155,213,213,203,86,167,125,45,88,72,194,120,237,199,228,157,215,113,193,236,25,245,202,67,216,176,122,218,223,28,247,122,53,100,127,203,241,123,3,26,57,2,211,63,123,159,128,69,68,38,94,135,141,103,97,20,192,10,252,173,88,52,77,136,84,6,50,250,91,147,168,198,88,46,67,18,123,3,164,219,241,221,48,158,148,193,11,25,169,197,237,201,145,159,135,185,115,125,208,67,198,76,51,152,39,70,200,68,78,79,48,118,104,126,130,41,210,55,88,190,211,206,105,156,105,174,224,62,33,175,6,41,105,89,163,209,2,165,213,108,182,221,60,141,194,162,213,116,155,66,172,238,180,88,177,147,212,80,79,125,134,99,117,71,210,169,198,7,140,108,197,236,125,195,244,147,31,198,85,239,60,8,167,194,55,127,3,15,150,199,61,241,163,156,155,206,57,240,74,250,241,88,193,174,28,131,70,49,235,102,211,17,213,252,52,29,89,245,238,193,55,56,102,48,121,136,161,244,132,49,77,120,216,152,205,35,244,67,160,249,5,15,246,226,84,9,4,168,32,0,124,43,186,249,58,239,18,202,205,90,239,221,118,218,137,34,225,179,43,216,128,3,129,219,9,28,42,232,248,130,142,45,164,73,94,236,140,45,224,186,84,0,177,208,18,204,24,143,17,253,196,17,224,151,112,190,36,95,240,157,30,21,127,240,195,136,118,143,219,12,29,39,3,81,24,194,253,136,226,24,35,166,191,15,73,108,165,176,220,180,55,123,131,10,146,85,45,29,49,160,1,212,68,25,212,40,58,182,130,20,138,138,142,144,73,17,22,170,11,158,136,146,112,194,90,143,105,120,219,74,181,52,155,123,151,246,58,229,130,106,39,159,31,99,112,124,190,18,171,250,52,11,3,250,133,225,201,28,10,112,123,69,191,10,45,53,80,234,231,201,61,10,78,105,12,151,171,117,67,248,118,13,240,51,16,73,112,240,116,209,134,253,239,255,188,110,160,83,125,69,85,166,73,18,208,235,185,25,148,75,40,104,39,253,110,244,155,109,31,188,12,202,213,109,235,9,239,192,140,255,195,186,25,128,94,139,166,172,68,95,16,32,130,158,154,134,79,63,190,98,23,111,223,128,105,128,201,10,184,144,160,55,15,83,100,34,157,166,11,124,23,251,112,249,50,132,17,219,161,13,231,5,50,151,60,67,101,205,148,254,129,74,134,216,232,110,164,176,148,93,169,29,61,80,33,173,52,19,27,124,173,123,215,117,241,69,78,27,10,141,157,199,69,235,174,141,106,180,135,70,191,196,45,94,204,71,176,6,160,103,6,214,13,252,245,193,202,233,15,135,13,150,70,128,211,12,84,52,207,128,92,152,138,173,158,3,5,109,123,33,221,137,164,100,255,3,209,148,243,249,143,35,250,35,2,250,157,168,142,232,203,3,49,21,122,230,143,35,250,10,181,212,54,158,150,207,254,23,201,46,172,97,97,193,10,114,73,21,31,80,153,88,242,251,134,62,212,10,240,126,196,64,1,160,191,29,131,78,216,131,99,3,190,34,46,20,84,55,145,181,140,36,25,250,105,208,186,67,62,37,3,167,14,204,70,14,22,124,32,18,132,48,45,234,167,36,6,245,0,110,3,198,46,121,28,84,81,173,241,3,190,173,211,60,91,167,245,109,157,246,216,113,158,220,147,7,188,33,196,78,149,10,75,147,16,220,110,80,60,142,179,205,37,114,156,102,43,167,63,168,238,155,253,17,46,105,25,23,220,186,154,1,147,198,136,26,114,203,143,217,229,151,31,89,56,167,77,131,41,143,81,191,2,243,48,77,96,134,142,214,90,243,81,195,33,78,139,37,2,61,183,181,204,61,11,133,165,128,91,6,58,129,173,150,213,117,102,149,218,177,193,177,92,228,229,214,49,24,155,91,86,176,88,177,105,133,165,104,237,231,247,47,191,188,60,191,120,249,234,226,45,198,45,127,56,255,116,121,245,245,213,135,15,184,63,209,124,255,225,234,235,235,15,63,253,116,126,117,245,246,13,126,40,95,110,174,91,8,223,205,169,79,154,169,109,246,119,54,184,41,205,2,152,0,33,70,176,205,122,103,172,247,173,29,90,49,116,24,115,47,253,96,123,32,255,10,63,215,218,83,174,19,106,85,155,85,221,92,91,6,189,198,153,24,6,76,103,32,54,111,106,39,181,168,250,250,211,235,131,62,214,20,188,250,135,224,213,56,27,31,244,203,109,16,239,144,98,184,113,215,111,238,131,117,25,254,202,183,64,97,168,226,33,141,127,128,151,25,8,164,95,152,32,116,140,153,96,161,90,3,138,230,169,138,53,215,134,154,237,158,246,59,6,219,34,44,246,28,171,62,130,144,100,220,44,130,7,123,247,238,30,140,189,251,205,205,183,77,114,156,99,19,217,75,87,72,227,67,236,114,236,81,153,229,187,141,65,209,115,18,143,147,249,60,196,184,150,88,220,234,186,22,85,154,98,243,110,231,174,158,44,16,221,88,93,100,124,148,36,181,93,4,252,46,28,243,46,180,224,15,133,143,5,56,200,31,65,77,133,57,215,84,99,80,53,89,20,45,209,199,189,226,41,152,215,44,195,95,192,244,3,218,109,176,81,163,124,131,241,237,94,250,85,37,11,67,69,150,5,14,180,105,206,247,16,74,229,24,146,210,227,88,195,174,5,229,193,2,20,37,106,173,228,182,195,48,169,83,132,250,218,210,131,32,115,62,185,213,182,60,57,122,214,6,211,31,226,147,220,107,218,23,248,83,166,253,55,22,203,131,134,220,190,177,181,190,54,65,94,139,93,7,166,24,46,150,167,6,169,3,88,73,241,207,117,239,102,179,47,59,130,54,19,203,96,136,92,24,43,185,82,175,133,168,23,184,34,170,190,204,132,56,53,25,202,37,212,218,242,47,102,96,204,125,78,97,133,15,115,12,135,7,37,110,106,173,56,61,101,148,11,71,9,64,148,231,177,195,246,216,201,139,143,96,87,134,201,34,223,203,12,79,51,99,139,198,79,74,160,193,132,217,67,168,18,105,69,170,69,40,22,64,147,96,155,82,207,164,180,87,71,105,205,58,164,23,200,149,181,15,103,47,144,204,74,210,217,181,33,246,71,23,76,134,97,55,152,136,56,215,10,224,193,110,11,86,181,60,176,17,19,50,70,241,46,83,208,170,169,235,134,17,38,134,69,84,160,9,169,7,214,29,133,49,134,20,105,104,196,164,167,177,17,143,10,4,166,148,52,44,117,36,202,27,204,31,143,121,10,22,30,194,233,184,139,201,174,16,155,64,214,76,145,220,150,26,161,161,133,150,170,72,10,21,109,108,9,145,74,163,94,212,235,58,120,75,138,145,130,241,57,172,70,73,102,119,66,122,113,83,77,219,25,91,240,153,200,139,220,105,98,194,218,252,159,40,167,237,0,71,213,22,47,13,112,61,233,108,139,187,214,147,183,253,119,157,161,36,167,143,31,131,205,13,43,64,70,243,58,155,211,254,43,26,232,121,129,169,0,152,94,138,86,182,193,48,13,42,153,128,52,130,233,163,125,196,250,72,194,254,254,199,224,8,140,56,43,109,231,14,251,252,94,155,202,44,201,152,126,113,217,249,132,197,73,169,19,109,132,253,59,63,140,80,73,128,245,78,46,134,97,158,187,15,193,145,49,13,154,124,149,31,63,159,51,20,112,0,93,206,21,156,38,196,180,28,28,186,28,123,26,207,22,241,45,122,35,226,129,212,157,225,179,144,36,99,118,78,158,131,157,167,54,182,101,229,100,50,129,149,176,35,118,177,203,78,200,242,196,78,124,209,31,46,185,199,26,100,205,28,252,135,0,116,250,223,223,17,164,211,127,125,71,71,47,254,93,37,219,20,213,63,83,216,106,198,87,228,182,177,57,7,151,47,14,243,57,112,98,18,198,60,103,7,228,164,41,147,34,7,110,249,5,201,88,225,103,224,194,85,56,39,14,34,133,243,52,226,115,224,219,49,155,79,191,2,137,95,71,124,26,130,69,214,81,239,203,12,112,7,163,21,185,38,63,193,0,181,218,191,115,224,63,189,189,188,130,57,78,40,2,222,1,120,184,57,218,174,12,1,174,86,43,232,1,139,48,69,212,199,220,111,69,45,124,160,185,224,26,34,36,103,77,207,145,27,206,82,62,178,112,58,69,168,26,69,76,195,24,207,24,240,21,229,185,92,40,53,40,201,202,5,9,16,246,27,84,22,229,223,73,228,137,175,143,130,96,198,180,157,156,140,139,96,134,91,129,141,178,1,147,233,133,120,74,41,63,238,118,231,50,176,225,46,243,238,146,131,214,247,179,188,219,56,251,103,130,199,195,22,25,120,238,156,51,89,112,210,245,207,128,61,26,22,122,233,1,47,96,174,2,25,124,149,70,190,200,249,128,89,54,2,115,144,165,9,76,20,76,163,152,216,146,132,26,9,67,4,211,144,231,229,84,128,209,214,178,33,52,65,192,231,201,94,177,175,205,45,151,201,163,85,231,73,37,149,138,141,19,249,178,119,239,4,135,231,19,207,23,81,33,218,232,215,125,173,246,184,93,10,3,74,136,124,184,99,98,160,251,45,15,76,99,49,191,165,64,27,96,113,75,209,197,187,42,32,218,44,253,48,250,5,96,184,168,206,166,184,33,213,97,43,240,34,175,111,111,142,217,221,6,157,26,102,120,16,52,73,106,188,16,77,85,110,164,121,62,104,135,67,181,148,27,41,15,229,133,30,6,228,70,173,151,168,183,37,116,7,214,206,132,220,86,74,166,31,82,33,173,167,236,250,186,215,97,205,55,194,50,109,222,0,59,61,120,127,155,101,73,70,111,125,120,67,23,152,94,14,176,42,31,45,166,205,155,155,111,251,50,85,67,65,216,15,243,160,98,46,84,227,44,123,226,62,101,96,239,255,215,190,85,194,179,199,192,149,249,149,67,51,189,188,180,115,43,33,35,202,193,215,163,137,153,248,42,21,208,60,207,185,97,9,218,115,101,69,233,45,84,98,146,86,141,57,207,115,74,41,27,71,160,218,160,76,204,69,91,122,104,226,82,6,228,230,209,238,80,246,219,152,18,193,46,18,76,71,87,177,108,37,88,152,202,2,138,159,220,153,50,182,45,39,95,171,105,148,54,219,187,247,106,182,59,133,222,216,5,174,208,59,186,140,176,108,71,135,84,102,116,199,35,152,227,96,216,7,65,18,95,240,9,216,246,61,112,158,77,47,236,113,61,57,137,152,29,226,160,143,156,42,155,125,88,191,162,115,19,96,23,212,113,106,164,11,107,240,46,11,155,91,187,28,132,248,39,74,201,104,252,125,63,219,164,156,190,247,205,125,7,141,129,48,66,190,162,53,85,131,130,81,90,226,176,107,71,109,4,162,61,47,148,31,71,187,46,14,122,127,48,157,28,220,28,56,51,156,21,203,255,64,25,221,88,94,138,248,162,206,70,160,142,45,15,72,116,207,254,19,107,207,8,243,211,196,230,81,20,166,57,24,193,86,214,84,93,224,255,91,97,255,151,192,212,44,228,197,26,253,5,233,237,194,90,15,235,122,154,113,71,24,133,120,160,135,113,212,51,104,7,6,2,28,153,123,134,9,82,36,211,41,76,170,145,60,146,141,185,224,120,160,130,9,97,197,144,125,186,192,208,13,143,2,113,100,157,178,245,208,66,200,100,98,155,182,26,80,58,114,87,169,40,53,216,132,148,222,197,65,131,222,7,46,196,83,179,101,101,69,214,251,13,29,105,196,9,181,158,151,48,113,249,98,137,88,51,13,64,175,113,44,209,156,147,251,29,180,80,202,99,146,226,0,126,117,153,52,26,87,54,57,118,155,53,120,196,69,156,112,169,26,54,105,150,220,133,57,212,145,185,26,31,203,119,59,229,67,230,19,80,72,15,106,230,33,46,208,176,56,135,233,221,0,159,172,204,143,28,188,57,161,251,4,212,203,242,253,27,217,41,0,87,26,89,248,180,231,144,137,24,109,30,96,61,105,149,149,31,246,90,102,232,129,45,65,218,229,17,21,241,98,181,104,54,205,250,240,39,6,200,116,155,0,180,120,173,95,247,146,82,136,168,230,39,60,54,40,47,52,80,152,232,58,23,201,248,22,167,246,159,123,77,0,230,132,129,6,76,208,114,183,50,3,251,3,248,81,89,120,167,13,233,129,82,62,130,58,147,47,51,244,208,236,31,251,233,105,131,212,65,195,252,252,75,130,27,199,246,119,145,253,214,232,171,35,252,204,27,222,245,231,206,33,27,204,188,190,223,103,125,232,188,215,235,59,253,59,231,80,191,58,240,254,206,124,101,253,187,242,21,254,254,58,247,122,142,215,251,114,228,15,216,64,212,121,198,122,119,131,217,179,95,233,160,181,58,96,173,184,9,211,240,18,76,81,63,146,44,109,101,32,77,70,126,11,90,117,248,137,157,49,231,160,87,154,117,118,106,88,243,197,86,229,195,250,202,195,218,202,71,195,74,101,153,179,89,95,251,121,21,116,66,137,137,70,109,171,52,3,205,172,138,204,83,23,100,81,27,83,87,59,16,247,38,12,51,163,8,79,179,117,141,201,223,84,14,242,158,51,82,162,136,54,95,53,104,252,87,201,206,109,154,136,96,237,99,80,19,248,87,159,111,98,21,77,163,181,11,165,101,219,42,137,20,13,125,207,105,166,11,125,67,31,240,113,83,30,154,18,251,3,21,166,160,230,121,32,55,80,105,213,177,161,36,212,162,18,12,193,20,222,185,84,234,72,100,102,80,40,123,81,60,44,177,252,6,51,109,78,98,30,199,62,38,146,150,20,80,126,251,77,109,164,25,220,48,100,68,40,76,108,64,137,218,240,215,224,73,117,8,149,50,101,151,151,231,111,176,107,170,47,128,87,116,109,203,46,82,10,85,41,81,19,5,169,73,43,227,97,233,212,22,158,49,151,208,182,70,72,182,55,206,3,86,78,3,202,175,187,82,226,72,150,204,133,67,202,148,90,17,212,232,84,6,201,68,118,27,225,82,241,151,163,98,178,71,47,63,165,228,87,88,100,119,9,142,11,80,205,209,123,172,151,12,42,106,53,37,10,140,94,113,136,232,193,238,233,47,64,115,107,76,253,120,204,163,189,67,106,118,189,167,219,157,194,83,159,174,88,213,121,101,218,98,53,235,176,85,89,4,12,235,164,173,249,43,168,73,147,168,74,139,238,11,85,73,171,93,47,18,123,0,139,127,165,57,224,170,200,239,169,185,249,137,29,119,216,16,247,57,95,24,13,75,35,218,80,116,234,1,219,40,205,178,97,28,152,172,59,213,170,193,80,9,123,88,191,49,21,163,77,27,210,181,141,188,73,222,56,226,126,166,232,168,169,90,210,83,203,4,68,67,147,246,72,19,136,3,105,240,83,6,168,254,178,3,117,100,102,41,81,114,69,106,143,138,41,212,71,70,190,125,20,78,37,155,215,29,185,179,14,200,157,209,17,116,3,1,35,205,78,214,32,61,92,197,18,70,113,179,93,245,252,227,151,65,181,42,45,149,117,7,238,126,222,16,241,143,255,108,234,209,82,249,29,180,131,131,25,39,197,14,22,216,200,254,185,71,31,141,124,57,141,204,152,60,37,121,5,5,117,174,115,229,182,195,6,168,21,140,120,65,41,177,86,186,226,165,249,189,38,148,163,73,180,64,152,99,80,73,14,84,120,47,34,125,18,98,43,73,23,96,161,14,160,131,8,57,173,251,53,71,125,172,204,133,234,185,80,139,153,120,191,143,56,193,93,77,157,52,182,245,30,122,154,99,187,238,86,124,79,87,178,175,99,208,215,153,12,24,94,92,243,228,222,178,251,137,80,151,44,255,77,229,68,163,96,201,99,170,16,230,120,69,137,193,97,186,20,67,120,99,186,11,127,4,235,237,2,166,130,131,7,223,61,230,136,171,61,60,182,4,14,204,212,85,44,250,200,171,8,6,90,152,119,173,45,177,42,197,243,200,218,17,173,97,31,138,183,56,2,142,199,69,114,101,177,108,234,0,87,63,109,127,144,97,133,50,128,164,2,155,202,48,20,166,156,166,31,71,218,21,39,247,81,89,210,206,208,176,39,207,210,136,168,145,22,0,177,178,156,116,69,31,230,1,209,40,220,62,136,180,136,44,161,151,74,200,180,204,30,32,250,164,22,101,147,227,74,243,45,54,81,160,210,40,223,18,0,165,146,68,244,72,76,81,101,23,150,243,91,125,193,48,28,213,196,115,223,50,58,172,141,23,238,138,29,76,151,90,1,63,173,204,234,143,26,168,10,193,137,185,148,150,55,105,205,11,227,116,146,148,169,173,105,37,242,62,168,170,214,167,91,35,44,45,102,43,111,166,140,103,212,141,52,252,161,11,137,164,135,91,51,216,250,142,43,19,20,94,138,84,154,124,174,235,210,21,72,242,11,230,50,218,130,81,131,41,217,145,187,49,146,174,111,173,240,189,166,182,118,31,122,236,77,41,43,159,69,128,76,24,125,47,211,212,204,109,171,68,200,112,91,93,197,126,46,196,179,21,248,209,14,139,172,47,110,165,226,197,231,44,178,131,74,93,43,170,164,111,127,251,12,15,123,162,79,185,117,57,156,117,53,90,29,26,143,140,29,42,220,69,173,59,77,36,138,154,149,36,77,196,3,251,54,15,79,225,93,154,0,130,170,60,206,220,228,22,134,185,100,131,52,236,113,10,169,246,100,83,194,200,43,183,119,219,155,86,53,51,23,57,80,198,22,38,33,104,240,104,173,43,217,125,212,159,91,170,16,21,198,138,38,122,105,151,251,154,104,196,202,113,52,183,243,200,239,69,134,178,81,228,199,183,116,115,10,6,98,195,56,44,66,63,162,164,15,217,250,49,97,91,189,39,131,46,27,221,8,62,209,117,4,145,254,144,200,115,64,116,213,18,17,105,239,51,232,123,145,196,141,165,114,147,93,31,39,186,74,4,84,186,38,240,152,249,193,60,140,187,244,91,92,28,232,117,233,183,120,233,211,11,169,140,159,233,24,55,229,199,208,248,137,155,225,196,53,105,114,60,243,49,78,238,253,214,116,24,59,51,71,84,100,250,174,51,79,158,216,68,43,72,222,80,104,222,47,132,93,156,90,23,12,150,215,100,136,187,15,55,82,42,141,235,223,16,241,83,121,103,157,121,247,97,21,144,45,249,210,168,218,238,201,160,225,207,184,234,144,112,23,247,207,162,198,127,61,195,224,156,121,81,33,76,242,22,191,115,129,126,80,243,179,16,115,165,240,144,240,59,241,228,2,3,129,113,239,96,168,229,151,22,84,51,246,160,240,44,231,6,19,98,252,69,68,215,170,100,120,212,167,102,151,42,135,69,196,199,24,107,110,236,239,148,181,202,248,190,170,39,110,171,50,235,216,217,225,170,158,186,121,202,172,41,238,62,82,53,212,77,82,251,207,81,44,195,56,72,150,110,18,203,76,97,49,65,197,45,191,173,89,11,84,44,76,199,32,25,47,112,55,199,197,0,13,204,204,255,3,4,253,104,92,112,88,0,0,0};
+static const unsigned char v4[] = {31,139,8,0,0,0,0,0,2,3,237,125,107,115,219,70,182,224,119,253,138,19,150,54,36,199,236,22,186,241,150,68,165,28,207,77,57,85,246,108,42,78,244,37,155,93,131,32,40,98,132,7,47,0,82,146,53,252,239,91,231,116,227,73,74,118,50,190,179,183,180,83,149,64,64,163,159,231,253,2,61,222,150,17,148,85,17,135,213,248,226,36,78,55,121,81,193,35,172,103,80,68,217,50,42,102,176,45,163,15,85,80,69,116,247,31,171,85,20,86,116,251,115,180,154,193,186,74,147,25,252,156,111,171,168,128,61,172,138,60,5,24,243,179,197,54,91,38,17,95,44,92,225,57,94,200,255,94,142,47,78,78,206,206,224,109,148,108,162,2,86,219,44,172,226,60,131,106,29,84,80,68,213,182,200,74,8,96,83,228,105,92,70,117,115,153,39,187,168,132,96,133,211,47,163,36,120,56,9,243,172,172,224,175,120,15,115,152,164,229,12,118,65,50,133,249,21,100,209,29,252,164,38,152,232,177,216,92,70,213,47,113,26,229,219,170,110,157,65,61,108,122,113,114,18,221,211,161,213,196,63,226,31,152,195,227,9,192,58,10,138,234,28,247,180,41,113,34,60,236,199,203,114,119,3,97,18,148,229,252,244,145,94,113,122,218,195,125,154,100,229,124,180,174,170,205,249,217,217,221,221,29,191,51,121,94,220,156,73,195,48,206,202,221,205,8,86,113,146,204,71,89,158,69,35,216,197,209,221,247,249,253,124,100,128,1,210,2,105,141,174,46,55,65,181,70,116,228,183,17,75,226,44,10,131,205,124,84,228,219,108,57,234,54,255,61,143,179,97,251,93,188,172,214,243,145,28,193,114,62,122,111,113,83,120,224,224,53,176,184,13,248,191,1,134,97,96,155,99,189,19,18,164,129,119,137,203,29,79,50,186,246,122,50,234,200,154,238,46,119,76,39,97,2,167,84,215,35,221,193,248,52,186,186,60,195,99,92,93,226,153,175,62,206,78,0,150,249,93,246,186,40,114,60,240,191,18,160,3,216,8,110,215,77,243,81,184,45,138,40,171,222,228,73,94,140,174,224,79,129,30,33,237,131,199,165,253,214,229,118,32,185,180,129,46,4,145,230,113,231,15,94,53,79,235,99,111,104,224,142,249,199,230,163,203,91,97,191,247,65,200,196,4,51,53,192,72,76,102,166,204,4,243,26,223,142,224,236,10,58,192,223,110,254,13,250,175,9,250,212,96,102,194,16,228,8,122,4,123,106,50,243,90,28,0,62,204,111,94,28,196,185,237,91,96,114,223,10,185,225,51,110,91,146,219,14,227,190,5,130,11,129,55,107,201,109,223,12,185,141,160,19,220,144,220,244,61,122,203,125,43,225,82,152,32,184,244,68,200,13,199,228,166,139,146,202,228,142,231,112,199,178,185,231,114,195,181,184,97,113,97,185,220,240,76,46,37,23,210,229,166,180,184,240,29,238,34,22,92,156,216,181,185,144,86,34,184,20,46,227,150,237,4,130,11,105,131,186,26,96,8,193,77,151,91,62,118,241,29,196,166,229,30,244,97,92,58,32,184,101,10,148,109,134,97,114,79,186,33,227,210,55,185,180,24,183,76,143,59,194,196,27,193,125,95,6,14,119,109,31,212,21,39,48,128,75,219,14,25,55,12,151,155,174,199,133,233,113,215,230,150,201,125,92,218,48,108,238,73,47,228,150,180,184,105,115,219,180,184,111,91,245,178,184,170,244,189,167,118,39,184,233,248,220,242,105,119,245,65,67,198,77,219,102,92,152,38,227,174,205,184,225,74,220,188,235,32,68,2,135,219,46,208,69,31,16,33,232,225,32,83,112,225,153,140,219,158,224,150,111,51,238,88,22,247,28,63,97,13,94,240,32,62,183,45,236,229,112,223,194,45,16,234,196,154,33,102,173,144,17,106,113,61,201,16,183,172,198,188,154,133,41,236,50,110,56,248,222,181,24,55,133,100,136,97,90,143,113,207,197,45,74,160,75,189,69,134,88,198,61,74,60,152,239,48,238,74,134,168,86,7,99,132,107,5,131,163,184,86,144,98,136,110,130,168,203,142,67,148,75,135,41,116,35,106,112,55,210,13,185,244,113,49,139,91,166,203,16,221,28,207,175,176,237,155,184,83,188,18,182,25,97,27,145,141,135,243,16,9,158,66,130,26,162,168,136,230,245,142,18,27,173,158,60,183,69,36,91,70,56,199,227,58,132,113,110,218,14,226,155,187,54,194,67,66,11,21,194,62,55,44,100,25,135,113,195,115,53,56,61,110,154,120,227,153,220,246,36,206,104,107,4,56,62,50,162,165,80,245,73,201,173,63,43,18,132,13,66,6,38,152,200,238,130,57,96,128,122,48,132,131,230,192,64,40,150,81,85,197,217,77,249,246,165,137,70,97,112,27,156,181,207,93,91,223,7,130,35,90,109,5,24,19,140,212,4,163,219,104,96,227,123,196,41,56,168,197,82,19,132,164,25,82,134,215,94,111,227,216,20,6,77,145,50,154,195,160,57,124,230,172,77,154,194,252,67,83,168,5,105,245,167,112,118,253,210,112,230,128,48,185,125,77,224,50,0,143,222,131,150,129,230,21,51,123,192,162,54,192,17,215,194,225,118,42,36,51,255,169,9,152,195,252,122,2,243,203,39,240,105,2,131,31,34,43,12,178,151,134,39,151,219,4,155,183,206,235,190,97,166,120,103,39,184,253,30,129,169,58,9,175,223,75,72,3,239,168,27,66,238,250,160,131,240,128,250,172,25,118,97,62,24,195,149,4,173,36,188,29,163,181,190,88,230,129,242,127,162,242,182,202,55,47,207,254,22,46,218,203,168,241,220,160,134,0,42,120,31,208,230,144,239,16,113,82,172,209,192,112,164,160,203,235,186,31,2,17,237,119,247,154,102,73,29,38,228,181,24,152,242,162,53,229,223,218,92,218,67,172,128,176,175,177,61,21,30,24,3,226,16,104,135,129,121,100,156,97,66,51,232,90,200,63,186,164,164,37,135,140,23,36,209,191,54,92,240,47,209,106,22,247,208,220,70,91,92,6,210,228,158,229,129,254,131,128,180,185,101,91,20,14,120,237,113,223,113,65,93,53,83,161,144,218,49,238,94,251,175,29,112,104,128,3,254,14,165,220,176,55,147,104,38,130,195,13,41,67,193,93,211,228,14,122,26,54,154,201,134,103,3,174,132,66,208,20,169,205,93,97,129,17,72,11,141,49,208,127,104,22,253,170,233,210,240,168,110,120,111,162,201,4,46,183,105,191,62,168,43,142,181,209,10,4,51,69,235,15,217,56,24,118,144,92,56,30,6,60,134,152,95,68,73,242,111,196,255,127,136,248,34,90,21,81,185,126,113,184,71,100,152,224,115,211,242,214,22,250,65,59,116,111,197,123,201,125,207,6,225,163,27,177,99,244,6,131,32,170,79,74,13,38,134,163,184,240,4,224,213,12,80,194,83,152,70,137,100,147,123,134,137,150,233,123,139,27,166,0,159,123,142,221,239,36,218,78,157,153,100,106,208,252,98,135,215,3,13,187,8,138,210,122,105,120,32,155,3,85,205,90,89,138,100,226,88,252,75,30,15,68,84,80,148,230,139,132,15,70,98,232,200,234,81,200,46,56,26,224,13,225,145,228,55,249,246,229,105,107,73,32,176,147,54,58,201,204,212,4,115,205,92,110,191,151,2,205,86,31,124,37,25,209,250,1,245,68,66,251,136,179,30,236,162,23,40,220,236,214,253,194,204,134,64,53,130,154,1,176,69,249,98,232,2,60,237,71,200,39,252,135,167,188,134,235,97,187,67,59,88,163,183,225,131,177,102,254,16,242,81,26,196,47,206,166,144,162,102,216,29,122,174,79,154,221,107,118,220,13,160,203,53,142,79,133,143,222,240,208,224,247,181,4,60,24,223,201,8,232,161,59,46,45,115,184,8,6,213,64,112,95,56,9,50,12,88,220,57,182,19,211,1,227,157,201,77,137,54,130,56,54,9,163,73,104,171,7,152,189,223,4,217,242,69,138,98,188,236,44,116,178,25,98,1,239,24,229,7,223,249,224,171,46,196,38,104,58,160,39,126,208,73,216,239,21,143,17,119,80,47,122,213,78,250,78,216,224,167,40,214,65,8,34,149,182,83,59,43,246,58,204,199,148,235,34,206,110,95,158,19,238,95,91,28,19,130,254,91,253,247,93,131,13,116,209,9,37,116,243,182,190,73,24,65,16,47,24,203,240,17,11,116,115,93,223,36,248,142,213,29,132,93,247,16,29,4,39,205,36,67,72,231,127,0,202,95,11,132,16,20,113,192,214,241,114,25,101,243,81,85,108,163,127,50,180,129,186,244,29,17,25,208,193,201,169,249,227,58,116,245,2,5,57,197,138,241,146,232,18,0,77,16,76,63,254,113,40,109,55,73,30,188,60,169,72,22,197,78,30,6,160,136,117,164,88,99,252,121,240,10,97,231,181,225,97,236,193,124,180,83,148,73,87,131,24,27,118,248,242,48,218,152,223,101,255,134,230,49,104,42,227,79,72,178,250,28,210,22,6,197,40,133,76,53,92,175,205,67,223,50,79,170,23,169,175,17,92,9,90,98,140,196,28,65,197,224,246,26,61,241,119,196,227,202,98,195,118,147,219,111,113,208,1,231,174,243,244,197,249,8,68,61,66,38,30,102,234,25,94,237,144,91,84,13,224,99,162,214,150,245,173,237,11,48,222,213,96,122,143,68,228,107,251,86,72,59,52,0,67,222,220,54,44,232,102,121,233,250,86,5,201,44,238,185,118,104,176,186,35,235,116,81,247,107,220,78,136,239,169,162,66,72,123,56,225,181,20,107,139,22,236,246,98,109,55,53,209,53,105,48,79,51,139,215,87,220,138,214,147,23,104,33,9,147,11,12,231,57,94,175,100,13,105,222,194,186,54,105,89,141,230,234,117,232,150,192,37,136,98,180,235,93,219,197,72,161,137,213,19,82,118,155,159,44,159,59,58,187,209,89,254,0,13,229,58,142,146,229,11,204,23,29,53,170,82,102,50,151,27,166,243,26,43,77,108,31,244,31,229,65,219,190,7,14,53,249,250,170,50,56,62,119,45,63,52,192,230,54,134,111,185,39,45,20,95,18,237,12,33,184,35,49,201,35,92,44,184,48,77,9,62,115,56,142,98,244,78,82,5,139,137,21,25,232,209,217,174,96,184,16,229,204,197,154,33,139,135,12,233,198,1,68,37,122,117,210,242,24,242,12,51,185,244,236,79,71,67,144,168,122,95,158,218,165,160,34,6,73,222,155,224,171,10,7,147,52,130,170,85,176,184,141,4,190,19,82,199,156,176,28,134,188,15,74,236,129,20,239,80,11,187,199,228,77,128,165,137,47,17,106,66,2,193,132,108,140,4,3,1,204,33,144,72,140,159,219,9,107,154,142,195,100,187,121,129,16,193,147,239,152,134,9,29,30,106,160,160,251,208,52,12,109,140,187,160,120,137,4,226,239,76,93,235,99,26,38,96,49,36,150,246,121,14,102,190,108,172,116,163,54,84,225,190,229,169,123,228,67,87,80,158,12,119,203,61,42,184,243,234,78,140,58,189,19,88,161,233,211,8,79,205,136,101,11,204,228,134,41,245,157,231,123,104,184,112,199,119,209,20,22,210,249,68,24,178,49,242,130,249,252,29,55,12,239,173,80,169,31,239,192,236,139,179,85,254,226,80,34,154,184,82,194,13,75,48,110,200,0,107,57,221,218,96,192,146,85,207,150,9,227,174,129,53,155,158,233,116,58,24,117,7,179,25,46,62,239,10,167,204,39,105,137,80,247,106,168,95,163,166,249,116,24,59,12,147,32,13,240,203,137,95,138,56,200,110,146,232,223,108,241,223,138,45,170,245,54,93,252,250,226,100,183,195,29,211,36,231,48,228,158,225,144,135,97,99,245,177,101,97,97,181,97,82,216,219,11,124,164,123,80,87,149,57,247,28,180,175,172,144,187,210,100,220,244,16,35,104,59,251,148,223,119,108,196,147,43,208,50,182,124,204,177,227,21,89,137,155,18,113,226,184,242,218,236,242,32,149,218,186,195,162,156,58,247,25,26,181,123,38,85,193,55,22,72,75,36,34,41,60,108,116,184,109,123,92,80,152,95,122,146,187,228,66,73,79,174,177,62,192,9,177,170,89,29,207,183,108,238,248,22,158,206,198,77,187,194,230,134,101,115,75,74,110,56,30,247,108,252,67,131,237,128,12,86,101,182,214,73,2,199,242,49,167,36,177,20,218,244,60,110,97,9,174,239,185,220,149,62,30,204,176,241,238,45,22,29,32,49,90,158,9,6,227,190,99,97,57,55,22,85,91,8,48,137,159,26,112,65,181,186,134,133,254,131,33,64,93,201,203,104,186,189,181,185,111,88,239,85,46,203,39,151,241,61,53,169,240,71,168,106,233,13,180,136,77,110,97,196,196,229,142,33,185,240,93,174,150,68,218,103,220,150,196,4,107,198,125,131,152,196,243,201,84,118,177,6,222,166,79,127,124,170,54,55,29,47,64,206,168,75,184,109,41,152,201,109,195,13,177,187,109,155,92,250,138,183,28,238,153,130,89,88,43,254,198,228,166,231,146,153,110,160,93,41,28,151,60,0,80,142,192,90,112,195,54,67,110,185,56,43,119,45,155,219,182,195,109,238,59,88,148,97,123,160,174,250,232,166,129,118,131,227,104,180,251,22,151,166,4,201,77,172,33,177,45,98,244,67,33,186,8,194,219,187,160,88,190,188,236,26,74,44,79,8,140,58,120,72,71,62,242,44,34,27,233,205,51,185,239,186,152,215,18,134,199,44,44,207,63,168,60,71,160,250,182,153,116,250,188,30,246,145,66,185,210,59,143,11,105,126,170,149,230,215,89,249,157,207,109,199,5,151,187,226,72,89,188,158,73,175,124,240,185,205,58,126,113,114,151,98,53,38,213,183,98,216,128,62,119,50,169,108,145,74,85,169,81,200,110,83,202,132,46,131,237,246,163,121,208,250,190,150,66,71,142,41,250,41,176,33,37,135,77,120,189,54,134,66,202,94,31,230,105,141,126,38,246,233,47,165,156,3,49,109,224,118,159,72,255,182,31,102,125,74,105,59,114,237,239,252,53,243,119,204,63,68,117,144,70,69,240,242,148,172,39,241,195,29,65,112,51,5,208,69,85,168,9,207,193,80,145,73,202,4,53,18,42,65,151,11,129,162,88,152,22,14,122,35,185,239,147,210,241,20,88,61,20,199,234,214,231,182,107,93,11,239,201,175,225,196,97,224,92,215,46,208,80,18,234,134,227,210,167,46,24,132,65,133,228,25,146,97,109,156,31,88,46,214,113,129,254,163,197,179,48,45,134,251,130,254,97,80,36,144,58,179,237,4,63,147,33,101,34,156,0,117,17,74,111,188,234,25,92,19,45,52,195,244,193,242,184,235,90,245,31,122,109,147,180,55,224,248,56,160,113,180,128,160,226,65,231,159,253,206,69,165,14,144,228,219,40,158,16,88,44,14,221,160,161,15,198,167,247,170,244,152,130,233,141,85,191,38,139,145,106,246,15,8,154,92,254,242,37,150,237,75,241,206,28,230,90,116,38,135,210,53,169,65,25,46,140,16,185,186,147,134,244,123,213,132,31,181,12,193,181,204,195,23,231,247,96,85,10,89,111,59,52,30,165,29,144,245,162,108,24,253,153,14,222,170,43,73,245,3,213,140,128,4,23,31,233,51,133,103,103,120,139,42,33,85,220,254,214,198,5,67,166,146,7,172,73,49,116,83,17,59,138,223,61,155,208,88,19,119,124,38,5,65,230,130,118,135,13,131,249,90,186,119,131,61,241,42,254,127,128,221,97,57,193,193,103,245,127,12,169,250,91,126,68,45,137,13,27,157,4,16,36,2,65,32,166,13,15,140,209,89,167,31,218,242,224,7,194,1,225,232,110,82,112,188,239,117,243,184,77,252,35,68,160,107,171,65,224,23,138,182,234,135,27,129,123,49,31,9,57,130,7,49,31,73,99,4,247,18,159,185,33,70,240,32,169,169,3,242,253,240,71,16,170,120,67,64,168,127,8,225,166,136,162,236,28,198,139,27,70,183,76,24,6,84,209,125,165,31,125,195,128,34,206,234,183,166,97,140,17,145,15,81,146,228,119,106,156,186,111,7,234,231,102,164,126,174,135,22,209,82,141,43,162,101,59,8,31,154,17,248,160,186,119,246,223,252,174,196,247,219,170,202,179,201,99,21,87,73,52,131,60,11,147,56,188,157,193,50,46,131,69,18,45,103,16,38,229,12,226,48,207,240,167,46,86,51,8,233,196,51,88,231,187,168,160,135,182,55,61,238,167,4,12,5,162,223,202,77,156,205,240,203,184,15,155,56,251,29,230,205,239,100,76,86,65,82,70,211,139,166,107,184,128,121,179,177,73,180,83,211,212,111,139,8,161,172,247,7,223,213,119,147,41,156,67,182,77,146,11,234,27,175,0,127,188,2,190,253,22,170,135,77,148,171,71,30,6,85,184,158,194,124,62,135,113,189,194,184,158,31,234,221,77,176,24,102,122,161,27,155,113,147,9,253,106,134,218,46,175,214,81,166,91,234,97,234,141,30,184,63,1,216,227,45,110,229,27,5,172,169,6,26,204,9,87,139,100,27,49,199,48,20,8,207,235,22,219,48,26,64,54,141,150,97,140,47,8,209,248,211,31,138,201,79,46,23,132,53,58,226,124,164,30,70,154,237,71,113,134,148,205,86,73,116,15,127,223,150,85,188,122,96,97,148,225,47,131,196,85,148,150,245,195,77,176,97,18,136,9,163,37,108,238,49,187,3,155,7,20,136,138,138,202,20,86,121,86,177,50,74,227,69,158,44,85,235,221,58,174,34,40,215,193,50,191,195,46,167,143,234,108,123,188,75,202,253,72,149,251,207,79,31,139,104,181,175,209,52,63,125,12,23,251,230,120,243,211,199,250,22,254,241,15,64,26,217,195,213,9,192,169,34,68,4,226,229,233,35,182,195,119,234,183,70,184,254,134,0,206,137,24,247,245,113,239,152,5,77,207,113,144,197,105,80,69,12,159,199,112,14,227,241,30,165,230,201,229,217,217,213,199,163,12,240,183,188,138,87,113,72,177,194,201,99,126,59,163,99,34,217,231,101,212,35,101,106,89,84,153,162,225,159,163,213,4,233,174,67,192,244,171,46,115,24,87,69,144,149,9,110,227,129,73,200,55,65,24,87,15,204,128,50,61,239,190,26,52,220,51,57,110,231,170,242,225,76,70,51,19,242,249,96,168,209,25,250,91,85,16,195,253,82,244,217,173,200,83,218,108,243,243,52,147,134,217,106,86,160,81,147,42,159,94,64,243,172,127,18,38,218,33,201,55,48,248,246,219,230,158,107,125,192,21,107,62,249,102,50,157,129,176,13,131,54,177,159,193,111,191,119,96,135,116,146,151,17,204,65,45,244,168,247,162,118,221,221,8,245,155,129,137,19,41,78,235,243,198,50,222,169,18,183,36,222,69,243,81,80,150,81,81,197,187,168,97,144,79,76,24,176,201,99,228,2,22,237,162,172,42,25,42,61,8,22,101,158,108,171,8,226,172,140,42,102,0,241,144,98,154,40,35,30,177,144,67,28,132,190,106,46,171,160,168,240,113,195,156,17,18,48,45,175,23,162,225,119,108,181,77,18,154,138,133,121,210,231,193,114,19,132,136,91,171,157,49,66,157,72,192,239,78,53,216,110,176,173,242,122,230,52,184,103,196,137,40,76,86,168,28,84,109,95,205,218,44,185,129,197,77,159,111,147,27,165,27,132,250,179,72,130,240,86,221,214,52,102,3,145,215,42,47,82,136,130,50,98,249,182,130,229,182,32,62,65,125,162,222,199,196,67,167,143,85,177,215,187,30,236,155,89,77,251,17,224,116,128,216,233,118,216,145,169,146,84,102,244,122,145,140,200,111,27,9,145,223,194,185,190,197,98,194,70,68,172,153,3,119,204,1,221,121,220,209,200,40,94,81,76,52,106,19,27,148,200,232,172,114,118,246,212,230,82,252,93,147,59,77,42,76,192,166,98,248,169,241,96,151,155,186,123,79,174,166,209,50,222,166,181,125,16,60,160,202,30,93,157,62,98,195,254,242,108,243,212,36,26,189,105,197,68,35,168,219,73,108,156,228,117,246,128,4,125,23,87,107,8,168,86,5,194,32,131,44,191,35,195,14,170,117,92,162,185,23,241,193,58,207,31,213,82,28,241,44,70,142,170,38,165,16,106,177,208,213,10,154,239,247,199,180,87,77,192,233,178,37,224,246,160,86,163,64,123,135,135,85,30,110,203,243,124,91,209,68,100,205,246,183,8,112,89,110,130,172,94,177,44,88,158,37,15,163,171,55,184,145,203,51,124,119,56,160,49,171,71,107,102,195,29,179,135,38,50,254,87,155,208,159,173,183,29,76,15,208,90,173,14,151,30,214,10,119,19,106,42,166,128,158,186,243,206,163,223,144,81,213,3,88,205,225,118,58,10,163,237,39,208,233,230,134,147,60,217,143,169,126,106,136,65,253,88,191,159,94,152,213,19,210,218,205,6,63,13,216,228,8,253,28,18,84,247,177,243,208,220,234,27,250,67,74,251,226,168,214,126,151,223,196,217,228,49,193,63,63,100,51,250,76,233,71,178,81,181,33,91,197,155,95,144,143,122,182,232,182,140,148,106,252,181,140,250,202,113,60,238,232,162,223,54,65,89,82,191,159,130,178,124,186,95,158,149,219,69,26,87,207,153,173,193,182,90,175,151,5,42,243,239,131,50,14,97,12,175,96,81,229,193,4,55,3,175,96,124,142,45,184,162,54,32,213,184,117,20,44,35,229,88,188,222,86,235,188,136,63,145,232,61,175,103,220,171,222,90,247,173,34,52,84,199,69,84,86,103,4,148,241,12,30,245,28,123,109,180,106,96,77,249,42,206,130,36,121,152,20,218,136,197,83,226,201,148,98,62,174,81,27,226,111,180,89,95,147,13,44,205,197,13,83,166,137,52,140,3,189,184,200,139,101,84,52,166,103,195,219,119,204,119,96,195,236,35,250,47,69,141,180,65,115,234,179,75,163,93,123,223,81,59,151,167,143,53,117,116,52,130,144,181,67,26,62,4,25,89,227,250,89,116,200,250,114,45,26,53,132,34,187,53,131,239,19,18,213,72,108,104,193,142,137,32,199,251,33,29,31,156,194,108,247,149,4,139,40,105,96,146,228,225,109,35,206,211,5,19,176,12,138,219,243,214,230,30,93,33,213,102,65,26,93,158,209,208,102,162,56,219,108,43,45,113,177,255,8,105,36,15,243,116,147,68,85,235,175,51,164,56,148,197,255,185,141,139,104,217,176,97,247,128,89,94,164,65,210,162,164,193,145,66,153,250,163,100,45,218,0,218,4,105,166,170,181,224,3,106,65,242,41,250,234,13,54,73,16,70,235,60,89,246,196,182,101,24,237,20,7,226,155,108,93,13,152,50,61,79,162,96,137,150,138,211,58,75,225,182,40,243,130,101,121,197,2,116,143,59,135,235,58,84,180,150,232,122,89,125,181,217,12,202,51,2,233,252,244,81,25,163,90,98,76,162,29,175,130,226,38,170,248,46,72,182,209,116,15,244,119,126,250,136,160,221,3,252,23,34,31,153,244,46,47,150,207,33,127,163,251,60,69,0,237,251,255,2,34,248,243,184,255,74,56,255,106,184,38,121,120,128,235,102,68,141,243,13,197,213,242,44,92,7,217,77,68,182,140,210,7,251,231,233,160,98,110,87,56,169,8,204,94,41,174,249,232,67,124,147,193,143,217,136,188,220,249,233,163,178,103,213,103,184,125,195,169,94,44,76,6,190,70,95,32,142,62,183,155,218,221,39,121,109,213,49,164,251,82,9,56,165,70,191,80,45,147,197,19,45,39,143,42,94,164,61,105,21,31,168,53,49,5,66,254,241,15,21,10,81,139,54,129,43,245,232,31,141,121,116,109,182,174,149,120,16,212,16,42,142,81,219,225,167,180,25,116,75,85,132,84,61,119,226,7,54,172,25,69,206,63,82,216,225,200,58,138,63,187,70,123,199,52,37,74,199,184,73,13,183,158,107,69,174,100,27,36,233,216,247,207,67,18,205,141,38,42,167,224,168,113,65,55,181,173,163,227,143,3,32,63,169,190,91,243,29,93,209,134,193,53,99,183,65,157,250,120,247,137,18,68,13,166,144,143,85,75,71,8,120,71,116,124,227,140,146,171,122,204,21,173,189,105,9,71,244,253,113,204,222,51,217,114,206,129,83,85,21,219,44,12,122,62,130,242,7,26,180,141,174,154,0,19,52,142,207,83,108,33,224,11,54,177,54,123,187,184,79,218,93,12,98,103,69,16,222,34,65,84,241,205,186,37,8,178,29,218,253,122,53,120,219,38,73,14,105,107,52,107,250,57,57,52,161,187,132,123,184,245,134,151,105,73,229,142,244,38,190,60,125,212,236,187,39,8,206,91,238,175,101,145,38,188,189,166,54,213,242,70,135,255,254,180,45,143,75,92,163,76,157,60,146,104,37,203,123,149,117,99,208,29,213,49,35,93,55,131,96,185,204,179,159,17,152,250,254,93,180,194,219,10,163,95,41,198,156,211,224,126,6,101,21,109,102,144,110,147,129,43,176,184,161,101,190,191,233,155,247,53,117,142,7,145,50,21,240,125,164,160,46,174,15,24,73,206,182,233,34,42,198,83,8,215,81,120,187,11,146,201,43,90,248,21,173,252,74,233,141,139,78,168,11,55,163,68,159,24,171,77,209,147,232,196,192,245,76,93,151,162,61,204,174,19,167,251,254,102,184,91,21,114,78,99,146,117,59,184,68,40,76,59,93,235,20,129,102,93,124,68,226,234,142,13,238,213,216,43,92,239,75,199,238,219,237,99,248,19,15,201,83,10,156,159,253,111,254,234,127,241,9,127,53,61,235,184,77,203,248,38,174,208,179,73,225,59,72,127,19,191,243,36,202,110,42,140,236,26,189,128,32,233,213,54,34,72,219,76,162,10,118,212,214,83,207,237,25,14,177,83,71,249,159,192,82,19,240,199,105,95,77,54,65,81,70,63,36,121,80,77,118,83,56,35,44,77,121,149,255,16,223,71,203,137,218,123,39,212,15,138,88,39,187,22,20,199,119,65,219,164,21,212,221,95,158,158,249,121,241,173,149,124,143,185,7,22,90,55,58,191,184,217,107,53,216,112,73,171,11,159,210,169,93,51,176,17,104,164,227,106,2,128,158,242,238,109,102,104,31,14,76,65,187,111,97,52,187,34,149,248,145,128,218,53,106,79,31,9,150,181,156,28,31,77,34,180,134,56,253,213,136,169,162,205,252,244,17,255,236,145,23,230,167,143,41,230,25,210,224,30,111,131,251,189,114,92,122,22,156,186,221,3,231,252,244,17,133,137,154,75,195,136,192,217,135,142,86,62,53,6,190,196,24,118,255,168,49,252,181,140,222,238,170,104,192,182,79,90,124,107,116,144,88,253,10,84,146,124,21,42,105,3,219,101,88,228,73,130,169,228,7,52,149,211,56,83,105,231,115,176,141,255,113,209,80,19,109,191,33,167,231,140,172,40,137,194,227,186,39,223,96,143,178,85,66,61,245,81,229,63,102,24,246,185,71,193,116,143,140,78,98,227,199,172,154,220,79,225,187,222,211,57,220,63,35,213,148,244,160,249,14,92,142,35,194,160,164,29,31,39,217,198,160,37,10,172,9,178,231,209,41,241,208,82,165,232,64,220,57,78,123,53,129,63,67,131,163,163,44,169,232,73,195,145,167,193,102,178,107,203,20,84,115,203,181,191,25,191,239,65,29,142,102,193,6,4,171,98,231,43,108,16,191,43,148,78,63,131,211,187,184,10,215,71,112,218,67,96,157,71,238,163,225,27,173,178,155,110,139,27,152,195,55,170,25,51,7,157,228,45,165,13,106,158,147,70,55,1,87,21,253,81,221,68,157,173,210,13,7,169,187,47,200,239,246,131,230,113,120,187,239,139,165,46,107,170,148,135,16,253,88,61,104,220,233,108,82,99,150,19,193,104,134,148,245,13,237,113,19,96,224,160,147,235,97,218,110,109,82,65,210,48,84,130,40,206,40,71,116,132,132,84,19,185,67,186,38,193,24,65,145,35,11,151,132,45,29,35,39,5,77,232,215,192,35,26,82,226,231,48,136,222,30,190,42,246,71,243,121,61,239,77,135,237,59,105,173,254,233,251,25,50,189,205,254,214,59,25,175,167,142,143,255,168,131,74,32,92,158,41,188,61,45,123,232,183,130,39,84,164,163,72,19,109,27,165,249,230,173,81,92,91,20,170,152,167,177,43,20,224,198,211,102,64,135,238,159,26,66,236,213,29,210,138,191,231,204,142,182,144,72,185,43,55,69,188,4,188,32,45,148,76,234,74,130,244,129,137,177,194,88,47,184,117,232,138,28,38,173,80,35,166,72,123,93,31,187,94,183,13,178,182,94,75,239,93,19,157,120,206,129,196,49,235,9,29,125,166,138,166,166,159,117,194,127,10,110,226,76,87,6,64,149,87,65,242,35,206,56,83,19,255,20,21,63,5,55,209,12,116,120,77,61,80,252,232,38,194,164,132,102,149,129,230,168,130,4,59,160,1,252,62,168,214,60,140,226,100,210,78,14,103,189,217,59,194,40,13,238,177,229,103,173,63,100,251,38,137,202,242,151,117,144,125,120,72,23,57,250,14,163,203,81,251,246,166,136,130,42,42,250,29,174,58,29,136,240,63,96,42,26,223,64,231,13,238,4,209,62,135,113,17,37,1,166,209,225,201,216,203,230,158,153,157,64,8,165,57,145,123,62,49,169,25,137,237,226,50,94,36,81,45,30,142,183,18,25,28,107,207,87,43,157,151,63,250,186,145,204,23,135,113,166,206,187,230,112,8,76,4,57,254,243,56,143,176,33,236,197,229,235,144,78,185,39,135,111,66,198,159,82,89,193,73,29,48,124,163,197,112,83,5,164,16,62,193,41,154,56,97,35,157,52,12,177,62,166,153,253,59,248,216,214,205,180,81,222,143,168,27,6,50,186,207,36,135,161,37,93,79,166,173,168,166,162,72,27,81,227,189,138,116,214,190,57,70,45,111,180,125,124,121,22,92,125,60,1,152,18,76,122,220,255,249,112,76,29,99,92,68,213,93,20,101,189,176,14,81,129,60,90,15,80,166,231,52,151,254,203,68,91,248,80,151,68,164,231,195,185,85,149,4,134,139,104,9,245,152,229,119,69,176,209,54,195,97,154,247,72,120,168,13,48,30,132,133,122,41,203,114,157,223,197,217,205,32,160,210,79,255,168,121,92,149,176,159,116,4,0,48,16,83,248,75,143,135,225,21,136,189,214,11,192,142,204,91,111,227,244,145,36,66,26,103,189,41,255,50,144,55,173,176,152,54,211,230,43,56,125,108,25,121,127,242,100,190,251,185,147,180,51,55,19,23,81,185,77,170,178,151,195,221,244,75,58,122,112,207,130,6,217,113,153,227,228,61,137,193,106,100,110,186,249,125,109,0,144,222,152,143,90,177,59,44,46,8,6,233,230,167,121,81,1,50,184,31,226,102,6,98,58,221,15,166,209,251,61,42,226,136,158,15,213,87,227,174,253,81,142,196,208,95,103,75,223,204,65,160,141,216,231,122,93,186,118,32,64,15,68,225,65,41,193,233,99,95,25,12,8,225,44,184,58,25,86,208,212,114,112,79,50,112,126,250,40,246,141,28,156,247,119,139,5,148,98,63,76,251,247,251,92,245,21,213,43,144,240,221,17,71,178,35,24,63,7,194,14,157,154,72,167,156,115,77,157,31,21,156,6,187,121,93,20,193,3,199,202,177,201,163,10,45,157,67,195,88,173,2,158,245,55,250,23,144,200,168,211,253,12,38,255,103,6,49,17,84,67,70,178,167,230,129,245,198,78,225,21,196,83,242,113,54,4,166,43,2,37,92,129,64,47,154,238,47,187,170,191,147,140,56,128,62,9,232,231,16,160,58,160,39,180,127,6,13,189,245,24,197,246,186,72,17,211,127,53,86,58,219,185,34,154,127,18,2,109,207,103,225,208,237,118,214,44,250,207,9,140,129,228,125,133,2,163,93,231,191,155,228,232,128,244,171,138,144,3,139,241,136,20,233,62,102,193,174,91,213,211,81,9,157,7,117,251,132,165,253,43,253,172,221,15,113,18,233,130,244,142,91,84,23,239,80,23,85,190,67,183,189,200,189,42,197,5,56,59,211,115,213,255,68,98,167,18,189,10,170,173,170,235,249,64,183,7,149,61,184,205,179,51,120,163,160,172,127,107,15,212,184,54,38,240,76,5,112,237,89,245,223,158,208,172,31,176,132,52,128,4,35,60,84,123,7,225,122,155,221,194,226,65,221,52,147,148,81,70,144,248,107,80,5,221,60,192,182,72,102,52,240,111,65,26,169,59,236,50,83,195,63,196,159,162,58,214,173,109,185,238,191,243,216,204,210,252,211,142,69,244,247,40,172,58,225,113,85,195,28,103,113,185,198,74,251,219,54,232,174,195,220,10,176,237,153,187,227,84,121,190,114,202,242,76,67,238,187,65,195,4,203,171,15,79,160,227,255,253,74,254,63,95,205,255,101,197,251,84,10,170,129,65,31,17,40,120,76,166,157,163,237,33,74,202,168,55,241,147,195,58,163,244,221,254,162,7,89,68,235,27,194,120,7,167,138,9,187,123,223,5,133,38,140,121,11,160,114,187,8,80,169,233,254,51,80,127,225,85,23,247,232,33,143,47,122,19,229,27,74,180,60,166,81,181,206,241,75,145,159,254,231,135,95,198,51,88,228,203,135,115,53,118,223,31,129,193,144,95,11,116,17,183,69,130,229,105,223,169,165,230,88,165,86,175,218,129,199,248,91,18,66,244,122,128,79,24,116,196,210,37,234,23,101,97,190,140,126,253,249,199,55,121,186,201,179,40,171,38,53,81,76,7,251,191,189,232,18,160,98,219,201,88,17,34,218,232,245,178,56,22,119,59,131,197,67,21,149,208,221,45,140,57,31,247,246,50,233,131,175,161,191,87,48,70,67,250,200,89,58,251,82,165,118,26,78,20,40,46,167,157,185,21,141,117,217,173,79,153,13,85,99,185,50,214,202,119,118,0,87,96,76,91,66,121,98,155,23,189,217,144,79,65,77,215,127,161,133,0,190,66,189,51,233,141,219,63,179,101,236,125,108,207,223,228,183,211,46,22,254,163,40,242,226,156,160,69,67,102,90,120,76,242,219,233,5,74,188,31,130,56,57,152,229,240,188,106,163,52,226,125,94,104,177,88,226,23,16,8,137,190,107,214,172,174,35,239,136,92,248,107,158,145,60,211,255,252,22,44,163,93,28,70,156,243,241,0,86,131,253,189,78,146,122,177,50,202,170,30,120,46,134,76,220,98,197,168,211,127,117,202,239,88,116,255,72,65,40,193,176,141,241,35,133,149,191,25,191,55,0,104,242,155,24,62,70,217,141,74,224,103,170,225,196,79,39,86,189,172,103,61,90,87,129,242,34,10,150,175,75,178,124,191,223,174,86,81,49,89,77,235,119,57,253,202,105,119,83,189,79,159,180,88,239,170,29,29,58,84,26,135,103,36,173,113,71,191,198,89,229,209,34,19,92,18,61,195,233,12,164,97,121,173,216,28,100,49,48,118,52,238,188,219,20,20,162,253,107,180,10,182,73,135,42,245,71,37,221,175,70,22,65,25,213,159,142,104,144,31,129,184,142,227,31,1,56,194,114,149,93,116,206,72,84,179,66,253,125,223,73,123,127,179,202,116,80,116,248,193,138,50,40,254,150,215,166,64,156,161,70,187,41,34,170,15,94,231,119,74,145,47,227,32,201,111,122,245,184,89,187,211,39,211,185,189,92,90,93,148,211,255,108,83,213,213,40,179,162,87,254,63,210,201,1,92,191,174,175,167,110,251,227,201,161,32,12,163,77,213,196,114,213,163,246,228,14,138,208,250,209,213,126,37,90,253,163,185,251,99,249,8,181,15,42,241,111,74,68,244,113,186,85,34,189,47,68,170,58,239,215,143,209,160,133,140,201,91,228,246,131,224,175,106,30,198,111,255,47,248,85,170,250,164,123,0,0,0};
 
-static const unsigned char v5[] = {31,139,8,0,0,0,0,0,0,3,237,60,107,143,227,72,110,127,69,153,193,2,221,19,73,35,201,146,221,150,113,193,5,1,130,59,224,54,31,146,124,200,97,123,62,200,82,217,214,181,44,41,122,180,237,118,156,223,30,178,94,170,146,100,91,222,157,13,238,14,187,51,30,187,72,22,139,69,178,88,172,215,126,49,195,104,211,144,202,12,215,100,83,84,228,108,89,205,193,90,23,85,66,42,171,46,163,56,205,183,214,49,116,86,99,240,147,128,55,85,148,215,89,212,144,142,180,3,73,170,170,104,160,44,74,245,27,57,116,228,180,36,41,235,56,202,144,151,171,22,79,162,88,70,57,224,140,174,112,146,133,52,143,119,214,71,81,236,5,164,142,171,34,203,172,58,143,74,171,110,170,52,110,114,82,215,97,89,21,199,116,159,54,39,70,181,173,162,36,37,121,99,109,170,98,111,149,69,157,54,105,145,11,30,18,251,158,70,215,145,77,49,192,129,182,210,60,202,164,44,89,84,239,72,98,125,144,170,16,176,188,221,19,144,202,218,164,219,182,34,125,40,87,244,128,184,138,98,181,157,10,141,145,230,53,105,52,72,177,217,0,200,58,164,73,179,11,157,242,56,68,197,69,86,84,225,231,205,102,163,224,24,176,218,174,163,167,96,105,186,51,199,244,252,185,105,7,207,195,250,245,46,74,138,67,232,24,142,241,217,129,255,20,138,113,212,45,40,107,152,36,125,236,58,107,43,209,175,117,149,110,119,204,132,28,18,23,57,184,90,221,40,246,56,81,127,17,128,93,75,132,231,113,72,154,191,147,74,86,168,163,166,173,20,108,77,202,52,18,133,164,42,74,33,180,16,33,138,223,40,88,147,75,2,7,2,74,84,95,82,137,24,136,44,49,67,217,37,74,239,132,4,23,232,49,205,105,0,239,247,178,67,168,221,69,17,163,52,183,234,244,131,244,97,89,116,42,218,166,15,45,225,159,1,176,110,78,216,153,75,24,138,102,126,11,43,191,133,149,223,194,202,111,97,229,187,132,149,175,95,254,193,0,64,118,72,243,36,174,107,227,125,102,251,182,187,52,254,199,248,241,143,255,105,252,41,141,9,248,44,148,118,77,83,214,225,215,175,10,173,29,23,251,47,95,191,244,147,158,117,113,68,225,112,76,240,88,4,144,21,251,9,126,83,23,89,154,24,159,73,64,22,100,125,25,75,152,80,68,24,173,225,167,79,151,112,87,212,141,185,107,246,217,57,75,115,98,237,8,154,46,116,237,96,101,29,200,250,45,133,49,77,142,13,85,134,21,37,127,105,193,116,174,227,252,176,178,246,197,135,213,68,107,166,38,127,101,21,106,73,249,185,41,48,164,68,251,52,59,133,127,132,118,43,227,61,170,204,127,174,210,40,51,255,64,178,119,210,164,113,100,214,16,40,193,12,85,186,225,21,8,218,138,0,168,105,160,163,117,248,41,126,119,221,79,230,167,186,118,220,79,140,6,248,164,17,134,0,133,170,40,235,143,79,198,204,235,164,135,152,183,131,62,101,216,47,62,172,105,88,46,163,10,116,112,89,23,201,233,188,143,170,109,154,67,224,85,117,144,230,59,144,167,185,236,170,51,135,56,43,86,159,99,184,202,33,232,149,60,190,184,229,241,18,173,215,85,120,0,2,242,244,83,147,54,25,249,246,124,214,84,153,144,184,168,168,220,97,155,67,125,108,211,72,138,166,33,201,234,30,193,101,231,154,59,207,220,205,204,157,111,238,2,115,55,63,83,85,80,93,11,177,40,228,160,119,34,58,235,162,247,27,18,116,107,19,38,136,34,223,158,85,38,235,34,3,49,46,113,145,16,243,109,157,152,101,69,192,96,251,242,172,218,182,77,193,37,242,2,163,53,49,255,227,95,127,132,223,214,191,147,109,155,129,181,127,36,121,86,152,0,138,226,194,252,151,34,7,23,141,106,243,79,233,154,176,230,13,164,6,68,91,165,224,31,255,70,14,166,100,117,197,29,242,162,218,71,217,85,63,80,209,84,55,46,217,95,106,0,101,138,190,94,156,31,46,117,11,61,110,75,5,186,8,126,208,220,192,89,201,25,173,34,48,151,167,239,100,133,81,7,188,54,179,34,112,171,28,242,134,154,96,21,228,6,163,179,105,96,234,181,108,47,192,54,129,55,248,7,20,177,4,195,34,35,103,170,123,24,225,56,4,29,225,68,163,158,5,192,44,42,107,18,138,31,151,117,11,220,115,51,205,203,182,49,139,178,217,86,69,91,154,208,60,137,27,19,25,131,87,71,154,93,52,175,24,232,81,195,142,40,82,195,51,77,226,232,31,113,177,177,177,179,202,128,79,151,43,73,176,222,89,57,250,202,40,73,144,204,17,221,100,253,98,10,163,131,22,98,216,30,140,155,235,138,144,195,237,84,146,223,49,196,183,231,17,84,69,160,95,163,24,48,28,36,66,202,72,141,202,146,68,208,98,76,66,198,112,133,147,5,106,59,79,134,81,68,69,166,251,104,75,152,140,33,13,146,155,34,110,107,76,7,206,48,117,160,146,194,168,109,10,142,132,81,3,147,24,184,81,194,194,58,155,101,105,109,72,207,182,32,113,125,190,230,109,97,40,164,77,243,156,106,25,166,29,174,151,14,7,141,234,56,17,205,168,20,188,251,208,215,120,247,109,172,247,168,251,77,74,178,100,197,165,231,105,79,104,121,16,236,186,102,24,11,37,164,140,49,99,90,145,117,54,41,100,180,109,153,21,81,34,100,187,174,127,116,57,25,166,234,118,15,94,115,58,39,105,93,194,156,28,102,105,13,90,104,96,136,173,179,34,126,251,239,182,104,136,153,36,102,146,153,44,169,52,7,129,211,220,85,102,137,161,76,70,255,11,237,39,244,109,8,49,51,178,37,121,114,238,60,116,79,242,214,44,50,179,197,137,19,26,103,211,61,118,112,204,159,19,152,237,138,173,82,93,14,85,176,48,142,42,97,227,11,243,77,230,28,208,181,152,236,104,240,149,99,123,136,58,139,116,199,229,227,234,243,50,142,102,209,70,176,26,231,50,133,193,79,176,108,144,3,202,228,22,138,219,170,6,154,178,72,113,50,191,132,96,2,140,106,137,64,36,100,19,181,25,204,56,109,146,22,102,28,129,119,215,38,217,175,73,98,166,144,179,239,137,153,238,183,102,177,254,11,70,172,250,125,107,190,167,9,41,164,37,169,253,250,1,118,159,38,73,70,46,88,145,81,239,163,163,152,114,49,28,105,30,189,3,98,146,127,227,227,27,76,210,60,113,216,239,218,188,73,51,24,144,48,78,191,61,63,203,54,169,91,218,117,101,21,121,118,58,203,112,31,173,97,158,130,209,179,146,147,187,104,8,127,74,91,10,123,91,8,45,64,242,77,6,67,152,181,184,138,179,180,132,121,35,110,158,28,147,254,121,94,29,118,224,168,52,36,162,191,28,170,168,20,225,158,47,82,46,54,87,174,69,222,33,184,212,22,202,119,214,97,92,230,30,33,42,160,79,72,149,98,111,210,35,152,72,118,141,22,47,182,232,225,176,207,23,91,76,118,231,193,244,7,170,2,227,188,41,154,98,229,139,77,151,95,150,115,102,203,48,232,136,69,87,2,150,123,166,223,116,82,172,96,144,218,52,103,114,249,204,200,97,108,226,132,218,124,6,133,234,25,217,32,59,252,194,34,99,70,59,89,117,6,183,145,151,67,121,1,77,138,185,5,244,136,125,211,212,134,65,46,246,135,229,58,231,15,58,243,194,170,218,65,192,235,79,254,203,235,55,9,244,95,24,112,238,40,192,57,80,194,184,64,139,229,150,119,222,86,41,157,1,218,61,244,27,64,134,247,149,125,93,236,189,229,139,208,225,210,46,237,143,76,90,6,180,104,63,16,192,93,198,82,123,177,63,65,39,56,156,246,69,16,117,234,0,18,87,37,97,154,235,209,9,117,2,177,167,17,143,209,74,210,153,70,186,24,163,93,72,98,95,37,118,135,164,174,32,12,52,194,81,113,93,41,239,186,235,92,191,43,89,215,21,170,67,91,194,103,58,124,33,17,190,134,224,18,85,29,31,166,122,193,168,234,232,25,130,87,104,198,20,78,225,67,221,82,240,136,30,41,124,160,50,10,29,211,15,69,44,116,4,231,67,99,163,30,41,113,204,209,89,89,199,169,64,24,252,25,57,74,20,22,100,45,13,163,192,96,80,209,84,85,160,104,233,98,163,239,75,24,22,46,54,139,115,189,80,186,195,145,198,99,165,199,149,3,48,79,192,102,28,34,1,146,198,23,16,151,3,2,9,16,234,217,89,243,14,38,64,155,22,82,123,1,133,41,1,180,8,218,219,225,214,23,1,241,104,65,98,223,119,23,251,0,163,77,198,219,131,229,186,188,228,9,101,31,64,58,6,178,5,192,231,0,151,151,3,81,22,162,29,64,52,1,18,144,133,96,227,190,112,200,82,16,121,62,135,80,233,187,249,140,9,207,193,244,167,138,194,169,207,170,247,202,28,200,249,160,225,192,95,241,43,116,13,215,64,106,10,171,119,144,126,190,65,135,149,18,118,155,253,210,160,174,128,14,169,33,191,61,48,24,254,66,74,252,22,116,20,6,84,144,157,166,53,132,208,153,83,30,33,136,82,28,133,133,8,193,40,207,118,79,9,100,206,24,167,251,43,29,129,232,40,249,62,171,115,109,87,86,236,233,13,247,101,75,177,43,34,23,32,176,194,121,26,101,243,108,92,67,157,158,113,186,234,246,118,153,85,6,59,190,22,179,206,128,210,180,85,8,76,83,114,25,35,225,79,178,105,133,244,217,28,129,158,158,159,13,182,21,214,213,97,101,64,224,238,241,127,117,112,182,181,204,225,127,238,193,145,17,221,109,83,43,176,253,102,129,249,115,31,3,117,46,189,206,12,247,189,209,196,42,77,48,164,145,163,69,163,83,245,116,250,123,210,211,105,168,167,83,95,79,56,85,15,105,108,69,77,168,9,179,87,227,111,91,69,191,127,35,39,186,30,168,13,92,156,66,254,166,116,136,75,230,54,109,149,63,95,32,81,205,97,89,77,179,102,160,100,5,154,119,66,209,112,107,3,231,173,168,50,210,124,147,230,41,198,14,182,22,177,120,42,220,95,179,216,108,95,129,229,213,98,197,217,214,52,44,33,130,45,227,216,250,188,15,237,3,216,164,136,241,171,134,216,75,127,195,50,180,164,58,102,89,98,13,137,51,44,102,155,39,215,132,88,14,81,27,150,2,238,166,66,47,233,170,122,183,171,122,131,170,52,176,2,21,139,176,73,138,107,12,84,9,171,200,241,184,184,56,203,95,33,254,3,107,6,92,249,137,61,96,139,174,106,85,72,8,16,200,15,64,146,26,22,181,81,213,156,233,26,140,174,174,235,144,205,9,8,22,52,200,96,64,161,240,136,9,53,129,74,194,64,23,27,119,147,211,205,73,144,200,34,23,164,79,182,38,205,1,39,243,62,29,93,74,9,44,40,53,130,165,197,171,29,156,225,71,104,207,248,116,142,80,143,129,58,128,79,1,174,44,31,113,28,162,217,153,22,45,73,190,234,3,4,253,108,72,191,24,84,88,168,53,252,65,13,183,71,223,201,115,130,124,2,231,88,10,229,237,178,149,35,48,42,143,255,164,46,110,191,61,255,175,94,100,17,69,80,87,176,28,172,106,210,45,43,88,158,11,195,49,126,194,149,235,151,110,136,234,53,158,159,87,106,38,221,85,120,114,13,203,184,94,11,124,84,192,252,239,37,40,106,230,33,65,105,133,169,130,66,76,157,46,232,105,40,40,230,234,180,85,106,169,209,102,79,74,179,189,133,144,82,243,122,165,78,212,7,116,122,75,212,171,10,186,39,233,152,41,52,65,147,20,183,106,172,211,20,57,5,173,34,232,224,108,133,181,58,240,187,126,85,20,87,158,138,209,13,133,94,245,27,53,165,208,120,24,105,121,142,243,128,236,221,30,154,182,161,95,109,215,79,158,183,52,188,153,11,159,224,107,191,117,94,205,116,169,109,73,182,209,98,46,2,180,144,203,41,42,210,196,59,149,134,131,46,182,216,127,98,251,14,114,55,138,109,49,72,36,95,180,245,54,171,20,2,118,99,160,35,96,101,133,224,164,55,0,233,10,223,139,169,218,60,198,188,190,191,17,54,220,245,2,98,220,215,39,89,150,150,176,62,48,187,186,20,46,25,8,2,88,40,33,15,230,106,140,197,121,140,43,221,134,39,137,88,89,224,213,132,182,150,75,119,142,101,89,188,78,178,132,255,48,47,19,36,217,182,207,67,103,177,31,180,33,38,27,65,113,236,55,33,87,242,20,122,214,246,253,92,101,121,228,233,40,79,65,173,207,99,238,173,86,150,141,210,237,179,33,94,182,203,246,211,134,4,194,253,181,21,215,163,14,174,87,99,14,174,242,159,61,192,223,1,254,238,12,62,203,73,252,43,80,253,35,226,7,190,225,57,30,126,38,177,103,9,244,67,250,153,131,110,160,1,223,121,160,129,135,20,52,99,10,242,166,25,64,57,186,58,107,204,212,147,113,123,189,197,235,29,196,10,164,32,91,85,136,254,121,24,10,18,44,13,119,230,64,71,231,138,28,219,158,12,156,237,124,58,219,217,194,88,46,123,238,53,228,218,115,219,187,92,199,221,118,140,47,228,149,184,190,159,206,24,84,16,120,200,124,2,227,7,212,59,243,13,119,9,186,240,111,178,69,247,127,68,90,116,127,244,80,239,182,209,144,237,3,178,122,179,165,49,127,129,191,55,153,50,87,127,68,90,31,12,230,7,240,89,78,96,252,144,55,140,13,210,107,140,131,7,4,126,1,103,160,14,113,147,239,123,90,100,164,121,72,21,48,44,188,25,140,250,224,182,63,208,73,114,186,55,128,110,217,231,38,211,19,76,203,48,239,63,234,103,62,4,136,229,109,206,188,108,45,130,1,103,7,230,79,60,203,202,50,43,62,69,108,232,96,41,252,236,204,215,243,196,231,56,102,34,95,34,151,126,52,91,191,224,177,85,85,188,17,86,21,163,15,43,67,229,151,165,187,246,36,190,11,191,130,32,94,39,1,113,37,129,203,17,98,234,132,53,53,204,216,226,64,144,103,9,184,186,20,32,151,67,130,14,34,242,145,18,183,108,57,148,31,98,176,99,18,1,227,7,21,29,185,215,35,31,163,238,136,113,33,172,211,207,71,249,207,187,6,102,189,10,139,49,250,133,36,247,117,114,119,72,236,10,210,158,40,238,104,87,59,213,224,214,153,192,177,35,49,81,234,206,196,144,72,237,35,61,119,113,117,190,226,56,201,237,24,187,122,133,113,122,133,124,208,196,108,49,90,69,100,128,229,73,177,83,119,252,214,39,151,196,51,157,120,156,121,199,123,174,145,187,163,204,197,134,65,153,225,25,132,174,120,118,20,81,86,74,187,61,187,54,87,213,74,145,35,157,227,249,60,54,192,50,120,118,118,143,229,139,205,214,42,236,28,191,127,161,133,159,238,179,234,175,63,205,217,193,129,188,112,52,167,123,165,244,18,226,94,1,219,47,76,73,250,181,69,79,145,228,168,94,246,18,190,166,147,47,84,242,90,229,62,194,156,29,178,32,9,94,136,211,110,200,45,28,135,163,232,61,67,13,55,147,184,61,129,69,192,94,67,6,18,201,174,172,105,72,95,34,107,178,79,7,141,206,17,221,150,37,169,226,168,38,253,91,82,18,129,199,232,17,53,213,188,127,199,83,236,47,199,111,212,146,84,244,222,149,45,203,118,232,69,54,166,35,61,113,99,235,180,222,229,145,43,249,154,74,203,66,61,133,208,156,205,191,203,208,13,230,134,59,159,25,238,98,34,203,224,62,75,103,97,184,46,36,84,222,203,52,150,247,187,189,8,140,151,0,122,62,141,223,226,46,63,152,134,231,192,210,157,198,239,229,190,89,92,3,178,167,96,162,10,151,247,85,8,249,135,111,204,166,244,23,19,221,251,102,94,96,38,234,77,52,137,150,59,95,239,243,48,101,190,201,241,190,149,81,64,112,197,197,84,142,247,245,8,203,133,151,153,225,223,183,75,1,163,123,75,38,244,154,230,89,46,100,113,222,93,158,152,214,223,183,12,102,177,46,172,48,225,51,137,227,4,17,135,235,131,27,252,166,152,197,49,102,47,240,119,18,191,9,206,237,129,119,67,16,187,239,221,189,229,250,13,51,143,172,210,111,242,156,16,24,209,46,24,24,95,238,187,163,88,185,220,143,140,14,216,25,2,238,132,145,205,120,78,8,101,46,13,101,83,59,62,193,60,224,220,48,102,238,251,183,178,250,185,110,153,177,69,207,21,126,124,225,51,197,193,33,244,44,150,198,125,135,228,44,39,116,26,188,135,26,251,22,75,249,102,224,220,187,228,111,209,203,199,18,125,177,197,74,203,145,55,64,157,14,136,43,59,41,3,222,10,193,155,201,252,88,65,60,96,114,203,163,49,131,143,99,208,151,82,236,138,163,237,62,155,12,229,193,7,143,138,122,216,43,239,157,58,102,221,177,130,66,51,96,58,78,37,36,53,249,55,219,197,149,55,171,187,179,238,193,11,46,83,62,185,82,14,204,149,103,92,163,120,134,146,173,98,107,61,21,57,32,170,27,160,208,179,129,38,128,165,15,192,57,98,253,201,122,210,57,94,85,150,198,249,182,178,48,179,30,90,214,27,88,214,9,110,25,207,187,97,188,213,255,135,13,42,229,158,208,200,11,61,157,33,189,163,250,108,56,244,207,168,72,116,117,255,60,142,227,189,234,203,119,171,13,122,2,117,163,161,126,75,194,68,172,87,38,251,118,39,58,243,184,250,6,74,83,244,121,17,13,252,53,171,15,221,236,31,111,53,119,83,137,148,223,185,199,63,164,255,114,138,117,6,107,33,85,3,50,8,247,88,210,112,76,5,251,218,147,70,13,197,20,162,159,118,76,96,59,122,220,113,149,57,166,152,143,112,119,97,90,194,220,203,93,120,119,185,99,166,244,144,228,1,230,198,1,126,238,242,230,147,222,99,236,49,121,242,141,133,123,151,187,152,197,130,17,230,14,196,49,186,83,136,151,78,216,151,114,49,48,107,43,245,50,160,124,202,170,0,197,35,86,5,36,159,175,42,176,238,225,170,2,100,79,86,21,128,120,148,170,130,240,57,170,82,86,30,224,226,22,169,250,246,150,111,145,106,207,113,241,159,167,151,242,216,167,53,187,34,239,124,175,172,104,65,173,167,170,99,248,196,119,12,59,162,160,225,67,223,49,228,168,202,122,207,125,199,48,220,180,99,168,17,253,234,239,126,197,109,61,250,148,225,220,253,180,74,32,129,246,78,33,245,64,179,191,169,109,170,39,103,102,63,215,98,80,220,127,54,217,102,177,41,156,180,11,224,102,119,181,143,25,192,236,25,100,165,72,211,164,123,116,226,77,155,243,139,94,237,58,141,173,53,249,72,73,245,100,251,56,61,123,48,0,212,42,73,203,95,119,218,110,80,171,189,180,240,33,228,88,79,1,254,171,181,73,53,82,255,122,10,254,190,130,139,34,61,66,26,37,243,84,170,217,53,170,25,80,145,168,38,224,188,248,20,239,252,184,144,188,254,35,149,157,174,174,242,206,235,53,212,182,220,70,94,146,125,151,77,184,91,45,126,247,198,118,120,77,228,53,84,142,170,67,10,250,158,7,214,93,27,124,107,241,177,38,112,47,134,29,0,222,56,13,230,109,104,155,172,106,51,191,108,171,85,229,46,182,71,39,113,159,184,73,74,159,184,190,134,31,48,88,66,250,91,62,158,242,28,137,21,239,71,241,214,44,167,18,15,98,113,229,192,254,183,5,234,163,218,222,131,83,122,9,166,199,139,231,126,142,206,79,212,232,218,102,57,52,167,250,107,78,112,31,78,109,39,46,172,126,206,122,128,106,203,122,79,235,116,157,17,169,243,80,3,75,149,179,247,175,212,136,215,106,90,222,149,186,202,37,167,43,53,117,59,15,24,244,236,61,172,47,135,212,120,125,254,236,213,11,230,51,178,198,91,128,236,73,235,107,200,239,145,231,5,158,102,65,186,10,107,221,254,123,87,5,167,214,20,17,9,195,158,172,50,49,98,44,231,52,139,134,160,113,61,96,104,45,209,49,237,254,140,150,60,31,50,106,223,191,29,255,186,166,244,0,162,55,246,11,99,200,239,241,112,44,50,158,186,231,78,115,223,129,28,246,108,215,251,215,112,228,5,155,0,247,95,60,33,124,202,43,149,1,157,57,0,253,173,63,177,24,233,208,80,23,252,20,80,39,189,246,104,101,245,119,160,144,41,79,27,58,186,235,207,27,58,154,27,79,28,144,232,193,247,11,88,101,228,62,9,3,207,149,27,36,138,225,30,59,29,199,42,55,207,132,71,70,227,98,254,66,71,227,30,194,192,207,127,182,50,194,216,117,60,159,114,206,182,175,225,232,11,87,68,12,94,134,34,240,96,149,199,179,114,125,21,97,191,224,73,141,94,125,118,187,250,236,78,117,255,118,117,127,188,58,125,33,50,31,190,16,25,60,66,17,214,167,74,251,117,174,62,74,91,149,21,217,144,170,102,213,97,52,237,200,158,132,73,84,189,129,209,240,235,53,84,239,245,202,99,232,251,215,86,135,231,209,99,119,86,121,19,219,254,209,208,253,94,14,207,136,6,83,27,229,221,77,107,222,132,99,198,17,205,13,51,98,133,241,247,59,128,186,252,31,133,207,219,182,0,85,0,0,0};
+static const unsigned char v5[] = {39,117,115,101,32,115,116,114,105,99,116,39,59,10,105,109,112,111,114,116,32,123,32,104,44,32,114,101,110,100,101,114,44,32,117,115,101,83,116,97,116,101,44,32,117,115,101,69,102,102,101,99,116,44,32,117,115,101,82,101,102,44,32,104,116,109,108,44,32,82,111,117,116,101,114,32,125,32,102,114,111,109,32,32,39,46,47,98,117,110,100,108,101,46,98,98,55,49,56,54,56,99,46,106,115,39,59,10,10,47,47,32,72,101,108,112,101,114,32,102,117,110,99,116,105,111,110,32,116,104,97,116,32,114,101,116,117,114,110,115,32,97,32,112,114,111,109,105,115,101,32,116,104,97,116,32,114,101,115,111,108,118,101,115,32,97,102,116,101,114,32,100,101,108,97,121,10,99,111,110,115,116,32,68,101,108,97,121,32,61,32,40,109,115,44,32,118,97,108,41,32,61,62,32,110,101,119,32,80,114,111,109,105,115,101,40,114,101,115,111,108,118,101,32,61,62,32,115,101,116,84,105,109,101,111,117,116,40,114,101,115,111,108,118,101,44,32,109,115,44,32,118,97,108,41,41,59,10,10,101,120,112,111,114,116,32,99,111,110,115,116,32,73,99,111,110,115,32,61,32,123,10,32,32,104,101,97,114,116,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,62,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,50,34,32,100,61,34,77,52,46,51,49,56,32,54,46,51,49,56,97,52,46,53,32,52,46,53,32,48,32,48,48,48,32,54,46,51,54,52,76,49,50,32,50,48,46,51,54,52,108,55,46,54,56,50,45,55,46,54,56,50,97,52,46,53,32,52,46,53,32,48,32,48,48,45,54,46,51,54,52,45,54,46,51,54,52,76,49,50,32,55,46,54,51,54,108,45,49,46,51,49,56,45,49,46,51,49,56,97,52,46,53,32,52,46,53,32,48,32,48,48,45,54,46,51,54,52,32,48,122,34,62,60,47,112,97,116,104,62,60,47,115,118,103,62,96,44,10,32,32,100,111,119,110,65,114,114,111,119,66,111,120,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,56,46,50,53,72,55,46,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,32,50,46,50,53,118,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,32,50,46,50,53,104,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,45,50,46,50,53,118,45,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,45,50,46,50,53,72,49,53,77,57,32,49,50,108,51,32,51,109,48,32,48,108,51,45,51,109,45,51,32,51,86,50,46,50,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,117,112,65,114,114,111,119,66,111,120,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,56,46,50,53,72,55,46,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,32,50,46,50,53,118,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,32,50,46,50,53,104,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,45,50,46,50,53,118,45,57,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,45,50,46,50,53,72,49,53,109,48,45,51,108,45,51,45,51,109,48,32,48,108,45,51,32,51,109,51,45,51,86,49,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,99,111,103,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,46,53,57,52,32,51,46,57,52,99,46,48,57,45,46,53,52,50,46,53,54,45,46,57,52,32,49,46,49,49,45,46,57,52,104,50,46,53,57,51,99,46,53,53,32,48,32,49,46,48,50,46,51,57,56,32,49,46,49,49,46,57,52,108,46,50,49,51,32,49,46,50,56,49,99,46,48,54,51,46,51,55,52,46,51,49,51,46,54,56,54,46,54,52,53,46,56,55,46,48,55,52,46,48,52,46,49,52,55,46,48,56,51,46,50,50,46,49,50,55,46,51,50,52,46,49,57,54,46,55,50,46,50,53,55,32,49,46,48,55,53,46,49,50,52,108,49,46,50,49,55,45,46,52,53,54,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,49,46,51,55,46,52,57,108,49,46,50,57,54,32,50,46,50,52,55,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,45,46,50,54,32,49,46,52,51,49,108,45,49,46,48,48,51,46,56,50,55,99,45,46,50,57,51,46,50,52,45,46,52,51,56,46,54,49,51,45,46,52,51,49,46,57,57,50,97,54,46,55,53,57,32,54,46,55,53,57,32,48,32,48,49,48,32,46,50,53,53,99,45,46,48,48,55,46,51,55,56,46,49,51,56,46,55,53,46,52,51,46,57,57,108,49,46,48,48,53,46,56,50,56,99,46,52,50,52,46,51,53,46,53,51,52,46,57,53,52,46,50,54,32,49,46,52,51,108,45,49,46,50,57,56,32,50,46,50,52,55,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,45,49,46,51,54,57,46,52,57,49,108,45,49,46,50,49,55,45,46,52,53,54,99,45,46,51,53,53,45,46,49,51,51,45,46,55,53,45,46,48,55,50,45,49,46,48,55,54,46,49,50,52,97,54,46,53,55,32,54,46,53,55,32,48,32,48,49,45,46,50,50,46,49,50,56,99,45,46,51,51,49,46,49,56,51,45,46,53,56,49,46,52,57,53,45,46,54,52,52,46,56,54,57,108,45,46,50,49,51,32,49,46,50,56,99,45,46,48,57,46,53,52,51,45,46,53,54,46,57,52,49,45,49,46,49,49,46,57,52,49,104,45,50,46,53,57,52,99,45,46,53,53,32,48,45,49,46,48,50,45,46,51,57,56,45,49,46,49,49,45,46,57,52,108,45,46,50,49,51,45,49,46,50,56,49,99,45,46,48,54,50,45,46,51,55,52,45,46,51,49,50,45,46,54,56,54,45,46,54,52,52,45,46,56,55,97,54,46,53,50,32,54,46,53,50,32,48,32,48,49,45,46,50,50,45,46,49,50,55,99,45,46,51,50,53,45,46,49,57,54,45,46,55,50,45,46,50,53,55,45,49,46,48,55,54,45,46,49,50,52,108,45,49,46,50,49,55,46,52,53,54,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,45,49,46,51,54,57,45,46,52,57,108,45,49,46,50,57,55,45,50,46,50,52,55,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,46,50,54,45,49,46,52,51,49,108,49,46,48,48,52,45,46,56,50,55,99,46,50,57,50,45,46,50,52,46,52,51,55,45,46,54,49,51,46,52,51,45,46,57,57,50,97,54,46,57,51,50,32,54,46,57,51,50,32,48,32,48,49,48,45,46,50,53,53,99,46,48,48,55,45,46,51,55,56,45,46,49,51,56,45,46,55,53,45,46,52,51,45,46,57,57,108,45,49,46,48,48,52,45,46,56,50,56,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,45,46,50,54,45,49,46,52,51,108,49,46,50,57,55,45,50,46,50,52,55,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,49,46,51,55,45,46,52,57,49,108,49,46,50,49,54,46,52,53,54,99,46,51,53,54,46,49,51,51,46,55,53,49,46,48,55,50,32,49,46,48,55,54,45,46,49,50,52,46,48,55,50,45,46,48,52,52,46,49,52,54,45,46,48,56,55,46,50,50,45,46,49,50,56,46,51,51,50,45,46,49,56,51,46,53,56,50,45,46,52,57,53,46,54,52,52,45,46,56,54,57,108,46,50,49,52,45,49,46,50,56,49,122,34,32,47,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,53,32,49,50,97,51,32,51,32,48,32,49,49,45,54,32,48,32,51,32,51,32,48,32,48,49,54,32,48,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,115,101,116,116,105,110,103,115,72,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,48,46,53,32,54,104,57,46,55,53,77,49,48,46,53,32,54,97,49,46,53,32,49,46,53,32,48,32,49,49,45,51,32,48,109,51,32,48,97,49,46,53,32,49,46,53,32,48,32,49,48,45,51,32,48,77,51,46,55,53,32,54,72,55,46,53,109,51,32,49,50,104,57,46,55,53,109,45,57,46,55,53,32,48,97,49,46,53,32,49,46,53,32,48,32,48,49,45,51,32,48,109,51,32,48,97,49,46,53,32,49,46,53,32,48,32,48,48,45,51,32,48,109,45,51,46,55,53,32,48,72,55,46,53,109,57,45,54,104,51,46,55,53,109,45,51,46,55,53,32,48,97,49,46,53,32,49,46,53,32,48,32,48,49,45,51,32,48,109,51,32,48,97,49,46,53,32,49,46,53,32,48,32,48,48,45,51,32,48,109,45,57,46,55,53,32,48,104,57,46,55,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,115,101,116,116,105,110,103,115,86,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,54,32,49,51,46,53,86,51,46,55,53,109,48,32,57,46,55,53,97,49,46,53,32,49,46,53,32,48,32,48,49,48,32,51,109,48,45,51,97,49,46,53,32,49,46,53,32,48,32,48,48,48,32,51,109,48,32,51,46,55,53,86,49,54,46,53,109,49,50,45,51,86,51,46,55,53,109,48,32,57,46,55,53,97,49,46,53,32,49,46,53,32,48,32,48,49,48,32,51,109,48,45,51,97,49,46,53,32,49,46,53,32,48,32,48,48,48,32,51,109,48,32,51,46,55,53,86,49,54,46,53,109,45,54,45,57,86,51,46,55,53,109,48,32,51,46,55,53,97,49,46,53,32,49,46,53,32,48,32,48,49,48,32,51,109,48,45,51,97,49,46,53,32,49,46,53,32,48,32,48,48,48,32,51,109,48,32,57,46,55,53,86,49,48,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,115,99,97,110,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,55,46,53,32,51,46,55,53,72,54,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,51,46,55,53,32,54,118,49,46,53,77,49,54,46,53,32,51,46,55,53,72,49,56,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,50,48,46,50,53,32,54,118,49,46,53,109,48,32,57,86,49,56,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,49,56,32,50,48,46,50,53,104,45,49,46,53,109,45,57,32,48,72,54,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,51,46,55,53,32,49,56,118,45,49,46,53,77,49,53,32,49,50,97,51,32,51,32,48,32,49,49,45,54,32,48,32,51,32,51,32,48,32,48,49,54,32,48,122,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,100,101,115,107,116,111,112,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,49,55,46,50,53,118,49,46,48,48,55,97,51,32,51,32,48,32,48,49,45,46,56,55,57,32,50,46,49,50,50,76,55,46,53,32,50,49,104,57,108,45,46,54,50,49,45,46,54,50,49,65,51,32,51,32,48,32,48,49,49,53,32,49,56,46,50,53,55,86,49,55,46,50,53,109,54,45,49,50,86,49,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,50,46,50,53,32,50,46,50,53,72,53,46,50,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,51,32,49,53,86,53,46,50,53,109,49,56,32,48,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,49,56,46,55,53,32,51,72,53,46,50,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,51,32,53,46,50,53,109,49,56,32,48,86,49,50,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,50,46,50,53,32,50,46,50,53,72,53,46,50,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,51,32,49,50,86,53,46,50,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,97,108,101,114,116,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,52,46,56,53,55,32,49,55,46,48,56,50,97,50,51,46,56,52,56,32,50,51,46,56,52,56,32,48,32,48,48,53,46,52,53,52,45,49,46,51,49,65,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,49,56,32,57,46,55,53,118,45,46,55,86,57,65,54,32,54,32,48,32,48,48,54,32,57,118,46,55,53,97,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,45,50,46,51,49,50,32,54,46,48,50,50,99,49,46,55,51,51,46,54,52,32,51,46,53,54,32,49,46,48,56,53,32,53,46,52,53,53,32,49,46,51,49,109,53,46,55,49,52,32,48,97,50,52,46,50,53,53,32,50,52,46,50,53,53,32,48,32,48,49,45,53,46,55,49,52,32,48,109,53,46,55,49,52,32,48,97,51,32,51,32,48,32,49,49,45,53,46,55,49,52,32,48,77,51,46,49,50,52,32,55,46,53,65,56,46,57,54,57,32,56,46,57,54,57,32,48,32,48,49,53,46,50,57,50,32,51,109,49,51,46,52,49,54,32,48,97,56,46,57,54,57,32,56,46,57,54,57,32,48,32,48,49,50,46,49,54,56,32,52,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,98,101,108,108,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,52,46,56,53,55,32,49,55,46,48,56,50,97,50,51,46,56,52,56,32,50,51,46,56,52,56,32,48,32,48,48,53,46,52,53,52,45,49,46,51,49,65,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,49,56,32,57,46,55,53,118,45,46,55,86,57,65,54,32,54,32,48,32,48,48,54,32,57,118,46,55,53,97,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,45,50,46,51,49,50,32,54,46,48,50,50,99,49,46,55,51,51,46,54,52,32,51,46,53,54,32,49,46,48,56,53,32,53,46,52,53,53,32,49,46,51,49,109,53,46,55,49,52,32,48,97,50,52,46,50,53,53,32,50,52,46,50,53,53,32,48,32,48,49,45,53,46,55,49,52,32,48,109,53,46,55,49,52,32,48,97,51,32,51,32,48,32,49,49,45,53,46,55,49,52,32,48,77,51,46,49,50,52,32,55,46,53,65,56,46,57,54,57,32,56,46,57,54,57,32,48,32,48,49,53,46,50,57,50,32,51,109,49,51,46,52,49,54,32,48,97,56,46,57,54,57,32,56,46,57,54,57,32,48,32,48,49,50,46,49,54,56,32,52,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,114,101,102,114,101,115,104,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,54,46,48,50,51,32,57,46,51,52,56,104,52,46,57,57,50,118,45,46,48,48,49,77,50,46,57,56,53,32,49,57,46,54,52,52,118,45,52,46,57,57,50,109,48,32,48,104,52,46,57,57,50,109,45,52,46,57,57,51,32,48,108,51,46,49,56,49,32,51,46,49,56,51,97,56,46,50,53,32,56,46,50,53,32,48,32,48,48,49,51,46,56,48,51,45,51,46,55,77,52,46,48,51,49,32,57,46,56,54,53,97,56,46,50,53,32,56,46,50,53,32,48,32,48,49,49,51,46,56,48,51,45,51,46,55,108,51,46,49,56,49,32,51,46,49,56,50,109,48,45,52,46,57,57,49,118,52,46,57,57,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,98,97,114,115,52,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,46,55,53,32,53,46,50,53,104,49,54,46,53,109,45,49,54,46,53,32,52,46,53,104,49,54,46,53,109,45,49,54,46,53,32,52,46,53,104,49,54,46,53,109,45,49,54,46,53,32,52,46,53,104,49,54,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,98,97,114,115,51,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,46,55,53,32,54,46,55,53,104,49,54,46,53,77,51,46,55,53,32,49,50,104,49,54,46,53,109,45,49,54,46,53,32,53,46,50,53,104,49,54,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,108,111,103,111,117,116,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,50,46,55,53,32,49,53,108,51,45,51,109,48,32,48,108,45,51,45,51,109,51,32,51,104,45,55,46,53,77,50,49,32,49,50,97,57,32,57,32,48,32,49,49,45,49,56,32,48,32,57,32,57,32,48,32,48,49,49,56,32,48,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,115,97,118,101,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,54,46,53,32,51,46,55,53,86,49,54,46,53,76,49,50,32,49,52,46,50,53,32,55,46,53,32,49,54,46,53,86,51,46,55,53,109,57,32,48,72,49,56,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,50,48,46,50,53,32,54,118,49,50,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,49,56,32,50,48,46,50,53,72,54,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,51,46,55,53,32,49,56,86,54,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,54,32,51,46,55,53,104,49,46,53,109,57,32,48,104,45,57,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,101,109,97,105,108,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,50,49,46,55,53,32,54,46,55,53,118,49,48,46,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,50,46,50,53,32,50,46,50,53,104,45,49,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,50,46,50,53,45,50,46,50,53,86,54,46,55,53,109,49,57,46,53,32,48,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,49,57,46,53,32,52,46,53,104,45,49,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,32,50,46,50,53,109,49,57,46,53,32,48,118,46,50,52,51,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,49,46,48,55,32,49,46,57,49,54,108,45,55,46,53,32,52,46,54,49,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,50,46,51,54,32,48,76,51,46,51,50,32,56,46,57,49,97,50,46,50,53,32,50,46,50,53,32,48,32,48,49,45,49,46,48,55,45,49,46,57,49,54,86,54,46,55,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,101,120,112,97,110,100,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,46,55,53,32,51,46,55,53,118,52,46,53,109,48,45,52,46,53,104,52,46,53,109,45,52,46,53,32,48,76,57,32,57,77,51,46,55,53,32,50,48,46,50,53,118,45,52,46,53,109,48,32,52,46,53,104,52,46,53,109,45,52,46,53,32,48,76,57,32,49,53,77,50,48,46,50,53,32,51,46,55,53,104,45,52,46,53,109,52,46,53,32,48,118,52,46,53,109,48,45,52,46,53,76,49,53,32,57,109,53,46,50,53,32,49,49,46,50,53,104,45,52,46,53,109,52,46,53,32,48,118,45,52,46,53,109,48,32,52,46,53,76,49,53,32,49,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,115,104,114,105,110,107,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,57,86,52,46,53,77,57,32,57,72,52,46,53,77,57,32,57,76,51,46,55,53,32,51,46,55,53,77,57,32,49,53,118,52,46,53,77,57,32,49,53,72,52,46,53,77,57,32,49,53,108,45,53,46,50,53,32,53,46,50,53,77,49,53,32,57,104,52,46,53,77,49,53,32,57,86,52,46,53,77,49,53,32,57,108,53,46,50,53,45,53,46,50,53,77,49,53,32,49,53,104,52,46,53,77,49,53,32,49,53,118,52,46,53,109,48,45,52,46,53,108,53,46,50,53,32,53,46,50,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,111,107,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,32,97,114,105,97,45,104,105,100,100,101,110,61,34,116,114,117,101,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,49,50,46,55,53,76,49,49,46,50,53,32,49,53,32,49,53,32,57,46,55,53,77,50,49,32,49,50,97,57,32,57,32,48,32,49,49,45,49,56,32,48,32,57,32,57,32,48,32,48,49,49,56,32,48,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,102,97,105,108,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,46,55,53,32,57,46,55,53,108,52,46,53,32,52,46,53,109,48,45,52,46,53,108,45,52,46,53,32,52,46,53,77,50,49,32,49,50,97,57,32,57,32,48,32,49,49,45,49,56,32,48,32,57,32,57,32,48,32,48,49,49,56,32,48,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,117,112,108,111,97,100,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,32,49,54,46,53,118,50,46,50,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,53,46,50,53,32,50,49,104,49,51,46,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,49,32,49,56,46,55,53,86,49,54,46,53,109,45,49,51,46,53,45,57,76,49,50,32,51,109,48,32,48,108,52,46,53,32,52,46,53,77,49,50,32,51,118,49,51,46,53,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,100,111,119,110,108,111,97,100,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,32,49,54,46,53,118,50,46,50,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,53,46,50,53,32,50,49,104,49,51,46,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,49,32,49,56,46,55,53,86,49,54,46,53,77,49,54,46,53,32,49,50,76,49,50,32,49,54,46,53,109,48,32,48,76,55,46,53,32,49,50,109,52,46,53,32,52,46,53,86,51,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,98,111,108,116,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,46,55,53,32,49,51,46,53,108,49,48,46,53,45,49,49,46,50,53,76,49,50,32,49,48,46,53,104,56,46,50,53,76,57,46,55,53,32,50,49,46,55,53,32,49,50,32,49,51,46,53,72,51,46,55,53,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,104,111,109,101,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,50,46,50,53,32,49,50,108,56,46,57,53,52,45,56,46,57,53,53,99,46,52,52,45,46,52,51,57,32,49,46,49,53,50,45,46,52,51,57,32,49,46,53,57,49,32,48,76,50,49,46,55,53,32,49,50,77,52,46,53,32,57,46,55,53,118,49,48,46,49,50,53,99,48,32,46,54,50,49,46,53,48,52,32,49,46,49,50,53,32,49,46,49,50,53,32,49,46,49,50,53,72,57,46,55,53,118,45,52,46,56,55,53,99,48,45,46,54,50,49,46,53,48,52,45,49,46,49,50,53,32,49,46,49,50,53,45,49,46,49,50,53,104,50,46,50,53,99,46,54,50,49,32,48,32,49,46,49,50,53,46,53,48,52,32,49,46,49,50,53,32,49,46,49,50,53,86,50,49,104,52,46,49,50,53,99,46,54,50,49,32,48,32,49,46,49,50,53,45,46,53,48,52,32,49,46,49,50,53,45,49,46,49,50,53,86,57,46,55,53,77,56,46,50,53,32,50,49,104,56,46,50,53,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,108,105,110,107,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,51,46,49,57,32,56,46,54,56,56,97,52,46,53,32,52,46,53,32,48,32,48,49,49,46,50,52,50,32,55,46,50,52,52,108,45,52,46,53,32,52,46,53,97,52,46,53,32,52,46,53,32,48,32,48,49,45,54,46,51,54,52,45,54,46,51,54,52,108,49,46,55,53,55,45,49,46,55,53,55,109,49,51,46,51,53,45,46,54,50,50,108,49,46,55,53,55,45,49,46,55,53,55,97,52,46,53,32,52,46,53,32,48,32,48,48,45,54,46,51,54,52,45,54,46,51,54,52,108,45,52,46,53,32,52,46,53,97,52,46,53,32,52,46,53,32,48,32,48,48,49,46,50,52,50,32,55,46,50,52,52,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,115,104,105,101,108,100,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,57,32,49,50,46,55,53,76,49,49,46,50,53,32,49,53,32,49,53,32,57,46,55,53,109,45,51,45,55,46,48,51,54,65,49,49,46,57,53,57,32,49,49,46,57,53,57,32,48,32,48,49,51,46,53,57,56,32,54,32,49,49,46,57,57,32,49,49,46,57,57,32,48,32,48,48,51,32,57,46,55,52,57,99,48,32,53,46,53,57,50,32,51,46,56,50,52,32,49,48,46,50,57,32,57,32,49,49,46,54,50,51,32,53,46,49,55,54,45,49,46,51,51,50,32,57,45,54,46,48,51,32,57,45,49,49,46,54,50,50,32,48,45,49,46,51,49,45,46,50,49,45,50,46,53,55,49,45,46,53,57,56,45,51,46,55,53,49,104,45,46,49,53,50,99,45,51,46,49,57,54,32,48,45,54,46,49,45,49,46,50,52,56,45,56,46,50,53,45,51,46,50,56,53,122,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,98,97,114,115,100,111,119,110,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,51,32,52,46,53,104,49,52,46,50,53,77,51,32,57,104,57,46,55,53,77,51,32,49,51,46,53,104,57,46,55,53,109,52,46,53,45,52,46,53,118,49,50,109,48,32,48,108,45,51,46,55,53,45,51,46,55,53,77,49,55,46,50,53,32,50,49,76,50,49,32,49,55,46,50,53,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,97,114,114,111,119,100,111,119,110,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,50,32,52,46,53,118,49,53,109,48,32,48,108,54,46,55,53,45,54,46,55,53,77,49,50,32,49,57,46,53,108,45,54,46,55,53,45,54,46,55,53,34,32,47,62,32,60,47,115,118,103,62,32,96,44,10,32,32,97,114,114,111,119,117,112,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,50,32,49,57,46,53,118,45,49,53,109,48,32,48,108,45,54,46,55,53,32,54,46,55,53,77,49,50,32,52,46,53,108,54,46,55,53,32,54,46,55,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,119,97,114,110,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,50,32,57,118,51,46,55,53,109,45,57,46,51,48,51,32,51,46,51,55,54,99,45,46,56,54,54,32,49,46,53,46,50,49,55,32,51,46,51,55,52,32,49,46,57,52,56,32,51,46,51,55,52,104,49,52,46,55,49,99,49,46,55,51,32,48,32,50,46,56,49,51,45,49,46,56,55,52,32,49,46,57,52,56,45,51,46,51,55,52,76,49,51,46,57,52,57,32,51,46,51,55,56,99,45,46,56,54,54,45,49,46,53,45,51,46,48,51,50,45,49,46,53,45,51,46,56,57,56,32,48,76,50,46,54,57,55,32,49,54,46,49,50,54,122,77,49,50,32,49,53,46,55,53,104,46,48,48,55,118,46,48,48,56,72,49,50,118,45,46,48,48,56,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,105,110,102,111,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,49,46,50,53,32,49,49,46,50,53,108,46,48,52,49,45,46,48,50,97,46,55,53,46,55,53,32,48,32,48,49,49,46,48,54,51,46,56,53,50,108,45,46,55,48,56,32,50,46,56,51,54,97,46,55,53,46,55,53,32,48,32,48,48,49,46,48,54,51,46,56,53,51,108,46,48,52,49,45,46,48,50,49,77,50,49,32,49,50,97,57,32,57,32,48,32,49,49,45,49,56,32,48,32,57,32,57,32,48,32,48,49,49,56,32,48,122,109,45,57,45,51,46,55,53,104,46,48,48,56,118,46,48,48,56,72,49,50,86,56,46,50,53,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,101,120,99,108,97,109,97,116,105,111,110,84,114,105,97,110,103,108,101,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,50,32,57,118,51,46,55,53,109,45,57,46,51,48,51,32,51,46,51,55,54,99,45,46,56,54,54,32,49,46,53,46,50,49,55,32,51,46,51,55,52,32,49,46,57,52,56,32,51,46,51,55,52,104,49,52,46,55,49,99,49,46,55,51,32,48,32,50,46,56,49,51,45,49,46,56,55,52,32,49,46,57,52,56,45,51,46,51,55,52,76,49,51,46,57,52,57,32,51,46,51,55,56,99,45,46,56,54,54,45,49,46,53,45,51,46,48,51,50,45,49,46,53,45,51,46,56,57,56,32,48,76,50,46,54,57,55,32,49,54,46,49,50,54,122,77,49,50,32,49,53,46,55,53,104,46,48,48,55,118,46,48,48,56,72,49,50,118,45,46,48,48,56,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,116,104,117,109,98,85,112,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,54,46,54,51,51,32,49,48,46,53,99,46,56,48,54,32,48,32,49,46,53,51,51,45,46,52,52,54,32,50,46,48,51,49,45,49,46,48,56,97,57,46,48,52,49,32,57,46,48,52,49,32,48,32,48,49,50,46,56,54,49,45,50,46,52,99,46,55,50,51,45,46,51,56,52,32,49,46,51,53,45,46,57,53,54,32,49,46,54,53,51,45,49,46,55,49,53,97,52,46,52,57,56,32,52,46,52,57,56,32,48,32,48,48,46,51,50,50,45,49,46,54,55,50,86,51,97,46,55,53,46,55,53,32,48,32,48,49,46,55,53,45,46,55,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,49,49,54,46,53,32,52,46,53,99,48,32,49,46,49,53,50,45,46,50,54,32,50,46,50,52,51,45,46,55,50,51,32,51,46,50,49,56,45,46,50,54,54,46,53,53,56,46,49,48,55,32,49,46,50,56,50,46,55,50,53,32,49,46,50,56,50,104,51,46,49,50,54,99,49,46,48,50,54,32,48,32,49,46,57,52,53,46,54,57,52,32,50,46,48,53,52,32,49,46,55,49,53,46,48,52,53,46,52,50,50,46,48,54,56,46,56,53,46,48,54,56,32,49,46,50,56,53,97,49,49,46,57,53,32,49,49,46,57,53,32,48,32,48,49,45,50,46,54,52,57,32,55,46,53,50,49,99,45,46,51,56,56,46,52,56,50,45,46,57,56,55,46,55,50,57,45,49,46,54,48,53,46,55,50,57,72,49,51,46,52,56,99,45,46,52,56,51,32,48,45,46,57,54,52,45,46,48,55,56,45,49,46,52,50,51,45,46,50,51,108,45,51,46,49,49,52,45,49,46,48,52,97,52,46,53,48,49,32,52,46,53,48,49,32,48,32,48,48,45,49,46,52,50,51,45,46,50,51,72,53,46,57,48,52,77,49,52,46,50,53,32,57,104,50,46,50,53,77,53,46,57,48,52,32,49,56,46,55,53,99,46,48,56,51,46,50,48,53,46,49,55,51,46,52,48,53,46,50,55,46,54,48,50,46,49,57,55,46,52,45,46,48,55,56,46,56,57,56,45,46,53,50,51,46,56,57,56,104,45,46,57,48,56,99,45,46,56,56,57,32,48,45,49,46,55,49,51,45,46,53,49,56,45,49,46,57,55,50,45,49,46,51,54,56,97,49,50,32,49,50,32,48,32,48,49,45,46,53,50,49,45,51,46,53,48,55,99,48,45,49,46,53,53,51,46,50,57,53,45,51,46,48,51,54,46,56,51,49,45,52,46,51,57,56,67,51,46,51,56,55,32,49,48,46,50,48,51,32,52,46,49,54,55,32,57,46,55,53,32,53,32,57,46,55,53,104,49,46,48,53,51,99,46,52,55,50,32,48,32,46,55,52,53,46,53,53,54,46,53,46,57,54,97,56,46,57,53,56,32,56,46,57,53,56,32,48,32,48,48,45,49,46,51,48,50,32,52,46,54,54,53,99,48,32,49,46,49,57,52,46,50,51,50,32,50,46,51,51,51,46,54,53,52,32,51,46,51,55,53,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,98,97,99,107,119,97,114,100,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,50,49,32,49,54,46,56,49,49,99,48,32,46,56,54,52,45,46,57,51,51,32,49,46,52,48,53,45,49,46,54,56,51,46,57,55,55,108,45,55,46,49,48,56,45,52,46,48,54,50,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,48,45,49,46,57,53,51,108,55,46,49,48,56,45,52,46,48,54,50,65,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,50,49,32,56,46,54,56,56,118,56,46,49,50,51,122,77,49,49,46,50,53,32,49,54,46,56,49,49,99,48,32,46,56,54,52,45,46,57,51,51,32,49,46,52,48,53,45,49,46,54,56,51,46,57,55,55,108,45,55,46,49,48,56,45,52,46,48,54,50,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,48,45,49,46,57,53,51,76,57,46,53,54,55,32,55,46,55,49,97,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,49,46,54,56,51,46,57,55,55,118,56,46,49,50,51,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,99,104,105,112,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,56,46,50,53,32,51,118,49,46,53,77,52,46,53,32,56,46,50,53,72,51,109,49,56,32,48,104,45,49,46,53,77,52,46,53,32,49,50,72,51,109,49,56,32,48,104,45,49,46,53,109,45,49,53,32,51,46,55,53,72,51,109,49,56,32,48,104,45,49,46,53,77,56,46,50,53,32,49,57,46,53,86,50,49,77,49,50,32,51,118,49,46,53,109,48,32,49,53,86,50,49,109,51,46,55,53,45,49,56,118,49,46,53,109,48,32,49,53,86,50,49,109,45,57,45,49,46,53,104,49,48,46,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,45,50,46,50,53,86,54,46,55,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,45,50,46,50,53,45,50,46,50,53,72,54,46,55,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,52,46,53,32,54,46,55,53,118,49,48,46,53,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,32,50,46,50,53,122,109,46,55,53,45,49,50,104,57,118,57,104,45,57,118,45,57,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,99,97,109,101,114,97,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,54,46,56,50,55,32,54,46,49,55,53,65,50,46,51,49,32,50,46,51,49,32,48,32,48,49,53,46,49,56,54,32,55,46,50,51,99,45,46,51,56,46,48,53,52,45,46,55,53,55,46,49,49,50,45,49,46,49,51,52,46,49,55,53,67,50,46,57,57,57,32,55,46,53,56,32,50,46,50,53,32,56,46,53,48,55,32,50,46,50,53,32,57,46,53,55,52,86,49,56,97,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,46,50,53,32,50,46,50,53,104,49,53,65,50,46,50,53,32,50,46,50,53,32,48,32,48,48,50,49,46,55,53,32,49,56,86,57,46,53,55,52,99,48,45,49,46,48,54,55,45,46,55,53,45,49,46,57,57,52,45,49,46,56,48,50,45,50,46,49,54,57,97,52,55,46,56,54,53,32,52,55,46,56,54,53,32,48,32,48,48,45,49,46,49,51,52,45,46,49,55,53,32,50,46,51,49,32,50,46,51,49,32,48,32,48,49,45,49,46,54,52,45,49,46,48,53,53,108,45,46,56,50,50,45,49,46,51,49,54,97,50,46,49,57,50,32,50,46,49,57,50,32,48,32,48,48,45,49,46,55,51,54,45,49,46,48,51,57,32,52,56,46,55,55,52,32,52,56,46,55,55,52,32,48,32,48,48,45,53,46,50,51,50,32,48,32,50,46,49,57,50,32,50,46,49,57,50,32,48,32,48,48,45,49,46,55,51,54,32,49,46,48,51,57,108,45,46,56,50,49,32,49,46,51,49,54,122,34,32,47,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,54,46,53,32,49,50,46,55,53,97,52,46,53,32,52,46,53,32,48,32,49,49,45,57,32,48,32,52,46,53,32,52,46,53,32,48,32,48,49,57,32,48,122,77,49,56,46,55,53,32,49,48,46,53,104,46,48,48,56,118,46,48,48,56,104,45,46,48,48,56,86,49,48,46,53,122,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,97,114,114,111,119,115,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,55,46,53,32,50,49,76,51,32,49,54,46,53,109,48,32,48,76,55,46,53,32,49,50,77,51,32,49,54,46,53,104,49,51,46,53,109,48,45,49,51,46,53,76,50,49,32,55,46,53,109,48,32,48,76,49,54,46,53,32,49,50,77,50,49,32,55,46,53,72,55,46,53,34,32,47,62,32,60,47,115,118,103,62,96,44,10,32,32,100,111,99,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,100,61,34,77,49,57,46,53,32,49,52,46,50,53,118,45,50,46,54,50,53,97,51,46,51,55,53,32,51,46,51,55,53,32,48,32,48,48,45,51,46,51,55,53,45,51,46,51,55,53,104,45,49,46,53,65,49,46,49,50,53,32,49,46,49,50,53,32,48,32,48,49,49,51,46,53,32,55,46,49,50,53,118,45,49,46,53,97,51,46,51,55,53,32,51,46,51,55,53,32,48,32,48,48,45,51,46,51,55,53,45,51,46,51,55,53,72,56,46,50,53,109,50,46,50,53,32,48,72,53,46,54,50,53,99,45,46,54,50,49,32,48,45,49,46,49,50,53,46,53,48,52,45,49,46,49,50,53,32,49,46,49,50,53,118,49,55,46,50,53,99,48,32,46,54,50,49,46,53,48,52,32,49,46,49,50,53,32,49,46,49,50,53,32,49,46,49,50,53,104,49,50,46,55,53,99,46,54,50,49,32,48,32,49,46,49,50,53,45,46,53,48,52,32,49,46,49,50,53,45,49,46,49,50,53,86,49,49,46,50,53,97,57,32,57,32,48,32,48,48,45,57,45,57,122,34,32,47,62,60,47,115,118,103,62,96,44,10,32,32,119,105,102,105,58,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,50,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,62,60,112,97,116,104,32,100,61,34,77,53,32,49,50,46,53,53,97,49,49,32,49,49,32,48,32,48,32,49,32,49,52,46,48,56,32,48,34,47,62,60,112,97,116,104,32,100,61,34,77,49,46,52,50,32,57,97,49,54,32,49,54,32,48,32,48,32,49,32,50,49,46,49,54,32,48,34,47,62,60,112,97,116,104,32,100,61,34,77,56,46,53,51,32,49,54,46,49,49,97,54,32,54,32,48,32,48,32,49,32,54,46,57,53,32,48,34,47,62,60,108,105,110,101,32,120,49,61,34,49,50,34,32,121,49,61,34,50,48,34,32,120,50,61,34,49,50,46,48,49,34,32,121,50,61,34,50,48,34,47,62,60,47,115,118,103,62,96,44,10,125,59,10,10,101,120,112,111,114,116,32,99,111,110,115,116,32,116,105,112,67,111,108,111,114,115,32,61,32,123,10,32,32,103,114,101,101,110,58,32,39,98,103,45,103,114,101,101,110,45,49,48,48,32,116,101,120,116,45,103,114,101,101,110,45,57,48,48,32,114,105,110,103,45,103,114,101,101,110,45,51,48,48,39,44,10,32,32,121,101,108,108,111,119,58,32,39,98,103,45,121,101,108,108,111,119,45,49,48,48,32,116,101,120,116,45,121,101,108,108,111,119,45,57,48,48,32,114,105,110,103,45,121,101,108,108,111,119,45,51,48,48,39,44,10,32,32,114,101,100,58,32,39,98,103,45,114,101,100,45,49,48,48,32,116,101,120,116,45,114,101,100,45,57,48,48,32,114,105,110,103,45,114,101,100,45,51,48,48,39,44,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,66,117,116,116,111,110,40,123,116,105,116,108,101,44,32,111,110,99,108,105,99,107,44,32,100,105,115,97,98,108,101,100,44,32,99,108,115,44,32,105,99,111,110,44,32,114,101,102,44,32,99,111,108,111,114,115,44,32,104,111,118,101,114,99,111,108,111,114,44,32,100,105,115,97,98,108,101,100,99,111,108,111,114,125,41,32,123,10,32,32,99,111,110,115,116,32,91,115,112,105,110,44,32,115,101,116,83,112,105,110,93,32,61,32,117,115,101,83,116,97,116,101,40,102,97,108,115,101,41,59,10,32,32,99,111,110,115,116,32,99,98,32,61,32,102,117,110,99,116,105,111,110,40,101,118,41,32,123,10,32,32,32,32,99,111,110,115,116,32,114,101,115,32,61,32,111,110,99,108,105,99,107,32,63,32,111,110,99,108,105,99,107,40,41,32,58,32,110,117,108,108,59,10,32,32,32,32,105,102,32,40,114,101,115,32,38,38,32,116,121,112,101,111,102,32,40,114,101,115,46,99,97,116,99,104,41,32,61,61,61,32,39,102,117,110,99,116,105,111,110,39,41,32,123,10,32,32,32,32,32,32,115,101,116,83,112,105,110,40,116,114,117,101,41,59,10,32,32,32,32,32,32,114,101,115,46,99,97,116,99,104,40,40,41,32,61,62,32,102,97,108,115,101,41,46,116,104,101,110,40,40,41,32,61,62,32,115,101,116,83,112,105,110,40,102,97,108,115,101,41,41,59,10,32,32,32,32,125,10,32,32,125,59,10,32,32,105,102,32,40,33,99,111,108,111,114,115,41,32,99,111,108,111,114,115,32,61,32,39,98,103,45,98,108,117,101,45,54,48,48,32,104,111,118,101,114,58,98,103,45,98,108,117,101,45,53,48,48,32,100,105,115,97,98,108,101,100,58,98,103,45,98,108,117,101,45,52,48,48,39,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,98,117,116,116,111,110,32,116,121,112,101,61,34,98,117,116,116,111,110,34,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,106,117,115,116,105,102,121,45,99,101,110,116,101,114,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,50,32,114,111,117,110,100,101,100,32,112,120,45,50,46,53,32,112,121,45,49,46,53,32,116,101,120,116,45,115,109,32,102,111,110,116,45,115,101,109,105,98,111,108,100,32,116,101,120,116,45,119,104,105,116,101,32,115,104,97,100,111,119,45,115,109,32,36,123,99,111,108,111,114,115,125,32,36,123,99,108,115,125,34,10,32,32,114,101,102,61,36,123,114,101,102,125,32,111,110,99,108,105,99,107,61,36,123,99,98,125,32,100,105,115,97,98,108,101,100,61,36,123,100,105,115,97,98,108,101,100,32,124,124,32,115,112,105,110,125,32,62,10,32,32,36,123,116,105,116,108,101,125,10,32,32,60,36,123,115,112,105,110,32,63,32,73,99,111,110,115,46,114,101,102,114,101,115,104,32,58,32,105,99,111,110,125,32,99,108,97,115,115,61,34,119,45,52,32,36,123,115,112,105,110,32,63,32,39,97,110,105,109,97,116,101,45,115,112,105,110,39,32,58,32,39,39,125,34,32,47,62,10,60,47,47,62,96,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,78,111,116,105,102,105,99,97,116,105,111,110,40,123,111,107,44,32,116,101,120,116,44,32,99,108,111,115,101,125,41,32,123,10,32,32,99,111,110,115,116,32,99,108,111,115,101,98,116,110,32,61,32,117,115,101,82,101,102,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,102,114,111,109,32,61,32,39,116,114,97,110,115,108,97,116,101,45,121,45,50,32,111,112,97,99,105,116,121,45,48,32,115,109,58,116,114,97,110,115,108,97,116,101,45,121,45,48,32,115,109,58,116,114,97,110,115,108,97,116,101,45,120,45,50,39,59,10,32,32,99,111,110,115,116,32,116,111,32,61,32,39,116,114,97,110,115,108,97,116,101,45,121,45,48,32,111,112,97,99,105,116,121,45,49,48,48,32,115,109,58,116,114,97,110,115,108,97,116,101,45,120,45,48,39,59,10,32,32,99,111,110,115,116,32,91,116,114,44,32,115,101,116,84,114,93,32,61,32,117,115,101,83,116,97,116,101,40,102,114,111,109,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,102,117,110,99,116,105,111,110,40,41,32,123,10,32,32,32,32,115,101,116,84,114,40,116,111,41,59,32,10,32,32,32,32,115,101,116,84,105,109,101,111,117,116,40,101,118,32,61,62,32,99,108,111,115,101,98,116,110,32,38,38,32,99,108,111,115,101,98,116,110,46,99,117,114,114,101,110,116,46,99,108,105,99,107,32,38,38,32,99,108,111,115,101,98,116,110,46,99,117,114,114,101,110,116,46,99,108,105,99,107,40,41,44,32,49,53,48,48,41,59,10,32,32,125,44,32,91,93,41,59,10,32,32,99,111,110,115,116,32,111,110,99,108,111,115,101,32,61,32,101,118,32,61,62,32,123,32,115,101,116,84,114,40,102,114,111,109,41,59,32,115,101,116,84,105,109,101,111,117,116,40,99,108,111,115,101,44,32,51,48,48,41,59,32,125,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,97,114,105,97,45,108,105,118,101,61,34,97,115,115,101,114,116,105,118,101,34,32,99,108,97,115,115,61,34,122,45,49,48,32,112,111,105,110,116,101,114,45,101,118,101,110,116,115,45,110,111,110,101,32,97,98,115,111,108,117,116,101,32,105,110,115,101,116,45,48,32,102,108,101,120,32,105,116,101,109,115,45,101,110,100,32,112,120,45,52,32,112,121,45,54,32,115,109,58,105,116,101,109,115,45,115,116,97,114,116,32,115,109,58,112,45,54,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,119,45,102,117,108,108,32,102,108,101,120,45,99,111,108,32,105,116,101,109,115,45,99,101,110,116,101,114,32,115,112,97,99,101,45,121,45,52,32,115,109,58,105,116,101,109,115,45,101,110,100,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,111,105,110,116,101,114,45,101,118,101,110,116,115,45,97,117,116,111,32,119,45,102,117,108,108,32,109,97,120,45,119,45,115,109,32,111,118,101,114,102,108,111,119,45,104,105,100,100,101,110,32,114,111,117,110,100,101,100,45,108,103,32,98,103,45,119,104,105,116,101,32,115,104,97,100,111,119,45,108,103,32,114,105,110,103,45,49,32,114,105,110,103,45,98,108,97,99,107,32,114,105,110,103,45,111,112,97,99,105,116,121,45,53,32,116,114,97,110,115,102,111,114,109,32,101,97,115,101,45,111,117,116,32,100,117,114,97,116,105,111,110,45,51,48,48,32,116,114,97,110,115,105,116,105,111,110,32,36,123,116,114,125,34,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,45,52,34,62,10,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,115,116,97,114,116,34,62,10,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,45,115,104,114,105,110,107,45,48,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,36,123,111,107,32,63,32,73,99,111,110,115,46,111,107,32,58,32,73,99,111,110,115,46,102,97,105,108,125,32,99,108,97,115,115,61,34,104,45,54,32,119,45,54,32,36,123,111,107,32,63,32,39,116,101,120,116,45,103,114,101,101,110,45,52,48,48,39,32,58,32,39,116,101,120,116,45,114,101,100,45,52,48,48,39,125,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,108,45,51,32,119,45,48,32,102,108,101,120,45,49,32,112,116,45,48,46,53,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,112,32,99,108,97,115,115,61,34,116,101,120,116,45,115,109,32,102,111,110,116,45,109,101,100,105,117,109,32,116,101,120,116,45,103,114,97,121,45,57,48,48,34,62,36,123,116,101,120,116,125,60,47,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,112,32,99,108,97,115,115,61,34,104,105,100,100,101,110,32,109,116,45,49,32,116,101,120,116,45,115,109,32,116,101,120,116,45,103,114,97,121,45,53,48,48,34,62,65,110,121,111,110,101,32,119,105,116,104,32,97,32,108,105,110,107,32,99,97,110,32,110,111,119,32,118,105,101,119,32,116,104,105,115,32,102,105,108,101,46,60,47,112,62,10,32,32,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,108,45,52,32,102,108,101,120,32,102,108,101,120,45,115,104,114,105,110,107,45,48,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,117,116,116,111,110,32,116,121,112,101,61,34,98,117,116,116,111,110,34,32,114,101,102,61,36,123,99,108,111,115,101,98,116,110,125,32,111,110,99,108,105,99,107,61,36,123,111,110,99,108,111,115,101,125,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,114,111,117,110,100,101,100,45,109,100,32,98,103,45,119,104,105,116,101,32,116,101,120,116,45,103,114,97,121,45,52,48,48,32,104,111,118,101,114,58,116,101,120,116,45,103,114,97,121,45,53,48,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,112,97,110,32,99,108,97,115,115,61,34,115,114,45,111,110,108,121,34,62,67,108,111,115,101,60,47,115,112,97,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,118,103,32,99,108,97,115,115,61,34,104,45,53,32,119,45,53,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,48,32,50,48,34,32,102,105,108,108,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,32,97,114,105,97,45,104,105,100,100,101,110,61,34,116,114,117,101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,112,97,116,104,32,100,61,34,77,54,46,50,56,32,53,46,50,50,97,46,55,53,46,55,53,32,48,32,48,48,45,49,46,48,54,32,49,46,48,54,76,56,46,57,52,32,49,48,108,45,51,46,55,50,32,51,46,55,50,97,46,55,53,46,55,53,32,48,32,49,48,49,46,48,54,32,49,46,48,54,76,49,48,32,49,49,46,48,54,108,51,46,55,50,32,51,46,55,50,97,46,55,53,46,55,53,32,48,32,49,48,49,46,48,54,45,49,46,48,54,76,49,49,46,48,54,32,49,48,108,51,46,55,50,45,51,46,55,50,97,46,55,53,46,55,53,32,48,32,48,48,45,49,46,48,54,45,49,46,48,54,76,49,48,32,56,46,57,52,32,54,46,50,56,32,53,46,50,50,122,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,76,111,103,105,110,40,123,108,111,103,105,110,70,110,44,32,108,111,103,111,73,99,111,110,44,32,116,105,116,108,101,44,32,116,105,112,84,101,120,116,125,41,32,123,10,32,32,99,111,110,115,116,32,91,117,115,101,114,44,32,115,101,116,85,115,101,114,93,32,61,32,117,115,101,83,116,97,116,101,40,39,39,41,59,10,32,32,99,111,110,115,116,32,91,112,97,115,115,44,32,115,101,116,80,97,115,115,93,32,61,32,117,115,101,83,116,97,116,101,40,39,39,41,59,10,32,32,99,111,110,115,116,32,111,110,115,117,98,109,105,116,32,61,32,102,117,110,99,116,105,111,110,40,101,118,41,32,123,10,32,32,32,32,99,111,110,115,116,32,97,117,116,104,104,100,114,32,61,32,39,66,97,115,105,99,32,39,32,43,32,98,116,111,97,40,117,115,101,114,32,43,32,39,58,39,32,43,32,112,97,115,115,41,59,10,32,32,32,32,99,111,110,115,116,32,104,101,97,100,101,114,115,32,61,32,123,65,117,116,104,111,114,105,122,97,116,105,111,110,58,32,97,117,116,104,104,100,114,125,59,10,32,32,32,32,114,101,116,117,114,110,32,102,101,116,99,104,40,39,114,101,115,116,47,108,111,103,105,110,39,44,32,123,104,101,97,100,101,114,115,125,41,46,116,104,101,110,40,108,111,103,105,110,70,110,41,46,102,105,110,97,108,108,121,40,114,32,61,62,32,115,101,116,80,97,115,115,40,39,39,41,41,59,10,32,32,125,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,104,45,102,117,108,108,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,106,117,115,116,105,102,121,45,99,101,110,116,101,114,32,98,103,45,115,108,97,116,101,45,50,48,48,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,111,114,100,101,114,32,114,111,117,110,100,101,100,32,98,103,45,119,104,105,116,101,32,119,45,57,54,32,112,45,53,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,53,32,112,121,45,50,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,106,117,115,116,105,102,121,45,99,101,110,116,101,114,32,103,97,112,45,120,45,52,34,62,10,32,32,32,32,32,32,60,36,123,108,111,103,111,73,99,111,110,125,32,99,108,97,115,115,61,34,104,45,49,50,32,115,116,114,111,107,101,45,99,121,97,110,45,54,48,48,32,115,116,114,111,107,101,45,49,34,32,47,62,10,32,32,32,32,32,32,60,104,49,32,99,108,97,115,115,61,34,102,111,110,116,45,98,111,108,100,32,116,101,120,116,45,120,108,34,62,36,123,116,105,116,108,101,32,124,124,32,39,76,111,103,105,110,39,125,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,51,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,32,99,108,97,115,115,61,34,98,108,111,99,107,32,116,101,120,116,45,115,109,32,109,98,45,49,32,100,97,114,107,58,116,101,120,116,45,119,104,105,116,101,34,62,85,115,101,114,110,97,109,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,105,110,112,117,116,32,116,121,112,101,61,34,116,101,120,116,34,32,97,117,116,111,99,111,109,112,108,101,116,101,61,34,99,117,114,114,101,110,116,45,117,115,101,114,34,32,114,101,113,117,105,114,101,100,10,32,32,32,32,32,32,32,32,99,108,97,115,115,61,34,102,111,110,116,45,110,111,114,109,97,108,32,98,103,45,119,104,105,116,101,32,114,111,117,110,100,101,100,32,98,111,114,100,101,114,32,98,111,114,100,101,114,45,103,114,97,121,45,51,48,48,32,119,45,102,117,108,108,32,10,32,32,32,32,32,32,32,32,102,108,101,120,45,49,32,112,121,45,48,46,53,32,112,120,45,50,32,116,101,120,116,45,103,114,97,121,45,57,48,48,32,112,108,97,99,101,104,111,108,100,101,114,58,116,101,120,116,45,103,114,97,121,45,52,48,48,10,32,32,32,32,32,32,32,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,32,115,109,58,116,101,120,116,45,115,109,32,115,109,58,108,101,97,100,105,110,103,45,54,32,100,105,115,97,98,108,101,100,58,99,117,114,115,111,114,45,110,111,116,45,97,108,108,111,119,101,100,10,32,32,32,32,32,32,32,32,100,105,115,97,98,108,101,100,58,98,103,45,103,114,97,121,45,49,48,48,32,100,105,115,97,98,108,101,100,58,116,101,120,116,45,103,114,97,121,45,53,48,48,34,10,32,32,32,32,32,32,32,32,111,110,105,110,112,117,116,61,36,123,101,118,32,61,62,32,115,101,116,85,115,101,114,40,101,118,46,116,97,114,103,101,116,46,118,97,108,117,101,41,125,32,118,97,108,117,101,61,36,123,117,115,101,114,125,32,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,51,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,32,99,108,97,115,115,61,34,98,108,111,99,107,32,116,101,120,116,45,115,109,32,109,98,45,49,32,100,97,114,107,58,116,101,120,116,45,119,104,105,116,101,34,62,80,97,115,115,119,111,114,100,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,105,110,112,117,116,32,116,121,112,101,61,34,112,97,115,115,119,111,114,100,34,32,97,117,116,111,99,111,109,112,108,101,116,101,61,34,99,117,114,114,101,110,116,45,112,97,115,115,119,111,114,100,34,32,114,101,113,117,105,114,101,100,10,32,32,32,32,32,32,32,32,99,108,97,115,115,61,34,102,111,110,116,45,110,111,114,109,97,108,32,98,103,45,119,104,105,116,101,32,114,111,117,110,100,101,100,32,98,111,114,100,101,114,32,98,111,114,100,101,114,45,103,114,97,121,45,51,48,48,32,119,45,102,117,108,108,32,102,108,101,120,45,49,32,112,121,45,48,46,53,32,112,120,45,50,32,116,101,120,116,45,103,114,97,121,45,57,48,48,32,112,108,97,99,101,104,111,108,100,101,114,58,116,101,120,116,45,103,114,97,121,45,52,48,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,32,115,109,58,116,101,120,116,45,115,109,32,115,109,58,108,101,97,100,105,110,103,45,54,32,100,105,115,97,98,108,101,100,58,99,117,114,115,111,114,45,110,111,116,45,97,108,108,111,119,101,100,32,100,105,115,97,98,108,101,100,58,98,103,45,103,114,97,121,45,49,48,48,32,100,105,115,97,98,108,101,100,58,116,101,120,116,45,103,114,97,121,45,53,48,48,34,10,32,32,32,32,32,32,32,32,111,110,105,110,112,117,116,61,36,123,101,118,32,61,62,32,115,101,116,80,97,115,115,40,101,118,46,116,97,114,103,101,116,46,118,97,108,117,101,41,125,10,32,32,32,32,32,32,32,32,118,97,108,117,101,61,36,123,112,97,115,115,125,32,111,110,99,104,97,110,103,101,61,36,123,111,110,115,117,98,109,105,116,125,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,116,45,55,34,62,10,32,32,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,83,105,103,110,32,73,110,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,108,111,103,111,117,116,125,32,111,110,99,108,105,99,107,61,36,123,111,110,115,117,98,109,105,116,125,32,99,108,115,61,34,102,108,101,120,32,119,45,102,117,108,108,32,106,117,115,116,105,102,121,45,99,101,110,116,101,114,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,116,45,53,32,116,101,120,116,45,115,108,97,116,101,45,52,48,48,32,116,101,120,116,45,120,115,34,62,36,123,116,105,112,84,101,120,116,125,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,67,111,108,111,114,101,100,40,123,105,99,111,110,44,32,116,101,120,116,44,32,99,111,108,111,114,115,125,41,32,123,10,32,32,99,111,108,111,114,115,32,124,124,61,32,39,98,103,45,115,108,97,116,101,45,49,48,48,32,116,101,120,116,45,115,108,97,116,101,45,57,48,48,39,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,115,112,97,110,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,49,46,53,32,112,121,45,48,46,53,34,62,10,32,32,36,123,105,99,111,110,32,38,38,32,104,116,109,108,96,60,36,123,105,99,111,110,125,32,99,108,97,115,115,61,34,119,45,53,32,104,45,53,34,32,47,62,96,125,10,32,32,60,115,112,97,110,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,98,108,111,99,107,32,102,111,110,116,45,109,101,100,105,117,109,32,114,111,117,110,100,101,100,45,109,100,32,112,120,45,50,32,112,121,45,49,32,116,101,120,116,45,120,115,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,36,123,99,111,108,111,114,115,125,34,62,36,123,116,101,120,116,125,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,83,116,97,116,40,123,116,105,116,108,101,44,32,116,101,120,116,44,32,116,105,112,84,101,120,116,44,32,116,105,112,73,99,111,110,44,32,116,105,112,67,111,108,111,114,115,44,32,99,111,108,111,114,115,125,41,32,123,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,102,108,101,120,45,99,111,108,32,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,115,104,97,100,111,119,45,115,109,32,114,111,117,110,100,101,100,45,120,108,32,100,97,114,107,58,98,103,45,115,108,97,116,101,45,57,48,48,32,100,97,114,107,58,98,111,114,100,101,114,45,103,114,97,121,45,56,48,48,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,111,118,101,114,102,108,111,119,45,97,117,116,111,32,114,111,117,110,100,101,100,45,108,103,32,98,103,45,119,104,105,116,101,32,112,120,45,52,32,112,121,45,50,32,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,120,45,50,34,62,10,32,32,32,32,32,32,60,112,32,99,108,97,115,115,61,34,116,101,120,116,45,115,109,32,116,114,117,110,99,97,116,101,32,116,101,120,116,45,103,114,97,121,45,53,48,48,32,102,111,110,116,45,109,101,100,105,117,109,34,62,32,36,123,116,105,116,108,101,125,32,60,47,112,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,116,45,49,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,120,45,50,34,62,10,32,32,32,32,32,32,60,104,51,32,99,108,97,115,115,61,34,116,101,120,116,45,120,108,32,116,114,117,110,99,97,116,101,32,102,111,110,116,45,115,101,109,105,98,111,108,100,32,116,114,97,99,107,105,110,103,45,116,105,103,104,116,32,36,123,99,111,108,111,114,115,32,124,124,32,39,116,101,120,116,45,103,114,97,121,45,56,48,48,32,100,97,114,107,58,116,101,120,116,45,103,114,97,121,45,50,48,48,39,125,34,62,10,32,32,32,32,32,32,32,32,36,123,116,101,120,116,125,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,115,112,97,110,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,36,123,116,105,112,84,101,120,116,32,124,124,32,39,104,105,100,100,101,110,39,125,34,62,10,32,32,32,32,32,32,32,32,60,36,123,67,111,108,111,114,101,100,125,32,116,101,120,116,61,36,123,116,105,112,84,101,120,116,125,32,105,99,111,110,61,36,123,116,105,112,73,99,111,110,125,32,99,111,108,111,114,115,61,36,123,116,105,112,67,111,108,111,114,115,125,32,47,62,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,84,101,120,116,86,97,108,117,101,40,123,118,97,108,117,101,44,32,115,101,116,102,110,44,32,100,105,115,97,98,108,101,100,44,32,112,108,97,99,101,104,111,108,100,101,114,44,32,116,121,112,101,44,32,97,100,100,111,110,82,105,103,104,116,44,32,97,100,100,111,110,76,101,102,116,44,32,97,116,116,114,44,32,109,105,110,44,32,109,97,120,44,32,115,116,101,112,44,32,109,117,108,116,125,41,32,123,10,32,32,99,111,110,115,116,32,91,98,103,44,32,115,101,116,66,103,93,32,61,32,117,115,101,83,116,97,116,101,40,39,98,103,45,119,104,105,116,101,39,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,32,105,102,32,40,116,121,112,101,32,61,61,32,39,110,117,109,98,101,114,39,41,32,99,104,101,99,107,118,97,108,40,43,109,105,110,44,32,43,109,97,120,44,32,43,118,97,108,117,101,41,59,32,125,44,32,91,93,41,59,10,32,32,115,116,101,112,32,124,124,61,32,39,49,39,44,32,109,117,108,116,32,124,124,61,32,49,59,10,32,32,99,111,110,115,116,32,99,104,101,99,107,118,97,108,32,61,32,102,117,110,99,116,105,111,110,40,109,105,110,44,32,109,97,120,44,32,118,41,32,123,10,32,32,32,32,115,101,116,66,103,40,39,98,103,45,119,104,105,116,101,39,41,59,10,32,32,32,32,105,102,32,40,109,105,110,32,38,38,32,118,32,60,32,109,105,110,41,32,115,101,116,66,103,40,39,98,103,45,114,101,100,45,49,48,48,32,98,111,114,100,101,114,45,114,101,100,45,50,48,48,39,41,59,10,32,32,32,32,105,102,32,40,109,97,120,32,38,38,32,118,32,62,32,109,97,120,41,32,115,101,116,66,103,40,39,98,103,45,114,101,100,45,49,48,48,32,98,111,114,100,101,114,45,114,101,100,45,50,48,48,39,41,59,10,32,32,125,59,10,32,32,99,111,110,115,116,32,109,32,61,32,115,116,101,112,46,109,97,116,99,104,40,47,94,46,43,92,46,40,46,43,41,47,41,59,10,32,32,99,111,110,115,116,32,100,105,103,105,116,115,32,61,32,109,32,63,32,109,91,49,93,46,108,101,110,103,116,104,32,58,32,48,59,10,32,32,99,111,110,115,116,32,111,110,99,104,97,110,103,101,32,61,32,101,118,32,61,62,32,123,10,32,32,32,32,108,101,116,32,118,32,61,32,101,118,46,116,97,114,103,101,116,46,118,97,108,117,101,59,10,32,32,32,32,105,102,32,40,116,121,112,101,32,61,61,32,39,110,117,109,98,101,114,39,41,32,123,10,32,32,32,32,32,32,99,104,101,99,107,118,97,108,40,43,109,105,110,44,32,43,109,97,120,44,32,43,118,41,59,10,32,32,32,32,32,32,118,32,61,32,43,40,112,97,114,115,101,70,108,111,97,116,40,118,41,32,47,32,109,117,108,116,41,46,116,111,70,105,120,101,100,40,100,105,103,105,116,115,41,59,10,32,32,32,32,125,10,32,32,32,32,115,101,116,102,110,40,118,41,59,10,32,32,125,59,10,32,32,105,102,32,40,116,121,112,101,32,61,61,32,39,110,117,109,98,101,114,39,41,32,118,97,108,117,101,32,61,32,43,40,118,97,108,117,101,32,42,32,109,117,108,116,41,46,116,111,70,105,120,101,100,40,100,105,103,105,116,115,41,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,119,45,102,117,108,108,32,105,116,101,109,115,45,99,101,110,116,101,114,32,114,111,117,110,100,101,100,32,98,111,114,100,101,114,32,115,104,97,100,111,119,45,115,109,32,36,123,98,103,125,34,62,10,32,32,36,123,97,100,100,111,110,76,101,102,116,32,38,38,32,104,116,109,108,96,60,115,112,97,110,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,102,111,110,116,45,110,111,114,109,97,108,32,116,114,117,110,99,97,116,101,32,112,121,45,49,32,98,111,114,100,101,114,45,114,32,98,103,45,115,108,97,116,101,45,49,48,48,32,105,116,101,109,115,45,99,101,110,116,101,114,32,98,111,114,100,101,114,45,103,114,97,121,45,51,48,48,32,112,120,45,50,32,116,101,120,116,45,103,114,97,121,45,53,48,48,32,116,101,120,116,45,120,115,34,62,36,123,97,100,100,111,110,76,101,102,116,125,60,47,47,62,96,32,125,10,32,32,60,105,110,112,117,116,32,116,121,112,101,61,36,123,116,121,112,101,32,124,124,32,39,116,101,120,116,39,125,32,100,105,115,97,98,108,101,100,61,36,123,100,105,115,97,98,108,101,100,125,32,118,97,108,117,101,61,36,123,118,97,108,117,101,125,10,32,32,32,32,115,116,101,112,61,36,123,115,116,101,112,125,32,109,105,110,61,36,123,109,105,110,125,32,109,97,120,61,36,123,109,97,120,125,32,10,32,32,32,32,111,110,99,104,97,110,103,101,61,36,123,111,110,99,104,97,110,103,101,125,32,46,46,46,36,123,97,116,116,114,125,10,32,32,32,32,99,108,97,115,115,61,34,36,123,98,103,125,32,102,111,110,116,45,110,111,114,109,97,108,32,116,101,120,116,45,115,109,32,114,111,117,110,100,101,100,32,119,45,102,117,108,108,32,102,108,101,120,45,49,32,112,121,45,48,46,53,32,112,120,45,50,32,116,101,120,116,45,103,114,97,121,45,55,48,48,32,112,108,97,99,101,104,111,108,100,101,114,58,116,101,120,116,45,103,114,97,121,45,52,48,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,32,100,105,115,97,98,108,101,100,58,99,117,114,115,111,114,45,110,111,116,45,97,108,108,111,119,101,100,32,100,105,115,97,98,108,101,100,58,98,103,45,103,114,97,121,45,49,48,48,32,100,105,115,97,98,108,101,100,58,116,101,120,116,45,103,114,97,121,45,53,48,48,34,32,112,108,97,99,101,104,111,108,100,101,114,61,36,123,112,108,97,99,101,104,111,108,100,101,114,125,32,47,62,10,32,32,36,123,97,100,100,111,110,82,105,103,104,116,32,38,38,32,104,116,109,108,96,60,115,112,97,110,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,102,111,110,116,45,110,111,114,109,97,108,32,116,114,117,110,99,97,116,101,32,112,121,45,49,32,98,111,114,100,101,114,45,108,32,98,103,45,115,108,97,116,101,45,49,48,48,32,105,116,101,109,115,45,99,101,110,116,101,114,32,98,111,114,100,101,114,45,103,114,97,121,45,51,48,48,32,112,120,45,50,32,116,101,120,116,45,103,114,97,121,45,53,48,48,32,116,101,120,116,45,120,115,32,111,118,101,114,102,108,111,119,45,115,99,114,111,108,108,34,32,115,116,121,108,101,61,34,109,105,110,45,119,105,100,116,104,58,32,53,48,37,59,34,62,36,123,97,100,100,111,110,82,105,103,104,116,125,60,47,47,62,96,32,125,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,83,101,108,101,99,116,86,97,108,117,101,40,123,118,97,108,117,101,44,32,115,101,116,102,110,44,32,111,112,116,105,111,110,115,44,32,100,105,115,97,98,108,101,100,125,41,32,123,10,32,32,99,111,110,115,116,32,116,111,73,110,116,32,61,32,120,32,61,62,32,120,32,61,61,32,112,97,114,115,101,73,110,116,40,120,41,32,63,32,112,97,114,115,101,73,110,116,40,120,41,32,58,32,120,59,10,32,32,99,111,110,115,116,32,111,110,99,104,97,110,103,101,32,61,32,101,118,32,61,62,32,115,101,116,102,110,40,116,111,73,110,116,40,101,118,46,116,97,114,103,101,116,46,118,97,108,117,101,41,41,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,115,101,108,101,99,116,32,111,110,99,104,97,110,103,101,61,36,123,111,110,99,104,97,110,103,101,125,32,99,108,97,115,115,61,34,119,45,102,117,108,108,32,114,111,117,110,100,101,100,32,102,111,110,116,45,110,111,114,109,97,108,32,98,111,114,100,101,114,32,112,121,45,48,46,53,32,112,120,45,49,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,32,116,101,120,116,45,115,109,32,100,105,115,97,98,108,101,100,58,99,117,114,115,111,114,45,110,111,116,45,97,108,108,111,119,101,100,34,32,100,105,115,97,98,108,101,100,61,36,123,100,105,115,97,98,108,101,100,125,62,10,32,32,36,123,111,112,116,105,111,110,115,46,109,97,112,40,118,32,61,62,32,104,116,109,108,96,60,111,112,116,105,111,110,32,118,97,108,117,101,61,36,123,118,91,48,93,125,32,115,101,108,101,99,116,101,100,61,36,123,118,91,48,93,32,61,61,32,118,97,108,117,101,125,62,36,123,118,91,49,93,125,60,47,47,62,96,41,32,125,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,83,119,105,116,99,104,86,97,108,117,101,40,123,118,97,108,117,101,44,32,115,101,116,102,110,125,41,32,123,10,32,32,99,111,110,115,116,32,111,110,99,108,105,99,107,32,61,32,101,118,32,61,62,32,115,101,116,102,110,40,33,118,97,108,117,101,41,59,10,32,32,99,111,110,115,116,32,98,103,32,61,32,33,33,118,97,108,117,101,32,63,32,39,98,103,45,98,108,117,101,45,54,48,48,39,32,58,32,39,98,103,45,103,114,97,121,45,50,48,48,39,59,10,32,32,99,111,110,115,116,32,116,114,32,61,32,33,33,118,97,108,117,101,32,63,32,39,116,114,97,110,115,108,97,116,101,45,120,45,53,39,32,58,32,39,116,114,97,110,115,108,97,116,101,45,120,45,48,39,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,98,117,116,116,111,110,32,116,121,112,101,61,34,98,117,116,116,111,110,34,32,111,110,99,108,105,99,107,61,36,123,111,110,99,108,105,99,107,125,32,99,108,97,115,115,61,34,36,123,98,103,125,32,105,110,108,105,110,101,45,102,108,101,120,32,104,45,54,32,119,45,49,49,32,102,108,101,120,45,115,104,114,105,110,107,45,48,32,99,117,114,115,111,114,45,112,111,105,110,116,101,114,32,114,111,117,110,100,101,100,45,102,117,108,108,32,98,111,114,100,101,114,45,50,32,98,111,114,100,101,114,45,116,114,97,110,115,112,97,114,101,110,116,32,116,114,97,110,115,105,116,105,111,110,45,99,111,108,111,114,115,32,100,117,114,97,116,105,111,110,45,50,48,48,32,101,97,115,101,45,105,110,45,111,117,116,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,110,111,110,101,32,102,111,99,117,115,58,114,105,110,103,45,48,32,114,105,110,103,45,48,34,32,114,111,108,101,61,34,115,119,105,116,99,104,34,32,97,114,105,97,45,99,104,101,99,107,101,100,61,36,123,33,33,118,97,108,117,101,125,62,10,32,32,60,115,112,97,110,32,97,114,105,97,45,104,105,100,100,101,110,61,34,116,114,117,101,34,32,99,108,97,115,115,61,34,36,123,116,114,125,32,112,111,105,110,116,101,114,45,101,118,101,110,116,115,45,110,111,110,101,32,105,110,108,105,110,101,45,98,108,111,99,107,32,104,45,53,32,119,45,53,32,116,114,97,110,115,102,111,114,109,32,114,111,117,110,100,101,100,45,102,117,108,108,32,98,103,45,119,104,105,116,101,32,115,104,97,100,111,119,32,114,105,110,103,45,48,32,102,111,99,117,115,58,114,105,110,103,45,48,32,116,114,97,110,115,105,116,105,111,110,32,100,117,114,97,116,105,111,110,45,50,48,48,32,101,97,115,101,45,105,110,45,111,117,116,34,62,60,47,115,112,97,110,62,10,60,47,98,117,116,116,111,110,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,83,101,116,116,105,110,103,40,112,114,111,112,115,41,32,123,10,32,32,108,101,116,32,105,110,112,117,116,32,61,32,84,101,120,116,86,97,108,117,101,59,10,32,32,105,102,32,40,112,114,111,112,115,46,116,121,112,101,32,61,61,32,39,115,119,105,116,99,104,39,41,32,105,110,112,117,116,32,61,32,83,119,105,116,99,104,86,97,108,117,101,59,10,32,32,105,102,32,40,112,114,111,112,115,46,116,121,112,101,32,61,61,32,39,115,101,108,101,99,116,39,41,32,105,110,112,117,116,32,61,32,83,101,108,101,99,116,86,97,108,117,101,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,115,32,124,124,32,39,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,50,32,103,97,112,45,50,32,109,121,45,49,39,125,62,10,32,32,60,108,97,98,101,108,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,115,109,32,116,101,120,116,45,103,114,97,121,45,55,48,48,32,109,114,45,50,32,102,111,110,116,45,109,101,100,105,117,109,32,36,123,112,114,111,112,115,46,116,105,116,108,101,32,124,124,32,39,104,105,100,100,101,110,39,125,34,62,36,123,112,114,111,112,115,46,116,105,116,108,101,125,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,34,62,36,123,104,40,105,110,112,117,116,44,32,112,114,111,112,115,41,125,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,80,97,103,105,110,97,116,105,111,110,40,123,32,116,111,116,97,108,73,116,101,109,115,44,32,105,116,101,109,115,80,101,114,80,97,103,101,44,32,99,117,114,114,101,110,116,80,97,103,101,44,32,115,101,116,80,97,103,101,70,110,44,32,99,111,108,111,114,115,32,125,41,32,123,10,32,32,99,111,110,115,116,32,116,111,116,97,108,80,97,103,101,115,32,61,32,77,97,116,104,46,99,101,105,108,40,116,111,116,97,108,73,116,101,109,115,32,47,32,105,116,101,109,115,80,101,114,80,97,103,101,41,59,10,32,32,99,111,110,115,116,32,109,97,120,80,97,103,101,82,97,110,103,101,32,61,32,50,59,10,32,32,99,111,110,115,116,32,108,101,115,115,84,104,97,110,83,121,109,98,111,108,32,61,32,34,60,34,59,10,32,32,99,111,110,115,116,32,103,114,101,97,116,101,114,84,104,97,110,83,121,109,98,111,108,32,61,32,34,62,34,59,10,32,32,99,111,110,115,116,32,119,104,105,116,101,83,112,97,99,101,32,61,32,34,32,34,59,10,32,32,99,111,110,115,116,32,105,116,101,109,99,108,115,32,61,32,39,114,101,108,97,116,105,118,101,32,105,110,108,105,110,101,45,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,112,120,45,51,32,112,121,45,49,32,116,101,120,116,45,115,109,32,102,111,99,117,115,58,122,45,50,48,32,102,111,99,117,115,45,118,105,115,105,98,108,101,58,111,117,116,108,105,110,101,32,102,111,99,117,115,45,118,105,115,105,98,108,101,58,111,117,116,108,105,110,101,45,50,32,102,111,99,117,115,45,118,105,115,105,98,108,101,58,111,117,116,108,105,110,101,45,111,102,102,115,101,116,45,48,32,102,111,99,117,115,45,118,105,115,105,98,108,101,58,111,117,116,108,105,110,101,45,98,108,117,101,45,54,48,48,39,59,10,32,32,99,111,108,111,114,115,32,124,124,61,32,39,98,103,45,98,108,117,101,45,54,48,48,39,59,10,10,32,32,99,111,110,115,116,32,80,97,103,101,73,116,101,109,32,61,32,40,123,32,112,97,103,101,44,32,105,115,65,99,116,105,118,101,32,125,41,32,61,62,32,40,10,32,32,32,32,104,116,109,108,96,60,97,10,32,32,32,32,32,32,111,110,67,108,105,99,107,61,36,123,40,41,32,61,62,32,115,101,116,80,97,103,101,70,110,40,112,97,103,101,41,125,10,32,32,32,32,32,32,99,108,97,115,115,61,34,36,123,105,116,101,109,99,108,115,125,32,36,123,105,115,65,99,116,105,118,101,32,63,32,96,36,123,99,111,108,111,114,115,125,32,116,101,120,116,45,119,104,105,116,101,96,32,58,32,39,99,117,114,115,111,114,45,112,111,105,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,55,48,48,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,114,105,110,103,45,103,114,97,121,45,51,48,48,32,104,111,118,101,114,58,98,103,45,103,114,97,121,45,53,48,39,125,34,10,32,32,32,32,62,10,32,32,32,32,32,32,36,123,112,97,103,101,125,10,32,32,32,32,60,47,97,62,96,10,32,32,41,59,10,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,32,98,103,45,119,104,105,116,101,32,112,120,45,51,32,112,121,45,50,34,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,115,109,58,102,108,101,120,32,115,109,58,102,108,101,120,45,49,32,115,109,58,105,116,101,109,115,45,99,101,110,116,101,114,32,115,109,58,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,32,115,112,97,99,101,45,120,45,52,32,119,104,105,116,101,115,112,97,99,101,45,110,111,119,114,97,112,32,115,101,108,101,99,116,45,110,111,110,101,34,62,10,32,32,32,32,32,32,32,32,32,32,60,112,32,99,108,97,115,115,61,34,116,101,120,116,45,115,109,32,116,101,120,116,45,115,108,97,116,101,45,53,48,48,32,102,111,110,116,45,109,101,100,105,117,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,115,104,111,119,105,110,103,32,60,115,112,97,110,32,99,108,97,115,115,61,34,102,111,110,116,45,98,111,108,100,32,116,101,120,116,45,115,108,97,116,101,45,55,48,48,34,62,36,123,40,99,117,114,114,101,110,116,80,97,103,101,32,45,32,49,41,32,42,32,105,116,101,109,115,80,101,114,80,97,103,101,32,43,32,49,125,60,47,115,112,97,110,62,32,45,32,60,115,112,97,110,32,99,108,97,115,115,61,34,102,111,110,116,45,109,101,100,105,117,109,34,62,36,123,77,97,116,104,46,109,105,110,40,99,117,114,114,101,110,116,80,97,103,101,32,42,32,105,116,101,109,115,80,101,114,80,97,103,101,44,32,116,111,116,97,108,73,116,101,109,115,41,125,60,47,115,112,97,110,62,32,111,102,32,36,123,119,104,105,116,101,83,112,97,99,101,125,10,32,32,32,32,32,32,32,32,32,32,32,32,60,115,112,97,110,32,99,108,97,115,115,61,34,102,111,110,116,45,98,111,108,100,32,116,101,120,116,45,115,108,97,116,101,45,55,48,48,34,62,36,123,116,111,116,97,108,73,116,101,109,115,125,60,47,115,112,97,110,62,32,114,101,115,117,108,116,115,10,32,32,32,32,32,32,32,32,32,32,60,47,112,62,10,32,32,32,32,32,32,32,32,60,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,60,110,97,118,32,99,108,97,115,115,61,34,105,115,111,108,97,116,101,32,105,110,108,105,110,101,45,102,108,101,120,32,45,115,112,97,99,101,45,120,45,112,120,32,114,111,117,110,100,101,100,45,109,100,34,32,97,114,105,97,45,108,97,98,101,108,61,34,80,97,103,105,110,97,116,105,111,110,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,97,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,110,67,108,105,99,107,61,36,123,40,41,32,61,62,32,115,101,116,80,97,103,101,70,110,40,77,97,116,104,46,109,97,120,40,99,117,114,114,101,110,116,80,97,103,101,32,45,32,49,44,32,49,41,41,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,97,115,115,61,34,114,101,108,97,116,105,118,101,32,105,110,108,105,110,101,45,102,108,101,120,32,112,120,45,51,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,52,48,48,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,114,105,110,103,45,103,114,97,121,45,51,48,48,32,104,111,118,101,114,58,98,103,45,103,114,97,121,45,53,48,32,36,123,99,117,114,114,101,110,116,80,97,103,101,32,33,61,32,49,32,63,32,39,99,117,114,115,111,114,45,112,111,105,110,116,101,114,39,32,58,32,39,39,125,32,102,111,99,117,115,58,122,45,50,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,111,102,102,115,101,116,45,48,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,36,123,108,101,115,115,84,104,97,110,83,121,109,98,111,108,125,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,97,62,10,10,32,32,32,32,32,32,32,32,32,32,32,32,60,36,123,80,97,103,101,73,116,101,109,125,32,112,97,103,101,61,36,123,49,125,32,105,115,65,99,116,105,118,101,61,36,123,99,117,114,114,101,110,116,80,97,103,101,32,61,61,61,32,49,125,32,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,36,123,99,117,114,114,101,110,116,80,97,103,101,32,62,32,109,97,120,80,97,103,101,82,97,110,103,101,32,43,32,50,32,63,32,104,116,109,108,96,60,115,112,97,110,32,99,108,97,115,115,61,34,36,123,105,116,101,109,99,108,115,125,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,114,105,110,103,45,103,114,97,121,45,51,48,48,32,116,101,120,116,45,115,108,97,116,101,45,51,48,48,34,62,46,46,46,60,47,115,112,97,110,62,96,32,58,32,39,39,125,10,32,32,32,32,32,32,32,32,32,32,32,32,36,123,65,114,114,97,121,46,102,114,111,109,40,123,108,101,110,103,116,104,58,32,77,97,116,104,46,109,105,110,40,116,111,116,97,108,80,97,103,101,115,44,32,109,97,120,80,97,103,101,82,97,110,103,101,32,42,32,50,32,43,32,49,41,125,44,32,40,95,44,32,105,41,32,61,62,32,77,97,116,104,46,109,97,120,40,50,44,32,99,117,114,114,101,110,116,80,97,103,101,32,45,32,109,97,120,80,97,103,101,82,97,110,103,101,41,32,43,32,105,41,46,109,97,112,40,112,97,103,101,32,61,62,32,112,97,103,101,32,62,32,49,32,38,38,32,112,97,103,101,32,60,32,116,111,116,97,108,80,97,103,101,115,32,38,38,32,104,116,109,108,96,60,36,123,80,97,103,101,73,116,101,109,125,32,112,97,103,101,61,36,123,112,97,103,101,125,32,105,115,65,99,116,105,118,101,61,36,123,99,117,114,114,101,110,116,80,97,103,101,32,61,61,61,32,112,97,103,101,125,32,47,62,96,41,125,10,32,32,32,32,32,32,32,32,32,32,32,32,36,123,99,117,114,114,101,110,116,80,97,103,101,32,60,32,116,111,116,97,108,80,97,103,101,115,32,45,32,40,109,97,120,80,97,103,101,82,97,110,103,101,32,43,32,49,41,32,63,32,104,116,109,108,96,60,115,112,97,110,32,99,108,97,115,115,61,34,36,123,105,116,101,109,99,108,115,125,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,114,105,110,103,45,103,114,97,121,45,51,48,48,32,116,101,120,116,45,115,108,97,116,101,45,51,48,48,34,62,46,46,46,60,47,115,112,97,110,62,96,32,58,32,39,39,125,10,32,32,32,32,32,32,32,32,32,32,32,32,36,123,116,111,116,97,108,80,97,103,101,115,32,62,32,49,32,63,32,104,116,109,108,96,60,36,123,80,97,103,101,73,116,101,109,125,32,112,97,103,101,61,36,123,116,111,116,97,108,80,97,103,101,115,125,32,105,115,65,99,116,105,118,101,61,36,123,99,117,114,114,101,110,116,80,97,103,101,32,61,61,61,32,116,111,116,97,108,80,97,103,101,115,125,32,47,62,96,32,58,32,39,39,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,60,97,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,110,67,108,105,99,107,61,36,123,40,41,32,61,62,32,115,101,116,80,97,103,101,70,110,40,77,97,116,104,46,109,105,110,40,99,117,114,114,101,110,116,80,97,103,101,32,43,32,49,44,32,116,111,116,97,108,80,97,103,101,115,41,41,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,97,115,115,61,34,114,101,108,97,116,105,118,101,32,105,110,108,105,110,101,45,102,108,101,120,32,112,120,45,51,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,52,48,48,32,114,105,110,103,45,49,32,114,105,110,103,45,105,110,115,101,116,32,114,105,110,103,45,103,114,97,121,45,51,48,48,32,104,111,118,101,114,58,98,103,45,103,114,97,121,45,53,48,32,36,123,99,117,114,114,101,110,116,80,97,103,101,32,33,61,32,116,111,116,97,108,80,97,103,101,115,32,63,32,39,99,117,114,115,111,114,45,112,111,105,110,116,101,114,39,32,58,32,39,39,125,32,102,111,99,117,115,58,122,45,50,48,32,102,111,99,117,115,58,111,117,116,108,105,110,101,45,111,102,102,115,101,116,45,48,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,36,123,103,114,101,97,116,101,114,84,104,97,110,83,121,109,98,111,108,125,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,97,62,10,32,32,32,32,32,32,32,32,32,32,60,47,110,97,118,62,10,32,32,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,60,47,100,105,118,62,96,59,10,125,59,10,10,101,120,112,111,114,116,32,102,117,110,99,116,105,111,110,32,85,112,108,111,97,100,70,105,108,101,66,117,116,116,111,110,40,112,114,111,112,115,41,32,123,10,32,32,99,111,110,115,116,32,91,117,112,108,111,97,100,44,32,115,101,116,85,112,108,111,97,100,93,32,61,32,117,115,101,83,116,97,116,101,40,110,117,108,108,41,59,32,32,47,47,32,85,112,108,111,97,100,32,112,114,111,109,105,115,101,10,32,32,99,111,110,115,116,32,91,115,116,97,116,117,115,44,32,115,101,116,83,116,97,116,117,115,93,32,61,32,117,115,101,83,116,97,116,101,40,39,39,41,59,32,32,32,32,47,47,32,67,117,114,114,101,110,116,32,117,112,108,111,97,100,32,115,116,97,116,117,115,10,32,32,99,111,110,115,116,32,98,116,110,32,61,32,117,115,101,82,101,102,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,105,110,112,117,116,32,61,32,117,115,101,82,101,102,40,110,117,108,108,41,59,10,10,32,32,47,47,32,83,101,110,100,32,97,32,108,97,114,103,101,32,102,105,108,101,32,99,104,117,110,107,32,98,121,32,99,104,117,110,107,10,32,32,99,111,110,115,116,32,115,101,110,100,70,105,108,101,68,97,116,97,32,61,32,102,117,110,99,116,105,111,110,40,117,114,108,44,32,102,105,108,101,78,97,109,101,44,32,102,105,108,101,68,97,116,97,44,32,99,104,117,110,107,83,105,122,101,41,32,123,10,32,32,32,32,114,101,116,117,114,110,32,110,101,119,32,80,114,111,109,105,115,101,40,102,117,110,99,116,105,111,110,40,114,101,115,111,108,118,101,44,32,114,101,106,101,99,116,41,32,123,10,32,32,32,32,32,32,99,111,110,115,116,32,102,105,110,105,115,104,32,61,32,111,107,32,61,62,32,123,10,32,32,32,32,32,32,32,32,115,101,116,85,112,108,111,97,100,40,110,117,108,108,41,59,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,114,101,115,32,61,32,112,114,111,112,115,46,111,110,117,112,108,111,97,100,32,63,32,112,114,111,112,115,46,111,110,117,112,108,111,97,100,40,111,107,44,32,102,105,108,101,78,97,109,101,44,32,102,105,108,101,68,97,116,97,46,108,101,110,103,116,104,41,32,58,32,110,117,108,108,59,10,32,32,32,32,32,32,32,32,105,102,32,40,114,101,115,32,38,38,32,116,121,112,101,111,102,32,40,114,101,115,46,99,97,116,99,104,41,32,61,61,61,32,39,102,117,110,99,116,105,111,110,39,41,32,123,10,32,32,32,32,32,32,32,32,32,32,114,101,115,46,99,97,116,99,104,40,40,41,32,61,62,32,102,97,108,115,101,41,46,116,104,101,110,40,40,41,32,61,62,32,111,107,32,63,32,114,101,115,111,108,118,101,40,41,32,58,32,114,101,106,101,99,116,40,41,41,59,10,32,32,32,32,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,32,32,32,32,111,107,32,63,32,114,101,115,111,108,118,101,40,41,32,58,32,114,101,106,101,99,116,40,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,125,59,10,32,32,32,32,32,32,99,111,110,115,116,32,115,101,110,100,67,104,117,110,107,32,61,32,102,117,110,99,116,105,111,110,40,111,102,102,115,101,116,41,32,123,10,32,32,32,32,32,32,32,32,118,97,114,32,99,104,117,110,107,32,61,32,102,105,108,101,68,97,116,97,46,115,117,98,97,114,114,97,121,40,111,102,102,115,101,116,44,32,111,102,102,115,101,116,32,43,32,99,104,117,110,107,83,105,122,101,41,32,124,124,32,39,39,59,10,32,32,32,32,32,32,32,32,118,97,114,32,111,112,116,115,32,61,32,123,109,101,116,104,111,100,58,32,39,80,79,83,84,39,44,32,98,111,100,121,58,32,99,104,117,110,107,125,59,10,32,32,32,32,32,32,32,32,118,97,114,32,102,117,108,108,85,114,108,32,61,32,117,114,108,32,43,32,39,63,111,102,102,115,101,116,61,39,32,43,32,111,102,102,115,101,116,32,43,10,32,32,32,32,32,32,32,32,32,32,39,38,116,111,116,97,108,61,39,32,43,32,102,105,108,101,68,97,116,97,46,108,101,110,103,116,104,32,32,43,10,32,32,32,32,32,32,32,32,32,32,39,38,110,97,109,101,61,39,32,43,32,101,110,99,111,100,101,85,82,73,67,111,109,112,111,110,101,110,116,40,102,105,108,101,78,97,109,101,41,59,10,32,32,32,32,32,32,32,32,118,97,114,32,111,107,59,10,32,32,32,32,32,32,32,32,115,101,116,83,116,97,116,117,115,40,39,85,112,108,111,97,100,105,110,103,32,39,32,43,32,102,105,108,101,78,97,109,101,32,43,32,39,44,32,98,121,116,101,115,32,39,32,43,32,111,102,102,115,101,116,32,43,32,39,46,46,39,32,43,10,32,32,32,32,32,32,32,32,32,32,40,111,102,102,115,101,116,32,43,32,99,104,117,110,107,46,108,101,110,103,116,104,41,32,43,32,39,32,111,102,32,39,32,43,32,102,105,108,101,68,97,116,97,46,108,101,110,103,116,104,41,59,10,32,32,32,32,32,32,32,32,102,101,116,99,104,40,102,117,108,108,85,114,108,44,32,111,112,116,115,41,10,32,32,32,32,32,32,32,32,32,32,46,116,104,101,110,40,102,117,110,99,116,105,111,110,40,114,101,115,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,115,46,111,107,32,38,38,32,99,104,117,110,107,46,108,101,110,103,116,104,32,62,32,48,41,32,115,101,110,100,67,104,117,110,107,40,111,102,102,115,101,116,32,43,32,99,104,117,110,107,46,108,101,110,103,116,104,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,111,107,32,61,32,114,101,115,46,111,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,114,101,115,46,116,101,120,116,40,41,59,10,32,32,32,32,32,32,32,32,32,32,125,41,10,32,32,32,32,32,32,32,32,32,32,46,116,104,101,110,40,102,117,110,99,116,105,111,110,40,116,101,120,116,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,33,111,107,41,32,115,101,116,83,116,97,116,117,115,40,39,69,114,114,111,114,58,32,39,32,43,32,116,101,120,116,41,44,32,102,105,110,105,115,104,40,111,107,41,59,32,47,47,32,70,97,105,108,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,99,104,117,110,107,46,108,101,110,103,116,104,32,62,32,48,41,32,114,101,116,117,114,110,59,32,47,47,32,77,111,114,101,32,99,104,117,110,107,115,32,116,111,32,115,101,110,100,10,32,32,32,32,32,32,32,32,32,32,32,32,115,101,116,83,116,97,116,117,115,40,120,32,61,62,32,120,32,43,32,39,46,32,68,111,110,101,44,32,114,101,115,101,116,116,105,110,103,32,100,101,118,105,99,101,46,46,46,39,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,102,105,110,105,115,104,40,111,107,41,59,32,47,47,32,65,108,108,32,99,104,117,110,107,115,32,115,101,110,116,10,32,32,32,32,32,32,32,32,32,32,125,41,59,10,32,32,32,32,32,32,125,59,10,32,32,32,32,32,32,115,101,110,100,67,104,117,110,107,40,48,41,59,10,32,32,32,32,125,41,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,111,110,99,104,97,110,103,101,32,61,32,102,117,110,99,116,105,111,110,40,101,118,41,32,123,10,32,32,32,32,105,102,32,40,33,101,118,46,116,97,114,103,101,116,46,102,105,108,101,115,91,48,93,41,32,114,101,116,117,114,110,59,10,32,32,32,32,108,101,116,32,114,32,61,32,110,101,119,32,70,105,108,101,82,101,97,100,101,114,40,41,44,32,102,32,61,32,101,118,46,116,97,114,103,101,116,46,102,105,108,101,115,91,48,93,59,10,32,32,32,32,114,46,114,101,97,100,65,115,65,114,114,97,121,66,117,102,102,101,114,40,102,41,59,10,32,32,32,32,114,46,111,110,108,111,97,100,32,61,32,102,117,110,99,116,105,111,110,40,41,32,123,10,32,32,32,32,32,32,115,101,116,85,112,108,111,97,100,40,115,101,110,100,70,105,108,101,68,97,116,97,40,112,114,111,112,115,46,117,114,108,44,32,102,46,110,97,109,101,44,32,110,101,119,32,85,105,110,116,56,65,114,114,97,121,40,114,46,114,101,115,117,108,116,41,44,32,50,48,52,56,41,41,59,10,32,32,32,32,32,32,101,118,46,116,97,114,103,101,116,46,118,97,108,117,101,32,61,32,39,39,59,10,32,32,32,32,32,32,101,118,46,112,114,101,118,101,110,116,68,101,102,97,117,108,116,40,41,59,10,32,32,32,32,32,32,98,116,110,32,38,38,32,98,116,110,46,99,117,114,114,101,110,116,46,98,97,115,101,46,99,108,105,99,107,40,41,59,10,32,32,32,32,125,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,111,110,99,108,105,99,107,32,61,32,102,117,110,99,116,105,111,110,40,101,118,41,32,123,10,32,32,32,32,108,101,116,32,102,110,59,32,115,101,116,85,112,108,111,97,100,40,120,32,61,62,32,102,110,32,61,32,120,41,59,10,32,32,32,32,105,102,32,40,33,102,110,41,32,105,110,112,117,116,46,99,117,114,114,101,110,116,46,99,108,105,99,107,40,41,59,32,32,47,47,32,78,111,32,117,112,108,111,97,100,32,105,110,32,112,114,111,103,114,101,115,115,44,32,115,104,111,119,32,102,105,108,101,32,100,105,97,108,111,103,10,32,32,32,32,114,101,116,117,114,110,32,102,110,59,10,32,32,125,59,10,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,102,108,101,120,32,102,108,101,120,45,99,111,108,32,36,123,112,114,111,112,115,46,99,108,97,115,115,125,34,62,10,32,32,60,105,110,112,117,116,32,99,108,97,115,115,61,34,104,105,100,100,101,110,34,32,116,121,112,101,61,34,102,105,108,101,34,32,114,101,102,61,36,123,105,110,112,117,116,125,32,111,110,99,104,97,110,103,101,61,36,123,111,110,99,104,97,110,103,101,125,32,97,99,99,101,112,116,61,36,123,112,114,111,112,115,46,97,99,99,101,112,116,125,32,47,62,10,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,36,123,112,114,111,112,115,46,116,105,116,108,101,125,32,105,99,111,110,61,36,123,73,99,111,110,115,46,100,111,119,110,108,111,97,100,125,32,111,110,99,108,105,99,107,61,36,123,111,110,99,108,105,99,107,125,32,114,101,102,61,36,123,98,116,110,125,32,99,111,108,111,114,115,61,36,123,112,114,111,112,115,46,99,111,108,111,114,115,125,32,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,116,45,50,32,116,101,120,116,45,115,109,32,116,101,120,116,45,115,108,97,116,101,45,52,48,48,32,36,123,115,116,97,116,117,115,32,124,124,32,39,104,105,100,100,101,110,39,125,34,62,36,123,115,116,97,116,117,115,125,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,0};
 
-static const unsigned char v6[] = {45,45,45,45,45,66,69,71,73,78,32,67,69,82,84,73,70,73,67,65,84,69,45,45,45,45,45,10,77,73,73,66,67,84,67,66,115,65,73,74,65,75,57,119,98,73,68,107,72,110,65,111,77,65,111,71,67,67,113,71,83,77,52,57,66,65,77,67,77,65,48,120,67,122,65,74,66,103,78,86,66,65,89,84,65,107,108,70,77,66,52,88,10,68,84,73,122,77,68,69,121,79,84,73,120,77,106,69,122,79,70,111,88,68,84,77,122,77,68,69,121,78,106,73,120,77,106,69,122,79,70,111,119,68,84,69,76,77,65,107,71,65,49,85,69,66,104,77,67,83,85,85,119,87,84,65,84,10,66,103,99,113,104,107,106,79,80,81,73,66,66,103,103,113,104,107,106,79,80,81,77,66,66,119,78,67,65,65,82,122,83,81,83,53,79,72,100,49,55,108,85,101,78,73,43,54,107,112,57,87,89,117,48,99,120,117,69,73,105,47,74,84,10,106,112,104,98,67,109,100,74,68,49,99,85,118,104,109,122,77,57,47,112,104,118,74,84,57,107,97,49,48,90,57,116,111,90,104,103,110,66,113,48,111,48,120,102,84,81,52,106,67,49,118,119,77,65,111,71,67,67,113,71,83,77,52,57,10,66,65,77,67,65,48,103,65,77,69,85,67,73,81,67,101,48,84,50,69,48,71,79,105,86,101,57,75,119,118,73,69,80,101,88,49,74,49,74,48,84,55,84,78,97,99,103,82,48,89,97,51,51,72,86,57,86,103,73,103,78,118,100,110,10,97,69,87,105,66,112,49,120,115,104,115,52,105,122,54,87,98,112,120,114,83,49,73,72,117,99,114,113,107,90,117,74,76,102,78,90,71,90,73,61,10,45,45,45,45,45,69,78,68,32,67,69,82,84,73,70,73,67,65,84,69,45,45,45,45,45,10,0};
+static const unsigned char v6[] = {27,44,58,0,156,5,118,155,211,151,156,156,125,73,145,162,201,141,128,6,35,36,153,221,183,233,215,233,108,78,201,204,236,174,217,210,125,72,105,191,119,7,100,16,16,41,145,69,202,227,197,236,253,173,170,38,51,236,44,158,32,30,164,167,232,92,78,223,63,141,165,170,223,87,173,69,3,196,14,56,166,251,149,231,241,114,172,4,21,194,89,198,211,15,146,211,101,19,18,93,40,194,37,81,172,30,104,73,129,173,232,1,25,160,15,167,169,164,168,67,31,255,223,212,146,142,180,123,90,120,21,192,52,64,26,148,189,155,116,152,142,67,192,237,31,205,215,91,53,63,203,246,110,158,228,178,173,95,109,163,145,236,147,79,87,236,189,166,120,83,106,65,189,65,146,28,11,10,132,173,62,126,240,96,0,161,129,186,85,169,197,189,212,26,247,20,181,102,122,183,43,53,158,128,177,25,78,58,242,239,152,130,183,54,37,225,74,128,175,4,57,25,193,154,110,233,136,88,173,100,171,156,237,156,118,59,145,245,157,148,203,101,208,136,85,140,184,60,159,253,255,251,242,249,98,217,235,59,4,215,109,151,23,59,19,153,214,209,164,33,102,217,33,71,84,80,14,112,200,13,225,34,195,250,32,188,15,30,12,58,238,149,24,214,17,7,163,109,126,87,20,92,90,221,178,183,119,71,112,239,76,22,154,116,99,237,67,134,102,135,150,25,52,41,37,69,225,122,158,32,45,107,74,70,35,141,90,85,13,212,21,182,17,229,149,148,110,117,38,248,86,107,37,129,100,86,157,175,109,148,39,212,251,126,191,140,171,120,61,79,223,174,161,197,205,96,76,17,176,189,35,82,254,92,31,47,111,95,43,201,187,198,126,180,107,237,39,26,224,42,82,230,26,216,192,204,23,229,113,129,173,235,108,236,63,20,216,158,206,81,6,236,15,122,160,118,133,88,216,52,24,3,27,8,10,79,108,4,193,79,144,236,142,37,253,184,253,170,112,187,149,89,4,143,109,93,7,98,82,253,100,96,7,183,16,0,60,255,6,220,40,197,120,117,78,56,148,64,253,224,106,69,45,98,164,27,115,22,231,238,31,138,152,132,125,77,117,154,55,162,186,24,182,82,116,116,40,230,13,44,156,203,134,8,72,254,205,254,18,153,216,60,104,9,249,91,138,164,149,2,249,71,106,238,76,64,90,184,148,101,238,75,36,91,196,98,138,112,86,114,154,223,182,74,79,16,157,68,76,77,82,241,251,253,117,171,61,203,231,198,95,238,85,0,98,252,165,194,86,228,156,230,236,126,56,63,212,158,213,145,156,111,150,82,133,114,225,71,249,88,8,127,23,110,239,101,169,92,148,118,13,115,205,66,1,169,110,216,82,184,189,183,226,180,216,164,150,6,74,163,219,34,55,8,42,91,95,220,141,149,77,21,146,73,179,252,4,160,206,72,252,143,38,12,63,138,164,183,144,173,16,148,4,242,133,148,136,132,204,103,174,5,145,198,221,79,54,64,22,193,125,47,1,20,50,105,17,116,2,190,0,185,48,158,195,114,84,144,13,9,206,66,202,71,113,181,219,215,155,151,70,160,19,132,32,246,202,78,20,130,158,39,5,251,55,129,34,193,129,229,112,161,242,90,230,42,215,114,88,52,156,157,92,238,60,65,154,223,243,228,21,10,220,64,17,204,64,80,242,232,120,236,10,17,82,164,113,183,76,80,146,67,195,115,134,113,132,112,38,29,1,127,151,215,43,88,94,171,153,188,146,53,121,61,167,165,150,145,191,254,1,62,56,62,179,209,6,111,92,182,237,22,164,68,189,101,59,82,26,218,169,45,186,230,83,166,84,34,247,16,40,126,178,163,62,89,183,229,21,206,43,64,37,186,54,3,45,80,125,191,163,129,77,19,181,155,3,25,3,148,189,230,146,227,118,23,95,43,195,237,102,15,225,197,220,100,100,65,228,41,181,36,147,227,210,10,162,2,106,23,201,224,58,72,0,214,193,52,5,146,83,81,94,77,11,81,61,75,236,77,91,98,42,192,172,109,125,146,8,238,161,196,186,35,10,202,155,146,115,200,110,169,8,6,248,74,66,118,202,125,86,97,43,12,226,184,4,178,177,8,67,156,133,1,45,112,148,31,136,156,107,21,134,163,1,194,98,32,216,16,191,105,171,131,240,139,29,128,37,77,141,34,0,103,120,209,63,196,16,254,158,187,30,127,11,200,216,248,69,182,117,235,129,162,250,49,10,232,231,248,33,62,142,200,33,242,106,10,242,151,90,203,131,149,137,195,71,218,152,22,147,118,142,218,0,123,59,68,177,85,248,1,114,64,48,172,64,32,160,10,95,112,249,89,34,104,105,65,183,148,38,69,210,203,17,161,243,82,142,15,232,238,181,99,84,123,254,115,115,207,215,53,173,239,234,55,129,234,177,9,48,75,10,42,195,142,239,26,60,53,219,68,89,10,42,86,177,152,13,240,143,195,121,11,2,153,162,111,67,146,106,227,218,185,194,44,4,79,75,202,117,255,176,182,189,237,120,88,190,46,202,229,213,144,50,42,102,244,18,72,148,81,99,170,187,134,70,188,161,194,122,125,71,6,253,251,24,5,90,194,32,66,82,43,205,50,198,207,113,172,202,65,75,183,216,94,108,6,178,237,69,50,6,139,255,99,149,232,159,42,5,17,97,84,18,169,144,27,55,151,84,141,153,62,73,7,161,241,135,84,0,178,129,157,182,144,74,133,79,7,253,32,74,32,207,185,96,111,143,208,186,69,88,213,8,197,231,221,255,198,241,250,65,248,255,227,213,137,134,46,183,143,200,99,190,176,3,31,122,174,118,117,188,239,53,158,93,72,203,117,58,252,14,244,46,142,122,162,67,221,225,84,10,213,180,247,207,134,249,107,132,39,151,111,101,152,216,220,92,35,107,86,110,229,22,57,131,22,109,232,144,80,209,92,87,103,64,6,177,104,152,231,168,36,78,157,80,130,41,55,27,70,117,226,15,68,206,108,178,204,33,21,88,41,228,98,109,64,189,161,25,146,75,12,95,251,117,201,199,74,49,94,175,168,56,68,160,233,245,150,200,200,198,154,219,55,69,1,232,242,65,149,91,60,28,176,172,156,59,65,247,96,49,102,106,49,85,239,216,148,199,121,191,102,193,10,75,81,249,61,235,114,213,29,204,203,242,2,111,135,195,112,158,222,181,171,65,94,127,205,126,67,103,23,221,217,137,61,87,53,128,55,243,132,120,17,210,133,233,161,144,233,48,205,171,20,65,146,248,31,248,152,212,125,79,246,138,230,55,74,144,205,20,141,64,60,124,198,23,63,82,105,190,34,21,168,200,125,206,187,113,149,151,239,215,171,166,166,251,142,65,149,7,163,50,230,248,186,108,1,47,187,159,141,206,227,242,29,43,249,66,153,40,73,227,133,46,238,21,141,94,227,194,227,51,190,191,61,53,80,236,161,162,181,7,133,72,207,76,70,216,102,112,206,183,45,208,193,217,146,240,47,26,127,222,139,149,247,177,228,237,52,79,135,105,220,207,127,161,243,205,110,55,197,90,164,101,222,60,19,167,243,241,199,100,151,23,150,243,221,226,166,115,99,236,150,48,56,55,35,219,244,144,57,248,102,47,57,65,132,11,133,52,29,245,138,196,115,244,4,217,64,27,35,231,222,3,229,227,246,236,156,122,199,216,133,84,90,86,162,205,26,96,233,229,60,223,57,254,48,45,255,185,56,246,168,223,251,243,242,115,213,222,233,168,255,123,151,47,252,129,143,74,105,171,222,144,212,19,196,218,21,156,143,69,200,101,69,24,57,155,241,58,158,217,40,169,112,29,75,189,172,86,39,56,209,136,42,115,233,174,112,109,88,206,114,46,206,105,214,57,59,194,41,240,229,188,210,191,55,140,153,178,64,61,77,246,4,239,11,246,167,60,49,242,175,235,192,82,229,247,60,57,33,127,76,148,74,142,221,126,54,112,171,68,155,213,238,252,109,27,215,163,76,39,61,255,30,105,208,121,79,11,96,15,103,137,205,97,233,13,212,79,143,87,228,133,144,96,147,119,143,1,139,130,255,190,131,61,143,128,71,185,59,38,87,8,172,146,235,81,222,179,100,154,246,184,49,165,101,4,128,154,180,36,14,153,203,178,205,49,251,176,76,116,244,113,29,210,250,40,189,35,93,133,79,48,11,80,163,23,224,187,97,196,149,65,42,104,97,127,219,128,176,173,241,160,193,170,99,40,7,89,60,231,129,133,172,7,235,141,90,23,91,101,217,189,40,109,23,220,73,239,191,23,181,155,192,150,12,115,244,184,152,145,66,143,86,11,102,238,23,3,114,18,120,229,199,25,255,63,2,166,75,133,44,43,165,19,81,174,255,52,189,12,176,106,38,244,129,172,107,133,251,5,249,180,79,89,203,44,27,34,24,4,54,243,114,237,129,25,184,131,176,122,133,182,49,9,102,247,118,230,156,89,143,191,29,170,202,82,220,5,39,38,240,152,52,85,127,123,201,47,180,249,175,172,80,46,97,136,53,92,210,161,207,94,180,109,107,51,42,152,241,99,73,180,210,137,151,89,151,109,177,25,53,172,217,113,145,185,47,202,89,145,192,78,209,132,42,152,130,23,195,142,169,93,153,18,53,221,98,8,241,222,218,250,113,198,196,104,104,30,212,48,135,7,155,224,165,117,111,178,230,12,145,146,15,239,63,132,92,102,45,157,14,248,67,7,22,69,96,30,202,143,117,72,84,157,136,216,158,174,85,254,164,194,10,73,250,228,22,158,8,53,208,185,160,167,204,51,133,128,60,117,69,43,129,206,39,236,86,133,21,254,198,34,216,188,182,18,193,137,140,50,50,129,74,45,90,204,114,174,215,58,251,178,61,119,42,137,187,75,92,196,59,238,12,32,209,202,252,3,125,53,158,40,57,0,241,62,40,243,92,224,224,49,144,216,231,210,216,1,195,163,80,117,29,82,248,198,65,74,149,89,119,94,37,19,187,212,186,86,8,74,139,7,120,83,76,215,48,93,235,216,188,152,145,233,253,182,98,84,63,33,3,143,185,183,86,177,122,193,147,151,3,154,210,121,138,160,115,79,174,25,105,126,145,67,29,147,89,193,56,165,224,1,121,91,2,153,65,37,4,53,11,57,2,36,47,66,173,74,69,101,246,15,6,240,211,254,68,237,170,145,103,204,122,215,141,65,239,193,68,247,244,252,121,23,251,69,220,6,18,150,175,150,190,168,71,91,224,162,92,44,92,157,116,63,14,142,140,236,39,59,247,126,3,111,143,93,200,178,41,243,45,23,201,149,233,114,110,81,56,94,137,13,89,27,22,209,24,75,158,185,163,235,72,185,249,150,183,144,109,161,197,136,5,109,212,232,231,232,137,241,236,149,225,120,119,172,166,106,68,219,192,178,1,210,101,246,106,12,153,122,232,119,27,222,130,27,75,85,105,90,197,27,38,242,35,8,144,177,161,251,168,32,27,40,179,143,161,18,129,83,132,175,137,214,194,151,15,229,225,91,121,166,14,157,156,75,33,198,71,116,124,231,120,169,84,115,134,108,51,129,131,223,241,49,213,150,230,252,219,212,43,22,139,143,12,92,107,71,222,239,23,118,107,63,190,223,240,97,191,250,83,54,208,85,125,92,79,173,179,234,162,249,75,28,108,133,159,55,5,251,96,191,233,42,53,253,149,59,120,44,193,86,55,87,4,66,43,204,178,57,94,104,166,29,7,26,221,58,45,145,137,189,83,152,143,165,6,231,33,251,229,46,151,242,130,208,133,213,23,168,74,172,115,30,183,82,14,38,172,255,103,153,178,238,241,161,162,232,126,72,210,217,70,116,99,105,82,239,222,18,92,183,148,113,41,141,137,137,7,53,66,92,3,248,87,30,64,43,69,7,15,135,70,0,73,164,17,62,60,55,74,234,183,160,187,101,143,23,183,186,207,183,64,139,254,61,172,76,39,92,162,251,163,30,24,179,143,5,148,2,188,244,6,21,32,206,160,194,113,80,141,249,23,31,139,176,212,127,36,56,50,216,65,96,100,189,74,231,123,118,90,101,94,205,243,10,173,204,199,132,101,27,104,74,41,178,154,17,6,142,48,251,102,181,50,136,167,252,234,183,70,228,135,203,251,160,122,200,120,24,55,198,237,204,76,194,4,135,254,220,2,210,206,116,179,190,87,215,198,29,225,207,72,217,241,65,75,163,152,171,2,82,151,204,108,62,75,60,147,182,37,38,19,32,170,208,228,247,127,43,231,116,114,46,21,131,175,48,176,41,48,177,121,115,99,159,225,231,202,231,140,135,248,252,144,181,137,145,34,20,110,240,212,147,149,104,116,19,72,62,83,110,160,197,164,115,82,15,212,189,213,121,196,217,206,179,153,119,77,213,121,174,215,106,158,232,14,39,213,56,7,35,203,178,223,22,236,165,126,101,140,186,73,129,62,137,214,87,241,226,145,61,232,244,183,69,8,228,4,226,28,67,152,17,224,30,125,1,72,145,209,155,59,230,179,219,17,215,155,39,30,140,95,142,200,211,158,7,111,131,200,52,31,121,29,111,31,201,190,59,51,136,186,241,76,141,87,129,34,197,189,233,235,201,247,212,67,67,232,231,229,236,69,240,36,21,220,114,196,215,191,193,120,91,103,213,188,243,39,72,32,82,174,86,137,216,142,233,109,209,125,211,219,166,235,70,26,102,78,149,33,25,214,243,102,77,236,19,50,172,247,205,157,64,171,63,199,141,49,51,58,164,177,60,237,203,88,26,203,227,140,233,21,248,152,109,170,158,94,33,15,25,119,221,85,207,72,190,87,110,212,139,21,27,101,214,243,152,241,240,111,232,106,114,162,43,93,7,246,107,252,247,77,68,69,70,103,208,207,59,190,154,102,91,113,135,95,105,6,160,179,165,52,58,242,137,64,222,251,10,72,143,181,23,187,169,102,129,70,59,63,79,182,210,107,177,152,150,74,162,54,182,154,236,99,213,200,198,205,175,202,165,166,220,176,28,198,121,245,48,219,86,30,40,3,123,112,228,200,88,224,210,44,213,68,213,64,53,56,22,107,111,186,149,27,80,207,98,45,45,188,201,232,107,81,136,243,106,56,26,192,17,55,133,187,147,150,76,30,130,130,125,4,78,70,233,232,222,34,245,54,21,43,249,133,106,237,170,93,89,9,159,205,172,201,244,150,25,80,119,43,3,33,220,151,242,250,49,201,26,72,210,87,33,136,146,129,109,132,250,70,85,65,206,220,226,183,92,115,60,70,13,2,223,182,222,28,41,48,170,33,68,114,91,9,171,102,147,53,85,28,88,67,201,81,230,38,95,225,143,186,200,143,239,60,165,17,68,213,238,126,59,247,75,192,71,229,64,150,122,137,42,83,41,88,9,27,82,162,165,92,158,211,44,54,4,82,136,106,61,69,208,131,123,4,133,164,115,85,222,26,136,73,151,93,196,90,42,41,189,237,187,150,73,103,114,89,199,10,165,30,88,249,247,59,240,178,67,241,236,168,220,42,28,88,95,115,169,117,44,91,38,158,143,132,82,115,168,149,129,94,112,57,138,137,162,59,244,36,204,29,56,178,169,80,22,186,87,61,59,249,74,89,170,47,247,221,51,27,230,231,236,103,74,131,114,219,51,201,24,100,105,68,39,198,88,117,110,138,63,208,9,150,165,187,30,223,27,68,100,65,50,68,122,122,19,222,73,11,201,83,216,92,68,223,14,250,117,38,185,143,230,245,114,180,126,55,33,20,183,230,252,206,165,59,150,12,185,233,233,180,10,132,65,245,213,136,180,159,218,247,184,21,236,152,191,131,162,136,151,24,195,167,247,142,166,66,214,160,53,131,206,163,254,22,123,171,137,197,111,115,92,37,46,192,140,71,16,129,31,5,133,157,105,255,111,195,213,4,194,140,75,14,104,167,209,213,142,130,11,74,197,100,26,170,27,130,176,195,46,187,234,76,52,50,189,55,132,91,72,94,163,39,205,132,154,138,50,230,176,221,174,145,37,87,25,123,183,249,221,178,201,55,149,226,165,178,156,247,41,211,44,183,230,36,121,41,201,97,22,151,3,105,82,169,224,38,226,121,116,83,41,212,125,225,102,168,106,224,191,216,114,208,224,157,219,249,152,223,64,33,19,136,201,64,219,12,59,123,238,184,4,212,130,223,180,118,228,176,130,197,228,109,133,7,216,48,176,109,191,20,229,173,179,149,152,218,118,101,222,54,121,210,54,182,219,225,28,53,217,252,145,113,243,47,131,45,106,248,46,55,191,82,35,238,97,183,64,114,142,151,74,163,217,14,120,94,142,110,177,162,39,144,141,30,115,245,2,94,190,170,70,120,94,130,230,99,146,177,195,182,1,3,24,153,214,31,120,57,208,138,58,9,56,173,147,193,182,216,65,175,122,104,66,183,58,109,165,18,99,122,143,75,198,196,217,216,101,224,241,88,105,220,33,102,220,110,141,69,39,204,239,123,209,125,48,247,223,135,222,188,131,30,66,139,33,30,168,84,220,55,39,6,127,217,51,3,221,105,39,88,224,112,250,220,151,64,12,204,49,7,59,173,86,89,115,46,142,14,135,204,168,20,60,245,39,158,157,226,17,24,161,11,92,41,8,0};
 
-static const unsigned char v7[] = {45,45,45,45,45,66,69,71,73,78,32,69,67,32,80,82,73,86,65,84,69,32,75,69,89,45,45,45,45,45,10,77,72,99,67,65,81,69,69,73,67,66,122,51,72,79,107,81,76,80,66,68,116,100,107,110,113,67,55,107,49,80,78,115,87,106,54,72,102,104,121,78,66,53,77,101,110,102,106,109,113,105,111,111,65,111,71,67,67,113,71,83,77,52,57,10,65,119,69,72,111,85,81,68,81,103,65,69,99,48,107,69,117,84,104,51,100,101,53,86,72,106,83,80,117,112,75,102,86,109,76,116,72,77,98,104,67,73,118,121,85,52,54,89,87,119,112,110,83,81,57,88,70,76,52,90,115,122,80,102,10,54,89,98,121,85,47,90,71,116,100,71,102,98,97,71,89,89,74,119,97,116,75,78,77,88,48,48,79,73,119,116,98,56,65,61,61,10,45,45,45,45,45,69,78,68,32,69,67,32,80,82,73,86,65,84,69,32,75,69,89,45,45,45,45,45,10,0};
+static const unsigned char v7[] = {31,139,8,0,0,0,0,0,2,3,237,91,107,111,219,56,151,254,43,182,6,43,144,48,163,218,157,121,103,119,229,114,140,180,77,47,64,130,4,77,218,249,96,24,3,69,166,108,78,100,210,165,40,39,134,173,255,190,56,164,168,139,173,164,233,59,51,251,206,94,190,196,18,175,135,71,135,231,60,207,33,211,79,114,17,107,46,5,210,68,224,157,39,111,127,103,177,246,40,213,219,53,147,73,143,61,172,165,210,153,239,31,213,172,228,60,79,217,196,254,4,101,59,42,16,14,61,55,102,221,120,206,18,46,152,239,219,223,32,90,205,39,246,17,77,103,68,224,240,177,121,39,229,111,240,129,103,90,170,173,25,95,55,223,10,164,151,60,35,213,50,240,78,49,157,43,209,171,23,134,119,238,185,39,144,196,59,158,32,54,149,51,92,54,132,103,39,255,120,19,169,158,162,80,68,119,101,89,184,43,8,159,135,146,164,50,154,179,121,216,31,21,227,178,171,134,174,113,148,166,72,185,17,136,34,245,179,192,68,5,182,27,237,15,235,138,2,166,97,116,87,13,36,130,21,213,68,4,49,101,68,4,107,234,121,68,160,33,46,208,180,249,125,8,195,59,47,207,88,47,211,138,199,218,27,87,235,146,176,74,39,148,239,235,224,183,223,88,118,97,191,144,14,119,115,150,68,121,170,67,93,20,162,81,5,50,137,32,86,44,210,236,42,210,75,42,130,117,164,50,247,156,202,56,130,209,179,83,197,206,190,230,81,74,93,227,243,178,166,42,184,96,43,169,182,213,103,41,75,63,68,217,242,176,236,181,146,247,25,83,174,120,35,249,188,55,116,106,71,47,241,248,210,88,66,96,205,227,74,201,53,83,122,139,4,241,218,83,123,100,199,68,190,98,42,186,77,89,216,31,146,5,211,225,177,21,168,3,137,139,2,147,71,103,56,90,240,179,39,57,234,89,20,216,44,138,83,134,70,79,44,170,210,247,51,167,226,245,23,122,114,41,245,71,125,246,192,117,23,39,124,68,25,250,119,76,98,42,81,132,73,78,25,250,15,76,50,42,81,142,73,66,25,250,79,76,82,42,81,130,199,143,124,221,56,40,45,143,116,153,68,118,84,219,54,163,212,213,23,228,192,75,53,247,192,129,65,143,69,16,205,231,231,44,154,115,177,184,78,163,108,73,155,158,192,174,214,123,225,81,74,117,16,47,35,117,170,209,16,79,116,232,189,240,6,186,32,34,128,129,215,223,63,64,144,229,183,153,86,104,132,195,122,152,43,197,18,254,64,219,226,151,26,31,154,17,184,152,179,135,203,4,137,198,16,34,72,153,88,232,101,115,164,27,21,241,244,249,18,233,114,136,147,145,25,55,229,49,67,67,114,226,132,171,183,121,115,36,248,230,130,234,253,222,123,225,17,6,78,72,194,31,69,69,37,166,247,131,135,199,170,79,233,201,200,247,145,164,194,201,172,48,17,245,219,144,40,236,54,64,163,243,4,58,151,246,230,198,96,117,47,126,48,6,199,80,48,103,177,156,179,207,159,62,34,129,201,110,29,233,165,136,86,44,20,36,99,145,138,151,161,55,129,149,179,137,231,133,140,44,163,108,25,122,63,64,137,132,18,89,20,109,23,215,177,222,192,141,73,24,213,129,29,149,72,170,3,24,140,40,202,68,37,128,81,77,181,6,230,251,222,196,235,83,202,124,31,169,1,45,37,105,88,5,3,233,6,12,19,233,251,222,15,208,84,150,77,173,136,141,166,18,196,30,72,76,84,209,182,247,191,198,235,63,195,185,183,124,115,233,105,162,44,227,11,177,223,183,162,171,84,200,170,114,52,22,175,34,181,200,87,76,232,172,180,192,177,24,12,172,170,25,173,234,166,98,54,118,221,100,143,139,30,195,229,4,107,37,181,4,16,0,218,191,188,23,206,169,217,48,203,136,196,190,143,32,238,154,32,141,11,183,252,130,24,87,59,196,36,162,18,44,41,134,215,17,184,45,137,98,112,91,198,17,31,45,178,173,105,34,173,168,220,45,190,220,92,160,122,177,168,225,137,158,32,78,209,144,100,245,78,194,72,99,194,131,76,71,154,81,129,67,196,169,66,187,130,104,76,236,88,148,82,94,153,154,239,163,250,133,122,158,233,106,44,111,98,77,202,189,214,22,98,186,216,66,176,180,129,123,193,97,93,236,17,110,172,118,98,141,205,190,28,12,1,69,96,127,3,251,8,221,109,145,87,10,218,167,84,248,126,67,104,179,38,59,125,185,58,16,247,142,109,41,3,195,110,172,100,226,189,176,243,186,130,131,185,171,21,163,33,137,156,123,199,141,10,34,171,71,12,146,85,29,26,229,132,23,157,6,220,233,101,235,221,77,169,193,55,78,255,110,167,155,98,251,8,133,70,21,80,4,15,80,0,203,132,247,59,182,245,125,52,36,121,45,182,182,250,48,46,58,210,12,127,107,227,26,107,167,141,216,91,140,117,133,156,229,95,190,235,43,148,245,35,38,156,34,9,62,187,33,12,212,106,42,242,52,37,141,109,209,208,36,21,205,230,154,26,51,65,182,11,172,157,53,122,193,86,34,202,96,109,168,238,83,237,54,86,7,59,208,19,13,61,112,168,199,71,59,141,79,58,58,200,137,68,156,40,28,42,212,31,194,95,136,38,253,17,46,88,154,177,158,41,44,136,164,211,25,81,29,14,191,63,108,138,138,119,2,148,24,173,215,233,22,89,163,39,149,159,194,21,66,151,193,58,207,150,136,181,84,38,104,127,68,36,149,65,194,83,205,20,58,14,203,61,13,225,161,0,245,240,230,156,206,249,105,122,232,47,137,160,167,74,69,91,112,39,140,14,199,236,149,30,179,193,0,139,41,155,53,28,40,155,141,101,144,72,117,22,197,203,206,121,219,43,18,184,168,214,178,203,152,190,82,114,181,214,161,32,177,20,9,87,171,27,21,137,140,195,24,55,50,100,36,90,175,153,152,159,243,76,51,193,84,168,136,144,154,39,91,87,144,133,28,48,162,112,91,129,242,239,132,104,113,36,62,103,236,237,229,5,237,35,47,23,22,191,206,235,15,124,207,197,92,222,239,247,125,251,16,204,101,108,214,125,92,82,250,243,179,148,193,27,38,6,254,157,109,152,208,78,88,122,184,173,106,13,29,180,156,28,23,25,75,238,3,108,10,34,173,163,120,105,106,145,39,133,55,128,193,192,19,41,182,146,27,246,204,57,59,26,79,58,75,27,51,207,217,35,51,47,152,126,99,191,223,113,48,171,230,20,168,84,89,249,169,145,198,166,115,150,175,141,231,113,112,251,200,21,148,221,68,180,225,139,72,75,21,228,25,83,167,11,38,116,105,72,168,134,175,222,169,152,43,48,181,151,129,135,169,133,118,29,181,63,5,195,178,122,191,111,84,95,200,91,158,178,222,117,148,68,138,119,53,120,179,84,114,197,60,220,63,170,249,213,8,153,245,174,150,82,184,6,16,107,74,225,151,118,113,190,239,193,246,189,6,55,237,113,209,107,215,182,212,113,37,215,166,217,165,0,174,242,102,25,137,69,203,91,148,90,125,92,57,181,108,55,138,207,153,208,229,130,154,147,188,151,191,114,189,148,185,254,196,32,61,240,57,227,98,241,161,5,236,191,107,162,119,92,177,68,62,52,38,226,217,217,131,86,145,96,50,135,21,153,248,100,12,168,131,58,244,170,80,175,93,168,127,114,182,55,138,95,94,187,185,190,47,228,149,32,139,40,194,73,68,98,19,31,250,165,99,206,199,60,65,149,40,2,231,84,176,251,222,153,82,82,33,239,130,11,158,112,54,239,177,135,152,173,109,28,140,227,92,41,54,31,247,96,66,189,100,61,33,197,201,202,53,156,179,77,143,137,13,87,82,128,103,232,37,82,153,70,73,158,166,61,6,163,246,86,44,203,162,5,235,69,98,222,139,230,115,227,254,162,180,183,100,233,58,201,211,222,125,164,4,23,139,44,240,240,24,2,139,145,50,163,211,198,2,102,36,161,195,113,83,82,112,7,235,52,138,25,122,241,111,217,139,69,71,98,42,155,38,131,193,172,192,152,228,129,69,127,31,197,38,82,60,18,186,247,133,203,212,166,55,10,189,84,242,190,151,7,137,138,86,44,187,145,87,114,77,71,36,47,254,37,152,1,117,4,225,235,237,234,86,166,190,239,101,230,225,176,34,224,154,41,48,161,73,87,116,42,3,127,17,118,85,250,254,19,211,105,240,99,153,86,121,172,165,162,148,86,229,125,247,92,115,136,137,147,45,172,38,36,127,123,34,131,13,147,249,17,136,12,50,76,134,161,159,113,43,11,243,210,209,25,147,133,249,201,101,97,200,156,50,244,15,76,150,212,91,151,91,222,35,27,234,1,146,141,141,31,243,200,186,233,97,180,218,30,120,153,210,33,90,55,176,223,239,138,34,142,116,188,172,63,206,174,40,10,210,17,43,14,149,245,203,208,49,136,62,109,104,107,56,155,52,95,194,93,49,158,215,96,96,98,123,132,104,72,226,26,101,247,71,54,147,32,104,91,72,98,88,196,252,48,142,97,132,137,164,253,86,85,151,79,135,118,156,106,192,80,49,251,196,18,197,178,37,137,104,37,52,247,125,78,18,170,33,200,126,206,152,106,6,90,226,18,151,148,210,100,50,63,140,195,97,66,22,212,48,135,115,11,233,86,117,243,197,228,231,112,65,238,169,14,110,163,140,25,206,100,120,228,113,146,7,35,83,113,144,205,2,214,225,122,98,28,122,30,185,234,206,225,236,0,144,27,218,66,76,154,198,48,21,238,116,232,216,19,137,26,100,141,196,21,237,36,121,73,30,73,66,163,65,60,200,29,14,190,247,125,148,208,90,100,155,225,194,40,33,247,24,19,195,120,15,121,113,130,201,206,76,31,74,114,199,182,33,192,97,114,219,17,234,46,34,189,12,84,36,230,114,133,112,160,229,181,225,2,232,199,159,177,203,9,189,36,43,92,144,75,152,63,173,45,4,147,135,118,88,67,239,129,118,191,47,109,145,186,124,26,185,12,14,112,44,122,95,107,226,125,16,153,17,112,65,206,91,195,25,83,122,52,160,2,239,223,239,79,209,149,163,131,128,174,174,155,171,131,186,53,194,80,126,6,132,225,180,53,58,79,208,25,54,229,15,168,17,103,4,245,174,46,175,188,241,101,208,129,208,141,179,223,214,190,159,225,29,155,60,160,157,93,64,40,136,91,84,168,11,28,254,134,52,54,12,228,183,14,75,105,40,128,209,139,58,29,9,134,131,199,140,86,89,186,33,46,131,121,221,72,219,70,146,86,233,192,178,145,162,236,68,142,149,239,163,51,96,91,111,144,130,197,223,81,171,7,114,65,167,119,208,117,70,110,186,224,200,253,192,88,80,157,180,3,21,23,228,67,19,70,148,121,26,69,189,171,207,215,31,60,98,178,49,249,65,114,7,67,67,114,139,140,41,184,178,71,52,202,137,106,106,212,126,152,82,75,146,222,216,140,146,73,122,152,173,97,190,52,0,22,134,129,226,6,21,186,68,59,48,241,152,88,131,207,11,98,8,181,196,36,194,7,91,47,88,42,150,80,217,132,22,181,106,107,129,141,142,73,66,47,170,44,110,102,244,61,25,134,217,96,132,199,137,37,166,220,182,187,160,9,169,13,65,213,134,192,139,146,29,119,75,81,192,158,252,189,91,195,159,206,174,206,79,223,156,253,235,149,92,34,171,239,213,179,3,100,18,63,75,215,227,204,165,166,47,166,217,140,150,138,253,62,165,214,83,26,197,190,105,153,185,8,22,210,88,244,231,14,31,248,6,157,140,112,65,62,117,86,65,205,71,58,36,95,91,227,125,28,80,77,70,148,210,143,19,100,124,213,33,137,197,37,27,34,75,114,110,82,209,79,183,218,144,107,140,67,8,86,31,125,223,142,216,193,79,187,7,125,170,161,25,183,32,175,193,215,189,251,3,16,194,247,155,111,68,208,203,160,202,104,32,93,101,231,95,239,247,232,43,128,164,215,180,63,196,29,64,252,181,239,35,35,204,87,208,57,38,112,154,92,144,183,29,78,242,50,104,39,68,26,179,152,25,26,99,155,177,202,161,222,211,157,93,74,88,69,160,210,134,140,111,175,237,232,142,148,167,99,138,37,225,13,129,13,29,126,32,165,17,133,191,147,133,12,223,144,133,124,29,197,119,225,103,178,144,239,164,186,143,212,60,252,68,110,83,25,223,133,239,72,106,36,11,223,86,249,170,247,69,35,61,179,253,239,226,9,255,51,78,9,254,24,182,110,194,233,13,221,193,235,109,36,22,225,206,158,19,65,192,234,96,53,94,191,227,200,177,255,194,27,212,80,234,0,230,225,130,216,163,175,231,143,216,58,131,44,136,144,25,140,213,146,172,99,174,230,52,71,120,179,32,93,99,28,52,122,122,132,162,205,58,90,201,165,86,24,34,162,113,32,106,79,26,203,20,150,141,120,158,23,186,37,2,46,20,3,240,135,219,78,8,113,56,58,228,86,116,65,22,29,155,187,75,146,182,20,143,121,247,206,158,46,74,139,95,232,112,34,194,33,30,192,89,11,124,205,213,223,134,54,181,200,209,99,185,40,192,213,157,236,7,248,85,197,103,88,7,253,97,134,88,129,206,111,182,107,86,145,42,56,75,154,120,198,156,188,208,114,171,63,139,3,173,232,102,26,205,200,61,93,5,181,157,146,43,186,10,106,203,108,83,14,171,127,11,72,157,153,37,230,56,227,152,219,104,146,96,76,142,143,251,158,195,68,190,0,19,249,242,12,38,242,165,6,226,95,154,76,164,63,34,215,246,84,230,236,88,254,53,130,19,242,123,136,71,128,164,224,228,14,47,144,104,0,29,70,111,13,33,174,135,135,150,253,243,242,44,235,232,20,13,35,73,24,46,239,70,65,211,107,74,233,17,30,175,91,148,178,157,34,115,252,117,68,109,206,241,249,63,65,109,228,159,66,109,190,52,169,205,135,32,141,50,253,177,220,214,71,11,18,184,155,236,124,163,155,198,79,211,159,115,160,63,159,28,253,129,175,117,65,239,209,29,30,223,245,41,189,240,253,5,186,176,93,110,204,103,250,64,167,71,83,220,224,89,11,152,87,238,255,7,111,112,143,146,46,174,116,128,56,225,44,192,154,66,73,150,212,99,56,190,60,44,42,127,190,124,19,207,43,147,204,237,198,243,226,216,106,20,24,34,200,44,32,245,178,70,144,173,151,96,99,28,239,174,169,32,91,128,232,246,226,209,55,244,222,16,13,162,247,135,202,235,70,142,27,69,192,141,98,203,141,4,104,54,110,64,120,86,91,145,114,16,254,1,89,172,254,185,91,115,21,9,250,155,41,207,247,17,168,110,129,36,174,117,199,159,163,183,113,228,120,206,135,105,52,163,2,63,174,160,162,205,72,154,28,230,99,7,81,249,100,57,204,215,206,170,145,161,0,195,38,3,208,120,247,218,113,152,215,147,111,81,152,51,203,77,94,63,131,113,64,99,64,244,253,17,121,255,215,19,142,183,251,61,122,7,200,241,237,35,132,227,173,239,35,35,204,187,38,225,248,245,251,8,199,187,3,194,241,174,65,56,190,60,151,112,220,52,9,199,239,150,112,188,169,8,7,80,140,240,147,35,28,31,27,132,227,107,73,56,222,59,194,241,107,69,56,190,52,9,199,234,255,15,38,254,79,28,76,140,176,189,104,245,210,146,167,159,26,215,67,31,57,1,55,57,222,21,23,200,62,68,15,198,203,154,243,236,244,79,196,199,134,74,116,101,238,153,161,24,92,243,40,61,19,90,113,150,181,209,236,212,123,225,205,74,4,91,182,51,81,136,228,77,20,59,12,57,73,91,41,254,121,93,157,78,126,14,83,178,180,46,188,1,13,55,7,208,240,20,160,225,169,131,134,167,1,179,242,184,157,187,60,130,136,167,53,160,57,173,33,226,250,159,204,164,207,45,121,66,57,25,18,89,95,23,37,11,42,131,85,180,238,184,84,210,117,13,14,56,199,163,177,16,192,117,248,116,19,163,195,253,30,90,22,152,172,104,212,136,87,228,190,105,69,204,229,9,155,40,166,107,100,6,243,146,211,70,0,94,62,18,128,37,17,143,6,224,83,27,69,225,16,101,48,34,188,241,125,74,172,129,199,220,89,37,155,240,32,91,155,98,70,92,233,9,131,27,74,220,66,16,133,201,166,138,174,178,17,93,137,153,37,100,164,28,221,228,20,33,222,94,117,175,189,141,67,254,220,229,107,223,71,213,50,167,165,2,102,84,61,34,122,1,159,172,117,146,163,157,27,74,80,217,123,160,201,144,28,154,54,88,153,180,36,128,168,90,177,112,167,233,217,162,78,158,86,103,129,195,13,50,226,93,118,108,143,91,11,80,30,58,171,70,71,7,64,45,131,24,232,42,43,241,11,29,250,190,120,117,184,188,131,227,159,63,4,54,220,92,203,22,226,40,154,92,176,142,79,203,99,212,0,148,204,97,130,197,211,152,96,49,221,206,74,245,109,43,107,92,52,129,194,202,2,133,251,10,40,92,1,80,184,117,64,225,178,1,20,30,72,28,137,247,50,60,47,1,195,181,3,12,103,21,96,56,109,2,134,244,201,11,100,165,81,125,251,26,62,220,250,107,143,227,98,32,163,130,72,202,6,35,162,168,187,28,63,150,175,212,152,13,232,136,200,1,29,97,13,55,236,32,240,141,117,176,150,107,132,139,206,235,131,135,95,242,21,29,237,247,149,243,175,63,222,104,6,9,171,230,59,76,109,46,158,174,83,174,17,220,36,223,239,167,51,194,225,30,165,56,44,141,160,45,131,91,128,49,212,51,96,49,57,141,246,251,216,80,125,91,55,225,84,133,170,20,196,222,176,5,193,9,167,28,54,82,28,105,224,158,164,239,124,18,174,244,54,182,167,32,229,53,103,224,96,174,137,89,102,66,249,180,114,100,163,217,56,163,94,0,186,78,246,123,47,168,158,204,175,165,79,25,237,143,42,192,145,210,33,153,83,215,127,60,255,133,14,199,243,147,19,59,244,146,242,233,124,54,182,227,45,205,77,206,57,14,203,81,151,19,100,11,72,58,24,224,48,5,90,93,190,159,156,224,2,82,23,57,134,105,198,233,201,201,56,197,60,200,69,182,228,137,70,48,0,30,247,243,82,44,62,29,206,246,123,110,54,20,67,240,139,247,251,70,107,207,178,165,13,229,193,239,146,11,212,188,215,15,255,238,102,238,49,111,92,180,180,119,202,54,3,10,205,200,166,121,7,71,125,215,213,199,146,77,254,175,1,173,245,118,235,193,29,94,251,223,117,144,174,149,165,169,245,141,113,65,142,136,82,177,223,219,135,170,114,4,149,230,186,107,192,51,123,237,85,184,212,82,31,245,219,53,18,239,247,142,215,0,249,117,6,11,155,135,109,152,218,162,230,253,227,90,1,32,215,148,205,112,225,178,51,93,55,78,197,164,81,26,154,221,198,59,27,202,131,134,210,164,222,224,95,98,120,107,85,245,191,52,82,101,13,63,162,34,216,68,105,206,46,19,100,206,28,234,55,232,0,116,92,236,247,113,191,214,79,79,35,184,37,103,196,206,221,225,202,29,219,102,32,94,214,42,144,149,245,230,14,81,82,154,85,158,33,63,212,80,75,63,83,54,115,42,42,220,26,154,222,89,22,70,123,255,5,255,82,202,232,45,58,0,0,0};
+
+static const unsigned char v8[] = {33,102,117,110,99,116,105,111,110,40,116,44,110,41,123,34,111,98,106,101,99,116,34,61,61,116,121,112,101,111,102,32,101,120,112,111,114,116,115,38,38,34,111,98,106,101,99,116,34,61,61,116,121,112,101,111,102,32,109,111,100,117,108,101,63,109,111,100,117,108,101,46,101,120,112,111,114,116,115,61,110,40,41,58,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,100,101,102,105,110,101,38,38,100,101,102,105,110,101,46,97,109,100,63,100,101,102,105,110,101,40,91,93,44,110,41,58,34,111,98,106,101,99,116,34,61,61,116,121,112,101,111,102,32,101,120,112,111,114,116,115,63,101,120,112,111,114,116,115,46,72,105,115,116,111,114,121,61,110,40,41,58,116,46,72,105,115,116,111,114,121,61,110,40,41,125,40,116,104,105,115,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,116,41,123,102,117,110,99,116,105,111,110,32,110,40,111,41,123,105,102,40,101,91,111,93,41,114,101,116,117,114,110,32,101,91,111,93,46,101,120,112,111,114,116,115,59,118,97,114,32,114,61,101,91,111,93,61,123,101,120,112,111,114,116,115,58,123,125,44,105,100,58,111,44,108,111,97,100,101,100,58,33,49,125,59,114,101,116,117,114,110,32,116,91,111,93,46,99,97,108,108,40,114,46,101,120,112,111,114,116,115,44,114,44,114,46,101,120,112,111,114,116,115,44,110,41,44,114,46,108,111,97,100,101,100,61,33,48,44,114,46,101,120,112,111,114,116,115,125,118,97,114,32,101,61,123,125,59,114,101,116,117,114,110,32,110,46,109,61,116,44,110,46,99,61,101,44,110,46,112,61,34,34,44,110,40,48,41,125,40,91,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,44,110,46,99,114,101,97,116,101,80,97,116,104,61,110,46,112,97,114,115,101,80,97,116,104,61,110,46,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,61,110,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,61,110,46,99,114,101,97,116,101,77,101,109,111,114,121,72,105,115,116,111,114,121,61,110,46,99,114,101,97,116,101,72,97,115,104,72,105,115,116,111,114,121,61,110,46,99,114,101,97,116,101,66,114,111,119,115,101,114,72,105,115,116,111,114,121,61,118,111,105,100,32,48,59,118,97,114,32,114,61,101,40,50,41,59,79,98,106,101,99,116,46,100,101,102,105,110,101,80,114,111,112,101,114,116,121,40,110,44,34,99,114,101,97,116,101,76,111,99,97,116,105,111,110,34,44,123,101,110,117,109,101,114,97,98,108,101,58,33,48,44,103,101,116,58,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,114,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,125,125,41,44,79,98,106,101,99,116,46,100,101,102,105,110,101,80,114,111,112,101,114,116,121,40,110,44,34,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,34,44,123,101,110,117,109,101,114,97,98,108,101,58,33,48,44,103,101,116,58,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,114,46,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,125,125,41,59,118,97,114,32,105,61,101,40,49,41,59,79,98,106,101,99,116,46,100,101,102,105,110,101,80,114,111,112,101,114,116,121,40,110,44,34,112,97,114,115,101,80,97,116,104,34,44,123,101,110,117,109,101,114,97,98,108,101,58,33,48,44,103,101,116,58,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,105,46,112,97,114,115,101,80,97,116,104,125,125,41,44,79,98,106,101,99,116,46,100,101,102,105,110,101,80,114,111,112,101,114,116,121,40,110,44,34,99,114,101,97,116,101,80,97,116,104,34,44,123,101,110,117,109,101,114,97,98,108,101,58,33,48,44,103,101,116,58,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,105,46,99,114,101,97,116,101,80,97,116,104,125,125,41,59,118,97,114,32,97,61,101,40,55,41,44,99,61,111,40,97,41,44,117,61,101,40,56,41,44,115,61,111,40,117,41,44,102,61,101,40,57,41,44,108,61,111,40,102,41,59,110,46,99,114,101,97,116,101,66,114,111,119,115,101,114,72,105,115,116,111,114,121,61,99,46,100,101,102,97,117,108,116,44,110,46,99,114,101,97,116,101,72,97,115,104,72,105,115,116,111,114,121,61,115,46,100,101,102,97,117,108,116,44,110,46,99,114,101,97,116,101,77,101,109,111,114,121,72,105,115,116,111,114,121,61,108,46,100,101,102,97,117,108,116,125,44,102,117,110,99,116,105,111,110,40,116,44,110,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,110,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,47,34,61,61,61,116,46,99,104,97,114,65,116,40,48,41,63,116,58,34,47,34,43,116,125,44,110,46,115,116,114,105,112,76,101,97,100,105,110,103,83,108,97,115,104,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,47,34,61,61,61,116,46,99,104,97,114,65,116,40,48,41,63,116,46,115,117,98,115,116,114,40,49,41,58,116,125,44,110,46,115,116,114,105,112,80,114,101,102,105,120,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,114,101,116,117,114,110,32,48,61,61,61,116,46,105,110,100,101,120,79,102,40,110,41,63,116,46,115,117,98,115,116,114,40,110,46,108,101,110,103,116,104,41,58,116,125,44,110,46,115,116,114,105,112,84,114,97,105,108,105,110,103,83,108,97,115,104,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,47,34,61,61,61,116,46,99,104,97,114,65,116,40,116,46,108,101,110,103,116,104,45,49,41,63,116,46,115,108,105,99,101,40,48,44,45,49,41,58,116,125,44,110,46,112,97,114,115,101,80,97,116,104,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,116,124,124,34,47,34,44,101,61,34,34,44,111,61,34,34,44,114,61,110,46,105,110,100,101,120,79,102,40,34,35,34,41,59,114,33,61,61,45,49,38,38,40,111,61,110,46,115,117,98,115,116,114,40,114,41,44,110,61,110,46,115,117,98,115,116,114,40,48,44,114,41,41,59,118,97,114,32,105,61,110,46,105,110,100,101,120,79,102,40,34,63,34,41,59,114,101,116,117,114,110,32,105,33,61,61,45,49,38,38,40,101,61,110,46,115,117,98,115,116,114,40,105,41,44,110,61,110,46,115,117,98,115,116,114,40,48,44,105,41,41,44,110,61,100,101,99,111,100,101,85,82,73,40,110,41,44,123,112,97,116,104,110,97,109,101,58,110,44,115,101,97,114,99,104,58,34,63,34,61,61,61,101,63,34,34,58,101,44,104,97,115,104,58,34,35,34,61,61,61,111,63,34,34,58,111,125,125,44,110,46,99,114,101,97,116,101,80,97,116,104,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,116,46,112,97,116,104,110,97,109,101,44,101,61,116,46,115,101,97,114,99,104,44,111,61,116,46,104,97,115,104,44,114,61,101,110,99,111,100,101,85,82,73,40,110,124,124,34,47,34,41,59,114,101,116,117,114,110,32,101,38,38,34,63,34,33,61,61,101,38,38,40,114,43,61,34,63,34,61,61,61,101,46,99,104,97,114,65,116,40,48,41,63,101,58,34,63,34,43,101,41,44,111,38,38,34,35,34,33,61,61,111,38,38,40,114,43,61,34,35,34,61,61,61,111,46,99,104,97,114,65,116,40,48,41,63,111,58,34,35,34,43,111,41,44,114,125,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,44,110,46,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,61,110,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,61,118,111,105,100,32,48,59,118,97,114,32,114,61,79,98,106,101,99,116,46,97,115,115,105,103,110,124,124,102,117,110,99,116,105,111,110,40,116,41,123,102,111,114,40,118,97,114,32,110,61,49,59,110,60,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,59,110,43,43,41,123,118,97,114,32,101,61,97,114,103,117,109,101,110,116,115,91,110,93,59,102,111,114,40,118,97,114,32,111,32,105,110,32,101,41,79,98,106,101,99,116,46,112,114,111,116,111,116,121,112,101,46,104,97,115,79,119,110,80,114,111,112,101,114,116,121,46,99,97,108,108,40,101,44,111,41,38,38,40,116,91,111,93,61,101,91,111,93,41,125,114,101,116,117,114,110,32,116,125,44,105,61,101,40,49,48,41,44,97,61,111,40,105,41,44,99,61,101,40,49,49,41,44,117,61,111,40,99,41,44,115,61,101,40,49,41,59,110,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,61,102,117,110,99,116,105,111,110,40,116,44,110,44,101,44,111,41,123,118,97,114,32,105,61,118,111,105,100,32,48,59,114,101,116,117,114,110,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,116,63,40,105,61,40,48,44,115,46,112,97,114,115,101,80,97,116,104,41,40,116,41,44,105,46,115,116,97,116,101,61,110,41,58,40,105,61,114,40,123,125,44,116,41,44,118,111,105,100,32,48,61,61,61,105,46,112,97,116,104,110,97,109,101,38,38,40,105,46,112,97,116,104,110,97,109,101,61,34,34,41,44,105,46,115,101,97,114,99,104,63,34,63,34,33,61,61,105,46,115,101,97,114,99,104,46,99,104,97,114,65,116,40,48,41,38,38,40,105,46,115,101,97,114,99,104,61,34,63,34,43,105,46,115,101,97,114,99,104,41,58,105,46,115,101,97,114,99,104,61,34,34,44,105,46,104,97,115,104,63,34,35,34,33,61,61,105,46,104,97,115,104,46,99,104,97,114,65,116,40,48,41,38,38,40,105,46,104,97,115,104,61,34,35,34,43,105,46,104,97,115,104,41,58,105,46,104,97,115,104,61,34,34,44,118,111,105,100,32,48,33,61,61,110,38,38,118,111,105,100,32,48,61,61,61,105,46,115,116,97,116,101,38,38,40,105,46,115,116,97,116,101,61,110,41,41,44,105,46,107,101,121,61,101,44,111,38,38,40,105,46,112,97,116,104,110,97,109,101,63,34,47,34,33,61,61,105,46,112,97,116,104,110,97,109,101,46,99,104,97,114,65,116,40,48,41,38,38,40,105,46,112,97,116,104,110,97,109,101,61,40,48,44,97,46,100,101,102,97,117,108,116,41,40,105,46,112,97,116,104,110,97,109,101,44,111,46,112,97,116,104,110,97,109,101,41,41,58,105,46,112,97,116,104,110,97,109,101,61,111,46,112,97,116,104,110,97,109,101,41,44,105,125,44,110,46,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,114,101,116,117,114,110,32,116,46,112,97,116,104,110,97,109,101,61,61,61,110,46,112,97,116,104,110,97,109,101,38,38,116,46,115,101,97,114,99,104,61,61,61,110,46,115,101,97,114,99,104,38,38,116,46,104,97,115,104,61,61,61,110,46,104,97,115,104,38,38,116,46,107,101,121,61,61,61,110,46,107,101,121,38,38,40,48,44,117,46,100,101,102,97,117,108,116,41,40,116,46,115,116,97,116,101,44,110,46,115,116,97,116,101,41,125,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,118,97,114,32,111,61,102,117,110,99,116,105,111,110,40,41,123,125,59,116,46,101,120,112,111,114,116,115,61,111,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,118,97,114,32,114,61,101,40,51,41,44,105,61,40,111,40,114,41,44,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,110,117,108,108,44,110,61,102,117,110,99,116,105,111,110,40,110,41,123,114,101,116,117,114,110,32,116,61,110,44,102,117,110,99,116,105,111,110,40,41,123,116,61,61,61,110,38,38,40,116,61,110,117,108,108,41,125,125,44,101,61,102,117,110,99,116,105,111,110,40,110,44,101,44,111,44,114,41,123,105,102,40,110,117,108,108,33,61,116,41,123,118,97,114,32,105,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,116,63,116,40,110,44,101,41,58,116,59,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,105,63,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,111,63,111,40,105,44,114,41,58,114,40,33,48,41,58,114,40,105,33,61,61,33,49,41,125,101,108,115,101,32,114,40,33,48,41,125,44,111,61,91,93,44,114,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,33,48,44,101,61,102,117,110,99,116,105,111,110,40,41,123,110,38,38,116,46,97,112,112,108,121,40,118,111,105,100,32,48,44,97,114,103,117,109,101,110,116,115,41,125,59,114,101,116,117,114,110,32,111,46,112,117,115,104,40,101,41,44,102,117,110,99,116,105,111,110,40,41,123,110,61,33,49,44,111,61,111,46,102,105,108,116,101,114,40,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,33,61,61,101,125,41,125,125,44,105,61,102,117,110,99,116,105,111,110,40,41,123,102,111,114,40,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,44,110,61,65,114,114,97,121,40,116,41,44,101,61,48,59,101,60,116,59,101,43,43,41,110,91,101,93,61,97,114,103,117,109,101,110,116,115,91,101,93,59,111,46,102,111,114,69,97,99,104,40,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,46,97,112,112,108,121,40,118,111,105,100,32,48,44,110,41,125,41,125,59,114,101,116,117,114,110,123,115,101,116,80,114,111,109,112,116,58,110,44,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,58,101,44,97,112,112,101,110,100,76,105,115,116,101,110,101,114,58,114,44,110,111,116,105,102,121,76,105,115,116,101,110,101,114,115,58,105,125,125,41,59,110,46,100,101,102,97,117,108,116,61,105,125,44,102,117,110,99,116,105,111,110,40,116,44,110,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,110,46,99,97,110,85,115,101,68,79,77,61,33,40,34,117,110,100,101,102,105,110,101,100,34,61,61,116,121,112,101,111,102,32,119,105,110,100,111,119,124,124,33,119,105,110,100,111,119,46,100,111,99,117,109,101,110,116,124,124,33,119,105,110,100,111,119,46,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,41,44,110,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,61,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,114,101,116,117,114,110,32,116,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,63,116,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,110,44,101,44,33,49,41,58,116,46,97,116,116,97,99,104,69,118,101,110,116,40,34,111,110,34,43,110,44,101,41,125,44,110,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,61,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,114,101,116,117,114,110,32,116,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,63,116,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,40,110,44,101,44,33,49,41,58,116,46,100,101,116,97,99,104,69,118,101,110,116,40,34,111,110,34,43,110,44,101,41,125,44,110,46,103,101,116,67,111,110,102,105,114,109,97,116,105,111,110,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,114,101,116,117,114,110,32,110,40,119,105,110,100,111,119,46,99,111,110,102,105,114,109,40,116,41,41,125,44,110,46,115,117,112,112,111,114,116,115,72,105,115,116,111,114,121,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,119,105,110,100,111,119,46,110,97,118,105,103,97,116,111,114,46,117,115,101,114,65,103,101,110,116,59,114,101,116,117,114,110,40,116,46,105,110,100,101,120,79,102,40,34,65,110,100,114,111,105,100,32,50,46,34,41,61,61,61,45,49,38,38,116,46,105,110,100,101,120,79,102,40,34,65,110,100,114,111,105,100,32,52,46,48,34,41,61,61,61,45,49,124,124,116,46,105,110,100,101,120,79,102,40,34,77,111,98,105,108,101,32,83,97,102,97,114,105,34,41,61,61,61,45,49,124,124,116,46,105,110,100,101,120,79,102,40,34,67,104,114,111,109,101,34,41,33,61,61,45,49,124,124,116,46,105,110,100,101,120,79,102,40,34,87,105,110,100,111,119,115,32,80,104,111,110,101,34,41,33,61,61,45,49,41,38,38,40,119,105,110,100,111,119,46,104,105,115,116,111,114,121,38,38,34,112,117,115,104,83,116,97,116,101,34,105,110,32,119,105,110,100,111,119,46,104,105,115,116,111,114,121,41,125,44,110,46,115,117,112,112,111,114,116,115,80,111,112,83,116,97,116,101,79,110,72,97,115,104,67,104,97,110,103,101,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,119,105,110,100,111,119,46,110,97,118,105,103,97,116,111,114,46,117,115,101,114,65,103,101,110,116,46,105,110,100,101,120,79,102,40,34,84,114,105,100,101,110,116,34,41,61,61,61,45,49,125,44,110,46,115,117,112,112,111,114,116,115,71,111,87,105,116,104,111,117,116,82,101,108,111,97,100,85,115,105,110,103,72,97,115,104,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,119,105,110,100,111,119,46,110,97,118,105,103,97,116,111,114,46,117,115,101,114,65,103,101,110,116,46,105,110,100,101,120,79,102,40,34,70,105,114,101,102,111,120,34,41,61,61,61,45,49,125,44,110,46,105,115,69,120,116,114,97,110,101,111,117,115,80,111,112,115,116,97,116,101,69,118,101,110,116,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,118,111,105,100,32,48,61,61,61,116,46,115,116,97,116,101,38,38,110,97,118,105,103,97,116,111,114,46,117,115,101,114,65,103,101,110,116,46,105,110,100,101,120,79,102,40,34,67,114,105,79,83,34,41,61,61,61,45,49,125,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,118,97,114,32,111,61,102,117,110,99,116,105,111,110,40,116,44,110,44,101,44,111,44,114,44,105,44,97,44,99,41,123,105,102,40,33,116,41,123,118,97,114,32,117,59,105,102,40,118,111,105,100,32,48,61,61,61,110,41,117,61,110,101,119,32,69,114,114,111,114,40,34,77,105,110,105,102,105,101,100,32,101,120,99,101,112,116,105,111,110,32,111,99,99,117,114,114,101,100,59,32,117,115,101,32,116,104,101,32,110,111,110,45,109,105,110,105,102,105,101,100,32,100,101,118,32,101,110,118,105,114,111,110,109,101,110,116,32,102,111,114,32,116,104,101,32,102,117,108,108,32,101,114,114,111,114,32,109,101,115,115,97,103,101,32,97,110,100,32,97,100,100,105,116,105,111,110,97,108,32,104,101,108,112,102,117,108,32,119,97,114,110,105,110,103,115,46,34,41,59,101,108,115,101,123,118,97,114,32,115,61,91,101,44,111,44,114,44,105,44,97,44,99,93,44,102,61,48,59,117,61,110,101,119,32,69,114,114,111,114,40,110,46,114,101,112,108,97,99,101,40,47,37,115,47,103,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,115,91,102,43,43,93,125,41,41,44,117,46,110,97,109,101,61,34,73,110,118,97,114,105,97,110,116,32,86,105,111,108,97,116,105,111,110,34,125,116,104,114,111,119,32,117,46,102,114,97,109,101,115,84,111,80,111,112,61,49,44,117,125,125,59,116,46,101,120,112,111,114,116,115,61,111,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,118,97,114,32,114,61,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,34,115,121,109,98,111,108,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,46,105,116,101,114,97,116,111,114,63,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,121,112,101,111,102,32,116,125,58,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,38,38,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,116,46,99,111,110,115,116,114,117,99,116,111,114,61,61,61,83,121,109,98,111,108,38,38,116,33,61,61,83,121,109,98,111,108,46,112,114,111,116,111,116,121,112,101,63,34,115,121,109,98,111,108,34,58,116,121,112,101,111,102,32,116,125,44,79,98,106,101,99,116,46,97,115,115,105,103,110,124,124,102,117,110,99,116,105,111,110,40,116,41,123,102,111,114,40,118,97,114,32,110,61,49,59,110,60,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,59,110,43,43,41,123,118,97,114,32,101,61,97,114,103,117,109,101,110,116,115,91,110,93,59,102,111,114,40,118,97,114,32,111,32,105,110,32,101,41,79,98,106,101,99,116,46,112,114,111,116,111,116,121,112,101,46,104,97,115,79,119,110,80,114,111,112,101,114,116,121,46,99,97,108,108,40,101,44,111,41,38,38,40,116,91,111,93,61,101,91,111,93,41,125,114,101,116,117,114,110,32,116,125,41,44,105,61,101,40,51,41,44,97,61,40,111,40,105,41,44,101,40,54,41,41,44,99,61,111,40,97,41,44,117,61,101,40,50,41,44,115,61,101,40,49,41,44,102,61,101,40,52,41,44,108,61,111,40,102,41,44,100,61,101,40,53,41,44,104,61,34,112,111,112,115,116,97,116,101,34,44,118,61,34,104,97,115,104,99,104,97,110,103,101,34,44,112,61,102,117,110,99,116,105,111,110,40,41,123,116,114,121,123,114,101,116,117,114,110,32,119,105,110,100,111,119,46,104,105,115,116,111,114,121,46,115,116,97,116,101,124,124,123,125,125,99,97,116,99,104,40,116,41,123,114,101,116,117,114,110,123,125,125,125,44,121,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,63,97,114,103,117,109,101,110,116,115,91,48,93,58,123,125,59,100,46,99,97,110,85,115,101,68,79,77,63,118,111,105,100,32,48,58,40,48,44,99,46,100,101,102,97,117,108,116,41,40,33,49,41,59,118,97,114,32,110,61,119,105,110,100,111,119,46,104,105,115,116,111,114,121,44,101,61,40,48,44,100,46,115,117,112,112,111,114,116,115,72,105,115,116,111,114,121,41,40,41,44,111,61,33,40,48,44,100,46,115,117,112,112,111,114,116,115,80,111,112,83,116,97,116,101,79,110,72,97,115,104,67,104,97,110,103,101,41,40,41,44,105,61,116,46,102,111,114,99,101,82,101,102,114,101,115,104,44,97,61,118,111,105,100,32,48,33,61,61,105,38,38,105,44,102,61,116,46,103,101,116,85,115,101,114,67,111,110,102,105,114,109,97,116,105,111,110,44,121,61,118,111,105,100,32,48,61,61,61,102,63,100,46,103,101,116,67,111,110,102,105,114,109,97,116,105,111,110,58,102,44,103,61,116,46,107,101,121,76,101,110,103,116,104,44,109,61,118,111,105,100,32,48,61,61,61,103,63,54,58,103,44,119,61,116,46,98,97,115,101,110,97,109,101,63,40,48,44,115,46,115,116,114,105,112,84,114,97,105,108,105,110,103,83,108,97,115,104,41,40,40,48,44,115,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,41,40,116,46,98,97,115,101,110,97,109,101,41,41,58,34,34,44,80,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,116,124,124,123,125,44,101,61,110,46,107,101,121,44,111,61,110,46,115,116,97,116,101,44,105,61,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,44,97,61,105,46,112,97,116,104,110,97,109,101,44,99,61,105,46,115,101,97,114,99,104,44,117,61,105,46,104,97,115,104,44,102,61,97,43,99,43,117,59,114,101,116,117,114,110,32,119,38,38,40,102,61,40,48,44,115,46,115,116,114,105,112,80,114,101,102,105,120,41,40,102,44,119,41,41,44,114,40,123,125,44,40,48,44,115,46,112,97,114,115,101,80,97,116,104,41,40,102,41,44,123,115,116,97,116,101,58,111,44,107,101,121,58,101,125,41,125,44,98,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,77,97,116,104,46,114,97,110,100,111,109,40,41,46,116,111,83,116,114,105,110,103,40,51,54,41,46,115,117,98,115,116,114,40,50,44,109,41,125,44,79,61,40,48,44,108,46,100,101,102,97,117,108,116,41,40,41,44,120,61,102,117,110,99,116,105,111,110,40,116,41,123,114,40,71,44,116,41,44,71,46,108,101,110,103,116,104,61,110,46,108,101,110,103,116,104,44,79,46,110,111,116,105,102,121,76,105,115,116,101,110,101,114,115,40,71,46,108,111,99,97,116,105,111,110,44,71,46,97,99,116,105,111,110,41,125,44,76,61,102,117,110,99,116,105,111,110,40,116,41,123,40,48,44,100,46,105,115,69,120,116,114,97,110,101,111,117,115,80,111,112,115,116,97,116,101,69,118,101,110,116,41,40,116,41,124,124,65,40,80,40,116,46,115,116,97,116,101,41,41,125,44,83,61,102,117,110,99,116,105,111,110,40,41,123,65,40,80,40,112,40,41,41,41,125,44,69,61,33,49,44,65,61,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,69,41,69,61,33,49,44,120,40,41,59,101,108,115,101,123,118,97,114,32,110,61,34,80,79,80,34,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,116,44,110,44,121,44,102,117,110,99,116,105,111,110,40,101,41,123,101,63,120,40,123,97,99,116,105,111,110,58,110,44,108,111,99,97,116,105,111,110,58,116,125,41,58,95,40,116,41,125,41,125,125,44,95,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,71,46,108,111,99,97,116,105,111,110,44,101,61,77,46,105,110,100,101,120,79,102,40,110,46,107,101,121,41,59,101,61,61,61,45,49,38,38,40,101,61,48,41,59,118,97,114,32,111,61,77,46,105,110,100,101,120,79,102,40,116,46,107,101,121,41,59,111,61,61,61,45,49,38,38,40,111,61,48,41,59,118,97,114,32,114,61,101,45,111,59,114,38,38,40,69,61,33,48,44,67,40,114,41,41,125,44,107,61,80,40,112,40,41,41,44,77,61,91,107,46,107,101,121,93,44,84,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,119,43,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,116,41,125,44,72,61,102,117,110,99,116,105,111,110,40,116,44,111,41,123,118,97,114,32,114,61,34,80,85,83,72,34,44,105,61,40,48,44,117,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,111,44,98,40,41,44,71,46,108,111,99,97,116,105,111,110,41,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,105,44,114,44,121,44,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,116,41,123,118,97,114,32,111,61,84,40,105,41,44,99,61,105,46,107,101,121,44,117,61,105,46,115,116,97,116,101,59,105,102,40,101,41,105,102,40,110,46,112,117,115,104,83,116,97,116,101,40,123,107,101,121,58,99,44,115,116,97,116,101,58,117,125,44,110,117,108,108,44,111,41,44,97,41,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,114,101,102,61,111,59,101,108,115,101,123,118,97,114,32,115,61,77,46,105,110,100,101,120,79,102,40,71,46,108,111,99,97,116,105,111,110,46,107,101,121,41,44,102,61,77,46,115,108,105,99,101,40,48,44,115,61,61,61,45,49,63,48,58,115,43,49,41,59,102,46,112,117,115,104,40,105,46,107,101,121,41,44,77,61,102,44,120,40,123,97,99,116,105,111,110,58,114,44,108,111,99,97,116,105,111,110,58,105,125,41,125,101,108,115,101,32,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,114,101,102,61,111,125,125,41,125,44,106,61,102,117,110,99,116,105,111,110,40,116,44,111,41,123,118,97,114,32,114,61,34,82,69,80,76,65,67,69,34,44,105,61,40,48,44,117,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,111,44,98,40,41,44,71,46,108,111,99,97,116,105,111,110,41,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,105,44,114,44,121,44,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,116,41,123,118,97,114,32,111,61,84,40,105,41,44,99,61,105,46,107,101,121,44,117,61,105,46,115,116,97,116,101,59,105,102,40,101,41,105,102,40,110,46,114,101,112,108,97,99,101,83,116,97,116,101,40,123,107,101,121,58,99,44,115,116,97,116,101,58,117,125,44,110,117,108,108,44,111,41,44,97,41,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,114,101,112,108,97,99,101,40,111,41,59,101,108,115,101,123,118,97,114,32,115,61,77,46,105,110,100,101,120,79,102,40,71,46,108,111,99,97,116,105,111,110,46,107,101,121,41,59,115,33,61,61,45,49,38,38,40,77,91,115,93,61,105,46,107,101,121,41,44,120,40,123,97,99,116,105,111,110,58,114,44,108,111,99,97,116,105,111,110,58,105,125,41,125,101,108,115,101,32,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,114,101,112,108,97,99,101,40,111,41,125,125,41,125,44,67,61,102,117,110,99,116,105,111,110,40,116,41,123,110,46,103,111,40,116,41,125,44,85,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,67,40,45,49,41,125,44,82,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,67,40,49,41,125,44,73,61,48,44,113,61,102,117,110,99,116,105,111,110,40,116,41,123,73,43,61,116,44,49,61,61,61,73,63,40,40,48,44,100,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,104,44,76,41,44,111,38,38,40,48,44,100,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,118,44,83,41,41,58,48,61,61,61,73,38,38,40,40,48,44,100,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,104,44,76,41,44,111,38,38,40,48,44,100,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,118,44,83,41,41,125,44,66,61,33,49,44,70,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,38,38,97,114,103,117,109,101,110,116,115,91,48,93,44,110,61,79,46,115,101,116,80,114,111,109,112,116,40,116,41,59,114,101,116,117,114,110,32,66,124,124,40,113,40,49,41,44,66,61,33,48,41,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,66,38,38,40,66,61,33,49,44,113,40,45,49,41,41,44,110,40,41,125,125,44,68,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,79,46,97,112,112,101,110,100,76,105,115,116,101,110,101,114,40,116,41,59,114,101,116,117,114,110,32,113,40,49,41,44,102,117,110,99,116,105,111,110,40,41,123,113,40,45,49,41,44,110,40,41,125,125,44,71,61,123,108,101,110,103,116,104,58,110,46,108,101,110,103,116,104,44,97,99,116,105,111,110,58,34,80,79,80,34,44,108,111,99,97,116,105,111,110,58,107,44,99,114,101,97,116,101,72,114,101,102,58,84,44,112,117,115,104,58,72,44,114,101,112,108,97,99,101,58,106,44,103,111,58,67,44,103,111,66,97,99,107,58,85,44,103,111,70,111,114,119,97,114,100,58,82,44,98,108,111,99,107,58,70,44,108,105,115,116,101,110,58,68,125,59,114,101,116,117,114,110,32,71,125,59,110,46,100,101,102,97,117,108,116,61,121,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,118,97,114,32,114,61,79,98,106,101,99,116,46,97,115,115,105,103,110,124,124,102,117,110,99,116,105,111,110,40,116,41,123,102,111,114,40,118,97,114,32,110,61,49,59,110,60,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,59,110,43,43,41,123,118,97,114,32,101,61,97,114,103,117,109,101,110,116,115,91,110,93,59,102,111,114,40,118,97,114,32,111,32,105,110,32,101,41,79,98,106,101,99,116,46,112,114,111,116,111,116,121,112,101,46,104,97,115,79,119,110,80,114,111,112,101,114,116,121,46,99,97,108,108,40,101,44,111,41,38,38,40,116,91,111,93,61,101,91,111,93,41,125,114,101,116,117,114,110,32,116,125,44,105,61,101,40,51,41,44,97,61,40,111,40,105,41,44,101,40,54,41,41,44,99,61,111,40,97,41,44,117,61,101,40,50,41,44,115,61,101,40,49,41,44,102,61,101,40,52,41,44,108,61,111,40,102,41,44,100,61,101,40,53,41,44,104,61,34,104,97,115,104,99,104,97,110,103,101,34,44,118,61,123,104,97,115,104,98,97,110,103,58,123,101,110,99,111,100,101,80,97,116,104,58,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,33,34,61,61,61,116,46,99,104,97,114,65,116,40,48,41,63,116,58,34,33,47,34,43,40,48,44,115,46,115,116,114,105,112,76,101,97,100,105,110,103,83,108,97,115,104,41,40,116,41,125,44,100,101,99,111,100,101,80,97,116,104,58,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,33,34,61,61,61,116,46,99,104,97,114,65,116,40,48,41,63,116,46,115,117,98,115,116,114,40,49,41,58,116,125,125,44,110,111,115,108,97,115,104,58,123,101,110,99,111,100,101,80,97,116,104,58,115,46,115,116,114,105,112,76,101,97,100,105,110,103,83,108,97,115,104,44,100,101,99,111,100,101,80,97,116,104,58,115,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,125,44,115,108,97,115,104,58,123,101,110,99,111,100,101,80,97,116,104,58,115,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,44,100,101,99,111,100,101,80,97,116,104,58,115,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,125,125,44,112,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,114,101,102,44,110,61,116,46,105,110,100,101,120,79,102,40,34,35,34,41,59,114,101,116,117,114,110,32,110,61,61,61,45,49,63,34,34,58,116,46,115,117,98,115,116,114,105,110,103,40,110,43,49,41,125,44,121,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,97,115,104,61,116,125,44,103,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,114,101,102,46,105,110,100,101,120,79,102,40,34,35,34,41,59,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,114,101,112,108,97,99,101,40,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,114,101,102,46,115,108,105,99,101,40,48,44,110,62,61,48,63,110,58,48,41,43,34,35,34,43,116,41,125,44,109,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,63,97,114,103,117,109,101,110,116,115,91,48,93,58,123,125,59,100,46,99,97,110,85,115,101,68,79,77,63,118,111,105,100,32,48,58,40,48,44,99,46,100,101,102,97,117,108,116,41,40,33,49,41,59,118,97,114,32,110,61,119,105,110,100,111,119,46,104,105,115,116,111,114,121,44,101,61,40,40,48,44,100,46,115,117,112,112,111,114,116,115,71,111,87,105,116,104,111,117,116,82,101,108,111,97,100,85,115,105,110,103,72,97,115,104,41,40,41,44,116,46,103,101,116,85,115,101,114,67,111,110,102,105,114,109,97,116,105,111,110,41,44,111,61,118,111,105,100,32,48,61,61,61,101,63,100,46,103,101,116,67,111,110,102,105,114,109,97,116,105,111,110,58,101,44,105,61,116,46,104,97,115,104,84,121,112,101,44,97,61,118,111,105,100,32,48,61,61,61,105,63,34,115,108,97,115,104,34,58,105,44,102,61,116,46,98,97,115,101,110,97,109,101,63,40,48,44,115,46,115,116,114,105,112,84,114,97,105,108,105,110,103,83,108,97,115,104,41,40,40,48,44,115,46,97,100,100,76,101,97,100,105,110,103,83,108,97,115,104,41,40,116,46,98,97,115,101,110,97,109,101,41,41,58,34,34,44,109,61,118,91,97,93,44,119,61,109,46,101,110,99,111,100,101,80,97,116,104,44,80,61,109,46,100,101,99,111,100,101,80,97,116,104,44,98,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,80,40,112,40,41,41,59,114,101,116,117,114,110,32,102,38,38,40,116,61,40,48,44,115,46,115,116,114,105,112,80,114,101,102,105,120,41,40,116,44,102,41,41,44,40,48,44,115,46,112,97,114,115,101,80,97,116,104,41,40,116,41,125,44,79,61,40,48,44,108,46,100,101,102,97,117,108,116,41,40,41,44,120,61,102,117,110,99,116,105,111,110,40,116,41,123,114,40,86,44,116,41,44,86,46,108,101,110,103,116,104,61,110,46,108,101,110,103,116,104,44,79,46,110,111,116,105,102,121,76,105,115,116,101,110,101,114,115,40,86,46,108,111,99,97,116,105,111,110,44,86,46,97,99,116,105,111,110,41,125,44,76,61,33,49,44,83,61,110,117,108,108,44,69,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,112,40,41,44,110,61,119,40,116,41,59,105,102,40,116,33,61,61,110,41,103,40,110,41,59,101,108,115,101,123,118,97,114,32,101,61,98,40,41,44,111,61,86,46,108,111,99,97,116,105,111,110,59,105,102,40,33,76,38,38,40,48,44,117,46,108,111,99,97,116,105,111,110,115,65,114,101,69,113,117,97,108,41,40,111,44,101,41,41,114,101,116,117,114,110,59,105,102,40,83,61,61,61,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,101,41,41,114,101,116,117,114,110,59,83,61,110,117,108,108,44,65,40,101,41,125,125,44,65,61,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,76,41,76,61,33,49,44,120,40,41,59,101,108,115,101,123,118,97,114,32,110,61,34,80,79,80,34,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,116,44,110,44,111,44,102,117,110,99,116,105,111,110,40,101,41,123,101,63,120,40,123,97,99,116,105,111,110,58,110,44,108,111,99,97,116,105,111,110,58,116,125,41,58,95,40,116,41,125,41,125,125,44,95,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,86,46,108,111,99,97,116,105,111,110,44,101,61,72,46,108,97,115,116,73,110,100,101,120,79,102,40,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,110,41,41,59,101,61,61,61,45,49,38,38,40,101,61,48,41,59,118,97,114,32,111,61,72,46,108,97,115,116,73,110,100,101,120,79,102,40,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,116,41,41,59,111,61,61,61,45,49,38,38,40,111,61,48,41,59,118,97,114,32,114,61,101,45,111,59,114,38,38,40,76,61,33,48,44,82,40,114,41,41,125,44,107,61,112,40,41,44,77,61,119,40,107,41,59,107,33,61,61,77,38,38,103,40,77,41,59,118,97,114,32,84,61,98,40,41,44,72,61,91,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,84,41,93,44,106,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,35,34,43,119,40,102,43,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,116,41,41,125,44,67,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,118,97,114,32,101,61,34,80,85,83,72,34,44,114,61,40,48,44,117,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,118,111,105,100,32,48,44,118,111,105,100,32,48,44,86,46,108,111,99,97,116,105,111,110,41,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,114,44,101,44,111,44,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,116,41,123,118,97,114,32,110,61,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,114,41,44,111,61,119,40,102,43,110,41,44,105,61,112,40,41,33,61,61,111,59,105,102,40,105,41,123,83,61,110,44,121,40,111,41,59,118,97,114,32,97,61,72,46,108,97,115,116,73,110,100,101,120,79,102,40,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,86,46,108,111,99,97,116,105,111,110,41,41,44,99,61,72,46,115,108,105,99,101,40,48,44,97,61,61,61,45,49,63,48,58,97,43,49,41,59,99,46,112,117,115,104,40,110,41,44,72,61,99,44,120,40,123,97,99,116,105,111,110,58,101,44,108,111,99,97,116,105,111,110,58,114,125,41,125,101,108,115,101,32,120,40,41,125,125,41,125,44,85,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,118,97,114,32,101,61,34,82,69,80,76,65,67,69,34,44,114,61,40,48,44,117,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,118,111,105,100,32,48,44,118,111,105,100,32,48,44,86,46,108,111,99,97,116,105,111,110,41,59,79,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,114,44,101,44,111,44,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,116,41,123,118,97,114,32,110,61,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,114,41,44,111,61,119,40,102,43,110,41,44,105,61,112,40,41,33,61,61,111,59,105,38,38,40,83,61,110,44,103,40,111,41,41,59,118,97,114,32,97,61,72,46,105,110,100,101,120,79,102,40,40,48,44,115,46,99,114,101,97,116,101,80,97,116,104,41,40,86,46,108,111,99,97,116,105,111,110,41,41,59,97,33,61,61,45,49,38,38,40,72,91,97,93,61,110,41,44,120,40,123,97,99,116,105,111,110,58,101,44,108,111,99,97,116,105,111,110,58,114,125,41,125,125,41,125,44,82,61,102,117,110,99,116,105,111,110,40,116,41,123,110,46,103,111,40,116,41,125,44,73,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,82,40,45,49,41,125,44,113,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,82,40,49,41,125,44,66,61,48,44,70,61,102,117,110,99,116,105,111,110,40,116,41,123,66,43,61,116,44,49,61,61,61,66,63,40,48,44,100,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,104,44,69,41,58,48,61,61,61,66,38,38,40,48,44,100,46,114,101,109,111,118,101,69,118,101,110,116,76,105,115,116,101,110,101,114,41,40,119,105,110,100,111,119,44,104,44,69,41,125,44,68,61,33,49,44,71,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,38,38,97,114,103,117,109,101,110,116,115,91,48,93,44,110,61,79,46,115,101,116,80,114,111,109,112,116,40,116,41,59,114,101,116,117,114,110,32,68,124,124,40,70,40,49,41,44,68,61,33,48,41,44,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,68,38,38,40,68,61,33,49,44,70,40,45,49,41,41,44,110,40,41,125,125,44,87,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,79,46,97,112,112,101,110,100,76,105,115,116,101,110,101,114,40,116,41,59,114,101,116,117,114,110,32,70,40,49,41,44,102,117,110,99,116,105,111,110,40,41,123,70,40,45,49,41,44,110,40,41,125,125,44,86,61,123,108,101,110,103,116,104,58,110,46,108,101,110,103,116,104,44,97,99,116,105,111,110,58,34,80,79,80,34,44,108,111,99,97,116,105,111,110,58,84,44,99,114,101,97,116,101,72,114,101,102,58,106,44,112,117,115,104,58,67,44,114,101,112,108,97,99,101,58,85,44,103,111,58,82,44,103,111,66,97,99,107,58,73,44,103,111,70,111,114,119,97,114,100,58,113,44,98,108,111,99,107,58,71,44,108,105,115,116,101,110,58,87,125,59,114,101,116,117,114,110,32,86,125,59,110,46,100,101,102,97,117,108,116,61,109,125,44,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,102,117,110,99,116,105,111,110,32,111,40,116,41,123,114,101,116,117,114,110,32,116,38,38,116,46,95,95,101,115,77,111,100,117,108,101,63,116,58,123,100,101,102,97,117,108,116,58,116,125,125,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,118,97,114,32,114,61,40,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,34,115,121,109,98,111,108,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,46,105,116,101,114,97,116,111,114,63,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,121,112,101,111,102,32,116,125,58,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,38,38,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,116,46,99,111,110,115,116,114,117,99,116,111,114,61,61,61,83,121,109,98,111,108,38,38,116,33,61,61,83,121,109,98,111,108,46,112,114,111,116,111,116,121,112,101,63,34,115,121,109,98,111,108,34,58,116,121,112,101,111,102,32,116,125,44,79,98,106,101,99,116,46,97,115,115,105,103,110,124,124,102,117,110,99,116,105,111,110,40,116,41,123,102,111,114,40,118,97,114,32,110,61,49,59,110,60,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,59,110,43,43,41,123,118,97,114,32,101,61,97,114,103,117,109,101,110,116,115,91,110,93,59,102,111,114,40,118,97,114,32,111,32,105,110,32,101,41,79,98,106,101,99,116,46,112,114,111,116,111,116,121,112,101,46,104,97,115,79,119,110,80,114,111,112,101,114,116,121,46,99,97,108,108,40,101,44,111,41,38,38,40,116,91,111,93,61,101,91,111,93,41,125,114,101,116,117,114,110,32,116,125,41,44,105,61,101,40,51,41,44,97,61,40,111,40,105,41,44,101,40,49,41,41,44,99,61,101,40,50,41,44,117,61,101,40,52,41,44,115,61,111,40,117,41,44,102,61,102,117,110,99,116,105,111,110,40,116,44,110,44,101,41,123,114,101,116,117,114,110,32,77,97,116,104,46,109,105,110,40,77,97,116,104,46,109,97,120,40,116,44,110,41,44,101,41,125,44,108,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,63,97,114,103,117,109,101,110,116,115,91,48,93,58,123,125,44,110,61,116,46,103,101,116,85,115,101,114,67,111,110,102,105,114,109,97,116,105,111,110,44,101,61,116,46,105,110,105,116,105,97,108,69,110,116,114,105,101,115,44,111,61,118,111,105,100,32,48,61,61,61,101,63,91,34,47,34,93,58,101,44,105,61,116,46,105,110,105,116,105,97,108,73,110,100,101,120,44,117,61,118,111,105,100,32,48,61,61,61,105,63,48,58,105,44,108,61,116,46,107,101,121,76,101,110,103,116,104,44,100,61,118,111,105,100,32,48,61,61,61,108,63,54,58,108,44,104,61,40,48,44,115,46,100,101,102,97,117,108,116,41,40,41,44,118,61,102,117,110,99,116,105,111,110,40,116,41,123,114,40,65,44,116,41,44,65,46,108,101,110,103,116,104,61,65,46,101,110,116,114,105,101,115,46,108,101,110,103,116,104,44,104,46,110,111,116,105,102,121,76,105,115,116,101,110,101,114,115,40,65,46,108,111,99,97,116,105,111,110,44,65,46,97,99,116,105,111,110,41,125,44,112,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,77,97,116,104,46,114,97,110,100,111,109,40,41,46,116,111,83,116,114,105,110,103,40,51,54,41,46,115,117,98,115,116,114,40,50,44,100,41,125,44,121,61,102,40,117,44,48,44,111,46,108,101,110,103,116,104,45,49,41,44,103,61,111,46,109,97,112,40,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,115,116,114,105,110,103,34,61,61,116,121,112,101,111,102,32,116,63,40,48,44,99,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,118,111,105,100,32,48,44,112,40,41,41,58,40,48,44,99,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,118,111,105,100,32,48,44,116,46,107,101,121,124,124,112,40,41,41,125,41,44,109,61,97,46,99,114,101,97,116,101,80,97,116,104,44,119,61,102,117,110,99,116,105,111,110,40,116,44,101,41,123,118,97,114,32,111,61,34,80,85,83,72,34,44,114,61,40,48,44,99,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,101,44,112,40,41,44,65,46,108,111,99,97,116,105,111,110,41,59,104,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,114,44,111,44,110,44,102,117,110,99,116,105,111,110,40,116,41,123,105,102,40,116,41,123,118,97,114,32,110,61,65,46,105,110,100,101,120,44,101,61,110,43,49,44,105,61,65,46,101,110,116,114,105,101,115,46,115,108,105,99,101,40,48,41,59,105,46,108,101,110,103,116,104,62,101,63,105,46,115,112,108,105,99,101,40,101,44,105,46,108,101,110,103,116,104,45,101,44,114,41,58,105,46,112,117,115,104,40,114,41,44,118,40,123,97,99,116,105,111,110,58,111,44,108,111,99,97,116,105,111,110,58,114,44,105,110,100,101,120,58,101,44,101,110,116,114,105,101,115,58,105,125,41,125,125,41,125,44,80,61,102,117,110,99,116,105,111,110,40,116,44,101,41,123,118,97,114,32,111,61,34,82,69,80,76,65,67,69,34,44,114,61,40,48,44,99,46,99,114,101,97,116,101,76,111,99,97,116,105,111,110,41,40,116,44,101,44,112,40,41,44,65,46,108,111,99,97,116,105,111,110,41,59,104,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,114,44,111,44,110,44,102,117,110,99,116,105,111,110,40,116,41,123,116,38,38,40,65,46,101,110,116,114,105,101,115,91,65,46,105,110,100,101,120,93,61,114,44,118,40,123,97,99,116,105,111,110,58,111,44,108,111,99,97,116,105,111,110,58,114,125,41,41,125,41,125,44,98,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,101,61,102,40,65,46,105,110,100,101,120,43,116,44,48,44,65,46,101,110,116,114,105,101,115,46,108,101,110,103,116,104,45,49,41,44,111,61,34,80,79,80,34,44,114,61,65,46,101,110,116,114,105,101,115,91,101,93,59,104,46,99,111,110,102,105,114,109,84,114,97,110,115,105,116,105,111,110,84,111,40,114,44,111,44,110,44,102,117,110,99,116,105,111,110,40,116,41,123,116,63,118,40,123,97,99,116,105,111,110,58,111,44,108,111,99,97,116,105,111,110,58,114,44,105,110,100,101,120,58,101,125,41,58,118,40,41,125,41,125,44,79,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,98,40,45,49,41,125,44,120,61,102,117,110,99,116,105,111,110,40,41,123,114,101,116,117,114,110,32,98,40,49,41,125,44,76,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,65,46,105,110,100,101,120,43,116,59,114,101,116,117,114,110,32,110,62,61,48,38,38,110,60,65,46,101,110,116,114,105,101,115,46,108,101,110,103,116,104,125,44,83,61,102,117,110,99,116,105,111,110,40,41,123,118,97,114,32,116,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,62,48,38,38,118,111,105,100,32,48,33,61,61,97,114,103,117,109,101,110,116,115,91,48,93,38,38,97,114,103,117,109,101,110,116,115,91,48,93,59,114,101,116,117,114,110,32,104,46,115,101,116,80,114,111,109,112,116,40,116,41,125,44,69,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,104,46,97,112,112,101,110,100,76,105,115,116,101,110,101,114,40,116,41,125,44,65,61,123,108,101,110,103,116,104,58,103,46,108,101,110,103,116,104,44,97,99,116,105,111,110,58,34,80,79,80,34,44,108,111,99,97,116,105,111,110,58,103,91,121,93,44,105,110,100,101,120,58,121,44,101,110,116,114,105,101,115,58,103,44,99,114,101,97,116,101,72,114,101,102,58,109,44,112,117,115,104,58,119,44,114,101,112,108,97,99,101,58,80,44,103,111,58,98,44,103,111,66,97,99,107,58,79,44,103,111,70,111,114,119,97,114,100,58,120,44,99,97,110,71,111,58,76,44,98,108,111,99,107,58,83,44,108,105,115,116,101,110,58,69,125,59,114,101,116,117,114,110,32,65,125,59,110,46,100,101,102,97,117,108,116,61,108,125,44,102,117,110,99,116,105,111,110,40,116,44,110,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,118,97,114,32,101,61,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,34,47,34,61,61,61,116,46,99,104,97,114,65,116,40,48,41,125,44,111,61,102,117,110,99,116,105,111,110,40,116,44,110,41,123,102,111,114,40,118,97,114,32,101,61,110,44,111,61,101,43,49,44,114,61,116,46,108,101,110,103,116,104,59,111,60,114,59,101,43,61,49,44,111,43,61,49,41,116,91,101,93,61,116,91,111,93,59,116,46,112,111,112,40,41,125,44,114,61,102,117,110,99,116,105,111,110,40,116,41,123,118,97,114,32,110,61,97,114,103,117,109,101,110,116,115,46,108,101,110,103,116,104,60,61,49,124,124,118,111,105,100,32,48,61,61,61,97,114,103,117,109,101,110,116,115,91,49,93,63,34,34,58,97,114,103,117,109,101,110,116,115,91,49,93,44,114,61,116,38,38,116,46,115,112,108,105,116,40,34,47,34,41,124,124,91,93,44,105,61,110,38,38,110,46,115,112,108,105,116,40,34,47,34,41,124,124,91,93,44,97,61,116,38,38,101,40,116,41,44,99,61,110,38,38,101,40,110,41,44,117,61,97,124,124,99,59,105,102,40,116,38,38,101,40,116,41,63,105,61,114,58,114,46,108,101,110,103,116,104,38,38,40,105,46,112,111,112,40,41,44,105,61,105,46,99,111,110,99,97,116,40,114,41,41,44,33,105,46,108,101,110,103,116,104,41,114,101,116,117,114,110,34,47,34,59,118,97,114,32,115,61,118,111,105,100,32,48,59,105,102,40,105,46,108,101,110,103,116,104,41,123,118,97,114,32,102,61,105,91,105,46,108,101,110,103,116,104,45,49,93,59,115,61,34,46,34,61,61,61,102,124,124,34,46,46,34,61,61,61,102,124,124,34,34,61,61,61,102,125,101,108,115,101,32,115,61,33,49,59,102,111,114,40,118,97,114,32,108,61,48,44,100,61,105,46,108,101,110,103,116,104,59,100,62,61,48,59,100,45,45,41,123,118,97,114,32,104,61,105,91,100,93,59,34,46,34,61,61,61,104,63,111,40,105,44,100,41,58,34,46,46,34,61,61,61,104,63,40,111,40,105,44,100,41,44,108,43,43,41,58,108,38,38,40,111,40,105,44,100,41,44,108,45,45,41,125,105,102,40,33,117,41,102,111,114,40,59,108,45,45,59,108,41,105,46,117,110,115,104,105,102,116,40,34,46,46,34,41,59,33,117,124,124,34,34,61,61,61,105,91,48,93,124,124,105,91,48,93,38,38,101,40,105,91,48,93,41,124,124,105,46,117,110,115,104,105,102,116,40,34,34,41,59,118,97,114,32,118,61,105,46,106,111,105,110,40,34,47,34,41,59,114,101,116,117,114,110,32,115,38,38,34,47,34,33,61,61,118,46,115,117,98,115,116,114,40,45,49,41,38,38,40,118,43,61,34,47,34,41,44,118,125,59,116,46,101,120,112,111,114,116,115,61,114,125,44,102,117,110,99,116,105,111,110,40,116,44,110,41,123,34,117,115,101,32,115,116,114,105,99,116,34,59,110,46,95,95,101,115,77,111,100,117,108,101,61,33,48,59,118,97,114,32,101,61,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,34,115,121,109,98,111,108,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,46,105,116,101,114,97,116,111,114,63,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,121,112,101,111,102,32,116,125,58,102,117,110,99,116,105,111,110,40,116,41,123,114,101,116,117,114,110,32,116,38,38,34,102,117,110,99,116,105,111,110,34,61,61,116,121,112,101,111,102,32,83,121,109,98,111,108,38,38,116,46,99,111,110,115,116,114,117,99,116,111,114,61,61,61,83,121,109,98,111,108,38,38,116,33,61,61,83,121,109,98,111,108,46,112,114,111,116,111,116,121,112,101,63,34,115,121,109,98,111,108,34,58,116,121,112,101,111,102,32,116,125,44,111,61,102,117,110,99,116,105,111,110,32,116,40,110,44,111,41,123,105,102,40,110,61,61,61,111,41,114,101,116,117,114,110,33,48,59,105,102,40,110,117,108,108,61,61,110,124,124,110,117,108,108,61,61,111,41,114,101,116,117,114,110,33,49,59,105,102,40,65,114,114,97,121,46,105,115,65,114,114,97,121,40,110,41,41,114,101,116,117,114,110,33,40,33,65,114,114,97,121,46,105,115,65,114,114,97,121,40,111,41,124,124,110,46,108,101,110,103,116,104,33,61,61,111,46,108,101,110,103,116,104,41,38,38,110,46,101,118,101,114,121,40,102,117,110,99,116,105,111,110,40,110,44,101,41,123,114,101,116,117,114,110,32,116,40,110,44,111,91,101,93,41,125,41,59,118,97,114,32,114,61,34,117,110,100,101,102,105,110,101,100,34,61,61,116,121,112,101,111,102,32,110,63,34,117,110,100,101,102,105,110,101,100,34,58,101,40,110,41,44,105,61,34,117,110,100,101,102,105,110,101,100,34,61,61,116,121,112,101,111,102,32,111,63,34,117,110,100,101,102,105,110,101,100,34,58,101,40,111,41,59,105,102,40,114,33,61,61,105,41,114,101,116,117,114,110,33,49,59,105,102,40,34,111,98,106,101,99,116,34,61,61,61,114,41,123,118,97,114,32,97,61,110,46,118,97,108,117,101,79,102,40,41,44,99,61,111,46,118,97,108,117,101,79,102,40,41,59,105,102,40,97,33,61,61,110,124,124,99,33,61,61,111,41,114,101,116,117,114,110,32,116,40,97,44,99,41,59,118,97,114,32,117,61,79,98,106,101,99,116,46,107,101,121,115,40,110,41,44,115,61,79,98,106,101,99,116,46,107,101,121,115,40,111,41,59,114,101,116,117,114,110,32,117,46,108,101,110,103,116,104,61,61,61,115,46,108,101,110,103,116,104,38,38,117,46,101,118,101,114,121,40,102,117,110,99,116,105,111,110,40,101,41,123,114,101,116,117,114,110,32,116,40,110,91,101,93,44,111,91,101,93,41,125,41,125,114,101,116,117,114,110,33,49,125,59,110,46,100,101,102,97,117,108,116,61,111,125,93,41,125,41,59,0};
+
+static const unsigned char v9[] = {27,33,4,32,44,6,220,221,19,222,93,47,226,233,129,132,170,249,9,159,13,132,22,82,112,78,101,115,130,102,12,70,220,119,68,7,106,16,31,133,162,253,194,67,54,215,233,22,43,128,254,39,184,110,176,117,97,3,206,48,26,2,217,96,144,141,255,185,229,165,1,33,198,251,135,168,85,151,47,137,71,162,209,40,121,109,33,131,235,140,230,207,13,205,81,152,153,193,222,137,255,242,251,249,71,68,69,169,174,21,175,28,218,24,207,23,233,131,210,211,179,200,11,100,88,14,186,214,1,19,248,87,238,79,156,131,226,82,163,6,128,121,42,65,92,75,79,115,244,55,46,193,116,23,73,232,83,182,170,20,233,206,251,215,94,112,131,95,175,17,223,154,70,38,166,175,29,182,112,179,188,163,196,200,254,13,112,162,62,129,59,114,248,7,43,128,219,204,129,219,110,249,127,4,0,200,220,157,63,248,231,117,31,61,30,68,144,251,212,124,68,120,197,79,61,85,73,64,8,136,32,180,165,82,62,38,226,51,47,73,20,160,38,56,122,125,17,79,147,99,57,160,67,184,186,148,193,49,93,28,122,12,128,106,113,89,166,32,173,101,195,216,14,134,160,62,160,105,46,194,182,126,130,125,75,86,40,153,182,141,252,8,103,229,250,127,33,90,211,81,132,174,151,26,219,48,88,38,204,109,131,132,107,193,152,207,130,251,108,177,53,19,144,50,169,147,121,136,138,252,212,32,87,217,240,210,230,196,129,170,133,147,113,64,81,53,196,76,145,20,7,175,247,252,230,92,43,175,159,207,3,6,25,84,21,129,238,132,145,156,41,76,132,171,235,30,207,64,155,186,43,183,24,109,148,213,194,143,236,167,130,90,41,223,239,34,1,73,114,211,140,73,66,210,249,128,248,54,27,87,211,93,181,170,92,22,146,146,197,64,169,197,25,139,3,25,175,177,141,210,169,25,167,66,4,55,63,15,28,61,22,231,61,14,75,187,242,156,70,106,37,33,166,40,0,0};
+
+static const unsigned char v10[] = {31,139,8,0,0,0,0,0,2,3,93,84,77,115,219,32,16,189,231,87,108,184,232,208,128,64,223,206,8,207,164,105,14,61,116,218,67,219,105,143,4,97,139,4,129,11,216,74,254,125,71,146,29,59,185,176,210,238,123,188,149,222,66,123,253,229,251,253,207,191,63,30,160,143,131,89,95,181,83,0,35,236,150,35,101,17,72,35,66,224,168,199,155,189,49,240,184,197,99,175,163,66,235,43,128,182,87,162,155,30,0,218,168,163,81,235,54,93,226,146,27,84,20,32,123,225,131,138,28,237,227,6,55,8,210,203,98,31,227,14,171,127,123,125,224,232,15,254,117,135,239,221,176,19,81,63,26,133,64,58,27,149,141,28,125,125,224,170,219,170,15,92,43,6,197,209,65,171,113,231,124,188,128,143,186,139,61,239,212,65,75,133,231,151,27,208,86,71,45,12,14,82,24,197,25,161,231,205,140,182,207,224,149,225,72,75,103,17,196,215,157,226,72,15,98,171,210,112,216,126,122,25,12,130,222,171,13,71,157,136,226,246,93,229,166,13,135,45,188,12,198,6,158,76,95,115,155,166,227,56,146,49,39,206,111,211,140,82,58,65,19,216,104,99,120,98,157,85,9,76,61,127,118,47,60,161,64,33,43,32,43,18,8,209,187,231,99,187,60,97,164,60,165,120,34,247,222,43,27,239,157,113,62,89,67,187,19,177,63,225,141,182,74,138,29,79,188,219,219,46,185,76,63,57,109,223,242,29,79,190,177,130,52,101,13,172,38,180,201,68,150,147,166,104,224,24,40,80,90,146,162,44,48,35,57,187,107,200,170,170,97,89,41,80,198,26,88,145,186,60,96,82,255,94,221,85,80,205,132,10,86,7,82,151,226,35,26,103,36,103,25,84,132,102,153,100,164,206,115,82,21,144,147,178,2,70,104,83,194,164,84,194,164,52,148,164,102,5,80,145,21,36,43,75,56,134,121,151,99,233,13,146,67,14,20,216,91,33,129,116,13,237,244,123,215,103,55,175,49,158,13,93,12,155,28,9,183,105,234,195,16,200,160,82,109,163,242,203,74,100,8,104,241,61,196,87,163,66,175,84,68,144,98,60,143,118,122,154,237,246,209,117,175,239,79,1,90,183,233,148,157,203,215,24,7,233,245,46,66,240,242,172,40,59,75,162,208,102,212,182,147,33,16,233,134,137,182,64,143,26,231,201,187,236,96,233,252,196,37,155,134,101,13,237,186,185,223,153,246,78,78,135,232,252,43,25,180,37,98,181,218,84,185,172,201,83,56,75,93,50,150,201,30,92,183,159,142,215,204,31,132,182,68,86,221,170,222,8,246,129,216,166,203,141,240,31,150,159,183,206,34,4,0,0,0};
+
+static const unsigned char v11[] = {60,33,68,79,67,84,89,80,69,32,104,116,109,108,62,10,60,104,116,109,108,32,108,97,110,103,61,34,101,110,34,32,99,108,97,115,115,61,34,104,45,102,117,108,108,32,98,103,45,119,104,105,116,101,34,62,10,32,32,60,104,101,97,100,62,10,32,32,32,32,60,116,105,116,108,101,62,60,47,116,105,116,108,101,62,10,32,32,32,32,60,109,101,116,97,32,99,104,97,114,115,101,116,61,34,117,116,102,45,56,34,32,47,62,10,32,32,32,32,60,109,101,116,97,32,104,116,116,112,45,101,113,117,105,118,61,34,88,45,85,65,45,67,111,109,112,97,116,105,98,108,101,34,32,99,111,110,116,101,110,116,61,34,73,69,61,101,100,103,101,34,32,47,62,10,32,32,32,32,60,109,101,116,97,32,110,97,109,101,61,34,118,105,101,119,112,111,114,116,34,32,99,111,110,116,101,110,116,61,34,119,105,100,116,104,61,100,101,118,105,99,101,45,119,105,100,116,104,44,32,105,110,105,116,105,97,108,45,115,99,97,108,101,61,49,46,48,34,32,47,62,10,32,32,32,32,60,108,105,110,107,32,114,101,108,61,34,105,99,111,110,34,32,116,121,112,101,61,34,105,109,97,103,101,47,115,118,103,43,120,109,108,34,32,104,114,101,102,61,34,100,97,116,97,58,105,109,97,103,101,47,115,118,103,43,120,109,108,44,60,115,118,103,32,120,109,108,110,115,61,39,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,39,32,102,105,108,108,61,39,110,111,110,101,39,32,118,105,101,119,66,111,120,61,39,48,32,48,32,50,52,32,50,52,39,32,115,116,114,111,107,101,45,119,105,100,116,104,61,39,49,46,53,39,32,115,116,114,111,107,101,61,39,99,117,114,114,101,110,116,67,111,108,111,114,39,62,32,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,39,114,111,117,110,100,39,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,39,114,111,117,110,100,39,32,100,61,39,77,49,52,46,56,53,55,32,49,55,46,48,56,50,97,50,51,46,56,52,56,32,50,51,46,56,52,56,32,48,32,48,48,53,46,52,53,52,45,49,46,51,49,65,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,49,56,32,57,46,55,53,118,45,46,55,86,57,65,54,32,54,32,48,32,48,48,54,32,57,118,46,55,53,97,56,46,57,54,55,32,56,46,57,54,55,32,48,32,48,49,45,50,46,51,49,50,32,54,46,48,50,50,99,49,46,55,51,51,46,54,52,32,51,46,53,54,32,49,46,48,56,53,32,53,46,52,53,53,32,49,46,51,49,109,53,46,55,49,52,32,48,97,50,52,46,50,53,53,32,50,52,46,50,53,53,32,48,32,48,49,45,53,46,55,49,52,32,48,109,53,46,55,49,52,32,48,97,51,32,51,32,48,32,49,49,45,53,46,55,49,52,32,48,39,32,47,62,32,60,47,115,118,103,62,34,32,47,62,10,32,32,32,32,60,33,45,45,108,105,110,107,32,104,114,101,102,61,34,104,116,116,112,115,58,47,47,114,115,109,115,46,109,101,47,105,110,116,101,114,47,105,110,116,101,114,46,99,115,115,34,32,114,101,108,61,34,115,116,121,108,101,115,104,101,101,116,34,32,47,45,45,62,10,32,32,60,47,104,101,97,100,62,10,32,32,60,98,111,100,121,32,99,108,97,115,115,61,34,104,45,102,117,108,108,34,62,60,47,98,111,100,121,62,10,32,32,60,33,45,45,115,99,114,105,112,116,32,115,114,99,61,34,104,116,116,112,115,58,47,47,99,100,110,46,116,97,105,108,119,105,110,100,99,115,115,46,99,111,109,34,62,60,47,115,99,114,105,112,116,45,45,62,10,32,32,60,108,105,110,107,32,114,101,108,61,34,115,116,121,108,101,115,104,101,101,116,34,32,104,114,101,102,61,34,116,97,105,108,119,105,110,100,46,102,56,49,50,56,48,100,100,46,99,115,115,34,62,10,32,32,60,115,99,114,105,112,116,32,115,114,99,61,34,104,105,115,116,111,114,121,46,109,105,110,46,97,57,57,102,54,51,99,55,46,106,115,34,62,60,47,115,99,114,105,112,116,62,10,32,32,60,115,99,114,105,112,116,32,116,121,112,101,61,34,109,111,100,117,108,101,34,32,115,114,99,61,34,109,97,105,110,46,99,54,100,57,55,102,97,49,46,106,115,34,62,60,47,115,99,114,105,112,116,62,10,60,47,104,116,109,108,62,10,0};
+
+static const unsigned char v12[] = {27,129,88,0,44,6,236,134,238,34,140,147,231,66,92,4,88,94,12,70,41,11,10,234,24,35,36,153,133,255,230,68,127,70,61,202,160,252,113,109,166,155,53,166,106,66,151,131,168,218,9,245,3,246,127,155,102,247,92,78,127,60,147,72,120,248,8,236,84,178,178,83,74,119,154,48,50,232,89,32,189,98,27,150,213,253,178,246,186,95,41,187,64,170,215,153,190,82,178,250,212,198,147,34,250,132,22,218,126,223,211,84,131,120,178,55,217,56,166,247,138,38,136,216,87,112,255,255,77,83,85,130,14,33,84,62,46,93,116,41,86,206,117,200,77,195,185,247,253,247,14,103,6,59,18,176,32,76,128,25,84,90,82,105,233,188,226,57,255,253,63,192,2,203,152,86,142,113,165,202,57,116,178,203,84,181,169,110,214,157,190,100,221,228,105,122,132,176,12,53,91,201,110,122,253,24,99,134,0,1,66,146,199,253,168,117,112,0,82,143,206,225,254,187,65,243,10,8,145,27,14,179,37,17,86,177,117,91,135,116,213,231,8,107,255,246,0,162,31,225,243,135,193,80,172,7,47,193,7,167,182,129,244,104,163,29,153,160,77,15,93,68,209,68,150,36,78,137,70,36,126,31,254,32,31,233,118,103,144,57,107,228,32,54,102,30,13,172,217,95,117,232,107,45,179,170,186,85,148,84,46,202,114,236,3,24,169,250,62,221,136,139,240,75,26,149,149,61,194,203,99,41,4,101,127,17,166,124,127,157,172,211,163,165,32,122,255,100,90,116,45,129,173,75,93,2,255,20,243,116,8,27,78,17,252,31,156,221,100,14,234,85,127,202,8,213,227,194,200,0,31,135,155,120,224,35,138,223,244,119,235,143,141,130,253,254,98,154,93,101,38,243,113,119,253,7,124,86,69,162,68,244,79,203,124,14,84,183,171,27,45,103,163,58,127,225,129,233,249,44,135,6,84,66,126,55,31,119,26,225,118,185,243,43,92,245,151,246,159,198,171,246,136,175,71,105,93,150,228,223,229,131,51,123,89,158,231,228,244,113,152,168,32,221,174,237,52,197,12,193,26,189,92,74,88,19,75,83,205,188,40,155,81,55,114,178,13,254,176,56,73,97,227,163,3,9,123,23,133,189,238,40,80,165,133,218,92,67,92,180,255,213,124,246,186,80,113,106,156,4,109,69,162,91,117,98,139,121,179,139,103,199,21,244,27,41,82,250,112,134,76,130,249,226,236,95,97,97,149,201,171,226,42,132,37,14,169,132,32,135,30,81,1,94,174,103,234,182,11,159,191,82,33,90,37,165,69,177,185,186,43,67,88,244,144,132,100,175,95,209,7,241,190,101,97,121,58,169,147,120,165,193,74,236,171,136,171,157,216,196,153,183,69,75,79,105,254,188,184,186,24,194,253,89,240,198,27,241,201,217,12,6,242,208,153,90,84,144,47,4,181,240,136,91,85,159,50,75,34,184,170,87,49,181,1,8,176,121,92,214,96,255,216,193,8,99,239,220,204,8,168,155,222,31,105,208,39,104,5,192,23,105,14,248,227,34,209,189,147,246,65,192,165,99,190,67,243,18,195,79,161,61,163,81,248,50,69,226,89,228,94,234,140,51,91,61,102,133,10,206,32,132,89,247,193,9,2,36,197,120,18,68,114,170,56,224,63,213,89,124,78,138,192,39,169,79,51,216,224,23,146,70,19,91,230,138,213,47,105,85,36,123,60,149,166,192,241,99,86,100,28,201,85,58,183,231,37,31,250,252,87,51,38,4,242,50,107,254,139,98,251,69,171,121,55,106,26,169,116,122,116,194,239,245,1,247,173,114,41,120,25,152,50,195,111,162,117,206,27,220,19,197,116,101,180,132,56,196,215,140,227,170,193,214,92,233,235,217,71,49,66,48,22,53,70,60,93,47,71,12,39,108,10,38,86,252,250,67,193,142,72,44,190,252,192,134,124,109,101,53,122,157,244,64,241,90,60,107,13,245,193,137,175,59,13,9,93,211,169,26,229,152,29,144,240,13,158,140,52,146,55,186,41,191,28,204,174,177,10,229,178,133,248,26,75,12,98,137,180,195,139,73,30,145,101,2,42,21,53,255,226,179,215,196,60,13,61,172,106,234,9,10,233,60,175,253,139,169,62,192,214,145,52,203,37,62,169,69,55,2,11,67,205,38,124,52,24,96,188,249,123,16,120,10,139,61,10,42,169,119,88,5,39,195,182,5,221,148,243,26,231,159,115,67,187,19,177,99,131,145,225,93,246,234,161,163,222,102,125,74,16,33,37,238,23,236,0,6,178,93,36,171,132,47,225,226,43,111,53,49,12,201,171,52,60,224,37,155,13,152,168,219,32,76,78,152,15,243,122,13,182,128,160,252,246,20,232,21,170,243,10,121,169,40,151,98,59,169,122,149,197,203,25,131,195,18,79,23,201,247,243,49,189,213,212,220,83,167,117,130,151,130,81,144,22,124,215,204,113,100,58,56,93,102,66,97,145,186,119,244,70,180,157,163,9,135,78,202,16,160,108,1,154,40,138,193,97,84,157,28,178,180,120,158,227,144,236,93,76,19,77,108,57,137,217,8,248,233,196,39,193,26,164,106,82,97,217,50,77,208,202,155,160,35,217,45,86,8,37,100,158,64,179,227,43,236,114,150,183,47,230,6,243,37,235,64,237,236,36,89,162,107,36,183,79,192,164,6,139,68,86,8,34,164,55,64,135,77,23,24,201,78,181,148,93,153,216,161,172,48,116,78,37,254,26,208,235,23,136,186,17,240,114,150,239,105,48,143,174,241,102,20,16,209,24,120,108,221,198,147,37,238,106,86,36,137,90,216,181,122,136,127,22,182,217,196,31,211,99,32,239,14,123,201,130,246,208,162,45,66,105,208,11,26,124,202,77,222,119,66,175,64,148,1,25,46,150,46,201,12,203,243,202,167,52,194,1,59,247,210,100,254,214,74,56,28,150,21,92,74,36,234,163,186,60,233,158,155,184,160,129,18,212,153,199,59,119,95,141,134,142,145,224,205,80,254,211,246,255,247,45,130,168,90,167,250,61,106,36,34,57,1,185,64,114,73,191,215,239,45,171,122,100,137,114,26,99,73,232,12,238,183,21,111,20,187,163,211,163,76,139,133,115,62,20,65,67,9,147,71,162,106,123,32,169,59,122,39,131,200,150,123,162,108,21,86,68,246,157,119,81,69,28,82,167,3,91,211,156,180,23,52,27,119,143,124,85,255,106,23,240,83,247,59,79,106,167,206,48,152,205,55,36,78,142,156,132,147,251,92,159,250,210,190,155,185,47,93,179,217,92,217,39,78,194,129,253,107,187,118,165,53,255,53,61,138,21,15,118,170,71,172,245,198,77,54,89,196,210,129,95,240,46,221,55,209,205,47,117,251,232,128,242,130,110,173,191,236,42,208,62,251,78,118,191,129,172,129,148,25,192,242,169,117,43,218,243,20,95,87,177,167,12,36,67,19,254,145,174,240,168,4,66,214,40,170,216,187,53,28,53,44,233,234,175,168,221,72,167,96,244,74,120,183,47,42,151,239,89,71,242,166,116,53,64,233,142,171,206,48,145,227,177,5,139,232,94,234,146,80,91,151,181,75,67,94,167,81,221,240,151,21,70,71,130,172,80,168,104,0,185,215,213,236,160,7,181,192,157,172,12,7,22,178,36,174,245,136,188,11,161,221,124,178,113,221,59,245,166,190,202,152,235,81,221,17,151,23,28,102,77,132,139,124,106,251,168,253,208,30,0,85,148,109,45,248,169,70,230,16,108,90,234,67,80,77,199,24,210,197,68,157,81,137,70,232,99,11,113,13,196,34,31,80,144,19,169,209,90,161,249,106,204,33,175,78,4,195,34,200,48,37,18,173,205,68,54,105,92,59,211,82,163,29,254,178,208,230,107,139,232,155,175,99,66,12,67,75,218,73,141,228,158,54,145,235,16,177,168,121,185,51,119,104,130,159,8,112,20,36,204,195,227,77,234,201,59,167,76,235,132,26,48,154,152,170,193,10,221,43,86,111,67,232,57,32,253,9,213,6,83,171,180,57,145,186,23,61,247,87,95,74,232,123,184,26,157,163,202,72,28,145,145,144,153,220,157,212,35,231,160,175,241,247,109,47,38,66,73,29,189,0,189,66,38,170,24,202,226,23,35,184,12,187,204,59,95,177,236,48,150,11,178,169,133,181,149,17,159,13,63,213,14,245,55,132,74,133,24,42,229,11,211,247,6,37,221,242,182,234,58,169,91,102,43,233,132,159,105,119,52,212,0,110,47,114,67,95,162,204,38,190,114,108,171,185,92,41,15,127,99,179,62,12,241,193,184,154,211,80,143,78,107,175,141,40,221,146,44,72,104,211,129,34,189,199,106,231,78,105,210,105,129,140,225,214,83,139,134,20,170,125,161,56,238,220,58,145,110,136,240,162,77,64,43,91,233,6,133,255,202,244,191,230,160,45,218,113,200,196,93,163,39,167,139,35,154,233,162,64,143,214,235,154,239,45,29,215,57,148,145,113,136,146,238,219,189,221,94,104,173,111,155,36,92,35,122,92,55,106,56,1,46,5,213,12,72,93,113,107,249,164,254,11,211,85,100,143,166,4,229,62,46,108,38,141,223,201,114,225,107,72,212,123,137,112,121,198,235,99,208,169,30,59,180,100,121,175,145,162,155,20,124,106,134,97,133,251,110,235,107,123,119,4,153,52,101,5,157,167,230,154,203,214,33,87,34,175,154,133,161,179,121,252,46,3,33,87,254,200,215,156,187,73,230,107,218,38,1,199,41,79,145,89,66,1,105,255,9,10,245,107,31,147,168,189,93,25,180,208,105,31,240,176,99,42,81,179,185,166,213,250,214,153,112,14,214,48,40,203,42,239,184,61,17,150,74,180,81,81,165,127,192,35,67,217,139,216,81,35,157,183,109,204,240,160,133,150,19,17,210,255,28,238,129,51,67,135,55,6,108,134,113,243,247,204,187,148,19,112,22,60,87,227,248,60,230,190,162,246,192,41,34,235,47,150,153,162,24,97,248,178,181,83,113,121,93,155,168,112,37,226,92,142,213,40,28,121,234,13,28,255,29,206,131,242,96,78,43,85,229,62,23,15,35,157,153,159,195,99,39,134,0,206,71,99,224,219,82,1,238,247,208,22,16,149,79,96,222,253,208,57,168,130,75,20,205,179,170,170,245,253,34,43,115,88,96,33,63,97,30,172,131,7,162,60,69,203,189,217,17,239,174,109,169,117,155,99,21,192,252,212,57,8,253,132,24,145,97,61,64,201,106,28,157,164,122,2,124,85,90,91,19,19,250,39,69,93,75,21,104,44,182,22,254,251,134,98,154,75,56,8,159,16,186,48,140,4,106,194,152,214,126,78,75,12,251,152,26,207,28,50,229,136,14,6,92,166,198,180,149,52,26,232,100,44,128,13,253,110,155,88,132,91,156,164,20,37,197,38,50,102,160,157,111,169,206,239,196,254,70,78,120,187,16,202,224,192,103,47,190,250,121,119,249,243,49,187,166,141,75,143,159,9,181,155,230,217,81,10,221,156,170,167,173,92,99,216,248,129,67,193,137,161,176,207,30,3,85,137,25,22,249,191,161,253,101,58,239,34,227,98,166,27,62,232,240,37,19,230,48,207,90,135,75,35,182,39,55,225,219,131,109,118,125,97,28,78,73,74,171,194,123,61,93,96,91,80,255,86,78,55,127,13,191,4,131,28,33,172,24,0,134,198,155,154,197,241,97,230,27,117,137,105,98,216,77,230,180,1,82,247,176,120,75,195,75,156,220,6,137,249,227,251,2,71,213,72,17,200,231,108,134,95,239,130,236,60,221,155,24,0,12,160,5,8,118,223,98,123,135,27,56,99,196,104,76,174,163,232,123,232,57,72,120,223,31,58,200,231,35,25,230,252,57,62,140,250,244,157,63,83,206,128,195,146,202,102,222,82,42,50,52,21,61,154,133,162,107,137,25,139,44,72,121,250,165,146,37,166,35,146,102,104,188,24,67,181,19,169,181,68,22,20,233,234,225,105,221,250,144,34,155,67,178,137,22,209,177,148,253,185,151,184,241,169,60,153,54,69,81,51,200,148,112,78,18,42,89,181,193,125,32,174,125,132,36,135,134,112,57,91,103,173,39,31,175,157,252,99,81,84,143,72,175,234,152,67,153,70,116,205,0,222,58,169,160,255,33,217,67,223,91,171,230,114,131,71,234,121,225,224,180,187,147,103,128,223,176,148,88,0,44,0,238,52,118,77,117,185,254,67,83,93,214,78,78,214,37,228,6,64,229,20,232,154,133,46,252,56,241,124,45,235,205,190,146,183,112,165,137,1,74,8,88,235,164,15,172,26,61,219,204,225,108,15,222,153,75,172,180,223,174,238,143,181,172,157,108,247,44,154,140,198,96,244,133,247,207,26,31,42,216,171,86,56,127,20,214,40,0,3,66,101,236,154,170,3,38,176,17,51,78,10,140,196,16,83,15,7,81,92,1,136,61,132,90,53,129,69,58,227,57,195,128,98,73,125,110,250,71,38,44,40,184,26,74,53,96,34,106,196,92,140,52,46,105,66,133,254,169,211,124,9,59,45,8,40,156,11,81,206,234,44,137,151,18,244,114,233,132,84,239,217,23,80,207,158,170,43,105,140,100,168,217,33,136,202,55,32,81,142,61,114,136,197,140,4,83,117,68,123,29,200,60,214,222,141,15,151,20,113,7,198,0,24,208,120,67,10,239,142,252,127,245,140,149,253,116,7,187,6,141,22,158,19,230,174,49,251,216,247,46,42,169,126,184,126,251,40,165,168,214,110,12,64,120,65,238,196,95,3,81,144,107,160,141,218,207,167,127,120,186,134,221,227,141,237,190,65,101,210,151,117,231,169,220,133,79,202,101,55,142,197,9,167,72,27,140,216,235,2,128,217,59,212,22,141,121,108,156,17,77,244,138,25,198,121,71,36,40,104,100,66,173,147,70,43,116,202,148,186,72,209,49,121,216,234,168,250,20,121,117,73,225,147,237,86,71,239,108,15,159,229,241,83,196,240,101,22,49,142,112,193,60,240,131,188,1,205,109,177,153,142,75,251,128,74,18,204,230,197,37,214,253,69,185,157,217,93,89,216,102,243,192,2,235,254,0,103,86,238,228,251,237,219,49,255,134,125,167,135,132,114,116,7,66,113,79,86,118,233,231,180,129,3,85,11,125,238,77,247,200,112,118,103,108,104,36,172,187,0,251,134,82,55,162,8,202,225,97,215,10,149,25,212,88,198,158,251,218,164,125,47,233,151,95,65,246,245,140,30,63,99,188,246,102,240,166,4,19,93,255,98,234,5,63,45,178,196,209,152,176,140,29,139,48,139,214,211,157,167,251,94,3,50,244,137,214,27,82,150,207,5,98,228,230,227,30,69,30,39,122,248,248,101,123,75,86,109,63,223,0,190,3,59,61,194,82,221,18,104,235,238,8,192,54,198,13,246,86,65,156,140,173,237,140,204,134,62,116,212,70,214,142,103,195,199,104,112,250,150,176,181,188,164,150,37,197,118,248,249,205,94,117,225,198,189,235,42,79,246,17,13,38,183,190,121,203,182,159,98,248,137,158,163,186,169,31,114,64,158,88,90,183,152,230,42,215,143,154,6,100,77,62,143,99,247,107,94,145,207,243,134,144,238,110,125,225,84,98,110,183,190,174,31,87,206,103,108,93,162,65,87,55,155,15,193,67,193,164,32,75,3,65,173,207,172,245,149,235,195,186,215,147,192,235,9,235,111,218,186,237,114,49,20,210,47,18,29,247,171,238,217,153,184,7,197,106,233,19,200,21,83,59,64,189,109,223,34,107,16,193,25,163,51,211,61,99,207,85,122,115,254,100,190,77,217,57,200,101,99,25,119,76,246,19,16,4,126,130,237,245,85,127,134,155,41,38,83,172,102,57,202,89,247,225,83,197,114,228,212,109,115,250,202,71,251,6,161,248,62,52,253,70,125,20,244,14,201,163,88,171,201,0,94,46,12,126,166,120,229,189,249,216,78,86,198,8,63,110,197,88,168,167,191,241,155,9,29,214,126,42,134,49,11,174,248,211,157,224,138,38,118,15,247,166,176,106,57,226,224,131,39,60,7,151,190,221,195,64,45,250,151,70,205,59,249,221,74,39,188,140,44,237,96,163,227,79,81,32,19,230,99,175,54,100,108,246,41,143,180,144,251,36,175,133,38,253,13,204,62,209,209,124,139,94,215,15,86,60,157,134,137,127,218,188,159,166,194,28,152,145,33,156,4,230,183,102,72,144,1,83,160,135,53,54,28,82,253,206,188,120,251,85,111,242,35,115,72,112,64,81,9,34,173,248,165,108,115,81,32,231,165,254,57,166,56,45,16,86,141,38,134,253,201,220,190,255,179,141,90,95,162,240,105,125,49,230,39,252,112,5,144,106,152,175,20,219,195,67,37,217,91,159,31,95,228,227,185,244,33,83,95,114,48,145,213,151,190,252,23,102,130,65,62,243,124,147,226,45,229,122,201,87,146,239,215,208,161,48,41,19,108,46,219,173,210,172,217,0,208,192,201,223,178,21,171,75,111,96,2,39,249,140,52,47,151,217,146,124,236,150,139,52,105,196,18,11,165,37,238,74,86,169,30,86,103,174,5,31,176,214,73,117,134,34,33,30,37,137,157,122,246,191,108,46,220,250,170,210,172,217,145,217,36,192,22,211,124,206,17,44,77,76,149,204,45,156,189,65,204,37,1,113,228,179,123,222,147,242,49,242,43,225,44,43,209,240,30,9,238,76,61,174,175,205,214,15,89,135,67,187,102,230,149,143,64,80,59,56,69,207,202,26,225,180,157,107,117,231,123,243,137,62,188,150,248,62,248,115,44,38,19,239,33,174,41,40,138,129,102,206,245,255,59,141,85,142,153,115,182,97,72,234,175,140,218,207,59,113,248,249,205,237,101,200,28,124,170,76,158,239,160,55,223,62,208,110,45,94,182,41,63,113,19,253,180,37,156,67,224,202,254,202,225,167,159,7,200,228,29,31,149,23,104,253,46,189,80,222,239,82,1,182,237,161,223,67,53,78,156,31,76,191,69,114,115,216,242,56,25,220,214,37,69,176,135,235,248,81,143,168,115,189,22,126,98,167,255,205,217,92,57,172,215,142,141,249,254,218,121,196,15,215,22,187,100,126,228,179,221,54,25,46,151,198,194,223,102,130,215,65,29,70,181,236,168,217,118,138,34,159,137,216,82,10,122,34,158,100,7,162,96,13,116,205,159,44,136,63,7,68,102,119,146,102,148,210,186,133,144,11,63,31,191,247,53,207,50,241,177,139,151,227,235,131,14,102,144,95,43,125,251,181,4,71,159,211,15,3,103,247,106,35,240,173,73,1,67,110,190,69,148,141,180,228,12,114,59,232,44,201,30,132,185,134,30,130,73,201,240,32,140,23,85,150,230,156,128,147,210,230,20,222,75,85,204,179,140,104,36,16,6,201,181,20,51,179,109,220,66,180,208,6,168,156,232,118,196,141,63,151,157,60,235,100,165,122,225,60,155,173,244,214,140,204,193,9,157,135,153,148,156,156,11,37,23,61,117,21,149,117,82,195,20,96,83,25,246,13,118,185,105,206,171,80,84,7,153,226,9,249,70,8,112,182,206,250,121,74,128,242,152,38,59,80,186,106,189,66,213,98,251,241,19,36,145,172,119,95,150,51,163,204,107,250,174,151,134,226,138,177,103,231,196,5,121,170,94,152,157,251,221,158,216,86,64,185,63,93,144,30,29,227,128,169,236,154,152,110,114,102,73,187,145,187,134,189,122,179,255,117,112,140,29,155,121,206,128,136,246,68,242,49,235,84,51,28,138,209,165,195,96,202,212,240,240,73,129,87,190,167,168,67,19,234,137,255,177,161,165,129,105,212,140,60,152,179,217,228,6,228,81,235,116,45,169,100,83,24,16,37,236,52,217,177,64,55,152,143,29,75,30,190,227,203,171,234,207,164,27,11,210,134,184,80,82,55,25,82,231,214,180,31,35,238,253,63,181,113,53,3,181,124,42,143,101,99,89,204,93,32,61,217,72,249,240,45,69,193,141,175,236,128,78,184,243,91,34,102,207,45,135,30,67,138,46,233,109,5,33,217,42,170,202,44,234,23,161,73,14,98,225,37,23,228,37,198,32,103,139,54,239,47,122,101,158,254,172,153,11,236,44,189,63,119,91,110,208,36,20,192,115,41,177,113,41,68,228,238,188,199,16,109,167,198,255,54,151,242,55,63,251,71,63,163,63,178,115,83,171,16,117,109,250,223,27,238,151,228,214,140,244,196,78,225,44,74,65,16,185,144,168,184,156,114,12,121,245,64,118,226,43,245,210,251,103,83,89,200,61,163,207,141,201,72,7,3,207,99,191,122,26,87,65,39,121,149,90,125,210,47,105,136,80,80,61,247,138,109,68,175,86,163,106,159,82,33,144,132,190,28,71,94,226,45,67,43,113,128,160,25,29,150,84,31,4,249,116,49,246,84,104,170,145,64,14,181,162,134,0,204,184,197,231,73,253,44,220,63,198,93,107,101,189,242,156,83,73,226,255,212,23,167,195,78,245,108,184,131,13,52,144,184,7,30,208,31,26,31,184,10,251,169,209,151,39,34,132,186,102,76,201,176,92,249,37,247,119,5,43,188,97,102,137,93,99,14,217,237,51,52,245,4,47,1,211,93,250,10,58,7,220,210,174,254,114,99,14,92,187,103,80,104,165,22,89,133,133,253,145,140,29,83,93,143,97,204,3,169,26,162,23,196,242,147,85,101,228,128,31,232,104,223,180,129,152,139,156,146,141,27,83,125,16,248,53,230,222,153,249,198,138,144,226,195,246,24,143,188,87,149,244,106,146,162,236,241,250,212,98,108,0,237,221,138,30,255,213,245,51,50,155,134,67,229,133,94,213,152,106,43,104,162,42,16,96,87,22,138,13,219,183,206,84,131,130,196,57,24,248,191,231,17,178,76,164,213,131,215,230,161,81,251,232,212,129,178,185,247,131,124,216,44,18,13,141,157,177,78,26,20,239,109,164,42,0,7,205,22,162,255,41,238,192,219,24,156,114,226,13,248,172,23,74,158,4,149,203,151,249,37,54,253,143,110,133,229,179,45,234,113,179,160,147,34,121,86,181,38,42,198,255,47,1,241,117,209,161,131,220,22,139,51,2,161,161,169,150,175,232,140,62,194,210,178,127,15,240,181,56,126,251,103,87,228,22,108,249,76,64,236,253,155,1,250,245,122,123,251,223,89,19,178,86,136,238,109,100,216,208,152,0,214,9,117,222,179,151,26,133,90,140,183,128,21,232,217,180,75,176,135,93,120,178,47,240,86,164,183,108,223,86,142,194,183,217,230,249,182,42,69,49,201,43,123,27,251,74,89,223,188,228,133,180,170,227,226,107,157,136,249,201,29,199,85,68,137,182,121,134,0,216,173,104,127,213,43,7,96,205,249,11,3,135,238,2,9,12,150,24,151,36,125,111,50,78,27,129,109,20,195,208,230,124,22,50,69,54,156,135,73,197,57,52,196,87,19,29,150,199,70,6,12,176,207,44,32,2,196,149,6,133,143,172,191,169,98,86,65,236,120,52,238,166,62,25,28,45,164,211,0,52,117,219,188,40,61,32,137,41,197,37,217,216,207,216,175,100,62,17,164,137,11,96,2,128,42,92,114,201,168,10,102,15,127,252,56,216,184,113,25,126,38,241,237,34,157,109,72,85,17,169,11,70,192,166,169,52,241,120,181,164,114,230,226,98,38,149,196,13,39,19,152,186,200,156,118,108,113,204,79,174,242,8,249,74,107,5,73,161,116,66,185,0,167,3,29,35,255,139,2,136,172,10,186,20,0,83,194,91,93,135,241,102,156,51,57,144,179,7,148,4,163,2,35,124,115,130,142,110,215,160,166,211,213,29,102,169,246,39,245,190,173,215,237,51,80,158,101,49,141,247,148,117,145,37,33,191,164,34,224,184,133,162,163,151,26,163,27,90,163,47,120,25,58,185,40,77,178,69,123,199,249,138,155,4,186,203,43,11,124,0,20,91,240,112,231,13,146,240,38,204,109,58,70,118,58,129,229,20,187,152,254,167,20,122,8,0,153,6,252,11,70,142,22,63,139,91,38,2,46,138,78,81,88,206,58,189,105,11,8,4,69,78,122,93,114,98,198,48,13,68,170,237,41,84,199,166,150,102,39,238,54,139,209,21,214,69,28,110,115,82,246,98,119,139,51,202,57,197,208,227,64,24,171,157,217,34,46,78,134,244,43,120,85,71,235,239,245,247,174,5,86,151,89,161,187,254,252,1,192,99,234,236,252,121,43,101,125,121,88,229,161,55,1,12,249,0,111,47,241,199,152,103,78,3,228,21,36,51,0,194,47,151,39,29,0,51,196,52,3,205,181,158,229,214,119,130,242,228,28,139,166,119,198,165,131,187,68,188,126,78,189,95,138,81,151,238,1,15,80,24,1,83,121,113,31,199,189,144,4,144,7,40,117,252,80,138,59,205,62,105,190,206,72,162,163,165,46,29,111,141,215,132,74,6,83,105,178,67,110,21,220,190,237,207,200,86,217,171,50,124,157,107,204,237,180,180,172,188,10,62,71,59,212,30,153,121,163,74,61,75,20,126,175,177,37,6,69,242,200,58,36,94,72,177,87,18,4,189,159,190,124,230,168,65,139,122,84,180,141,56,138,236,184,55,83,52,87,240,243,254,229,13,133,180,96,68,36,35,110,90,227,80,110,11,86,240,84,139,244,62,16,38,71,135,58,150,81,23,244,25,101,2,169,93,34,85,181,22,146,139,104,37,140,212,59,232,115,18,17,185,214,217,180,217,159,168,49,44,182,88,58,145,6,149,36,190,218,201,103,130,16,206,188,114,127,109,27,70,101,92,77,65,138,163,237,98,81,110,213,53,96,106,121,220,69,229,0,158,110,96,238,106,181,106,10,22,66,121,154,179,218,180,134,93,144,80,34,128,242,69,139,188,31,98,157,159,249,84,14,173,102,207,59,19,209,52,178,169,221,19,123,213,94,110,246,105,122,174,156,115,80,140,20,53,251,62,45,203,212,26,74,211,243,137,51,71,62,180,210,150,108,25,170,205,149,178,206,128,213,181,188,255,180,12,230,115,154,77,7,34,153,52,252,174,189,111,45,127,91,146,74,22,212,110,138,52,147,76,123,226,143,118,90,116,153,241,193,105,251,55,248,236,52,97,105,145,157,77,3,28,86,232,219,150,2,21,233,108,75,43,140,203,6,197,206,162,99,43,47,81,36,179,29,243,166,134,5,254,199,103,42,39,238,115,172,109,117,246,39,51,123,88,131,66,27,247,40,70,234,6,219,149,67,202,174,111,56,229,124,235,185,12,10,77,98,43,40,56,149,123,218,159,188,236,146,143,24,195,171,15,26,52,201,216,38,27,178,33,45,221,144,30,251,190,0,42,181,224,227,200,73,4,141,236,88,76,135,4,25,226,164,174,12,106,30,173,35,172,168,146,160,209,134,93,35,11,68,117,75,140,104,98,172,193,116,35,133,99,32,41,246,84,164,104,249,147,113,153,170,2,171,114,21,120,21,123,71,211,177,43,216,167,24,60,126,81,45,106,33,138,114,147,71,102,24,64,59,156,168,74,19,87,101,115,48,166,104,81,31,83,61,190,208,114,3,250,206,246,131,228,157,84,45,133,177,142,33,122,179,200,149,12,70,170,50,68,255,225,51,34,145,10,56,70,161,203,245,214,185,239,148,99,169,220,31,26,86,105,223,92,60,214,93,221,33,195,47,90,105,129,245,69,147,176,41,43,148,130,126,34,149,199,236,224,116,226,45,239,40,122,116,69,232,162,149,23,43,75,15,166,95,76,19,51,14,5,121,206,110,220,28,143,98,22,5,249,164,113,164,170,231,227,111,1,199,52,92,121,155,17,141,95,95,104,47,37,236,37,56,196,245,91,181,79,185,151,232,63,82,91,149,52,153,74,150,34,104,31,22,5,206,134,121,68,247,239,143,67,91,122,223,218,36,89,73,225,40,233,1,0};
+
+static const unsigned char v13[] = {31,139,8,0,0,0,0,0,2,3,189,60,219,114,219,184,146,239,254,138,30,173,247,72,202,144,20,41,75,182,99,91,158,202,109,38,217,202,36,169,216,201,238,89,151,107,6,34,33,9,99,138,96,1,208,109,52,252,167,253,134,253,178,173,6,120,1,37,90,241,156,51,103,83,21,153,36,128,70,163,209,104,244,13,232,245,0,62,124,188,125,115,1,47,62,189,131,144,196,177,132,249,66,42,144,138,8,5,43,166,102,208,38,41,235,181,129,37,192,69,68,5,40,14,146,138,37,5,53,163,64,210,20,136,2,146,108,224,203,231,119,71,71,237,133,164,32,149,96,161,106,95,30,177,121,202,133,130,45,204,28,16,52,137,168,112,96,33,233,141,34,138,234,167,55,147,9,13,149,126,252,76,39,14,204,212,60,118,224,51,95,40,42,32,131,137,224,115,128,182,215,27,47,146,40,166,222,120,124,22,156,159,158,135,222,111,210,134,254,46,228,137,116,224,61,159,178,196,129,27,170,20,75,166,14,188,92,40,197,241,131,34,202,1,197,210,87,60,230,66,58,160,255,210,200,129,15,92,177,9,11,137,98,88,239,19,153,178,36,127,254,146,198,156,68,63,178,152,22,80,110,233,90,125,37,241,130,22,120,181,189,94,200,231,41,79,104,162,164,119,234,159,13,250,39,253,190,65,237,8,49,82,136,17,135,17,164,130,167,18,70,215,122,120,191,94,201,229,20,194,152,72,57,58,222,234,34,79,191,101,176,158,199,137,28,181,102,74,165,23,189,222,106,181,242,86,39,30,23,211,94,223,247,253,158,92,78,91,176,100,116,245,146,175,71,45,31,124,8,250,222,249,153,254,29,182,174,175,34,58,145,215,87,82,109,98,122,237,197,177,27,198,210,13,182,19,22,199,23,9,79,232,165,84,130,63,208,139,127,243,125,63,127,118,231,76,81,17,179,57,83,23,65,249,113,197,34,53,187,240,189,97,186,190,204,174,122,6,224,85,207,128,159,2,139,70,173,247,100,67,197,47,253,22,68,68,17,55,33,115,154,127,131,126,171,94,39,112,155,106,5,173,235,171,148,168,89,78,134,86,129,109,11,162,81,235,231,160,239,157,246,157,192,59,239,127,61,247,158,7,47,2,111,120,238,232,31,223,241,157,192,9,2,39,240,189,193,249,219,1,9,188,193,192,209,63,186,200,13,92,239,228,236,133,119,250,220,59,125,158,215,238,123,231,3,39,240,99,215,11,92,47,232,19,239,60,240,206,131,188,190,23,12,93,111,112,254,117,232,13,207,136,119,126,230,157,159,229,205,188,243,83,215,59,63,125,59,240,206,78,190,158,121,253,115,226,157,159,122,231,167,186,216,119,244,203,240,237,115,111,128,16,135,222,249,176,44,24,186,222,249,240,235,137,55,24,190,168,53,9,124,47,56,113,78,28,239,236,212,59,171,62,106,4,137,215,127,238,245,13,202,62,162,233,122,1,142,235,185,249,49,159,245,224,222,246,189,147,231,95,145,56,72,151,51,71,255,24,148,7,142,215,31,190,13,130,189,130,138,160,255,221,234,29,164,60,146,213,16,247,107,176,79,248,115,239,185,134,245,182,177,123,175,63,116,130,224,235,137,247,124,176,143,129,119,222,119,250,136,254,185,247,156,212,7,22,96,219,147,179,216,11,250,94,64,44,234,4,142,23,4,94,48,176,168,136,159,6,222,224,172,152,145,146,240,129,107,94,222,158,123,193,73,49,157,21,241,93,51,45,167,111,113,90,236,137,198,18,172,246,245,185,55,176,89,195,119,188,96,232,13,206,99,47,208,76,83,113,20,150,156,120,65,224,212,121,207,55,163,208,4,238,77,243,255,114,57,189,254,245,242,232,104,178,72,66,148,43,240,150,146,136,138,206,54,230,83,190,48,114,79,56,32,169,186,153,241,213,13,139,232,152,224,123,245,146,117,97,123,4,32,168,90,136,196,200,143,163,171,136,45,139,249,27,79,221,213,140,41,148,185,44,124,216,128,226,169,235,195,239,238,221,224,252,30,214,43,119,178,136,99,24,107,193,237,142,33,221,184,125,56,222,90,240,225,111,127,131,118,26,187,103,253,118,6,74,144,68,50,68,212,37,113,12,209,66,104,105,232,158,248,190,41,155,112,49,111,93,31,1,216,40,164,107,183,15,121,79,233,198,245,97,142,63,147,152,174,129,41,58,151,110,72,19,69,133,110,7,112,53,214,242,20,212,38,165,163,150,121,105,1,79,194,152,133,15,163,227,45,93,162,160,172,83,164,163,191,125,183,236,102,69,159,138,174,149,43,99,162,168,59,240,253,28,52,192,213,241,86,239,5,222,152,8,121,82,214,158,185,167,45,232,229,253,247,138,7,107,8,26,89,252,113,3,152,146,212,93,187,3,144,52,158,184,82,9,170,194,25,196,211,11,243,253,180,234,203,106,47,104,76,20,91,82,176,0,181,174,203,174,26,58,179,41,83,118,217,208,11,192,149,76,73,82,31,247,28,118,199,31,243,233,148,70,184,71,19,121,1,199,91,228,171,204,234,191,142,193,140,69,17,77,176,187,113,204,195,7,124,152,153,238,87,110,186,214,223,167,238,84,144,141,219,247,253,22,16,193,136,107,218,140,90,74,44,104,109,104,154,234,102,147,204,64,49,21,163,148,215,236,221,2,22,242,100,84,204,137,225,249,204,154,235,226,75,69,166,94,125,150,244,31,252,249,245,242,40,179,215,81,193,24,219,133,136,205,122,201,23,138,217,119,63,144,229,123,150,60,192,8,58,91,141,146,163,81,113,96,38,80,203,88,136,56,235,150,251,113,206,206,121,199,68,215,25,181,254,237,120,139,15,89,171,32,154,121,135,209,8,155,195,15,208,30,79,243,25,24,250,102,62,198,241,130,186,167,190,15,83,193,23,105,27,46,160,173,191,107,74,158,249,62,204,248,146,138,139,122,93,243,173,160,247,176,104,156,25,86,50,236,112,2,130,47,146,136,70,238,60,130,212,237,67,193,6,49,37,17,75,166,238,41,76,120,162,92,73,231,108,204,227,200,94,15,56,238,114,33,172,220,83,192,197,80,18,252,216,144,39,43,136,94,82,253,215,203,111,72,157,37,227,49,85,110,128,67,144,46,14,34,38,27,235,209,229,41,77,46,180,212,208,68,90,187,126,201,48,248,207,181,139,180,236,120,146,244,169,193,152,176,53,141,114,145,23,211,137,114,125,24,115,165,248,220,136,192,83,255,30,86,238,89,31,74,33,153,11,66,81,131,146,127,44,248,29,112,0,147,152,175,220,141,75,22,168,236,134,130,199,241,152,8,119,83,107,103,228,168,22,160,181,97,182,51,16,108,58,83,166,117,129,208,158,216,172,68,69,200,99,152,187,3,61,217,155,114,237,239,213,157,185,129,15,114,38,88,242,224,250,205,2,68,115,1,114,128,225,144,117,108,11,138,97,93,80,226,26,181,36,36,78,65,171,119,13,127,231,11,1,47,5,73,162,167,137,203,98,4,54,232,124,249,149,226,224,53,145,179,49,39,34,218,145,8,51,62,167,89,190,222,122,45,92,87,163,99,92,209,182,68,216,135,150,235,247,114,7,88,200,167,37,44,89,86,121,34,204,255,100,63,50,120,197,147,9,155,238,128,93,177,9,43,225,226,203,147,97,254,200,196,124,69,4,133,47,105,68,20,221,129,27,241,85,130,38,70,9,123,145,215,122,34,244,55,75,52,59,118,128,146,152,10,85,66,164,121,149,125,136,223,18,175,6,120,103,91,19,170,119,6,158,86,87,76,133,123,24,149,230,92,231,238,190,123,89,213,77,201,148,234,154,159,200,148,214,234,5,221,203,163,178,158,160,19,65,229,12,5,53,10,100,141,220,4,119,220,142,182,58,77,143,189,41,85,109,71,99,98,254,205,169,154,241,232,2,218,159,62,222,220,182,29,24,243,104,115,1,255,113,243,241,131,135,166,103,50,101,147,77,103,139,40,92,0,254,102,93,39,111,155,117,61,53,163,73,71,160,244,23,222,111,146,39,157,110,183,4,108,21,150,131,236,136,174,193,184,52,87,59,57,214,142,25,230,253,110,177,30,74,142,110,78,129,142,70,46,37,66,210,78,204,67,18,223,40,46,200,148,122,83,170,222,41,58,239,180,17,82,187,219,213,52,212,152,58,112,119,16,114,13,140,172,129,113,244,168,61,197,111,52,53,58,6,106,86,199,215,76,192,237,108,223,62,85,51,144,33,71,245,12,215,117,177,232,119,20,204,192,175,212,202,252,193,136,25,20,215,149,192,157,186,60,37,33,83,27,247,108,136,218,97,224,13,33,69,81,165,5,19,10,237,114,51,171,109,97,182,224,122,142,16,73,248,16,9,158,226,198,41,170,183,9,139,181,106,89,24,210,102,55,187,234,169,153,217,193,242,65,70,13,131,140,202,77,17,49,149,41,9,169,155,240,149,32,233,35,3,195,189,65,43,208,26,255,84,184,39,208,160,142,61,71,41,91,162,67,215,10,177,137,108,108,62,9,198,181,102,146,10,198,51,107,70,77,49,182,129,17,220,181,103,108,58,107,59,208,158,211,136,45,230,248,20,243,85,251,254,14,155,221,95,90,45,66,237,214,192,54,165,143,195,211,238,141,234,117,67,227,152,175,236,47,83,65,105,82,3,102,239,246,87,199,219,220,73,146,229,224,71,199,91,243,144,105,12,71,199,91,61,56,200,85,133,204,226,41,189,110,244,8,169,173,102,93,41,161,133,206,241,246,54,42,129,220,181,83,190,162,2,71,55,35,34,66,121,137,207,138,81,113,82,60,12,218,247,119,212,67,131,225,62,151,96,117,24,5,198,72,216,12,112,68,104,71,120,154,188,189,235,95,27,219,80,79,177,57,133,31,160,147,208,21,188,70,193,148,127,122,6,129,239,251,221,174,167,248,123,92,98,180,88,68,168,207,5,207,207,124,215,15,92,63,104,63,6,54,167,74,33,87,143,30,85,162,112,203,143,216,146,69,212,221,20,15,251,74,136,86,34,114,245,175,92,87,251,202,68,109,237,236,91,24,149,30,138,58,103,138,42,229,111,11,169,216,100,227,142,169,90,81,154,192,222,50,104,210,67,254,76,55,141,150,210,92,184,131,214,245,155,175,111,62,220,194,251,143,63,93,245,42,205,219,122,60,222,86,190,184,12,194,133,16,52,209,114,20,61,102,40,208,11,185,250,35,238,125,249,115,6,138,43,18,163,28,148,163,129,159,171,72,159,168,208,13,251,62,84,123,94,29,39,150,196,44,161,174,177,133,230,44,113,115,99,150,196,108,154,184,115,22,69,49,109,129,246,131,141,90,115,178,118,103,20,245,187,11,56,239,47,103,151,229,84,93,0,206,213,101,65,54,69,198,49,45,135,93,65,45,100,10,77,137,32,149,78,138,148,71,85,222,34,155,154,81,18,89,102,150,89,63,150,213,117,59,43,213,129,219,77,74,91,208,123,188,2,46,142,131,21,110,217,252,48,132,215,84,134,130,165,56,39,181,122,87,189,10,49,148,188,22,210,87,10,183,230,170,234,241,182,99,182,116,143,8,1,63,128,245,114,129,219,157,55,39,105,135,106,145,209,209,82,196,1,148,33,221,172,2,95,1,188,234,105,18,31,84,100,94,205,136,80,157,45,58,32,107,186,76,2,35,237,149,244,98,154,76,213,12,122,207,128,38,74,48,42,225,89,207,129,21,140,0,25,198,124,221,128,118,137,234,146,24,229,108,48,236,61,211,6,7,232,245,2,207,122,149,116,199,253,20,141,162,222,51,152,10,146,206,192,48,139,110,188,193,45,20,1,12,177,248,239,64,214,76,130,249,134,197,99,13,91,55,53,86,67,3,248,205,156,172,17,185,161,245,9,101,45,67,162,117,102,224,194,88,118,161,87,116,245,12,58,12,190,135,192,82,205,198,122,199,175,85,127,6,41,244,16,235,75,232,245,224,37,17,57,210,85,155,205,94,27,23,198,179,78,106,193,21,36,153,82,148,250,58,116,224,128,100,191,163,6,168,104,170,247,128,23,66,144,141,135,142,243,206,214,16,253,66,87,201,28,232,252,226,0,211,149,24,34,140,77,224,143,63,32,232,194,247,38,14,161,123,233,245,116,71,60,166,232,73,232,68,178,123,208,68,157,111,254,106,241,26,235,121,92,164,41,21,33,145,244,41,82,118,160,21,6,13,238,150,206,83,42,136,90,8,234,64,76,164,130,254,96,214,44,143,10,111,82,33,73,170,120,1,26,222,102,43,119,215,67,191,116,186,185,131,157,192,192,241,54,121,182,250,62,150,25,28,111,103,89,171,178,246,245,36,117,252,130,21,205,130,99,182,43,36,95,104,40,17,97,29,140,124,216,4,163,227,237,70,117,88,55,131,117,31,189,54,242,251,228,217,42,131,77,191,42,176,67,7,35,223,59,169,148,70,253,189,212,12,91,69,205,136,200,25,65,150,24,181,2,39,168,203,19,173,1,173,177,235,162,3,183,95,247,252,221,157,166,235,123,192,208,134,237,4,59,222,226,234,112,241,167,103,198,247,172,195,190,15,186,182,35,236,215,82,150,88,196,72,12,29,214,13,116,16,52,68,92,244,168,215,122,212,163,227,237,120,211,65,225,113,183,190,127,22,248,126,15,59,236,102,70,72,140,130,126,190,120,176,222,172,169,158,88,143,250,37,99,225,16,194,13,73,180,117,222,68,5,187,103,148,43,79,33,195,250,89,63,187,240,253,134,97,127,203,240,123,77,151,52,230,41,21,31,184,162,29,173,226,57,16,206,88,28,9,154,124,203,23,173,23,68,154,59,50,250,123,139,168,65,89,174,92,18,7,29,164,251,254,93,150,76,42,231,69,238,169,197,128,229,152,72,38,221,187,19,31,9,51,21,124,229,90,46,147,124,121,82,154,232,245,57,23,24,155,106,118,209,214,189,105,37,85,48,96,72,119,157,148,122,91,211,179,245,199,31,208,110,119,61,153,198,76,117,218,94,219,176,213,178,100,43,184,74,45,241,212,7,156,171,165,230,206,98,126,142,183,37,177,15,77,211,207,132,37,187,214,121,196,166,198,54,127,205,166,117,203,124,66,98,73,109,227,92,42,146,219,241,88,161,94,57,89,196,177,93,87,76,199,186,230,231,233,184,86,111,43,104,116,1,190,3,154,160,250,9,125,154,23,224,103,118,243,24,237,16,73,213,123,26,29,196,105,199,17,80,56,1,4,149,170,39,55,178,167,81,110,55,90,239,117,163,93,143,200,216,236,5,236,152,70,26,220,163,192,99,26,149,254,133,210,183,144,114,169,30,245,45,224,190,164,232,5,130,134,31,32,0,61,126,77,17,49,29,27,227,43,167,11,190,235,199,130,62,248,97,172,195,200,93,64,195,201,66,52,98,211,195,136,226,28,35,166,127,14,73,108,85,96,153,117,179,131,78,133,156,84,157,210,99,160,39,176,28,148,53,154,98,28,123,78,138,98,20,142,225,73,227,22,106,114,158,152,18,54,129,206,119,122,122,187,133,104,105,183,15,110,237,77,194,5,197,142,156,95,160,115,124,190,54,187,250,84,176,72,255,160,123,82,186,125,29,94,41,95,141,148,26,180,74,139,3,25,167,82,134,171,221,186,101,108,187,214,241,86,35,233,169,170,40,131,255,253,159,87,45,52,170,111,117,149,41,231,145,126,125,103,59,229,184,118,218,229,118,55,218,205,117,27,188,114,202,53,133,245,140,117,96,251,255,229,140,68,124,229,198,83,168,208,55,3,48,78,207,114,12,159,127,122,9,239,223,188,110,193,18,179,22,112,35,65,107,94,82,53,201,141,166,247,248,110,226,112,114,197,84,56,123,68,26,206,21,18,87,91,134,133,54,83,217,7,69,86,68,86,118,147,51,75,213,85,17,209,251,60,29,119,82,97,2,124,157,173,231,121,248,146,47,27,237,26,123,151,168,206,178,139,98,212,71,165,63,199,45,89,204,199,84,180,208,50,27,181,252,22,204,201,122,212,234,15,135,45,72,99,18,210,25,143,35,42,70,173,207,52,130,142,239,246,135,195,110,125,35,125,20,201,156,252,79,68,51,95,207,255,60,162,63,33,160,63,137,234,88,127,121,34,166,70,206,252,243,136,190,68,41,181,143,103,205,102,255,23,241,238,107,54,101,10,148,54,73,11,58,160,48,169,241,239,107,253,161,145,129,15,35,22,242,24,237,237,196,237,31,194,177,5,130,35,46,218,169,110,35,91,83,146,114,215,79,75,239,59,218,166,4,38,65,208,144,178,37,141,76,166,16,38,74,253,204,147,41,231,146,106,223,37,77,162,86,147,47,254,207,202,180,160,46,211,250,117,153,246,157,235,30,111,181,5,156,105,196,70,133,8,75,57,75,148,204,160,231,186,251,84,210,134,211,108,237,246,7,240,148,153,124,34,149,74,30,55,212,186,157,49,9,33,162,134,212,34,9,220,124,253,9,216,92,7,13,166,52,65,249,74,35,192,52,129,25,26,90,155,146,142,37,28,77,105,179,69,160,229,182,201,179,209,152,209,20,48,100,80,166,180,181,158,26,246,40,34,54,56,151,11,89,133,142,147,9,223,211,130,205,142,173,119,88,237,173,253,242,225,197,215,23,239,222,191,120,249,254,13,250,45,127,124,247,249,230,246,151,151,31,63,98,124,162,253,225,227,237,47,175,62,254,252,243,187,219,219,55,175,241,67,245,114,127,215,65,248,158,212,125,234,149,218,133,127,135,193,125,165,22,44,73,204,208,131,109,215,187,6,255,242,73,121,33,232,115,175,236,224,250,68,254,43,236,220,90,76,185,137,169,139,218,176,107,230,214,121,48,104,93,155,105,192,116,6,77,230,172,113,81,155,170,175,62,191,58,233,99,77,67,171,31,12,173,66,17,158,244,171,48,72,112,170,125,184,73,143,180,15,193,186,97,191,211,61,80,232,170,120,74,227,31,99,34,103,52,2,162,108,16,165,143,89,195,66,177,38,21,153,167,133,175,185,209,213,92,239,233,176,97,176,207,194,38,230,184,107,35,24,78,198,96,81,50,225,245,232,221,54,115,96,155,221,127,91,37,199,53,54,201,123,233,25,110,124,138,94,142,61,22,106,249,227,202,160,233,153,39,33,159,207,25,250,181,204,230,214,212,181,169,210,54,193,187,71,163,122,121,129,233,166,214,133,160,99,206,27,187,136,232,146,133,180,39,168,164,79,133,143,5,56,201,159,4,159,51,73,203,81,163,83,149,47,84,199,244,177,45,104,218,233,94,130,192,159,204,129,19,29,109,168,163,166,243,13,194,135,131,227,47,42,213,48,44,134,85,3,71,5,46,227,199,7,170,203,209,37,85,206,99,3,185,22,58,33,22,70,80,176,90,135,63,56,128,73,157,198,213,215,205,45,8,173,206,243,135,82,151,215,134,94,45,192,244,79,209,41,143,53,29,114,252,21,170,253,55,54,203,147,86,30,190,169,75,253,82,5,121,101,162,14,80,16,220,108,79,45,45,14,70,199,91,252,115,231,223,103,135,178,35,116,48,177,114,134,52,231,74,189,50,172,174,112,71,44,250,178,19,226,138,197,80,109,161,181,144,191,154,45,230,227,47,105,6,17,147,232,14,143,42,220,138,189,98,52,2,157,11,167,19,128,116,158,199,35,186,199,163,180,248,36,232,146,241,133,60,72,140,160,36,198,222,24,63,23,12,173,248,161,129,22,44,93,12,181,54,80,44,88,17,17,237,143,52,176,71,234,55,141,180,97,31,42,55,200,117,45,14,87,223,32,161,150,164,243,88,64,236,159,221,48,1,221,110,44,68,189,52,81,130,199,143,107,176,69,203,147,58,98,134,199,180,191,203,102,180,221,28,118,75,9,51,211,98,42,232,5,89,78,172,55,102,9,186,20,245,212,152,69,175,231,198,60,22,32,48,165,164,85,19,71,166,188,5,36,12,105,170,70,45,132,227,120,139,201,99,46,54,131,172,157,34,185,207,53,70,66,27,41,181,195,41,186,40,171,115,72,46,52,154,89,189,169,131,55,90,48,106,103,188,164,161,226,162,222,137,150,139,217,110,218,78,88,131,15,38,47,242,81,21,243,232,232,31,18,78,251,14,142,93,93,188,82,192,203,69,87,215,184,27,45,249,186,253,94,102,40,229,203,135,36,17,112,53,163,66,175,107,49,215,241,87,84,208,165,194,84,0,76,47,69,45,219,34,88,9,138,79,96,130,170,207,110,34,231,159,234,63,36,9,140,41,84,186,179,3,95,62,148,170,50,112,1,229,139,7,239,38,144,240,74,38,214,17,38,75,194,98,20,18,14,48,109,98,88,234,185,247,20,28,1,74,208,218,86,249,233,203,59,64,6,151,64,170,181,130,203,68,19,77,210,36,146,216,83,56,91,36,15,104,141,152,7,45,238,44,155,69,115,50,102,231,72,201,146,105,17,216,206,43,243,201,68,82,60,168,130,81,236,170,19,173,121,98,39,196,244,135,91,238,69,9,178,97,13,254,96,0,141,254,235,111,26,210,232,239,127,211,71,47,254,251,80,142,237,95,201,108,13,243,107,114,219,96,78,195,25,73,152,156,67,68,39,44,161,18,78,180,145,86,168,20,18,212,140,40,205,99,138,136,41,85,59,148,51,71,147,216,60,141,233,156,38,234,2,230,211,95,184,34,191,140,233,148,37,157,174,83,188,175,4,83,180,211,213,84,203,63,209,36,234,116,255,228,196,127,126,115,115,59,89,196,26,197,25,193,3,72,66,162,238,10,8,112,189,94,119,186,186,8,83,68,9,230,126,23,163,85,220,172,5,207,98,161,124,213,248,110,30,112,206,249,67,176,233,20,161,150,40,98,26,70,56,131,148,10,228,231,106,163,44,65,229,164,92,104,6,194,126,163,157,77,249,79,14,242,138,148,71,65,48,99,186,158,156,140,155,160,192,80,96,11,172,180,0,147,94,136,167,148,228,69,175,55,207,29,27,222,74,246,86,116,204,18,34,100,175,117,253,31,28,15,140,45,4,76,4,165,144,23,92,245,200,53,168,106,213,162,149,30,81,69,24,250,209,233,58,141,137,201,249,144,64,198,124,161,32,229,82,50,76,163,152,212,57,9,37,18,186,8,166,140,202,106,41,36,81,197,27,70,18,68,116,206,15,178,125,99,110,121,158,60,186,107,60,21,73,165,38,112,146,191,28,140,157,224,244,124,166,114,17,43,211,166,124,61,212,234,128,217,85,96,160,19,34,159,110,152,88,232,126,203,2,43,177,152,63,104,71,27,140,224,65,123,23,151,187,128,116,176,244,227,248,55,26,42,15,197,217,20,3,82,14,172,29,216,222,61,220,95,192,50,67,163,6,44,11,66,47,146,6,43,164,28,149,180,210,60,159,20,225,40,90,230,129,148,167,210,162,156,6,164,70,163,149,88,134,37,202,14,106,145,137,60,172,196,167,31,83,195,173,35,184,187,243,29,104,191,54,154,105,251,222,129,187,192,129,246,27,33,184,208,111,125,7,218,104,2,235,151,19,172,74,199,139,105,251,254,254,219,182,204,174,162,96,244,135,121,180,163,46,236,250,89,14,248,125,42,199,222,255,175,126,91,48,207,1,5,55,207,175,28,218,233,229,149,158,187,227,50,210,57,248,229,108,98,38,126,145,10,104,31,236,204,128,163,62,87,85,204,173,133,29,159,100,173,198,156,74,169,83,202,194,152,75,116,62,155,181,88,231,30,189,112,117,6,100,118,244,184,43,251,77,162,19,193,222,115,76,71,47,124,217,5,99,97,42,203,47,84,215,176,2,38,249,226,235,180,173,210,118,247,241,88,205,126,167,239,249,20,222,227,14,253,72,151,49,150,61,210,161,46,179,186,163,49,13,85,11,72,20,241,228,61,157,168,81,203,119,79,90,182,21,246,93,243,112,184,89,29,230,160,79,190,84,178,67,88,191,212,231,38,18,42,155,40,53,46,11,27,240,174,10,219,123,81,14,141,248,103,157,146,209,250,247,195,100,203,249,244,3,177,227,14,37,6,70,9,249,5,181,169,6,20,172,210,10,135,199,34,106,99,55,128,185,42,236,56,29,117,113,209,250,163,137,114,49,56,112,109,25,43,53,251,3,121,52,171,89,41,230,75,113,54,2,101,108,117,64,162,119,253,143,104,123,150,155,95,47,108,26,199,44,149,76,214,179,166,154,28,255,223,114,251,191,128,37,17,140,170,13,218,11,185,181,43,1,247,245,84,80,215,40,133,120,160,7,40,202,25,212,3,35,3,78,171,123,150,10,162,248,116,26,83,24,231,103,179,49,23,28,15,84,128,97,86,116,217,167,11,116,221,208,56,50,135,216,117,182,30,106,8,34,79,108,43,181,6,228,14,233,21,34,170,152,108,141,84,25,197,65,133,158,196,49,75,166,118,203,157,29,185,140,55,56,185,18,103,196,186,172,96,226,246,5,220,236,153,22,160,87,56,151,168,206,229,241,14,189,81,230,199,36,205,145,252,221,109,210,106,188,19,228,120,92,173,193,35,46,230,132,203,174,98,147,10,190,100,146,241,36,207,213,248,84,189,215,83,62,242,124,2,237,210,115,64,74,134,27,116,219,1,150,46,7,248,84,203,252,144,33,73,140,236,51,80,111,170,247,111,100,167,72,22,229,74,22,62,29,56,100,98,102,155,70,88,47,215,202,170,15,7,53,51,180,192,86,92,228,227,205,95,106,45,218,109,187,126,200,147,132,134,230,90,1,73,213,171,242,245,224,80,148,241,106,126,198,99,131,249,21,7,5,38,101,157,247,60,124,192,165,253,215,94,19,128,57,97,163,22,30,251,223,201,12,236,15,160,63,40,178,240,70,173,220,2,213,249,8,197,153,252,60,67,15,213,254,144,164,163,150,22,7,45,251,243,111,28,3,199,245,239,38,251,173,213,47,142,240,67,48,92,246,231,238,41,12,102,65,159,244,161,15,62,248,126,223,237,47,221,211,242,213,237,187,253,183,246,43,244,151,213,107,31,250,191,207,3,223,13,252,175,103,100,0,3,83,231,28,252,229,96,118,254,187,62,104,93,28,176,46,168,57,165,234,134,77,19,18,231,36,237,8,41,153,149,223,130,90,29,126,130,107,112,79,252,74,173,171,167,134,181,47,247,42,159,54,87,30,54,86,62,27,238,84,206,115,54,155,107,63,223,5,205,117,98,162,85,187,86,42,104,84,22,217,167,46,180,70,109,45,221,210,128,216,218,48,236,140,34,60,205,214,179,22,127,187,48,144,15,156,145,50,69,58,248,90,130,198,127,59,217,185,109,27,17,172,125,209,118,244,223,242,124,19,236,72,154,82,186,232,180,236,186,72,210,130,70,127,151,122,165,27,121,163,63,224,99,86,29,154,50,241,129,29,162,160,228,121,34,53,80,104,53,145,161,26,104,109,148,159,169,76,121,130,30,1,45,212,113,144,194,26,97,222,75,65,195,10,203,111,16,179,78,73,204,227,56,68,68,45,37,13,148,63,254,40,2,105,22,53,44,30,49,2,19,27,232,68,109,201,34,139,38,187,83,88,8,83,184,185,121,247,26,187,214,245,47,139,99,109,182,172,237,212,139,10,129,90,8,81,27,133,92,146,238,204,71,77,166,118,240,140,121,14,109,111,134,242,246,214,121,192,157,211,128,71,197,169,222,230,148,56,205,75,246,198,145,243,84,177,35,20,179,179,51,73,54,178,251,8,87,130,191,154,21,155,60,229,246,83,113,254,14,137,234,93,134,4,71,77,209,122,108,230,12,93,212,105,231,40,128,126,197,41,210,15,245,158,254,5,104,238,205,41,73,66,26,31,156,82,187,235,3,221,62,202,60,205,233,138,187,50,175,74,91,220,205,58,236,236,108,2,150,118,210,45,233,107,70,147,242,120,119,44,101,95,40,74,58,221,102,150,56,0,184,136,186,20,234,128,87,120,126,71,118,240,19,59,118,96,136,113,206,75,171,97,165,68,91,130,174,120,192,54,133,100,201,128,198,146,150,157,150,162,193,18,9,7,72,159,217,130,177,62,54,28,215,62,242,246,240,194,152,18,81,140,163,161,234,229,209,65,34,32,26,229,208,142,202,1,226,68,90,244,204,29,84,255,178,3,117,90,205,42,88,201,51,169,61,133,79,225,31,61,10,87,36,155,55,29,185,171,29,144,187,214,71,208,45,4,172,52,187,188,134,150,195,187,88,74,22,101,251,85,223,125,250,58,216,173,170,183,202,166,3,119,191,102,122,240,223,253,213,163,71,77,229,79,140,157,73,72,184,122,132,4,117,100,255,218,163,143,86,190,92,137,76,168,45,165,252,10,10,221,121,153,43,183,239,54,64,169,96,249,11,42,142,173,165,43,222,216,223,27,92,57,229,16,107,32,236,57,216,73,14,44,240,94,196,229,73,136,189,36,221,227,173,54,167,244,65,4,169,247,253,134,163,62,181,204,133,221,115,161,53,98,226,253,62,230,4,119,191,41,151,172,233,178,153,199,79,115,60,126,143,206,78,21,235,224,135,185,142,161,188,206,100,0,120,113,205,241,182,166,247,235,129,122,90,243,207,118,78,52,26,146,124,167,43,48,137,87,148,88,20,214,151,98,24,107,172,236,130,140,37,143,23,138,130,139,7,223,3,112,205,213,30,1,172,220,62,204,138,171,88,202,35,175,198,25,88,195,188,87,11,137,237,121,130,226,90,68,244,145,163,40,230,8,56,30,23,145,133,198,146,53,1,222,253,180,255,33,119,43,84,14,164,194,177,89,40,134,70,149,203,236,203,157,60,115,114,31,133,165,142,12,13,253,252,44,141,241,26,149,12,96,118,150,171,158,233,195,62,32,26,179,253,131,72,139,184,198,244,185,16,178,53,179,39,176,190,22,139,121,147,139,157,230,123,100,210,142,74,171,124,143,1,10,145,100,188,71,102,137,22,122,97,181,190,139,47,232,134,211,53,241,220,119,238,29,46,149,23,234,153,8,166,167,91,117,179,122,102,245,167,18,104,225,130,51,107,41,173,110,210,154,43,235,116,82,206,83,123,203,202,228,125,232,170,165,60,221,155,225,92,99,174,229,205,84,254,140,166,153,246,134,160,47,36,202,45,220,134,201,46,239,184,178,65,225,165,72,149,202,231,121,158,190,2,41,255,130,185,140,117,198,104,192,84,235,145,143,99,148,155,190,141,204,247,74,183,173,247,81,206,189,205,101,213,179,113,144,25,165,239,69,154,218,185,109,59,30,50,12,171,23,190,159,247,230,185,230,248,41,13,150,188,190,185,149,138,170,47,34,174,59,149,122,53,175,82,121,251,219,23,73,197,1,239,147,172,93,14,87,187,26,173,9,13,59,66,133,81,212,166,211,68,166,168,189,147,164,137,120,96,223,221,90,148,139,161,245,172,171,124,39,60,254,0,63,88,100,200,21,123,92,66,69,123,173,83,194,69,105,246,30,53,221,173,162,107,10,15,41,80,249,22,38,44,33,113,188,41,43,213,251,104,62,183,180,51,40,150,20,99,210,47,221,42,174,137,74,108,62,143,118,56,79,219,189,72,80,24,199,36,121,208,55,167,160,35,150,37,76,49,18,235,164,143,34,28,168,177,221,189,39,67,223,58,154,25,58,233,235,8,226,242,3,207,207,1,233,171,150,142,172,196,171,220,217,92,222,139,100,174,46,205,131,236,229,113,162,91,110,160,234,107,2,47,128,68,115,150,244,244,175,185,56,48,232,233,95,243,210,215,47,90,100,252,170,143,113,235,252,24,61,127,230,102,56,115,77,90,62,159,50,196,197,125,88,155,102,137,59,115,77,69,40,239,58,11,242,19,155,168,5,229,55,20,218,247,11,97,23,163,218,5,131,213,53,25,230,238,195,44,231,74,235,250,55,68,124,148,223,89,103,223,125,184,11,168,206,249,185,82,181,223,147,53,134,191,226,170,67,141,187,185,145,22,37,254,171,25,58,231,236,139,10,191,136,184,67,151,222,66,96,48,112,198,48,87,10,15,9,191,53,79,94,40,40,81,244,45,145,179,252,75,167,155,129,21,131,194,179,156,25,38,196,144,69,172,175,85,17,120,212,167,33,74,37,51,64,255,44,70,228,170,248,78,85,171,242,239,23,245,204,109,85,118,157,122,118,120,81,175,184,121,202,174,105,238,62,42,106,20,55,73,29,62,71,177,98,73,196,87,30,79,242,76,97,179,64,205,189,191,157,89,231,69,154,118,29,136,120,184,192,104,142,135,14,154,238,229,209,255,1,134,4,46,250,130,88,0,0,0};
+
+static const unsigned char v14[] = {47,47,32,32,78,79,84,69,58,32,65,80,73,32,99,97,108,108,115,32,109,117,115,116,32,115,116,97,114,116,32,119,105,116,104,32,39,97,112,105,47,39,32,105,110,32,111,114,100,101,114,32,116,111,32,115,101,114,118,101,32,116,104,101,32,97,112,112,32,97,116,32,97,110,121,32,85,82,73,10,10,39,117,115,101,32,115,116,114,105,99,116,39,59,10,105,109,112,111,114,116,32,123,32,104,44,32,114,101,110,100,101,114,44,32,117,115,101,83,116,97,116,101,44,32,117,115,101,69,102,102,101,99,116,44,32,117,115,101,82,101,102,44,32,104,116,109,108,44,32,82,111,117,116,101,114,32,125,32,102,114,111,109,32,32,39,46,47,98,117,110,100,108,101,46,98,98,55,49,56,54,56,99,46,106,115,39,59,10,105,109,112,111,114,116,32,123,32,73,99,111,110,115,44,32,76,111,103,105,110,44,32,83,101,116,116,105,110,103,44,32,66,117,116,116,111,110,44,32,83,116,97,116,44,32,116,105,112,67,111,108,111,114,115,44,32,67,111,108,111,114,101,100,44,32,78,111,116,105,102,105,99,97,116,105,111,110,44,32,80,97,103,105,110,97,116,105,111,110,44,32,85,112,108,111,97,100,70,105,108,101,66,117,116,116,111,110,44,32,84,101,120,116,86,97,108,117,101,32,125,32,102,114,111,109,32,39,46,47,99,111,109,112,111,110,101,110,116,115,46,54,48,55,52,50,51,50,50,46,106,115,39,59,10,10,99,111,110,115,116,32,76,111,103,111,32,61,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,49,50,46,56,55,32,49,50,46,56,53,34,62,60,100,101,102,115,62,60,115,116,121,108,101,62,46,108,108,45,99,108,115,45,49,123,102,105,108,108,58,110,111,110,101,59,115,116,114,111,107,101,58,35,48,48,48,59,115,116,114,111,107,101,45,109,105,116,101,114,108,105,109,105,116,58,49,48,59,115,116,114,111,107,101,45,119,105,100,116,104,58,48,46,53,112,120,59,125,60,47,115,116,121,108,101,62,60,47,100,101,102,115,62,60,103,32,105,100,61,34,76,97,121,101,114,95,50,34,32,100,97,116,97,45,110,97,109,101,61,34,76,97,121,101,114,32,50,34,62,60,103,32,105,100,61,34,76,97,121,101,114,95,49,45,50,34,32,100,97,116,97,45,110,97,109,101,61,34,76,97,121,101,114,32,49,34,62,60,112,97,116,104,32,99,108,97,115,115,61,34,108,108,45,99,108,115,45,49,34,32,100,61,34,77,49,50,46,54,50,44,49,46,56,50,86,56,46,57,49,65,49,46,53,56,44,49,46,53,56,44,48,44,48,44,49,44,49,49,44,49,48,46,52,56,72,52,97,49,46,52,52,44,49,46,52,52,44,48,44,48,44,49,45,49,45,46,51,55,65,46,54,57,46,54,57,44,48,44,48,44,49,44,50,46,56,52,44,49,48,108,45,46,49,45,46,49,50,97,46,56,49,46,56,49,44,48,44,48,44,49,45,46,49,53,45,46,52,56,86,53,46,53,55,97,46,56,55,46,56,55,44,48,44,48,44,49,44,46,56,54,45,46,56,54,72,52,46,55,51,86,55,46,50,56,97,46,56,54,46,56,54,44,48,44,48,44,48,44,46,56,54,46,56,53,72,57,46,52,50,97,46,56,53,46,56,53,44,48,44,48,44,48,44,46,56,53,45,46,56,53,86,51,46,52,53,65,46,56,54,46,56,54,44,48,44,48,44,48,44,49,48,46,49,51,44,51,44,46,55,54,46,55,54,44,48,44,48,44,48,44,49,48,44,50,46,56,52,97,46,50,57,46,50,57,44,48,44,48,44,48,45,46,49,50,45,46,49,44,49,46,52,57,44,49,46,52,57,44,48,44,48,44,48,45,49,45,46,51,55,72,50,46,51,57,86,49,46,56,50,65,49,46,53,55,44,49,46,53,55,44,48,44,48,44,49,44,52,44,46,50,53,72,49,49,65,49,46,53,55,44,49,46,53,55,44,48,44,48,44,49,44,49,50,46,54,50,44,49,46,56,50,90,34,47,62,60,112,97,116,104,32,99,108,97,115,115,61,34,108,108,45,99,108,115,45,49,34,32,100,61,34,77,49,48,46,52,56,44,49,48,46,52,56,86,49,49,65,49,46,53,56,44,49,46,53,56,44,48,44,48,44,49,44,56,46,57,44,49,50,46,54,72,49,46,56,50,65,49,46,53,55,44,49,46,53,55,44,48,44,48,44,49,44,46,50,53,44,49,49,86,51,46,57,52,65,49,46,53,55,44,49,46,53,55,44,48,44,48,44,49,44,49,46,56,50,44,50,46,51,55,72,56,46,57,97,49,46,52,57,44,49,46,52,57,44,48,44,48,44,49,44,49,44,46,51,55,108,46,49,50,46,49,97,46,55,54,46,55,54,44,48,44,48,44,49,44,46,49,49,46,49,52,46,56,54,46,56,54,44,48,44,48,44,49,44,46,49,52,46,52,55,86,55,46,50,56,97,46,56,53,46,56,53,44,48,44,48,44,49,45,46,56,53,46,56,53,72,56,46,49,51,86,53,46,53,55,97,46,56,54,46,56,54,44,48,44,48,44,48,45,46,56,53,45,46,56,54,72,51,46,52,53,97,46,56,55,46,56,55,44,48,44,48,44,48,45,46,56,54,46,56,54,86,57,46,52,97,46,56,49,46,56,49,44,48,44,48,44,48,44,46,49,53,46,52,56,108,46,49,46,49,50,97,46,54,57,46,54,57,44,48,44,48,44,48,44,46,49,51,46,49,49,44,49,46,52,52,44,49,46,52,52,44,48,44,48,44,48,44,49,44,46,51,55,90,34,47,62,60,47,103,62,60,47,103,62,60,47,115,118,103,62,96,59,10,10,102,117,110,99,116,105,111,110,32,72,101,97,100,101,114,40,123,108,111,103,111,117,116,44,32,117,115,101,114,44,32,115,101,116,83,104,111,119,83,105,100,101,98,97,114,44,32,115,104,111,119,83,105,100,101,98,97,114,125,41,32,123,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,115,116,105,99,107,121,32,116,111,112,45,48,32,122,45,91,52,56,93,32,120,119,45,102,117,108,108,32,98,111,114,100,101,114,45,98,32,112,121,45,50,32,36,123,115,104,111,119,83,105,100,101,98,97,114,32,38,38,32,39,112,108,45,55,50,39,125,32,116,114,97,110,115,105,116,105,111,110,45,97,108,108,32,100,117,114,97,116,105,111,110,45,51,48,48,32,116,114,97,110,115,102,111,114,109,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,120,45,50,32,119,45,102,117,108,108,32,112,121,45,48,32,109,121,45,48,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,34,62,10,32,32,32,32,60,98,117,116,116,111,110,32,116,121,112,101,61,34,98,117,116,116,111,110,34,32,111,110,99,108,105,99,107,61,36,123,101,118,32,61,62,32,115,101,116,83,104,111,119,83,105,100,101,98,97,114,40,118,32,61,62,32,33,118,41,125,32,99,108,97,115,115,61,34,116,101,120,116,45,115,108,97,116,101,45,52,48,48,34,62,10,32,32,32,32,32,32,60,36,123,73,99,111,110,115,46,98,97,114,115,51,125,32,99,108,97,115,115,61,34,104,45,54,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,102,108,101,120,45,49,32,103,97,112,45,120,45,52,32,115,101,108,102,45,115,116,114,101,116,99,104,32,108,103,58,103,97,112,45,120,45,54,34,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,114,101,108,97,116,105,118,101,32,102,108,101,120,32,102,108,101,120,45,49,34,62,60,47,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,120,45,52,32,108,103,58,103,97,112,45,120,45,54,34,62,10,32,32,32,32,32,32,32,32,60,115,112,97,110,32,99,108,97,115,115,61,34,116,101,120,116,45,115,109,32,116,101,120,116,45,115,108,97,116,101,45,52,48,48,34,62,108,111,103,103,101,100,32,105,110,32,97,115,58,32,36,123,117,115,101,114,125,60,47,47,62,10,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,104,105,100,100,101,110,32,108,103,58,98,108,111,99,107,32,108,103,58,104,45,52,32,108,103,58,119,45,112,120,32,108,103,58,98,103,45,103,114,97,121,45,50,48,48,34,32,97,114,105,97,45,104,105,100,100,101,110,61,34,116,114,117,101,34,62,60,47,47,62,10,32,32,32,32,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,76,111,103,111,117,116,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,108,111,103,111,117,116,125,32,111,110,99,108,105,99,107,61,36,123,108,111,103,111,117,116,125,32,47,62,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,83,105,100,101,98,97,114,40,123,117,114,108,44,32,115,104,111,119,125,41,32,123,10,32,32,99,111,110,115,116,32,78,97,118,76,105,110,107,32,61,32,40,123,116,105,116,108,101,44,32,105,99,111,110,44,32,104,114,101,102,44,32,117,114,108,125,41,32,61,62,32,104,116,109,108,96,10,32,32,60,100,105,118,62,10,32,32,32,32,60,97,32,104,114,101,102,61,34,35,36,123,104,114,101,102,125,34,32,99,108,97,115,115,61,34,36,123,104,114,101,102,32,61,61,32,117,114,108,32,63,32,39,98,103,45,115,108,97,116,101,45,53,48,32,116,101,120,116,45,98,108,117,101,45,54,48,48,32,103,114,111,117,112,39,32,58,32,39,116,101,120,116,45,103,114,97,121,45,55,48,48,32,104,111,118,101,114,58,116,101,120,116,45,98,108,117,101,45,54,48,48,32,104,111,118,101,114,58,98,103,45,103,114,97,121,45,53,48,32,103,114,111,117,112,39,125,32,102,108,101,120,32,103,97,112,45,120,45,51,32,114,111,117,110,100,101,100,45,109,100,32,112,45,50,32,116,101,120,116,45,115,109,32,108,101,97,100,105,110,103,45,54,32,102,111,110,116,45,115,101,109,105,98,111,108,100,34,62,10,32,32,32,32,32,32,60,36,123,105,99,111,110,125,32,99,108,97,115,115,61,34,119,45,54,32,104,45,54,34,47,62,10,32,32,32,32,32,32,36,123,116,105,116,108,101,125,10,32,32,32,32,60,47,47,47,62,10,32,32,60,47,47,62,96,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,118,105,111,108,101,116,45,49,48,48,32,104,115,45,111,118,101,114,108,97,121,32,104,115,45,111,118,101,114,108,97,121,45,111,112,101,110,58,116,114,97,110,115,108,97,116,101,45,120,45,48,10,32,32,32,32,32,32,32,32,32,32,32,32,45,116,114,97,110,115,108,97,116,101,45,120,45,102,117,108,108,32,116,114,97,110,115,105,116,105,111,110,45,97,108,108,32,100,117,114,97,116,105,111,110,45,51,48,48,32,116,114,97,110,115,102,111,114,109,10,32,32,32,32,32,32,32,32,32,32,32,32,102,105,120,101,100,32,116,111,112,45,48,32,108,101,102,116,45,48,32,98,111,116,116,111,109,45,48,32,122,45,91,54,48,93,32,119,45,55,50,32,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,45,114,10,32,32,32,32,32,32,32,32,32,32,32,32,98,111,114,100,101,114,45,103,114,97,121,45,50,48,48,32,111,118,101,114,102,108,111,119,45,121,45,97,117,116,111,32,115,99,114,111,108,108,98,97,114,45,121,10,32,32,32,32,32,32,32,32,32,32,32,32,36,123,115,104,111,119,32,38,38,32,39,116,114,97,110,115,108,97,116,101,45,120,45,48,39,125,32,114,105,103,104,116,45,97,117,116,111,32,98,111,116,116,111,109,45,48,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,102,108,101,120,45,99,111,108,32,109,45,52,32,103,97,112,45,121,45,54,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,104,45,49,48,32,115,104,114,105,110,107,45,48,32,105,116,101,109,115,45,99,101,110,116,101,114,32,103,97,112,45,120,45,52,32,102,111,110,116,45,98,111,108,100,32,116,101,120,116,45,120,108,32,116,101,120,116,45,115,108,97,116,101,45,53,48,48,34,62,10,32,32,32,32,32,32,60,36,123,76,111,103,111,125,32,99,108,97,115,115,61,34,104,45,102,117,108,108,34,47,62,32,89,111,117,114,32,66,114,97,110,100,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,102,108,101,120,45,49,32,102,108,101,120,45,99,111,108,34,62,10,32,32,32,32,32,32,60,36,123,78,97,118,76,105,110,107,125,32,116,105,116,108,101,61,34,68,97,115,104,98,111,97,114,100,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,104,111,109,101,125,32,104,114,101,102,61,34,47,34,32,117,114,108,61,36,123,117,114,108,125,32,47,62,10,32,32,32,32,32,32,60,36,123,78,97,118,76,105,110,107,125,32,116,105,116,108,101,61,34,83,101,116,116,105,110,103,115,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,99,111,103,125,32,104,114,101,102,61,34,47,115,101,116,116,105,110,103,115,34,32,117,114,108,61,36,123,117,114,108,125,32,47,62,10,32,32,32,32,32,32,60,36,123,78,97,118,76,105,110,107,125,32,116,105,116,108,101,61,34,87,105,70,105,32,67,111,110,102,105,103,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,119,105,102,105,125,32,104,114,101,102,61,34,47,119,105,102,105,34,32,117,114,108,61,36,123,117,114,108,125,32,47,62,10,32,32,32,32,32,32,60,36,123,78,97,118,76,105,110,107,125,32,116,105,116,108,101,61,34,70,105,114,109,119,97,114,101,32,85,112,100,97,116,101,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,100,111,119,110,108,111,97,100,125,32,104,114,101,102,61,34,47,117,112,100,97,116,101,34,32,117,114,108,61,36,123,117,114,108,125,32,47,62,10,32,32,32,32,32,32,60,36,123,78,97,118,76,105,110,107,125,32,116,105,116,108,101,61,34,69,118,101,110,116,115,34,32,105,99,111,110,61,36,123,73,99,111,110,115,46,97,108,101,114,116,125,32,104,114,101,102,61,34,47,101,118,101,110,116,115,34,32,117,114,108,61,36,123,117,114,108,125,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,69,118,101,110,116,115,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,101,118,101,110,116,115,44,32,115,101,116,69,118,101,110,116,115,93,32,61,32,117,115,101,83,116,97,116,101,40,91,93,41,59,10,32,32,99,111,110,115,116,32,91,112,97,103,101,44,32,115,101,116,80,97,103,101,93,32,61,32,117,115,101,83,116,97,116,101,40,49,41,59,10,10,32,32,99,111,110,115,116,32,114,101,102,114,101,115,104,32,61,32,40,41,32,61,62,10,32,32,32,32,102,101,116,99,104,40,39,97,112,105,47,101,118,101,110,116,115,47,103,101,116,39,44,32,123,10,32,32,32,32,32,32,32,32,109,101,116,104,111,100,58,32,39,80,79,83,84,39,44,32,98,111,100,121,58,32,74,83,79,78,46,115,116,114,105,110,103,105,102,121,40,123,112,97,103,101,58,32,112,97,103,101,125,41,44,10,32,32,32,32,32,32,125,41,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,115,101,116,69,118,101,110,116,115,40,114,41,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,114,101,102,114,101,115,104,44,32,91,112,97,103,101,93,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,10,32,32,32,32,115,101,116,80,97,103,101,40,74,83,79,78,46,112,97,114,115,101,40,108,111,99,97,108,83,116,111,114,97,103,101,46,103,101,116,73,116,101,109,40,39,112,97,103,101,39,41,41,41,59,10,32,32,32,32,32,32,125,44,32,91,93,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,10,32,32,32,32,108,111,99,97,108,83,116,111,114,97,103,101,46,115,101,116,73,116,101,109,40,39,112,97,103,101,39,44,32,112,97,103,101,46,116,111,83,116,114,105,110,103,40,41,41,59,10,32,32,125,44,32,91,112,97,103,101,93,41,59,10,10,32,32,99,111,110,115,116,32,84,104,32,61,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,116,104,32,115,99,111,112,101,61,34,99,111,108,34,32,99,108,97,115,115,61,34,115,116,105,99,107,121,32,116,111,112,45,48,32,122,45,49,48,32,98,111,114,100,101,114,45,98,32,98,111,114,100,101,114,45,115,108,97,116,101,45,51,48,48,32,98,103,45,119,104,105,116,101,32,98,103,45,111,112,97,99,105,116,121,45,55,53,32,112,121,45,49,46,53,32,112,120,45,52,32,116,101,120,116,45,108,101,102,116,32,116,101,120,116,45,115,109,32,102,111,110,116,45,115,101,109,105,98,111,108,100,32,116,101,120,116,45,115,108,97,116,101,45,57,48,48,32,98,97,99,107,100,114,111,112,45,98,108,117,114,32,98,97,99,107,100,114,111,112,45,102,105,108,116,101,114,34,62,36,123,112,114,111,112,115,46,116,105,116,108,101,125,60,47,116,104,62,96,59,10,32,32,99,111,110,115,116,32,84,100,32,61,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,116,100,32,99,108,97,115,115,61,34,119,104,105,116,101,115,112,97,99,101,45,110,111,119,114,97,112,32,98,111,114,100,101,114,45,98,32,98,111,114,100,101,114,45,115,108,97,116,101,45,50,48,48,32,112,121,45,50,32,112,120,45,52,32,112,114,45,51,32,116,101,120,116,45,115,109,32,116,101,120,116,45,115,108,97,116,101,45,57,48,48,34,62,36,123,112,114,111,112,115,46,116,101,120,116,125,60,47,116,100,62,96,59,10,32,32,99,111,110,115,116,32,80,114,105,111,32,61,32,40,123,112,114,105,111,125,41,32,61,62,32,123,10,32,32,32,32,99,111,110,115,116,32,116,101,120,116,32,61,32,91,39,104,105,103,104,39,44,32,39,109,101,100,105,117,109,39,44,32,39,108,111,119,39,93,91,112,114,105,111,93,59,10,32,32,32,32,99,111,110,115,116,32,99,111,108,111,114,115,32,61,32,91,116,105,112,67,111,108,111,114,115,46,114,101,100,44,32,116,105,112,67,111,108,111,114,115,46,121,101,108,108,111,119,44,32,116,105,112,67,111,108,111,114,115,46,103,114,101,101,110,93,91,112,114,105,111,93,59,10,32,32,32,32,114,101,116,117,114,110,32,104,116,109,108,96,60,36,123,67,111,108,111,114,101,100,125,32,99,111,108,111,114,115,61,36,123,99,111,108,111,114,115,125,32,116,101,120,116,61,36,123,116,101,120,116,125,32,47,62,96,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,69,118,101,110,116,32,61,32,40,123,101,125,41,32,61,62,32,104,116,109,108,96,10,60,116,114,62,10,32,32,60,36,123,84,100,125,32,116,101,120,116,61,36,123,91,39,112,111,119,101,114,39,44,32,39,104,97,114,100,119,97,114,101,39,44,32,39,116,105,101,114,51,39,44,32,39,116,105,101,114,52,39,93,91,101,46,116,121,112,101,93,125,32,47,62,10,32,32,60,36,123,84,100,125,32,116,101,120,116,61,36,123,104,116,109,108,96,60,36,123,80,114,105,111,125,32,112,114,105,111,61,36,123,101,46,112,114,105,111,125,47,62,96,125,32,47,62,10,32,32,60,36,123,84,100,125,32,116,101,120,116,61,36,123,101,46,116,105,109,101,32,63,32,40,110,101,119,32,68,97,116,101,40,101,46,116,105,109,101,32,42,32,49,48,48,48,41,41,46,116,111,76,111,99,97,108,101,83,116,114,105,110,103,40,41,32,58,32,39,49,57,55,48,45,48,49,45,48,49,39,125,32,47,62,10,32,32,60,36,123,84,100,125,32,116,101,120,116,61,36,123,101,46,116,101,120,116,125,32,47,62,10,60,47,47,62,96,59,10,10,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,45,52,32,100,105,118,105,100,101,45,121,32,100,105,118,105,100,101,45,103,114,97,121,45,50,48,48,32,111,118,101,114,102,108,111,119,45,97,117,116,111,32,114,111,117,110,100,101,100,32,98,103,45,119,104,105,116,101,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,51,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,32,119,104,105,116,101,115,112,97,99,101,45,110,111,119,114,97,112,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,34,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,114,45,52,34,62,69,86,69,78,84,32,76,79,71,60,47,100,105,118,62,10,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,60,36,123,80,97,103,105,110,97,116,105,111,110,125,32,99,117,114,114,101,110,116,80,97,103,101,61,36,123,112,97,103,101,125,32,115,101,116,80,97,103,101,70,110,61,36,123,115,101,116,80,97,103,101,125,32,116,111,116,97,108,73,116,101,109,115,61,52,48,48,32,105,116,101,109,115,80,101,114,80,97,103,101,61,50,48,32,47,62,10,32,32,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,105,110,108,105,110,101,45,98,108,111,99,107,32,109,105,110,45,119,45,102,117,108,108,32,97,108,105,103,110,45,109,105,100,100,108,101,34,32,115,116,121,108,101,61,34,109,97,120,45,104,101,105,103,104,116,58,32,56,50,118,104,59,32,111,118,101,114,102,108,111,119,58,32,97,117,116,111,59,34,62,10,32,32,32,32,60,116,97,98,108,101,32,99,108,97,115,115,61,34,109,105,110,45,119,45,102,117,108,108,32,98,111,114,100,101,114,45,115,101,112,97,114,97,116,101,32,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,48,34,62,10,32,32,32,32,32,32,60,116,104,101,97,100,62,10,32,32,32,32,32,32,32,32,60,116,114,62,10,32,32,32,32,32,32,32,32,32,32,60,36,123,84,104,125,32,116,105,116,108,101,61,34,84,121,112,101,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,60,36,123,84,104,125,32,116,105,116,108,101,61,34,80,114,105,111,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,60,36,123,84,104,125,32,116,105,116,108,101,61,34,84,105,109,101,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,60,36,123,84,104,125,32,116,105,116,108,101,61,34,68,101,115,99,114,105,112,116,105,111,110,34,32,47,62,10,32,32,32,32,32,32,32,32,60,47,116,114,62,10,32,32,32,32,32,32,60,47,116,104,101,97,100,62,10,32,32,32,32,32,32,60,116,98,111,100,121,62,10,32,32,32,32,32,32,32,32,36,123,40,101,118,101,110,116,115,46,97,114,114,32,63,32,101,118,101,110,116,115,46,97,114,114,32,58,32,91,93,41,46,109,97,112,40,101,32,61,62,32,104,40,69,118,101,110,116,44,32,123,101,125,41,41,125,10,32,32,32,32,32,32,60,47,116,98,111,100,121,62,10,32,32,32,32,60,47,116,97,98,108,101,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,67,104,97,114,116,40,123,100,97,116,97,125,41,32,123,10,32,32,99,111,110,115,116,32,110,32,61,32,100,97,116,97,46,108,101,110,103,116,104,32,47,42,32,101,110,116,114,105,101,115,32,42,47,44,32,119,32,61,32,50,48,32,47,42,32,101,110,116,114,121,32,119,105,100,116,104,32,42,47,44,32,108,115,32,61,32,49,53,47,42,32,108,101,102,116,32,115,112,97,99,101,32,42,47,59,10,32,32,99,111,110,115,116,32,104,32,61,32,49,48,48,32,47,42,32,103,114,97,112,104,32,104,101,105,103,104,116,32,42,47,44,32,121,116,105,99,107,115,32,61,32,53,32,47,42,32,89,32,97,120,105,115,32,116,105,99,107,115,32,42,47,44,32,98,115,32,61,32,49,48,32,47,42,32,98,111,116,116,111,109,32,115,112,97,99,101,32,42,47,59,10,32,32,99,111,110,115,116,32,121,109,97,120,32,61,32,50,53,59,10,32,32,99,111,110,115,116,32,121,116,32,61,32,105,32,61,62,32,40,104,32,45,32,98,115,41,32,47,32,121,116,105,99,107,115,32,42,32,40,105,32,43,32,49,41,59,10,32,32,99,111,110,115,116,32,98,104,32,61,32,112,32,61,62,32,40,104,32,45,32,98,115,41,32,42,32,112,32,47,32,49,48,48,59,32,47,47,32,66,97,114,32,104,101,105,103,104,116,10,32,32,99,111,110,115,116,32,98,121,32,61,32,112,32,61,62,32,40,104,32,45,32,98,115,41,32,45,32,98,104,40,112,41,59,10,32,32,99,111,110,115,116,32,114,97,110,103,101,32,61,32,40,115,116,97,114,116,44,32,115,105,122,101,44,32,115,116,101,112,41,32,61,62,32,65,114,114,97,121,46,102,114,111,109,40,123,108,101,110,103,116,104,58,32,115,105,122,101,125,44,32,40,95,44,32,105,41,32,61,62,32,105,32,42,32,40,115,116,101,112,32,124,124,32,49,41,32,43,32,115,116,97,114,116,41,59,10,32,32,47,47,32,99,111,110,115,111,108,101,46,108,111,103,40,100,115,41,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,52,32,100,105,118,105,100,101,45,121,32,100,105,118,105,100,101,45,103,114,97,121,45,50,48,48,32,111,118,101,114,102,108,111,119,45,97,117,116,111,32,114,111,117,110,100,101,100,32,98,103,45,119,104,105,116,101,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,108,105,103,104,116,32,117,112,112,101,114,99,97,115,101,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,52,32,112,121,45,50,34,62,10,32,32,84,101,109,112,101,114,97,116,117,114,101,44,32,108,97,115,116,32,50,52,104,10,32,32,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,114,101,108,97,116,105,118,101,34,62,10,32,32,32,32,60,115,118,103,32,99,108,97,115,115,61,34,98,103,45,121,101,108,108,111,119,45,120,53,48,32,119,45,102,117,108,108,32,112,45,52,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,36,123,110,42,119,43,108,115,125,32,36,123,104,125,34,62,10,32,32,32,32,32,32,36,123,114,97,110,103,101,40,48,44,32,121,116,105,99,107,115,41,46,109,97,112,40,105,32,61,62,32,104,116,109,108,96,10,32,32,32,32,32,32,32,32,60,108,105,110,101,32,120,49,61,48,32,121,49,61,36,123,121,116,40,105,41,125,32,120,50,61,36,123,108,115,43,110,42,119,125,32,121,50,61,36,123,121,116,40,105,41,125,32,115,116,114,111,107,101,45,119,105,100,116,104,61,48,46,51,32,99,108,97,115,115,61,34,115,116,114,111,107,101,45,115,108,97,116,101,45,51,48,48,34,32,115,116,114,111,107,101,45,100,97,115,104,97,114,114,97,121,61,34,49,44,49,34,32,47,62,10,32,32,32,32,32,32,32,32,60,116,101,120,116,32,120,61,48,32,121,61,36,123,121,116,40,105,41,45,50,125,32,99,108,97,115,115,61,34,116,101,120,116,45,91,54,112,120,93,32,102,105,108,108,45,115,108,97,116,101,45,52,48,48,34,62,36,123,121,109,97,120,45,121,109,97,120,47,121,116,105,99,107,115,42,40,105,43,49,41,125,60,47,47,62,10,32,32,32,32,32,32,96,41,125,10,32,32,32,32,32,32,36,123,114,97,110,103,101,40,48,44,32,110,41,46,109,97,112,40,120,32,61,62,32,104,116,109,108,96,10,32,32,32,32,32,32,32,32,60,114,101,99,116,32,120,61,36,123,108,115,43,120,42,119,125,32,121,61,36,123,98,121,40,100,97,116,97,91,120,93,42,49,48,48,47,121,109,97,120,41,125,32,119,105,100,116,104,61,49,50,32,104,101,105,103,104,116,61,36,123,98,104,40,100,97,116,97,91,120,93,42,49,48,48,47,121,109,97,120,41,125,32,114,120,61,50,32,99,108,97,115,115,61,34,102,105,108,108,45,99,121,97,110,45,53,48,48,34,32,47,62,10,32,32,32,32,32,32,32,32,60,116,101,120,116,32,120,61,36,123,108,115,43,120,42,119,125,32,121,61,49,48,48,32,99,108,97,115,115,61,34,116,101,120,116,45,91,54,112,120,93,32,102,105,108,108,45,115,108,97,116,101,45,52,48,48,34,62,36,123,120,42,50,125,58,48,48,60,47,47,62,10,32,32,32,32,32,32,96,41,125,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,68,101,118,101,108,111,112,101,114,78,111,116,101,40,123,116,101,120,116,44,32,99,104,105,108,100,114,101,110,125,41,32,123,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,112,45,52,32,103,97,112,45,50,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,116,101,120,116,45,115,109,32,116,101,120,116,45,115,108,97,116,101,45,53,48,48,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,34,62,10,32,32,32,32,32,32,60,36,123,73,99,111,110,115,46,105,110,102,111,125,32,99,108,97,115,115,61,34,115,101,108,102,45,115,116,97,114,116,32,98,97,115,105,115,45,91,51,48,112,120,93,32,103,114,111,119,45,48,32,115,104,114,105,110,107,45,48,32,116,101,120,116,45,103,114,101,101,110,45,54,48,48,32,109,114,45,50,34,32,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,34,62,68,101,118,101,108,111,112,101,114,32,78,111,116,101,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,36,123,40,116,101,120,116,32,124,124,32,39,39,41,46,115,112,108,105,116,40,39,46,39,41,46,109,97,112,40,118,32,61,62,32,104,116,109,108,96,32,60,112,32,99,108,97,115,115,61,34,109,121,45,50,32,34,62,36,123,118,125,60,47,47,62,96,41,125,10,32,32,32,32,36,123,99,104,105,108,100,114,101,110,125,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,77,97,105,110,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,100,105,103,115,44,32,115,101,116,68,105,103,115,93,32,61,32,117,115,101,83,116,97,116,101,40,102,97,108,115,101,41,59,10,32,32,99,111,110,115,116,32,91,115,116,97,116,115,44,32,115,101,116,83,116,97,116,115,93,32,61,32,117,115,101,83,116,97,116,101,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,91,114,103,98,44,32,115,101,116,82,103,98,93,32,61,32,117,115,101,83,116,97,116,101,40,123,114,101,100,58,32,48,44,32,103,114,101,101,110,58,32,48,44,32,98,108,117,101,58,32,48,125,41,59,10,32,32,99,111,110,115,116,32,91,108,101,100,44,32,115,101,116,76,101,100,93,32,61,32,117,115,101,83,116,97,116,101,40,102,97,108,115,101,41,59,10,32,32,99,111,110,115,116,32,114,101,102,114,101,115,104,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,114,101,115,116,47,115,121,115,47,115,116,97,116,115,39,41,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,46,116,104,101,110,40,114,32,61,62,32,115,101,116,83,116,97,116,115,40,114,41,41,59,10,32,32,99,111,110,115,116,32,108,101,100,102,101,116,99,104,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,114,101,115,116,47,115,121,115,47,108,101,100,39,44,32,123,10,32,32,32,32,109,101,116,104,111,100,58,32,39,112,111,115,116,39,44,32,98,111,100,121,58,32,74,83,79,78,46,115,116,114,105,110,103,105,102,121,40,123,32,115,116,97,116,101,58,32,108,101,100,32,63,32,49,32,58,32,48,44,32,114,101,100,58,32,114,103,98,46,114,101,100,44,32,103,114,101,101,110,58,32,114,103,98,46,103,114,101,101,110,44,32,98,108,117,101,58,32,114,103,98,46,98,108,117,101,32,125,41,32,10,32,32,125,41,59,10,32,32,99,111,110,115,116,32,100,105,103,102,101,116,99,104,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,114,101,115,116,47,115,121,115,47,100,105,103,115,39,44,32,123,109,101,116,104,111,100,58,32,39,112,111,115,116,39,44,32,98,111,100,121,58,32,74,83,79,78,46,115,116,114,105,110,103,105,102,121,40,123,32,115,116,97,116,101,58,32,100,105,103,115,32,63,32,49,32,58,32,48,125,41,125,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,10,32,32,32,32,108,101,100,102,101,116,99,104,40,41,59,10,32,32,125,44,32,91,108,101,100,44,32,114,103,98,46,114,101,100,44,32,114,103,98,46,103,114,101,101,110,44,32,114,103,98,46,98,108,117,101,93,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,100,105,103,102,101,116,99,104,44,32,91,100,105,103,115,93,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,114,101,102,114,101,115,104,44,32,91,93,41,59,10,32,32,105,102,32,40,33,115,116,97,116,115,41,32,114,101,116,117,114,110,32,39,39,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,112,45,50,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,45,52,32,115,109,58,112,45,50,32,109,120,45,97,117,116,111,32,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,50,32,108,103,58,103,114,105,100,45,99,111,108,115,45,52,32,103,97,112,45,52,34,62,10,32,32,32,32,60,36,123,83,116,97,116,125,32,116,105,116,108,101,61,34,84,101,109,112,101,114,97,116,117,114,101,34,32,116,101,120,116,61,34,36,123,115,116,97,116,115,46,116,101,109,112,101,114,97,116,117,114,101,125,32,194,176,67,34,32,116,105,112,84,101,120,116,61,34,103,111,111,100,34,32,116,105,112,73,99,111,110,61,36,123,73,99,111,110,115,46,111,107,125,32,116,105,112,67,111,108,111,114,115,61,36,123,116,105,112,67,111,108,111,114,115,46,103,114,101,101,110,125,32,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,45,109,100,32,115,104,97,100,111,119,45,108,103,32,112,45,52,34,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,82,71,66,32,76,69,68,34,32,118,97,108,117,101,61,36,123,108,101,100,125,32,115,101,116,102,110,61,36,123,115,101,116,76,101,100,125,32,116,121,112,101,61,34,115,119,105,116,99,104,34,32,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,116,45,52,32,115,112,97,99,101,45,121,45,50,34,62,10,32,32,32,32,32,32,32,32,60,36,123,84,101,120,116,86,97,108,117,101,125,32,118,97,108,117,101,61,36,123,114,103,98,46,114,101,100,125,32,115,101,116,102,110,61,36,123,118,32,61,62,32,115,101,116,82,103,98,40,112,114,101,118,32,61,62,32,40,123,46,46,46,112,114,101,118,44,32,114,101,100,58,32,112,97,114,115,101,73,110,116,40,118,41,32,124,124,32,48,125,41,41,125,32,116,121,112,101,61,34,110,117,109,98,101,114,34,32,109,105,110,61,34,48,34,32,109,97,120,61,34,50,53,53,34,32,112,108,97,99,101,104,111,108,100,101,114,61,34,82,101,100,32,40,48,45,50,53,53,41,34,32,47,62,10,32,32,32,32,32,32,32,32,60,36,123,84,101,120,116,86,97,108,117,101,125,32,118,97,108,117,101,61,36,123,114,103,98,46,103,114,101,101,110,125,32,115,101,116,102,110,61,36,123,118,32,61,62,32,115,101,116,82,103,98,40,112,114,101,118,32,61,62,32,40,123,46,46,46,112,114,101,118,44,32,103,114,101,101,110,58,32,112,97,114,115,101,73,110,116,40,118,41,32,124,124,32,48,125,41,41,125,32,116,121,112,101,61,34,110,117,109,98,101,114,34,32,109,105,110,61,34,48,34,32,109,97,120,61,34,50,53,53,34,32,112,108,97,99,101,104,111,108,100,101,114,61,34,71,114,101,101,110,32,40,48,45,50,53,53,41,34,32,47,62,10,32,32,32,32,32,32,32,32,60,36,123,84,101,120,116,86,97,108,117,101,125,32,118,97,108,117,101,61,36,123,114,103,98,46,98,108,117,101,125,32,115,101,116,102,110,61,36,123,118,32,61,62,32,115,101,116,82,103,98,40,112,114,101,118,32,61,62,32,40,123,46,46,46,112,114,101,118,44,32,98,108,117,101,58,32,112,97,114,115,101,73,110,116,40,118,41,32,124,124,32,48,125,41,41,125,32,116,121,112,101,61,34,110,117,109,98,101,114,34,32,109,105,110,61,34,48,34,32,109,97,120,61,34,50,53,53,34,32,112,108,97,99,101,104,111,108,100,101,114,61,34,66,108,117,101,32,40,48,45,50,53,53,41,34,32,47,62,10,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,45,109,100,32,115,104,97,100,111,119,45,108,103,32,112,45,52,34,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,68,105,103,105,116,32,116,105,109,101,34,32,118,97,108,117,101,61,36,123,100,105,103,115,125,32,115,101,116,102,110,61,36,123,115,101,116,68,105,103,115,125,32,116,121,112,101,61,34,115,119,105,116,99,104,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,99,111,108,45,115,112,97,110,45,50,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,45,109,100,32,115,104,97,100,111,119,45,108,103,34,32,114,111,108,101,61,34,97,108,101,114,116,34,62,10,32,32,32,32,32,32,60,36,123,68,101,118,101,108,111,112,101,114,78,111,116,101,125,32,116,101,120,116,61,34,83,116,97,116,115,32,100,97,116,97,32,105,115,32,114,101,99,101,105,118,101,100,32,102,114,111,109,32,116,104,101,32,77,111,110,103,111,111,115,101,32,98,97,99,107,101,110,100,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,45,52,32,115,109,58,112,45,50,32,109,120,45,97,117,116,111,32,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,49,32,108,103,58,103,114,105,100,45,99,111,108,115,45,50,32,103,97,112,45,52,34,62,10,32,32,32,32,60,33,45,45,36,123,67,104,97,114,116,125,32,100,97,116,97,61,36,123,115,116,97,116,115,46,112,111,105,110,116,115,125,32,47,45,45,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,52,32,104,120,45,50,52,32,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,45,109,100,32,115,104,97,100,111,119,45,108,103,34,32,114,111,108,101,61,34,97,108,101,114,116,34,62,10,32,32,32,32,32,32,60,36,123,68,101,118,101,108,111,112,101,114,78,111,116,101,125,10,32,32,32,32,32,32,32,32,116,101,120,116,61,34,84,104,105,115,32,99,104,97,114,116,32,105,115,32,97,110,32,83,86,71,32,105,109,97,103,101,44,32,103,101,110,101,114,97,116,101,100,32,111,110,32,116,104,101,32,102,108,121,32,102,114,111,109,32,116,104,101,10,32,32,32,32,32,32,32,32,100,97,116,97,32,114,101,116,117,114,110,101,100,32,98,121,32,116,104,101,32,97,112,105,47,115,116,97,116,115,47,103,101,116,32,65,80,73,32,99,97,108,108,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,70,105,114,109,119,97,114,101,83,116,97,116,117,115,40,123,116,105,116,108,101,44,32,105,110,102,111,44,32,99,104,105,108,100,114,101,110,125,41,32,123,10,32,32,99,111,110,115,116,32,115,116,97,116,101,32,61,32,91,39,85,78,65,86,65,73,76,65,66,76,69,39,44,32,39,70,73,82,83,84,95,66,79,79,84,39,44,32,39,78,79,84,95,67,79,77,77,73,84,84,69,68,39,44,32,39,67,79,77,77,73,84,84,69,68,39,93,91,40,105,110,102,111,46,115,116,97,116,117,115,32,124,124,32,48,41,32,37,32,52,93,59,10,32,32,99,111,110,115,116,32,118,97,108,105,100,32,61,32,105,110,102,111,46,115,116,97,116,117,115,32,62,32,48,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,112,121,45,49,32,100,105,118,105,100,101,45,121,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,108,105,103,104,116,32,117,112,112,101,114,99,97,115,101,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,52,32,112,121,45,50,34,62,10,32,32,32,32,36,123,116,105,116,108,101,125,10,32,32,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,120,45,52,32,112,121,45,50,32,114,101,108,97,116,105,118,101,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,49,34,62,83,116,97,116,117,115,58,32,36,123,115,116,97,116,101,125,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,49,34,62,67,82,67,51,50,58,32,36,123,118,97,108,105,100,32,63,32,105,110,102,111,46,99,114,99,51,50,46,116,111,83,116,114,105,110,103,40,49,54,41,32,58,32,39,110,47,97,39,125,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,49,34,62,83,105,122,101,58,32,36,123,118,97,108,105,100,32,63,32,105,110,102,111,46,115,105,122,101,32,58,32,39,110,47,97,39,125,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,49,34,62,70,108,97,115,104,101,100,32,97,116,58,32,36,123,118,97,108,105,100,32,63,32,110,101,119,32,68,97,116,101,40,105,110,102,111,46,116,105,109,101,115,116,97,109,112,32,42,32,49,48,48,48,41,46,116,111,76,111,99,97,108,101,83,116,114,105,110,103,40,41,32,58,32,39,110,47,97,39,125,60,47,47,62,10,32,32,32,32,36,123,99,104,105,108,100,114,101,110,125,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,10,102,117,110,99,116,105,111,110,32,70,105,114,109,119,97,114,101,85,112,100,97,116,101,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,105,110,102,111,44,32,115,101,116,73,110,102,111,93,32,61,32,117,115,101,83,116,97,116,101,40,91,123,125,44,32,123,125,93,41,59,10,32,32,99,111,110,115,116,32,114,101,102,114,101,115,104,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,102,105,114,109,119,97,114,101,47,115,116,97,116,117,115,39,41,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,46,116,104,101,110,40,114,32,61,62,32,115,101,116,73,110,102,111,40,114,41,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,114,101,102,114,101,115,104,44,32,91,93,41,59,10,32,32,99,111,110,115,116,32,111,110,99,111,109,109,105,116,32,61,32,101,118,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,102,105,114,109,119,97,114,101,47,99,111,109,109,105,116,39,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,46,116,104,101,110,40,114,101,102,114,101,115,104,41,59,10,32,32,99,111,110,115,116,32,111,110,114,101,98,111,111,116,32,61,32,101,118,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,100,101,118,105,99,101,47,114,101,115,101,116,39,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,110,101,119,32,80,114,111,109,105,115,101,40,114,32,61,62,32,115,101,116,84,105,109,101,111,117,116,40,101,118,32,61,62,32,123,32,114,101,102,114,101,115,104,40,41,59,32,114,40,41,59,32,125,44,32,51,48,48,48,41,41,41,59,10,32,32,99,111,110,115,116,32,111,110,114,111,108,108,98,97,99,107,32,61,32,101,118,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,102,105,114,109,119,97,114,101,47,114,111,108,108,98,97,99,107,39,41,10,32,32,32,32,46,116,104,101,110,40,111,110,114,101,98,111,111,116,41,59,10,32,32,99,111,110,115,116,32,111,110,101,114,97,115,101,32,61,32,101,118,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,100,101,118,105,99,101,47,101,114,97,115,101,108,97,115,116,39,41,46,116,104,101,110,40,114,101,102,114,101,115,104,41,59,10,32,32,99,111,110,115,116,32,111,110,117,112,108,111,97,100,32,61,32,102,117,110,99,116,105,111,110,40,111,107,44,32,110,97,109,101,44,32,115,105,122,101,41,32,123,10,32,32,32,32,105,102,32,40,33,111,107,41,32,114,101,116,117,114,110,32,102,97,108,115,101,59,10,32,32,32,32,114,101,116,117,114,110,32,110,101,119,32,80,114,111,109,105,115,101,40,114,32,61,62,32,115,101,116,84,105,109,101,111,117,116,40,101,118,32,61,62,32,123,32,114,101,102,114,101,115,104,40,41,59,32,114,40,41,59,32,125,44,32,51,48,48,48,41,41,59,10,32,32,125,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,45,52,32,103,97,112,45,52,32,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,49,32,108,103,58,103,114,105,100,45,99,111,108,115,45,51,34,62,10,32,32,60,36,123,70,105,114,109,119,97,114,101,83,116,97,116,117,115,125,32,116,105,116,108,101,61,34,67,117,114,114,101,110,116,32,102,105,114,109,119,97,114,101,32,105,109,97,103,101,34,32,105,110,102,111,61,36,123,105,110,102,111,91,48,93,125,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,102,108,101,120,45,119,114,97,112,32,103,97,112,45,50,34,62,10,32,32,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,67,111,109,109,105,116,32,116,104,105,115,32,102,105,114,109,119,97,114,101,34,32,111,110,99,108,105,99,107,61,36,123,111,110,99,111,109,109,105,116,125,10,32,32,32,32,32,32,32,32,105,99,111,110,61,36,123,73,99,111,110,115,46,116,104,117,109,98,85,112,125,32,100,105,115,97,98,108,101,100,61,36,123,105,110,102,111,91,48,93,46,115,116,97,116,117,115,32,61,61,32,51,125,32,99,108,115,61,34,119,45,102,117,108,108,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,32,32,60,36,123,70,105,114,109,119,97,114,101,83,116,97,116,117,115,125,32,116,105,116,108,101,61,34,80,114,101,118,105,111,117,115,32,102,105,114,109,119,97,114,101,32,105,109,97,103,101,34,32,105,110,102,111,61,36,123,105,110,102,111,91,49,93,125,62,10,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,82,111,108,108,98,97,99,107,32,116,111,32,116,104,105,115,32,102,105,114,109,119,97,114,101,34,32,111,110,99,108,105,99,107,61,36,123,111,110,114,111,108,108,98,97,99,107,125,10,32,32,32,32,32,32,105,99,111,110,61,36,123,73,99,111,110,115,46,98,97,99,107,119,97,114,100,125,32,100,105,115,97,98,108,101,100,61,36,123,105,110,102,111,91,49,93,46,115,116,97,116,117,115,32,61,61,32,48,125,32,99,108,115,61,34,119,45,102,117,108,108,34,32,47,62,10,32,32,60,47,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,120,109,45,52,32,100,105,118,105,100,101,45,121,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,32,102,108,101,120,32,102,108,101,120,45,99,111,108,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,108,105,103,104,116,32,117,112,112,101,114,99,97,115,101,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,52,32,112,121,45,50,34,62,10,32,32,32,32,32,32,68,101,118,105,99,101,32,99,111,110,116,114,111,108,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,120,45,52,32,112,121,45,51,32,102,108,101,120,32,102,108,101,120,45,99,111,108,32,103,97,112,45,50,32,103,114,111,119,34,62,10,32,32,32,32,32,32,60,36,123,85,112,108,111,97,100,70,105,108,101,66,117,116,116,111,110,125,10,32,32,32,32,32,32,32,32,116,105,116,108,101,61,34,85,112,108,111,97,100,32,110,101,119,32,102,105,114,109,119,97,114,101,32,46,98,105,110,32,102,105,108,101,34,32,111,110,117,112,108,111,97,100,61,36,123,111,110,117,112,108,111,97,100,125,10,32,32,32,32,32,32,117,114,108,61,34,97,112,105,47,102,105,114,109,119,97,114,101,47,117,112,108,111,97,100,34,32,97,99,99,101,112,116,61,34,46,98,105,110,44,46,117,102,50,34,32,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,103,114,111,119,34,62,60,47,47,62,10,32,32,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,82,101,98,111,111,116,32,100,101,118,105,99,101,34,32,111,110,99,108,105,99,107,61,36,123,111,110,114,101,98,111,111,116,125,32,105,99,111,110,61,36,123,73,99,111,110,115,46,114,101,102,114,101,115,104,125,32,99,108,115,61,34,119,45,102,117,108,108,34,32,47,62,10,32,32,32,32,32,32,60,36,123,66,117,116,116,111,110,125,32,116,105,116,108,101,61,34,69,114,97,115,101,32,108,97,115,116,32,115,101,99,116,111,114,34,32,111,110,99,108,105,99,107,61,36,123,111,110,101,114,97,115,101,125,32,105,99,111,110,61,36,123,73,99,111,110,115,46,100,111,99,125,32,99,108,115,61,34,119,45,102,117,108,108,32,104,105,100,100,101,110,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,10,10,10,60,100,105,118,32,99,108,97,115,115,61,34,109,45,52,32,103,97,112,45,52,32,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,49,32,108,103,58,103,114,105,100,45,99,111,108,115,45,50,34,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,115,104,97,100,111,119,45,108,103,34,62,10,32,32,32,32,60,36,123,68,101,118,101,108,111,112,101,114,78,111,116,101,125,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,50,34,62,10,32,32,32,32,32,32,32,32,70,105,114,109,119,97,114,101,32,115,116,97,116,117,115,32,97,110,100,32,111,116,104,101,114,32,105,110,102,111,114,109,97,116,105,111,110,32,105,115,32,115,116,111,114,101,100,32,105,110,32,116,104,101,32,108,97,115,116,32,115,101,99,116,111,114,10,32,32,32,32,32,32,32,32,111,102,32,102,108,97,115,104,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,50,34,62,10,32,32,32,32,32,32,32,32,70,105,114,109,119,97,114,101,32,115,116,97,116,117,115,32,99,97,110,32,98,101,32,70,73,82,83,84,95,66,79,79,84,44,32,85,78,67,79,77,77,73,84,84,69,68,32,111,114,32,67,79,77,77,73,84,84,69,68,46,32,73,102,32,110,111,10,32,32,32,32,32,32,32,32,105,110,102,111,114,109,97,116,105,111,110,32,105,115,32,97,118,97,105,108,97,98,108,101,44,32,105,116,32,105,115,32,85,78,65,86,65,73,76,65,66,76,69,46,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,50,34,62,32,32,10,32,32,32,32,32,32,32,32,84,104,105,115,32,71,85,73,32,108,111,97,100,115,32,97,32,102,105,114,109,119,97,114,101,32,102,105,108,101,32,97,110,100,32,115,101,110,100,115,32,105,116,32,99,104,117,110,107,32,98,121,32,99,104,117,110,107,32,116,111,32,116,104,101,10,32,32,32,32,32,32,32,32,100,101,118,105,99,101,44,32,112,97,115,115,105,110,103,32,99,117,114,114,101,110,116,32,99,104,117,110,107,32,111,102,102,115,101,116,44,32,116,111,116,97,108,32,102,105,114,109,119,97,114,101,32,115,105,122,101,32,97,110,100,32,97,32,102,105,108,101,32,110,97,109,101,58,10,32,32,32,32,32,32,32,32,97,112,105,47,102,105,114,109,119,97,114,101,47,117,112,108,111,97,100,63,111,102,102,115,101,116,61,88,38,116,111,116,97,108,61,89,38,110,97,109,101,61,90,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,115,104,97,100,111,119,45,108,103,34,62,10,32,32,32,32,60,36,123,68,101,118,101,108,111,112,101,114,78,111,116,101,125,62,10,32,32,32,32,32,32,60,100,105,118,62,10,32,32,32,32,32,32,32,32,70,105,114,109,119,97,114,101,32,117,112,100,97,116,101,32,109,101,99,104,97,110,105,115,109,32,100,101,102,105,110,101,115,32,51,32,65,80,73,32,102,117,110,99,116,105,111,110,115,32,116,104,97,116,32,116,104,101,32,116,97,114,103,101,116,10,32,32,32,32,32,32,32,32,100,101,118,105,99,101,32,109,117,115,116,32,105,109,112,108,101,109,101,110,116,58,32,109,103,95,111,116,97,95,98,101,103,105,110,40,41,44,32,109,103,95,111,116,97,95,119,114,105,116,101,40,41,32,97,110,100,32,109,103,95,111,116,97,95,101,110,100,40,41,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,50,34,62,32,32,10,32,32,32,32,32,32,32,32,82,69,83,84,102,117,108,32,65,80,73,32,104,97,110,100,108,101,114,115,32,117,115,101,32,111,116,97,95,120,120,120,40,41,32,65,80,73,32,116,111,32,115,97,118,101,32,102,105,114,109,119,97,114,101,32,116,111,32,102,108,97,115,104,46,10,32,32,32,32,32,32,32,32,84,104,101,32,108,97,115,116,32,48,45,108,101,110,103,116,104,32,99,104,117,110,107,32,116,114,105,103,103,101,114,115,32,111,116,97,95,101,110,100,40,41,32,119,104,105,99,104,32,112,101,114,102,111,114,109,115,32,102,105,114,109,119,97,114,101,10,32,32,32,32,32,32,32,32,117,112,100,97,116,101,32,117,115,105,110,103,32,115,97,118,101,100,32,102,105,114,109,119,97,114,101,32,105,109,97,103,101,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,121,45,50,34,62,32,32,10,32,32,32,32,32,32,32,32,60,97,32,99,108,97,115,115,61,34,108,105,110,107,32,116,101,120,116,45,98,108,117,101,45,54,48,48,32,117,110,100,101,114,108,105,110,101,34,32,10,32,32,32,32,32,32,32,32,32,32,104,114,101,102,61,34,104,116,116,112,115,58,47,47,109,111,110,103,111,111,115,101,46,119,115,47,119,101,98,105,110,97,114,115,47,34,62,74,111,105,110,32,111,117,114,32,102,114,101,101,32,119,101,98,105,110,97,114,60,47,97,62,32,116,111,10,32,32,32,32,32,32,32,32,103,101,116,32,100,101,116,97,105,108,101,100,32,101,120,112,108,97,110,97,116,105,111,110,115,32,97,98,111,117,116,32,112,111,115,115,105,98,108,101,32,102,105,114,109,119,97,114,101,32,117,112,100,97,116,101,115,32,115,116,114,97,116,101,103,105,101,115,10,32,32,32,32,32,32,32,32,97,110,100,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,100,101,109,111,10,32,32,32,32,32,32,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,83,101,116,116,105,110,103,115,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,115,101,116,116,105,110,103,115,44,32,115,101,116,83,101,116,116,105,110,103,115,93,32,61,32,117,115,101,83,116,97,116,101,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,91,115,97,118,101,82,101,115,117,108,116,44,32,115,101,116,83,97,118,101,82,101,115,117,108,116,93,32,61,32,117,115,101,83,116,97,116,101,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,114,101,102,114,101,115,104,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,115,101,116,116,105,110,103,115,47,103,101,116,39,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,115,101,116,83,101,116,116,105,110,103,115,40,114,41,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,114,101,102,114,101,115,104,44,32,91,93,41,59,10,10,32,32,99,111,110,115,116,32,109,107,115,101,116,102,110,32,61,32,107,32,61,62,32,40,118,32,61,62,32,115,101,116,83,101,116,116,105,110,103,115,40,120,32,61,62,32,79,98,106,101,99,116,46,97,115,115,105,103,110,40,123,125,44,32,120,44,32,123,91,107,93,58,32,118,125,41,41,41,59,32,10,32,32,99,111,110,115,116,32,111,110,115,97,118,101,32,61,32,101,118,32,61,62,32,102,101,116,99,104,40,39,97,112,105,47,115,101,116,116,105,110,103,115,47,115,101,116,39,44,32,123,10,32,32,32,32,109,101,116,104,111,100,58,32,39,112,111,115,116,39,44,32,98,111,100,121,58,32,74,83,79,78,46,115,116,114,105,110,103,105,102,121,40,115,101,116,116,105,110,103,115,41,32,10,32,32,125,41,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,115,101,116,83,97,118,101,82,101,115,117,108,116,40,114,41,41,10,32,32,32,32,46,116,104,101,110,40,114,101,102,114,101,115,104,41,59,10,10,32,32,105,102,32,40,33,115,101,116,116,105,110,103,115,41,32,114,101,116,117,114,110,32,39,39,59,10,32,32,99,111,110,115,116,32,108,111,103,79,112,116,105,111,110,115,32,61,32,91,91,48,44,32,39,68,105,115,97,98,108,101,39,93,44,32,91,49,44,32,39,69,114,114,111,114,39,93,44,32,91,50,44,32,39,73,110,102,111,39,93,44,32,91,51,44,32,39,68,101,98,117,103,39,93,93,59,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,45,52,32,103,114,105,100,32,103,114,105,100,45,99,111,108,115,45,49,32,103,97,112,45,52,32,109,100,58,103,114,105,100,45,99,111,108,115,45,50,34,62,10,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,121,45,49,32,100,105,118,105,100,101,45,121,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,32,98,103,45,119,104,105,116,101,32,102,108,101,120,32,102,108,101,120,45,99,111,108,34,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,108,105,103,104,116,32,117,112,112,101,114,99,97,115,101,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,52,32,112,121,45,50,34,62,10,32,32,32,32,32,32,68,101,118,105,99,101,32,83,101,116,116,105,110,103,115,10,32,32,32,32,60,47,47,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,121,45,50,32,112,120,45,53,32,102,108,101,120,45,49,32,102,108,101,120,32,102,108,101,120,45,99,111,108,32,114,101,108,97,116,105,118,101,34,62,10,32,32,32,32,32,32,36,123,115,97,118,101,82,101,115,117,108,116,32,38,38,32,104,116,109,108,96,60,36,123,78,111,116,105,102,105,99,97,116,105,111,110,125,32,111,107,61,36,123,115,97,118,101,82,101,115,117,108,116,46,115,116,97,116,117,115,125,10,32,32,32,32,32,32,32,32,116,101,120,116,61,36,123,115,97,118,101,82,101,115,117,108,116,46,109,101,115,115,97,103,101,125,32,99,108,111,115,101,61,36,123,40,41,32,61,62,32,115,101,116,83,97,118,101,82,101,115,117,108,116,40,110,117,108,108,41,125,32,47,62,96,125,10,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,69,110,97,98,108,101,32,76,111,103,115,34,32,118,97,108,117,101,61,36,123,115,101,116,116,105,110,103,115,46,108,111,103,95,101,110,97,98,108,101,100,125,32,115,101,116,102,110,61,36,123,109,107,115,101,116,102,110,40,39,108,111,103,95,101,110,97,98,108,101,100,39,41,125,32,116,121,112,101,61,34,115,119,105,116,99,104,34,32,47,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,76,111,103,32,76,101,118,101,108,34,32,118,97,108,117,101,61,36,123,115,101,116,116,105,110,103,115,46,108,111,103,95,108,101,118,101,108,125,32,115,101,116,102,110,61,36,123,109,107,115,101,116,102,110,40,39,108,111,103,95,108,101,118,101,108,39,41,125,32,116,121,112,101,61,34,115,101,108,101,99,116,34,32,97,100,100,111,110,76,101,102,116,61,34,48,45,51,34,32,100,105,115,97,98,108,101,100,61,36,123,33,115,101,116,116,105,110,103,115,46,108,111,103,95,101,110,97,98,108,101,100,125,32,111,112,116,105,111,110,115,61,36,123,108,111,103,79,112,116,105,111,110,115,125,47,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,66,114,105,103,104,116,110,101,115,115,34,32,118,97,108,117,101,61,36,123,115,101,116,116,105,110,103,115,46,98,114,105,103,104,116,110,101,115,115,125,32,115,101,116,102,110,61,36,123,109,107,115,101,116,102,110,40,39,98,114,105,103,104,116,110,101,115,115,39,41,125,32,116,121,112,101,61,34,110,117,109,98,101,114,34,32,97,100,100,111,110,82,105,103,104,116,61,34,37,34,32,47,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,68,101,118,105,99,101,32,78,97,109,101,34,32,118,97,108,117,101,61,36,123,115,101,116,116,105,110,103,115,46,100,101,118,105,99,101,95,110,97,109,101,125,32,115,101,116,102,110,61,36,123,109,107,115,101,116,102,110,40,39,100,101,118,105,99,101,95,110,97,109,101,39,41,125,32,116,121,112,101,61,34,34,32,47,62,10,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,98,45,49,32,109,116,45,51,32,102,108,101,120,32,112,108,97,99,101,45,99,111,110,116,101,110,116,45,101,110,100,34,62,60,36,123,66,117,116,116,111,110,125,32,105,99,111,110,61,36,123,73,99,111,110,115,46,115,97,118,101,125,32,111,110,99,108,105,99,107,61,36,123,111,110,115,97,118,101,125,32,116,105,116,108,101,61,34,83,97,118,101,32,83,101,116,116,105,110,103,115,34,32,47,62,60,47,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,98,103,45,119,104,105,116,101,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,45,109,100,32,116,101,120,116,45,101,108,108,105,112,115,105,115,32,111,118,101,114,102,108,111,119,45,97,117,116,111,34,32,114,111,108,101,61,34,97,108,101,114,116,34,62,10,32,32,32,32,60,36,123,68,101,118,101,108,111,112,101,114,78,111,116,101,125,10,32,32,32,32,32,32,32,32,116,101,120,116,61,34,65,32,118,97,114,105,101,116,121,32,111,102,32,99,111,110,116,114,111,108,115,32,97,114,101,32,112,114,101,45,100,101,102,105,110,101,100,32,116,111,32,101,97,115,101,32,116,104,101,32,100,101,118,101,108,111,112,109,101,110,116,58,10,32,32,32,32,32,32,32,32,32,32,116,111,103,103,108,101,32,98,117,116,116,111,110,44,32,100,114,111,112,100,111,119,110,32,115,101,108,101,99,116,44,32,105,110,112,117,116,32,102,105,101,108,100,32,119,105,116,104,32,108,101,102,116,32,97,110,100,32,114,105,103,104,116,10,32,32,32,32,32,32,32,32,32,32,97,100,100,111,110,115,46,32,68,101,118,105,99,101,32,115,101,116,116,105,110,103,115,32,97,114,101,32,114,101,99,101,105,118,101,100,32,98,121,32,99,97,108,108,105,110,103,10,32,32,32,32,32,32,32,32,32,32,97,112,105,47,115,101,116,116,105,110,103,115,47,103,101,116,32,65,80,73,32,99,97,108,108,44,32,119,104,105,99,104,32,114,101,116,117,114,110,115,32,115,101,116,116,105,110,103,115,32,74,83,79,78,32,111,98,106,101,99,116,46,10,32,32,32,32,32,32,32,32,32,32,67,108,105,99,107,105,110,103,32,111,110,32,116,104,101,32,115,97,118,101,32,98,117,116,116,111,110,32,99,97,108,108,115,32,97,112,105,47,115,101,116,116,105,110,103,115,47,115,101,116,10,32,32,32,32,32,32,32,32,32,32,65,80,73,32,99,97,108,108,34,32,47,62,10,32,32,60,47,47,62,10,10,60,47,47,62,96,59,10,125,59,10,10,102,117,110,99,116,105,111,110,32,87,105,70,105,67,111,110,102,105,103,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,112,114,111,118,105,115,105,111,110,101,100,44,32,115,101,116,80,114,111,118,105,115,105,111,110,101,100,93,32,61,32,117,115,101,83,116,97,116,101,40,123,115,116,97,116,101,58,32,102,97,108,115,101,44,32,115,115,105,100,58,32,39,39,44,32,105,112,118,52,58,32,39,39,125,41,59,10,32,32,99,111,110,115,116,32,91,115,99,97,110,69,110,97,98,108,101,100,44,32,115,101,116,83,99,97,110,69,110,97,98,108,101,100,93,32,61,32,117,115,101,83,116,97,116,101,40,102,97,108,115,101,41,59,10,32,32,99,111,110,115,116,32,91,115,115,105,100,115,44,32,115,101,116,83,115,105,100,115,93,32,61,32,117,115,101,83,116,97,116,101,40,91,93,41,59,10,32,32,99,111,110,115,116,32,91,115,101,108,101,99,116,101,100,83,115,105,100,44,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,93,32,61,32,117,115,101,83,116,97,116,101,40,110,117,108,108,41,59,10,32,32,99,111,110,115,116,32,91,112,97,115,115,119,111,114,100,44,32,115,101,116,80,97,115,115,119,111,114,100,93,32,61,32,117,115,101,83,116,97,116,101,40,39,39,41,59,10,32,32,99,111,110,115,116,32,91,99,111,110,110,101,99,116,105,110,103,44,32,115,101,116,67,111,110,110,101,99,116,105,110,103,93,32,61,32,117,115,101,83,116,97,116,101,40,102,97,108,115,101,41,59,10,32,32,99,111,110,115,116,32,116,105,109,101,111,117,116,82,101,102,32,61,32,117,115,101,82,101,102,40,110,117,108,108,41,59,10,10,32,32,99,111,110,115,116,32,76,111,99,107,73,99,111,110,32,61,32,112,114,111,112,115,32,61,62,32,104,116,109,108,96,60,115,118,103,32,99,108,97,115,115,61,36,123,112,114,111,112,115,46,99,108,97,115,115,125,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,47,115,118,103,34,32,102,105,108,108,61,34,110,111,110,101,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,115,116,114,111,107,101,61,34,99,117,114,114,101,110,116,67,111,108,111,114,34,62,60,112,97,116,104,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,50,34,32,100,61,34,77,49,50,32,49,53,118,50,109,45,54,32,52,104,49,50,97,50,32,50,32,48,32,48,48,50,45,50,118,45,54,97,50,32,50,32,48,32,48,48,45,50,45,50,72,54,97,50,32,50,32,48,32,48,48,45,50,32,50,118,54,97,50,32,50,32,48,32,48,48,50,32,50,122,109,49,48,45,49,48,86,55,97,52,32,52,32,48,32,48,48,45,56,32,48,118,52,104,56,122,34,47,62,60,47,115,118,103,62,96,59,10,10,32,32,99,111,110,115,116,32,103,101,116,83,105,103,110,97,108,73,99,111,110,32,61,32,40,114,115,115,105,41,32,61,62,32,123,10,32,32,32,32,105,102,32,40,114,115,115,105,32,62,32,45,51,48,41,32,114,101,116,117,114,110,32,39,116,101,120,116,45,103,114,101,101,110,45,54,48,48,39,59,10,32,32,32,32,105,102,32,40,114,115,115,105,32,62,32,45,54,48,41,32,114,101,116,117,114,110,32,39,116,101,120,116,45,103,114,101,101,110,45,53,48,48,39,59,10,32,32,32,32,105,102,32,40,114,115,115,105,32,62,32,45,55,53,41,32,114,101,116,117,114,110,32,39,116,101,120,116,45,121,101,108,108,111,119,45,53,48,48,39,59,10,32,32,32,32,105,102,32,40,114,115,115,105,32,62,32,45,57,48,41,32,114,101,116,117,114,110,32,39,116,101,120,116,45,111,114,97,110,103,101,45,53,48,48,39,59,10,32,32,32,32,114,101,116,117,114,110,32,39,116,101,120,116,45,114,101,100,45,53,48,48,39,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,102,101,116,99,104,80,114,111,118,105,115,105,111,110,101,100,32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,114,101,116,117,114,110,32,102,101,116,99,104,40,39,114,101,115,116,47,119,105,102,105,47,112,114,111,118,105,115,105,111,110,101,100,39,41,10,32,32,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,114,46,106,115,111,110,40,41,41,10,32,32,32,32,32,32,46,116,104,101,110,40,100,97,116,97,32,61,62,32,123,10,32,32,32,32,32,32,32,32,47,47,32,99,111,110,115,111,108,101,46,108,111,103,40,39,80,114,111,118,105,115,105,111,110,101,100,32,100,97,116,97,58,39,44,32,100,97,116,97,41,59,10,32,32,32,32,32,32,32,32,115,101,116,80,114,111,118,105,115,105,111,110,101,100,40,123,115,116,97,116,101,58,32,100,97,116,97,46,112,114,111,118,105,115,105,111,110,101,100,44,32,115,115,105,100,58,32,100,97,116,97,46,115,115,105,100,44,32,105,112,118,52,58,32,100,97,116,97,46,105,112,118,52,125,41,59,10,32,32,32,32,32,32,125,41,59,10,32,32,125,10,10,32,32,99,111,110,115,116,32,102,101,116,99,104,83,99,97,110,32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,114,101,116,117,114,110,32,102,101,116,99,104,40,39,114,101,115,116,47,119,105,102,105,47,115,99,97,110,39,41,10,32,32,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,111,108,101,46,108,111,103,40,39,82,101,115,112,111,110,115,101,32,111,98,106,101,99,116,58,39,44,32,114,41,59,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,114,46,106,115,111,110,40,41,59,10,32,32,32,32,32,32,125,41,10,32,32,32,32,32,32,46,116,104,101,110,40,100,97,116,97,32,61,62,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,111,108,101,46,108,111,103,40,39,80,97,114,115,101,100,32,100,97,116,97,58,39,44,32,100,97,116,97,41,59,10,32,32,32,32,32,32,32,32,115,101,116,83,115,105,100,115,40,100,97,116,97,32,124,124,32,91,93,41,59,10,32,32,32,32,32,32,125,41,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,115,101,108,101,99,116,83,115,105,100,32,61,32,40,115,115,105,100,41,32,61,62,32,123,10,32,32,32,32,47,47,32,99,111,110,115,111,108,101,46,108,111,103,40,39,83,101,108,101,99,116,101,100,32,83,83,73,68,58,39,44,32,115,115,105,100,41,59,10,32,32,32,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,40,115,115,105,100,41,59,10,32,32,32,32,115,101,116,80,97,115,115,119,111,114,100,40,39,39,41,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,99,111,110,110,101,99,116,32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,115,101,116,67,111,110,110,101,99,116,105,110,103,40,116,114,117,101,41,59,10,32,32,32,32,102,101,116,99,104,40,39,114,101,115,116,47,119,105,102,105,47,99,111,110,110,101,99,116,39,44,32,123,10,32,32,32,32,32,32,109,101,116,104,111,100,58,32,39,80,79,83,84,39,44,10,32,32,32,32,32,32,98,111,100,121,58,32,74,83,79,78,46,115,116,114,105,110,103,105,102,121,40,123,32,115,115,105,100,58,32,115,101,108,101,99,116,101,100,83,115,105,100,46,115,115,105,100,44,32,112,97,115,115,119,111,114,100,32,125,41,10,32,32,32,32,125,41,10,32,32,32,32,32,32,46,116,104,101,110,40,40,41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,115,101,116,67,111,110,110,101,99,116,105,110,103,40,102,97,108,115,101,41,59,10,32,32,32,32,32,32,32,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,40,110,117,108,108,41,59,10,32,32,32,32,32,32,32,32,115,101,116,80,97,115,115,119,111,114,100,40,39,39,41,59,10,32,32,32,32,32,32,125,41,10,32,32,32,32,32,32,46,99,97,116,99,104,40,101,114,114,111,114,32,61,62,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,111,108,101,46,101,114,114,111,114,40,39,67,111,110,110,101,99,116,32,101,114,114,111,114,58,39,44,32,101,114,114,111,114,41,59,10,32,32,32,32,32,32,32,32,115,101,116,67,111,110,110,101,99,116,105,110,103,40,102,97,108,115,101,41,59,10,32,32,32,32,32,32,32,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,40,110,117,108,108,41,59,10,32,32,32,32,32,32,32,32,115,101,116,80,97,115,115,119,111,114,100,40,39,39,41,59,10,32,32,32,32,32,32,125,41,59,10,32,32,125,59,10,10,32,32,99,111,110,115,116,32,99,97,110,99,101,108,32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,115,101,116,67,111,110,110,101,99,116,105,110,103,40,102,97,108,115,101,41,59,10,32,32,32,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,40,110,117,108,108,41,59,10,32,32,32,32,115,101,116,80,97,115,115,119,111,114,100,40,39,39,41,59,10,32,32,125,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,10,32,32,32,32,102,101,116,99,104,80,114,111,118,105,115,105,111,110,101,100,40,41,59,10,32,32,125,44,32,91,93,41,59,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,123,10,32,32,32,32,105,102,32,40,115,99,97,110,69,110,97,98,108,101,100,41,32,123,10,32,32,32,32,32,32,99,111,110,115,116,32,112,111,108,108,32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,102,101,116,99,104,83,99,97,110,40,41,46,116,104,101,110,40,40,41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,115,99,97,110,69,110,97,98,108,101,100,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,116,105,109,101,111,117,116,82,101,102,46,99,117,114,114,101,110,116,32,61,32,115,101,116,84,105,109,101,111,117,116,40,112,111,108,108,44,32,53,48,48,48,41,59,10,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,41,59,10,32,32,32,32,32,32,125,59,10,32,32,32,32,32,32,112,111,108,108,40,41,59,10,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,115,101,116,83,115,105,100,115,40,91,93,41,59,10,32,32,32,32,32,32,115,101,116,83,101,108,101,99,116,101,100,83,115,105,100,40,110,117,108,108,41,59,10,32,32,32,32,125,10,32,32,32,32,114,101,116,117,114,110,32,40,41,32,61,62,32,123,10,32,32,32,32,32,32,105,102,32,40,116,105,109,101,111,117,116,82,101,102,46,99,117,114,114,101,110,116,41,32,123,10,32,32,32,32,32,32,32,32,99,108,101,97,114,84,105,109,101,111,117,116,40,116,105,109,101,111,117,116,82,101,102,46,99,117,114,114,101,110,116,41,59,10,32,32,32,32,32,32,32,32,116,105,109,101,111,117,116,82,101,102,46,99,117,114,114,101,110,116,32,61,32,110,117,108,108,59,10,32,32,32,32,32,32,125,10,32,32,32,32,125,59,10,32,32,125,44,32,91,115,99,97,110,69,110,97,98,108,101,100,93,41,59,10,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,45,52,32,100,105,118,105,100,101,45,121,32,100,105,118,105,100,101,45,103,114,97,121,45,50,48,48,32,111,118,101,114,102,108,111,119,45,97,117,116,111,32,114,111,117,110,100,101,100,32,98,103,45,119,104,105,116,101,34,62,10,32,32,36,123,112,114,111,118,105,115,105,111,110,101,100,46,115,116,97,116,101,32,38,38,32,104,116,109,108,96,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,101,101,110,45,54,48,48,32,112,120,45,51,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,34,62,10,32,32,32,32,32,32,60,100,105,118,62,87,105,70,105,32,112,114,111,118,105,115,105,111,110,101,100,60,47,100,105,118,62,10,32,32,32,32,32,32,60,100,105,118,62,83,83,73,68,58,32,36,123,112,114,111,118,105,115,105,111,110,101,100,46,115,115,105,100,125,60,47,100,105,118,62,10,32,32,32,32,32,32,60,100,105,118,62,73,80,86,52,58,32,36,123,112,114,111,118,105,115,105,111,110,101,100,46,105,112,118,52,125,60,47,100,105,118,62,10,32,32,32,32,60,47,100,105,118,62,10,32,32,96,125,10,32,32,36,123,33,112,114,111,118,105,115,105,111,110,101,100,46,115,116,97,116,101,32,38,38,32,104,116,109,108,96,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,114,101,100,45,54,48,48,32,112,120,45,51,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,34,62,10,32,32,32,32,32,32,60,100,105,118,62,87,105,70,105,32,105,115,32,110,111,116,32,112,114,111,118,105,115,105,111,110,101,100,60,47,100,105,118,62,10,32,32,32,32,60,47,100,105,118,62,10,32,32,96,125,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,115,101,109,105,98,111,108,100,32,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,32,116,101,120,116,45,103,114,97,121,45,54,48,48,32,112,120,45,51,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,34,62,10,32,32,32,32,60,33,45,45,100,105,118,62,87,105,70,105,32,99,111,110,102,105,103,117,114,97,116,105,111,110,60,47,100,105,118,45,45,62,10,32,32,32,32,60,36,123,83,101,116,116,105,110,103,125,32,116,105,116,108,101,61,34,83,99,97,110,34,32,118,97,108,117,101,61,36,123,115,99,97,110,69,110,97,98,108,101,100,125,32,115,101,116,102,110,61,36,123,115,101,116,83,99,97,110,69,110,97,98,108,101,100,125,32,116,121,112,101,61,34,115,119,105,116,99,104,34,32,47,62,10,32,32,60,47,100,105,118,62,10,32,32,36,123,115,99,97,110,69,110,97,98,108,101,100,32,38,38,32,104,116,109,108,96,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,45,52,34,62,10,32,32,32,32,60,117,108,32,99,108,97,115,115,61,34,115,112,97,99,101,45,121,45,50,34,62,10,32,32,32,32,32,32,36,123,115,115,105,100,115,46,109,97,112,40,115,115,105,100,32,61,62,32,104,116,109,108,96,10,32,32,32,32,32,32,32,32,60,108,105,32,99,108,97,115,115,61,34,102,108,101,120,32,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,32,105,116,101,109,115,45,99,101,110,116,101,114,32,112,121,45,48,46,53,32,112,120,45,50,32,98,111,114,100,101,114,32,114,111,117,110,100,101,100,34,62,10,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,105,116,101,109,115,45,99,101,110,116,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,114,101,108,97,116,105,118,101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,36,123,73,99,111,110,115,46,119,105,102,105,125,32,99,108,97,115,115,61,34,119,45,52,32,104,45,52,32,36,123,103,101,116,83,105,103,110,97,108,73,99,111,110,40,115,115,105,100,46,114,115,115,105,41,125,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,36,123,33,115,115,105,100,46,105,115,111,112,101,110,101,100,32,38,38,32,104,116,109,108,96,60,36,123,76,111,99,107,73,99,111,110,125,32,99,108,97,115,115,61,34,97,98,115,111,108,117,116,101,32,45,116,111,112,45,49,32,45,114,105,103,104,116,45,49,32,119,45,50,32,104,45,50,32,116,101,120,116,45,103,114,97,121,45,54,48,48,34,32,47,62,96,125,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,109,108,45,50,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,111,110,116,45,109,101,100,105,117,109,34,62,36,123,115,115,105,100,46,115,115,105,100,125,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,60,98,117,116,116,111,110,32,111,110,99,108,105,99,107,61,36,123,40,41,32,61,62,32,115,101,108,101,99,116,83,115,105,100,40,115,115,105,100,41,125,32,99,108,97,115,115,61,34,112,120,45,50,46,53,32,112,121,45,49,32,98,103,45,98,108,117,101,45,53,48,48,32,116,101,120,116,45,119,104,105,116,101,32,114,111,117,110,100,101,100,34,62,83,101,108,101,99,116,60,47,98,117,116,116,111,110,62,10,32,32,32,32,32,32,32,32,60,47,108,105,62,10,32,32,32,32,32,32,96,41,125,10,32,32,32,32,60,47,117,108,62,10,32,32,60,47,100,105,118,62,10,32,32,96,125,10,32,32,36,123,115,101,108,101,99,116,101,100,83,115,105,100,32,38,38,32,104,116,109,108,96,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,112,45,52,34,62,10,32,32,32,32,60,100,105,118,62,83,101,108,101,99,116,101,100,58,32,36,123,115,101,108,101,99,116,101,100,83,115,105,100,46,115,115,105,100,125,60,47,100,105,118,62,10,32,32,32,32,36,123,33,115,101,108,101,99,116,101,100,83,115,105,100,46,105,115,111,112,101,110,101,100,32,38,38,32,104,116,109,108,96,10,32,32,32,32,32,32,60,105,110,112,117,116,32,116,121,112,101,61,34,112,97,115,115,119,111,114,100,34,32,118,97,108,117,101,61,36,123,112,97,115,115,119,111,114,100,125,32,111,110,105,110,112,117,116,61,36,123,101,32,61,62,32,115,101,116,80,97,115,115,119,111,114,100,40,101,46,116,97,114,103,101,116,46,118,97,108,117,101,41,125,32,112,108,97,99,101,104,111,108,100,101,114,61,34,80,97,115,115,119,111,114,100,34,32,99,108,97,115,115,61,34,98,111,114,100,101,114,32,112,45,50,32,119,45,102,117,108,108,32,109,116,45,50,34,32,47,62,10,32,32,32,32,96,125,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,102,108,101,120,32,103,97,112,45,50,32,109,116,45,50,34,62,10,32,32,32,32,32,32,60,98,117,116,116,111,110,32,111,110,99,108,105,99,107,61,36,123,99,111,110,110,101,99,116,125,32,100,105,115,97,98,108,101,100,61,36,123,99,111,110,110,101,99,116,105,110,103,125,32,99,108,97,115,115,61,34,112,120,45,50,46,53,32,112,121,45,49,46,53,32,98,103,45,103,114,101,101,110,45,53,48,48,32,116,101,120,116,45,119,104,105,116,101,32,114,111,117,110,100,101,100,32,102,108,101,120,45,49,34,62,36,123,99,111,110,110,101,99,116,105,110,103,32,63,32,39,67,111,110,110,101,99,116,105,110,103,46,46,46,39,32,58,32,39,67,111,110,110,101,99,116,39,125,60,47,98,117,116,116,111,110,62,10,32,32,32,32,32,32,60,98,117,116,116,111,110,32,111,110,99,108,105,99,107,61,36,123,99,97,110,99,101,108,125,32,99,108,97,115,115,61,34,112,120,45,50,46,53,32,112,121,45,49,46,53,32,98,103,45,114,101,100,45,53,48,48,32,116,101,120,116,45,119,104,105,116,101,32,114,111,117,110,100,101,100,34,62,67,97,110,99,101,108,60,47,98,117,116,116,111,110,62,10,32,32,32,32,60,47,100,105,118,62,10,32,32,60,47,100,105,118,62,10,32,32,96,125,10,60,47,100,105,118,62,10,32,32,96,59,10,125,59,10,10,99,111,110,115,116,32,65,112,112,32,61,32,102,117,110,99,116,105,111,110,40,123,125,41,32,123,10,32,32,99,111,110,115,116,32,91,108,111,97,100,105,110,103,44,32,115,101,116,76,111,97,100,105,110,103,93,32,61,32,117,115,101,83,116,97,116,101,40,116,114,117,101,41,59,10,32,32,99,111,110,115,116,32,91,117,114,108,44,32,115,101,116,85,114,108,93,32,61,32,117,115,101,83,116,97,116,101,40,39,47,39,41,59,10,32,32,99,111,110,115,116,32,91,117,115,101,114,44,32,115,101,116,85,115,101,114,93,32,61,32,117,115,101,83,116,97,116,101,40,39,39,41,59,10,32,32,99,111,110,115,116,32,91,115,104,111,119,83,105,100,101,98,97,114,44,32,115,101,116,83,104,111,119,83,105,100,101,98,97,114,93,32,61,32,117,115,101,83,116,97,116,101,40,116,114,117,101,41,59,10,10,32,32,99,111,110,115,116,32,108,111,103,111,117,116,32,61,32,40,41,32,61,62,32,102,101,116,99,104,40,39,114,101,115,116,47,108,111,103,111,117,116,39,41,46,116,104,101,110,40,114,32,61,62,32,115,101,116,85,115,101,114,40,39,39,41,41,59,10,32,32,99,111,110,115,116,32,108,111,103,105,110,32,61,32,114,32,61,62,32,33,114,46,111,107,32,63,32,115,101,116,76,111,97,100,105,110,103,40,102,97,108,115,101,41,32,38,38,32,115,101,116,85,115,101,114,40,110,117,108,108,41,32,58,32,114,46,106,115,111,110,40,41,10,32,32,32,32,32,32,46,116,104,101,110,40,114,32,61,62,32,115,101,116,85,115,101,114,40,114,46,117,115,101,114,41,41,10,32,32,32,32,32,32,46,102,105,110,97,108,108,121,40,114,32,61,62,32,115,101,116,76,111,97,100,105,110,103,40,102,97,108,115,101,41,41,59,10,10,32,32,117,115,101,69,102,102,101,99,116,40,40,41,32,61,62,32,102,101,116,99,104,40,39,114,101,115,116,47,108,111,103,105,110,39,41,46,116,104,101,110,40,108,111,103,105,110,41,44,32,91,93,41,59,10,10,32,32,105,102,32,40,108,111,97,100,105,110,103,41,32,114,101,116,117,114,110,32,39,39,59,32,32,47,47,32,83,104,111,119,32,98,108,97,110,107,32,112,97,103,101,32,111,110,32,105,110,105,116,105,97,108,32,108,111,97,100,10,32,32,105,102,32,40,33,117,115,101,114,41,32,114,101,116,117,114,110,32,104,116,109,108,96,60,36,123,76,111,103,105,110,125,32,108,111,103,105,110,70,110,61,36,123,108,111,103,105,110,125,32,108,111,103,111,73,99,111,110,61,36,123,76,111,103,111,125,10,32,32,32,32,116,105,116,108,101,61,34,68,101,118,105,99,101,32,68,97,115,104,98,111,97,114,100,32,76,111,103,105,110,34,32,10,32,32,32,32,116,105,112,84,101,120,116,61,34,84,111,32,108,111,103,105,110,44,32,117,115,101,58,32,97,100,109,105,110,47,97,100,109,105,110,44,32,117,115,101,114,49,47,117,115,101,114,49,44,32,117,115,101,114,50,47,117,115,101,114,50,34,32,47,62,96,59,32,47,47,32,73,102,32,110,111,116,32,108,111,103,103,101,100,32,105,110,44,32,115,104,111,119,32,108,111,103,105,110,32,115,99,114,101,101,110,10,10,32,32,114,101,116,117,114,110,32,104,116,109,108,96,10,60,100,105,118,32,99,108,97,115,115,61,34,109,105,110,45,104,45,115,99,114,101,101,110,32,98,103,45,115,108,97,116,101,45,49,48,48,34,62,10,32,32,60,36,123,83,105,100,101,98,97,114,125,32,117,114,108,61,36,123,117,114,108,125,32,115,104,111,119,61,36,123,115,104,111,119,83,105,100,101,98,97,114,125,32,47,62,10,32,32,60,36,123,72,101,97,100,101,114,125,32,108,111,103,111,117,116,61,36,123,108,111,103,111,117,116,125,32,117,115,101,114,61,36,123,117,115,101,114,125,32,115,104,111,119,83,105,100,101,98,97,114,61,36,123,115,104,111,119,83,105,100,101,98,97,114,125,32,115,101,116,83,104,111,119,83,105,100,101,98,97,114,61,36,123,115,101,116,83,104,111,119,83,105,100,101,98,97,114,125,32,47,62,10,32,32,60,100,105,118,32,99,108,97,115,115,61,34,36,123,115,104,111,119,83,105,100,101,98,97,114,32,38,38,32,39,112,108,45,55,50,39,125,32,116,114,97,110,115,105,116,105,111,110,45,97,108,108,32,100,117,114,97,116,105,111,110,45,51,48,48,32,116,114,97,110,115,102,111,114,109,34,62,10,32,32,32,32,60,36,123,82,111,117,116,101,114,125,32,111,110,67,104,97,110,103,101,61,36,123,101,118,32,61,62,32,115,101,116,85,114,108,40,101,118,46,117,114,108,41,125,32,104,105,115,116,111,114,121,61,36,123,72,105,115,116,111,114,121,46,99,114,101,97,116,101,72,97,115,104,72,105,115,116,111,114,121,40,41,125,32,62,10,32,32,32,32,32,32,60,36,123,77,97,105,110,125,32,100,101,102,97,117,108,116,61,36,123,116,114,117,101,125,32,47,62,10,32,32,32,32,32,32,60,36,123,83,101,116,116,105,110,103,115,125,32,112,97,116,104,61,34,115,101,116,116,105,110,103,115,34,32,47,62,10,32,32,32,32,32,32,60,36,123,87,105,70,105,67,111,110,102,105,103,125,32,112,97,116,104,61,34,119,105,102,105,34,32,47,62,10,32,32,32,32,32,32,60,36,123,70,105,114,109,119,97,114,101,85,112,100,97,116,101,125,32,112,97,116,104,61,34,117,112,100,97,116,101,34,32,47,62,10,32,32,32,32,32,32,60,36,123,69,118,101,110,116,115,125,32,112,97,116,104,61,34,101,118,101,110,116,115,34,32,47,62,10,32,32,32,32,60,47,47,62,10,32,32,60,47,47,62,10,60,47,47,62,96,59,10,125,59,10,10,119,105,110,100,111,119,46,111,110,108,111,97,100,32,61,32,40,41,32,61,62,32,114,101,110,100,101,114,40,104,40,65,112,112,41,44,32,100,111,99,117,109,101,110,116,46,98,111,100,121,41,59,10,0};
+
+static const unsigned char v15[] = {27,255,84,17,213,164,131,137,168,34,117,3,26,133,227,222,163,32,162,20,98,56,197,20,56,221,34,134,211,69,49,66,134,220,246,85,245,171,170,53,166,178,6,124,218,144,233,221,189,107,202,16,101,155,227,47,140,44,25,146,126,36,120,126,255,58,63,171,118,22,88,122,127,238,192,3,253,42,68,85,210,45,155,98,159,181,44,29,48,40,138,253,255,108,150,239,80,90,82,27,33,8,157,57,72,45,173,219,72,73,100,135,164,87,183,222,251,219,173,110,157,63,210,234,120,181,99,64,174,170,215,165,233,105,121,198,132,16,125,192,48,7,206,40,76,136,150,177,246,255,49,180,190,104,116,108,131,59,3,6,189,203,100,52,203,234,244,244,129,69,67,54,51,85,238,183,62,19,39,55,166,166,184,55,208,186,158,174,88,178,128,54,127,83,220,152,31,195,54,204,206,237,13,56,186,231,45,49,183,12,165,95,120,119,254,248,42,215,69,196,71,98,163,215,159,135,27,195,109,152,183,244,33,227,107,116,238,204,52,124,50,8,11,127,161,186,111,128,49,135,227,161,19,126,66,150,214,184,175,229,22,247,216,239,49,205,173,64,46,139,146,59,90,175,6,137,15,157,158,226,37,134,205,3,79,101,115,243,174,174,49,135,84,158,235,166,208,78,178,66,130,217,159,239,228,126,49,46,232,209,208,158,27,59,232,146,93,245,242,202,134,14,121,253,33,55,233,190,16,20,171,128,104,164,134,131,141,0,229,172,184,100,107,3,254,28,134,109,14,163,151,10,202,149,88,172,130,191,73,3,98,121,37,51,49,205,59,207,141,165,7,87,15,65,230,15,40,107,12,210,82,92,183,124,37,188,212,141,236,203,99,221,237,147,252,46,51,236,185,184,63,139,244,137,179,83,2,148,133,248,193,9,220,24,87,141,114,196,176,161,129,111,139,200,95,52,116,76,16,151,205,59,107,133,228,224,112,105,249,172,20,155,157,86,126,113,168,72,56,104,208,169,228,240,150,107,170,56,175,202,118,45,159,65,181,4,253,161,90,130,123,82,216,193,13,84,231,54,103,221,27,206,234,95,7,168,150,115,31,222,62,33,96,150,204,213,159,190,180,54,92,212,91,64,161,255,135,191,126,251,231,22,205,253,139,247,244,146,221,248,100,174,61,240,243,131,225,51,93,149,155,222,163,213,173,53,115,250,80,203,51,140,152,249,166,47,249,76,62,73,146,149,25,77,214,160,186,140,159,62,25,27,119,25,25,208,203,212,194,186,16,193,31,109,226,12,150,152,209,179,83,124,93,103,100,101,12,246,59,160,45,15,76,97,214,192,45,91,214,249,184,7,207,114,107,253,246,7,150,58,92,190,86,250,110,136,33,209,175,219,227,69,122,92,130,117,141,133,172,213,89,98,130,88,223,249,233,114,121,247,238,41,61,181,246,246,221,211,120,98,243,186,251,207,40,71,123,60,145,74,13,206,14,7,44,72,107,49,184,246,100,200,242,244,218,65,30,19,247,66,59,85,245,45,249,230,200,54,180,62,221,144,213,154,46,45,100,54,47,51,51,95,222,252,253,35,91,77,156,22,40,104,211,10,26,255,184,54,93,239,178,78,145,78,23,231,188,163,253,251,187,214,135,214,199,214,167,250,103,179,159,139,230,65,41,174,200,253,131,22,63,156,25,199,29,207,100,212,55,43,243,50,149,106,118,248,239,65,223,230,149,250,42,52,134,253,208,254,189,254,57,162,45,185,88,245,119,162,191,127,254,171,59,21,220,183,232,181,233,175,237,41,21,2,255,108,97,41,244,67,119,106,37,133,70,44,76,31,77,187,215,156,107,148,58,197,220,33,37,87,69,36,128,17,116,89,240,163,112,251,156,143,109,107,88,194,109,179,51,50,191,128,191,231,121,166,241,124,236,31,159,252,133,40,60,8,63,130,143,16,36,33,112,67,139,81,138,133,162,194,115,235,32,238,46,165,191,101,42,7,136,54,6,214,228,218,254,230,182,209,89,206,193,10,82,160,139,130,240,135,255,49,48,168,149,19,94,58,159,186,163,255,173,244,128,232,74,66,114,126,223,112,178,122,91,114,12,221,249,31,236,160,1,52,49,227,134,243,253,1,255,24,29,200,87,160,194,97,156,87,114,85,81,55,52,154,160,199,23,224,83,201,141,193,67,206,16,33,8,124,176,191,221,222,176,12,250,6,64,213,29,173,206,68,212,144,104,109,66,162,138,38,241,34,24,132,139,114,230,172,40,13,208,37,164,81,40,48,207,24,132,219,247,203,207,17,135,12,230,141,106,135,209,128,20,24,33,223,35,149,184,9,115,137,183,30,114,110,233,197,152,241,90,163,240,99,233,206,221,106,52,148,4,77,128,9,250,168,27,106,127,3,196,139,169,6,22,81,189,150,107,233,111,197,64,50,174,90,81,19,68,203,200,114,68,67,12,64,19,112,249,170,245,129,17,59,81,85,150,76,104,212,43,113,19,241,112,61,28,186,236,198,44,24,246,228,134,180,89,105,147,8,175,54,147,242,188,140,246,149,122,117,38,107,128,193,157,241,120,16,233,190,67,122,104,180,154,74,41,177,28,215,167,46,209,57,105,1,104,149,143,74,170,50,13,154,199,77,66,134,43,254,75,170,184,159,7,38,159,16,16,151,8,145,241,173,4,151,138,164,74,176,101,55,41,235,240,33,236,146,171,144,82,116,34,23,255,57,148,52,168,10,234,165,208,5,177,19,99,254,134,3,45,85,147,219,95,153,240,59,175,67,190,132,70,219,125,150,149,152,168,43,232,176,111,68,59,93,78,227,101,35,106,167,65,137,159,144,216,131,166,58,203,226,190,196,115,219,112,3,131,232,75,53,230,169,100,199,248,149,77,46,125,244,207,127,48,108,57,30,161,114,226,92,190,16,205,47,227,199,138,46,167,187,50,77,178,130,231,204,232,159,210,159,220,231,89,29,18,164,175,104,50,134,215,31,100,233,35,87,223,71,111,38,58,203,168,197,177,48,97,199,42,31,121,157,201,119,223,192,3,16,95,25,202,216,160,141,193,215,112,152,152,34,33,36,16,49,230,27,116,114,130,103,64,19,243,161,84,194,93,218,183,28,229,224,45,148,162,139,90,73,93,9,216,200,124,203,206,86,240,242,152,2,131,166,224,173,192,34,204,27,227,166,97,206,125,185,41,199,187,163,192,241,230,217,183,1,79,72,77,143,242,98,37,61,164,21,210,4,20,26,225,35,251,214,48,209,101,135,242,197,98,23,125,76,30,180,208,155,154,255,15,224,165,113,113,1,44,111,246,225,189,229,15,127,235,29,44,31,60,114,18,121,186,46,41,213,238,152,33,203,86,227,138,191,88,22,109,139,131,60,60,188,234,238,91,216,225,35,71,176,198,237,205,199,94,195,38,1,215,79,94,72,190,221,222,165,197,153,240,48,33,71,137,217,186,128,216,11,209,2,97,12,116,139,42,69,118,235,220,36,134,233,212,101,115,48,149,88,186,93,247,242,16,115,57,7,80,9,78,39,33,30,135,1,215,67,135,105,238,50,246,85,89,237,66,244,67,1,217,109,108,168,185,71,58,227,186,133,165,22,151,152,186,140,29,80,227,8,170,43,149,176,203,28,31,3,71,203,251,155,239,135,47,120,15,113,51,243,187,36,183,149,0,98,146,68,112,5,17,138,171,60,25,200,130,249,252,47,112,2,140,205,31,235,66,135,211,108,255,106,99,14,18,34,136,224,27,164,208,69,164,208,149,54,21,152,58,62,9,66,216,137,98,150,120,8,192,160,142,122,7,243,109,204,216,131,147,144,43,64,40,238,116,57,153,191,130,151,99,46,77,155,129,121,32,17,78,240,66,100,25,150,245,86,64,174,115,120,15,167,78,100,57,73,34,138,44,202,66,56,22,19,8,1,118,103,133,54,155,143,222,54,220,38,227,254,62,200,118,33,169,167,192,242,240,82,6,129,76,0,254,217,227,169,198,252,10,94,32,20,116,60,243,49,235,160,154,32,54,23,22,58,209,70,27,54,192,105,51,108,170,41,62,188,231,23,142,255,250,136,55,83,198,203,102,243,111,119,204,52,106,212,218,14,35,153,90,88,56,247,136,91,102,31,66,127,59,27,108,0,241,230,124,9,117,180,234,33,185,1,253,188,217,153,103,27,33,101,194,173,190,121,157,66,10,245,253,40,64,239,195,75,85,70,166,225,232,188,171,30,204,17,230,253,103,231,134,161,235,230,0,235,35,137,49,85,254,182,50,215,202,138,94,191,183,103,211,144,47,134,132,149,197,216,158,191,183,230,38,11,80,192,139,72,16,159,238,48,224,242,138,241,105,189,184,250,191,97,254,183,145,185,51,203,105,99,50,12,43,98,35,16,77,255,203,229,223,249,191,126,147,123,157,224,179,219,48,246,49,235,84,2,101,125,119,103,76,231,154,157,153,231,125,231,160,38,0,138,119,180,159,57,96,252,120,202,239,112,200,47,49,199,46,230,235,35,5,138,195,193,122,11,126,1,62,40,91,115,173,147,184,212,3,32,215,48,90,57,195,215,32,112,98,190,80,120,126,3,150,231,204,185,182,37,197,113,227,63,148,243,239,133,170,141,121,15,183,145,43,236,170,115,198,83,72,47,193,193,157,4,142,178,78,159,12,108,150,134,42,24,67,125,150,241,131,145,249,218,31,183,3,231,168,217,122,208,54,231,246,125,253,229,224,199,231,90,15,203,33,76,9,2,40,166,35,75,194,155,171,209,35,193,159,1,46,236,119,95,196,100,2,130,103,194,164,182,51,67,120,54,213,41,166,248,233,230,255,13,7,240,193,251,178,133,131,131,190,165,19,102,32,23,103,89,107,67,200,77,55,50,147,244,136,201,33,140,52,78,64,86,27,209,230,52,47,75,115,111,107,194,52,196,114,195,25,113,169,229,138,177,110,163,246,216,215,143,235,111,63,43,184,79,240,183,251,31,132,163,10,155,176,127,162,186,6,174,127,124,135,117,72,203,88,163,191,61,191,76,21,83,137,115,82,154,246,214,183,246,26,84,15,38,41,159,50,252,63,194,60,75,177,51,43,1,67,179,17,39,210,12,233,158,185,188,142,237,33,5,119,122,255,115,160,50,228,153,174,100,208,243,238,65,111,143,202,8,185,34,72,244,78,58,93,68,47,160,247,78,10,127,5,46,123,121,79,49,14,197,10,94,14,234,170,166,197,227,196,67,125,165,32,204,254,151,118,52,222,164,115,202,119,30,69,10,137,130,68,253,97,11,27,29,17,210,247,241,146,94,142,187,4,244,86,166,122,93,149,190,156,206,22,92,218,119,173,137,182,7,134,152,171,75,128,80,56,59,96,178,115,103,36,71,224,228,138,114,118,132,39,187,127,193,169,158,243,18,186,216,175,181,124,141,204,183,237,127,214,54,165,120,180,216,200,188,193,137,37,76,52,50,175,141,92,135,185,106,179,237,55,202,181,11,234,245,52,57,183,234,59,83,160,36,31,32,163,142,157,7,235,111,15,120,220,236,9,200,230,214,157,7,80,166,105,126,192,91,162,178,18,24,38,144,54,70,70,62,0,228,188,127,217,176,66,22,215,44,216,112,164,99,161,70,179,126,192,209,85,81,252,18,240,107,93,179,205,228,160,244,133,239,198,129,165,109,78,160,71,28,229,153,27,100,13,66,226,150,176,28,113,22,20,162,103,23,71,237,216,146,71,200,216,145,25,170,117,122,196,197,93,246,21,231,7,133,59,254,125,252,106,195,42,157,5,190,213,55,143,248,60,49,158,190,229,114,23,40,31,220,98,195,230,15,182,250,64,138,175,211,68,165,100,49,125,149,172,27,47,68,196,238,239,152,72,6,230,22,111,235,146,22,7,146,127,213,106,132,146,168,216,98,94,2,177,62,246,197,130,196,251,56,171,15,44,191,84,11,197,188,86,222,144,221,103,231,227,196,144,152,63,92,43,150,167,19,245,133,26,43,86,201,101,98,57,113,62,252,46,252,61,153,172,94,143,142,68,83,162,122,248,221,204,27,229,140,114,68,203,113,95,93,160,39,248,108,243,218,73,108,133,80,156,97,79,140,228,250,60,14,201,249,89,55,72,9,235,123,120,249,16,228,78,252,140,227,42,174,134,71,50,13,77,237,171,216,87,157,243,13,198,94,203,171,24,111,71,192,250,251,213,185,96,37,52,216,235,170,246,179,158,215,79,130,2,72,126,251,188,234,238,123,8,131,23,37,5,2,119,172,128,236,184,52,132,101,125,179,173,223,243,29,216,134,169,71,190,107,164,151,168,210,145,84,25,14,232,249,209,141,90,156,123,233,220,52,13,147,236,97,115,176,148,88,122,185,30,220,33,230,189,238,96,203,22,99,8,43,16,114,56,89,223,63,96,101,19,64,193,242,6,24,170,32,93,25,118,230,48,53,1,5,209,67,244,147,44,61,180,130,3,142,236,142,243,33,74,204,47,148,144,36,242,7,25,91,86,183,149,180,157,223,163,150,9,212,0,162,76,111,28,105,212,241,124,99,243,245,21,240,242,231,43,135,31,86,16,3,22,204,3,233,116,212,135,89,252,125,199,29,53,14,57,162,2,93,23,235,226,155,251,220,146,17,160,195,162,43,45,107,46,104,210,92,12,25,117,138,243,123,201,157,153,152,209,217,17,230,171,142,98,64,139,63,119,28,221,214,124,209,177,23,30,101,143,14,175,137,102,200,14,141,168,9,246,148,18,100,97,191,186,179,199,35,46,97,178,41,199,163,115,70,152,188,31,234,182,117,85,29,88,60,158,66,133,55,3,118,246,234,101,54,161,151,157,160,216,87,102,150,254,134,128,71,66,84,66,58,167,244,132,83,2,59,18,36,167,139,223,128,228,148,157,74,185,164,75,45,111,197,35,33,35,93,62,21,40,200,64,238,233,202,41,138,68,98,164,229,233,138,228,164,206,82,105,180,148,100,137,181,54,141,251,197,230,248,53,93,28,137,100,199,85,73,34,101,57,131,41,203,35,102,142,49,128,177,33,55,101,173,183,7,39,17,245,118,7,89,97,167,118,206,244,62,94,165,116,174,35,196,111,41,227,62,194,164,233,53,58,131,111,146,249,132,21,18,46,51,70,9,191,166,30,111,111,244,193,113,7,203,143,64,54,17,175,218,220,138,171,161,225,143,62,156,173,197,76,174,233,10,101,240,167,167,100,255,81,3,210,55,189,226,19,39,80,249,137,215,39,155,17,82,33,182,54,93,161,87,161,73,240,202,147,140,27,104,210,142,254,25,16,67,38,217,108,222,232,89,224,197,193,26,159,238,3,62,183,128,222,201,13,58,54,242,82,244,183,65,239,71,76,163,165,208,205,241,130,128,55,132,110,75,86,63,9,104,117,40,165,111,33,7,208,167,11,90,92,101,103,223,22,244,24,45,185,210,187,26,6,245,193,161,29,186,255,27,34,173,76,3,52,92,134,139,193,104,218,196,243,2,220,227,45,85,226,170,109,107,98,122,83,108,213,163,34,96,123,92,132,61,25,198,61,117,123,203,67,102,79,192,3,42,255,241,83,58,24,226,7,228,197,126,221,109,12,23,92,112,131,165,236,113,117,56,242,124,135,231,144,9,46,214,29,195,133,170,234,88,112,134,51,28,178,65,245,120,53,144,161,181,40,244,49,225,56,229,233,127,23,254,81,86,123,228,223,81,68,178,157,141,58,16,221,60,178,84,230,195,6,58,234,28,136,213,81,231,249,232,57,28,142,125,83,34,204,198,28,143,24,171,117,21,235,192,51,39,146,231,93,160,118,178,105,33,36,121,230,6,89,151,235,138,11,33,250,125,156,192,27,223,44,53,21,160,94,150,81,194,202,208,251,195,87,110,73,92,199,212,241,4,15,145,249,120,12,63,103,36,95,3,225,107,222,60,205,202,215,172,68,3,232,107,222,89,243,149,181,28,233,252,97,253,243,116,164,63,61,120,193,49,247,55,250,26,129,108,4,136,10,199,4,35,253,40,209,63,61,64,165,96,173,110,162,85,37,90,87,208,26,150,53,43,85,171,10,145,93,179,31,57,162,166,79,75,252,170,66,76,46,108,164,134,237,101,196,61,107,164,242,22,48,244,219,96,71,131,113,73,25,213,57,136,215,168,123,31,18,161,137,18,165,62,249,104,58,197,61,35,243,175,86,228,143,181,62,207,113,193,74,30,81,234,24,172,226,42,72,133,55,198,198,155,179,135,94,199,1,62,134,244,197,241,53,165,208,246,113,127,145,238,34,86,254,67,91,36,255,5,121,158,65,134,141,164,147,46,19,121,128,180,173,191,145,183,161,9,14,25,221,185,171,71,97,199,236,46,53,150,238,88,175,251,255,213,52,187,41,163,201,150,186,33,46,198,213,191,44,7,167,251,114,113,202,101,87,231,13,248,47,134,105,45,238,112,243,226,204,86,180,199,128,9,184,50,184,227,55,180,66,47,117,115,171,239,2,194,33,98,233,27,74,205,48,215,235,255,213,60,32,220,60,151,1,84,45,97,10,30,67,74,61,103,45,165,5,223,135,229,75,83,123,3,107,67,131,78,73,250,246,9,186,132,203,33,83,142,251,40,71,227,20,81,200,253,155,90,71,248,207,156,234,4,136,191,2,159,198,37,241,190,156,81,178,98,12,172,73,200,74,166,31,10,228,44,29,157,148,73,79,107,177,68,79,115,109,229,151,85,37,97,135,190,222,84,60,234,118,101,63,145,204,233,194,246,37,191,240,84,58,62,84,46,60,230,213,197,123,166,249,168,212,54,198,204,68,39,37,38,209,15,167,179,184,38,122,181,33,206,17,83,186,111,219,138,163,242,15,34,178,47,189,206,127,253,144,199,218,235,33,79,191,148,104,220,223,156,250,113,255,171,25,197,6,84,120,212,19,84,228,72,21,141,182,177,2,255,109,31,102,161,4,74,139,15,112,2,161,227,6,174,252,175,159,246,200,225,13,184,198,12,113,0,93,196,48,7,168,217,141,97,128,49,173,79,9,80,157,88,199,60,59,14,57,140,85,231,11,107,175,200,221,83,204,73,187,46,205,208,21,213,242,243,193,98,115,114,220,212,81,174,6,25,26,29,10,196,213,87,244,55,237,194,138,117,105,252,23,180,34,133,166,209,20,182,113,195,40,145,158,145,59,121,132,161,48,249,151,216,253,81,210,75,190,207,223,65,179,98,128,63,111,54,125,128,232,212,169,127,120,191,191,154,190,189,233,179,206,147,214,175,236,76,185,177,135,226,67,234,243,137,244,171,216,239,189,181,173,76,216,48,122,236,97,215,45,95,122,38,20,167,10,0};
+
+static const unsigned char v16[] = {31,139,8,0,0,0,0,0,2,3,237,92,91,143,227,56,118,254,43,76,15,6,40,79,68,181,40,201,118,89,133,13,54,88,32,200,2,59,121,72,242,144,197,84,63,208,18,109,115,75,183,80,82,149,221,90,229,183,7,135,20,37,234,98,91,158,233,9,178,139,193,160,186,138,223,185,240,240,144,58,188,158,249,193,10,232,161,100,194,10,246,236,144,9,86,99,92,126,224,125,38,34,38,112,145,211,144,167,71,124,14,156,151,57,252,162,241,82,208,180,136,105,201,122,214,30,234,184,68,86,210,146,233,82,241,198,62,122,118,89,234,56,139,144,198,160,139,152,197,139,46,230,52,197,231,0,245,133,75,87,224,105,120,194,95,179,44,209,72,17,138,44,142,113,145,210,28,23,165,224,97,153,178,162,8,114,145,157,121,194,203,139,226,58,10,26,113,150,150,248,32,178,4,231,89,193,75,158,165,90,71,71,125,231,244,58,177,204,38,180,76,68,60,165,113,103,75,76,139,19,139,240,87,38,50,141,165,85,194,4,15,241,129,31,43,193,198,104,235,232,9,179,160,161,89,143,128,206,224,105,193,202,1,146,29,14,5,43,241,7,143,202,83,224,228,231,41,41,204,226,76,4,223,29,14,7,131,166,64,113,220,211,167,245,206,34,158,99,185,254,198,178,215,171,169,124,113,162,81,246,17,56,200,65,223,57,142,227,24,28,243,164,91,168,170,152,69,99,234,62,174,132,110,215,94,240,227,73,117,97,139,132,89,90,10,90,148,70,127,92,228,120,209,192,169,98,122,228,181,8,79,223,153,232,4,10,90,86,194,160,22,44,231,84,23,34,145,229,218,104,109,2,13,223,36,60,176,171,3,39,6,118,164,177,165,29,97,98,114,71,153,218,222,145,134,141,232,224,12,70,76,121,153,224,227,86,246,4,179,185,96,34,229,41,46,248,87,54,198,98,122,201,170,114,140,230,148,167,19,176,40,47,208,152,38,8,116,53,191,133,149,223,194,202,111,97,229,183,176,242,77,194,202,231,31,254,1,149,148,199,31,60,141,194,162,64,239,158,237,219,100,135,254,138,126,252,227,127,162,63,241,144,165,5,67,127,69,167,178,204,139,224,243,103,131,215,14,179,228,135,207,63,140,23,61,251,236,12,198,193,55,209,198,162,125,118,126,81,127,6,14,42,178,152,71,232,59,182,102,91,182,111,230,22,76,96,34,75,203,224,211,167,38,56,101,69,105,157,202,36,174,99,158,50,124,98,208,117,1,177,215,47,248,131,237,223,120,137,75,118,46,165,51,48,141,254,82,21,101,64,28,231,251,23,156,100,95,113,73,247,202,77,254,11,206,204,146,241,231,33,131,144,66,19,30,95,130,63,166,37,19,232,157,10,235,159,5,167,177,245,175,44,126,103,37,15,169,85,208,180,192,5,19,252,208,10,48,232,43,134,11,86,150,60,61,22,193,167,240,157,144,79,214,167,162,112,200,39,197,243,78,5,167,16,2,12,174,44,47,190,126,66,158,219,91,79,115,124,226,199,83,12,237,106,63,107,25,150,115,42,88,90,54,251,44,186,212,9,21,71,158,6,206,139,233,3,158,158,152,224,101,115,18,117,139,56,47,74,190,165,180,46,199,101,150,183,241,133,228,231,134,238,247,34,248,56,49,193,158,126,42,121,25,179,47,171,122,224,202,136,133,153,144,118,7,85,26,49,1,117,162,40,43,75,22,189,220,99,104,78,196,58,185,214,201,179,78,190,117,90,91,167,77,45,93,33,125,173,205,146,200,199,176,17,180,30,154,62,174,72,243,237,173,162,20,89,122,172,77,37,251,44,142,152,104,194,44,98,214,219,62,178,114,193,172,130,38,121,109,246,109,197,113,146,165,25,68,107,102,253,199,191,252,152,165,25,254,119,118,172,98,42,172,31,89,26,103,214,143,89,74,195,204,250,67,150,22,89,76,11,235,79,124,207,84,245,8,184,173,63,100,149,224,76,160,127,99,31,86,167,234,202,112,72,51,145,208,248,234,56,48,201,210,55,132,37,77,145,208,56,54,252,245,236,124,223,20,213,222,42,170,220,64,183,235,239,7,195,192,121,233,102,52,193,98,90,242,119,246,2,81,135,135,52,198,52,230,199,52,216,211,130,129,8,104,171,247,89,89,102,73,128,109,119,13,117,86,121,93,102,121,128,109,40,149,116,31,179,90,250,158,167,17,124,130,142,30,68,179,35,43,204,226,152,230,5,11,244,31,205,190,42,203,44,181,120,154,87,165,149,229,229,81,100,85,110,21,44,102,97,105,129,98,42,24,29,244,203,96,84,76,252,56,160,206,56,114,64,87,158,132,175,127,102,136,205,125,59,47,49,43,203,126,173,212,193,195,198,118,95,95,78,163,8,216,28,221,76,213,46,229,48,249,209,30,50,145,4,105,150,14,29,209,125,110,151,156,253,78,17,190,172,102,72,130,21,172,156,165,20,213,62,225,165,241,165,210,60,103,84,208,52,100,129,82,248,2,147,5,120,59,141,166,81,196,36,242,132,30,153,178,49,144,65,242,144,133,85,1,203,129,58,171,74,112,82,64,171,50,107,137,21,135,73,140,198,60,82,97,93,205,178,82,58,23,217,81,176,162,168,175,141,182,32,208,214,242,52,149,94,230,41,110,253,210,211,178,170,28,210,116,52,147,86,180,205,103,84,132,167,47,115,173,7,223,31,56,139,163,151,214,250,118,217,19,96,55,63,27,38,40,21,70,72,153,83,166,188,210,201,28,120,204,112,149,199,25,141,180,109,215,253,15,67,174,11,83,69,149,36,84,92,234,136,23,121,76,47,65,204,139,18,243,146,37,205,62,206,194,183,255,174,178,146,89,81,100,69,177,165,22,149,214,36,112,90,39,97,229,16,202,186,232,223,200,118,22,172,156,34,86,204,142,44,141,234,126,132,38,44,173,172,44,182,42,152,56,139,178,157,238,161,129,115,227,57,226,52,206,142,134,120,247,169,10,38,191,42,221,199,141,26,155,106,112,228,49,13,217,73,6,223,238,219,158,146,106,189,220,33,237,119,245,221,46,164,30,61,104,85,243,90,150,40,248,73,100,113,247,65,89,109,15,133,149,40,50,17,228,25,135,201,188,9,34,94,64,84,139,52,33,98,7,90,197,101,67,171,136,103,86,72,211,119,90,88,44,217,179,200,226,7,65,19,102,241,228,104,101,251,191,64,196,42,222,143,214,59,143,88,214,245,164,236,191,113,128,77,120,20,197,172,1,65,197,157,208,179,158,114,33,28,13,70,244,137,71,17,75,191,180,223,119,144,102,229,83,139,253,174,74,75,30,227,3,124,167,95,86,171,174,78,57,44,237,66,224,44,141,47,117,23,238,233,190,200,226,170,100,47,221,228,174,43,130,63,187,190,212,253,141,1,205,222,153,56,196,217,71,160,106,124,9,99,158,7,130,133,229,147,99,201,255,86,47,31,39,94,50,25,18,97,188,124,8,154,235,112,223,110,82,26,187,117,46,102,239,44,45,11,12,246,213,67,172,181,121,196,8,14,24,51,74,167,216,7,126,102,81,223,52,89,108,108,221,194,105,155,27,91,79,118,245,100,250,107,236,162,228,225,155,225,41,85,110,108,185,253,194,78,173,182,97,78,99,99,185,19,192,164,150,191,229,164,40,88,210,216,114,205,68,218,153,177,197,212,196,137,29,61,131,58,141,29,179,3,168,131,95,80,84,202,100,35,69,223,225,54,232,114,164,46,167,177,57,172,45,74,86,171,223,114,105,163,144,198,254,138,137,83,127,149,51,239,57,32,14,0,175,63,249,207,175,95,58,208,127,86,224,198,49,192,141,211,216,97,22,67,143,165,216,173,143,130,203,25,160,74,210,0,32,228,126,86,191,26,59,193,190,14,29,68,54,41,57,43,107,21,136,101,59,0,104,135,12,54,91,145,92,176,163,25,101,91,52,83,239,142,228,130,137,201,162,60,55,226,211,238,76,46,216,29,48,207,241,118,172,222,128,117,59,199,187,237,152,125,147,153,76,89,137,102,92,15,24,103,205,37,157,189,251,190,113,227,166,196,125,83,164,15,237,14,247,134,248,182,35,248,3,66,107,145,232,245,40,215,107,69,162,231,87,132,86,160,156,115,184,196,167,190,149,240,140,31,37,62,113,153,68,231,252,35,9,219,33,161,213,35,99,227,48,82,194,55,39,103,229,33,205,4,27,251,16,179,115,71,130,66,39,53,160,24,88,99,171,165,170,38,201,82,99,195,216,239,48,40,52,182,138,115,163,80,122,130,47,173,141,149,110,235,156,19,38,174,198,188,22,233,128,142,199,215,8,105,129,117,7,104,247,156,240,166,199,52,116,168,226,184,67,29,231,251,198,78,120,138,79,112,244,197,88,90,203,66,71,125,63,53,246,7,118,234,46,222,126,96,66,218,146,171,157,253,129,221,22,178,53,224,183,0,105,203,107,93,214,166,125,224,77,7,105,100,171,213,144,231,22,217,105,38,215,111,17,105,125,63,159,41,227,91,88,254,105,146,96,234,195,69,98,204,129,173,30,232,56,76,106,248,21,16,68,16,112,75,172,56,9,158,190,97,167,54,74,208,108,245,215,0,37,26,157,114,31,69,246,161,48,248,11,56,225,183,230,147,152,211,216,123,90,240,2,191,254,228,57,249,249,245,139,162,73,44,0,4,162,188,58,61,101,57,133,163,152,122,188,211,209,132,158,179,61,103,117,174,157,202,234,51,189,233,185,108,174,79,69,186,13,200,59,21,79,179,106,86,232,26,233,178,130,233,170,63,219,85,189,50,57,241,197,170,119,38,156,150,109,34,78,221,111,99,58,252,169,171,218,96,93,89,51,232,101,181,66,234,40,172,151,81,229,213,10,193,233,241,127,245,184,58,90,110,241,63,143,112,80,36,79,219,76,1,117,222,172,41,127,30,83,46,171,85,51,106,204,244,220,27,186,216,228,89,79,121,186,175,101,192,103,250,233,242,247,228,167,203,212,79,151,177,159,96,170,158,242,216,134,155,192,19,214,72,226,111,219,69,191,127,99,23,185,31,40,16,108,78,235,50,51,26,212,90,70,202,74,164,171,166,177,105,202,19,42,87,205,60,173,85,65,174,59,115,158,34,82,32,152,183,168,64,60,61,240,148,67,236,80,123,17,220,46,133,199,123,22,91,157,43,168,117,181,222,113,86,133,12,75,64,80,219,56,181,63,31,163,99,64,77,138,16,191,10,76,212,226,176,100,73,46,125,172,86,137,69,32,88,206,104,249,68,172,132,167,9,61,63,57,22,57,8,24,37,189,168,123,91,212,157,136,202,192,26,102,177,138,176,17,135,61,6,184,68,9,182,116,216,92,212,221,95,1,252,211,216,114,231,167,207,128,177,220,213,154,72,192,210,168,177,97,47,93,224,162,164,162,172,229,30,76,238,174,139,64,205,9,0,107,30,80,48,225,48,116,132,76,118,129,201,162,160,198,134,211,100,126,184,104,150,174,216,26,50,102,219,179,242,3,38,243,49,159,220,74,105,106,99,31,105,142,201,171,189,174,143,52,15,108,175,157,206,1,117,21,212,3,190,4,72,87,62,195,119,8,221,174,188,136,59,246,151,49,160,249,189,41,255,118,34,176,53,37,252,137,4,25,241,247,246,92,240,166,134,57,86,162,109,189,106,231,136,207,56,63,255,147,185,185,253,178,250,159,97,81,69,20,205,45,216,59,19,5,235,183,21,106,157,27,210,56,124,130,157,235,15,253,39,58,148,88,173,94,204,149,116,47,240,68,16,70,215,165,86,141,173,49,255,91,25,10,158,121,200,80,41,176,212,208,11,118,151,27,122,153,26,10,107,117,89,171,236,169,217,106,47,70,181,163,141,144,33,121,93,168,55,213,255,54,166,146,159,107,41,185,103,104,196,225,168,6,95,150,216,169,121,13,67,39,119,43,170,214,201,184,27,139,130,185,221,173,152,60,80,24,137,223,144,236,140,134,203,72,236,58,206,3,182,247,103,104,131,3,125,113,220,63,185,238,14,185,30,65,174,183,254,60,174,189,21,179,136,236,91,22,31,6,49,23,128,65,200,109,57,4,43,195,147,201,211,66,141,173,207,159,212,185,67,119,26,165,142,24,58,98,187,105,27,29,86,25,12,234,197,64,207,160,202,6,195,101,88,1,190,232,179,24,81,165,33,172,235,199,7,97,211,83,175,198,150,231,250,44,142,121,94,240,194,234,101,37,222,41,208,12,141,45,117,168,161,166,84,212,115,90,229,49,60,139,244,206,2,158,38,84,69,183,117,111,169,106,21,63,100,217,237,118,59,88,151,105,150,248,56,214,49,84,145,76,234,208,147,141,230,56,143,171,232,118,242,18,173,7,231,126,196,216,30,185,67,146,107,144,246,245,220,240,54,133,187,74,229,241,217,148,222,213,171,206,211,166,12,122,248,15,118,92,143,14,240,161,152,26,224,166,126,239,1,253,206,14,185,196,67,46,217,45,210,47,88,244,144,249,107,31,185,142,11,63,139,212,171,5,244,67,254,217,32,215,115,145,235,59,15,84,240,144,131,60,229,32,119,89,7,24,87,87,245,64,153,121,51,110,239,143,240,188,131,225,117,103,200,209,52,98,124,31,6,134,172,119,136,120,14,114,253,141,97,199,113,100,67,171,118,179,92,173,183,69,187,221,104,120,77,181,142,134,237,93,173,243,195,118,78,47,99,41,236,239,151,43,118,144,187,118,65,249,2,197,15,184,215,243,17,217,109,209,206,191,169,22,134,255,35,214,194,240,135,17,234,110,238,170,125,192,86,215,219,161,205,51,218,60,223,84,170,134,250,35,214,250,4,185,254,26,185,254,110,129,226,135,70,195,220,71,122,77,241,250,1,131,159,145,187,150,3,226,166,222,119,158,197,172,124,200,21,222,22,185,158,135,220,245,237,241,32,39,201,229,163,97,141,218,159,155,74,47,44,134,121,255,209,113,230,239,16,217,221,214,220,150,241,118,61,209,236,216,219,53,220,101,197,49,14,47,84,125,58,80,10,190,115,54,251,77,228,183,52,213,69,126,71,220,249,212,219,63,195,181,149,200,222,152,18,133,232,163,202,193,119,206,243,142,236,221,142,222,135,95,205,16,238,163,53,35,29,3,105,9,122,234,108,108,216,91,234,11,193,118,149,0,187,75,13,145,22,89,247,136,94,143,228,112,100,219,162,237,37,134,186,38,209,88,123,81,209,179,187,35,246,57,238,158,25,54,194,67,254,205,172,254,77,95,129,55,18,216,206,241,111,59,118,127,200,78,166,204,68,179,142,76,33,179,77,237,93,3,71,103,154,166,174,196,116,169,191,19,3,38,179,141,242,222,133,12,245,234,235,36,210,43,38,67,129,121,126,131,125,82,133,183,157,21,209,43,192,252,98,244,83,127,253,54,102,239,152,189,33,243,188,242,94,247,102,192,78,102,149,235,3,131,60,134,59,136,161,227,213,85,68,46,140,122,71,253,90,94,117,171,36,206,52,174,93,207,67,5,106,5,175,238,238,161,220,216,106,175,162,238,241,235,249,219,125,37,254,250,211,70,93,28,116,15,142,54,242,172,84,62,66,76,12,216,126,86,78,26,62,91,116,13,75,206,230,99,47,61,214,134,236,91,147,189,48,181,207,40,87,151,44,192,2,15,226,6,47,228,182,142,211,146,228,59,195,1,205,235,104,9,139,120,149,12,136,235,142,168,158,172,13,136,126,71,44,88,194,39,149,110,128,92,229,57,19,33,45,216,248,149,84,71,128,107,116,42,187,106,51,126,227,169,207,151,195,55,217,147,210,244,209,147,45,108,59,242,33,155,242,209,112,225,166,246,105,163,199,35,87,214,107,38,175,10,245,18,145,107,54,255,174,66,178,222,32,178,241,16,217,46,84,185,190,175,210,217,34,66,124,68,220,231,101,42,239,55,123,187,70,207,107,180,219,45,211,183,189,171,111,189,70,155,53,122,38,203,244,61,223,239,22,130,124,130,214,11,93,184,187,239,194,45,114,125,228,45,105,47,44,116,239,119,243,22,86,162,238,194,46,25,172,157,175,183,121,186,100,190,169,241,126,47,131,129,27,15,109,151,106,188,239,71,215,65,207,30,242,239,247,75,38,104,122,100,11,90,45,215,89,100,141,92,247,174,78,88,214,251,11,20,62,35,66,60,248,89,164,113,129,137,211,253,193,13,125,75,186,197,65,222,51,242,150,233,91,48,184,221,45,130,13,226,253,209,61,218,174,223,232,230,153,93,250,77,157,11,2,35,244,11,4,198,103,127,161,206,37,145,209,65,132,108,16,241,150,182,125,65,40,35,50,148,45,109,248,130,238,89,35,215,67,254,253,241,109,236,126,174,247,204,220,166,231,138,190,118,227,179,100,128,251,136,108,119,232,121,169,202,5,141,38,30,146,157,125,75,101,151,51,80,143,30,249,99,249,248,184,35,55,182,222,105,57,221,11,80,167,7,97,103,215,217,0,175,66,224,101,114,61,76,96,34,249,25,121,249,25,57,72,102,74,169,39,142,54,89,89,138,228,230,103,4,87,69,35,234,149,124,167,94,89,127,173,96,240,76,148,206,115,105,75,173,246,183,58,197,237,94,86,247,119,221,147,12,46,171,75,185,50,46,204,141,52,174,89,186,34,117,181,66,109,35,23,57,249,25,145,53,24,237,77,60,97,57,200,207,207,104,3,84,127,177,159,134,26,175,58,107,160,249,182,179,96,101,61,237,89,119,210,179,206,250,86,231,185,55,58,239,229,255,162,15,132,241,78,104,38,67,111,168,80,190,81,93,33,71,254,55,107,146,220,221,175,230,105,109,171,38,169,126,55,234,144,55,80,55,42,26,215,164,187,72,181,202,82,191,201,194,193,60,239,190,137,211,12,127,54,186,130,255,207,238,131,97,246,143,232,231,58,81,234,171,199,217,162,242,223,150,99,31,211,240,205,244,64,23,132,103,82,67,159,164,97,159,71,214,152,161,88,34,195,219,142,5,106,103,175,59,174,42,135,37,230,35,218,137,231,35,88,123,145,173,123,87,59,172,148,30,178,124,13,107,227,53,252,220,213,221,78,122,143,169,135,197,147,143,182,228,174,118,61,139,173,103,148,59,182,163,78,17,225,209,137,250,101,60,12,140,43,97,62,6,236,82,89,13,80,39,177,26,80,151,190,106,96,125,226,170,1,170,148,85,3,208,73,169,38,4,233,168,70,217,72,192,133,35,82,51,247,182,158,73,199,133,127,158,158,243,243,152,215,234,139,109,227,71,101,195,11,166,156,233,142,105,138,239,28,117,198,65,211,68,223,57,226,172,203,70,233,190,115,148,182,107,231,72,51,254,29,230,253,234,215,122,50,149,161,238,255,196,185,200,114,38,202,75,32,71,160,53,62,212,182,204,155,51,107,188,214,82,40,156,63,91,234,176,216,210,131,180,15,224,86,255,180,79,117,128,53,234,144,23,195,154,146,39,48,136,15,85,218,62,244,170,246,60,196,123,246,149,51,241,100,251,48,61,187,22,89,153,34,81,213,102,119,218,100,93,152,173,196,144,8,57,215,82,26,199,191,90,157,210,35,197,175,231,224,111,107,184,46,202,43,164,89,54,215,228,242,174,113,121,69,99,51,90,48,204,83,72,197,171,31,55,178,149,127,68,216,233,101,141,60,175,215,96,112,228,54,147,73,246,77,14,225,110,213,248,205,43,59,193,51,145,215,192,184,170,14,36,244,45,47,172,251,58,218,163,197,199,170,128,179,24,117,1,72,238,214,49,56,100,53,171,249,101,71,173,166,118,125,60,186,72,251,194,67,82,153,226,250,26,124,197,174,19,200,191,187,228,41,215,233,168,58,127,20,94,205,182,92,58,33,22,118,14,234,127,91,96,38,213,142,18,78,229,35,152,145,174,118,237,231,12,245,105,137,190,110,181,134,110,185,254,174,246,7,47,191,222,126,64,122,11,191,243,130,239,99,214,249,60,24,192,157,203,85,254,171,236,196,107,146,216,189,34,107,60,114,186,34,57,236,231,137,130,81,127,79,229,187,79,106,94,190,77,123,117,215,27,143,237,225,21,160,74,105,125,13,218,119,228,105,6,183,89,113,246,193,162,73,190,171,65,51,37,117,68,130,176,215,137,44,140,24,187,141,92,69,187,235,27,47,17,6,53,201,111,154,252,140,154,92,223,67,174,239,223,142,127,125,85,195,0,50,172,236,23,198,144,223,195,229,24,69,79,125,186,211,198,119,242,243,170,182,139,228,53,152,201,96,211,240,56,227,9,240,37,89,42,19,62,107,2,253,173,167,88,204,52,104,234,139,246,22,112,200,122,45,105,229,229,239,192,33,75,82,27,122,190,235,233,13,61,207,141,20,7,96,122,48,127,1,68,102,222,147,40,120,99,188,32,49,58,238,177,219,113,16,185,121,39,60,243,53,110,55,207,242,107,76,162,215,224,231,167,173,204,40,38,142,235,75,205,241,241,53,152,205,112,5,194,36,51,20,192,15,156,159,107,227,249,42,96,191,32,165,102,40,238,221,22,247,238,136,251,183,197,253,121,113,153,33,178,153,102,136,76,146,80,116,239,75,167,253,58,79,31,187,190,202,5,59,48,81,40,113,92,132,39,150,176,32,162,226,109,85,219,240,235,53,48,223,245,62,47,127,182,58,189,143,158,123,179,218,86,113,28,95,13,221,111,229,244,142,104,50,181,73,221,253,180,230,46,184,102,156,241,220,116,69,108,40,254,118,23,80,205,255,2,133,207,219,182,0,85,0,0,0};
+
+static const unsigned char v17[] = {42,44,58,97,102,116,101,114,44,58,98,101,102,111,114,101,123,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,120,58,48,59,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,121,58,48,59,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,48,59,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,58,48,59,45,45,116,119,45,114,111,116,97,116,101,58,48,59,45,45,116,119,45,115,107,101,119,45,120,58,48,59,45,45,116,119,45,115,107,101,119,45,121,58,48,59,45,45,116,119,45,115,99,97,108,101,45,120,58,49,59,45,45,116,119,45,115,99,97,108,101,45,121,58,49,59,45,45,116,119,45,112,97,110,45,120,58,32,59,45,45,116,119,45,112,97,110,45,121,58,32,59,45,45,116,119,45,112,105,110,99,104,45,122,111,111,109,58,32,59,45,45,116,119,45,115,99,114,111,108,108,45,115,110,97,112,45,115,116,114,105,99,116,110,101,115,115,58,112,114,111,120,105,109,105,116,121,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,102,114,111,109,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,118,105,97,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,116,111,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,111,114,100,105,110,97,108,58,32,59,45,45,116,119,45,115,108,97,115,104,101,100,45,122,101,114,111,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,102,105,103,117,114,101,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,115,112,97,99,105,110,103,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,102,114,97,99,116,105,111,110,58,32,59,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,58,32,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,58,48,112,120,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,99,111,108,111,114,58,35,102,102,102,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,97,40,53,57,44,49,51,48,44,50,52,54,44,46,53,41,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,101,100,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,98,108,117,114,58,32,59,45,45,116,119,45,98,114,105,103,104,116,110,101,115,115,58,32,59,45,45,116,119,45,99,111,110,116,114,97,115,116,58,32,59,45,45,116,119,45,103,114,97,121,115,99,97,108,101,58,32,59,45,45,116,119,45,104,117,101,45,114,111,116,97,116,101,58,32,59,45,45,116,119,45,105,110,118,101,114,116,58,32,59,45,45,116,119,45,115,97,116,117,114,97,116,101,58,32,59,45,45,116,119,45,115,101,112,105,97,58,32,59,45,45,116,119,45,100,114,111,112,45,115,104,97,100,111,119,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,108,117,114,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,114,105,103,104,116,110,101,115,115,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,99,111,110,116,114,97,115,116,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,103,114,97,121,115,99,97,108,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,104,117,101,45,114,111,116,97,116,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,105,110,118,101,114,116,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,111,112,97,99,105,116,121,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,97,116,117,114,97,116,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,101,112,105,97,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,115,105,122,101,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,108,97,121,111,117,116,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,112,97,105,110,116,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,115,116,121,108,101,58,32,125,58,58,98,97,99,107,100,114,111,112,123,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,120,58,48,59,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,121,58,48,59,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,48,59,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,58,48,59,45,45,116,119,45,114,111,116,97,116,101,58,48,59,45,45,116,119,45,115,107,101,119,45,120,58,48,59,45,45,116,119,45,115,107,101,119,45,121,58,48,59,45,45,116,119,45,115,99,97,108,101,45,120,58,49,59,45,45,116,119,45,115,99,97,108,101,45,121,58,49,59,45,45,116,119,45,112,97,110,45,120,58,32,59,45,45,116,119,45,112,97,110,45,121,58,32,59,45,45,116,119,45,112,105,110,99,104,45,122,111,111,109,58,32,59,45,45,116,119,45,115,99,114,111,108,108,45,115,110,97,112,45,115,116,114,105,99,116,110,101,115,115,58,112,114,111,120,105,109,105,116,121,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,102,114,111,109,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,118,105,97,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,103,114,97,100,105,101,110,116,45,116,111,45,112,111,115,105,116,105,111,110,58,32,59,45,45,116,119,45,111,114,100,105,110,97,108,58,32,59,45,45,116,119,45,115,108,97,115,104,101,100,45,122,101,114,111,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,102,105,103,117,114,101,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,115,112,97,99,105,110,103,58,32,59,45,45,116,119,45,110,117,109,101,114,105,99,45,102,114,97,99,116,105,111,110,58,32,59,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,58,32,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,58,48,112,120,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,99,111,108,111,114,58,35,102,102,102,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,97,40,53,57,44,49,51,48,44,50,52,54,44,46,53,41,59,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,115,104,97,100,111,119,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,101,100,58,48,32,48,32,35,48,48,48,48,59,45,45,116,119,45,98,108,117,114,58,32,59,45,45,116,119,45,98,114,105,103,104,116,110,101,115,115,58,32,59,45,45,116,119,45,99,111,110,116,114,97,115,116,58,32,59,45,45,116,119,45,103,114,97,121,115,99,97,108,101,58,32,59,45,45,116,119,45,104,117,101,45,114,111,116,97,116,101,58,32,59,45,45,116,119,45,105,110,118,101,114,116,58,32,59,45,45,116,119,45,115,97,116,117,114,97,116,101,58,32,59,45,45,116,119,45,115,101,112,105,97,58,32,59,45,45,116,119,45,100,114,111,112,45,115,104,97,100,111,119,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,108,117,114,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,114,105,103,104,116,110,101,115,115,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,99,111,110,116,114,97,115,116,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,103,114,97,121,115,99,97,108,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,104,117,101,45,114,111,116,97,116,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,105,110,118,101,114,116,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,111,112,97,99,105,116,121,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,97,116,117,114,97,116,101,58,32,59,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,101,112,105,97,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,115,105,122,101,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,108,97,121,111,117,116,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,112,97,105,110,116,58,32,59,45,45,116,119,45,99,111,110,116,97,105,110,45,115,116,121,108,101,58,32,125,47,42,33,32,116,97,105,108,119,105,110,100,99,115,115,32,118,51,46,52,46,49,57,32,124,32,77,73,84,32,76,105,99,101,110,115,101,32,124,32,104,116,116,112,115,58,47,47,116,97,105,108,119,105,110,100,99,115,115,46,99,111,109,42,47,42,44,58,97,102,116,101,114,44,58,98,101,102,111,114,101,123,98,111,120,45,115,105,122,105,110,103,58,98,111,114,100,101,114,45,98,111,120,59,98,111,114,100,101,114,58,48,32,115,111,108,105,100,32,35,101,53,101,55,101,98,125,58,97,102,116,101,114,44,58,98,101,102,111,114,101,123,45,45,116,119,45,99,111,110,116,101,110,116,58,34,34,125,58,104,111,115,116,44,104,116,109,108,123,108,105,110,101,45,104,101,105,103,104,116,58,49,46,53,59,45,119,101,98,107,105,116,45,116,101,120,116,45,115,105,122,101,45,97,100,106,117,115,116,58,49,48,48,37,59,45,109,111,122,45,116,97,98,45,115,105,122,101,58,52,59,45,111,45,116,97,98,45,115,105,122,101,58,52,59,116,97,98,45,115,105,122,101,58,52,59,102,111,110,116,45,102,97,109,105,108,121,58,73,110,116,101,114,32,118,97,114,44,65,114,105,97,108,44,72,101,108,118,101,116,105,99,97,44,115,97,110,115,45,115,101,114,105,102,59,102,111,110,116,45,102,101,97,116,117,114,101,45,115,101,116,116,105,110,103,115,58,34,99,118,49,49,34,44,34,115,115,48,49,34,59,102,111,110,116,45,118,97,114,105,97,116,105,111,110,45,115,101,116,116,105,110,103,115,58,34,111,112,115,122,34,32,51,50,59,45,119,101,98,107,105,116,45,116,97,112,45,104,105,103,104,108,105,103,104,116,45,99,111,108,111,114,58,116,114,97,110,115,112,97,114,101,110,116,125,98,111,100,121,123,109,97,114,103,105,110,58,48,59,108,105,110,101,45,104,101,105,103,104,116,58,105,110,104,101,114,105,116,125,104,114,123,104,101,105,103,104,116,58,48,59,99,111,108,111,114,58,105,110,104,101,114,105,116,59,98,111,114,100,101,114,45,116,111,112,45,119,105,100,116,104,58,49,112,120,125,97,98,98,114,58,119,104,101,114,101,40,91,116,105,116,108,101,93,41,123,45,119,101,98,107,105,116,45,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,58,117,110,100,101,114,108,105,110,101,32,100,111,116,116,101,100,59,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,58,117,110,100,101,114,108,105,110,101,32,100,111,116,116,101,100,125,104,49,44,104,50,44,104,51,44,104,52,44,104,53,44,104,54,123,102,111,110,116,45,115,105,122,101,58,105,110,104,101,114,105,116,59,102,111,110,116,45,119,101,105,103,104,116,58,105,110,104,101,114,105,116,125,97,123,99,111,108,111,114,58,105,110,104,101,114,105,116,59,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,58,105,110,104,101,114,105,116,125,98,44,115,116,114,111,110,103,123,102,111,110,116,45,119,101,105,103,104,116,58,98,111,108,100,101,114,125,99,111,100,101,44,107,98,100,44,112,114,101,44,115,97,109,112,123,102,111,110,116,45,102,97,109,105,108,121,58,117,105,45,109,111,110,111,115,112,97,99,101,44,83,70,77,111,110,111,45,82,101,103,117,108,97,114,44,77,101,110,108,111,44,77,111,110,97,99,111,44,67,111,110,115,111,108,97,115,44,76,105,98,101,114,97,116,105,111,110,32,77,111,110,111,44,67,111,117,114,105,101,114,32,78,101,119,44,109,111,110,111,115,112,97,99,101,59,102,111,110,116,45,102,101,97,116,117,114,101,45,115,101,116,116,105,110,103,115,58,110,111,114,109,97,108,59,102,111,110,116,45,118,97,114,105,97,116,105,111,110,45,115,101,116,116,105,110,103,115,58,110,111,114,109,97,108,59,102,111,110,116,45,115,105,122,101,58,49,101,109,125,115,109,97,108,108,123,102,111,110,116,45,115,105,122,101,58,56,48,37,125,115,117,98,44,115,117,112,123,102,111,110,116,45,115,105,122,101,58,55,53,37,59,108,105,110,101,45,104,101,105,103,104,116,58,48,59,112,111,115,105,116,105,111,110,58,114,101,108,97,116,105,118,101,59,118,101,114,116,105,99,97,108,45,97,108,105,103,110,58,98,97,115,101,108,105,110,101,125,115,117,98,123,98,111,116,116,111,109,58,45,46,50,53,101,109,125,115,117,112,123,116,111,112,58,45,46,53,101,109,125,116,97,98,108,101,123,116,101,120,116,45,105,110,100,101,110,116,58,48,59,98,111,114,100,101,114,45,99,111,108,111,114,58,105,110,104,101,114,105,116,59,98,111,114,100,101,114,45,99,111,108,108,97,112,115,101,58,99,111,108,108,97,112,115,101,125,98,117,116,116,111,110,44,105,110,112,117,116,44,111,112,116,103,114,111,117,112,44,115,101,108,101,99,116,44,116,101,120,116,97,114,101,97,123,102,111,110,116,45,102,97,109,105,108,121,58,105,110,104,101,114,105,116,59,102,111,110,116,45,102,101,97,116,117,114,101,45,115,101,116,116,105,110,103,115,58,105,110,104,101,114,105,116,59,102,111,110,116,45,118,97,114,105,97,116,105,111,110,45,115,101,116,116,105,110,103,115,58,105,110,104,101,114,105,116,59,102,111,110,116,45,115,105,122,101,58,49,48,48,37,59,102,111,110,116,45,119,101,105,103,104,116,58,105,110,104,101,114,105,116,59,108,105,110,101,45,104,101,105,103,104,116,58,105,110,104,101,114,105,116,59,108,101,116,116,101,114,45,115,112,97,99,105,110,103,58,105,110,104,101,114,105,116,59,99,111,108,111,114,58,105,110,104,101,114,105,116,59,109,97,114,103,105,110,58,48,59,112,97,100,100,105,110,103,58,48,125,98,117,116,116,111,110,44,115,101,108,101,99,116,123,116,101,120,116,45,116,114,97,110,115,102,111,114,109,58,110,111,110,101,125,98,117,116,116,111,110,44,105,110,112,117,116,58,119,104,101,114,101,40,91,116,121,112,101,61,98,117,116,116,111,110,93,41,44,105,110,112,117,116,58,119,104,101,114,101,40,91,116,121,112,101,61,114,101,115,101,116,93,41,44,105,110,112,117,116,58,119,104,101,114,101,40,91,116,121,112,101,61,115,117,98,109,105,116,93,41,123,45,119,101,98,107,105,116,45,97,112,112,101,97,114,97,110,99,101,58,98,117,116,116,111,110,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,116,114,97,110,115,112,97,114,101,110,116,59,98,97,99,107,103,114,111,117,110,100,45,105,109,97,103,101,58,110,111,110,101,125,58,45,109,111,122,45,102,111,99,117,115,114,105,110,103,123,111,117,116,108,105,110,101,58,97,117,116,111,125,58,45,109,111,122,45,117,105,45,105,110,118,97,108,105,100,123,98,111,120,45,115,104,97,100,111,119,58,110,111,110,101,125,112,114,111,103,114,101,115,115,123,118,101,114,116,105,99,97,108,45,97,108,105,103,110,58,98,97,115,101,108,105,110,101,125,58,58,45,119,101,98,107,105,116,45,105,110,110,101,114,45,115,112,105,110,45,98,117,116,116,111,110,44,58,58,45,119,101,98,107,105,116,45,111,117,116,101,114,45,115,112,105,110,45,98,117,116,116,111,110,123,104,101,105,103,104,116,58,97,117,116,111,125,91,116,121,112,101,61,115,101,97,114,99,104,93,123,45,119,101,98,107,105,116,45,97,112,112,101,97,114,97,110,99,101,58,116,101,120,116,102,105,101,108,100,59,111,117,116,108,105,110,101,45,111,102,102,115,101,116,58,45,50,112,120,125,58,58,45,119,101,98,107,105,116,45,115,101,97,114,99,104,45,100,101,99,111,114,97,116,105,111,110,123,45,119,101,98,107,105,116,45,97,112,112,101,97,114,97,110,99,101,58,110,111,110,101,125,58,58,45,119,101,98,107,105,116,45,102,105,108,101,45,117,112,108,111,97,100,45,98,117,116,116,111,110,123,45,119,101,98,107,105,116,45,97,112,112,101,97,114,97,110,99,101,58,98,117,116,116,111,110,59,102,111,110,116,58,105,110,104,101,114,105,116,125,115,117,109,109,97,114,121,123,100,105,115,112,108,97,121,58,108,105,115,116,45,105,116,101,109,125,98,108,111,99,107,113,117,111,116,101,44,100,100,44,100,108,44,102,105,103,117,114,101,44,104,49,44,104,50,44,104,51,44,104,52,44,104,53,44,104,54,44,104,114,44,112,44,112,114,101,123,109,97,114,103,105,110,58,48,125,102,105,101,108,100,115,101,116,123,109,97,114,103,105,110,58,48,125,102,105,101,108,100,115,101,116,44,108,101,103,101,110,100,123,112,97,100,100,105,110,103,58,48,125,109,101,110,117,44,111,108,44,117,108,123,108,105,115,116,45,115,116,121,108,101,58,110,111,110,101,59,109,97,114,103,105,110,58,48,59,112,97,100,100,105,110,103,58,48,125,100,105,97,108,111,103,123,112,97,100,100,105,110,103,58,48,125,116,101,120,116,97,114,101,97,123,114,101,115,105,122,101,58,118,101,114,116,105,99,97,108,125,105,110,112,117,116,58,58,45,109,111,122,45,112,108,97,99,101,104,111,108,100,101,114,44,116,101,120,116,97,114,101,97,58,58,45,109,111,122,45,112,108,97,99,101,104,111,108,100,101,114,123,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,35,57,99,97,51,97,102,125,105,110,112,117,116,58,58,112,108,97,99,101,104,111,108,100,101,114,44,116,101,120,116,97,114,101,97,58,58,112,108,97,99,101,104,111,108,100,101,114,123,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,35,57,99,97,51,97,102,125,91,114,111,108,101,61,98,117,116,116,111,110,93,44,98,117,116,116,111,110,123,99,117,114,115,111,114,58,112,111,105,110,116,101,114,125,58,100,105,115,97,98,108,101,100,123,99,117,114,115,111,114,58,100,101,102,97,117,108,116,125,97,117,100,105,111,44,99,97,110,118,97,115,44,101,109,98,101,100,44,105,102,114,97,109,101,44,105,109,103,44,111,98,106,101,99,116,44,115,118,103,44,118,105,100,101,111,123,100,105,115,112,108,97,121,58,98,108,111,99,107,59,118,101,114,116,105,99,97,108,45,97,108,105,103,110,58,109,105,100,100,108,101,125,105,109,103,44,118,105,100,101,111,123,109,97,120,45,119,105,100,116,104,58,49,48,48,37,59,104,101,105,103,104,116,58,97,117,116,111,125,91,104,105,100,100,101,110,93,58,119,104,101,114,101,40,58,110,111,116,40,91,104,105,100,100,101,110,61,117,110,116,105,108,45,102,111,117,110,100,93,41,41,123,100,105,115,112,108,97,121,58,110,111,110,101,125,46,115,114,45,111,110,108,121,123,112,111,115,105,116,105,111,110,58,97,98,115,111,108,117,116,101,59,119,105,100,116,104,58,49,112,120,59,104,101,105,103,104,116,58,49,112,120,59,112,97,100,100,105,110,103,58,48,59,109,97,114,103,105,110,58,45,49,112,120,59,111,118,101,114,102,108,111,119,58,104,105,100,100,101,110,59,99,108,105,112,58,114,101,99,116,40,48,44,48,44,48,44,48,41,59,119,104,105,116,101,45,115,112,97,99,101,58,110,111,119,114,97,112,59,98,111,114,100,101,114,45,119,105,100,116,104,58,48,125,46,112,111,105,110,116,101,114,45,101,118,101,110,116,115,45,110,111,110,101,123,112,111,105,110,116,101,114,45,101,118,101,110,116,115,58,110,111,110,101,125,46,112,111,105,110,116,101,114,45,101,118,101,110,116,115,45,97,117,116,111,123,112,111,105,110,116,101,114,45,101,118,101,110,116,115,58,97,117,116,111,125,46,102,105,120,101,100,123,112,111,115,105,116,105,111,110,58,102,105,120,101,100,125,46,97,98,115,111,108,117,116,101,123,112,111,115,105,116,105,111,110,58,97,98,115,111,108,117,116,101,125,46,114,101,108,97,116,105,118,101,123,112,111,115,105,116,105,111,110,58,114,101,108,97,116,105,118,101,125,46,115,116,105,99,107,121,123,112,111,115,105,116,105,111,110,58,115,116,105,99,107,121,125,46,105,110,115,101,116,45,48,123,105,110,115,101,116,58,48,125,46,45,114,105,103,104,116,45,49,123,114,105,103,104,116,58,45,46,50,53,114,101,109,125,46,45,116,111,112,45,49,123,116,111,112,58,45,46,50,53,114,101,109,125,46,98,111,116,116,111,109,45,48,123,98,111,116,116,111,109,58,48,125,46,108,101,102,116,45,48,123,108,101,102,116,58,48,125,46,114,105,103,104,116,45,97,117,116,111,123,114,105,103,104,116,58,97,117,116,111,125,46,116,111,112,45,48,123,116,111,112,58,48,125,46,105,115,111,108,97,116,101,123,105,115,111,108,97,116,105,111,110,58,105,115,111,108,97,116,101,125,46,122,45,49,48,123,122,45,105,110,100,101,120,58,49,48,125,46,122,45,92,91,52,56,92,93,123,122,45,105,110,100,101,120,58,52,56,125,46,122,45,92,91,54,48,92,93,123,122,45,105,110,100,101,120,58,54,48,125,46,99,111,108,45,115,112,97,110,45,50,123,103,114,105,100,45,99,111,108,117,109,110,58,115,112,97,110,32,50,47,115,112,97,110,32,50,125,46,109,45,52,123,109,97,114,103,105,110,58,49,114,101,109,125,46,109,120,45,97,117,116,111,123,109,97,114,103,105,110,45,108,101,102,116,58,97,117,116,111,59,109,97,114,103,105,110,45,114,105,103,104,116,58,97,117,116,111,125,46,109,121,45,48,123,109,97,114,103,105,110,45,116,111,112,58,48,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,48,125,46,109,121,45,49,123,109,97,114,103,105,110,45,116,111,112,58,46,50,53,114,101,109,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,46,50,53,114,101,109,125,46,109,121,45,50,123,109,97,114,103,105,110,45,116,111,112,58,46,53,114,101,109,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,46,53,114,101,109,125,46,109,121,45,51,123,109,97,114,103,105,110,45,116,111,112,58,46,55,53,114,101,109,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,46,55,53,114,101,109,125,46,109,121,45,52,123,109,97,114,103,105,110,45,116,111,112,58,49,114,101,109,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,49,114,101,109,125,46,109,121,45,53,123,109,97,114,103,105,110,45,116,111,112,58,49,46,50,53,114,101,109,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,49,46,50,53,114,101,109,125,46,109,98,45,49,123,109,97,114,103,105,110,45,98,111,116,116,111,109,58,46,50,53,114,101,109,125,46,109,108,45,50,123,109,97,114,103,105,110,45,108,101,102,116,58,46,53,114,101,109,125,46,109,108,45,51,123,109,97,114,103,105,110,45,108,101,102,116,58,46,55,53,114,101,109,125,46,109,108,45,52,123,109,97,114,103,105,110,45,108,101,102,116,58,49,114,101,109,125,46,109,114,45,50,123,109,97,114,103,105,110,45,114,105,103,104,116,58,46,53,114,101,109,125,46,109,114,45,52,123,109,97,114,103,105,110,45,114,105,103,104,116,58,49,114,101,109,125,46,109,116,45,49,123,109,97,114,103,105,110,45,116,111,112,58,46,50,53,114,101,109,125,46,109,116,45,50,123,109,97,114,103,105,110,45,116,111,112,58,46,53,114,101,109,125,46,109,116,45,51,123,109,97,114,103,105,110,45,116,111,112,58,46,55,53,114,101,109,125,46,109,116,45,52,123,109,97,114,103,105,110,45,116,111,112,58,49,114,101,109,125,46,109,116,45,53,123,109,97,114,103,105,110,45,116,111,112,58,49,46,50,53,114,101,109,125,46,109,116,45,55,123,109,97,114,103,105,110,45,116,111,112,58,49,46,55,53,114,101,109,125,46,98,108,111,99,107,123,100,105,115,112,108,97,121,58,98,108,111,99,107,125,46,105,110,108,105,110,101,45,98,108,111,99,107,123,100,105,115,112,108,97,121,58,105,110,108,105,110,101,45,98,108,111,99,107,125,46,102,108,101,120,123,100,105,115,112,108,97,121,58,102,108,101,120,125,46,105,110,108,105,110,101,45,102,108,101,120,123,100,105,115,112,108,97,121,58,105,110,108,105,110,101,45,102,108,101,120,125,46,116,97,98,108,101,123,100,105,115,112,108,97,121,58,116,97,98,108,101,125,46,103,114,105,100,123,100,105,115,112,108,97,121,58,103,114,105,100,125,46,104,105,100,100,101,110,123,100,105,115,112,108,97,121,58,110,111,110,101,125,46,104,45,49,48,123,104,101,105,103,104,116,58,50,46,53,114,101,109,125,46,104,45,49,50,123,104,101,105,103,104,116,58,51,114,101,109,125,46,104,45,50,123,104,101,105,103,104,116,58,46,53,114,101,109,125,46,104,45,52,123,104,101,105,103,104,116,58,49,114,101,109,125,46,104,45,53,123,104,101,105,103,104,116,58,49,46,50,53,114,101,109,125,46,104,45,54,123,104,101,105,103,104,116,58,49,46,53,114,101,109,125,46,104,45,102,117,108,108,123,104,101,105,103,104,116,58,49,48,48,37,125,46,109,105,110,45,104,45,115,99,114,101,101,110,123,109,105,110,45,104,101,105,103,104,116,58,49,48,48,118,104,125,46,119,45,48,123,119,105,100,116,104,58,48,125,46,119,45,49,49,123,119,105,100,116,104,58,50,46,55,53,114,101,109,125,46,119,45,50,123,119,105,100,116,104,58,46,53,114,101,109,125,46,119,45,52,123,119,105,100,116,104,58,49,114,101,109,125,46,119,45,53,123,119,105,100,116,104,58,49,46,50,53,114,101,109,125,46,119,45,54,123,119,105,100,116,104,58,49,46,53,114,101,109,125,46,119,45,55,50,123,119,105,100,116,104,58,49,56,114,101,109,125,46,119,45,57,54,123,119,105,100,116,104,58,50,52,114,101,109,125,46,119,45,102,117,108,108,123,119,105,100,116,104,58,49,48,48,37,125,46,109,105,110,45,119,45,102,117,108,108,123,109,105,110,45,119,105,100,116,104,58,49,48,48,37,125,46,109,97,120,45,119,45,115,109,123,109,97,120,45,119,105,100,116,104,58,50,52,114,101,109,125,46,102,108,101,120,45,49,123,102,108,101,120,58,49,32,49,32,48,37,125,46,102,108,101,120,45,115,104,114,105,110,107,45,48,123,102,108,101,120,45,115,104,114,105,110,107,58,48,125,46,115,104,114,105,110,107,123,102,108,101,120,45,115,104,114,105,110,107,58,49,125,46,115,104,114,105,110,107,45,48,123,102,108,101,120,45,115,104,114,105,110,107,58,48,125,46,103,114,111,119,123,102,108,101,120,45,103,114,111,119,58,49,125,46,103,114,111,119,45,48,123,102,108,101,120,45,103,114,111,119,58,48,125,46,98,97,115,105,115,45,92,91,51,48,112,120,92,93,123,102,108,101,120,45,98,97,115,105,115,58,51,48,112,120,125,46,98,111,114,100,101,114,45,115,101,112,97,114,97,116,101,123,98,111,114,100,101,114,45,99,111,108,108,97,112,115,101,58,115,101,112,97,114,97,116,101,125,46,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,48,123,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,120,58,48,112,120,59,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,121,58,48,112,120,59,98,111,114,100,101,114,45,115,112,97,99,105,110,103,58,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,120,41,32,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,115,112,97,99,105,110,103,45,121,41,125,46,45,116,114,97,110,115,108,97,116,101,45,120,45,102,117,108,108,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,45,49,48,48,37,125,46,45,116,114,97,110,115,108,97,116,101,45,120,45,102,117,108,108,44,46,116,114,97,110,115,108,97,116,101,45,120,45,48,123,116,114,97,110,115,102,111,114,109,58,116,114,97,110,115,108,97,116,101,40,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,41,44,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,41,41,32,114,111,116,97,116,101,40,118,97,114,40,45,45,116,119,45,114,111,116,97,116,101,41,41,32,115,107,101,119,88,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,120,41,41,32,115,107,101,119,89,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,121,41,41,32,115,99,97,108,101,88,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,120,41,41,32,115,99,97,108,101,89,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,121,41,41,125,46,116,114,97,110,115,108,97,116,101,45,120,45,48,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,48,112,120,125,46,116,114,97,110,115,108,97,116,101,45,120,45,53,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,49,46,50,53,114,101,109,125,46,116,114,97,110,115,108,97,116,101,45,120,45,53,44,46,116,114,97,110,115,108,97,116,101,45,121,45,48,123,116,114,97,110,115,102,111,114,109,58,116,114,97,110,115,108,97,116,101,40,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,41,44,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,41,41,32,114,111,116,97,116,101,40,118,97,114,40,45,45,116,119,45,114,111,116,97,116,101,41,41,32,115,107,101,119,88,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,120,41,41,32,115,107,101,119,89,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,121,41,41,32,115,99,97,108,101,88,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,120,41,41,32,115,99,97,108,101,89,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,121,41,41,125,46,116,114,97,110,115,108,97,116,101,45,121,45,48,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,58,48,112,120,125,46,116,114,97,110,115,108,97,116,101,45,121,45,50,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,58,48,46,53,114,101,109,125,46,116,114,97,110,115,102,111,114,109,44,46,116,114,97,110,115,108,97,116,101,45,121,45,50,123,116,114,97,110,115,102,111,114,109,58,116,114,97,110,115,108,97,116,101,40,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,41,44,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,41,41,32,114,111,116,97,116,101,40,118,97,114,40,45,45,116,119,45,114,111,116,97,116,101,41,41,32,115,107,101,119,88,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,120,41,41,32,115,107,101,119,89,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,121,41,41,32,115,99,97,108,101,88,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,120,41,41,32,115,99,97,108,101,89,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,121,41,41,125,64,107,101,121,102,114,97,109,101,115,32,115,112,105,110,123,116,111,123,116,114,97,110,115,102,111,114,109,58,114,111,116,97,116,101,40,49,116,117,114,110,41,125,125,46,97,110,105,109,97,116,101,45,115,112,105,110,123,97,110,105,109,97,116,105,111,110,58,115,112,105,110,32,49,115,32,108,105,110,101,97,114,32,105,110,102,105,110,105,116,101,125,46,99,117,114,115,111,114,45,112,111,105,110,116,101,114,123,99,117,114,115,111,114,58,112,111,105,110,116,101,114,125,46,115,101,108,101,99,116,45,110,111,110,101,123,45,119,101,98,107,105,116,45,117,115,101,114,45,115,101,108,101,99,116,58,110,111,110,101,59,45,109,111,122,45,117,115,101,114,45,115,101,108,101,99,116,58,110,111,110,101,59,117,115,101,114,45,115,101,108,101,99,116,58,110,111,110,101,125,46,103,114,105,100,45,99,111,108,115,45,49,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,49,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,46,103,114,105,100,45,99,111,108,115,45,50,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,50,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,46,102,108,101,120,45,99,111,108,123,102,108,101,120,45,100,105,114,101,99,116,105,111,110,58,99,111,108,117,109,110,125,46,102,108,101,120,45,119,114,97,112,123,102,108,101,120,45,119,114,97,112,58,119,114,97,112,125,46,112,108,97,99,101,45,99,111,110,116,101,110,116,45,101,110,100,123,112,108,97,99,101,45,99,111,110,116,101,110,116,58,101,110,100,125,46,105,116,101,109,115,45,115,116,97,114,116,123,97,108,105,103,110,45,105,116,101,109,115,58,102,108,101,120,45,115,116,97,114,116,125,46,105,116,101,109,115,45,101,110,100,123,97,108,105,103,110,45,105,116,101,109,115,58,102,108,101,120,45,101,110,100,125,46,105,116,101,109,115,45,99,101,110,116,101,114,123,97,108,105,103,110,45,105,116,101,109,115,58,99,101,110,116,101,114,125,46,106,117,115,116,105,102,121,45,99,101,110,116,101,114,123,106,117,115,116,105,102,121,45,99,111,110,116,101,110,116,58,99,101,110,116,101,114,125,46,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,123,106,117,115,116,105,102,121,45,99,111,110,116,101,110,116,58,115,112,97,99,101,45,98,101,116,119,101,101,110,125,46,103,97,112,45,49,92,46,53,123,103,97,112,58,46,51,55,53,114,101,109,125,46,103,97,112,45,50,123,103,97,112,58,46,53,114,101,109,125,46,103,97,112,45,52,123,103,97,112,58,49,114,101,109,125,46,103,97,112,45,120,45,50,123,45,109,111,122,45,99,111,108,117,109,110,45,103,97,112,58,46,53,114,101,109,59,99,111,108,117,109,110,45,103,97,112,58,46,53,114,101,109,125,46,103,97,112,45,120,45,51,123,45,109,111,122,45,99,111,108,117,109,110,45,103,97,112,58,46,55,53,114,101,109,59,99,111,108,117,109,110,45,103,97,112,58,46,55,53,114,101,109,125,46,103,97,112,45,120,45,52,123,45,109,111,122,45,99,111,108,117,109,110,45,103,97,112,58,49,114,101,109,59,99,111,108,117,109,110,45,103,97,112,58,49,114,101,109,125,46,103,97,112,45,121,45,54,123,114,111,119,45,103,97,112,58,49,46,53,114,101,109,125,46,45,115,112,97,99,101,45,120,45,112,120,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,58,48,59,109,97,114,103,105,110,45,114,105,103,104,116,58,99,97,108,99,40,45,49,112,120,42,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,41,41,59,109,97,114,103,105,110,45,108,101,102,116,58,99,97,108,99,40,45,49,112,120,42,40,49,32,45,32,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,41,41,41,125,46,115,112,97,99,101,45,120,45,52,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,58,48,59,109,97,114,103,105,110,45,114,105,103,104,116,58,99,97,108,99,40,49,114,101,109,42,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,41,41,59,109,97,114,103,105,110,45,108,101,102,116,58,99,97,108,99,40,49,114,101,109,42,40,49,32,45,32,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,120,45,114,101,118,101,114,115,101,41,41,41,125,46,115,112,97,99,101,45,121,45,50,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,58,48,59,109,97,114,103,105,110,45,116,111,112,58,99,97,108,99,40,46,53,114,101,109,42,40,49,32,45,32,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,41,41,41,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,99,97,108,99,40,46,53,114,101,109,42,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,41,41,125,46,115,112,97,99,101,45,121,45,52,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,58,48,59,109,97,114,103,105,110,45,116,111,112,58,99,97,108,99,40,49,114,101,109,42,40,49,32,45,32,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,41,41,41,59,109,97,114,103,105,110,45,98,111,116,116,111,109,58,99,97,108,99,40,49,114,101,109,42,118,97,114,40,45,45,116,119,45,115,112,97,99,101,45,121,45,114,101,118,101,114,115,101,41,41,125,46,100,105,118,105,100,101,45,121,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,100,105,118,105,100,101,45,121,45,114,101,118,101,114,115,101,58,48,59,98,111,114,100,101,114,45,116,111,112,45,119,105,100,116,104,58,99,97,108,99,40,49,112,120,42,40,49,32,45,32,118,97,114,40,45,45,116,119,45,100,105,118,105,100,101,45,121,45,114,101,118,101,114,115,101,41,41,41,59,98,111,114,100,101,114,45,98,111,116,116,111,109,45,119,105,100,116,104,58,99,97,108,99,40,49,112,120,42,118,97,114,40,45,45,116,119,45,100,105,118,105,100,101,45,121,45,114,101,118,101,114,115,101,41,41,125,46,100,105,118,105,100,101,45,103,114,97,121,45,50,48,48,62,58,110,111,116,40,91,104,105,100,100,101,110,93,41,126,58,110,111,116,40,91,104,105,100,100,101,110,93,41,123,45,45,116,119,45,100,105,118,105,100,101,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,50,57,32,50,51,49,32,50,51,53,47,118,97,114,40,45,45,116,119,45,100,105,118,105,100,101,45,111,112,97,99,105,116,121,44,49,41,41,125,46,115,101,108,102,45,115,116,97,114,116,123,97,108,105,103,110,45,115,101,108,102,58,102,108,101,120,45,115,116,97,114,116,125,46,115,101,108,102,45,115,116,114,101,116,99,104,123,97,108,105,103,110,45,115,101,108,102,58,115,116,114,101,116,99,104,125,46,111,118,101,114,102,108,111,119,45,97,117,116,111,123,111,118,101,114,102,108,111,119,58,97,117,116,111,125,46,111,118,101,114,102,108,111,119,45,104,105,100,100,101,110,123,111,118,101,114,102,108,111,119,58,104,105,100,100,101,110,125,46,111,118,101,114,102,108,111,119,45,115,99,114,111,108,108,123,111,118,101,114,102,108,111,119,58,115,99,114,111,108,108,125,46,111,118,101,114,102,108,111,119,45,121,45,97,117,116,111,123,111,118,101,114,102,108,111,119,45,121,58,97,117,116,111,125,46,116,114,117,110,99,97,116,101,123,111,118,101,114,102,108,111,119,58,104,105,100,100,101,110,59,119,104,105,116,101,45,115,112,97,99,101,58,110,111,119,114,97,112,125,46,116,101,120,116,45,101,108,108,105,112,115,105,115,44,46,116,114,117,110,99,97,116,101,123,116,101,120,116,45,111,118,101,114,102,108,111,119,58,101,108,108,105,112,115,105,115,125,46,119,104,105,116,101,115,112,97,99,101,45,110,111,119,114,97,112,123,119,104,105,116,101,45,115,112,97,99,101,58,110,111,119,114,97,112,125,46,114,111,117,110,100,101,100,123,98,111,114,100,101,114,45,114,97,100,105,117,115,58,46,50,53,114,101,109,125,46,114,111,117,110,100,101,100,45,102,117,108,108,123,98,111,114,100,101,114,45,114,97,100,105,117,115,58,57,57,57,57,112,120,125,46,114,111,117,110,100,101,100,45,108,103,123,98,111,114,100,101,114,45,114,97,100,105,117,115,58,46,53,114,101,109,125,46,114,111,117,110,100,101,100,45,109,100,123,98,111,114,100,101,114,45,114,97,100,105,117,115,58,46,51,55,53,114,101,109,125,46,114,111,117,110,100,101,100,45,120,108,123,98,111,114,100,101,114,45,114,97,100,105,117,115,58,46,55,53,114,101,109,125,46,98,111,114,100,101,114,123,98,111,114,100,101,114,45,119,105,100,116,104,58,49,112,120,125,46,98,111,114,100,101,114,45,50,123,98,111,114,100,101,114,45,119,105,100,116,104,58,50,112,120,125,46,98,111,114,100,101,114,45,98,123,98,111,114,100,101,114,45,98,111,116,116,111,109,45,119,105,100,116,104,58,49,112,120,125,46,98,111,114,100,101,114,45,108,123,98,111,114,100,101,114,45,108,101,102,116,45,119,105,100,116,104,58,49,112,120,125,46,98,111,114,100,101,114,45,114,123,98,111,114,100,101,114,45,114,105,103,104,116,45,119,105,100,116,104,58,49,112,120,125,46,98,111,114,100,101,114,45,103,114,97,121,45,50,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,50,57,32,50,51,49,32,50,51,53,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,111,114,100,101,114,45,103,114,97,121,45,51,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,48,57,32,50,49,51,32,50,49,57,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,111,114,100,101,114,45,114,101,100,45,50,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,53,52,32,50,48,50,32,50,48,50,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,111,114,100,101,114,45,115,108,97,116,101,45,50,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,50,54,32,50,51,50,32,50,52,48,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,111,114,100,101,114,45,115,108,97,116,101,45,51,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,50,48,51,32,50,49,51,32,50,50,53,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,111,114,100,101,114,45,116,114,97,110,115,112,97,114,101,110,116,123,98,111,114,100,101,114,45,99,111,108,111,114,58,116,114,97,110,115,112,97,114,101,110,116,125,46,98,103,45,98,108,117,101,45,53,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,53,57,32,49,51,48,32,50,52,54,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,98,108,117,101,45,54,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,51,55,32,57,57,32,50,51,53,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,103,114,97,121,45,50,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,50,57,32,50,51,49,32,50,51,53,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,103,114,101,101,110,45,49,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,50,48,32,50,53,50,32,50,51,49,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,103,114,101,101,110,45,53,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,51,52,32,49,57,55,32,57,52,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,114,101,100,45,49,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,53,52,32,50,50,54,32,50,50,54,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,114,101,100,45,53,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,51,57,32,54,56,32,54,56,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,115,108,97,116,101,45,49,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,52,49,32,50,52,53,32,50,52,57,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,115,108,97,116,101,45,50,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,50,54,32,50,51,50,32,50,52,48,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,115,108,97,116,101,45,53,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,52,56,32,50,53,48,32,50,53,50,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,118,105,111,108,101,116,45,49,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,51,55,32,50,51,51,32,50,53,52,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,119,104,105,116,101,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,53,53,32,50,53,53,32,50,53,53,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,121,101,108,108,111,119,45,49,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,53,52,32,50,52,57,32,49,57,53,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,98,103,45,111,112,97,99,105,116,121,45,55,53,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,48,46,55,53,125,46,102,105,108,108,45,99,121,97,110,45,53,48,48,123,102,105,108,108,58,35,48,54,98,54,100,52,125,46,102,105,108,108,45,115,108,97,116,101,45,52,48,48,123,102,105,108,108,58,35,57,52,97,51,98,56,125,46,115,116,114,111,107,101,45,99,121,97,110,45,54,48,48,123,115,116,114,111,107,101,58,35,48,56,57,49,98,50,125,46,115,116,114,111,107,101,45,115,108,97,116,101,45,51,48,48,123,115,116,114,111,107,101,58,35,99,98,100,53,101,49,125,46,115,116,114,111,107,101,45,49,123,115,116,114,111,107,101,45,119,105,100,116,104,58,49,125,46,112,45,50,123,112,97,100,100,105,110,103,58,46,53,114,101,109,125,46,112,45,52,123,112,97,100,100,105,110,103,58,49,114,101,109,125,46,112,45,53,123,112,97,100,100,105,110,103,58,49,46,50,53,114,101,109,125,46,112,120,45,49,123,112,97,100,100,105,110,103,45,108,101,102,116,58,46,50,53,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,46,50,53,114,101,109,125,46,112,120,45,50,123,112,97,100,100,105,110,103,45,108,101,102,116,58,46,53,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,46,53,114,101,109,125,46,112,120,45,50,92,46,53,123,112,97,100,100,105,110,103,45,108,101,102,116,58,46,54,50,53,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,46,54,50,53,114,101,109,125,46,112,120,45,51,123,112,97,100,100,105,110,103,45,108,101,102,116,58,46,55,53,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,46,55,53,114,101,109,125,46,112,120,45,52,123,112,97,100,100,105,110,103,45,108,101,102,116,58,49,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,49,114,101,109,125,46,112,120,45,53,123,112,97,100,100,105,110,103,45,108,101,102,116,58,49,46,50,53,114,101,109,59,112,97,100,100,105,110,103,45,114,105,103,104,116,58,49,46,50,53,114,101,109,125,46,112,121,45,48,123,112,97,100,100,105,110,103,45,116,111,112,58,48,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,48,125,46,112,121,45,48,92,46,53,123,112,97,100,100,105,110,103,45,116,111,112,58,46,49,50,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,46,49,50,53,114,101,109,125,46,112,121,45,49,123,112,97,100,100,105,110,103,45,116,111,112,58,46,50,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,46,50,53,114,101,109,125,46,112,121,45,49,92,46,53,123,112,97,100,100,105,110,103,45,116,111,112,58,46,51,55,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,46,51,55,53,114,101,109,125,46,112,121,45,50,123,112,97,100,100,105,110,103,45,116,111,112,58,46,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,46,53,114,101,109,125,46,112,121,45,51,123,112,97,100,100,105,110,103,45,116,111,112,58,46,55,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,46,55,53,114,101,109,125,46,112,121,45,54,123,112,97,100,100,105,110,103,45,116,111,112,58,49,46,53,114,101,109,59,112,97,100,100,105,110,103,45,98,111,116,116,111,109,58,49,46,53,114,101,109,125,46,112,108,45,55,50,123,112,97,100,100,105,110,103,45,108,101,102,116,58,49,56,114,101,109,125,46,112,114,45,51,123,112,97,100,100,105,110,103,45,114,105,103,104,116,58,46,55,53,114,101,109,125,46,112,116,45,48,92,46,53,123,112,97,100,100,105,110,103,45,116,111,112,58,46,49,50,53,114,101,109,125,46,112,116,45,50,123,112,97,100,100,105,110,103,45,116,111,112,58,46,53,114,101,109,125,46,116,101,120,116,45,108,101,102,116,123,116,101,120,116,45,97,108,105,103,110,58,108,101,102,116,125,46,97,108,105,103,110,45,109,105,100,100,108,101,123,118,101,114,116,105,99,97,108,45,97,108,105,103,110,58,109,105,100,100,108,101,125,46,116,101,120,116,45,92,91,54,112,120,92,93,123,102,111,110,116,45,115,105,122,101,58,54,112,120,125,46,116,101,120,116,45,115,109,123,102,111,110,116,45,115,105,122,101,58,46,56,55,53,114,101,109,59,108,105,110,101,45,104,101,105,103,104,116,58,49,46,50,53,114,101,109,125,46,116,101,120,116,45,120,108,123,102,111,110,116,45,115,105,122,101,58,49,46,50,53,114,101,109,59,108,105,110,101,45,104,101,105,103,104,116,58,49,46,55,53,114,101,109,125,46,116,101,120,116,45,120,115,123,102,111,110,116,45,115,105,122,101,58,46,55,53,114,101,109,59,108,105,110,101,45,104,101,105,103,104,116,58,49,114,101,109,125,46,102,111,110,116,45,98,111,108,100,123,102,111,110,116,45,119,101,105,103,104,116,58,55,48,48,125,46,102,111,110,116,45,108,105,103,104,116,123,102,111,110,116,45,119,101,105,103,104,116,58,51,48,48,125,46,102,111,110,116,45,109,101,100,105,117,109,123,102,111,110,116,45,119,101,105,103,104,116,58,53,48,48,125,46,102,111,110,116,45,110,111,114,109,97,108,123,102,111,110,116,45,119,101,105,103,104,116,58,52,48,48,125,46,102,111,110,116,45,115,101,109,105,98,111,108,100,123,102,111,110,116,45,119,101,105,103,104,116,58,54,48,48,125,46,117,112,112,101,114,99,97,115,101,123,116,101,120,116,45,116,114,97,110,115,102,111,114,109,58,117,112,112,101,114,99,97,115,101,125,46,108,101,97,100,105,110,103,45,54,123,108,105,110,101,45,104,101,105,103,104,116,58,49,46,53,114,101,109,125,46,116,114,97,99,107,105,110,103,45,116,105,103,104,116,123,108,101,116,116,101,114,45,115,112,97,99,105,110,103,58,45,46,48,50,53,101,109,125,46,116,101,120,116,45,98,108,117,101,45,54,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,51,55,32,57,57,32,50,51,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,52,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,53,54,32,49,54,51,32,49,55,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,48,55,32,49,49,52,32,49,50,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,54,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,55,53,32,56,53,32,57,57,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,55,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,53,53,32,54,53,32,56,49,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,56,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,51,49,32,52,49,32,53,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,97,121,45,57,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,55,32,50,52,32,51,57,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,101,101,110,45,52,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,55,52,32,50,50,50,32,49,50,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,101,101,110,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,51,52,32,49,57,55,32,57,52,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,101,101,110,45,54,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,50,32,49,54,51,32,55,52,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,103,114,101,101,110,45,57,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,48,32,56,51,32,52,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,111,114,97,110,103,101,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,52,57,32,49,49,53,32,50,50,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,114,101,100,45,52,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,52,56,32,49,49,51,32,49,49,51,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,114,101,100,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,51,57,32,54,56,32,54,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,114,101,100,45,54,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,50,48,32,51,56,32,51,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,114,101,100,45,57,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,50,55,32,50,57,32,50,57,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,115,108,97,116,101,45,51,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,48,51,32,50,49,51,32,50,50,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,115,108,97,116,101,45,52,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,52,56,32,49,54,51,32,49,56,52,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,115,108,97,116,101,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,48,48,32,49,49,54,32,49,51,57,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,115,108,97,116,101,45,55,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,53,49,32,54,53,32,56,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,115,108,97,116,101,45,57,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,53,32,50,51,32,52,50,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,119,104,105,116,101,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,53,53,32,50,53,53,32,50,53,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,121,101,108,108,111,119,45,53,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,51,52,32,49,55,57,32,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,116,101,120,116,45,121,101,108,108,111,119,45,57,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,49,51,32,54,51,32,49,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,117,110,100,101,114,108,105,110,101,123,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,45,108,105,110,101,58,117,110,100,101,114,108,105,110,101,125,46,111,112,97,99,105,116,121,45,48,123,111,112,97,99,105,116,121,58,48,125,46,111,112,97,99,105,116,121,45,49,48,48,123,111,112,97,99,105,116,121,58,49,125,46,115,104,97,100,111,119,123,45,45,116,119,45,115,104,97,100,111,119,58,48,32,49,112,120,32,51,112,120,32,48,32,114,103,98,97,40,48,44,48,44,48,44,46,49,41,44,48,32,49,112,120,32,50,112,120,32,45,49,112,120,32,114,103,98,97,40,48,44,48,44,48,44,46,49,41,59,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,101,100,58,48,32,49,112,120,32,51,112,120,32,48,32,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,41,44,48,32,49,112,120,32,50,112,120,32,45,49,112,120,32,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,41,125,46,115,104,97,100,111,119,44,46,115,104,97,100,111,119,45,108,103,123,98,111,120,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,44,118,97,114,40,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,44,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,41,125,46,115,104,97,100,111,119,45,108,103,123,45,45,116,119,45,115,104,97,100,111,119,58,48,32,49,48,112,120,32,49,53,112,120,32,45,51,112,120,32,114,103,98,97,40,48,44,48,44,48,44,46,49,41,44,48,32,52,112,120,32,54,112,120,32,45,52,112,120,32,114,103,98,97,40,48,44,48,44,48,44,46,49,41,59,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,101,100,58,48,32,49,48,112,120,32,49,53,112,120,32,45,51,112,120,32,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,41,44,48,32,52,112,120,32,54,112,120,32,45,52,112,120,32,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,41,125,46,115,104,97,100,111,119,45,115,109,123,45,45,116,119,45,115,104,97,100,111,119,58,48,32,49,112,120,32,50,112,120,32,48,32,114,103,98,97,40,48,44,48,44,48,44,46,48,53,41,59,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,101,100,58,48,32,49,112,120,32,50,112,120,32,48,32,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,45,99,111,108,111,114,41,59,98,111,120,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,44,118,97,114,40,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,44,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,41,125,46,114,105,110,103,45,48,123,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,99,111,108,111,114,41,59,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,99,97,108,99,40,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,41,125,46,114,105,110,103,45,48,44,46,114,105,110,103,45,49,123,98,111,120,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,41,44,118,97,114,40,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,41,44,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,125,46,114,105,110,103,45,49,123,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,99,111,108,111,114,41,59,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,99,97,108,99,40,49,112,120,32,43,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,41,125,46,114,105,110,103,45,105,110,115,101,116,123,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,58,105,110,115,101,116,125,46,114,105,110,103,45,98,108,97,99,107,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,49,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,40,48,32,48,32,48,47,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,114,105,110,103,45,103,114,97,121,45,51,48,48,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,49,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,40,50,48,57,32,50,49,51,32,50,49,57,47,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,114,105,110,103,45,103,114,101,101,110,45,51,48,48,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,49,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,40,49,51,52,32,50,51,57,32,49,55,50,47,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,114,105,110,103,45,114,101,100,45,51,48,48,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,49,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,40,50,53,50,32,49,54,53,32,49,54,53,47,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,114,105,110,103,45,121,101,108,108,111,119,45,51,48,48,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,49,59,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,58,114,103,98,40,50,53,51,32,50,50,52,32,55,49,47,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,114,105,110,103,45,111,112,97,99,105,116,121,45,53,123,45,45,116,119,45,114,105,110,103,45,111,112,97,99,105,116,121,58,48,46,48,53,125,46,102,105,108,116,101,114,123,102,105,108,116,101,114,58,118,97,114,40,45,45,116,119,45,98,108,117,114,41,32,118,97,114,40,45,45,116,119,45,98,114,105,103,104,116,110,101,115,115,41,32,118,97,114,40,45,45,116,119,45,99,111,110,116,114,97,115,116,41,32,118,97,114,40,45,45,116,119,45,103,114,97,121,115,99,97,108,101,41,32,118,97,114,40,45,45,116,119,45,104,117,101,45,114,111,116,97,116,101,41,32,118,97,114,40,45,45,116,119,45,105,110,118,101,114,116,41,32,118,97,114,40,45,45,116,119,45,115,97,116,117,114,97,116,101,41,32,118,97,114,40,45,45,116,119,45,115,101,112,105,97,41,32,118,97,114,40,45,45,116,119,45,100,114,111,112,45,115,104,97,100,111,119,41,125,46,98,97,99,107,100,114,111,112,45,98,108,117,114,123,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,108,117,114,58,98,108,117,114,40,56,112,120,41,125,46,98,97,99,107,100,114,111,112,45,98,108,117,114,44,46,98,97,99,107,100,114,111,112,45,102,105,108,116,101,114,123,98,97,99,107,100,114,111,112,45,102,105,108,116,101,114,58,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,108,117,114,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,98,114,105,103,104,116,110,101,115,115,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,99,111,110,116,114,97,115,116,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,103,114,97,121,115,99,97,108,101,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,104,117,101,45,114,111,116,97,116,101,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,105,110,118,101,114,116,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,111,112,97,99,105,116,121,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,97,116,117,114,97,116,101,41,32,118,97,114,40,45,45,116,119,45,98,97,99,107,100,114,111,112,45,115,101,112,105,97,41,125,46,116,114,97,110,115,105,116,105,111,110,123,116,114,97,110,115,105,116,105,111,110,45,112,114,111,112,101,114,116,121,58,99,111,108,111,114,44,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,44,98,111,114,100,101,114,45,99,111,108,111,114,44,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,45,99,111,108,111,114,44,102,105,108,108,44,115,116,114,111,107,101,44,111,112,97,99,105,116,121,44,98,111,120,45,115,104,97,100,111,119,44,116,114,97,110,115,102,111,114,109,44,102,105,108,116,101,114,44,98,97,99,107,100,114,111,112,45,102,105,108,116,101,114,59,116,114,97,110,115,105,116,105,111,110,45,116,105,109,105,110,103,45,102,117,110,99,116,105,111,110,58,99,117,98,105,99,45,98,101,122,105,101,114,40,46,52,44,48,44,46,50,44,49,41,59,116,114,97,110,115,105,116,105,111,110,45,100,117,114,97,116,105,111,110,58,46,49,53,115,125,46,116,114,97,110,115,105,116,105,111,110,45,97,108,108,123,116,114,97,110,115,105,116,105,111,110,45,112,114,111,112,101,114,116,121,58,97,108,108,59,116,114,97,110,115,105,116,105,111,110,45,116,105,109,105,110,103,45,102,117,110,99,116,105,111,110,58,99,117,98,105,99,45,98,101,122,105,101,114,40,46,52,44,48,44,46,50,44,49,41,59,116,114,97,110,115,105,116,105,111,110,45,100,117,114,97,116,105,111,110,58,46,49,53,115,125,46,116,114,97,110,115,105,116,105,111,110,45,99,111,108,111,114,115,123,116,114,97,110,115,105,116,105,111,110,45,112,114,111,112,101,114,116,121,58,99,111,108,111,114,44,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,44,98,111,114,100,101,114,45,99,111,108,111,114,44,116,101,120,116,45,100,101,99,111,114,97,116,105,111,110,45,99,111,108,111,114,44,102,105,108,108,44,115,116,114,111,107,101,59,116,114,97,110,115,105,116,105,111,110,45,116,105,109,105,110,103,45,102,117,110,99,116,105,111,110,58,99,117,98,105,99,45,98,101,122,105,101,114,40,46,52,44,48,44,46,50,44,49,41,59,116,114,97,110,115,105,116,105,111,110,45,100,117,114,97,116,105,111,110,58,46,49,53,115,125,46,100,117,114,97,116,105,111,110,45,50,48,48,123,116,114,97,110,115,105,116,105,111,110,45,100,117,114,97,116,105,111,110,58,46,50,115,125,46,100,117,114,97,116,105,111,110,45,51,48,48,123,116,114,97,110,115,105,116,105,111,110,45,100,117,114,97,116,105,111,110,58,46,51,115,125,46,101,97,115,101,45,105,110,45,111,117,116,123,116,114,97,110,115,105,116,105,111,110,45,116,105,109,105,110,103,45,102,117,110,99,116,105,111,110,58,99,117,98,105,99,45,98,101,122,105,101,114,40,46,52,44,48,44,46,50,44,49,41,125,46,101,97,115,101,45,111,117,116,123,116,114,97,110,115,105,116,105,111,110,45,116,105,109,105,110,103,45,102,117,110,99,116,105,111,110,58,99,117,98,105,99,45,98,101,122,105,101,114,40,48,44,48,44,46,50,44,49,41,125,46,112,108,97,99,101,104,111,108,100,101,114,92,58,116,101,120,116,45,103,114,97,121,45,52,48,48,58,58,45,109,111,122,45,112,108,97,99,101,104,111,108,100,101,114,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,53,54,32,49,54,51,32,49,55,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,112,108,97,99,101,104,111,108,100,101,114,92,58,116,101,120,116,45,103,114,97,121,45,52,48,48,58,58,112,108,97,99,101,104,111,108,100,101,114,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,53,54,32,49,54,51,32,49,55,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,104,111,118,101,114,92,58,98,103,45,98,108,117,101,45,53,48,48,58,104,111,118,101,114,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,53,57,32,49,51,48,32,50,52,54,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,104,111,118,101,114,92,58,98,103,45,103,114,97,121,45,53,48,58,104,111,118,101,114,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,52,57,32,50,53,48,32,50,53,49,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,104,111,118,101,114,92,58,116,101,120,116,45,98,108,117,101,45,54,48,48,58,104,111,118,101,114,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,51,55,32,57,57,32,50,51,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,104,111,118,101,114,92,58,116,101,120,116,45,103,114,97,121,45,53,48,48,58,104,111,118,101,114,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,48,55,32,49,49,52,32,49,50,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,102,111,99,117,115,92,58,122,45,50,48,58,102,111,99,117,115,123,122,45,105,110,100,101,120,58,50,48,125,46,102,111,99,117,115,92,58,111,117,116,108,105,110,101,45,110,111,110,101,58,102,111,99,117,115,123,111,117,116,108,105,110,101,58,50,112,120,32,115,111,108,105,100,32,116,114,97,110,115,112,97,114,101,110,116,59,111,117,116,108,105,110,101,45,111,102,102,115,101,116,58,50,112,120,125,46,102,111,99,117,115,92,58,111,117,116,108,105,110,101,45,111,102,102,115,101,116,45,48,58,102,111,99,117,115,123,111,117,116,108,105,110,101,45,111,102,102,115,101,116,58,48,125,46,102,111,99,117,115,92,58,114,105,110,103,45,48,58,102,111,99,117,115,123,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,99,111,108,111,114,41,59,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,105,110,115,101,116,41,32,48,32,48,32,48,32,99,97,108,99,40,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,119,105,100,116,104,41,41,32,118,97,114,40,45,45,116,119,45,114,105,110,103,45,99,111,108,111,114,41,59,98,111,120,45,115,104,97,100,111,119,58,118,97,114,40,45,45,116,119,45,114,105,110,103,45,111,102,102,115,101,116,45,115,104,97,100,111,119,41,44,118,97,114,40,45,45,116,119,45,114,105,110,103,45,115,104,97,100,111,119,41,44,118,97,114,40,45,45,116,119,45,115,104,97,100,111,119,44,48,32,48,32,35,48,48,48,48,41,125,46,102,111,99,117,115,45,118,105,115,105,98,108,101,92,58,111,117,116,108,105,110,101,58,102,111,99,117,115,45,118,105,115,105,98,108,101,123,111,117,116,108,105,110,101,45,115,116,121,108,101,58,115,111,108,105,100,125,46,102,111,99,117,115,45,118,105,115,105,98,108,101,92,58,111,117,116,108,105,110,101,45,50,58,102,111,99,117,115,45,118,105,115,105,98,108,101,123,111,117,116,108,105,110,101,45,119,105,100,116,104,58,50,112,120,125,46,102,111,99,117,115,45,118,105,115,105,98,108,101,92,58,111,117,116,108,105,110,101,45,111,102,102,115,101,116,45,48,58,102,111,99,117,115,45,118,105,115,105,98,108,101,123,111,117,116,108,105,110,101,45,111,102,102,115,101,116,58,48,125,46,102,111,99,117,115,45,118,105,115,105,98,108,101,92,58,111,117,116,108,105,110,101,45,98,108,117,101,45,54,48,48,58,102,111,99,117,115,45,118,105,115,105,98,108,101,123,111,117,116,108,105,110,101,45,99,111,108,111,114,58,35,50,53,54,51,101,98,125,46,100,105,115,97,98,108,101,100,92,58,99,117,114,115,111,114,45,110,111,116,45,97,108,108,111,119,101,100,58,100,105,115,97,98,108,101,100,123,99,117,114,115,111,114,58,110,111,116,45,97,108,108,111,119,101,100,125,46,100,105,115,97,98,108,101,100,92,58,98,103,45,98,108,117,101,45,52,48,48,58,100,105,115,97,98,108,101,100,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,57,54,32,49,54,53,32,50,53,48,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,100,105,115,97,98,108,101,100,92,58,98,103,45,103,114,97,121,45,49,48,48,58,100,105,115,97,98,108,101,100,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,52,51,32,50,52,52,32,50,52,54,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,100,105,115,97,98,108,101,100,92,58,116,101,120,116,45,103,114,97,121,45,53,48,48,58,100,105,115,97,98,108,101,100,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,49,48,55,32,49,49,52,32,49,50,56,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,64,109,101,100,105,97,32,40,109,105,110,45,119,105,100,116,104,58,54,52,48,112,120,41,123,46,115,109,92,58,102,108,101,120,123,100,105,115,112,108,97,121,58,102,108,101,120,125,46,115,109,92,58,102,108,101,120,45,49,123,102,108,101,120,58,49,32,49,32,48,37,125,46,115,109,92,58,116,114,97,110,115,108,97,116,101,45,120,45,48,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,48,112,120,125,46,115,109,92,58,116,114,97,110,115,108,97,116,101,45,120,45,48,44,46,115,109,92,58,116,114,97,110,115,108,97,116,101,45,120,45,50,123,116,114,97,110,115,102,111,114,109,58,116,114,97,110,115,108,97,116,101,40,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,41,44,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,41,41,32,114,111,116,97,116,101,40,118,97,114,40,45,45,116,119,45,114,111,116,97,116,101,41,41,32,115,107,101,119,88,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,120,41,41,32,115,107,101,119,89,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,121,41,41,32,115,99,97,108,101,88,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,120,41,41,32,115,99,97,108,101,89,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,121,41,41,125,46,115,109,92,58,116,114,97,110,115,108,97,116,101,45,120,45,50,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,58,48,46,53,114,101,109,125,46,115,109,92,58,116,114,97,110,115,108,97,116,101,45,121,45,48,123,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,58,48,112,120,59,116,114,97,110,115,102,111,114,109,58,116,114,97,110,115,108,97,116,101,40,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,120,41,44,118,97,114,40,45,45,116,119,45,116,114,97,110,115,108,97,116,101,45,121,41,41,32,114,111,116,97,116,101,40,118,97,114,40,45,45,116,119,45,114,111,116,97,116,101,41,41,32,115,107,101,119,88,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,120,41,41,32,115,107,101,119,89,40,118,97,114,40,45,45,116,119,45,115,107,101,119,45,121,41,41,32,115,99,97,108,101,88,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,120,41,41,32,115,99,97,108,101,89,40,118,97,114,40,45,45,116,119,45,115,99,97,108,101,45,121,41,41,125,46,115,109,92,58,105,116,101,109,115,45,115,116,97,114,116,123,97,108,105,103,110,45,105,116,101,109,115,58,102,108,101,120,45,115,116,97,114,116,125,46,115,109,92,58,105,116,101,109,115,45,101,110,100,123,97,108,105,103,110,45,105,116,101,109,115,58,102,108,101,120,45,101,110,100,125,46,115,109,92,58,105,116,101,109,115,45,99,101,110,116,101,114,123,97,108,105,103,110,45,105,116,101,109,115,58,99,101,110,116,101,114,125,46,115,109,92,58,106,117,115,116,105,102,121,45,98,101,116,119,101,101,110,123,106,117,115,116,105,102,121,45,99,111,110,116,101,110,116,58,115,112,97,99,101,45,98,101,116,119,101,101,110,125,46,115,109,92,58,112,45,50,123,112,97,100,100,105,110,103,58,46,53,114,101,109,125,46,115,109,92,58,112,45,54,123,112,97,100,100,105,110,103,58,49,46,53,114,101,109,125,46,115,109,92,58,116,101,120,116,45,115,109,123,102,111,110,116,45,115,105,122,101,58,46,56,55,53,114,101,109,59,108,105,110,101,45,104,101,105,103,104,116,58,49,46,50,53,114,101,109,125,46,115,109,92,58,108,101,97,100,105,110,103,45,54,123,108,105,110,101,45,104,101,105,103,104,116,58,49,46,53,114,101,109,125,125,64,109,101,100,105,97,32,40,109,105,110,45,119,105,100,116,104,58,55,54,56,112,120,41,123,46,109,100,92,58,103,114,105,100,45,99,111,108,115,45,50,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,50,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,125,64,109,101,100,105,97,32,40,109,105,110,45,119,105,100,116,104,58,49,48,50,52,112,120,41,123,46,108,103,92,58,98,108,111,99,107,123,100,105,115,112,108,97,121,58,98,108,111,99,107,125,46,108,103,92,58,104,45,52,123,104,101,105,103,104,116,58,49,114,101,109,125,46,108,103,92,58,119,45,112,120,123,119,105,100,116,104,58,49,112,120,125,46,108,103,92,58,103,114,105,100,45,99,111,108,115,45,50,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,50,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,46,108,103,92,58,103,114,105,100,45,99,111,108,115,45,51,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,51,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,46,108,103,92,58,103,114,105,100,45,99,111,108,115,45,52,123,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,110,115,58,114,101,112,101,97,116,40,52,44,109,105,110,109,97,120,40,48,44,49,102,114,41,41,125,46,108,103,92,58,103,97,112,45,120,45,54,123,45,109,111,122,45,99,111,108,117,109,110,45,103,97,112,58,49,46,53,114,101,109,59,99,111,108,117,109,110,45,103,97,112,58,49,46,53,114,101,109,125,46,108,103,92,58,98,103,45,103,114,97,121,45,50,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,50,50,57,32,50,51,49,32,50,51,53,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,125,64,109,101,100,105,97,32,40,112,114,101,102,101,114,115,45,99,111,108,111,114,45,115,99,104,101,109,101,58,100,97,114,107,41,123,46,100,97,114,107,92,58,98,111,114,100,101,114,45,103,114,97,121,45,56,48,48,123,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,58,49,59,98,111,114,100,101,114,45,99,111,108,111,114,58,114,103,98,40,51,49,32,52,49,32,53,53,47,118,97,114,40,45,45,116,119,45,98,111,114,100,101,114,45,111,112,97,99,105,116,121,44,49,41,41,125,46,100,97,114,107,92,58,98,103,45,115,108,97,116,101,45,57,48,48,123,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,58,49,59,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,114,103,98,40,49,53,32,50,51,32,52,50,47,118,97,114,40,45,45,116,119,45,98,103,45,111,112,97,99,105,116,121,44,49,41,41,125,46,100,97,114,107,92,58,116,101,120,116,45,103,114,97,121,45,50,48,48,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,50,57,32,50,51,49,32,50,51,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,46,100,97,114,107,92,58,116,101,120,116,45,119,104,105,116,101,123,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,58,49,59,99,111,108,111,114,58,114,103,98,40,50,53,53,32,50,53,53,32,50,53,53,47,118,97,114,40,45,45,116,119,45,116,101,120,116,45,111,112,97,99,105,116,121,44,49,41,41,125,125,0};
+
+static const unsigned char v18[] = {45,45,45,45,45,66,69,71,73,78,32,67,69,82,84,73,70,73,67,65,84,69,45,45,45,45,45,10,77,73,73,66,67,84,67,66,115,65,73,74,65,75,57,119,98,73,68,107,72,110,65,111,77,65,111,71,67,67,113,71,83,77,52,57,66,65,77,67,77,65,48,120,67,122,65,74,66,103,78,86,66,65,89,84,65,107,108,70,77,66,52,88,10,68,84,73,122,77,68,69,121,79,84,73,120,77,106,69,122,79,70,111,88,68,84,77,122,77,68,69,121,78,106,73,120,77,106,69,122,79,70,111,119,68,84,69,76,77,65,107,71,65,49,85,69,66,104,77,67,83,85,85,119,87,84,65,84,10,66,103,99,113,104,107,106,79,80,81,73,66,66,103,103,113,104,107,106,79,80,81,77,66,66,119,78,67,65,65,82,122,83,81,83,53,79,72,100,49,55,108,85,101,78,73,43,54,107,112,57,87,89,117,48,99,120,117,69,73,105,47,74,84,10,106,112,104,98,67,109,100,74,68,49,99,85,118,104,109,122,77,57,47,112,104,118,74,84,57,107,97,49,48,90,57,116,111,90,104,103,110,66,113,48,111,48,120,102,84,81,52,106,67,49,118,119,77,65,111,71,67,67,113,71,83,77,52,57,10,66,65,77,67,65,48,103,65,77,69,85,67,73,81,67,101,48,84,50,69,48,71,79,105,86,101,57,75,119,118,73,69,80,101,88,49,74,49,74,48,84,55,84,78,97,99,103,82,48,89,97,51,51,72,86,57,86,103,73,103,78,118,100,110,10,97,69,87,105,66,112,49,120,115,104,115,52,105,122,54,87,98,112,120,114,83,49,73,72,117,99,114,113,107,90,117,74,76,102,78,90,71,90,73,61,10,45,45,45,45,45,69,78,68,32,67,69,82,84,73,70,73,67,65,84,69,45,45,45,45,45,10,0};
+
+static const unsigned char v19[] = {45,45,45,45,45,66,69,71,73,78,32,69,67,32,80,82,73,86,65,84,69,32,75,69,89,45,45,45,45,45,10,77,72,99,67,65,81,69,69,73,67,66,122,51,72,79,107,81,76,80,66,68,116,100,107,110,113,67,55,107,49,80,78,115,87,106,54,72,102,104,121,78,66,53,77,101,110,102,106,109,113,105,111,111,65,111,71,67,67,113,71,83,77,52,57,10,65,119,69,72,111,85,81,68,81,103,65,69,99,48,107,69,117,84,104,51,100,101,53,86,72,106,83,80,117,112,75,102,86,109,76,116,72,77,98,104,67,73,118,121,85,52,54,89,87,119,112,110,83,81,57,88,70,76,52,90,115,122,80,102,10,54,89,98,121,85,47,90,71,116,100,71,102,98,97,71,89,89,74,119,97,116,75,78,77,88,48,48,79,73,119,116,98,56,65,61,61,10,45,45,45,45,45,69,78,68,32,69,67,32,80,82,73,86,65,84,69,32,75,69,89,45,45,45,45,45,10,0};
 
 static const struct packed_file {
   const char *name;
   const unsigned char *data;
   size_t size;
   time_t mtime;
+  const char *etag;     // Strong ETag, with quotes
+  const char *headers;  // Complete 200 response header
 } packed_files[] = {
-  {"/web_root/bundle.js.gz", v0, sizeof(v0) - 1, 1768019257},
-  {"/web_root/components.js.gz", v1, sizeof(v1) - 1, 1766976640},
-  {"/web_root/history.min.js.gz", v2, sizeof(v2) - 1, 1766751605},
-  {"/web_root/index.html.gz", v3, sizeof(v3) - 1, 1767058371},
-  {"/web_root/main.js.gz", v4, sizeof(v4) - 1, 1768114571},
-  {"/web_root/tailwind.css.gz", v5, sizeof(v5) - 1, 1767867865},
-  {"/certs/server_cert.pem", v6, sizeof(v6) - 1, 1767009016},
-  {"/certs/server_key.pem", v7, sizeof(v7) - 1, 1767009016},
-  {NULL, NULL, 0, 0}
+  {"/certs/server_cert.pem", v18, sizeof(v18) - 1, 1767009016,
+   "\"17d20a3287cd028b\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/plain; charset=utf-8\r\nEtag: \"17d20a3287cd028b\"\r\nContent-Length: 420\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\n\r\n"},
+  {"/certs/server_key.pem", v19, sizeof(v19) - 1, 1767009016,
+   "\"0248d4f65ea0d553\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/plain; charset=utf-8\r\nEtag: \"0248d4f65ea0d553\"\r\nContent-Length: 227\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\n\r\n"},
+  {"/web_root/bundle.bb71868c.js", v2, sizeof(v2) - 1, 1768019257,
+   "\"bb71868cf221050b\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"bb71868cf221050b\"\r\nContent-Length: 20576\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/bundle.bb71868c.js.br", v0, sizeof(v0) - 1, 1768019257,
+   "\"bb71868cf221050b.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"bb71868cf221050b.br\"\r\nContent-Length: 7502\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/bundle.bb71868c.js.gz", v1, sizeof(v1) - 1, 1768019257,
+   "\"bb71868cf221050b.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"bb71868cf221050b.gz\"\r\nContent-Length: 8187\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/components.60742322.js", v5, sizeof(v5) - 1, 1766976640,
+   "\"607423225563b5ed\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"607423225563b5ed\"\r\nContent-Length: 31652\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/components.60742322.js.br", v3, sizeof(v3) - 1, 1766976640,
+   "\"607423225563b5ed.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"607423225563b5ed.br\"\r\nContent-Length: 7129\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/components.60742322.js.gz", v4, sizeof(v4) - 1, 1766976640,
+   "\"607423225563b5ed.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"607423225563b5ed.gz\"\r\nContent-Length: 8127\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/history.min.a99f63c7.js", v8, sizeof(v8) - 1, 1766751605,
+   "\"a99f63c74a01e231\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"a99f63c74a01e231\"\r\nContent-Length: 14893\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/history.min.a99f63c7.js.br", v6, sizeof(v6) - 1, 1766751605,
+   "\"a99f63c74a01e231.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"a99f63c74a01e231.br\"\r\nContent-Length: 3861\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/history.min.a99f63c7.js.gz", v7, sizeof(v7) - 1, 1766751605,
+   "\"a99f63c74a01e231.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"a99f63c74a01e231.gz\"\r\nContent-Length: 4367\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/index.html", v11, sizeof(v11) - 1, 1767058371,
+   "\"93184160c908c2fa\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nEtag: \"93184160c908c2fa\"\r\nContent-Length: 1058\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\n\r\n"},
+  {"/web_root/index.html.br", v9, sizeof(v9) - 1, 1767058371,
+   "\"93184160c908c2fa.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nEtag: \"93184160c908c2fa.br\"\r\nContent-Length: 455\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\n\r\n"},
+  {"/web_root/index.html.gz", v10, sizeof(v10) - 1, 1767058371,
+   "\"93184160c908c2fa.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nEtag: \"93184160c908c2fa.gz\"\r\nContent-Length: 614\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: no-cache\r\n\r\n"},
+  {"/web_root/main.c6d97fa1.js", v14, sizeof(v14) - 1, 1768114571,
+   "\"c6d97fa1a6db5488\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"c6d97fa1a6db5488\"\r\nContent-Length: 22658\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/main.c6d97fa1.js.br", v12, sizeof(v12) - 1, 1768114571,
+   "\"c6d97fa1a6db5488.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"c6d97fa1a6db5488.br\"\r\nContent-Length: 6273\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/main.c6d97fa1.js.gz", v13, sizeof(v13) - 1, 1768114571,
+   "\"c6d97fa1a6db5488.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nEtag: \"c6d97fa1a6db5488.gz\"\r\nContent-Length: 7300\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/tailwind.f81280dd.css", v17, sizeof(v17) - 1, 1767867865,
+   "\"f81280dddb19a1f7\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nEtag: \"f81280dddb19a1f7\"\r\nContent-Length: 21760\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/tailwind.f81280dd.css.br", v15, sizeof(v15) - 1, 1767867865,
+   "\"f81280dddb19a1f7.br\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nEtag: \"f81280dddb19a1f7.br\"\r\nContent-Length: 4171\r\nContent-Encoding: br\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {"/web_root/tailwind.f81280dd.css.gz", v16, sizeof(v16) - 1, 1767867865,
+   "\"f81280dddb19a1f7.gz\"",
+   "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nEtag: \"f81280dddb19a1f7.gz\"\r\nContent-Length: 4833\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n"},
+  {NULL, NULL, 0, 0, NULL, NULL}
+};
+
+static const char *packed_dirs[] = {
+  "",
+  "/certs",
+  "/web_root",
+  NULL
 };
 
-static int scmp(const char *a, const char *b) {
-  while (*a && (*a == *b)) a++, b++;
-  return *(const unsigned char *) a - *(const unsigned char *) b;
+#define NFILES (sizeof(packed_files) / sizeof(packed_files[0]) - 1)
+
+// Minimal perfect hash over packed_files and packed_dirs
+static const int packed_seeds[] = {0,1,0,0,-2,-3,0,3,3,0,-5,-10,2,-18,0,0,-19,0,-20,-22,2,-23,0};
+static const unsigned short packed_slots[] = {7,5,16,15,12,3,17,0,18,20,8,19,9,4,21,1,6,22,14,11,10,13,2};
+
+static uint32_t packed_hash(uint32_t seed, const char *s, size_t n) {
+  uint32_t h = seed ? seed : 0x811c9dc5U;
+  while (n-- > 0) h = (h ^ (unsigned char) *s++) * 0x01000193U;
+  return h ^ (h >> 16);
+}
+
+// Return packed_files index, packed_dirs index + NFILES, or -1
+static int packed_find(const char *name, size_t n) {
+  const size_t nk = sizeof(packed_slots) / sizeof(packed_slots[0]);
+  int seed = packed_seeds[packed_hash(0, name, n) % nk], i;
+  const char *p;
+  if (seed < 0) {
+    i = packed_slots[-seed - 1];
+  } else {
+    i = packed_slots[packed_hash((uint32_t) seed, name, n) % nk];
+  }
+  p = (size_t) i < NFILES ? packed_files[i].name : packed_dirs[i - NFILES];
+  return p != NULL && strncmp(p, name, n) == 0 && p[n] == '\0' ? i : -1;
 }
 
 const char *mg_unlist(size_t no) {
@@ -59,12 +169,26 @@ const char *mg_unlist(size_t no) {
 }
 
 const char *mg_unpack(const char *name, size_t *size, time_t *mtime) {
-  const struct packed_file *p;
-  for (p = packed_files; p->name != NULL; p++) {
-    if (scmp(p->name, name) != 0) continue;
-    if (size != NULL) *size = p->size;
-    if (mtime != NULL) *mtime = p->mtime;
-    return (const char *) p->data;
-  }
-  return NULL;
-};
+  int i = packed_find(name, strlen(name));
+  if (i < 0 || (size_t) i >= NFILES) return NULL;
+  if (size != NULL) *size = packed_files[i].size;
+  if (mtime != NULL) *mtime = packed_files[i].mtime;
+  return (const char *) packed_files[i].data;
+}
+
+// Pre-rendered response header for a packed file, see httpHeaders()
+const char *mg_unpack_http(const char *name, size_t *size, const char **etag,
+                           const char **headers) {
+  int i = packed_find(name, strlen(name));
+  if (i < 0 || (size_t) i >= NFILES) return NULL;
+  if (size != NULL) *size = packed_files[i].size;
+  if (etag != NULL) *etag = packed_files[i].etag;
+  if (headers != NULL) *headers = packed_files[i].headers;
+  return (const char *) packed_files[i].data;
+}
+
+int mg_unpack_dir(const char *name) {
+  size_t n = strlen(name);
+  if (n > 0 && name[n - 1] == '/') n--;  // "/dir/" is the same as "/dir"
+  return packed_find(name, n) >= (int) NFILES;
+}
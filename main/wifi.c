@@ -29,6 +29,8 @@ enum wifi_state {
 };
 
 static nvs_handle_t s_nvs_wifi_handle = 0;
+static struct mg_mgr *s_mgrs = NULL;  // Event loops notified of WiFi events
+static size_t s_nmgrs = 0;
 static esp_netif_t *s_ap_netif = NULL;
 static esp_netif_t *s_sta_netif = NULL;
 static struct wifi_context {
@@ -46,6 +48,13 @@ static struct wifi_context {
     .retry_count = 0,
 };
 
+// Runs in the ESP event task: hand the event over to the Mongoose loops
+static void wifi_notify(int ev, const void *buf, size_t len) {
+  for (size_t i = 0; i < s_nmgrs; i++) {
+    mg_chan_post(&s_mgrs[i], 0, ev, buf, len);
+  }
+}
+
 static void wifi_start_sta(wifi_config_t *cfg) {
   if (s_sta_netif != NULL) {
     esp_netif_destroy_default_wifi(s_sta_netif);
@@ -143,8 +152,9 @@ static void event_user_handler(void *arg, int32_t event_id, void *event_data)
       s_wifi_ctx.state = WIFI_STATE_SCANNING;
       MG_INFO(("User event: start scanning"));
       ESP_ERROR_CHECK(esp_wifi_scan_start(NULL, false));
-    } else {
+    } else if (s_wifi_ctx.state != WIFI_STATE_SCANNING) {
       MG_INFO(("WiFi is busy, cannot start scanning"));
+      wifi_notify(MG_EV_WIFI_SCAN_FAILED, NULL, 0);
     }
   } else if (event_id == WIFI_USER_EVENT_PROVISION) {
     MG_INFO(("User event: provisioning"));
@@ -170,6 +180,7 @@ static void event_user_handler(void *arg, int32_t event_id, void *event_data)
 static void event_wifi_handler(void *arg, int32_t event_id, void *event_data)
 {
   if (event_id == WIFI_EVENT_STA_START) {
+    wifi_notify(MG_EV_WIFI_STA_START, NULL, 0);
     if (wifi_is_provisioned()) {
       s_wifi_ctx.state = WIFI_STATE_CONNECTING;
       ESP_ERROR_CHECK(esp_wifi_connect());
@@ -177,7 +188,9 @@ static void event_wifi_handler(void *arg, int32_t event_id, void *event_data)
   } else if (event_id == WIFI_EVENT_STA_CONNECTED) {
     s_wifi_ctx.retry_count = 0;
     s_wifi_ctx.state = WIFI_STATE_IDLE;
+    wifi_notify(MG_EV_WIFI_STA_CONNECTED, NULL, 0);
   } else if (event_id == WIFI_EVENT_STA_DISCONNECTED) {
+    wifi_notify(MG_EV_WIFI_STA_DISCONNECTED, NULL, 0);
     if (s_wifi_ctx.state == WIFI_STATE_REPROVISIONING) {
       wifi_commit_config();
     }
@@ -192,11 +205,18 @@ static void event_wifi_handler(void *arg, int32_t event_id, void *event_data)
       s_wifi_ctx.state = WIFI_STATE_IDLE;
     }
   } else if (event_id == WIFI_EVENT_SCAN_DONE) {
-    MG_INFO(("WiFi scan done"));
+    wifi_event_sta_scan_done_t *done = (wifi_event_sta_scan_done_t *) event_data;
+    MG_INFO(("WiFi scan done, status %d", (int) done->status));
     wifi_save_scan_results();
     if (s_wifi_ctx.state == WIFI_STATE_SCANNING) {
       s_wifi_ctx.state = WIFI_STATE_IDLE;
     }
+    if (done->status != 0) {
+      wifi_notify(MG_EV_WIFI_SCAN_FAILED, NULL, 0);
+    } else {
+      wifi_notify(MG_EV_WIFI_SCAN_DONE, &s_wifi_ctx.ap_count,
+                  sizeof(s_wifi_ctx.ap_count));
+    }
   }
 }
 
@@ -205,6 +225,8 @@ static void ip_event_handler(void *arg, int32_t event_id, void *event_data)
   if (event_id == IP_EVENT_STA_GOT_IP) {
     ip_event_got_ip_t *event = (ip_event_got_ip_t *) event_data;
     MG_INFO(("Got IP ADDRESS: " IPSTR, IP2STR(&event->ip_info.ip)));
+    wifi_notify(MG_EV_WIFI_STA_GOT_IP, &event->ip_info.ip,
+                sizeof(event->ip_info.ip));
     if (!wifi_is_provisioned()) {
       struct wifi_prov_info prov = {};
       strncpy(prov.ssid, (char*)s_wifi_ctx.cfg.ssid, sizeof(prov.ssid));
@@ -227,8 +249,10 @@ static void event_handler(void *arg, esp_event_base_t event_base,
   }
 }
 
-void wifi_init() {
+void wifi_init(struct mg_mgr *mgrs, size_t n) {
   esp_err_t err = ESP_OK;
+  s_mgrs = mgrs;
+  s_nmgrs = n;
   if (!s_nvs_wifi_handle) {
     err = nvs_open(NVS_WIFI, NVS_READWRITE, &s_nvs_wifi_handle);
     if (err != ESP_OK) {
@@ -280,8 +304,9 @@ void wifi_uninit() {
   }
 }
 
-void wifi_scan_start() {
-  esp_event_post(WIFI_USER_EVENT, WIFI_USER_EVENT_SCAN, NULL, 0, portMAX_DELAY);
+bool wifi_scan_start() {
+  return esp_event_post(WIFI_USER_EVENT, WIFI_USER_EVENT_SCAN, NULL, 0, 0) ==
+         ESP_OK;
 }
 
 void wifi_scan_result(struct mg_str *out) {
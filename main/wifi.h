@@ -13,6 +13,7 @@
 #define MG_EV_WIFI_STA_DISCONNECTED (MG_EV_WIFI + 3)
 #define MG_EV_WIFI_STA_GOT_IP       (MG_EV_WIFI + 4)
 #define MG_EV_WIFI_SCAN_DONE        (MG_EV_WIFI + 5)
+#define MG_EV_WIFI_SCAN_FAILED      (MG_EV_WIFI + 6)
 
 struct wifi_prov_cfg {
   char ssid[MAX_SSID_LEN];
@@ -24,8 +25,11 @@ struct wifi_prov_info {
   char ipv4[MAX_IPV4_LEN];
 };
 
-void wifi_init();
-void wifi_scan_start();
+// WiFi events are posted to all n managers as MG_EV_WIFI_*, see mg_chan_post()
+void wifi_init(struct mg_mgr *mgrs, size_t n);
+// Ask the WiFi task for a scan, without waiting. It ends with
+// MG_EV_WIFI_SCAN_DONE, or MG_EV_WIFI_SCAN_FAILED if it could not be done
+bool wifi_scan_start();
 void wifi_scan_result(struct mg_str *out);
 void wifi_provision(struct wifi_prov_cfg *cfg);
 bool wifi_provisioned(struct wifi_prov_info *info);
@@ -280,6 +280,7 @@ static void dns_cb(struct mg_connection *c, int ev, void *ev_data) {
       // MG_DEBUG ("%lu %lu dns poll", d->expire, now));
       if (now > d->expire) mg_error(d->c, "DNS timeout");
     }
+    c->is_polling = *head != NULL;  // Stop polling when nothing is pending
   } else if (ev == MG_EV_READ) {
     struct mg_dns_message dm;
     int resolved = 0;
@@ -382,6 +383,8 @@ static void mg_sendnsreq(struct mg_connection *c, struct mg_str *name, int ms,
     d->expire = mg_millis() + (uint64_t) ms;
     d->c = c;
     c->is_resolving = 1;
+    dnsc->c->is_polling = 1;  // dns_cb expires requests on MG_EV_POLL
+    MG_POLL_READY(dnsc->c);
     MG_VERBOSE(("%lu resolving %.*s @ %s, txnid %hu", c->id, (int) name->len,
                 name->buf, dnsc->url, d->txnid));
     if (!mg_dns_send(dnsc->c, name, d->txnid, ipv6)) {
@@ -508,6 +511,7 @@ void mg_error(struct mg_connection *c, const char *fmt, ...) {
   MG_ERROR(("%lu %ld %s", c->id, c->fd, buf));
   c->is_closing = 1;             // Set is_closing before sending MG_EV_CALL
   mg_call(c, MG_EV_ERROR, buf);  // Let user handler override it
+  MG_POLL_READY(c);              // Close it without waiting for I/O
 }
 
 #ifdef MG_ENABLE_LINES
@@ -594,133 +598,268 @@ static bool is_digit(int c) {
   return c >= '0' && c <= '9';
 }
 
-static int addexp(char *buf, int e, int sign) {
-  int n = 0;
-  buf[n++] = 'e';
-  buf[n++] = (char) sign;
-  if (e > 400) return 0;
-  if (e < 10) buf[n++] = '0';
-  if (e >= 100) buf[n++] = (char) (e / 100 + '0'), e -= 100 * (e / 100);
-  if (e >= 10) buf[n++] = (char) (e / 10 + '0'), e -= 10 * (e / 10);
-  buf[n++] = (char) (e + '0');
-  return n;
+static const char s_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+#define MG_DTOA_WORDS 36   // Fits 1074 fraction bits, or a 1024-bit integer
+#define MG_DTOA_DIGITS 48  // Max digits generated, more would be cut anyway
+
+// Exact decimal expansion of a double, m * 2^e. The integer part is kept in
+// base 1e9, the fraction as fp / 2^bits. Each fraction digit is then a
+// short multiply by 10, which takes one or two words for typical values
+struct mg_dec {
+  uint32_t ip[MG_DTOA_WORDS];  // Integer part, most significant chunk first
+  uint32_t fp[MG_DTOA_WORDS];  // Fraction numerator, little-endian words
+  int ni, nf, bits, len;       // Words in ip and fp, fraction bits, digits
+};
+
+static uint32_t dec_div(uint32_t *w, int *n, uint32_t dv) {
+  uint64_t r = 0;
+  int i;
+  for (i = *n - 1; i >= 0; i--) {
+    r = r << 32 | w[i];
+    w[i] = (uint32_t) (r / dv), r %= dv;
+  }
+  while (*n > 0 && w[*n - 1] == 0) (*n)--;
+  return (uint32_t) r;
+}
+
+static void dec_init(struct mg_dec *x, uint64_t m, int e) {
+  uint32_t b[2], *w = b, t;
+  int i, n;
+  x->ni = x->nf = x->bits = x->len = 0;
+  if (e < 0) {
+    uint64_t f = e > -64 ? m & (((uint64_t) 1 << -e) - 1) : m;
+    m = e > -64 ? m >> -e : 0;
+    x->bits = -e, x->nf = 2;
+    x->fp[0] = (uint32_t) f, x->fp[1] = (uint32_t) (f >> 32);
+    while (x->nf > 0 && x->fp[x->nf - 1] == 0) x->nf--;
+    b[0] = (uint32_t) m, b[1] = (uint32_t) (m >> 32), n = 2;
+  } else {
+    int k = e / 32, sh = e % 32;  // No fraction, build m << e in fp
+    uint32_t lo = (uint32_t) m, hi = (uint32_t) (m >> 32);
+    w = x->fp, n = k + 3;
+    for (i = 0; i < k; i++) w[i] = 0;
+    w[k] = lo << sh;
+    w[k + 1] = hi << sh | (sh ? lo >> (32 - sh) : 0);
+    w[k + 2] = sh ? hi >> (32 - sh) : 0;
+  }
+  while (n > 0 && w[n - 1] == 0) n--;
+  while (n > 0) x->ip[x->ni++] = dec_div(w, &n, 1000000000);
+  for (i = 0; i < x->ni / 2; i++) {
+    t = x->ip[i], x->ip[i] = x->ip[x->ni - 1 - i], x->ip[x->ni - 1 - i] = t;
+  }
+  if (x->ni > 0) {
+    for (x->len = 9 * (x->ni - 1), t = x->ip[0]; t > 0; t /= 10) x->len++;
+  }
 }
 
-static int xisinf(double x) {
-  union {
-    double f;
-    uint64_t u;
-  } ieee754 = {x};
-  return ((unsigned) (ieee754.u >> 32) & 0x7fffffff) == 0x7ff00000 &&
-         ((unsigned) ieee754.u == 0);
+// Return integer digit i, counting from the most significant one
+static int dec_int_digit(const struct mg_dec *x, int i) {
+  int first = x->len - 9 * (x->ni - 1), pos;
+  uint32_t c;
+  if (i < first) {
+    c = x->ip[0], pos = first - 1 - i;
+  } else {
+    c = x->ip[1 + (i - first) / 9], pos = 8 - (i - first) % 9;
+  }
+  while (pos-- > 0) c /= 10;
+  return (int) (c % 10);
+}
+
+// Return the next fraction digit, and drop it from the fraction
+static int dec_frac_digit(struct mg_dec *x) {
+  int i, k = x->bits / 32, sh = x->bits % 32;
+  uint32_t c = 0, d;
+  for (i = 0; i < x->nf; i++) {
+    uint64_t v = (uint64_t) x->fp[i] * 10 + c;
+    x->fp[i] = (uint32_t) v, c = (uint32_t) (v >> 32);
+  }
+  if (c != 0) x->fp[x->nf++] = c;
+  if (k >= x->nf) return 0;
+  d = x->fp[k] >> sh;
+  if (sh > 28 && k + 1 < x->nf) d |= x->fp[k + 1] << (32 - sh);
+  x->fp[k] &= ((uint32_t) 1 << sh) - 1;
+  x->nf = k + 1;
+  while (x->nf > 0 && x->fp[x->nf - 1] == 0) x->nf--;
+  return (int) d;
+}
+
+// Compare the remaining fraction with 1/2: return -1, 0 or 1
+static int dec_frac_cmp_half(const struct mg_dec *x) {
+  int i, b = x->bits - 1, k = b / 32;
+  if (b < 0 || k >= x->nf || !((x->fp[k] >> (b % 32)) & 1)) return -1;
+  if (x->fp[k] & (((uint32_t) 1 << (b % 32)) - 1)) return 1;
+  for (i = 0; i < k; i++) {
+    if (x->fp[i] != 0) return 1;
+  }
+  return 0;
 }
 
-static int xisnan(double x) {
+static void dput(char *dst, size_t dstlen, size_t *n, char c) {
+  if (*n + 1 < dstlen) dst[*n] = c;
+  (*n)++;
+}
+
+// Print d like printf's %.*f (g == false) or %.*g (g == true) does: exact
+// digits, rounded half to even. Return the untruncated length
+static size_t mg_dtoa(char *dst, size_t dstlen, double d, int prec, bool g) {
   union {
     double f;
     uint64_t u;
-  } ieee754 = {x};
-  return ((unsigned) (ieee754.u >> 32) & 0x7fffffff) +
-             ((unsigned) ieee754.u != 0) >
-         0x7ff00000;
-}
-
-static size_t mg_dtoa(char *dst, size_t dstlen, double d, int width, bool tz) {
-  char buf[40];
-  int i, s = 0, n = 0, e = 0;
-  double t, mul, saved;
-  if (d == 0.0) return mg_snprintf(dst, dstlen, "%s", "0");
-  if (xisinf(d)) return mg_snprintf(dst, dstlen, "%s", d > 0 ? "inf" : "-inf");
-  if (xisnan(d)) return mg_snprintf(dst, dstlen, "%s", "nan");
-  if (d < 0.0) d = -d, buf[s++] = '-';
-
-  // Round
-  saved = d;
-  if (tz) {
-    mul = 1.0;
-    while (d >= 10.0 && d / mul >= 10.0) mul *= 10.0;
+  } ieee754 = {d};
+  struct mg_dec x;
+  char dg[MG_DTOA_DIGITS + 1];  // Digit values, one extra for the carry
+  uint64_t m = ieee754.u & (((uint64_t) 1 << 52) - 1);
+  int e = (int) (ieee754.u >> 52) & 0x7ff, want, nd = 0, pos = 0, z = 0;
+  int i, cmp, carry = 0, x10, last;
+  const char *p = NULL;
+  size_t n = 0;
+
+  if (e == 0x7ff) p = m != 0 ? "nan" : (ieee754.u >> 63) ? "-inf" : "inf";
+  if (p != NULL) {
+    while (*p != '\0') dput(dst, dstlen, &n, *p++);
   } else {
-    mul = 0.1;
-  }
-
-  while (d <= 1.0 && d / mul <= 1.0) mul /= 10.0;
-  for (i = 0, t = mul * 5; i < width; i++) t /= 10.0;
-
-  d += t;
-
-  // Calculate exponent, and 'mul' for scientific representation
-  mul = 1.0;
-  while (d >= 10.0 && d / mul >= 10.0) mul *= 10.0, e++;
-  while (d < 1.0 && d / mul < 1.0) mul /= 10.0, e--;
-  // printf(" --> %g %d %g %g\n", saved, e, t, mul);
-
-  if (tz && e >= width && width > 1) {
-    n = (int) mg_dtoa(buf, sizeof(buf), saved / mul, width, tz);
-    // printf(" --> %.*g %d [%.*s]\n", 10, d / t, e, n, buf);
-    n += addexp(buf + s + n, e, '+');
-    return mg_snprintf(dst, dstlen, "%.*s", n, buf);
-  } else if (tz && e <= -width && width > 1) {
-    n = (int) mg_dtoa(buf, sizeof(buf), saved / mul, width, tz);
-    // printf(" --> %.*g %d [%.*s]\n", 10, d / mul, e, n, buf);
-    n += addexp(buf + s + n, -e, '-');
-    return mg_snprintf(dst, dstlen, "%.*s", n, buf);
+    if (ieee754.u >> 63) dput(dst, dstlen, &n, '-');
+    if (g && e == 0 && m == 0) {
+      dput(dst, dstlen, &n, '0');
+    } else {
+      if (e == 0) {
+        e = 1;  // Subnormal
+      } else {
+        m |= (uint64_t) 1 << 52;
+      }
+      dec_init(&x, m, e - 1075);
+      if (prec < 0) prec = 6;
+      if (g && prec == 0) prec = 1;
+      want = g ? prec : x.len + prec;
+      if (g && x.len == 0) {  // Skip zeroes after the point
+        while ((i = dec_frac_digit(&x)) == 0) z++;
+        dg[nd++] = (char) i;
+      }
+      for (; nd < want && nd < MG_DTOA_DIGITS; nd++, pos++) {
+        dg[nd] = (char) (pos < x.len ? dec_int_digit(&x, pos)
+                                     : dec_frac_digit(&x));
+      }
+      if (nd < want) {
+        cmp = -1;  // Output gets cut before the rounding position
+      } else if (pos < x.len) {
+        i = dec_int_digit(&x, pos);
+        cmp = x.nf > 0 ? 1 : 0;
+        for (last = pos + 1; cmp == 0 && last < x.len; last++) {
+          if (dec_int_digit(&x, last) != 0) cmp = 1;
+        }
+        cmp = i > 5 || (i == 5 && cmp) ? 1 : i == 5 ? 0 : -1;
+      } else {
+        cmp = dec_frac_cmp_half(&x);
+      }
+      if (cmp > 0 || (cmp == 0 && nd > 0 && (dg[nd - 1] & 1))) {
+        for (i = nd - 1; i >= 0 && dg[i] == 9; i--) dg[i] = 0;
+        if (i >= 0) {
+          dg[i]++;
+        } else {
+          memmove(dg + 1, dg, (size_t) nd), dg[0] = 1, carry = 1;
+        }
+      }
+
+      x10 = (x.len > 0 ? x.len - 1 : -z - 1) + carry;  // Decimal exponent
+      if (!g) {
+        int il = x.len + carry;
+        if (il == 0) dput(dst, dstlen, &n, '0');
+        for (i = 0; i < il + prec; i++) {
+          if (i == il) dput(dst, dstlen, &n, '.');
+          dput(dst, dstlen, &n, (char) ('0' + (i < nd + carry ? dg[i] : 0)));
+        }
+      } else {
+        bool fixed = prec > x10 && x10 >= -4;
+        int point = fixed && x10 > 0 ? x10 + 1 : 1;  // Digits before '.'
+        last = nd > prec ? prec : nd;
+        while (last > point && dg[last - 1] == 0) last--;  // Trailing zeroes
+        if (fixed && x10 < 0) {
+          dput(dst, dstlen, &n, '0');
+          dput(dst, dstlen, &n, '.');
+          for (i = 0; i < -x10 - 1; i++) dput(dst, dstlen, &n, '0');
+          point = -1;
+        }
+        for (i = 0; i < last; i++) {
+          if (i == point) dput(dst, dstlen, &n, '.');
+          dput(dst, dstlen, &n, (char) ('0' + dg[i]));
+        }
+        if (!fixed) {
+          char tmp[4], *q = tmp + sizeof(tmp);
+          dput(dst, dstlen, &n, 'e');
+          dput(dst, dstlen, &n, x10 < 0 ? '-' : '+');
+          for (x10 = x10 < 0 ? -x10 : x10; x10 > 0 || q > tmp + 2; x10 /= 10) {
+            *--q = (char) ('0' + x10 % 10);
+          }
+          while (q < tmp + sizeof(tmp)) dput(dst, dstlen, &n, *q++);
+        }
+      }
+    }
+  }
+  if (dstlen > 0) dst[n < dstlen ? n : dstlen - 1] = '\0';
+  return n;
+}
+
+// Write v in decimal, two digits per step, backwards from p. Return start
+static char *u32_rev(char *p, uint32_t v) {
+  while (v >= 100) {
+    const char *d = &s_digit_pairs[(v % 100) * 2];
+    v /= 100, *--p = d[1], *--p = d[0];
+  }
+  if (v >= 10) {
+    *--p = s_digit_pairs[v * 2 + 1], *--p = s_digit_pairs[v * 2];
   } else {
-    int targ_width = width;
-    for (i = 0, t = mul; t >= 1.0 && s + n < (int) sizeof(buf); i++) {
-      int ch = (int) (d / t);
-      if (n > 0 || ch > 0) buf[s + n++] = (char) (ch + '0');
-      d -= ch * t;
-      t /= 10.0;
-    }
-    // printf(" --> [%g] -> %g %g (%d) [%.*s]\n", saved, d, t, n, s + n, buf);
-    if (n == 0) buf[s++] = '0';
-    while (t >= 1.0 && n + s < (int) sizeof(buf)) buf[n++] = '0', t /= 10.0;
-    if (s + n < (int) sizeof(buf)) buf[n + s++] = '.';
-    // printf(" 1--> [%g] -> [%.*s]\n", saved, s + n, buf);
-    if (!tz && n > 0) targ_width = width + n;
-    for (i = 0, t = 0.1; s + n < (int) sizeof(buf) && n < targ_width; i++) {
-      int ch = (int) (d / t);
-      buf[s + n++] = (char) (ch + '0');
-      d -= ch * t;
-      t /= 10.0;
-    }
-  }
-
-  while (tz && n > 0 && buf[s + n - 1] == '0') n--;  // Trim trailing zeroes
-  if (tz && n > 0 && buf[s + n - 1] == '.') n--;           // Trim trailing dot
-  n += s;
-  if (n >= (int) sizeof(buf)) n = (int) sizeof(buf) - 1;
-  buf[n] = '\0';
-  return mg_snprintf(dst, dstlen, "%s", buf);
+    *--p = (char) ('0' + v);
+  }
+  return p;
+}
+
+static size_t u32_len(uint32_t v) {
+  size_t n = 1;
+  for (;;) {
+    if (v < 10) return n;
+    if (v < 100) return n + 1;
+    if (v < 1000) return n + 2;
+    if (v < 10000) return n + 3;
+    v /= 10000, n += 4;
+  }
 }
 
 static size_t mg_lld(char *buf, int64_t val, bool is_signed, bool is_hex) {
   const char *letters = "0123456789abcdef";
-  uint64_t v = (uint64_t) val;
-  size_t s = 0, n, i;
-  if (is_signed && val < 0) buf[s++] = '-', v = (uint64_t) (-val);
-  // This loop prints a number in reverse order. I guess this is because we
-  // write numbers from right to left: least significant digit comes last.
-  // Maybe because we use Arabic numbers, and Arabs write RTL?
+  uint64_t v = (uint64_t) val, t;
+  size_t s = 0, n = 1;
+  if (is_signed && val < 0) buf[s++] = '-', v = 0 - v;
   if (is_hex) {
-    for (n = 0; v; v >>= 4) buf[s + n++] = letters[v & 15];
+    for (t = v; t > 15; t >>= 4) n++;
+    for (s += n, t = s; n > 0; n--, v >>= 4) buf[--t] = letters[v & 15];
+  } else if (v <= 0xffffffffU) {
+    s += u32_len((uint32_t) v);
+    u32_rev(buf + s, (uint32_t) v);
   } else {
-    for (n = 0; v; v /= 10) buf[s + n++] = letters[v % 10];
-  }
-  // Reverse a string
-  for (i = 0; i < n / 2; i++) {
-    char t = buf[s + i];
-    buf[s + i] = buf[s + n - i - 1], buf[s + n - i - 1] = t;
+    // 64-bit division is a library call on 32-bit MCUs, so only use it to
+    // split off 8 digits at a time, and print those with 32-bit math
+    char tmp[20], *end = tmp + sizeof(tmp), *p = end, *q;
+    while (v > 0xffffffffU) {
+      p = u32_rev(q = p, (uint32_t) (v % 100000000U));
+      while (p > q - 8) *--p = '0';
+      v /= 100000000U;
+    }
+    p = u32_rev(p, (uint32_t) v);
+    while (p < end) buf[s++] = *p++;
   }
-  if (val == 0) buf[n++] = '0';  // Handle special case
-  return n + s;
+  return s;
 }
 
 static size_t scpy(void (*out)(char, void *), void *ptr, char *buf,
                           size_t len) {
-  size_t i = 0;
-  while (i < len && buf[i] != '\0') out(buf[i++], ptr);
-  return i;
+  const char *end = buf == NULL ? NULL : (char *) memchr(buf, '\0', len);
+  return mg_pfn_write(out, ptr, buf, end == NULL ? len : (size_t) (end - buf));
 }
 
 size_t mg_xprintf(void (*out)(char, void *), void *ptr, const char *fmt, ...) {
@@ -763,11 +902,13 @@ size_t mg_vxprintf(void (*out)(char, void *), void *param, const char *fmt,
           c == 'g' || c == 'f') {
         bool s = (c == 'd'), h = (c == 'x' || c == 'X' || c == 'p');
         char tmp[40];
-        size_t xl = x ? 2 : 0;
+        size_t xl = x ? 2 : 0, sg;
         if (c == 'g' || c == 'f') {
           double v = va_arg(*ap, double);
           if (pr == ~0U) pr = 6;
           k = mg_dtoa(tmp, sizeof(tmp), v, (int) pr, c == 'g');
+          if (tmp[tmp[0] == '-'] > '9') pad = ' ';  // No 0-padding for inf, nan
+          if (k >= sizeof(tmp)) k = sizeof(tmp) - 1;  // Cut to what was printed
         } else if (is_long == 2) {
           int64_t v = va_arg(*ap, int64_t);
           k = mg_lld(tmp, v, s, h);
@@ -778,13 +919,15 @@ size_t mg_vxprintf(void (*out)(char, void *), void *param, const char *fmt,
           int v = va_arg(*ap, int);
           k = mg_lld(tmp, s ? (int64_t) v : (int64_t) (unsigned) v, s, h);
         }
+        sg = pad == '0' && k > 0 && tmp[0] == '-';  // Sign goes before 0s
         for (j = 0; j < xl && w > 0; j++) w--;
         for (j = 0; pad == ' ' && !minus && k < w && j + k < w; j++)
           n += scpy(out, param, &pad, 1);
-        n += scpy(out, param, (char *) "0x", xl);
+        n += mg_pfn_write(out, param, tmp, sg);
+        n += mg_pfn_write(out, param, "0x", xl);
         for (j = 0; pad == '0' && k < w && j + k < w; j++)
           n += scpy(out, param, &pad, 1);
-        n += scpy(out, param, tmp, k);
+        n += mg_pfn_write(out, param, tmp + sg, k - sg);
         for (j = 0; pad == ' ' && minus && k < w && j + k < w; j++)
           n += scpy(out, param, &pad, 1);
       } else if (c == 'm' || c == 'M') {
@@ -814,7 +957,10 @@ size_t mg_vxprintf(void (*out)(char, void *), void *param, const char *fmt,
       }
       i++;
     } else {
-      out(fmt[i], param), n++, i++;
+      size_t j = i;  // Copy a run of literal characters at once
+      while (fmt[j] != '\0' && fmt[j] != '%') j++;
+      n += mg_pfn_write(out, param, &fmt[i], j - i);
+      i = j;
     }
   }
   return n;
@@ -1074,6 +1220,15 @@ const char *mg_unlist(size_t no) {
   (void) no;
   return NULL;
 }
+int mg_unpack_dir(const char *path) {
+  (void) path;
+  return 0;
+}
+const char *mg_unpack_http(const char *path, size_t *size, const char **etag,
+                           const char **headers) {
+  (void) path, (void) size, (void) etag, (void) headers;
+  return NULL;
+}
 #endif
 
 struct mg_str mg_unpacked(const char *path) {
@@ -1089,14 +1244,8 @@ static int is_dir_prefix(const char *prefix, size_t n, const char *path) {
 }
 
 static int packed_stat(const char *path, size_t *size, time_t *mtime) {
-  const char *p;
-  size_t i, n = strlen(path);
   if (mg_unpack(path, size, mtime)) return MG_FS_READ;  // Regular file
-  // Scan all files. If `path` is a dir prefix for any of them, it's a dir
-  for (i = 0; (p = mg_unlist(i)) != NULL; i++) {
-    if (is_dir_prefix(path, n, p)) return MG_FS_DIR;
-  }
-  return 0;
+  return mg_unpack_dir(path) ? MG_FS_DIR : 0;  // Generated directory index
 }
 
 static void packed_list(const char *dir, void (*fn)(const char *, void *),
@@ -1911,6 +2060,8 @@ static void restore_http_cb(struct mg_connection *c) {
   c->pfn_data = NULL;
   c->pfn = http_cb;
   c->is_resp = 0;
+  c->is_polling = 0;
+  MG_POLL_READY(c);  // Let http_cb parse pipelined requests, if any
 }
 
 char *mg_http_etag(char *buf, size_t len, size_t size, time_t mtime);
@@ -1919,6 +2070,18 @@ char *mg_http_etag(char *buf, size_t len, size_t size, time_t mtime) {
   return buf;
 }
 
+// Packed files come with a content hash ETag, same as packed_serve() sends
+static char *file_etag(struct mg_fs *fs, const char *path, char *buf,
+                       size_t len, size_t size, time_t mtime) {
+  const char *etag = NULL;
+  if (fs == &mg_fs_packed && mg_unpack_http(path, NULL, &etag, NULL) != NULL &&
+      etag != NULL) {
+    mg_snprintf(buf, len, "%s", etag);
+    return buf;
+  }
+  return mg_http_etag(buf, len, size, mtime);
+}
+
 static void static_cb(struct mg_connection *c, int ev, void *ev_data) {
   if (ev == MG_EV_WRITE || ev == MG_EV_POLL) {
     struct mg_fd *fd = (struct mg_fd *) c->pfn_data;
@@ -1932,6 +2095,8 @@ static void static_cb(struct mg_connection *c, int ev, void *ev_data) {
     n = fd->fs->rd(fd->fd, c->send.buf + c->send.len, space);
     c->send.len += n;
     *cl -= n;
+    // While data is queued, MG_EV_WRITE calls us back. Poll only without it
+    c->is_polling = c->send.len == 0;
     if (n == 0) restore_http_cb(c);
   } else if (ev == MG_EV_CLOSE) {
     restore_http_cb(c);
@@ -2019,6 +2184,157 @@ static int getrange(struct mg_str *s, size_t *a, size_t *b) {
   return (int) numparsed;
 }
 
+// Content codings of precompressed variants, stored as path + suffix. The
+// order breaks ties between equally acceptable codings, smaller first
+static const char *s_codings[][2] = {
+    {"br", ".br"}, {"gzip", ".gz"}, {"identity", ""}};
+#define MG_CODINGS (sizeof(s_codings) / sizeof(s_codings[0]))
+
+static struct mg_str strip_spaces(struct mg_str s) {
+  while (s.len > 0 && (s.buf[0] == ' ' || s.buf[0] == '\t')) s.buf++, s.len--;
+  while (s.len > 0 && (s.buf[s.len - 1] == ' ' || s.buf[s.len - 1] == '\t')) {
+    s.len--;
+  }
+  return s;
+}
+
+// Parse a qvalue, "0.5" -> 500
+static int qvalue(struct mg_str s) {
+  int v = s.len > 0 && s.buf[0] == '1' ? 1000 : 0, scale = 100;
+  size_t i;
+  for (i = 2; i < s.len && s.buf[1] == '.' && scale > 0; i++, scale /= 10) {
+    if (s.buf[i] < '0' || s.buf[i] > '9') break;
+    v += (s.buf[i] - '0') * scale;
+  }
+  return v > 1000 ? 1000 : v;
+}
+
+// Put s_codings indices into order, most preferred by Accept-Encoding first,
+// and return their number. Codings with q=0 are left out, but identity is
+// always there, last if refused. See RFC 9110, 12.5.3
+static size_t accepted_codings(struct mg_http_message *hm, size_t *order) {
+  struct mg_str *ae = mg_http_get_header(hm, "Accept-Encoding");
+  struct mg_str s = ae == NULL ? mg_str("") : *ae, entry, name, params, p;
+  int q[MG_CODINGS], star = -1, v;
+  size_t i, j, n = 0;
+  for (i = 0; i < MG_CODINGS; i++) q[i] = -1;
+  while (mg_span(s, &entry, &s, ',')) {
+    mg_span(entry, &name, &params, ';');
+    name = strip_spaces(name), v = 1000;
+    while (mg_span(params, &p, &params, ';')) {
+      p = strip_spaces(p);
+      if (p.len > 2 && (p.buf[0] | 0x20) == 'q' && p.buf[1] == '=') {
+        v = qvalue(mg_str_n(p.buf + 2, p.len - 2));
+      }
+    }
+    if (mg_strcmp(name, mg_str("*")) == 0) star = v;
+    if (mg_strcasecmp(name, mg_str("x-gzip")) == 0) name = mg_str("gzip");
+    for (i = 0; i < MG_CODINGS; i++) {
+      if (mg_strcasecmp(name, mg_str(s_codings[i][0])) == 0) q[i] = v;
+    }
+  }
+  for (i = 0; i < MG_CODINGS; i++) {
+    bool identity = s_codings[i][1][0] == '\0';
+    if (q[i] < 0) q[i] = star >= 0 ? star : identity ? 1 : 0;
+    if (q[i] == 0 && !identity) continue;
+    for (j = n++; j > 0 && q[order[j - 1]] < q[i]; j--) order[j] = order[j - 1];
+    order[j] = i;
+  }
+  return n;
+}
+
+static bool has_coding_suffix(struct mg_str path) {
+  size_t i, n;
+  for (i = 0; i < MG_CODINGS; i++) {
+    if ((n = strlen(s_codings[i][1])) > 0 && path.len > n &&
+        memcmp(path.buf + path.len - n, s_codings[i][1], n) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// A 304 carries the validator and caching headers the 200 would have. For
+// packed files, Vary and Cache-Control come from the packed 200 header hdrs
+static void reply_304(struct mg_connection *c, const char *etag,
+                      const char *hdrs, const char *extra_headers) {
+  const char *p = hdrs == NULL ? NULL : strstr(hdrs, "\r\n"), *e;
+  mg_printf(c, "HTTP/1.1 304 %s\r\nEtag: %s\r\n",
+            mg_http_status_code_str(304), etag);
+  while (p != NULL && (e = strstr(p += 2, "\r\n")) != NULL && e > p) {
+    if (mg_ncasecmp(p, "Vary:", 5) == 0 ||
+        mg_ncasecmp(p, "Cache-Control:", 14) == 0) {
+      mg_printf(c, "%.*s\r\n", (int) (e - p), p);
+    }
+    p = e;
+  }
+  mg_printf(c, "%sContent-Length: 0\r\n\r\n",
+            extra_headers == NULL ? "" : extra_headers);
+  c->is_resp = 0;
+}
+
+// Stream an open file to the client from static_cb
+static void static_start(struct mg_connection *c, struct mg_fd *fd,
+                         size_t cl) {
+  // Track to-be-sent content length at the end of c->data, aligned
+  size_t *clp = (size_t *) &c->data[(sizeof(c->data) - sizeof(size_t)) /
+                                    sizeof(size_t) * sizeof(size_t)];
+  c->pfn = static_cb;
+  c->pfn_data = fd;
+  c->is_polling = 1;  // static_cb refills c->send on MG_EV_POLL
+  *clp = cl;
+}
+
+// Packed files carry a response header rendered by the packer. A plain GET or
+// HEAD needs no stat, no MIME lookup and no header formatting
+static bool packed_serve(struct mg_connection *c, struct mg_http_message *hm,
+                         const char *path,
+                         const struct mg_http_serve_opts *opts) {
+  char tmp[MG_PATH_MAX];
+  const char *data = NULL, *etag = NULL, *hdrs = NULL, *name = tmp;
+  size_t i, nc, size = 0, order[MG_CODINGS];
+  size_t n = path == NULL ? 0 : strlen(path);
+  struct mg_str *inm;
+  struct mg_fd *fd;
+  if (opts->fs != &mg_fs_packed || opts->mime_types != NULL || n == 0 ||
+      mg_http_get_header(hm, "Range") != NULL) {
+    return false;
+  }
+  nc = accepted_codings(hm, order);
+  for (i = 0; i < nc && data == NULL; i++) {
+    const char *suffix = s_codings[order[i]][1];
+    if (*suffix == '\0') {
+      // A .gz or .br asked for by its own name is served as is, unencoded
+      if (!has_coding_suffix(mg_str_n(path, n))) {
+        data = mg_unpack_http(name = path, &size, &etag, &hdrs);
+      }
+    } else if (mg_snprintf(tmp, sizeof(tmp), "%s%s", path, suffix) <
+               sizeof(tmp)) {
+      data = mg_unpack_http(name = tmp, &size, &etag, &hdrs);
+    }
+  }
+  if (data == NULL) return false;
+  if ((inm = mg_http_get_header(hm, "If-None-Match")) != NULL &&
+      mg_strcasecmp(*inm, mg_str(etag)) == 0) {
+    reply_304(c, etag, hdrs, opts->extra_headers);
+    return true;
+  }
+  // The header is constant like the body. Queue both where they are
+  n = strlen(hdrs);
+  if (opts->extra_headers != NULL) n -= 2;  // Insert before the blank line
+  if (!mg_send_ref(c, hdrs, n)) mg_send(c, hdrs, n);
+  if (opts->extra_headers != NULL) mg_printf(c, "%s\r\n", opts->extra_headers);
+  if (mg_strcasecmp(hm->method, mg_str("HEAD")) == 0 ||
+      (MG_ENABLE_SENDQ && mg_send_ref(c, data, size))) {
+    c->is_resp = 0;  // Packed data is constant: send it from where it is
+  } else if ((fd = mg_fs_open(&mg_fs_packed, name, MG_FS_READ)) != NULL) {
+    static_start(c, fd, size);
+  } else {
+    c->is_closing = 1;  // Headers are gone, the body cannot follow
+  }
+  return true;
+}
+
 void mg_http_serve_file(struct mg_connection *c, struct mg_http_message *hm,
                         const char *path,
                         const struct mg_http_serve_opts *opts) {
@@ -2028,21 +2344,24 @@ void mg_http_serve_file(struct mg_connection *c, struct mg_http_message *hm,
   size_t size = 0;
   time_t mtime = 0;
   struct mg_str *inm = NULL;
-  struct mg_str mime = guess_content_type(mg_str(path), opts->mime_types);
-  bool gzip = false;
+  struct mg_str mime;
+  const char *coding = NULL;
 
+  if (packed_serve(c, hm, path, opts)) return;
+  mime = guess_content_type(mg_str(path), opts->mime_types);
   if (path != NULL) {
-    // If a browser sends us "Accept-Encoding: gzip", try to open .gz first
-    struct mg_str *ae = mg_http_get_header(hm, "Accept-Encoding");
-    if (ae != NULL) {
-      if (mg_match(*ae, mg_str("*gzip*"), NULL)) {
-        mg_snprintf(tmp, sizeof(tmp), "%s.gz", path);
-        fd = mg_fs_open(fs, tmp, MG_FS_READ);
-        if (fd != NULL) gzip = true, path = tmp;
+    // Try precompressed variants in the order the client prefers them
+    size_t i, order[MG_CODINGS], nc = accepted_codings(hm, order);
+    for (i = 0; i < nc && fd == NULL; i++) {
+      const char *suffix = s_codings[order[i]][1];
+      if (*suffix == '\0') {
+        fd = mg_fs_open(fs, path, MG_FS_READ);
+      } else if (mg_snprintf(tmp, sizeof(tmp), "%s%s", path, suffix) <
+                     sizeof(tmp) &&
+                 (fd = mg_fs_open(fs, tmp, MG_FS_READ)) != NULL) {
+        coding = s_codings[order[i]][0], path = tmp;
       }
     }
-    // No luck opening .gz? Open what we've told to open
-    if (fd == NULL) fd = mg_fs_open(fs, path, MG_FS_READ);
   }
 
   // Failed to open, and page404 is configured? Open it, then
@@ -2055,12 +2374,14 @@ void mg_http_serve_file(struct mg_connection *c, struct mg_http_message *hm,
   if (fd == NULL || fs->st(path, &size, &mtime) == 0) {
     mg_http_reply(c, 404, opts->extra_headers, "Not found\n");
     mg_fs_close(fd);
-    // NOTE: mg_http_etag() call should go first!
-  } else if (mg_http_etag(etag, sizeof(etag), size, mtime) != NULL &&
+    // NOTE: file_etag() call should go first!
+  } else if (file_etag(fs, path, etag, sizeof(etag), size, mtime) != NULL &&
              (inm = mg_http_get_header(hm, "If-None-Match")) != NULL &&
              mg_strcasecmp(*inm, mg_str(etag)) == 0) {
+    const char *hdrs = NULL;
+    if (fs == &mg_fs_packed) mg_unpack_http(path, NULL, NULL, &hdrs);
     mg_fs_close(fd);
-    mg_http_reply(c, 304, opts->extra_headers, "");
+    reply_304(c, etag, hdrs, opts->extra_headers);
   } else {
     int n, status = 200;
     char range[100];
@@ -2091,20 +2412,22 @@ void mg_http_serve_file(struct mg_connection *c, struct mg_http_message *hm,
               "Content-Type: %.*s\r\n"
               "Etag: %s\r\n"
               "Content-Length: %llu\r\n"
-              "%s%s%s\r\n",
+              "%s%s%s%s%s\r\n",
               status, mg_http_status_code_str(status), (int) mime.len, mime.buf,
-              etag, (uint64_t) cl, gzip ? "Content-Encoding: gzip\r\n" : "",
-              range, opts->extra_headers ? opts->extra_headers : "");
+              etag, (uint64_t) cl, coding ? "Content-Encoding: " : "",
+              coding ? coding : "", coding ? "\r\n" : "", range,
+              opts->extra_headers ? opts->extra_headers : "");
     if (mg_strcasecmp(hm->method, mg_str("HEAD")) == 0) {
       c->is_resp = 0;
       mg_fs_close(fd);
+#if MG_ENABLE_SENDQ
+    } else if (fs == &mg_fs_packed &&
+               mg_send_ref(c, mg_unpack(path, NULL, NULL) + r1, cl)) {
+      c->is_resp = 0;  // Packed data is constant: send it from where it is
+      mg_fs_close(fd);
+#endif
     } else {
-      // Track to-be-sent content length at the end of c->data, aligned
-      size_t *clp = (size_t *) &c->data[(sizeof(c->data) - sizeof(size_t)) /
-                                        sizeof(size_t) * sizeof(size_t)];
-      c->pfn = static_cb;
-      c->pfn_data = fd;
-      *clp = cl;
+      static_start(c, fd, cl);
     }
   }
 }
@@ -2226,6 +2549,22 @@ static void listdir(struct mg_connection *c, struct mg_http_message *hm,
 #endif
 
 // Resolve requested file into `path` and return its fs->st() result
+// Check for index.html.br, index.html.gz and leave path at index.html
+static bool has_coded_index(struct mg_fs *fs, char *path, size_t path_size,
+                            size_t n) {
+  size_t i;
+  for (i = 0; i < MG_CODINGS; i++) {
+    if (s_codings[i][1][0] != '\0' &&
+        mg_snprintf(path + n, path_size - n, "/" MG_HTTP_INDEX "%s",
+                    s_codings[i][1]) < path_size - n &&
+        fs->st(path, NULL, NULL) != 0) {
+      path[n + 1 + strlen(MG_HTTP_INDEX)] = '\0';
+      return true;
+    }
+  }
+  return false;
+}
+
 static int uri_to_path2(struct mg_connection *c, struct mg_http_message *hm,
                         struct mg_fs *fs, struct mg_str url, struct mg_str dir,
                         char *path, size_t path_size) {
@@ -2272,13 +2611,8 @@ static int uri_to_path2(struct mg_connection *c, struct mg_http_message *hm,
          (mg_snprintf(path + n, path_size - n, "/index.shtml") > 0 &&
           (tmp = fs->st(path, NULL, NULL)) != 0))) {
       flags = tmp;
-    } else if ((mg_snprintf(path + n, path_size - n, "/" MG_HTTP_INDEX ".gz") >
-                    0 &&
-                (tmp = fs->st(path, NULL, NULL)) !=
-                    0)) {  // check for gzipped index
-      flags = tmp;
-      path[n + 1 + strlen(MG_HTTP_INDEX)] =
-          '\0';  // Remove appended .gz in index file name
+    } else if (has_coded_index(fs, path, path_size, n)) {
+      flags = MG_FS_READ;  // Only precompressed index variants are there
     } else {
       path[n] = '\0';  // Remove appended index file name
     }
@@ -2457,7 +2791,71 @@ static int skip_chunk(const char *buf, int len, int *pl, int *dl) {
   return i + 2 + n + 2;
 }
 
+static unsigned deadline_min(const struct mg_deadlines *d) {
+  unsigned i, ms = 0, v[] = {d->handshake_ms, d->header_ms, d->body_ms,
+                             d->idle_ms, d->write_ms};
+  for (i = 0; i < sizeof(v) / sizeof(v[0]); i++) {
+    if (v[i] > 0 && (ms == 0 || v[i] < ms)) ms = v[i];
+  }
+  return ms;
+}
+
+static void deadline_cb(void *arg);
+static void deadline_arm(struct mg_connection *c, uint64_t ms) {
+  mg_timer_free(&c->mgr->timers, &c->dl_timer);
+  mg_timer_init(&c->mgr->timers, &c->dl_timer, ms, MG_TIMER_ONCE, deadline_cb,
+                c);
+  c->dl_timer.expire = mg_millis() + ms;
+}
+
+// Each connection with deadlines has one timer in the manager's timer wheel.
+// I/O only records timestamps. The timer works out which deadline applies,
+// and closes the connection or re-arms itself. Checks are at most
+// deadline_min() apart, so a change of state is noticed within that time
+static void deadline_cb(void *arg) {
+  static const char *names[] = {"TLS handshake", "HTTP header", "HTTP body",
+                                "idle", "write"};
+  struct mg_connection *c = (struct mg_connection *) arg;
+  const struct mg_deadlines *d = c->deadlines;
+  unsigned cls = MG_DL_CLASSES, ms = 0;
+  uint64_t now = mg_millis(), start = now, next = deadline_min(d);
+  if (c->is_tls_hs) {
+    cls = MG_DL_HANDSHAKE, start = c->req_ms, ms = d->handshake_ms;
+  } else if (c->send.len > 0 || c->sendq != NULL) {
+    // A write stall counts from the last write, unless this check is the
+    // first to see pending data. Then, data may have been queued just now
+    cls = MG_DL_WRITE, ms = d->write_ms;
+    if (c->dl_class == MG_DL_WRITE) start = c->io_ms;
+  } else if (c->is_websocket || c->is_resp) {
+    // Waiting for the application, not for the peer
+  } else if (c->recv.len == 0) {
+    cls = MG_DL_IDLE, start = c->io_ms, ms = d->idle_ms;
+  } else if (mg_http_get_request_len(c->recv.buf, c->recv.len) <= 0) {
+    cls = MG_DL_HEADER, start = c->req_ms, ms = d->header_ms;
+  } else {
+    cls = MG_DL_BODY, start = c->io_ms, ms = d->body_ms;
+  }
+  c->dl_class = cls & 7U;
+  if (ms > 0 && now >= start + ms) {
+    c->mgr->timeouts[cls]++;
+    mg_error(c, "%s timeout", names[cls]);
+  } else {
+    if (ms > 0 && start + ms - now < next) next = start + ms - now;
+    deadline_arm(c, next);
+  }
+}
+
 static void http_cb(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_ACCEPT && c->deadlines != NULL &&
+      deadline_min(c->deadlines) > 0) {
+    c->req_ms = c->io_ms = mg_millis();
+    deadline_arm(c, deadline_min(c->deadlines));
+  } else if (ev == MG_EV_READ && c->deadlines != NULL &&
+             c->deadlines->header_ms > 0 && *(long *) ev_data > 0 &&
+             c->recv.len == (size_t) *(long *) ev_data) {
+    c->req_ms = c->io_ms;  // First bytes of a request. Check headers in time
+    deadline_arm(c, c->deadlines->header_ms);
+  }
   if (ev == MG_EV_READ || ev == MG_EV_CLOSE ||
       (ev == MG_EV_POLL && c->is_accepted && !c->is_draining &&
        c->recv.len > 0)) {  // see #2796
@@ -2561,6 +2959,7 @@ static void http_cb(struct mg_connection *c, int ev, void *ev_data) {
       }
     }
     if (ofs > 0) mg_iobuf_del(&c->recv, 0, ofs);  // Delete processed data
+    if (ofs > 0 && c->deadlines != NULL) c->req_ms = mg_millis();  // Next one
   }
   (void) ev_data;
 }
@@ -2589,25 +2988,115 @@ static size_t roundup(size_t size, size_t align) {
   return align == 0 ? size : (size + align - 1) / align * align;
 }
 
+#if MG_ENABLE_IOBUF_POOL
+// Connection buffers, i.e. those aligned to MG_IO_SIZE, are sized by classes:
+// class N holds MG_IO_SIZE << N bytes. Released buffers are kept in
+// per-class free lists, shared by all managers
+#define MG_IOBUF_CLASSES 16
+struct iobuf_free {
+  struct iobuf_free *next;
+};
+static struct iobuf_free *s_iobuf_pool[MG_IOBUF_CLASSES];
+static size_t s_iobuf_pooled;  // Bytes kept in the pool
+static mg_spinlock_t s_iobuf_lock = MG_SPINLOCK_INIT;
+
+// Return buffer size to allocate for a request, and its pool class or -1
+static size_t iobuf_class(size_t size, size_t align, int *cls) {
+  size_t n = MG_IO_SIZE;
+  *cls = -1;
+  if (align != MG_IO_SIZE || size == 0 || size > MG_IOBUF_POOL_MAX) {
+    return roundup(size, align);
+  }
+  for (*cls = 0; n < size; (*cls)++) n <<= 1;
+  if (*cls >= MG_IOBUF_CLASSES) *cls = -1;
+  return n;
+}
+
+static void *iobuf_alloc(size_t size, int cls) {
+  struct iobuf_free *p = NULL;
+  if (cls >= 0) {
+    MG_SPIN_LOCK(&s_iobuf_lock);
+    if ((p = s_iobuf_pool[cls]) != NULL) {
+      s_iobuf_pool[cls] = p->next, s_iobuf_pooled -= size;
+    }
+    MG_SPIN_UNLOCK(&s_iobuf_lock);
+    if (p != NULL) p->next = NULL;  // The rest was zeroed on release
+  }
+  return p != NULL ? (void *) p : mg_calloc(1, size);
+}
+
+static void iobuf_release(void *buf, size_t size) {
+  int cls;
+  bool kept = false;
+  if (buf == NULL) return;
+  mg_bzero((unsigned char *) buf, size);
+  if (iobuf_class(size, MG_IO_SIZE, &cls) == size && cls >= 0) {
+    MG_SPIN_LOCK(&s_iobuf_lock);
+    if (s_iobuf_pooled + size <= MG_IOBUF_POOL_BYTES) {
+      struct iobuf_free *p = (struct iobuf_free *) buf;
+      p->next = s_iobuf_pool[cls], s_iobuf_pool[cls] = p;
+      s_iobuf_pooled += size, kept = true;
+    }
+    MG_SPIN_UNLOCK(&s_iobuf_lock);
+  }
+  if (!kept) mg_free(buf);
+}
+#else
+static size_t iobuf_class(size_t size, size_t align, int *cls) {
+  *cls = -1;
+  return roundup(size, align);
+}
+
+static void *iobuf_alloc(size_t size, int cls) {
+  (void) cls;
+  return mg_calloc(1, size);
+}
+
+static void iobuf_release(void *buf, size_t size) {
+  mg_bzero((unsigned char *) buf, size);
+  mg_free(buf);
+}
+#endif
+
+// With MG_ENABLE_IOBUF_RING, connection buffers drop consumed data from the
+// front by moving buf forward over "head" bytes, instead of moving the data.
+// Data stays contiguous at buf, so handlers see no difference. The free
+// space in front is reclaimed, and wiped, when more room is needed at the end
+static bool is_ring(struct mg_iobuf *io) {
+  return MG_ENABLE_IOBUF_RING && io->align == MG_IO_SIZE;
+}
+
+void mg_iobuf_compact(struct mg_iobuf *io) {
+  if (io->head == 0) return;
+  if (io->len > 0) memmove(io->buf - io->head, io->buf, io->len);
+  io->buf -= io->head, io->size += io->head;
+  mg_bzero(io->buf + io->len, io->head);
+  io->head = 0;
+}
+
 bool mg_iobuf_resize(struct mg_iobuf *io, size_t new_size) {
   bool ok = true;
-  new_size = roundup(new_size, io->align);
+  int cls;
+  new_size = iobuf_class(new_size, io->align, &cls);
   if (new_size == 0) {
-    mg_bzero(io->buf, io->size);
-    mg_free(io->buf);
+    iobuf_release(io->buf - io->head, io->size + io->head);
     io->buf = NULL;
-    io->len = io->size = 0;
-  } else if (new_size != io->size) {
+    io->len = io->size = io->head = 0;
+  } else if (is_ring(io) && new_size <= io->size) {
+    // Big enough already
+  } else if (is_ring(io) && new_size <= io->size + io->head) {
+    mg_iobuf_compact(io);
+  } else if (new_size != io->size + io->head) {
     // NOTE(lsm): do not use realloc here. Use mg_calloc/mg_free only
-    void *p = mg_calloc(1, new_size);
+    void *p = iobuf_alloc(new_size, cls);
     if (p != NULL) {
       size_t len = new_size < io->len ? new_size : io->len;
       if (len > 0 && io->buf != NULL) memmove(p, io->buf, len);
-      mg_bzero(io->buf, io->size);
-      mg_free(io->buf);
+      iobuf_release(io->buf - io->head, io->size + io->head);
       io->buf = (unsigned char *) p;
       io->size = new_size;
       io->len = len;
+      io->head = 0;
     } else {
       ok = false;
       MG_ERROR(("%lld->%lld", (uint64_t) io->size, (uint64_t) new_size));
@@ -2619,15 +3108,15 @@ bool mg_iobuf_resize(struct mg_iobuf *io, size_t new_size) {
 bool mg_iobuf_init(struct mg_iobuf *io, size_t size, size_t align) {
   io->buf = NULL;
   io->align = align;
-  io->size = io->len = 0;
+  io->size = io->len = io->head = 0;
   return mg_iobuf_resize(io, size);
 }
 
 size_t mg_iobuf_add(struct mg_iobuf *io, size_t ofs, const void *buf,
                     size_t len) {
   size_t new_size = roundup(io->len + len, io->align);
-  mg_iobuf_resize(io, new_size);      // Attempt to resize
-  if (new_size != io->size) len = 0;  // Resize failure, append nothing
+  mg_iobuf_resize(io, new_size);     // Attempt to resize
+  if (new_size > io->size) len = 0;  // Resize failure, append nothing
   if (ofs < io->len) memmove(io->buf + ofs + len, io->buf + ofs, io->len - ofs);
   if (buf != NULL) memmove(io->buf + ofs, buf, len);
   if (ofs > io->len) io->len += ofs - io->len;
@@ -2638,6 +3127,11 @@ size_t mg_iobuf_add(struct mg_iobuf *io, size_t ofs, const void *buf,
 size_t mg_iobuf_del(struct mg_iobuf *io, size_t ofs, size_t len) {
   if (ofs > io->len) ofs = io->len;
   if (ofs + len > io->len) len = io->len - ofs;
+  if (ofs == 0 && io->buf != NULL && is_ring(io)) {
+    io->buf += len, io->head += len, io->size -= len, io->len -= len;
+    if (io->len == 0) mg_iobuf_compact(io);
+    return len;
+  }
   if (io->buf) memmove(io->buf + ofs, io->buf + ofs + len, io->len - ofs - len);
   if (io->buf) mg_bzero(io->buf + io->len - len, len);
   io->len -= len;
@@ -2668,16 +3162,97 @@ static char json_esc(int c, int esc) {
   return 0;
 }
 
+#if MG_ENABLE_JSON_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif MG_ENABLE_JSON_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#elif MG_ENABLE_JSON_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#define MG_SWAR_ONES ((uint64_t) 0x0101010101010101ULL)
+#define MG_SWAR_ZERO(x) (((x) - MG_SWAR_ONES) & ~(x) & (MG_SWAR_ONES * 0x80))
+
+// Return the number of leading bytes in s that need no attention from the
+// string scanner: anything but '"', '\\' and NUL. Long strings (SSIDs, keys,
+// base64 blobs) are skipped a block at a time
+static int json_plain_len(const char *s, int len) {
+  int i = 0;
+#if MG_ENABLE_JSON_SIMD && defined(__AVX2__)
+  const __m256i q = _mm256_set1_epi8('"'), b = _mm256_set1_epi8('\\');
+  for (; i + 32 <= len; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i *) (s + i));
+    __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, q),
+                                _mm256_cmpeq_epi8(v, b));
+    unsigned mask = (unsigned) _mm256_movemask_epi8(
+        _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#elif MG_ENABLE_JSON_SIMD && defined(__SSE2__)
+  const __m128i q = _mm_set1_epi8('"'), b = _mm_set1_epi8('\\');
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+    __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, q), _mm_cmpeq_epi8(v, b));
+    unsigned mask = (unsigned) _mm_movemask_epi8(
+        _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_setzero_si128())));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#elif MG_ENABLE_JSON_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+  const uint8x16_t q = vdupq_n_u8('"'), b = vdupq_n_u8('\\');
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t v = vld1q_u8((const uint8_t *) (s + i));
+    uint8x16_t m = vorrq_u8(vceqq_u8(v, q), vceqq_u8(v, b));
+    if (vmaxvq_u8(vorrq_u8(m, vceqzq_u8(v))) != 0) break;
+  }
+#endif
+  // Portable path, and the tail of the vector loops: 8 bytes per step.
+  // The lowest flagged byte is exact, higher ones may be false positives
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w, x;
+    memcpy(&w, s + i, sizeof(w));
+    x = MG_SWAR_ZERO(w) | MG_SWAR_ZERO(w ^ (MG_SWAR_ONES * '"')) |
+        MG_SWAR_ZERO(w ^ (MG_SWAR_ONES * '\\'));
+    if (x == 0) continue;
+#if defined(__GNUC__) || defined(__clang__)
+    if (!MG_BIG_ENDIAN) return i + (int) (__builtin_ctzll(x) >> 3);
+#endif
+    break;
+  }
+  while (i < len && s[i] != '"' && s[i] != '\\' && s[i] != '\0') i++;
+  return i;
+}
+
+#define MG_JSON_SPACE(c) \
+  ((c) == ' ' || (c) == '\t' || (c) == '\n' || (c) == '\r')
+
+// Return the length of the whitespace run at s. Pretty-printed documents
+// spend most of their bytes on indentation, so skip it in blocks too
+static int json_space_len(const char *s, int len) {
+  int i = 0;
+#if MG_ENABLE_JSON_SIMD && defined(__SSE2__)
+  const __m128i sp = _mm_set1_epi8(' '), nl = _mm_set1_epi8('\n');
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *) (s + i));
+    unsigned mask = (unsigned) _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, nl)));
+    if (mask != 0xffff) return i + __builtin_ctz(~mask);
+  }
+#endif
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w;
+    memcpy(&w, s + i, sizeof(w));
+    if (w != MG_SWAR_ONES * ' ') break;
+  }
+  while (i < len && MG_JSON_SPACE(s[i])) i++;
+  return i;
+}
+
 static int mg_pass_string(const char *s, int len) {
-  int i;
-  for (i = 0; i < len; i++) {
-    if (s[i] == '\\' && i + 1 < len && json_esc(s[i + 1], 1)) {
-      i++;
-    } else if (s[i] == '\0') {
-      return MG_JSON_INVALID;
-    } else if (s[i] == '"') {
-      return i;
-    }
+  int i = 0;
+  while ((i += json_plain_len(s + i, len - i)) < len) {
+    if (s[i] == '"') return i;
+    if (s[i] == '\0') return MG_JSON_INVALID;
+    i += i + 1 < len && json_esc(s[i + 1], 1) ? 2 : 1;  // Backslash
   }
   return MG_JSON_INVALID;
 }
@@ -2812,7 +3387,10 @@ int mg_json_get(struct mg_str json, const char *path, int *toklen) {
 
   for (i = 0; i < len; i++) {
     unsigned char c = ((unsigned char *) s)[i];
-    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') continue;
+    if (MG_JSON_SPACE(c)) {
+      if (c == '\n') i += json_space_len(&s[i + 1], len - i - 1);
+      continue;
+    }
     switch (expecting) {
       case S_VALUE:
         // p("V %s [%.*s] %d %d %d %d\n", path, pos, path, depth, ed, ci, ei);
@@ -2945,7 +3523,7 @@ bool mg_json_get_bool(struct mg_str json, const char *path, bool *v) {
   return found;
 }
 
-bool mg_json_unescape(struct mg_str s, char *to, size_t n) {
+static bool json_unescape(struct mg_str s, char *to, size_t n, size_t *len) {
   size_t i, j;
   for (i = 0, j = 0; i < s.len && j < n; i++, j++) {
     if (s.buf[i] == '\\' && i + 5 < s.len && s.buf[i + 1] == 'u') {
@@ -2967,9 +3545,38 @@ bool mg_json_unescape(struct mg_str s, char *to, size_t n) {
   }
   if (j >= n) return false;
   if (n > 0) to[j] = '\0';
+  *len = j;
   return true;
 }
 
+bool mg_json_unescape(struct mg_str s, char *to, size_t n) {
+  size_t len;
+  return json_unescape(s, to, n, &len);
+}
+
+// String token tok, quotes included, as a view of its text if there is
+// nothing to unescape. Otherwise unescape it into the free space of arena,
+// if any, and take that space. The arena is never grown
+static struct mg_str json_str_view(struct mg_str tok, struct mg_iobuf *arena) {
+  struct mg_str s = mg_str_n(NULL, 0), v;
+  size_t len;
+  if (tok.len < 2 || tok.buf[0] != '"') return s;
+  v = mg_str_n(tok.buf + 1, tok.len - 2);
+  if (memchr(v.buf, '\\', v.len) == NULL) return v;
+  if (arena != NULL && arena->len < arena->size &&
+      json_unescape(v, (char *) arena->buf + arena->len,
+                    arena->size - arena->len, &len)) {
+    s = mg_str_n((char *) arena->buf + arena->len, len);
+    arena->len += len + 1;
+  }
+  return s;
+}
+
+struct mg_str mg_json_get_str_view(struct mg_str json, const char *path,
+                                   struct mg_iobuf *arena) {
+  return json_str_view(mg_json_get_tok(json, path), arena);
+}
+
 char *mg_json_get_str(struct mg_str json, const char *path) {
   char *result = NULL;
   int len = 0, off = mg_json_get(json, path, &len);
@@ -3019,6 +3626,408 @@ long mg_json_get_long(struct mg_str json, const char *path, long dflt) {
   return result;
 }
 
+// Append a token to the tape, link it to its parent's last child
+static int json_tape_add(struct mg_json_tape *t, size_t max, int type, int ofs,
+                         int *stack, int *last, int depth) {
+  struct mg_json_tok *tok;
+  if ((size_t) t->n >= max) return MG_JSON_TOO_BIG;
+  tok = &t->toks[t->n];
+  tok->ofs = (uint16_t) ofs, tok->len = 0, tok->type = (uint8_t) type;
+  tok->parent = (uint16_t) (depth > 0 ? stack[depth - 1] : 0), tok->next = 0;
+  if (depth > 0) {
+    if (last[depth - 1] >= 0) t->toks[last[depth - 1]].next = (uint16_t) t->n;
+    last[depth - 1] = t->n;
+  }
+  return t->n++;
+}
+
+static int json_tape_parse(struct mg_json_tape *t, struct mg_str json,
+                           struct mg_json_tok *toks, size_t max) {
+  const char *s = json.buf;
+  int len = (int) json.len, i, k, depth = 0;
+  int stack[MG_JSON_MAX_DEPTH], last[MG_JSON_MAX_DEPTH];  // Open containers
+  enum { S_VALUE, S_KEY, S_COLON, S_COMMA_OR_EOO, S_DONE } expecting = S_VALUE;
+  t->json = json, t->toks = toks, t->n = 0, t->root = 0;
+  if (json.len > 0xffff) return MG_JSON_TOO_BIG;
+  if (max > 0xffff) max = 0xffff;
+  for (i = 0; i < len; i++) {
+    unsigned char c = ((unsigned char *) s)[i];
+    if (MG_JSON_SPACE(c)) {
+      if (c == '\n') i += json_space_len(&s[i + 1], len - i - 1);
+      continue;
+    }
+    if (expecting == S_DONE) return MG_JSON_INVALID;
+    if (expecting == S_COLON) {
+      if (c != ':') return MG_JSON_INVALID;
+      expecting = S_VALUE;
+      continue;
+    }
+    if (expecting == S_COMMA_OR_EOO && c == ',') {
+      expecting = toks[stack[depth - 1]].type == MG_JSON_OBJECT ? S_KEY
+                                                                : S_VALUE;
+      continue;
+    }
+    if (c == ']' || c == '}') {
+      // Close a container, if it is empty or its last member is complete
+      if (depth == 0) return MG_JSON_INVALID;
+      k = stack[depth - 1];
+      if (toks[k].type != (c == ']' ? MG_JSON_ARRAY : MG_JSON_OBJECT) ||
+          (expecting != S_COMMA_OR_EOO && last[depth - 1] >= 0)) {
+        return MG_JSON_INVALID;
+      }
+      toks[k].len = (uint16_t) (i - toks[k].ofs + 1);
+      expecting = --depth == 0 ? S_DONE : S_COMMA_OR_EOO;
+      continue;
+    }
+    if (expecting == S_COMMA_OR_EOO || (expecting == S_KEY && c != '"')) {
+      return MG_JSON_INVALID;
+    }
+    if (c == '{' || c == '[') {
+      if (depth >= MG_JSON_MAX_DEPTH) return MG_JSON_TOO_DEEP;
+      k = json_tape_add(t, max, c == '{' ? MG_JSON_OBJECT : MG_JSON_ARRAY, i,
+                        stack, last, depth);
+      if (k < 0) return k;
+      stack[depth] = k, last[depth] = -1, depth++;
+      expecting = c == '{' ? S_KEY : S_VALUE;
+      continue;
+    }
+    if (c == '"') {
+      k = mg_pass_string(&s[i + 1], len - i - 1);
+      if (k < 0) return k;
+      k += 2;
+    } else if (c == '-' || (c >= '0' && c <= '9')) {
+      mg_atod(&s[i], len - i, &k);
+    } else if (c == 't' && i + 3 < len && memcmp(&s[i], "true", 4) == 0) {
+      k = 4;
+    } else if (c == 'f' && i + 4 < len && memcmp(&s[i], "false", 5) == 0) {
+      k = 5;
+    } else if (c == 'n' && i + 3 < len && memcmp(&s[i], "null", 4) == 0) {
+      k = 4;
+    } else {
+      return MG_JSON_INVALID;
+    }
+    if (json_tape_add(t, max,
+                      c == '"'   ? MG_JSON_STRING
+                      : c == 't' ? MG_JSON_TRUE
+                      : c == 'f' ? MG_JSON_FALSE
+                      : c == 'n' ? MG_JSON_NULL
+                                 : MG_JSON_NUMBER,
+                      i, stack, last, depth) < 0) {
+      return MG_JSON_TOO_BIG;
+    }
+    toks[t->n - 1].len = (uint16_t) k;
+    i += k - 1;
+    expecting = expecting == S_KEY ? S_COLON
+                : depth == 0       ? S_DONE
+                                   : S_COMMA_OR_EOO;
+  }
+  if (expecting != S_DONE) return MG_JSON_INVALID;
+  return t->n;
+}
+
+// Return the number of tokens, or an error. A tape that failed is empty
+int mg_json_tape_init(struct mg_json_tape *t, struct mg_str json,
+                      struct mg_json_tok *toks, size_t max_toks) {
+  int n = json_tape_parse(t, json, toks, max_toks);
+  if (n < 0) t->n = 0;
+  return n;
+}
+
+// Like mg_json_tape_init(), but a document with more tokens than max_toks
+// gets storage sized for it. Every token but the first follows one of
+// "{[,:", so their count bounds the tokens. Release with mg_json_tape_free()
+int mg_json_tape_init_alloc(struct mg_json_tape *t, struct mg_str json,
+                            struct mg_json_tok *toks, size_t max_toks) {
+  struct mg_json_tok *big;
+  size_t i, n = 1;
+  int rc = mg_json_tape_init(t, json, toks, max_toks);
+  if (rc != MG_JSON_TOO_BIG || json.len > 0xffff) return rc;
+  for (i = 0; i < json.len; i++) {
+    char c = json.buf[i];
+    if (c == '{' || c == '[' || c == ',' || c == ':') n++;
+  }
+  if (n <= max_toks || (big = (struct mg_json_tok *) mg_calloc(
+                            n, sizeof(*big))) == NULL) {
+    return rc;
+  }
+  if ((rc = mg_json_tape_init(t, json, big, n)) < 0) {
+    mg_free(big);
+    t->toks = toks;
+  }
+  return rc;
+}
+
+// Free the storage mg_json_tape_init_alloc() allocated, if any
+void mg_json_tape_free(struct mg_json_tape *t, struct mg_json_tok *toks) {
+  if (t->toks != toks) mg_free(t->toks);
+  t->toks = toks, t->n = 0;
+}
+
+// First child of an object or array token, or 0 if none. Children are
+// chained by their next
+int mg_json_tape_child(const struct mg_json_tape *t, int i) {
+  return i + 1 < t->n && t->toks[i + 1].parent == i &&
+                 t->toks[i].type <= MG_JSON_ARRAY
+             ? i + 1
+             : 0;
+}
+
+// Same paths as mg_json_get(), relative to the tape root. Return token index
+int mg_json_tape_find(const struct mg_json_tape *t, const char *path) {
+  const struct mg_json_tok *toks = t->toks;
+  int i = t->root, k;
+  if (path[0] != '$') return MG_JSON_INVALID;
+  if (t->n <= 0 || i >= t->n) return MG_JSON_NOT_FOUND;
+  for (path++; *path != '\0';) {
+    if (*path == '.' && toks[i].type == MG_JSON_OBJECT) {
+      size_t n = strcspn(++path, ".[");
+      for (k = mg_json_tape_child(t, i); k > 0; k = toks[toks[k].next].next) {
+        if (toks[k].len == n + 2 &&
+            memcmp(t->json.buf + toks[k].ofs + 1, path, n) == 0) {
+          break;
+        }
+      }
+      if (k == 0) return MG_JSON_NOT_FOUND;
+      i = toks[k].next, path += n;
+    } else if (*path == '[' && toks[i].type == MG_JSON_ARRAY) {
+      long idx = 0;
+      for (path++; *path >= '0' && *path <= '9'; path++) {
+        idx = idx * 10 + (*path - '0');
+      }
+      if (*path++ != ']') return MG_JSON_INVALID;
+      k = mg_json_tape_child(t, i);
+      for (; k > 0 && idx > 0; idx--) k = toks[k].next;
+      if (k == 0) return MG_JSON_NOT_FOUND;
+      i = k;
+    } else {
+      return MG_JSON_NOT_FOUND;
+    }
+  }
+  return i;
+}
+
+struct mg_str mg_json_tape_get_tok(const struct mg_json_tape *t,
+                                   const char *path) {
+  int i = mg_json_tape_find(t, path);
+  return i < 0 ? mg_str_n(NULL, 0)
+               : mg_str_n(t->json.buf + t->toks[i].ofs, t->toks[i].len);
+}
+
+bool mg_json_tape_get_num(const struct mg_json_tape *t, const char *path,
+                          double *v) {
+  int i = mg_json_tape_find(t, path);
+  if (i < 0 || t->toks[i].type != MG_JSON_NUMBER) return false;
+  if (v != NULL) {
+    *v = mg_atod(t->json.buf + t->toks[i].ofs, t->toks[i].len, NULL);
+  }
+  return true;
+}
+
+bool mg_json_tape_get_bool(const struct mg_json_tape *t, const char *path,
+                           bool *v) {
+  int i = mg_json_tape_find(t, path);
+  if (i < 0 || (t->toks[i].type != MG_JSON_TRUE &&
+                t->toks[i].type != MG_JSON_FALSE)) {
+    return false;
+  }
+  if (v != NULL) *v = t->toks[i].type == MG_JSON_TRUE;
+  return true;
+}
+
+long mg_json_tape_get_long(const struct mg_json_tape *t, const char *path,
+                           long dflt) {
+  double dv;
+  return mg_json_tape_get_num(t, path, &dv) ? (long) dv : dflt;
+}
+
+struct mg_str mg_json_tape_get_str_view(const struct mg_json_tape *t,
+                                        const char *path,
+                                        struct mg_iobuf *arena) {
+  return json_str_view(mg_json_tape_get_tok(t, path), arena);
+}
+
+char *mg_json_tape_get_str(const struct mg_json_tape *t, const char *path) {
+  struct mg_str tok = mg_json_tape_get_tok(t, path);
+  char *result = NULL;
+  if (tok.len > 1 && tok.buf[0] == '"' &&
+      (result = (char *) mg_calloc(1, tok.len)) != NULL &&
+      !mg_json_unescape(mg_str_n(tok.buf + 1, tok.len - 2), result, tok.len)) {
+    mg_free(result);
+    result = NULL;
+  }
+  return result;
+}
+
+// Integer struct members of any size. memcpy() keeps enums and the like legal
+static void json_store(void *p, size_t size, uint64_t v) {
+  uint8_t v8 = (uint8_t) v;
+  uint16_t v16 = (uint16_t) v;
+  uint32_t v32 = (uint32_t) v;
+  if (size == 1) memcpy(p, &v8, size);
+  if (size == 2) memcpy(p, &v16, size);
+  if (size == 4) memcpy(p, &v32, size);
+  if (size == 8) memcpy(p, &v, size);
+}
+
+static uint64_t json_load(const void *p, size_t size, bool is_signed) {
+  int8_t v8 = 0;
+  int16_t v16 = 0;
+  int32_t v32 = 0;
+  uint64_t v = 0;
+  if (size == 1) {
+    memcpy(&v8, p, size);
+    v = is_signed ? (uint64_t) v8 : (uint8_t) v8;
+  } else if (size == 2) {
+    memcpy(&v16, p, size);
+    v = is_signed ? (uint64_t) v16 : (uint16_t) v16;
+  } else if (size == 4) {
+    memcpy(&v32, p, size);
+    v = is_signed ? (uint64_t) v32 : (uint32_t) v32;
+  } else if (size == 8) {
+    memcpy(&v, p, size);
+  }
+  return v;
+}
+
+static bool json_in_range(const struct mg_json_field *f, double v) {
+  return f->min == f->max || (v >= f->min && v <= f->max);
+}
+
+// Decode token i into the struct member of field f
+static bool json_decode_field(const struct mg_json_tape *t, int i,
+                              const struct mg_json_field *f, char *obj) {
+  const struct mg_json_tok *tok = &t->toks[i];
+  const char *s = t->json.buf + tok->ofs;
+  double d = 0;
+  if (tok->type == MG_JSON_NUMBER) d = mg_atod(s, tok->len, NULL);
+  switch (f->type) {
+    case MG_JSON_FIELD_INT:
+    case MG_JSON_FIELD_UINT:
+      if (tok->type != MG_JSON_NUMBER || d != (double) (int64_t) d ||
+          !json_in_range(f, d) || (f->type == MG_JSON_FIELD_UINT && d < 0)) {
+        return false;
+      }
+      json_store(obj + f->ofs, f->size, (uint64_t) (int64_t) d);
+      return true;
+    case MG_JSON_FIELD_BOOL:
+      if (tok->type != MG_JSON_TRUE && tok->type != MG_JSON_FALSE) return false;
+      *(bool *) (obj + f->ofs) = tok->type == MG_JSON_TRUE;
+      return true;
+    case MG_JSON_FIELD_DOUBLE:
+      if (tok->type != MG_JSON_NUMBER || !json_in_range(f, d)) return false;
+      if (f->size == sizeof(float)) *(float *) (obj + f->ofs) = (float) d;
+      if (f->size == sizeof(double)) *(double *) (obj + f->ofs) = d;
+      return true;
+    case MG_JSON_FIELD_STR: {
+      // The member is the arena: escaped text is unescaped right into it
+      struct mg_iobuf dst = {(unsigned char *) obj + f->ofs, f->size, 0, 0, 0};
+      struct mg_str v = mg_str_n(NULL, 0);
+      if (tok->type == MG_JSON_STRING) {
+        v = json_str_view(mg_str_n(s, tok->len), &dst);
+      }
+      if (v.buf == NULL || v.len >= f->size) {
+        if (f->size > 0) obj[f->ofs] = '\0';  // Does not fit: leave empty
+        return false;
+      }
+      if (v.buf != (char *) dst.buf) memcpy(obj + f->ofs, v.buf, v.len);
+      obj[f->ofs + v.len] = '\0';
+      return json_in_range(f, (double) v.len);
+    }
+    case MG_JSON_FIELD_BITS: {
+      uint64_t mask = 0;
+      if (tok->type != MG_JSON_ARRAY) return false;
+      for (i = mg_json_tape_child(t, i); i > 0; i = t->toks[i].next) {
+        tok = &t->toks[i];
+        d = tok->type == MG_JSON_NUMBER
+                ? mg_atod(t->json.buf + tok->ofs, tok->len, NULL)
+                : -1;
+        if (d < 0 || d >= f->size * 8 || d != (double) (int) d ||
+            !json_in_range(f, d)) {
+          return false;
+        }
+        mask |= (uint64_t) 1 << (int) d;
+      }
+      json_store(obj + f->ofs, f->size, mask);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Decode the tape root object into obj in one pass over its members. Keys
+// that are not in the table are ignored, missing optional members are left
+// as they are. Return the number of members decoded, or an error
+int mg_json_decode(const struct mg_json_tape *t,
+                   const struct mg_json_field *fields, size_t num_fields,
+                   void *obj) {
+  uint32_t seen = 0;
+  size_t j;
+  int k, n = 0;
+  if (num_fields > 32) return MG_JSON_TOO_BIG;
+  if (t->n > 0 && t->toks[t->root].type != MG_JSON_OBJECT) {
+    return MG_JSON_INVALID;
+  }
+  k = t->n > 0 ? mg_json_tape_child(t, t->root) : 0;
+  for (; k > 0; k = t->toks[t->toks[k].next].next) {
+    const struct mg_json_tok *key = &t->toks[k];
+    for (j = 0; j < num_fields; j++) {
+      size_t len = strlen(fields[j].name);
+      if (key->len == len + 2 &&
+          memcmp(t->json.buf + key->ofs + 1, fields[j].name, len) == 0) {
+        break;
+      }
+    }
+    if (j == num_fields) continue;
+    if (!json_decode_field(t, key->next, &fields[j], (char *) obj)) {
+      return MG_JSON_INVALID;
+    }
+    seen |= 1UL << j, n++;
+  }
+  for (j = 0; j < num_fields; j++) {
+    if (fields[j].required && !(seen & (1UL << j))) return MG_JSON_NOT_FOUND;
+  }
+  return n;
+}
+
+// Print struct members as "key":value pairs, comma-separated, without
+// braces. Arguments: const struct mg_json_field *, size_t, const void *
+size_t mg_print_fields(void (*out)(char, void *), void *arg, va_list *ap) {
+  const struct mg_json_field *f = va_arg(*ap, const struct mg_json_field *);
+  size_t j, num_fields = va_arg(*ap, size_t), n = 0;
+  const char *obj = va_arg(*ap, const char *);
+  for (j = 0; j < num_fields; j++, f++) {
+    const void *p = obj + f->ofs;
+    n += mg_xprintf(out, arg, "%s%m:", j == 0 ? "" : ",", MG_ESC(f->name));
+    if (f->type == MG_JSON_FIELD_INT) {
+      n += mg_xprintf(out, arg, "%lld", (int64_t) json_load(p, f->size, true));
+    } else if (f->type == MG_JSON_FIELD_UINT) {
+      n += mg_xprintf(out, arg, "%llu", json_load(p, f->size, false));
+    } else if (f->type == MG_JSON_FIELD_BOOL) {
+      n += mg_xprintf(out, arg, "%s", *(const bool *) p ? "true" : "false");
+    } else if (f->type == MG_JSON_FIELD_DOUBLE) {
+      n += mg_xprintf(out, arg, "%g",
+                      f->size == sizeof(float) ? (double) *(const float *) p
+                                               : *(const double *) p);
+    } else if (f->type == MG_JSON_FIELD_STR) {
+      n += mg_xprintf(out, arg, "%m", MG_ESC((const char *) p));
+    } else if (f->type == MG_JSON_FIELD_BITS) {
+      uint64_t mask = json_load(p, f->size, false);
+      int bit, first = 1;
+      n += mg_xprintf(out, arg, "[");
+      for (bit = 0; bit < 64; bit++) {
+        if (!(mask & ((uint64_t) 1 << bit))) continue;
+        n += mg_xprintf(out, arg, "%s%d", first ? "" : ",", bit);
+        first = 0;
+      }
+      n += mg_xprintf(out, arg, "]");
+    } else {
+      n += mg_xprintf(out, arg, "null");
+    }
+  }
+  return n;
+}
+
 #ifdef MG_ENABLE_LINES
 #line 1 "src/log.c"
 #endif
@@ -3915,6 +4924,7 @@ size_t mg_vprintf(struct mg_connection *c, const char *fmt, va_list *ap) {
     c->send.len = old;
     actual = 0;
   }
+  MG_POLL_MOD(c);
   return actual;
 }
 
@@ -3927,6 +4937,104 @@ size_t mg_printf(struct mg_connection *c, const char *fmt, ...) {
   return len;
 }
 
+static mg_spinlock_t s_shbuf_lock = MG_SPINLOCK_INIT;
+
+struct mg_shbuf *mg_shbuf_new(const void *buf, size_t len) {
+  struct mg_shbuf *sb = (struct mg_shbuf *) mg_calloc(1, sizeof(*sb) + len);
+  if (sb != NULL) {
+    sb->buf = (unsigned char *) (sb + 1);
+    sb->len = len;
+    sb->refs = 1;
+    if (buf != NULL) memcpy(sb->buf, buf, len);
+  }
+  return sb;
+}
+
+void mg_shbuf_unref(struct mg_shbuf *sb) {
+  size_t refs;
+  if (sb == NULL) return;
+  MG_SPIN_LOCK(&s_shbuf_lock);  // Connections of other managers may share sb
+  refs = --sb->refs;
+  MG_SPIN_UNLOCK(&s_shbuf_lock);
+  if (refs == 0) mg_free(sb);
+}
+
+#if MG_ENABLE_SENDQ && MG_ENABLE_SOCKET
+// Queue a segment after everything already queued. Data pending in c->send
+// must go first, so its storage is moved into a segment of its own
+static bool sendq_add(struct mg_connection *c, const void *buf, size_t len,
+                      struct mg_shbuf *sb) {
+  struct mg_sendseg **tail = &c->sendq, *seg, *own = NULL;
+  if ((seg = (struct mg_sendseg *) mg_calloc(1, sizeof(*seg))) == NULL ||
+      (c->send.len > 0 &&
+       (own = (struct mg_sendseg *) mg_calloc(1, sizeof(*own))) == NULL)) {
+    mg_free(seg);
+    return false;
+  }
+  while (*tail != NULL) tail = &(*tail)->next;  // Queues are short
+  if (own != NULL) {
+    own->buf = c->send.buf, own->len = c->send.len;
+    own->base = c->send.buf - c->send.head;
+    own->size = c->send.size + c->send.head;
+    c->send.buf = NULL, c->send.size = c->send.len = c->send.head = 0;
+    *tail = own, tail = &own->next;
+  }
+  seg->buf = (const unsigned char *) buf, seg->len = len, seg->sb = sb;
+  *tail = seg;
+  MG_POLL_MOD(c);  // We may want to write now
+  return true;
+}
+
+static void sendq_pop(struct mg_connection *c) {
+  struct mg_sendseg *seg = c->sendq;
+  struct mg_iobuf io = {seg->base, seg->size, 0, 0, 0};
+  c->sendq = seg->next;
+  if (seg->base != NULL) mg_iobuf_free(&io);
+  mg_shbuf_unref(seg->sb);
+  mg_free(seg);
+}
+
+bool mg_send_ref(struct mg_connection *c, const void *buf, size_t len) {
+  if (c->is_udp) return mg_send(c, buf, len);
+  return len == 0 || sendq_add(c, buf, len, NULL);
+}
+
+bool mg_send_shared(struct mg_connection *c, struct mg_shbuf *sb) {
+  if (c->is_udp) return mg_send(c, sb->buf, sb->len);
+  if (sb->len == 0) return true;
+  MG_SPIN_LOCK(&s_shbuf_lock);
+  sb->refs++;
+  MG_SPIN_UNLOCK(&s_shbuf_lock);
+  if (sendq_add(c, sb->buf, sb->len, sb)) return true;
+  mg_shbuf_unref(sb);
+  return false;
+}
+#else
+static void sendq_pop(struct mg_connection *c) {
+  c->sendq = NULL;
+}
+
+bool mg_send_ref(struct mg_connection *c, const void *buf, size_t len) {
+  return mg_send(c, buf, len);
+}
+
+bool mg_send_shared(struct mg_connection *c, struct mg_shbuf *sb) {
+  return mg_send(c, sb->buf, sb->len);
+}
+#endif
+
+void mg_sendq_del(struct mg_connection *c, size_t len) {
+  while (c->sendq != NULL && len >= c->sendq->len) {
+    len -= c->sendq->len;
+    sendq_pop(c);
+  }
+  if (c->sendq != NULL) {
+    c->sendq->buf += len, c->sendq->len -= len;
+  } else {
+    mg_iobuf_del(&c->send, 0, len);
+  }
+}
+
 static bool mg_atonl(struct mg_str str, struct mg_addr *addr) {
   uint32_t localhost = mg_htonl(0x7f000001);
   if (mg_strcasecmp(str, mg_str("localhost")) != 0) return false;
@@ -4054,6 +5162,8 @@ void mg_close_conn(struct mg_connection *c) {
   MG_PROF_FREE(c);
 
   mg_tls_free(c);
+  mg_timer_free(&c->mgr->timers, &c->dl_timer);
+  while (c->sendq != NULL) sendq_pop(c);
   mg_iobuf_free(&c->recv);
   mg_iobuf_free(&c->send);
   mg_iobuf_free(&c->rtls);
@@ -4071,6 +5181,7 @@ struct mg_connection *mg_connect_svc(struct mg_mgr *mgr, const char *url,
     MG_ERROR(("OOM"));
   } else {
     LIST_ADD_HEAD(struct mg_connection, &mgr->conns, c);
+    MG_POLL_READY(c);
     c->is_udp = (strncmp(url, "udp:", 4) == 0);
     c->fd = (void *) (size_t) MG_INVALID_SOCKET;
     c->fn = fn;
@@ -4105,6 +5216,7 @@ struct mg_connection *mg_listen(struct mg_mgr *mgr, const char *url,
     c->is_listening = 1;
     c->is_udp = strncmp(url, "udp:", 4) == 0;
     LIST_ADD_HEAD(struct mg_connection, &mgr->conns, c);
+    MG_POLL_READY(c);
     c->fn = fn;
     c->fn_data = fn_data;
     c->is_tls = (mg_url_is_ssl(url) != 0);
@@ -4122,8 +5234,10 @@ struct mg_connection *mg_wrapfd(struct mg_mgr *mgr, int fd,
     c->fn = fn;
     c->fn_data = fn_data;
     MG_EPOLL_ADD(c);
+    MG_POLL_ADD(c);
     mg_call(c, MG_EV_OPEN, NULL);
     LIST_ADD_HEAD(struct mg_connection, &mgr->conns, c);
+    MG_POLL_READY(c);
   }
   return c;
 }
@@ -4134,6 +5248,7 @@ struct mg_timer *mg_timer_add(struct mg_mgr *mgr, uint64_t milliseconds,
   if (t != NULL) {
     flags |= MG_TIMER_AUTODELETE;  // We have alloc'ed it, so autodelete
     mg_timer_init(&mgr->timers, t, milliseconds, flags, fn, arg);
+    t->expire = mg_millis() + milliseconds;  // Not from the next poll
   }
   return t;
 }
@@ -4148,10 +5263,17 @@ long mg_io_recv(struct mg_connection *c, void *buf, size_t len) {
 
 void mg_mgr_free(struct mg_mgr *mgr) {
   struct mg_connection *c;
-  struct mg_timer *tmp, *t = mgr->timers;
-  while (t != NULL) tmp = t->next, mg_free(t), t = tmp;
+  struct mg_timer *tmp, *t;
+  for (c = mgr->conns; c != NULL; c = c->next) {
+    mg_timer_free(&mgr->timers, &c->dl_timer);  // Embedded, not allocated
+  }
+  for (t = mgr->timers; t != NULL; t = tmp) tmp = t->next, mg_free(t);
   mgr->timers = NULL;  // Important. Next call to poll won't touch timers
-  for (c = mgr->conns; c != NULL; c = c->next) c->is_closing = 1;
+  mg_timer_wheel_free(&mgr->wheel);
+  for (c = mgr->conns; c != NULL; c = c->next) {
+    c->is_closing = 1;
+    MG_POLL_READY(c);
+  }
   mg_mgr_poll(mgr, 0);
 #if MG_ENABLE_FREERTOS_TCP
   FreeRTOS_DeleteSocketSet(mgr->ss);
@@ -4159,8 +5281,13 @@ void mg_mgr_free(struct mg_mgr *mgr) {
   MG_DEBUG(("All connections closed"));
 #if MG_ENABLE_EPOLL
   if (mgr->epoll_fd >= 0) close(mgr->epoll_fd), mgr->epoll_fd = -1;
+#endif
+#if MG_ENABLE_POLL
+  mg_free(mgr->fds), mg_free(mgr->fdconns);
+  mgr->fds = NULL, mgr->fdconns = NULL, mgr->nfds = mgr->fdsize = 0;
 #endif
   mg_tls_ctx_free(mgr);
+  mg_chan_free(&mgr->chan);
 #if MG_ENABLE_TCPIP
   if (mgr->ifp) mg_tcpip_free(mgr->ifp);
 #endif
@@ -4192,6 +5319,11 @@ void mg_mgr_init(struct mg_mgr *mgr) {
   mgr->dns4.url = "udp://8.8.8.8:53";
   mgr->dns6.url = "udp://[2001:4860:4860::8888]:53";
   mg_tls_ctx_init(mgr);
+#if MG_ENABLE_SLAB
+  mg_slab_add(sizeof(struct mg_connection), sizeof(struct mg_connection),
+              MG_SLAB_CONNS);
+  mg_slab_add(1, MG_SLAB_SMALL_SIZE, MG_SLAB_SMALL);
+#endif
   MG_DEBUG(("MG_IO_SIZE: %lu, TLS: %s", MG_IO_SIZE,
             MG_TLS == MG_TLS_NONE      ? "none"
             : MG_TLS == MG_TLS_MBED    ? "MbedTLS"
@@ -6179,7 +7311,7 @@ static bool can_write(struct mg_connection *c) {
 void mg_mgr_poll(struct mg_mgr *mgr, int ms) {
   struct mg_connection *c, *tmp;
   uint64_t now = mg_millis();
-  mg_timer_poll(&mgr->timers, now);
+  mg_timer_wheel_poll(&mgr->wheel, &mgr->timers, now);
   if (mgr->ifp == NULL || mgr->ifp->driver == NULL) return;
   mg_tcpip_poll(mgr->ifp, now);
   for (c = mgr->conns; c != NULL; c = tmp) {
@@ -8457,8 +9589,39 @@ void mg_pfn_iobuf(char ch, void *param) {
   mg_pfn_iobuf_private(ch, param, true);
 }
 
+// Append a span with one size check, growing the buffer once for all of it.
+// If that fails, go char by char to keep the truncation rules of the above
+static void mg_iobuf_write(struct mg_iobuf *io, const char *buf, size_t len,
+                           bool expand) {
+  if (expand && io->len + len + 1 > io->size) {
+    mg_iobuf_resize(io, io->len + len + 1);
+  }
+  if (io->len + len + 1 <= io->size) {
+    memcpy(io->buf + io->len, buf, len);
+    io->len += len;
+    io->buf[io->len] = 0;
+  } else {
+    while (len-- > 0) mg_pfn_iobuf_private(*buf++, io, expand);
+  }
+}
+
+size_t mg_pfn_write(mg_pfn_t out, void *param, const char *buf, size_t len) {
+  size_t i;
+  if (len == 0) return 0;
+  if (out == mg_pfn_iobuf) {
+    mg_iobuf_write((struct mg_iobuf *) param, buf, len, true);
+  } else if (out == mg_putchar_iobuf_static) {
+    mg_iobuf_write((struct mg_iobuf *) param, buf, len, false);
+  } else if (out == mg_pfn_stdout) {
+    fwrite(buf, 1, len, stdout);
+  } else {
+    for (i = 0; i < len; i++) out(buf[i], param);  // Per-char adapter
+  }
+  return len;
+}
+
 size_t mg_vsnprintf(char *buf, size_t len, const char *fmt, va_list *ap) {
-  struct mg_iobuf io = {(uint8_t *) buf, len, 0, 0};
+  struct mg_iobuf io = {(uint8_t *) buf, len, 0, 0, 0};
   size_t n = mg_vxprintf(mg_putchar_iobuf_static, &io, fmt, ap);
   if (n < len) buf[n] = '\0';
   return n;
@@ -8474,7 +9637,7 @@ size_t mg_snprintf(char *buf, size_t len, const char *fmt, ...) {
 }
 
 char *mg_vmprintf(const char *fmt, va_list *ap) {
-  struct mg_iobuf io = {0, 0, 0, 256};
+  struct mg_iobuf io = {0, 0, 0, 256, 0};
   mg_vxprintf(mg_pfn_iobuf, &io, fmt, ap);
   return (char *) io.buf;
 }
@@ -8545,10 +9708,19 @@ static char mg_escape(int c) {
 
 static size_t qcpy(void (*out)(char, void *), void *ptr, char *buf,
                    size_t len) {
-  size_t i = 0, extra = 0;
+  size_t i = 0, j, extra = 0;
   for (i = 0; i < len && buf[i] != '\0'; i++) {
-    char c = mg_escape(buf[i]);
-    if (c) {
+    char c;
+    j = i;
+    while (j < len && (unsigned char) buf[j] >= 0x20 && buf[j] != '"' &&
+           buf[j] != '\\') {
+      j++;
+    }
+    if (j > i) {  // Printable run with nothing to escape
+      mg_pfn_write(out, ptr, &buf[i], j - i);
+      if ((i = j) >= len || buf[i] == '\0') break;
+    }
+    if ((c = mg_escape(buf[i])) != 0) {
       out('\\', ptr), out(c, ptr), extra++;
     } else {
       out(buf[i], ptr);
@@ -8686,6 +9858,62 @@ void mg_queue_del(struct mg_queue *q, size_t len) {
   assert(q->tail + sizeof(uint32_t) <= q->size);
 }
 
+// Channel slot sequence numbers tell who may touch a slot. For the lap
+// that puts message N, the slot is free when seq == N, and holds the
+// message when seq == N + 1. Producers race for head with a CAS
+struct mg_chan_slot {
+  volatile size_t seq;
+  struct mg_chan_msg msg;
+};
+
+bool mg_chan_init(struct mg_chan *ch, size_t size) {
+  size_t i;
+  memset(ch, 0, sizeof(*ch));
+  if (size == 0 || (size & (size - 1)) != 0) return false;
+  ch->slots = (struct mg_chan_slot *) mg_calloc(size, sizeof(*ch->slots));
+  if (ch->slots == NULL) return false;
+  for (i = 0; i < size; i++) ch->slots[i].seq = i;
+  ch->mask = size - 1;
+  return true;
+}
+
+void mg_chan_free(struct mg_chan *ch) {
+  mg_free(ch->slots);
+  memset(ch, 0, sizeof(*ch));
+}
+
+bool mg_chan_put(struct mg_chan *ch, const struct mg_chan_msg *m) {
+  struct mg_chan_slot *s;
+  size_t pos = ch->head, seq;
+  if (ch->slots == NULL) return false;
+  for (;;) {
+    s = &ch->slots[pos & ch->mask];
+    MG_MEMORY_BARRIER();
+    seq = s->seq;
+    if (seq == pos && MG_CAS(&ch->head, pos, pos + 1)) break;
+    if ((ptrdiff_t) (seq - pos) < 0) return false;  // Full
+    pos = ch->head;  // Lost the race, or slot reused. Retry
+  }
+  s->msg = *m;
+  MG_MEMORY_BARRIER();
+  s->seq = pos + 1;  // Publish
+  return true;
+}
+
+bool mg_chan_get(struct mg_chan *ch, struct mg_chan_msg *m) {
+  struct mg_chan_slot *s;
+  if (ch->slots == NULL) return false;
+  s = &ch->slots[ch->tail & ch->mask];
+  MG_MEMORY_BARRIER();
+  if (s->seq != ch->tail + 1) return false;  // Empty, or not published yet
+  MG_MEMORY_BARRIER();
+  *m = s->msg;
+  MG_MEMORY_BARRIER();
+  s->seq = ch->tail + ch->mask + 1;  // Free the slot for the next lap
+  ch->tail++;
+  return true;
+}
+
 #ifdef MG_ENABLE_LINES
 #line 1 "src/rpc.c"
 #endif
@@ -8693,19 +9921,96 @@ void mg_queue_del(struct mg_queue *q, size_t len) {
 
 
 
+// Index of a handler list, kept by its head. Exact method names are hashed
+// into slots with linear probing, patterns are kept apart, newest first
+struct mg_rpc_tab {
+  size_t size;            // Number of slots, a power of 2
+  size_t count;           // Used slots
+  size_t nglobs;          // Number of patterns
+  struct mg_rpc **slots;  // Exact names, NULL if empty
+  struct mg_rpc **globs;  // Patterns
+};
+
+static bool rpc_is_glob(struct mg_str s) {
+  size_t i;
+  for (i = 0; i < s.len; i++) {
+    if (s.buf[i] == '*' || s.buf[i] == '?' || s.buf[i] == '#') return true;
+  }
+  return false;
+}
+
+static uint32_t rpc_hash(struct mg_str s) {
+  uint32_t h = 2166136261U;  // FNV-1a
+  size_t i;
+  for (i = 0; i < s.len; i++) h = (h ^ (uint8_t) s.buf[i]) * 16777619U;
+  return h;
+}
+
+// Slot that holds method, or the empty slot where it would go
+static struct mg_rpc **rpc_slot(struct mg_rpc_tab *t, struct mg_str method) {
+  size_t i = rpc_hash(method) & (t->size - 1);
+  struct mg_rpc *h;
+  while ((h = t->slots[i]) != NULL &&
+         (h->method.len != method.len ||
+          (method.len > 0 &&
+           memcmp(h->method.buf, method.buf, method.len) != 0))) {
+    i = (i + 1) & (t->size - 1);
+  }
+  return &t->slots[i];
+}
+
+// Build the index of a list from scratch. Without memory the list is left
+// unindexed, and is searched linearly
+static void rpc_reindex(struct mg_rpc *head) {
+  struct mg_rpc_tab *t;
+  struct mg_rpc *h, **slot;
+  size_t n = 0, nglobs = 0, size = 8;
+  if (head == NULL) return;
+  for (h = head; h != NULL; h = h->next) {
+    if (rpc_is_glob(h->method)) nglobs++;
+    else n++;
+  }
+  while (size < 2 * n) size *= 2;  // Keep at most half the slots used
+  t = (struct mg_rpc_tab *) mg_calloc(
+      1, sizeof(*t) + (size + nglobs) * sizeof(struct mg_rpc *));
+  if ((head->tab = t) == NULL) return;
+  t->size = size;
+  t->slots = (struct mg_rpc **) (t + 1);
+  t->globs = t->slots + size;
+  for (h = head; h != NULL; h = h->next) {
+    if (rpc_is_glob(h->method)) {
+      t->globs[t->nglobs++] = h;
+    } else if (*(slot = rpc_slot(t, h->method)) == NULL) {
+      *slot = h, t->count++;  // Newer handler shadows older, same name
+    }
+  }
+}
+
 void mg_rpc_add(struct mg_rpc **head, struct mg_str method,
                 void (*fn)(struct mg_rpc_req *), void *fn_data) {
   struct mg_rpc *rpc = (struct mg_rpc *) mg_calloc(1, sizeof(*rpc));
   if (rpc != NULL) {
+    struct mg_rpc_tab *t = *head == NULL ? NULL : (*head)->tab;
     rpc->method = mg_strdup(method);
     rpc->fn = fn;
     rpc->fn_data = fn_data;
     rpc->next = *head, *head = rpc;
+    if (rpc->next != NULL) rpc->next->tab = NULL;  // Index moves to new head
+    if (t != NULL && !rpc_is_glob(rpc->method) &&
+        2 * (t->count + 1) <= t->size) {
+      struct mg_rpc **slot = rpc_slot(t, rpc->method);
+      if (*slot == NULL) t->count++;
+      *slot = rpc, rpc->tab = t;
+    } else {
+      mg_free(t);  // Grow, or add a pattern: rare enough to start over
+      rpc_reindex(rpc);
+    }
   }
 }
 
 void mg_rpc_del(struct mg_rpc **head, void (*fn)(struct mg_rpc_req *)) {
-  struct mg_rpc *r;
+  struct mg_rpc *r, **list = head;
+  if (*head != NULL) mg_free((*head)->tab), (*head)->tab = NULL;
   while ((r = *head) != NULL) {
     if (r->fn == fn || fn == NULL) {
       *head = r->next;
@@ -8715,11 +10020,38 @@ void mg_rpc_del(struct mg_rpc **head, void (*fn)(struct mg_rpc_req *)) {
       head = &(*head)->next;
     }
   }
+  rpc_reindex(*list);
+}
+
+// Like mg_json_get() on the frame, from the tape if there is one
+static int rpc_get(struct mg_rpc_req *r, const char *path, int *len) {
+  int i;
+  if (r->tape == NULL) return mg_json_get(r->frame, path, len);
+  i = mg_json_tape_find(r->tape, path);
+  *len = i < 0 ? 0 : r->tape->toks[i].len;
+  return i < 0 ? i : r->tape->toks[i].ofs;
+}
+
+// Exact names are looked up first, then patterns. Unindexed lists, e.g.
+// when the index could not be allocated, are searched in order
+static struct mg_rpc *rpc_find(struct mg_rpc *head, struct mg_str method) {
+  struct mg_rpc_tab *t = head == NULL ? NULL : head->tab;
+  struct mg_rpc *h = NULL;
+  size_t i;
+  if (t == NULL) {
+    for (h = head; h != NULL && !mg_match(method, h->method, NULL);) {
+      h = h->next;
+    }
+  } else if ((h = *rpc_slot(t, method)) == NULL) {
+    for (i = 0; i < t->nglobs && h == NULL; i++) {
+      if (mg_match(method, t->globs[i]->method, NULL)) h = t->globs[i];
+    }
+  }
+  return h;
 }
 
 static void mg_rpc_call(struct mg_rpc_req *r, struct mg_str method) {
-  struct mg_rpc *h = r->head == NULL ? NULL : *r->head;
-  while (h != NULL && !mg_match(method, h->method, NULL)) h = h->next;
+  struct mg_rpc *h = rpc_find(r->head == NULL ? NULL : *r->head, method);
   if (h != NULL) {
     r->rpc = h;
     h->fn(r);
@@ -8728,22 +10060,33 @@ static void mg_rpc_call(struct mg_rpc_req *r, struct mg_str method) {
   }
 }
 
+// Tokenize the frame once for the dispatch, mg_rpc_ok() and the handler
 void mg_rpc_process(struct mg_rpc_req *r) {
-  int len, off = mg_json_get(r->frame, "$.method", &len);
+  struct mg_json_tok toks[MG_JSON_TAPE_SIZE];
+  struct mg_json_tape tape;
+  const struct mg_json_tape *saved = r->tape;
+  int len, off;
+  r->tape = NULL;
+  if (mg_json_tape_init_alloc(&tape, r->frame, toks, MG_JSON_TAPE_SIZE) > 0) {
+    r->tape = &tape;
+  }
+  off = rpc_get(r, "$.method", &len);
   if (off > 0 && r->frame.buf[off] == '"') {
     struct mg_str method = mg_str_n(&r->frame.buf[off + 1], (size_t) len - 2);
     mg_rpc_call(r, method);
-  } else if ((off = mg_json_get(r->frame, "$.result", &len)) > 0 ||
-             (off = mg_json_get(r->frame, "$.error", &len)) > 0) {
+  } else if ((off = rpc_get(r, "$.result", &len)) > 0 ||
+             (off = rpc_get(r, "$.error", &len)) > 0) {
     mg_rpc_call(r, mg_str(""));  // JSON response! call "" method handler
   } else {
     mg_rpc_err(r, -32700, "%m", mg_print_esc, (int) r->frame.len,
                r->frame.buf);  // Invalid
   }
+  mg_json_tape_free(&tape, toks);
+  r->tape = saved;
 }
 
 void mg_rpc_vok(struct mg_rpc_req *r, const char *fmt, va_list *ap) {
-  int len, off = mg_json_get(r->frame, "$.id", &len);
+  int len, off = rpc_get(r, "$.id", &len);
   if (off > 0) {
     mg_xprintf(r->pfn, r->pfn_data, "{%m:%.*s,%m:", mg_print_esc, 0, "id", len,
                &r->frame.buf[off], mg_print_esc, 0, "result");
@@ -8760,7 +10103,7 @@ void mg_rpc_ok(struct mg_rpc_req *r, const char *fmt, ...) {
 }
 
 void mg_rpc_verr(struct mg_rpc_req *r, int code, const char *fmt, va_list *ap) {
-  int len, off = mg_json_get(r->frame, "$.id", &len);
+  int len, off = rpc_get(r, "$.id", &len);
   mg_xprintf(r->pfn, r->pfn_data, "{");
   if (off > 0) {
     mg_xprintf(r->pfn, r->pfn_data, "%m:%.*s,", mg_print_esc, 0, "id", len,
@@ -8779,6 +10122,16 @@ void mg_rpc_err(struct mg_rpc_req *r, int code, const char *fmt, ...) {
   va_end(ap);
 }
 
+bool mg_rpc_defer(struct mg_rpc_req *r, char *buf, size_t len) {
+  int n, off = rpc_get(r, "$.id", &n);
+  if (off <= 0 || mg_snprintf(buf, len, "{%m:%.*s}", mg_print_esc, 0, "id", n,
+                              &r->frame.buf[off]) >= len) {
+    if (len > 0) buf[0] = '\0';
+    return false;
+  }
+  return true;
+}
+
 static size_t print_methods(mg_pfn_t pfn, void *pfn_data, va_list *ap) {
   struct mg_rpc *h, **head = (struct mg_rpc **) va_arg(*ap, void **);
   size_t len = 0;
@@ -9344,6 +10697,107 @@ void mg_sha384(uint8_t dst[48], uint8_t *data, size_t datasz) {
   mg_sha384_final(dst, &ctx);
 }
 
+#ifdef MG_ENABLE_LINES
+#line 1 "src/slab.c"
+#endif
+
+
+
+#if MG_ENABLE_SLAB
+static mg_spinlock_t s_slab_lock = MG_SPINLOCK_INIT;
+
+struct slab_obj {
+  struct slab_obj *next;
+};
+
+struct slab {
+  size_t min_size;         // Smallest request served
+  char *buf, *end;         // Preallocated objects
+  struct slab_obj *free;   // Free list
+  struct mg_slab_stats st;
+};
+
+// Pools are sorted by size, the first one that fits wins
+static struct slab s_slabs[MG_SLAB_CLASSES];
+static size_t s_nslabs;
+
+// Pools are shared by all managers. Adding the same pool again is a no-op
+bool mg_slab_add(size_t min_size, size_t size, size_t count) {
+  size_t i, j, osize = (size + 7) & ~(size_t) 7;
+  char *buf = count ? (char *) calloc(count, osize) : NULL;
+  bool ok = false;
+  if (buf == NULL) return false;
+  MG_SPIN_LOCK(&s_slab_lock);
+  for (i = 0; i < s_nslabs; i++) {
+    if (s_slabs[i].st.size == size && s_slabs[i].min_size == min_size) break;
+  }
+  if (i < s_nslabs) {
+    ok = true;  // Already there
+  } else if (s_nslabs < MG_SLAB_CLASSES) {
+    struct slab *sl;
+    for (i = s_nslabs++; i > 0 && s_slabs[i - 1].st.size > size; i--) {
+      s_slabs[i] = s_slabs[i - 1];
+    }
+    sl = &s_slabs[i];
+    memset(sl, 0, sizeof(*sl));
+    sl->min_size = min_size, sl->st.size = size, sl->st.count = count;
+    sl->buf = buf, sl->end = buf + count * osize;
+    for (j = count; j > 0; j--) {
+      struct slab_obj *o = (struct slab_obj *) (buf + (j - 1) * osize);
+      o->next = sl->free, sl->free = o;
+    }
+    buf = NULL, ok = true;
+  }
+  MG_SPIN_UNLOCK(&s_slab_lock);
+  free(buf);
+  return ok;
+}
+
+void *mg_slab_alloc(size_t size) {
+  struct slab_obj *o = NULL;
+  size_t i;
+  MG_SPIN_LOCK(&s_slab_lock);
+  for (i = 0; i < s_nslabs; i++) {
+    struct slab *sl = &s_slabs[i];
+    if (size < sl->min_size || size > sl->st.size) continue;
+    if ((o = sl->free) == NULL) {
+      sl->st.fails++;
+    } else {
+      sl->free = o->next;
+      if (++sl->st.used > sl->st.peak) sl->st.peak = sl->st.used;
+    }
+    break;
+  }
+  MG_SPIN_UNLOCK(&s_slab_lock);
+  if (o != NULL) memset(o, 0, size);
+  return o;
+}
+
+bool mg_slab_free(void *ptr) {
+  char *p = (char *) ptr;
+  size_t i;
+  bool ok = false;
+  MG_SPIN_LOCK(&s_slab_lock);
+  for (i = 0; i < s_nslabs && !ok; i++) {
+    struct slab *sl = &s_slabs[i];
+    if (p < sl->buf || p >= sl->end) continue;
+    ((struct slab_obj *) ptr)->next = sl->free, sl->free = ptr;
+    sl->st.used--;
+    ok = true;
+  }
+  MG_SPIN_UNLOCK(&s_slab_lock);
+  return ok;
+}
+
+size_t mg_slab_stats(struct mg_slab_stats *st, size_t max) {
+  size_t i;
+  MG_SPIN_LOCK(&s_slab_lock);
+  for (i = 0; i < s_nslabs && i < max; i++) st[i] = s_slabs[i].st;
+  MG_SPIN_UNLOCK(&s_slab_lock);
+  return s_nslabs;
+}
+#endif
+
 #ifdef MG_ENABLE_LINES
 #line 1 "src/sntp.c"
 #endif
@@ -9397,6 +10851,7 @@ static void sntp_cb(struct mg_connection *c, int ev, void *ev_data) {
   uint64_t *expiration_time = (uint64_t *) c->data;
   if (ev == MG_EV_OPEN) {
     *expiration_time = mg_millis() + 3000;  // Store expiration time in 3s
+    c->is_polling = 1;                      // Check expiration on MG_EV_POLL
   } else if (ev == MG_EV_CONNECT) {
     mg_sntp_request(c);
   } else if (ev == MG_EV_READ) {
@@ -9532,12 +10987,43 @@ static void setlocaddr(MG_SOCKET_TYPE fd, struct mg_addr *addr) {
   }
 }
 
+#if MG_ENABLE_IOBUF_POOL
+// Return empty buffers of quiet connections to the iobuf pool
+static void iobuf_sweep(void *arg) {
+  struct mg_mgr *mgr = (struct mg_mgr *) arg;
+  struct mg_connection *c;
+  uint64_t now = mg_millis();
+  bool again = false;
+  for (c = mgr->conns; c != NULL; c = c->next) {
+    if (now - c->io_ms >= MG_IOBUF_IDLE_MS) {
+      if (c->recv.len == 0) mg_iobuf_free(&c->recv);
+      if (c->send.len == 0) mg_iobuf_free(&c->send);
+      if (c->rtls.len == 0) mg_iobuf_free(&c->rtls);
+    }
+    if (c->recv.size + c->send.size + c->rtls.size > 0) again = true;
+  }
+  mgr->io_sweep = again && mg_timer_add(mgr, MG_IOBUF_IDLE_MS, MG_TIMER_ONCE,
+                                        iobuf_sweep, mgr) != NULL;
+}
+
+static void iobuf_touch(struct mg_connection *c) {
+  if (!c->mgr->io_sweep) {
+    c->mgr->io_sweep = mg_timer_add(c->mgr, MG_IOBUF_IDLE_MS, MG_TIMER_ONCE,
+                                    iobuf_sweep, c->mgr) != NULL;
+  }
+}
+#else
+#define iobuf_touch(c)
+#endif
+
 static void iolog(struct mg_connection *c, char *buf, long n, bool r) {
   if (n == MG_IO_WAIT) {
     // Do nothing
   } else if (n <= 0) {
     c->is_closing = 1;  // Termination. Don't call mg_error(): #1529
   } else if (n > 0) {
+    c->io_ms = mg_millis();
+    iobuf_touch(c);
     if (c->is_hexdumping) {
       MG_INFO(("\n-- %lu %M %s %M %ld", c->id, mg_print_ip_port, &c->loc,
                r ? "<-" : "->", mg_print_ip_port, &c->rem, n));
@@ -9547,9 +11033,9 @@ static void iolog(struct mg_connection *c, char *buf, long n, bool r) {
       c->recv.len += (size_t) n;
       mg_call(c, MG_EV_READ, &n);
     } else {
-      mg_iobuf_del(&c->send, 0, (size_t) n);
+      mg_sendq_del(c, (size_t) n);
       // if (c->send.len == 0) mg_iobuf_resize(&c->send, 0);
-      if (c->send.len == 0) {
+      if (c->send.len == 0 && c->sendq == NULL) {
         MG_EPOLL_MOD(c, 0);
       }
       mg_call(c, MG_EV_WRITE, &n);
@@ -9574,6 +11060,39 @@ long mg_io_send(struct mg_connection *c, const void *buf, size_t len) {
   return n;
 }
 
+#if MG_ENABLE_SENDQ
+// Send parts in one call, where the platform has a gather send
+static long mg_io_sendv(struct mg_connection *c, const struct mg_str *v,
+                        size_t n) {
+#if MG_ARCH == MG_ARCH_UNIX || MG_ARCH == MG_ARCH_ESP32 || MG_ENABLE_LWIP
+  struct iovec iov[MG_SENDQ_IOV];
+  size_t i;
+  long res;
+  for (i = 0; i < n && i < MG_SENDQ_IOV; i++) {
+    iov[i].iov_base = v[i].buf, iov[i].iov_len = v[i].len;
+  }
+#if MG_ARCH == MG_ARCH_UNIX
+  {
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov, msg.msg_iovlen = i;
+    res = sendmsg(FD(c), &msg, MSG_NONBLOCKING);
+  }
+#else
+  res = lwip_writev(FD(c), iov, (int) i);
+#endif
+  MG_VERBOSE(("%lu %ld %d", c->id, res, MG_SOCK_ERR(res)));
+  if (MG_SOCK_PENDING(res)) return MG_IO_WAIT;
+  if (MG_SOCK_RESET(res)) return MG_IO_RESET;
+  if (res <= 0) return MG_IO_ERR;
+  return res;
+#else
+  (void) n;
+  return mg_io_send(c, v[0].buf, v[0].len);
+#endif
+}
+#endif
+
 bool mg_send(struct mg_connection *c, const void *buf, size_t len) {
   if (c->is_udp) {
     long n = mg_io_send(c, buf, len);
@@ -9582,7 +11101,9 @@ bool mg_send(struct mg_connection *c, const void *buf, size_t len) {
     iolog(c, (char *) buf, n, false);
     return n > 0;
   } else {
-    return len == 0 || mg_iobuf_add(&c->send, c->send.len, buf, len) > 0;
+    bool ok = len == 0 || mg_iobuf_add(&c->send, c->send.len, buf, len) > 0;
+    MG_POLL_MOD(c);  // We may want to write now
+    return ok;
     // returning 0 means an OOM condition (iobuf couldn't resize), yet this is
     // so far recoverable, let the caller decide
   }
@@ -9700,6 +11221,7 @@ bool mg_open_listener(struct mg_connection *c, const char *url) {
       mg_set_non_blocking_mode(fd);
       c->fd = S2PTR(fd);
       MG_EPOLL_ADD(c);
+      MG_POLL_ADD(c);
       success = true;
     }
   }
@@ -9781,7 +11303,23 @@ static void read_conn(struct mg_connection *c) {
 static void write_conn(struct mg_connection *c) {
   char *buf = (char *) c->send.buf;
   size_t len = c->send.len;
-  long n = c->is_tls ? mg_tls_send(c, buf, len) : mg_io_send(c, buf, len);
+  long n;
+#if MG_ENABLE_SENDQ
+  // Queued segments go first. TLS encrypts them one by one, in place
+  struct mg_str v[MG_SENDQ_IOV];
+  struct mg_sendseg *seg;
+  size_t nv = 0, max = c->is_tls || c->is_hexdumping ? 1 : MG_SENDQ_IOV;
+  for (seg = c->sendq; seg != NULL && nv < max; seg = seg->next) {
+    v[nv++] = mg_str_n((char *) seg->buf, seg->len);
+  }
+  if (nv < max && len > 0) v[nv++] = mg_str_n(buf, len);
+  if (nv > 0) buf = v[0].buf, len = v[0].len;
+  n = nv > 1       ? mg_io_sendv(c, v, nv)
+      : c->is_tls ? mg_tls_send(c, buf, len)
+                  : mg_io_send(c, buf, len);
+#else
+  n = c->is_tls ? mg_tls_send(c, buf, len) : mg_io_send(c, buf, len);
+#endif
   // TODO(): mg_tls_send() may return 0 forever on steady OOM
   MG_DEBUG(("%lu %ld snd %ld/%ld rcv %ld/%ld n=%ld err=%d", c->id, c->fd,
             (long) c->send.len, (long) c->send.size, (long) c->recv.len,
@@ -9790,6 +11328,7 @@ static void write_conn(struct mg_connection *c) {
 }
 
 static void close_conn(struct mg_connection *c) {
+  MG_POLL_DEL(c);
   if (FD(c) != MG_INVALID_SOCKET) {
 #if MG_ENABLE_EPOLL
     epoll_ctl(c->mgr->epoll_fd, EPOLL_CTL_DEL, FD(c), NULL);
@@ -9845,6 +11384,7 @@ void mg_connect_resolved(struct mg_connection *c) {
     mg_error(c, "socket(): %d", MG_SOCK_ERR(-1));
   } else if (c->is_udp) {
     MG_EPOLL_ADD(c);
+    MG_POLL_ADD(c);
 #if MG_ARCH == MG_ARCH_TIRTOS
     union usa usa;  // TI-RTOS NDK requires binding to receive on UDP sockets
     socklen_t slen = tousa(&c->loc, &usa);
@@ -9860,6 +11400,7 @@ void mg_connect_resolved(struct mg_connection *c) {
     mg_set_non_blocking_mode(FD(c));
     setsockopts(c);
     MG_EPOLL_ADD(c);
+    MG_POLL_ADD(c);
     mg_call(c, MG_EV_RESOLVE, NULL);
     rc = connect(FD(c), &usa.sa, slen);  // Attempt to connect
     if (rc == 0) {                       // Success
@@ -9869,6 +11410,7 @@ void mg_connect_resolved(struct mg_connection *c) {
     } else if (MG_SOCK_PENDING(rc)) {    // Need to wait for TCP handshake
       MG_DEBUG(("%lu %ld -> %M pend", c->id, c->fd, mg_print_ip_port, &c->rem));
       c->is_connecting = 1;
+      MG_POLL_MOD(c);
     } else {
       mg_error(c, "connect: %d", MG_SOCK_ERR(rc));
     }
@@ -9885,33 +11427,60 @@ static MG_SOCKET_TYPE raccept(MG_SOCKET_TYPE sock, union usa *usa,
   return fd;
 }
 
-static void accept_conn(struct mg_mgr *mgr, struct mg_connection *lsn) {
+// Accepted socket passed to another manager, see mg_mgr_shard()
+// What an accepted connection inherits from its listener. A copy, because
+// the listener belongs to another manager when the connection is handed off
+struct lsn_info {
+  unsigned long id;
+  struct mg_addr loc;
+  mg_event_handler_t fn, pfn;
+  void *fn_data, *pfn_data;
+  const struct mg_deadlines *deadlines;  // User's, not the listener's
+  bool is_tls, is_hexdumping;
+};
+
+struct handoff {
+  unsigned long id;            // Always 0, mg_wakeup() uses non-zero IDs
+  struct lsn_info lsn;         // Listener settings
+  MG_SOCKET_TYPE fd;           // Accepted socket
+  socklen_t len;               // Peer address length
+  union usa usa;               // Peer address
+};
+
+static void lsn_copy(struct lsn_info *l, const struct mg_connection *lsn) {
+  l->id = lsn->id, l->loc = lsn->loc, l->deadlines = lsn->deadlines;
+  l->fn = lsn->fn, l->fn_data = lsn->fn_data;
+  l->pfn = lsn->pfn, l->pfn_data = lsn->pfn_data;
+  l->is_tls = lsn->is_tls, l->is_hexdumping = lsn->is_hexdumping;
+}
+
+static bool handoff(struct mg_mgr *mgr, const struct lsn_info *lsn,
+                    MG_SOCKET_TYPE fd, union usa *usa, socklen_t len) {
+  struct mg_mgr *dst;
+  struct handoff h;
+  if (mgr->nshards == 0) return false;
+  dst = mgr->shards[mgr->nextshard++ % mgr->nshards];
+  if (dst == mgr || dst->pipe == MG_INVALID_SOCKET) return false;
+  memset(&h, 0, sizeof(h));
+  h.lsn = *lsn, h.fd = fd, h.len = len, h.usa = *usa;
+  // A failed send keeps the connection here
+  return send(dst->pipe, (char *) &h, sizeof(h), MSG_NONBLOCKING) ==
+         (long) sizeof(h);
+}
+
+static void accepted(struct mg_mgr *mgr, const struct lsn_info *lsn,
+                     MG_SOCKET_TYPE fd, union usa *usa, socklen_t sa_len) {
   struct mg_connection *c = NULL;
-  union usa usa;
-  socklen_t sa_len = sizeof(usa);
-  MG_SOCKET_TYPE fd = raccept(FD(lsn), &usa, &sa_len);
-  if (fd == MG_INVALID_SOCKET) {
-#if MG_ARCH == MG_ARCH_THREADX || defined(__ECOS)
-    // NetxDuo, in non-block socket mode can mark listening socket readable
-    // even it is not. See comment for 'select' func implementation in
-    // nx_bsd.c That's not an error, just should try later
-    if (errno != EAGAIN)
-#endif
-      MG_ERROR(("%lu accept failed, errno %d", lsn->id, MG_SOCK_ERR(-1)));
-#if (MG_ARCH != MG_ARCH_WIN32) && !MG_ENABLE_FREERTOS_TCP && \
-    (MG_ARCH != MG_ARCH_TIRTOS) && !MG_ENABLE_POLL && !MG_ENABLE_EPOLL
-  } else if ((long) fd >= FD_SETSIZE) {
-    MG_ERROR(("%ld > %ld", (long) fd, (long) FD_SETSIZE));
-    closesocket(fd);
-#endif
-  } else if ((c = mg_alloc_conn(mgr)) == NULL) {
+  if ((c = mg_alloc_conn(mgr)) == NULL) {
     MG_ERROR(("%lu OOM", lsn->id));
     closesocket(fd);
   } else {
-    tomgaddr(&usa, &c->rem, sa_len != sizeof(usa.sin));
+    tomgaddr(usa, &c->rem, sa_len != sizeof(usa->sin));
     LIST_ADD_HEAD(struct mg_connection, &mgr->conns, c);
+    MG_POLL_READY(c);
     c->fd = S2PTR(fd);
     MG_EPOLL_ADD(c);
+    MG_POLL_ADD(c);
     mg_set_non_blocking_mode(FD(c));
     setsockopts(c);
     c->is_accepted = 1;
@@ -9922,6 +11491,7 @@ static void accept_conn(struct mg_mgr *mgr, struct mg_connection *lsn) {
     c->fn = lsn->fn;
     c->fn_data = lsn->fn_data;
     c->is_tls = lsn->is_tls;
+    c->deadlines = lsn->deadlines;
     MG_DEBUG(("%lu %ld accepted %M -> %M", c->id, c->fd, mg_print_ip_port,
               &c->rem, mg_print_ip_port, &c->loc));
     mg_call(c, MG_EV_OPEN, NULL);
@@ -9930,12 +11500,41 @@ static void accept_conn(struct mg_mgr *mgr, struct mg_connection *lsn) {
   }
 }
 
+static void accept_conn(struct mg_mgr *mgr, struct mg_connection *lsn) {
+  union usa usa;
+  socklen_t sa_len = sizeof(usa);
+  MG_SOCKET_TYPE fd = raccept(FD(lsn), &usa, &sa_len);
+  if (fd == MG_INVALID_SOCKET) {
+#if MG_ARCH == MG_ARCH_THREADX || defined(__ECOS)
+    // NetxDuo, in non-block socket mode can mark listening socket readable
+    // even it is not. See comment for 'select' func implementation in
+    // nx_bsd.c That's not an error, just should try later
+    if (errno != EAGAIN)
+#endif
+      MG_ERROR(("%lu accept failed, errno %d", lsn->id, MG_SOCK_ERR(-1)));
+#if (MG_ARCH != MG_ARCH_WIN32) && !MG_ENABLE_FREERTOS_TCP && \
+    (MG_ARCH != MG_ARCH_TIRTOS) && !MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+  } else if ((long) fd >= FD_SETSIZE) {
+    MG_ERROR(("%ld > %ld", (long) fd, (long) FD_SETSIZE));
+    closesocket(fd);
+#endif
+  } else {
+    struct lsn_info l;
+    lsn_copy(&l, lsn);
+    if (!handoff(mgr, &l, fd, &usa, sa_len)) {
+      accepted(mgr, &l, fd, &usa, sa_len);
+    }
+  }
+}
+
 static bool can_read(const struct mg_connection *c) {
   return c->is_full == false;
 }
 
 static bool can_write(const struct mg_connection *c) {
-  return c->is_connecting || (c->send.len > 0 && c->is_tls_hs == 0);
+  return c->is_connecting ||
+         ((c->send.len > 0 || c->sendq != NULL) && c->is_tls_hs == 0) ||
+         c->is_tls_throttled;
 }
 
 static bool skip_iotest(const struct mg_connection *c) {
@@ -9943,6 +11542,97 @@ static bool skip_iotest(const struct mg_connection *c) {
          (can_read(c) == false && can_write(c) == false);
 }
 
+#if MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+void mg_poll_add(struct mg_connection *c) {
+  struct mg_mgr *mgr = c->mgr;
+  if (c->fdslot > 0 || FD(c) == MG_INVALID_SOCKET) return;
+  if (mgr->nfds >= mgr->fdsize) {  // Grow poll set, double its size
+    size_t size = mgr->fdsize == 0 ? 8 : mgr->fdsize * 2;
+    struct pollfd *fds = (struct pollfd *) mg_calloc(size, sizeof(*fds));
+    struct mg_connection **conns =
+        (struct mg_connection **) mg_calloc(size, sizeof(*conns));
+    if (fds == NULL || conns == NULL) {
+      mg_free(fds);
+      mg_free(conns);
+      mg_error(c, "OOM");
+      return;
+    }
+    if (mgr->nfds > 0) {
+      memcpy(fds, mgr->fds, mgr->nfds * sizeof(*fds));
+      memcpy(conns, mgr->fdconns, mgr->nfds * sizeof(*conns));
+    }
+    mg_free(mgr->fds);
+    mg_free(mgr->fdconns);
+    mgr->fds = fds, mgr->fdconns = conns, mgr->fdsize = size;
+  }
+  mgr->fdconns[mgr->nfds] = c;
+  c->fdslot = ++mgr->nfds;
+  mg_poll_mod(c);
+}
+
+void mg_poll_del(struct mg_connection *c) {
+  struct mg_mgr *mgr = c->mgr;
+  size_t slot = c->fdslot, last = mgr->nfds;
+  if (c->is_queued) {  // Leave the ready list, it is short
+    struct mg_connection **h = &mgr->ready;
+    while (*h != c) h = &(*h)->rnext;
+    *h = c->rnext;
+    c->is_queued = 0;
+  }
+  if (slot == 0) return;
+  if (slot < last) {  // Move the last slot into the one being released
+    mgr->fds[slot - 1] = mgr->fds[last - 1];
+    mgr->fdconns[slot - 1] = mgr->fdconns[last - 1];
+    mgr->fdconns[slot - 1]->fdslot = slot;
+  }
+  mgr->nfds--;
+  c->fdslot = 0;
+}
+
+static void ready_add(struct mg_connection *c) {
+  if (c->is_queued) return;
+  c->rnext = c->mgr->ready;
+  c->mgr->ready = c;
+  c->is_queued = 1;
+}
+
+void mg_poll_ready(struct mg_connection *c) {
+  ready_add(c);
+  c->mgr->fdbusy = true;  // Don't wait in poll(), there is work to do
+}
+
+// Flags can be set by timers, by other connections' handlers, or by user
+// code between polls. Schedule the connections that carry them, so that an
+// idle socket is closed, or starts getting MG_EV_POLL, without waiting for
+// I/O. A draining connection with data left waits for POLLOUT instead
+static void ready_flagged(struct mg_mgr *mgr) {
+  struct mg_connection *c;
+  for (c = mgr->conns; c != NULL; c = c->next) {
+    if (c->is_queued) continue;
+    if (c->is_closing ||
+        (c->is_draining && c->send.len == 0 && c->sendq == NULL)) {
+      mg_poll_ready(c);
+    } else if (c->is_polling) {
+      ready_add(c);
+    }
+  }
+}
+
+void mg_poll_mod(struct mg_connection *c) {
+  struct pollfd *p;
+  if (c->fdslot == 0) return;
+  p = &c->mgr->fds[c->fdslot - 1];
+  p->events = 0;
+  if (skip_iotest(c)) {
+    p->fd = MG_INVALID_SOCKET;  // poll() ignores negative descriptors
+  } else {
+    p->fd = FD(c);
+    if (can_read(c)) p->events |= POLLIN;
+    if (can_write(c)) p->events |= POLLOUT;
+  }
+}
+#endif
+
 static void mg_iotest(struct mg_mgr *mgr, int ms) {
 #if MG_ENABLE_FREERTOS_TCP
   struct mg_connection *c;
@@ -9988,47 +11678,31 @@ static void mg_iotest(struct mg_mgr *mgr, int ms) {
   }
   (void) skip_iotest;
 #elif MG_ENABLE_POLL
-  nfds_t n = 0;
-  for (struct mg_connection *c = mgr->conns; c != NULL; c = c->next) n++;
-  struct pollfd *fds = (struct pollfd *) alloca(n * sizeof(fds[0]));
-  memset(fds, 0, n * sizeof(fds[0]));
-  n = 0;
-  for (struct mg_connection *c = mgr->conns; c != NULL; c = c->next) {
-    c->is_readable = c->is_writable = 0;
-    if (c->is_closing) ms = 1;
-    if (skip_iotest(c)) {
-      // Socket not valid, ignore
-    } else {
-      // Don't wait if TLS is ready
-      if (c->rtls.len > 0 || mg_tls_pending(c) > 0) ms = 1;
-      fds[n].fd = FD(c);
-      if (can_read(c)) fds[n].events |= POLLIN;
-      if (can_write(c)) fds[n].events |= POLLOUT;
-      n++;
-    }
-  }
-
-  // MG_INFO(("poll n=%d ms=%d", (int) n, ms));
-  if (poll(fds, n, ms) < 0) {
+  // The poll set is persistent: slots are taken and released as connections
+  // come and go, event masks are refreshed by mg_poll_mod(). Only slots
+  // reported by poll() are touched here
+  size_t i;
+  int n;
+  if (mgr->fdbusy) ms = 0;  // Closing connection, or TLS data is buffered
+  mgr->fdbusy = false;
+  if (mgr->ready != NULL) ms = 0;  // Queued connections have work to do
+  // MG_INFO(("poll n=%d ms=%d", (int) mgr->nfds, ms));
+  if ((n = poll(mgr->fds, (nfds_t) mgr->nfds, ms)) < 0) {
 #if MG_ARCH == MG_ARCH_WIN32
-    if (n == 0) Sleep(ms);  // On Windows, poll fails if no sockets
+    if (mgr->nfds == 0) Sleep(ms);  // On Windows, poll fails if no sockets
 #endif
-    memset(fds, 0, n * sizeof(fds[0]));
   }
-  n = 0;
-  for (struct mg_connection *c = mgr->conns; c != NULL; c = c->next) {
-    if (skip_iotest(c)) {
-      // Socket not valid, ignore
+  for (i = 0; n > 0 && i < mgr->nfds; i++) {
+    struct pollfd *p = &mgr->fds[i];
+    struct mg_connection *c = mgr->fdconns[i];
+    if (p->revents == 0) continue;
+    n--;
+    if (p->revents & POLLERR) {
+      mg_error(c, "socket error");
     } else {
-      if (fds[n].revents & POLLERR) {
-        mg_error(c, "socket error");
-      } else {
-        c->is_readable =
-            (unsigned) (fds[n].revents & (POLLIN | POLLHUP) ? 1 : 0);
-        c->is_writable = (unsigned) (fds[n].revents & POLLOUT ? 1 : 0);
-        if (c->rtls.len > 0 || mg_tls_pending(c) > 0) c->is_readable = 1;
-      }
-      n++;
+      if (p->revents & (POLLIN | POLLHUP)) c->is_readable = 1;
+      if (p->revents & POLLOUT) c->is_writable = 1;
+      ready_add(c);
     }
   }
 #else
@@ -10115,7 +11789,13 @@ static void wufn(struct mg_connection *c, int ev, void *ev_data) {
     unsigned long *id = (unsigned long *) c->recv.buf;
     // MG_INFO(("Got data"));
     // mg_hexdump(c->recv.buf, c->recv.len);
-    if (c->recv.len >= sizeof(*id)) {
+    if (c->recv.len == sizeof(struct handoff) && *id == 0) {
+      struct handoff h;
+      memcpy(&h, c->recv.buf, sizeof(h));
+      accepted(c->mgr, &h.lsn, h.fd, &h.usa, h.len);
+    } else if (c->recv.len == sizeof(*id) && *id == 0) {
+      // mg_chan_post() wakeup. Events are taken by chan_poll()
+    } else if (c->recv.len >= sizeof(*id)) {
       struct mg_connection *t;
       for (t = c->mgr->conns; t != NULL; t = t->next) {
         if (t->id == *id) {
@@ -10150,11 +11830,49 @@ bool mg_wakeup_init(struct mg_mgr *mgr) {
       MG_DEBUG(("%lu %p pipe %lu", c->id, c->fd, (unsigned long) sp[0]));
       mgr->pipe = sp[0];
       ok = true;
+      if (MG_CHAN_SIZE > 0) mg_chan_init(&mgr->chan, MG_CHAN_SIZE);
     }
   }
   return ok;
 }
 
+void mg_mgr_shard(struct mg_mgr *mgr, struct mg_mgr **shards, size_t n) {
+  mgr->shards = shards;
+  mgr->nshards = n;
+  mgr->nextshard = 0;
+}
+
+bool mg_chan_post(struct mg_mgr *mgr, unsigned long id, int ev,
+                  const void *buf, size_t len) {
+  struct mg_chan_msg m;
+  if (len > sizeof(m.data)) return false;
+  m.id = id, m.ev = ev, m.len = len;
+  if (len > 0) memcpy(m.data, buf, len);
+  if (!mg_chan_put(&mgr->chan, &m)) return false;
+  // Only the first post after the loop has taken a batch wakes it up
+  if (MG_CAS(&mgr->chan.armed, 0, 1) && mgr->pipe != MG_INVALID_SOCKET) {
+    unsigned long zero = 0;  // Empty wakeup, see wufn()
+    send(mgr->pipe, (char *) &zero, sizeof(zero), MSG_NONBLOCKING);
+  }
+  return true;
+}
+
+// Deliver events posted by other tasks, at most one queue worth
+static void chan_poll(struct mg_mgr *mgr) {
+  struct mg_chan_msg m;
+  struct mg_connection *c, *tmp;
+  size_t n = mgr->chan.mask + 1;
+  if (mgr->chan.slots == NULL) return;
+  MG_CAS(&mgr->chan.armed, 1, 0);  // Later posts must wake us up again
+  while (n-- > 0 && mg_chan_get(&mgr->chan, &m)) {
+    struct mg_str data = mg_str_n(m.data, m.len);
+    for (c = mgr->conns; c != NULL; c = tmp) {
+      tmp = c->next;
+      if (m.id == 0 || m.id == c->id) mg_call(c, m.ev, &data);
+    }
+  }
+}
+
 bool mg_wakeup(struct mg_mgr *mgr, unsigned long conn_id, const void *buf,
                size_t len) {
   if (mgr->pipe != MG_INVALID_SOCKET && conn_id > 0) {
@@ -10169,15 +11887,41 @@ bool mg_wakeup(struct mg_mgr *mgr, unsigned long conn_id, const void *buf,
 
 void mg_mgr_poll(struct mg_mgr *mgr, int ms) {
   struct mg_connection *c, *tmp;
-  uint64_t now;
-
+  uint64_t now = mg_millis();
+  int wait = mg_timer_wheel_wait(&mgr->wheel, mgr->timers, now);
+  bool is_resp;
+
+  // Do not sleep past the next timer deadline, nor at all if a connection
+  // wants MG_EV_POLL on every iteration
+  if (wait >= 0 && (ms < 0 || wait < ms)) ms = wait;
+#if MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+  ready_flagged(mgr);  // Queues is_polling connections, see mg_iotest()
+#else
+  for (c = mgr->conns; c != NULL && ms != 0; c = c->next) {
+    if (c->is_polling) ms = 0;
+  }
+#endif
   mg_iotest(mgr, ms);
+  chan_poll(mgr);
   now = mg_millis();
-  mg_timer_poll(&mgr->timers, now);
-
+  if (++mgr->nwakeups, now - mgr->wakeups_ms >= 1000) {
+    mgr->wakeups = (unsigned long) (mgr->nwakeups * 1000 /
+                                    (now - mgr->wakeups_ms));
+    mgr->nwakeups = 0, mgr->wakeups_ms = now;
+  }
+  mg_timer_wheel_poll(&mgr->wheel, &mgr->timers, now);
+
+#if MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+  // Visit only connections that have work to do. Connections scheduled while
+  // we iterate are visited on the next iteration
+  tmp = mgr->ready, mgr->ready = NULL;
+  while ((c = tmp) != NULL) {
+    tmp = c->rnext, c->rnext = NULL, c->is_queued = 0;
+#else
   for (c = mgr->conns; c != NULL; c = tmp) {
-    bool is_resp = c->is_resp;
     tmp = c->next;
+#endif
+    is_resp = c->is_resp;
     mg_call(c, MG_EV_POLL, &now);
     if (is_resp && !c->is_resp) {
       long n = 0;
@@ -10197,11 +11941,29 @@ void mg_mgr_poll(struct mg_mgr *mgr, int ms) {
     } else {
       if (c->is_readable) read_conn(c);
       if (c->is_writable) write_conn(c);
-      if (c->is_tls && !c->is_tls_hs && c->send.len == 0) mg_tls_flush(c);
+      if (c->is_tls && !c->is_tls_hs && c->send.len == 0 && c->sendq == NULL) {
+        mg_tls_flush(c);
+      }
     }
 
-    if (c->is_draining && c->send.len == 0) c->is_closing = 1;
-    if (c->is_closing) close_conn(c);
+    if (c->is_draining && c->send.len == 0 && c->sendq == NULL) {
+      c->is_closing = 1;
+    }
+    if (c->is_closing) {
+      close_conn(c);
+#if MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+    } else {
+      // Readiness is consumed. Buffered TLS data must be read without waiting
+      c->is_readable = c->is_writable = 0;
+      if (c->rtls.len > 0 || mg_tls_pending(c) > 0) {
+        c->is_readable = 1;
+        mg_poll_ready(c);
+      } else if (c->is_polling) {
+        ready_add(c);
+      }
+      mg_poll_mod(c);
+#endif
+    }
   }
 }
 #endif
@@ -10224,7 +11986,7 @@ void mg_mgr_poll(struct mg_mgr *mgr, int ms) {
 
 #if MG_ENABLE_SSI
 static char *mg_ssi(const char *path, const char *root, int depth) {
-  struct mg_iobuf b = {NULL, 0, 0, MG_IO_SIZE};
+  struct mg_iobuf b = {NULL, 0, 0, MG_IO_SIZE, 0};
   FILE *fp = fopen(path, "rb");
   if (fp != NULL) {
     char buf[MG_SSI_BUFSIZ], arg[sizeof(buf)];
@@ -10517,16 +12279,30 @@ bool mg_str_to_num(struct mg_str str, int base, void *val, size_t val_len) {
 
 
 
+static void timer_link(struct mg_timer **head, struct mg_timer *t) {
+  t->next = *head, t->pprev = head;
+  if (*head != NULL) (*head)->pprev = &t->next;
+  *head = t;
+}
+
+static void timer_unlink(struct mg_timer *t) {
+  if (t->pprev == NULL) return;  // Not linked anywhere
+  *t->pprev = t->next;
+  if (t->next != NULL) t->next->pprev = t->pprev;
+  t->next = NULL, t->pprev = NULL;
+}
+
 void mg_timer_init(struct mg_timer **head, struct mg_timer *t, uint64_t ms,
                    unsigned flags, void (*fn)(void *), void *arg) {
   t->period_ms = ms, t->expire = 0;
-  t->flags = flags, t->fn = fn, t->arg = arg, t->next = *head;
-  *head = t;
+  t->flags = flags, t->fn = fn, t->arg = arg;
+  timer_link(head, t);
 }
 
+// Timers know their own link, so this works for lists and wheel slots alike
 void mg_timer_free(struct mg_timer **head, struct mg_timer *t) {
-  while (*head && *head != t) head = &(*head)->next;
-  if (*head) *head = t->next;
+  timer_unlink(t);
+  (void) head;
 }
 
 // t: expiration time, prd: period, now: current time. Return true if expired
@@ -10559,6 +12335,174 @@ void mg_timer_poll(struct mg_timer **head, uint64_t now_ms) {
   }
 }
 
+#define MG_TIMER_BITS 6  // log2(MG_TIMER_SLOTS)
+
+static unsigned timer_ctz(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (unsigned) __builtin_ctzll(x);
+#else
+  unsigned n = 0;
+  while ((x & 1) == 0) x >>= 1, n++;
+  return n;
+#endif
+}
+
+// Put timer into a slot of the lowest level where its expiration differs
+// from w->next. Timers due in the past are due on the next tick
+static void timer_insert(struct mg_timer_wheel *w, struct mg_timer *t) {
+  uint64_t when = t->expire < w->next ? w->next : t->expire;
+  uint64_t diff = when ^ w->next;
+  unsigned level = 0, slot;
+  while (diff >= MG_TIMER_SLOTS && level < MG_TIMER_LEVELS) {
+    diff >>= MG_TIMER_BITS, level++;
+  }
+  if (level >= MG_TIMER_LEVELS) {
+    timer_link(&w->far, t);
+  } else {
+    slot = (unsigned) (when >> (level * MG_TIMER_BITS)) % MG_TIMER_SLOTS;
+    timer_link(&w->slots[level][slot], t);
+    w->bits[level] |= (uint64_t) 1 << slot;
+  }
+}
+
+// Earliest expiration in a list, but not earlier than the next tick
+static uint64_t timer_list_min(struct mg_timer_wheel *w, struct mg_timer *t) {
+  uint64_t min = UINT64_MAX;
+  for (; t != NULL; t = t->next) {
+    if (t->expire < min) min = t->expire;
+  }
+  return min < w->next ? w->next : min;
+}
+
+// Earliest tick when some slot fires or cascades, UINT64_MAX if none. With
+// "exact", return the earliest expiration instead of the cascade tick
+static uint64_t timer_next_event(struct mg_timer_wheel *w, bool exact) {
+  uint64_t min = UINT64_MAX;
+  unsigned level;
+  for (level = 0; level < MG_TIMER_LEVELS; level++) {
+    unsigned shift = level * MG_TIMER_BITS, slot;
+    unsigned digit = (unsigned) (w->next >> shift) % MG_TIMER_SLOTS;
+    uint64_t span = (uint64_t) 1 << (shift + MG_TIMER_BITS);
+    uint64_t mask = w->bits[level] & (~(uint64_t) 0 << digit);
+    while (mask != 0) {
+      slot = timer_ctz(mask);
+      if (w->slots[level][slot] != NULL) {
+        uint64_t tick = (w->next & ~(span - 1)) | ((uint64_t) slot << shift);
+        if (exact && level > 0) tick = timer_list_min(w, w->slots[level][slot]);
+        if (tick < min) min = tick;
+        break;
+      }
+      w->bits[level] &= ~((uint64_t) 1 << slot);  // Emptied by mg_timer_free
+      mask &= mask - 1;
+    }
+  }
+  if (w->far != NULL) {
+    unsigned shift = MG_TIMER_LEVELS * MG_TIMER_BITS;
+    uint64_t span = (uint64_t) 1 << shift;
+    uint64_t tick = (w->next + span - 1) & ~(span - 1);
+    if (exact) tick = timer_list_min(w, w->far);
+    if (tick < min) min = tick;
+  }
+  return min;
+}
+
+static void timer_reinsert(struct mg_timer_wheel *w, struct mg_timer **head) {
+  struct mg_timer *t, *list = *head;
+  *head = NULL;
+  if (list != NULL) list->pprev = &list;
+  while ((t = list) != NULL) timer_unlink(t), timer_insert(w, t);
+}
+
+// Call due timers. Re-armed ones go to "again", to not fire twice per poll
+static void timer_fire(struct mg_timer **due, struct mg_timer **again,
+                       uint64_t now) {
+  struct mg_timer *t;
+  while ((t = *due) != NULL) {
+    if ((t->flags & MG_TIMER_REPEAT) || !(t->flags & MG_TIMER_CALLED)) {
+      t->fn(t->arg);
+    }
+    if (t != *due) continue;  // Callback has called mg_timer_free()
+    timer_unlink(t);
+    t->flags |= MG_TIMER_CALLED;
+    if (t->flags & MG_TIMER_REPEAT) {
+      t->expire = (now - t->expire) > t->period_ms ? now + t->period_ms
+                                                    : t->expire + t->period_ms;
+      timer_link(again, t);
+    } else if (t->flags & MG_TIMER_AUTODELETE) {
+      mg_free(t);
+    }
+  }
+}
+
+void mg_timer_wheel_poll(struct mg_timer_wheel *w, struct mg_timer **staged,
+                         uint64_t now) {
+  struct mg_timer *t, *due = NULL, *again = NULL;
+  uint64_t tick;
+  unsigned level;
+
+  if (w->next == 0) w->next = now;  // First poll
+  while ((t = *staged) != NULL) {
+    timer_unlink(t);
+    if ((t->flags & MG_TIMER_RUN_NOW) && !(t->flags & MG_TIMER_CALLED)) {
+      t->expire = now;
+      timer_link(&due, t);
+    } else {
+      if (t->expire == 0) t->expire = now + t->period_ms;  // mg_timer_init()
+      timer_insert(w, t);
+    }
+  }
+  timer_fire(&due, &again, now);
+
+  while ((tick = timer_next_event(w, false)) <= now) {
+    w->next = tick;
+    if ((tick % ((uint64_t) 1 << (MG_TIMER_LEVELS * MG_TIMER_BITS))) == 0) {
+      timer_reinsert(w, &w->far);
+    }
+    for (level = MG_TIMER_LEVELS - 1; level > 0; level--) {
+      unsigned shift = level * MG_TIMER_BITS;
+      if (tick % ((uint64_t) 1 << shift) != 0) continue;
+      timer_reinsert(w, &w->slots[level][(tick >> shift) % MG_TIMER_SLOTS]);
+    }
+    w->next = tick + 1;
+    due = w->slots[0][tick % MG_TIMER_SLOTS];
+    w->slots[0][tick % MG_TIMER_SLOTS] = NULL;
+    if (due != NULL) due->pprev = &due;
+    timer_fire(&due, &again, now);
+  }
+  if (w->next <= now) w->next = now + 1;
+  timer_reinsert(w, &again);
+}
+
+// Milliseconds until the wheel needs a poll, or -1 if no timers are pending.
+// Staged timers are not in the wheel yet, but most know their expiration
+int mg_timer_wheel_wait(struct mg_timer_wheel *w, struct mg_timer *staged,
+                        uint64_t now) {
+  uint64_t tick = timer_next_event(w, true), ms;
+  for (; staged != NULL; staged = staged->next) {
+    bool run_now = (staged->flags & MG_TIMER_RUN_NOW) &&
+                   !(staged->flags & MG_TIMER_CALLED);
+    uint64_t expire = run_now                ? now
+                      : staged->expire != 0 ? staged->expire
+                                            : now + staged->period_ms;
+    if (expire < tick) tick = expire;
+  }
+  if (tick == UINT64_MAX) return -1;
+  ms = tick > now ? tick - now : 0;
+  return ms > INT_MAX ? INT_MAX : (int) ms;
+}
+
+void mg_timer_wheel_free(struct mg_timer_wheel *w) {
+  struct mg_timer *t;
+  size_t i, j;
+  for (i = 0; i < MG_TIMER_LEVELS; i++) {
+    for (j = 0; j < MG_TIMER_SLOTS; j++) {
+      while ((t = w->slots[i][j]) != NULL) timer_unlink(t), mg_free(t);
+    }
+  }
+  while ((t = w->far) != NULL) timer_unlink(t), mg_free(t);
+  memset(w, 0, sizeof(*w));
+}
+
 #ifdef MG_ENABLE_LINES
 #line 1 "src/tls_aes128.c"
 #endif
@@ -13391,7 +15335,9 @@ void mg_tls_init(struct mg_connection *c, const struct mg_tls_opts *opts) {
       c->is_client ? MG_TLS_STATE_CLIENT_START : MG_TLS_STATE_SERVER_START;
 
   tls->skip_verification = opts->skip_verification;
-  // tls->send.align = MG_IO_SIZE;
+#if MG_ENABLE_IOBUF_RING
+  tls->send.align = MG_IO_SIZE;  // Consume sent records without memmove
+#endif
 
   c->tls = tls;
   c->is_tls = c->is_tls_hs = 1;
@@ -13532,6 +15478,9 @@ void mg_tls_flush(struct mg_connection *c) {
 }
 
 void mg_tls_ctx_init(struct mg_mgr *mgr) {
+#if MG_ENABLE_SLAB
+  mg_slab_add(sizeof(struct tls_data), sizeof(struct tls_data), MG_SLAB_TLS);
+#endif
   (void) mgr;
 }
 
@@ -20882,10 +22831,19 @@ void mg_delayms(unsigned int ms) {
 #if MG_ENABLE_CUSTOM_CALLOC
 #else
 void *mg_calloc(size_t count, size_t size) {
+#if MG_ENABLE_SLAB
+  void *p = size == 0 || count <= (size_t) -1 / size
+                ? mg_slab_alloc(count * size)
+                : NULL;
+  if (p != NULL) return p;
+#endif
   return calloc(count, size);
 }
 
 void mg_free(void *ptr) {
+#if MG_ENABLE_SLAB
+  if (mg_slab_free(ptr)) return;
+#endif
   free(ptr);
 }
 #endif
@@ -21224,7 +23182,8 @@ size_t mg_ws_wrap(struct mg_connection *c, size_t len, int op) {
     memcpy(p - header_len, header, header_len);  // Prepend header
     mg_ws_mask(c, len);                          // Mask data
   }  // returning 0 means an OOM condition (iobuf couldn't resize), yet this is
-  return c->send.len;  // so far recoverable, let the caller decide
+  MG_POLL_MOD(c);      // so far recoverable, let the caller decide
+  return c->send.len;
 }
 
 #ifdef MG_ENABLE_LINES
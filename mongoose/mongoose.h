@@ -228,6 +228,7 @@ extern "C" {
 
 #include <esp_ota_ops.h>  // Use angle brackets to avoid
 #include <esp_timer.h>    // amalgamation ditching them
+#include <freertos/FreeRTOS.h>
 
 #define MG_PATH_MAX 128
 
@@ -1000,6 +1001,70 @@ struct timeval {
 #define MG_SOCK_LISTEN_BACKLOG_SIZE 128
 #endif
 
+#ifndef MG_ENABLE_IOBUF_POOL
+#define MG_ENABLE_IOBUF_POOL 0  // Power-of-two iobufs, recycled via a pool
+#endif
+
+#ifndef MG_IOBUF_POOL_MAX
+#define MG_IOBUF_POOL_MAX 32768  // Largest pooled buffer, bigger use the heap
+#endif
+
+#ifndef MG_IOBUF_POOL_BYTES
+#define MG_IOBUF_POOL_BYTES 32768  // Max bytes kept in the pool
+#endif
+
+#ifndef MG_IOBUF_IDLE_MS
+#define MG_IOBUF_IDLE_MS 3000  // Release empty buffers after this quiet time
+#endif
+
+#ifndef MG_ENABLE_IOBUF_RING
+#define MG_ENABLE_IOBUF_RING 0  // Consume conn iobufs from front w/o memmove
+#endif
+
+#ifndef MG_ENABLE_SENDQ
+#define MG_ENABLE_SENDQ 0  // Send borrowed and shared data without copying
+#endif
+
+#ifndef MG_SENDQ_IOV
+#define MG_SENDQ_IOV 8  // Max segments gathered into one send call
+#endif
+
+#ifndef MG_CHAN_SIZE
+#define MG_CHAN_SIZE 0  // Slots in mgr->chan, power of 2. 0 disables it
+#endif
+
+#ifndef MG_CHAN_DATA_SIZE
+#define MG_CHAN_DATA_SIZE 32  // Max data size of an mg_chan_post() event
+#endif
+
+#ifndef MG_ENABLE_JSON_SIMD
+#define MG_ENABLE_JSON_SIMD 1  // Scan JSON strings, whitespace with SSE2/NEON
+#endif
+
+#ifndef MG_ENABLE_SLAB
+#define MG_ENABLE_SLAB 0  // Serve fixed-size objects from preallocated pools
+#endif
+
+#ifndef MG_SLAB_CONNS
+#define MG_SLAB_CONNS 16  // Pooled struct mg_connection objects
+#endif
+
+#ifndef MG_SLAB_TLS
+#define MG_SLAB_TLS 4  // Pooled builtin TLS contexts
+#endif
+
+#ifndef MG_SLAB_SMALL
+#define MG_SLAB_SMALL 64  // Pooled small objects: strings, timers, RPC entries
+#endif
+
+#ifndef MG_SLAB_SMALL_SIZE
+#define MG_SLAB_SMALL_SIZE 64
+#endif
+
+#ifndef MG_SLAB_CLASSES
+#define MG_SLAB_CLASSES 8  // Max number of pools
+#endif
+
 #ifndef MG_DIRSEP
 #define MG_DIRSEP '/'
 #endif
@@ -1037,6 +1102,27 @@ struct timeval {
 #define MG_EPOLL_MOD(c, wr)
 #endif
 
+// With MG_ENABLE_POLL, struct mg_mgr keeps a persistent pollfd array. Each
+// socket owns one slot, and its event mask is refreshed only when the
+// connection's read/write interest may have changed. mg_mgr_poll() visits
+// only connections on the ready list: those reported by poll(), those with
+// buffered TLS data or scheduled by MG_POLL_READY(), and those with is_polling,
+// is_closing, or is_draining with nothing left to send. These flags can be set
+// from anywhere, e.g. from a timer: the next mg_mgr_poll() picks them up.
+// Connections without is_polling get MG_EV_POLL only on iterations that
+// visit them, i.e. when they have I/O, not on every iteration
+#if MG_ENABLE_SOCKET && MG_ENABLE_POLL && !MG_ENABLE_EPOLL
+#define MG_POLL_ADD(c) mg_poll_add(c)
+#define MG_POLL_DEL(c) mg_poll_del(c)
+#define MG_POLL_MOD(c) mg_poll_mod(c)
+#define MG_POLL_READY(c) mg_poll_ready(c)
+#else
+#define MG_POLL_ADD(c)
+#define MG_POLL_DEL(c)
+#define MG_POLL_MOD(c)
+#define MG_POLL_READY(c)
+#endif
+
 #ifndef MG_ENABLE_PROFILE
 #define MG_ENABLE_PROFILE 0
 #endif
@@ -1212,6 +1298,78 @@ void mg_queue_add(struct mg_queue *, size_t);                 // Add new message
 size_t mg_queue_next(struct mg_queue *, char **);  // Get oldest message
 void mg_queue_del(struct mg_queue *, size_t);      // Delete oldest message
 
+// Bounded multiple producer, single consumer lock-free queue of fixed-size
+// messages. Any task can put, one task gets
+
+struct mg_chan_msg {
+  unsigned long id;              // Connection ID to deliver to, or 0 for all
+  int ev;                        // Event type, e.g. MG_EV_USER + N
+  size_t len;                    // Length of data
+  char data[MG_CHAN_DATA_SIZE];  // Event data
+};
+
+struct mg_chan_slot;
+struct mg_chan {
+  struct mg_chan_slot *slots;  // Messages, each with a sequence number
+  size_t mask;                 // Number of slots minus 1
+  volatile size_t head;        // Next slot to put to, shared by producers
+  volatile size_t tail;        // Next slot to get from
+  volatile size_t armed;       // Consumer wakeup is pending
+};
+
+bool mg_chan_init(struct mg_chan *, size_t size);  // Size is a power of 2
+void mg_chan_free(struct mg_chan *);
+bool mg_chan_put(struct mg_chan *, const struct mg_chan_msg *);  // Any task
+bool mg_chan_get(struct mg_chan *, struct mg_chan_msg *);  // Consumer only
+
+
+
+
+// Spinlock for state shared by managers that run in different threads
+#if MG_ARCH == MG_ARCH_ESP32
+typedef portMUX_TYPE mg_spinlock_t;
+#define MG_SPINLOCK_INIT portMUX_INITIALIZER_UNLOCKED
+#define MG_SPIN_LOCK(l) portENTER_CRITICAL(l)
+#define MG_SPIN_UNLOCK(l) portEXIT_CRITICAL(l)
+#elif defined(__GNUC__) || defined(__clang__)
+typedef char mg_spinlock_t;
+#define MG_SPINLOCK_INIT 0
+#define MG_SPIN_LOCK(l) \
+  while (__atomic_test_and_set((l), __ATOMIC_ACQUIRE)) (void) 0
+#define MG_SPIN_UNLOCK(l) __atomic_clear((l), __ATOMIC_RELEASE)
+#else
+typedef char mg_spinlock_t;
+#define MG_SPINLOCK_INIT 0
+#define MG_SPIN_LOCK(l) (void) (l)
+#define MG_SPIN_UNLOCK(l) (void) (l)
+#endif
+
+// Atomic compare-and-swap with a full barrier, evaluates to true on success
+#if defined(__GNUC__) || defined(__clang__)
+#define MG_CAS(p, a, b) __sync_bool_compare_and_swap((p), (a), (b))
+#else
+#define MG_CAS(p, a, b) (*(p) == (a) ? (*(p) = (b), true) : false)
+#endif
+
+
+
+
+// Fixed-size object pools, used by mg_calloc() when MG_ENABLE_SLAB is set.
+// A pool preallocates "count" objects of "size" bytes, and serves requests
+// of min_size to size bytes. When a pool is exhausted, the heap is used
+struct mg_slab_stats {
+  size_t size;   // Object size
+  size_t count;  // Number of objects
+  size_t used;   // Objects in use
+  size_t peak;   // High watermark of used objects
+  size_t fails;  // Requests that found the pool exhausted
+};
+
+bool mg_slab_add(size_t min_size, size_t size, size_t count);
+size_t mg_slab_stats(struct mg_slab_stats *, size_t max);  // Return # of pools
+void *mg_slab_alloc(size_t size);  // Return NULL if no pool can serve size
+bool mg_slab_free(void *ptr);      // Return false if ptr is not pooled
+
 
 
 
@@ -1247,6 +1405,10 @@ size_t mg_print_mac(void (*out)(char, void *), void *arg, va_list *ap);
 void mg_pfn_iobuf(char ch, void *param);  // param: struct mg_iobuf *
 void mg_pfn_stdout(char c, void *param);  // param: ignored
 
+// Output a span through fn: appended at once for the functions above, one
+// char at a time for any other
+size_t mg_pfn_write(mg_pfn_t fn, void *param, const char *buf, size_t len);
+
 // A helper macro for printing JSON: mg_snprintf(buf, len, "%m", MG_ESC("hi"))
 #define MG_ESC(str) mg_print_esc, 0, (str)
 
@@ -1301,6 +1463,18 @@ struct mg_timer {
   void (*fn)(void *);          // Function to call
   void *arg;                   // Function argument
   struct mg_timer *next;       // Linkage
+  struct mg_timer **pprev;     // Link that points to us, for O(1) removal
+};
+
+// Hierarchical timing wheel. Level L slot S holds timers that expire when
+// tick bits [6L, 6L+6) reach S. Timers beyond the last level sit in "far"
+#define MG_TIMER_LEVELS 4
+#define MG_TIMER_SLOTS 64
+struct mg_timer_wheel {
+  uint64_t next;                    // Next tick to process, milliseconds
+  uint64_t bits[MG_TIMER_LEVELS];   // Non-empty slots, cleared lazily
+  struct mg_timer *slots[MG_TIMER_LEVELS][MG_TIMER_SLOTS];  // Timer lists
+  struct mg_timer *far;             // Timers too far in the future
 };
 
 void mg_timer_init(struct mg_timer **head, struct mg_timer *timer,
@@ -1309,6 +1483,11 @@ void mg_timer_init(struct mg_timer **head, struct mg_timer *timer,
 void mg_timer_free(struct mg_timer **head, struct mg_timer *);
 void mg_timer_poll(struct mg_timer **head, uint64_t new_ms);
 bool mg_timer_expired(uint64_t *expiration, uint64_t period, uint64_t now);
+void mg_timer_wheel_poll(struct mg_timer_wheel *, struct mg_timer **staged,
+                         uint64_t now);
+void mg_timer_wheel_free(struct mg_timer_wheel *);
+int mg_timer_wheel_wait(struct mg_timer_wheel *, struct mg_timer *staged,
+                        uint64_t now);
 
 
 
@@ -1358,6 +1537,9 @@ bool mg_file_printf(struct mg_fs *fs, const char *path, const char *fmt, ...);
 // Packed API
 const char *mg_unpack(const char *path, size_t *size, time_t *mtime);
 const char *mg_unlist(size_t no);             // Get no'th packed filename
+int mg_unpack_dir(const char *path);          // Is path a packed directory
+const char *mg_unpack_http(const char *path, size_t *size, const char **etag,
+                           const char **headers);  // With 200 response header
 struct mg_str mg_unpacked(const char *path);  // Packed file as mg_str
 
 
@@ -1537,6 +1719,7 @@ struct mg_iobuf {
   size_t size;         // Total size available
   size_t len;          // Current number of bytes
   size_t align;        // Alignment during allocation
+  size_t head;         // Consumed bytes before buf, see MG_ENABLE_IOBUF_RING
 };
 
 bool mg_iobuf_init(struct mg_iobuf *, size_t, size_t);
@@ -1544,6 +1727,7 @@ bool mg_iobuf_resize(struct mg_iobuf *, size_t);
 void mg_iobuf_free(struct mg_iobuf *);
 size_t mg_iobuf_add(struct mg_iobuf *, size_t, const void *, size_t);
 size_t mg_iobuf_del(struct mg_iobuf *, size_t ofs, size_t len);
+void mg_iobuf_compact(struct mg_iobuf *);  // Move data to allocation start
 
 
 size_t mg_base64_update(unsigned char input_byte, char *buf, size_t len);
@@ -1669,6 +1853,25 @@ struct mg_addr {
   bool is_ip6;       // True when address is IPv6 address
 };
 
+// Connection deadlines in milliseconds, 0 disables a class. Set a listener's
+// c->deadlines after mg_http_listen(), accepted connections inherit it
+struct mg_deadlines {
+  unsigned handshake_ms;  // TLS handshake, counted from accept
+  unsigned header_ms;     // Request headers, counted from the first byte
+  unsigned body_ms;       // Max gap between reads of a request body
+  unsigned idle_ms;       // Keep-alive connection without a request
+  unsigned write_ms;      // Max time without write progress
+};
+
+enum {
+  MG_DL_HANDSHAKE,
+  MG_DL_HEADER,
+  MG_DL_BODY,
+  MG_DL_IDLE,
+  MG_DL_WRITE,
+  MG_DL_CLASSES
+};
+
 struct mg_mgr {
   struct mg_connection *conns;  // List of active connections
   struct mg_dns dns4;           // DNS for IPv4
@@ -1680,16 +1883,52 @@ struct mg_mgr {
   void *tls_ctx;                // TLS context shared by all TLS sessions
   uint16_t mqtt_id;             // MQTT IDs for pub/sub
   void *active_dns_requests;    // DNS requests in progress
-  struct mg_timer *timers;      // Active timers
+  struct mg_timer *timers;      // Timers added since last poll
+  struct mg_timer_wheel wheel;  // Scheduled timers
   int epoll_fd;                 // Used when MG_EPOLL_ENABLE=1
   struct mg_tcpip_if *ifp;      // Builtin TCP/IP stack only. Interface pointer
   size_t extraconnsize;         // Builtin TCP/IP stack only. Extra space
   MG_SOCKET_TYPE pipe;          // Socketpair end for mg_wakeup()
+  struct mg_chan chan;          // Events from other tasks, see mg_chan_post()
+  struct mg_mgr **shards;       // Managers that serve accepted connections
+  size_t nshards;               // Number of shards, see mg_mgr_shard()
+  size_t nextshard;             // Next shard to receive a connection
+  unsigned long wakeups;        // Loop wakeups per second, last full second
+  unsigned long timeouts[MG_DL_CLASSES];  // Deadline closes, per class
+  bool io_sweep;                // Idle iobuf release is scheduled
+  unsigned long nwakeups;       // Wakeups counted since wakeups_ms
+  uint64_t wakeups_ms;          // Start of the current counting window
+#if MG_ENABLE_POLL
+  struct pollfd *fds;              // Persistent poll set, one slot per socket
+  struct mg_connection **fdconns;  // Owner of each poll set slot
+  size_t nfds;                     // Number of used poll set slots
+  size_t fdsize;                   // Number of allocated poll set slots
+  bool fdbusy;                     // Some connection must not wait in poll()
+  struct mg_connection *ready;     // Connections to visit on next iteration
+#endif
 #if MG_ENABLE_FREERTOS_TCP
   SocketSet_t ss;  // NOTE(lsm): referenced from socket struct
 #endif
 };
 
+// Reference counted buffer that can be queued on many connections at once
+struct mg_shbuf {
+  unsigned char *buf;  // Data, allocated together with this structure
+  size_t len;          // Data length
+  size_t refs;         // Reference count, see mg_shbuf_unref()
+};
+
+// Outgoing data that goes before c->send, see MG_ENABLE_SENDQ. Data is
+// either borrowed, or owned via base or sb and released when sent
+struct mg_sendseg {
+  struct mg_sendseg *next;   // Next segment to send
+  const unsigned char *buf;  // Data left to send
+  size_t len;                // Number of bytes left to send
+  unsigned char *base;       // Owned iobuf storage, or NULL
+  size_t size;               // Owned iobuf storage size
+  struct mg_shbuf *sb;       // Owned shared buffer reference, or NULL
+};
+
 struct mg_connection {
   struct mg_connection *next;     // Linkage in struct mg_mgr :: connections
   struct mg_mgr *mgr;             // Our container
@@ -1699,6 +1938,7 @@ struct mg_connection {
   unsigned long id;               // Auto-incrementing unique connection ID
   struct mg_iobuf recv;           // Incoming data
   struct mg_iobuf send;           // Outgoing data
+  struct mg_sendseg *sendq;       // Outgoing data to send before c->send
   struct mg_iobuf prof;           // Profile data enabled by MG_ENABLE_PROFILE
   struct mg_iobuf rtls;           // TLS only. Incoming encrypted data
   mg_event_handler_t fn;          // User-specified event handler function
@@ -1726,9 +1966,22 @@ struct mg_connection {
   unsigned is_resp : 1;           // Response is still being generated
   unsigned is_readable : 1;       // Connection is ready to read
   unsigned is_writable : 1;       // Connection is ready to write
+  unsigned is_polling : 1;        // Wants MG_EV_POLL on every iteration,
+                                  // mg_mgr_poll() does not sleep. Others
+                                  // get it only with I/O
+  unsigned dl_class : 3;          // Deadline class seen by the last check
+  uint64_t io_ms;                 // Last I/O time
+  uint64_t req_ms;                // Accept, or current request start time
+  const struct mg_deadlines *deadlines;  // Timeouts, or NULL for none
+  struct mg_timer dl_timer;              // Next deadline check
+#if MG_ENABLE_POLL
+  unsigned is_queued : 1;         // Linked into mgr->ready
+  size_t fdslot;                  // Index in mgr->fds plus 1, 0 if none
+  struct mg_connection *rnext;    // Linkage in struct mg_mgr :: ready
+#endif
 };
 
-void mg_mgr_poll(struct mg_mgr *, int ms);
+void mg_mgr_poll(struct mg_mgr *, int ms);  // ms < 0: sleep until needed
 void mg_mgr_init(struct mg_mgr *);
 void mg_mgr_free(struct mg_mgr *);
 
@@ -1740,6 +1993,10 @@ struct mg_connection *mg_wrapfd(struct mg_mgr *mgr, int fd,
                                 mg_event_handler_t fn, void *fn_data);
 void mg_connect_resolved(struct mg_connection *);
 bool mg_send(struct mg_connection *, const void *, size_t);
+bool mg_send_ref(struct mg_connection *, const void *buf, size_t len);
+bool mg_send_shared(struct mg_connection *, struct mg_shbuf *);
+struct mg_shbuf *mg_shbuf_new(const void *buf, size_t len);  // refs is 1
+void mg_shbuf_unref(struct mg_shbuf *);
 size_t mg_printf(struct mg_connection *, const char *fmt, ...);
 size_t mg_vprintf(struct mg_connection *, const char *fmt, va_list *ap);
 bool mg_aton(struct mg_str str, struct mg_addr *addr);
@@ -1747,11 +2004,25 @@ bool mg_aton(struct mg_str str, struct mg_addr *addr);
 // These functions are used to integrate with custom network stacks
 struct mg_connection *mg_alloc_conn(struct mg_mgr *);
 void mg_close_conn(struct mg_connection *c);
+void mg_sendq_del(struct mg_connection *c, size_t len);  // Consume sent data
 bool mg_open_listener(struct mg_connection *c, const char *url);
+void mg_poll_add(struct mg_connection *c);    // MG_ENABLE_POLL only. Take a
+void mg_poll_del(struct mg_connection *c);    // poll set slot, release it,
+void mg_poll_mod(struct mg_connection *c);    // refresh its event mask, or
+void mg_poll_ready(struct mg_connection *c);  // visit c on next iteration
 
 // Utility functions
 bool mg_wakeup(struct mg_mgr *, unsigned long id, const void *buf, size_t len);
+// Spread connections accepted by listeners of a manager over shards, in a
+// round-robin. Each shard runs mg_mgr_poll() in its own thread, and must have
+// called mg_wakeup_init(). A shard may be the accepting manager itself
+void mg_mgr_shard(struct mg_mgr *, struct mg_mgr **shards, size_t n);
 bool mg_wakeup_init(struct mg_mgr *);
+// Deliver event ev to connection id, or to all connections if id is 0. Can be
+// called from any task. The loop takes posted events in a batch, and is woken
+// up once per batch. Needs MG_CHAN_SIZE > 0 and mg_wakeup_init()
+bool mg_chan_post(struct mg_mgr *, unsigned long id, int ev, const void *buf,
+                  size_t len);
 struct mg_timer *mg_timer_add(struct mg_mgr *mgr, uint64_t milliseconds,
                               unsigned flags, void (*fn)(void *), void *arg);
 struct mg_connection *mg_connect_svc(struct mg_mgr *mgr, const char *url,
@@ -2979,9 +3250,88 @@ char *mg_json_get_hex(struct mg_str json, const char *path, int *len);
 char *mg_json_get_b64(struct mg_str json, const char *path, int *len);
 
 bool mg_json_unescape(struct mg_str str, char *buf, size_t len);
+
+// Allocation-free string lookup. Return a view of the value if it has no
+// escapes, else unescape it into the free space of arena (may be NULL) and
+// return that, NUL-terminated. buf is NULL if not found or does not fit
+struct mg_str mg_json_get_str_view(struct mg_str json, const char *path,
+                                   struct mg_iobuf *arena);
 size_t mg_json_next(struct mg_str obj, size_t ofs, struct mg_str *key,
                     struct mg_str *val);
 
+#ifndef MG_JSON_TAPE_SIZE
+#define MG_JSON_TAPE_SIZE 32  // Tokens in a tape built on stack
+#endif
+
+// Token tape: a document tokenized once, for many path lookups that do not
+// touch the text again. Object children go key, value, key, value...
+enum {
+  MG_JSON_OBJECT = 1,
+  MG_JSON_ARRAY,
+  MG_JSON_STRING,
+  MG_JSON_NUMBER,
+  MG_JSON_TRUE,
+  MG_JSON_FALSE,
+  MG_JSON_NULL
+};
+enum { MG_JSON_TOO_BIG = -4 };  // Text or tokens do not fit the tape
+
+struct mg_json_tok {
+  uint16_t ofs, len;  // Token text in the document, quotes included
+  uint16_t parent;    // Enclosing object or array. 0 for the root
+  uint16_t next;      // Next sibling, 0 if none
+  uint8_t type;       // MG_JSON_OBJECT, ...
+};
+
+struct mg_json_tape {
+  struct mg_str json;        // Document
+  struct mg_json_tok *toks;  // Tokens, caller-provided storage
+  int n;                     // Number of tokens
+  int root;                  // Token that "$" refers to. Default 0
+};
+
+int mg_json_tape_init(struct mg_json_tape *, struct mg_str json,
+                      struct mg_json_tok *toks, size_t max_toks);
+int mg_json_tape_init_alloc(struct mg_json_tape *, struct mg_str json,
+                            struct mg_json_tok *toks, size_t max_toks);
+void mg_json_tape_free(struct mg_json_tape *, struct mg_json_tok *toks);
+int mg_json_tape_find(const struct mg_json_tape *, const char *path);
+int mg_json_tape_child(const struct mg_json_tape *, int tok);
+struct mg_str mg_json_tape_get_tok(const struct mg_json_tape *, const char *);
+bool mg_json_tape_get_num(const struct mg_json_tape *, const char *, double *);
+bool mg_json_tape_get_bool(const struct mg_json_tape *, const char *, bool *);
+long mg_json_tape_get_long(const struct mg_json_tape *, const char *, long);
+char *mg_json_tape_get_str(const struct mg_json_tape *, const char *path);
+struct mg_str mg_json_tape_get_str_view(const struct mg_json_tape *,
+                                        const char *path, struct mg_iobuf *);
+
+// Binding of JSON objects to C structs, by a table of fields
+enum {
+  MG_JSON_FIELD_INT = 1,  // Signed integer of 1, 2, 4 or 8 bytes
+  MG_JSON_FIELD_UINT,     // Unsigned integer of 1, 2, 4 or 8 bytes
+  MG_JSON_FIELD_BOOL,     // bool
+  MG_JSON_FIELD_DOUBLE,   // double or float
+  MG_JSON_FIELD_STR,      // char array, stored unescaped with a trailing \0
+  MG_JSON_FIELD_BITS      // Array of bit numbers, stored as an unsigned mask
+};
+
+struct mg_json_field {
+  const char *name;    // Object key
+  uint8_t type;        // MG_JSON_FIELD_*
+  bool required;       // Decoding fails if the key is missing
+  uint16_t ofs, size;  // Struct member offset and size
+  double min, max;     // Range of numbers, bit numbers or string lengths.
+                       // Not checked if min == max
+};
+
+#define MG_JSON_FIELD(name, type, st, member, required, min, max) \
+  {(name), (type), (required), (uint16_t) offsetof(st, member),   \
+   (uint16_t) sizeof(((st *) 0)->member), (min), (max)}
+
+int mg_json_decode(const struct mg_json_tape *, const struct mg_json_field *,
+                   size_t num_fields, void *obj);
+size_t mg_print_fields(void (*out)(char, void *), void *arg, va_list *ap);
+
 
 
 
@@ -2993,14 +3343,18 @@ struct mg_rpc_req {
   void *pfn_data;        // Response printing function data
   void *req_data;        // Arbitrary request data
   struct mg_str frame;   // Request, e.g. {"id":1,"method":"add","params":[1,2]}
+  const struct mg_json_tape *tape;  // Tokenized frame, or NULL if too big
 };
 
-// JSON-RPC method handler
+// JSON-RPC method handler. Handlers with exact method names are found by
+// hash, before those with patterns
+struct mg_rpc_tab;
 struct mg_rpc {
   struct mg_rpc *next;              // Next in list
   struct mg_str method;             // Method pattern
   void (*fn)(struct mg_rpc_req *);  // Handler function
   void *fn_data;                    // Handler function argument
+  struct mg_rpc_tab *tab;           // Method index, kept by the list head
 };
 
 void mg_rpc_add(struct mg_rpc **head, struct mg_str method_pattern,
@@ -3014,6 +3368,10 @@ void mg_rpc_vok(struct mg_rpc_req *, const char *fmt, va_list *ap);
 void mg_rpc_err(struct mg_rpc_req *, int code, const char *fmt, ...);
 void mg_rpc_verr(struct mg_rpc_req *, int code, const char *fmt, va_list *);
 void mg_rpc_list(struct mg_rpc_req *r);
+// Answer later: keep the request id in buf, as a frame {"id":...}. An
+// mg_rpc_req with that frame can then answer by mg_rpc_ok() or mg_rpc_err(),
+// e.g. when a long operation completes. False if there is no id, or no room
+bool mg_rpc_defer(struct mg_rpc_req *, char *buf, size_t len);
 // Copyright (c) 2023 Cesanta Software Limited
 // All rights reserved
 
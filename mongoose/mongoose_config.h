@@ -4,4 +4,11 @@
 #define MG_OTA MG_OTA_ESP32
 #define MG_ENABLE_PACKED_FS 1
 #define MG_ENABLE_POLL 1
-#define MG_IO_SIZE 2048
\ No newline at end of file
+#define MG_IO_SIZE 2048
+#define MG_ENABLE_SLAB 1
+#define MG_ENABLE_IOBUF_POOL 1
+#define MG_IOBUF_POOL_BYTES 16384
+#define MG_ENABLE_IOBUF_RING 1
+#define MG_ENABLE_SENDQ 1
+#define MG_CHAN_SIZE 16
+#define MG_DATA_SIZE 64
@@ -4,4 +4,4 @@
 ../tailwindcss/node_modules/.bin/tailwindcss -i ./web_root/input.css -o ./web_root/tailwind.css -c tailwind.config.js -m
 
 # pack front-end source
-node tool/pack.js web_root/bundle.js::gzip web_root/components.js::gzip web_root/history.min.js::gzip web_root/index.html::gzip web_root/main.js::gzip web_root/tailwind.css::gzip certs/* > main/pack_fs.c
+node tool/pack.js web_root/bundle.js::br,gzip,identity,immutable web_root/components.js::br,gzip,identity,immutable web_root/history.min.js::br,gzip,identity,immutable web_root/index.html::br,gzip,identity web_root/main.js::br,gzip,identity,immutable web_root/tailwind.css::br,gzip,identity,immutable certs/* > main/pack_fs.c
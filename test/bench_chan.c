@@ -0,0 +1,105 @@
+// Events from other threads into a loop that waits in mg_mgr_poll(mgr, -1):
+// mg_wakeup(), one socketpair send per event, vs mg_chan_post(), one send per
+// batch. Producers either flood, or post one event every 500 us
+#include <pthread.h>
+#include <sched.h>
+#include "mongoose.h"
+
+#define MAX_PRODUCERS 4
+
+static struct mg_mgr s_mgr;
+static unsigned long s_id;      // Receiving connection
+static bool s_chan;             // Use mg_chan_post()
+static int s_count, s_pace_us;  // Events per producer, pause between them
+static volatile int s_running;  // Producers not finished yet
+static long s_got, s_seen;
+static double s_lat, s_last;  // Sum of post-to-handler latencies, last event
+static double s_busy[MAX_PRODUCERS];  // Time spent in posting, per producer
+static bool s_stop;
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_WAKEUP || ev == MG_EV_USER) {
+    struct mg_str *data = (struct mg_str *) ev_data;
+    double t;
+    memcpy(&t, data->buf, sizeof(t));
+    s_last = now_s(), s_lat += s_last - t, s_got++;
+  }
+  (void) c;
+}
+
+static void *producer(void *arg) {
+  double *busy = (double *) arg, t;
+  int i;
+  for (i = 0; i < s_count; i++) {
+    if (s_pace_us > 0) usleep((useconds_t) s_pace_us);
+    t = now_s();
+    if (s_chan) {
+      while (!mg_chan_post(&s_mgr, s_id, MG_EV_USER, &t, sizeof(t))) {
+        sched_yield();  // Full, the loop is behind
+      }
+    } else {
+      mg_wakeup(&s_mgr, s_id, &t, sizeof(t));  // Dropped if the pipe is full
+    }
+    *busy += now_s() - t;
+  }
+  __sync_fetch_and_sub(&s_running, 1);
+  return NULL;
+}
+
+// Stop once producers are done and nothing came in since the last check
+static void check(void *arg) {
+  if (s_running == 0 && s_got == s_seen) s_stop = true;
+  s_seen = s_got;
+  (void) arg;
+}
+
+static void run(bool chan, int producers, int count, int pace_us) {
+  pthread_t tids[MAX_PRODUCERS];
+  unsigned long iters = 0;
+  double t0, busy = 0, lost;
+  long total = (long) producers * count;
+  int i;
+
+  mg_mgr_init(&s_mgr);
+  mg_wakeup_init(&s_mgr);
+  s_id = mg_listen(&s_mgr, "udp://127.0.0.1:0", fn, NULL)->id;
+  mg_timer_add(&s_mgr, 100, MG_TIMER_REPEAT, check, NULL);
+  s_chan = chan, s_count = count, s_pace_us = pace_us, s_running = producers;
+  s_got = s_seen = 0, s_lat = 0, s_stop = false;
+  t0 = s_last = now_s();
+  for (i = 0; i < producers; i++) {
+    s_busy[i] = 0;
+    pthread_create(&tids[i], NULL, producer, &s_busy[i]);
+  }
+  while (!s_stop) mg_mgr_poll(&s_mgr, -1), iters++;
+  for (i = 0; i < producers; i++) {
+    pthread_join(tids[i], NULL), busy += s_busy[i];
+  }
+  lost = (double) (total - s_got) / (double) total;
+
+  printf("%-6s %d x %-6d %s: %7.0f ev/s, %4.1f%% lost, %6.2f us/post, "
+         "%8.1f us to handler, %lu iterations\n",
+         chan ? "chan" : "wakeup", producers, count,
+         pace_us > 0 ? "paced" : "flood",
+         (double) s_got / (s_last - t0), lost * 100,
+         busy / (double) total * 1e6,
+         s_got ? s_lat / (double) s_got * 1e6 : 0, iters);
+  mg_mgr_free(&s_mgr);
+}
+
+int main(void) {
+  int chan;
+  mg_log_set(MG_LL_NONE);
+  for (chan = 0; chan < 2; chan++) {
+    run(chan, 1, 100000, 0);
+    run(chan, 4, 25000, 0);
+    run(chan, 1, 2000, 500);
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+// Heap held by connection buffers under mixed traffic. 60 keep-alive clients
+// send one 8-30 KB POST each, then 10 of them keep chatting for 8 seconds and
+// 50 go idle. Heap blocks are counted by wrappers of calloc() and free(), see
+// the Makefile. Figures are relative to the heap after mg_http_listen()
+#include <malloc.h>
+#include <pthread.h>
+#include "mongoose.h"
+
+#define NCLIENTS 60
+#define NCHATTY 10
+
+static size_t s_live, s_peak;  // Heap bytes
+static volatile int s_done;
+static uint16_t s_port;
+static int s_fds[NCLIENTS];
+
+void *__real_calloc(size_t count, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_calloc(size_t count, size_t size) {
+  void *ptr = __real_calloc(count, size);
+  if (ptr != NULL) s_live += malloc_usable_size(ptr);
+  if (s_live > s_peak) s_peak = s_live;
+  return ptr;
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr != NULL) s_live -= malloc_usable_size(ptr);
+  __real_free(ptr);
+}
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_message *hm = (struct mg_http_message *) ev_data;
+    mg_http_reply(c, 200, "", "%lu\n", (unsigned long) hm->body.len);
+  }
+}
+
+// Blocking request, wait for the whole response
+static void req(int fd, const char *method, size_t len) {
+  char buf[4096], *body = (char *) calloc(1, len + 1), *p;
+  size_t n = 0, cl;
+  int hdr = snprintf(buf, sizeof(buf),
+                     "%s /x HTTP/1.1\r\nHost: x\r\nContent-Length: %lu\r\n\r\n",
+                     method, (unsigned long) len);
+  memset(body, 'x', len);
+  if (send(fd, buf, (size_t) hdr, 0) != hdr ||
+      send(fd, body, len, 0) != (ssize_t) len) {
+    exit(1);
+  }
+  for (;;) {
+    ssize_t r = recv(fd, buf + n, sizeof(buf) - 1 - n, 0);
+    if (r <= 0) exit(1);
+    n += (size_t) r, buf[n] = '\0';
+    if ((p = strstr(buf, "\r\n\r\n")) == NULL) continue;
+    cl = strtoul(strstr(buf, "Content-Length:") + 15, NULL, 10);
+    if (n >= (size_t) (p + 4 - buf) + cl) break;
+  }
+  free(body);
+}
+
+static void *clients(void *arg) {
+  struct sockaddr_in sin;
+  int i, r, *fds = s_fds;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = s_port;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  srand(1);
+  for (i = 0; i < NCLIENTS; i++) {
+    fds[i] = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(fds[i], (struct sockaddr *) &sin, sizeof(sin)) != 0) exit(1);
+    req(fds[i], "GET", 0);
+  }
+  for (i = 0; i < NCLIENTS; i++) req(fds[i], "POST", 8000 + rand() % 22000);
+  for (r = 0; r < 8; r++) {
+    sleep(1);
+    for (i = 0; i < NCHATTY; i++) req(fds[i], "GET", 0);
+  }
+  s_done = 1;
+  return arg;
+}
+
+int main(void) {
+  struct mg_mgr mgr;
+  struct mg_connection *lsn;
+  pthread_t tid;
+  size_t base, live;
+  int i;
+  mg_log_set(MG_LL_NONE);
+  mg_mgr_init(&mgr);
+  if ((lsn = mg_http_listen(&mgr, "http://127.0.0.1:0", fn, NULL)) == NULL) {
+    return 1;
+  }
+  s_port = lsn->loc.port;
+  base = s_live, s_peak = s_live;
+  pthread_create(&tid, NULL, clients, NULL);
+  while (!s_done) mg_mgr_poll(&mgr, 50);
+  live = s_live;
+  pthread_join(tid, NULL);
+  for (i = 0; i < NCLIENTS; i++) close(s_fds[i]);
+  printf("%d clients: peak %lu KB, held after 8 s %lu KB\n", NCLIENTS,
+         (unsigned long) ((s_peak - base) / 1024),
+         (unsigned long) ((live - base) / 1024));
+  mg_mgr_free(&mgr);
+  return 0;
+}
@@ -0,0 +1,68 @@
+// JSON scan throughput, mongoose.c before the block scans (ref_*) vs now, for
+// mg_json_get() of the last field and for a full tape. Tape offsets are 16
+// bit, so the tape gets the first 64000 bytes of the larger documents. Best
+// of 15 rounds, old and new interleaved. Built like test_json
+#include "mongoose.h"
+#include "json_docs.h"
+
+int ref_mg_json_get(struct mg_str json, const char *path, int *toklen);
+int ref_mg_json_tape_init(struct mg_json_tape *, struct mg_str json,
+                          struct mg_json_tok *toks, size_t max_toks);
+
+static struct mg_json_tok s_toks[20000];
+static volatile int s_sink;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+// ns per call, over about 5 MB
+static double run(int m, struct mg_str json) {
+  struct mg_json_tape t;
+  double start = now_ns();
+  int i, len, reps = (int) (5000000 / json.len) + 1;
+  for (i = 0; i < reps; i++) {
+    if (m == 0) s_sink += ref_mg_json_get(json, "$.result.last", &len);
+    if (m == 1) s_sink += mg_json_get(json, "$.result.last", &len);
+    if (m == 2) s_sink += ref_mg_json_tape_init(&t, json, s_toks, 20000);
+    if (m == 3) s_sink += mg_json_tape_init(&t, json, s_toks, 20000);
+  }
+  return (now_ns() - start) / reps;
+}
+
+int main(void) {
+  static const struct {
+    const char *name;
+    int kind;
+    size_t size;
+    bool pretty;
+  } docs[] = {{"compact 1 KB", DOC_SCAN, 1024, false},
+              {"compact 256 KB", DOC_SCAN, 256 * 1024, false},
+              {"compact 1 MB", DOC_SCAN, 1024 * 1024, false},
+              {"pretty 256 KB", DOC_SCAN, 256 * 1024, true},
+              {"long strings", DOC_FIRMWARE, 256 * 1024, false}};
+  size_t i, len;
+  int m, r;
+  printf("%-16s %20s %20s\n", "MB/s", "get old -> new", "tape old -> new");
+  for (i = 0; i < sizeof(docs) / sizeof(docs[0]); i++) {
+    char *doc = doc_make(docs[i].kind, docs[i].size, docs[i].pretty, &len);
+    struct mg_str json = mg_str_n(doc, len);
+    struct mg_str head = mg_str_n(doc, len < 64000 ? len : 64000);
+    double best[4] = {1e18, 1e18, 1e18, 1e18}, mb[4];
+    for (r = 0; r < 15; r++) {
+      for (m = 0; m < 4; m++) {
+        double t = run(m, m < 2 ? json : head);
+        if (t < best[m]) best[m] = t;
+      }
+    }
+    for (m = 0; m < 4; m++) {
+      mb[m] = (double) (m < 2 ? json : head).len / best[m] * 1e3;
+    }
+    printf("%-16s %9.0f -> %6.0f %9.0f -> %6.0f\n", docs[i].name, mb[0], mb[1],
+           mb[2], mb[3]);
+    free(doc);
+  }
+  return 0;
+}
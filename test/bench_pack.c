@@ -0,0 +1,42 @@
+// packed_stat() calls per second with 500 packed assets in 8 directories,
+// the linear scan it replaced vs the generated perfect hash
+#include "mongoose.h"
+#include "pack_linear.h"
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+static volatile int s_sink;
+
+static double rate(bool hashed, const char *path) {
+  size_t size;
+  time_t mtime;
+  double t = now_s();
+  int i, iters = hashed ? 2000000 : 20000;
+  for (i = 0; i < iters; i++) {
+    s_sink += hashed ? mg_fs_packed.st(path, &size, &mtime) : linear_stat(path);
+  }
+  return iters / (now_s() - t);
+}
+
+int main(void) {
+  static const char *names[] = {"file hit", "file miss (.gz)", "directory",
+                                "missing path"};
+  const char *paths[4] = {mg_unlist(250), NULL, "/assets/d7", "/assets/d9/x"};
+  char gz[MG_PATH_MAX];
+  size_t i;
+  mg_snprintf(gz, sizeof(gz), "%s.gz", paths[0]);
+  paths[1] = gz;
+  for (i = 0; i < 4; i++) {
+    double before = rate(false, paths[i]), after = rate(true, paths[i]);
+    if (linear_stat(paths[i]) != mg_fs_packed.st(paths[i], NULL, NULL)) {
+      printf("%s: results differ\n", paths[i]);
+    }
+    printf("%-16s %8.0fk -> %6.1fM calls/s (%.0fx)\n", names[i], before / 1e3,
+           after / 1e6, after / before);
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+// Cost of one mg_mgr_poll(mgr, 0) with idle keep-alive connections. It
+// includes the kernel's scan of the poll set.
+// Usage: bench_poll [connections ...], default 10 100 1000 4000
+#include "mongoose.h"
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e6 + (double) ts.tv_nsec / 1e3;
+}
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  (void) c, (void) ev, (void) ev_data;
+}
+
+static int accepted(struct mg_mgr *mgr) {
+  struct mg_connection *c;
+  int n = 0;
+  for (c = mgr->conns; c != NULL; c = c->next) n += c->is_accepted;
+  return n;
+}
+
+static void run(int n) {
+  struct mg_mgr mgr;
+  struct mg_connection *lsn;
+  struct sockaddr_in sin;
+  int i, iters = n < 100 ? 200000 : 20000000 / n, *fds;
+  double t;
+
+  mg_mgr_init(&mgr);
+  if ((lsn = mg_listen(&mgr, "tcp://127.0.0.1:0", fn, NULL)) == NULL) exit(1);
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = lsn->loc.port;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  fds = (int *) calloc((size_t) n, sizeof(*fds));
+  for (i = 0; i < n; i++) {
+    fds[i] = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(fds[i], (struct sockaddr *) &sin, sizeof(sin)) != 0) {
+      fprintf(stderr, "connect %d: %s, raise ulimit -n\n", i, strerror(errno));
+      exit(1);
+    }
+    mg_mgr_poll(&mgr, 0);  // The backlog is short, accept as we go
+  }
+  while (accepted(&mgr) < n) mg_mgr_poll(&mgr, 1);
+  for (i = 0; i < 1000; i++) mg_mgr_poll(&mgr, 0);  // Warm up
+
+  t = now_us();
+  for (i = 0; i < iters; i++) mg_mgr_poll(&mgr, 0);
+  printf("%6d idle connections: %8.2f us per mg_mgr_poll\n", n,
+         (now_us() - t) / iters);
+
+  for (i = 0; i < n; i++) close(fds[i]);
+  free(fds);
+  mg_mgr_free(&mgr);
+}
+
+int main(int argc, char *argv[]) {
+  static const int defaults[] = {10, 100, 1000, 4000};
+  int i;
+  mg_log_set(MG_LL_NONE);
+  if (argc > 1) {
+    for (i = 1; i < argc; i++) run(atoi(argv[i]));
+  } else {
+    for (i = 0; i < (int) (sizeof(defaults) / sizeof(defaults[0])); i++) {
+      run(defaults[i]);
+    }
+  }
+  return 0;
+}
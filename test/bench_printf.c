@@ -0,0 +1,82 @@
+// Typical response formatting, mg_vxprintf() writing char by char before
+// (ref_* functions, see the Makefile) vs in spans. Best of 15 rounds
+#include "mongoose.h"
+
+size_t ref_mg_xprintf(void (*fn)(char, void *), void *, const char *fmt, ...);
+size_t ref_mg_snprintf(char *, size_t, const char *fmt, ...);
+size_t ref_mg_print_esc(void (*out)(char, void *), void *arg, va_list *ap);
+void ref_mg_pfn_iobuf(char ch, void *param);
+void ref_mg_http_reply(struct mg_connection *, int status_code,
+                       const char *headers, const char *body_fmt, ...);
+
+static const char *s_body =
+    "{\"ssid\":\"HomeNetwork-5G\",\"bssid\":\"aa:bb:cc:dd:ee:ff\",\"rssi\":-61,"
+    "\"channel\":36,\"auth\":\"wpa2\",\"ip\":\"192.168.1.42\","
+    "\"mask\":\"255.255.255.0\",\"gw\":\"192.168.1.1\"}";
+static struct mg_connection s_conn;
+static volatile size_t s_sink;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+// One response, old or new. Returns its length
+static size_t run(bool is_new, int which) {
+  struct mg_iobuf *io = &s_conn.send;
+  char buf[512];
+  int n = (int) strlen(s_body);
+  io->len = 0;
+  if (which == 0) {  // REST reply: status line, headers, body
+    const char *h = "Content-Type: application/json\r\n";
+    if (is_new) mg_http_reply(&s_conn, 200, h, "%.*s", n, s_body);
+    if (!is_new) ref_mg_http_reply(&s_conn, 200, h, "%.*s", n, s_body);
+    return io->len;
+  } else if (which == 1) {  // JSON-RPC response frame
+    const char *fmt = "{%m:%.*s,%m:%.*s}";
+    if (is_new) {
+      mg_xprintf(mg_pfn_iobuf, io, fmt, MG_ESC("id"), 2, "42",
+                 MG_ESC("result"), n, s_body);
+    } else {
+      ref_mg_xprintf(ref_mg_pfn_iobuf, io, fmt, ref_mg_print_esc, 0, "id", 2,
+                     "42", ref_mg_print_esc, 0, "result", n, s_body);
+    }
+    return io->len;
+  } else if (which == 2) {  // Wrapper info object of %m pairs
+    const char *fmt = "{%m:%m,%m:%m,%m:%d,%m:%d,%m:%m}";
+    size_t (*esc)(void (*)(char, void *), void *, va_list *) =
+        is_new ? mg_print_esc : ref_mg_print_esc;
+    size_t (*fn)(char *, size_t, const char *, ...) =
+        is_new ? mg_snprintf : ref_mg_snprintf;
+    return fn(buf, sizeof(buf), fmt, esc, 0, "ssid", esc, 0, "HomeNetwork-5G",
+              esc, 0, "bssid", esc, 0, "aa:bb:cc:dd:ee:ff", esc, 0, "rssi",
+              -61, esc, 0, "channel", 36, esc, 0, "auth", esc, 0, "wpa2");
+  } else {  // A fixed literal, e.g. JSON_SUCCESS
+    const char *fmt = "{\"cause\":\"success\"}";
+    return is_new ? mg_snprintf(buf, sizeof(buf), fmt)
+               : ref_mg_snprintf(buf, sizeof(buf), fmt);
+  }
+}
+
+int main(void) {
+  static const char *names[] = {"mg_http_reply + JSON", "JSON-RPC frame",
+                                "wrapper %m object", "literal snprintf"};
+  int w, r, m, i;
+  s_conn.send.align = MG_IO_SIZE;
+  for (w = 0; w < 4; w++) {
+    double best[2] = {1e18, 1e18}, t;
+    size_t len = 0;
+    for (r = 0; r < 15; r++) {
+      for (m = 0; m < 2; m++) {
+        t = now_ns();
+        for (i = 0; i < 20000; i++) s_sink += len = run(m, w);
+        if ((t = (now_ns() - t) / 20000) < best[m]) best[m] = t;
+      }
+    }
+    printf("%-22s %4d bytes: %5.0f -> %4.0f ns (%.1fx)\n", names[w], (int) len,
+           best[0], best[1], best[0] / best[1]);
+  }
+  mg_iobuf_free(&s_conn.send);
+  return 0;
+}
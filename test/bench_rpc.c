@@ -0,0 +1,58 @@
+// RPC dispatch through mg_rpc_process() with 10, 100 and 1000 methods, ns per
+// call. Worst case calls the method added first, which a linear scan of the
+// list finds last. Uniform calls all of them. For the list scan it replaced:
+// make bench REF=db40c21~1
+#include "mongoose.h"
+
+static volatile int s_hits;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static void handler(struct mg_rpc_req *r) {
+  s_hits++;
+  (void) r;
+}
+
+static double run(struct mg_rpc **head, char (*frames)[64], int n, bool all) {
+  unsigned char buf[256];
+  struct mg_iobuf io;
+  struct mg_rpc_req r;
+  double t = now_ns();
+  int i, iters = 1000000;
+  memset(&io, 0, sizeof(io));
+  io.buf = buf, io.size = sizeof(buf);
+  for (i = 0; i < iters; i++) {
+    int k = all ? (int) ((unsigned) i * 2654435761U % (unsigned) n) : 0;
+    memset(&r, 0, sizeof(r));
+    r.head = head, r.pfn = mg_pfn_iobuf, r.pfn_data = &io;
+    r.frame = mg_str(frames[k]);
+    io.len = 0;
+    mg_rpc_process(&r);
+  }
+  return (now_ns() - t) / iters;
+}
+
+int main(void) {
+  static char frames[1000][64];
+  int sizes[] = {10, 100, 1000}, i, k;
+  char name[32];
+  printf("%8s %12s %12s\n", "methods", "worst case", "uniform");
+  for (k = 0; k < 3; k++) {
+    struct mg_rpc *head = NULL;
+    for (i = 0; i < sizes[k]; i++) {
+      mg_snprintf(name, sizeof(name), "module%d.method", i);
+      mg_rpc_add(&head, mg_str(name), handler, NULL);
+      mg_snprintf(frames[i], sizeof(frames[i]),
+                  "{\"id\":1,\"method\":\"module%d.method\"}", i);
+    }
+    printf("%8d %9.0f ns %9.0f ns\n", sizes[k],
+           run(&head, frames, sizes[k], false),
+           run(&head, frames, sizes[k], true));
+    mg_rpc_del(&head, NULL);
+  }
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Actuator call latency under load, on the firmware's main/main.c with the
+// hardware stubbed out (esp_stubs/ and the wrap_* below). sys/stats takes
+// 20 ms here. N keep-alive HTTP clients loop on it, while a WebSocket client
+// sends gpio_level every 10 ms. Each run starts a fresh server in a child
+// process and lasts 10 s.
+// main.c is linked 4 times, see the Makefile: as of now and before the
+// scheduler, each for 1 and 2 loops, with app_main renamed
+#include "esp_wrapper.h"
+#include <signal.h>
+#include <sys/wait.h>
+
+void now_main_1(void), now_main_2(void), ref_main_1(void), ref_main_2(void);
+
+#define DURATION_MS 10000
+#define MAX_SAMPLES 2048
+
+static const char *s_url = "http://127.0.0.1:8000";
+static double s_rtt[MAX_SAMPLES];  // gpio_level round trips, ms
+static size_t s_nrtt;
+static uint64_t s_sent_us;
+static int s_id, s_status[5];  // 200, 403, 429, 503, other
+
+// Hardware wrappers: answer at once, but for sys/stats
+void wrap_init(void) {
+}
+
+#define WRAP(name)                                                     \
+  bool name(const struct mg_json_tape *in, struct mg_str *out) {       \
+    out->len = mg_snprintf(out->buf, out->len, "{\"fn\":%m}",          \
+                           MG_ESC(#name));                             \
+    (void) in;                                                         \
+    return true;                                                       \
+  }
+WRAP(wrap_gpio_config)
+WRAP(wrap_gpio_info)
+WRAP(wrap_gpio_mode)
+WRAP(wrap_gpio_level)
+WRAP(wrap_pwm_config)
+WRAP(wrap_pwm_set_duty)
+WRAP(wrap_pwm_stop)
+WRAP(wrap_sys_info)
+WRAP(wrap_wifi_scan)
+WRAP(wrap_wifi_connect)
+WRAP(wrap_wifi_provisioned)
+WRAP(wrap_sys_led)
+WRAP(wrap_sys_digits)
+
+bool wrap_sys_stats(const struct mg_json_tape *in, struct mg_str *out) {
+  usleep(20000);
+  out->len = mg_snprintf(out->buf, out->len, "{\"temp\":%d}", 42);
+  (void) in;
+  return true;
+}
+
+void wifi_init(struct mg_mgr *mgrs, size_t n) {
+  (void) mgrs, (void) n;
+}
+
+bool wifi_scan_start(void) {
+  return false;
+}
+
+static uint64_t now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+static void send_stats(struct mg_connection *c) {
+  mg_printf(c,
+            "GET /rest/sys/stats HTTP/1.1\r\nHost: x\r\n"
+            "Authorization: Basic YWRtaW46YWRtaW4=\r\n\r\n");  // admin:admin
+}
+
+static void send_gpio(struct mg_connection *c) {
+  s_sent_us = now_us();
+  mg_ws_printf(c, WEBSOCKET_OP_TEXT,
+               "{\"id\":%d,\"method\":\"gpio_level\","
+               "\"params\":{\"pin\":2,\"level\":1}}",
+               ++s_id);
+}
+
+// Next request of a connection, by id: it may be gone by then
+struct later {
+  struct mg_mgr *mgr;
+  unsigned long id;
+};
+
+static void later_fn(void *arg) {
+  struct later *l = (struct later *) arg;
+  struct mg_connection *c;
+  for (c = l->mgr->conns; c != NULL; c = c->next) {
+    if (c->id != l->id) continue;
+    if (c->is_websocket) send_gpio(c);
+    if (!c->is_websocket) send_stats(c);
+  }
+  free(l);
+}
+
+static void later(struct mg_connection *c, uint64_t ms) {
+  struct later *l = (struct later *) calloc(1, sizeof(*l));
+  l->mgr = c->mgr, l->id = c->id;
+  mg_timer_add(c->mgr, ms, MG_TIMER_ONCE | MG_TIMER_AUTODELETE, later_fn, l);
+}
+
+static void loader_fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_CONNECT) {
+    send_stats(c);
+  } else if (ev == MG_EV_HTTP_MSG) {
+    int status = mg_http_status((struct mg_http_message *) ev_data);
+    s_status[status == 200   ? 0
+             : status == 403 ? 1
+             : status == 429 ? 2
+             : status == 503 ? 3
+                             : 4]++;
+    if (status == 200) send_stats(c);
+    if (status != 200) later(c, 100);  // Back off when refused
+  }
+}
+
+static void ws_fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_WS_OPEN) {
+    send_gpio(c);
+  } else if (ev == MG_EV_WS_MSG) {
+    struct mg_ws_message *wm = (struct mg_ws_message *) ev_data;
+    if (mg_json_get_long(wm->data, "$.id", -1) != s_id) return;
+    if (s_nrtt < MAX_SAMPLES) {
+      s_rtt[s_nrtt++] = (double) (now_us() - s_sent_us) / 1000;
+    }
+    later(c, 10);
+  }
+}
+
+static int cmp(const void *a, const void *b) {
+  double x = *(const double *) a, y = *(const double *) b;
+  return x < y ? -1 : x > y;
+}
+
+// p99 of gpio_level latency, ms
+static double run(void (*server)(void), int clients) {
+  struct mg_mgr mgr;
+  uint64_t end;
+  pid_t pid;
+  int i, fd;
+  fflush(stdout);
+  pid = fork();
+  if (pid == 0) {
+    fd = open("/dev/null", O_WRONLY);
+    dup2(fd, 1), dup2(fd, 2);
+    server();
+    exit(0);
+  }
+  usleep(300000);  // Listening
+  s_nrtt = 0, s_id = 0;
+  memset(s_status, 0, sizeof(s_status));
+  mg_mgr_init(&mgr);
+  for (i = 0; i < clients; i++) mg_http_connect(&mgr, s_url, loader_fn, NULL);
+  mg_ws_connect(&mgr, "ws://127.0.0.1:8000/websocket", ws_fn, NULL, NULL);
+  for (end = mg_millis() + DURATION_MS; mg_millis() < end;) {
+    mg_mgr_poll(&mgr, 1);
+  }
+  mg_mgr_free(&mgr);
+  kill(pid, SIGKILL);
+  waitpid(pid, NULL, 0);
+  if (s_nrtt == 0) return -1;
+  qsort(s_rtt, s_nrtt, sizeof(s_rtt[0]), cmp);
+  printf("  %4d calls, p50 %5.1f ms, max %6.1f ms, sys/stats "
+         "200/403/429/503/other: %d/%d/%d/%d/%d\n",
+         (int) s_nrtt, s_rtt[s_nrtt / 2], s_rtt[s_nrtt - 1], s_status[0],
+         s_status[1], s_status[2], s_status[3], s_status[4]);
+  return s_rtt[s_nrtt * 99 / 100];
+}
+
+int main(void) {
+  static const struct {
+    int loops, clients;
+    void (*before)(void), (*after)(void);
+  } runs[] = {{1, 4, ref_main_1, now_main_1},
+              {2, 4, ref_main_2, now_main_2},
+              {2, 16, ref_main_2, now_main_2}};
+  size_t i;
+  double before, after;
+  mg_log_set(MG_LL_NONE);
+  signal(SIGPIPE, SIG_IGN);
+  for (i = 0; i < sizeof(runs) / sizeof(runs[0]); i++) {
+    printf("%d loops, %d clients, before:\n", runs[i].loops, runs[i].clients);
+    before = run(runs[i].before, runs[i].clients);
+    printf("after:\n");
+    after = run(runs[i].after, runs[i].clients);
+    printf("gpio_level p99 %.1f -> %.1f ms\n\n", before, after);
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+// Serving the firmware's packed bundle.js, gzip accepted: keep-alive
+// requests per second from 4 client threads, then the peak heap while 40
+// clients with small receive buffers read it slowly. Heap bytes are counted
+// by wrappers of calloc() and free(), relative to the heap after
+// mg_http_listen(). bench_sendq_ref is the same against mongoose.c before
+// the send queue, which copied packed files into c->send 2 KB at a time
+#include <malloc.h>
+#include <pthread.h>
+#include "mongoose.h"
+
+#define NTHREADS 4
+#define NSLOW 40
+
+static size_t s_live, s_peak;  // Heap bytes
+static volatile long s_requests;
+static volatile int s_running;  // Client threads
+static uint16_t s_port;
+static char s_path[64], s_request[128];
+
+void *__real_calloc(size_t count, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_calloc(size_t count, size_t size) {
+  void *ptr = __real_calloc(count, size);
+  if (ptr != NULL) s_live += malloc_usable_size(ptr);
+  if (s_live > s_peak) s_peak = s_live;
+  return ptr;
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr != NULL) s_live -= malloc_usable_size(ptr);
+  __real_free(ptr);
+}
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_serve_opts opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.root_dir = "/web_root/", opts.fs = &mg_fs_packed;
+    mg_http_serve_dir(c, (struct mg_http_message *) ev_data, &opts);
+  }
+}
+
+static int connect_to_server(int rcvbuf) {
+  struct sockaddr_in sin;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (rcvbuf > 0) {
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = s_port;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (struct sockaddr *) &sin, sizeof(sin)) != 0) exit(1);
+  return fd;
+}
+
+// Keep-alive requests for 3 seconds, each response read in full
+static void *fast_client(void *arg) {
+  char buf[1 << 16];
+  int fd = connect_to_server(0);
+  uint64_t end = mg_millis() + 3000;
+  size_t len = strlen(s_request);
+  while (mg_millis() < end) {
+    struct mg_http_message hm;
+    size_t n = 0, want = 0;
+    int hlen;
+    if (send(fd, s_request, len, 0) != (ssize_t) len) break;
+    while (want == 0 || n < want) {
+      ssize_t r = recv(fd, buf + (want == 0 ? n : 0),
+                       want == 0 ? sizeof(buf) - n : sizeof(buf), 0);
+      if (r <= 0) goto done;
+      n += (size_t) r;
+      if (want == 0 && (hlen = mg_http_parse(buf, n, &hm)) > 0) {
+        want = (size_t) hlen + hm.body.len;
+      }
+    }
+    __sync_fetch_and_add(&s_requests, 1);
+  }
+done:
+  close(fd);
+  __sync_fetch_and_sub(&s_running, 1);
+  (void) arg;
+  return NULL;
+}
+
+// 1 KB from each client every 10 ms, for 3 seconds
+static void *slow_clients(void *arg) {
+  int fds[NSLOW], i, k;
+  char buf[1024];
+  for (i = 0; i < NSLOW; i++) {
+    fds[i] = connect_to_server(4096);
+    if (send(fds[i], s_request, strlen(s_request), 0) <= 0) exit(1);
+  }
+  for (k = 0; k < 300; k++) {
+    for (i = 0; i < NSLOW; i++) recv(fds[i], buf, sizeof(buf), MSG_DONTWAIT);
+    usleep(10000);
+  }
+  for (i = 0; i < NSLOW; i++) close(fds[i]);
+  __sync_fetch_and_sub(&s_running, 1);
+  (void) arg;
+  return NULL;
+}
+
+static void serve(struct mg_mgr *mgr, void *(*fn)(void *), int n) {
+  pthread_t t[NTHREADS];
+  int i;
+  s_running = n;
+  for (i = 0; i < n; i++) pthread_create(&t[i], NULL, fn, NULL);
+  while (s_running > 0) mg_mgr_poll(mgr, 1);
+  for (i = 0; i < n; i++) pthread_join(t[i], NULL);
+  for (i = 0; i < 10; i++) mg_mgr_poll(mgr, 1);  // Close
+}
+
+int main(void) {
+  struct mg_connection *c;
+  struct mg_mgr mgr;
+  const char *name;
+  size_t i, base;
+  for (i = 0; (name = mg_unlist(i)) != NULL; i++) {
+    if (mg_match(mg_str(name), mg_str("/web_root/bundle#.js.gz"), NULL)) break;
+  }
+  if (name == NULL) return 1;
+  mg_snprintf(s_path, sizeof(s_path), "%.*s", (int) (strlen(name) - 12),
+              name + 9);  // No /web_root, .gz
+  mg_snprintf(s_request, sizeof(s_request),
+              "GET %s HTTP/1.1\r\nHost: x\r\nAccept-Encoding: gzip\r\n\r\n",
+              s_path);
+  mg_log_set(MG_LL_NONE);
+  mg_mgr_init(&mgr);
+  c = mg_http_listen(&mgr, "http://127.0.0.1:0", fn, NULL);
+  s_port = c->loc.port;
+  base = s_live;
+
+  serve(&mgr, fast_client, NTHREADS);
+  printf("%s: %.1fk req/s", s_path, s_requests / 3.0 / 1000);
+  s_peak = s_live;
+  serve(&mgr, slow_clients, 1);
+  printf(", peak heap with %d slow clients %lu KB\n", NSLOW,
+         (unsigned long) (s_peak - base) / 1024);
+  mg_mgr_free(&mgr);
+  return 0;
+}
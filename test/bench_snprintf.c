@@ -0,0 +1,57 @@
+// Numbers formatted per second through mg_snprintf(): mongoose.c before the
+// digit pair and exact double code (ref_mg_snprintf, see the Makefile), now,
+// and glibc snprintf() for scale. Best of 5 runs, millions per second
+#include "mongoose.h"
+
+size_t ref_mg_snprintf(char *, size_t, const char *fmt, ...);
+
+static volatile size_t s_sink;
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+// Values like the firmware's: RSSI, counters, 64-bit totals, temperatures
+static double rate(int impl, int which) {
+  char buf[64];
+  double best = 0, t;
+  int r, i, n = 1000000;
+  for (r = 0; r < 5; r++) {
+    t = now_s();
+    for (i = 0; i < n; i++) {
+      int rssi = -30 - (i & 63);
+      unsigned long counter = 3000000000UL + (unsigned long) i * 7;
+      long long total = 1700000000000LL + (long long) i * 977;
+      double temp = 20.0 + (double) (i & 1023) / 37.0;
+      double any = (double) i * 1.37e-3 - 250.0;
+#define FMT(fmt, v)                                               \
+  (impl == 0   ? ref_mg_snprintf(buf, sizeof(buf), fmt, v)        \
+   : impl == 1 ? mg_snprintf(buf, sizeof(buf), fmt, v)            \
+               : (size_t) snprintf(buf, sizeof(buf), fmt, v))
+      if (which == 0) s_sink += FMT("%d", rssi);
+      if (which == 1) s_sink += FMT("%lu", counter);
+      if (which == 2) s_sink += FMT("%lld", total);
+      if (which == 3) s_sink += FMT("%f", temp);
+      if (which == 4) s_sink += FMT("%.1f", temp);
+      if (which == 5) s_sink += FMT("%g", any);
+#undef FMT
+    }
+    if ((t = n / (now_s() - t) / 1e6) > best) best = t;
+  }
+  return best;
+}
+
+int main(void) {
+  static const char *names[] = {"%d   RSSI",        "%lu  32-bit counters",
+                                "%lld 64-bit",      "%f   temperature",
+                                "%.1f temperature", "%g   arbitrary"};
+  int w;
+  printf("%-22s %6s %6s %6s\n", "M/s", "old", "new", "glibc");
+  for (w = 0; w < 6; w++) {
+    printf("%-22s %6.1f %6.1f %6.1f\n", names[w], rate(0, w), rate(1, w),
+           rate(2, w));
+  }
+  return 0;
+}
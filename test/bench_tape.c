@@ -0,0 +1,100 @@
+// Field lookups in the firmware's request bodies, one mg_json_get() text scan
+// per field vs a tape tokenized once. Best of 5 runs, ns per request.
+// For the size-optimised build: make bench OPT=-Os B=build-os
+#include "mongoose.h"
+
+static const char *s_pwm =
+    "{\"id\":17,\"method\":\"pwm_config\",\"params\":{\"pin\":4,\"channel\":0,"
+    "\"freq\":5000,\"timer\":0,\"resolution\":13}}";
+static const char *s_gpio =
+    "{\"pins\":[2,4,5,12,13],\"mode\":3,\"pull_up_en\":1,\"pull_down_en\":0,"
+    "\"intr_type\":0}";
+static volatile long s_sink;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+// RPC frame: method, params with 5 fields, id
+static void pwm_text(void) {
+  struct mg_str frame = mg_str(s_pwm), params;
+  int len;
+  s_sink += mg_json_get(frame, "$.method", &len);
+  params = mg_json_get_tok(frame, "$.params");
+  s_sink += mg_json_get_long(params, "$.pin", -1) +
+            mg_json_get_long(params, "$.channel", -1) +
+            mg_json_get_long(params, "$.freq", -1) +
+            mg_json_get_long(params, "$.timer", -1) +
+            mg_json_get_long(params, "$.resolution", -1);
+  s_sink += mg_json_get(frame, "$.id", &len);
+}
+
+static void pwm_tape(void) {
+  struct mg_json_tok toks[MG_JSON_TAPE_SIZE];
+  struct mg_json_tape frame, params;
+  mg_json_tape_init(&frame, mg_str(s_pwm), toks, MG_JSON_TAPE_SIZE);
+  s_sink += mg_json_tape_find(&frame, "$.method");
+  params = frame, params.root = mg_json_tape_find(&frame, "$.params");
+  s_sink += mg_json_tape_get_long(&params, "$.pin", -1) +
+            mg_json_tape_get_long(&params, "$.channel", -1) +
+            mg_json_tape_get_long(&params, "$.freq", -1) +
+            mg_json_tape_get_long(&params, "$.timer", -1) +
+            mg_json_tape_get_long(&params, "$.resolution", -1);
+  s_sink += mg_json_tape_find(&frame, "$.id");
+}
+
+// REST body: walk the pins array, then 4 fields
+static void gpio_text(void) {
+  struct mg_str body = mg_str(s_gpio), pins, val;
+  size_t ofs = 0;
+  uint8_t pin;
+  pins = mg_json_get_tok(body, "$.pins");
+  while ((ofs = mg_json_next(pins, ofs, NULL, &val)) > 0) {
+    mg_str_to_num(val, 10, &pin, sizeof(pin));
+    s_sink += pin;
+  }
+  s_sink += mg_json_get_long(body, "$.mode", 0) +
+            mg_json_get_long(body, "$.pull_up_en", 0) +
+            mg_json_get_long(body, "$.pull_down_en", 0) +
+            mg_json_get_long(body, "$.intr_type", 0);
+}
+
+static void gpio_tape(void) {
+  struct mg_json_tok toks[MG_JSON_TAPE_SIZE];
+  struct mg_json_tape body;
+  uint8_t pin;
+  int i;
+  mg_json_tape_init(&body, mg_str(s_gpio), toks, MG_JSON_TAPE_SIZE);
+  i = mg_json_tape_child(&body, mg_json_tape_find(&body, "$.pins"));
+  for (; i > 0; i = body.toks[i].next) {
+    struct mg_json_tok *t = &body.toks[i];
+    mg_str_to_num(mg_str_n(body.json.buf + t->ofs, t->len), 10, &pin,
+                  sizeof(pin));
+    s_sink += pin;
+  }
+  s_sink += mg_json_tape_get_long(&body, "$.mode", 0) +
+            mg_json_tape_get_long(&body, "$.pull_up_en", 0) +
+            mg_json_tape_get_long(&body, "$.pull_down_en", 0) +
+            mg_json_tape_get_long(&body, "$.intr_type", 0);
+}
+
+static double best(void (*fn)(void)) {
+  double min = 1e18, t;
+  int r, i, n = 200000;
+  for (r = 0; r < 5; r++) {
+    t = now_ns();
+    for (i = 0; i < n; i++) fn();
+    if ((t = (now_ns() - t) / n) < min) min = t;
+  }
+  return min;
+}
+
+int main(void) {
+  printf("pwm_config RPC frame: text %5.0f ns, tape %5.0f ns\n",
+         best(pwm_text), best(pwm_tape));
+  printf("gpio/cfg REST body:   text %5.0f ns, tape %5.0f ns\n",
+         best(gpio_text), best(gpio_tape));
+  return 0;
+}
@@ -0,0 +1,65 @@
+// Cost of one timer poll per millisecond, timer list vs timer wheel. The
+// repeating timers have periods of 1 to 60 seconds, so few are due at once
+// Usage: bench_timer [timers ...], default 10 100 1000 10000
+#include "mongoose.h"
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e6 + (double) ts.tv_nsec / 1e3;
+}
+
+static void fn(void *arg) {
+  (*(unsigned long *) arg)++;
+}
+
+static void run(int n) {
+  struct mg_timer *ts = (struct mg_timer *) calloc((size_t) n, sizeof(*ts));
+  struct mg_timer *list = NULL, *staged = NULL;
+  struct mg_timer_wheel wheel;
+  unsigned long fired[2] = {0, 0};
+  int i, iters = 1000000;
+  uint64_t now = 1000000;
+  double t, us[2];
+
+  srand(1);
+  for (i = 0; i < n; i++) {
+    uint64_t ms = 1000 + (uint64_t) rand() % 59000;
+    mg_timer_init(&list, &ts[i], ms, MG_TIMER_REPEAT, fn, &fired[0]);
+  }
+  if (n >= 1000) iters = 100000;
+  t = now_us();
+  for (i = 0; i < iters; i++) mg_timer_poll(&list, now + (uint64_t) i);
+  us[0] = (now_us() - t) / iters;
+
+  memset(&wheel, 0, sizeof(wheel));
+  memset(ts, 0, (size_t) n * sizeof(*ts));
+  srand(1);
+  for (i = 0; i < n; i++) {
+    uint64_t ms = 1000 + (uint64_t) rand() % 59000;
+    mg_timer_init(&staged, &ts[i], ms, MG_TIMER_REPEAT, fn, &fired[1]);
+  }
+  t = now_us();
+  for (i = 0; i < iters; i++) {
+    mg_timer_wheel_poll(&wheel, &staged, now + (uint64_t) i);
+  }
+  us[1] = (now_us() - t) / iters;
+
+  if (fired[0] != fired[1]) printf("fired %lu vs %lu\n", fired[0], fired[1]);
+  printf("%6d timers: list %8.3f us, wheel %8.3f us per poll\n", n, us[0],
+         us[1]);
+  free(ts);
+}
+
+int main(int argc, char *argv[]) {
+  static const int defaults[] = {10, 100, 1000, 10000};
+  int i;
+  if (argc > 1) {
+    for (i = 1; i < argc; i++) run(atoi(argv[i]));
+  } else {
+    for (i = 0; i < (int) (sizeof(defaults) / sizeof(defaults[0])); i++) {
+      run(defaults[i]);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,98 @@
+// Loop wakeups with a fixed 10 ms poll timeout vs mg_mgr_poll(mgr, -1),
+// which sleeps until the next timer or I/O. The manager has a listener and
+// a wakeup pipe. Per case: wakeups per second over 2 idle seconds, then the
+// latency of 50 mg_wakeup() calls from another thread. With a 250 ms timer,
+// how late it fires too
+#include <pthread.h>
+#include "mongoose.h"
+
+struct bench {
+  struct mg_mgr mgr;
+  unsigned long id;           // Listener, gets MG_EV_WAKEUP
+  double wakeup_us, late_us;  // Sums
+  int wakeups, fires;
+  uint64_t start_us;  // Timer armed
+};
+
+static uint64_t now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_WAKEUP) {
+    struct bench *b = (struct bench *) c->fn_data;
+    struct mg_str *data = (struct mg_str *) ev_data;
+    uint64_t sent;
+    memcpy(&sent, data->buf, sizeof(sent));
+    b->wakeup_us += (double) (now_us() - sent), b->wakeups++;
+  }
+}
+
+static void timer_fn(void *arg) {
+  struct bench *b = (struct bench *) arg;
+  uint64_t due = b->start_us + (uint64_t) (b->fires + 1) * 250000;
+  b->late_us += (double) now_us() - (double) due, b->fires++;
+}
+
+static void *waker(void *arg) {
+  struct bench *b = (struct bench *) arg;
+  int i;
+  for (i = 0; i < 50; i++) {
+    uint64_t t;
+    usleep(20000);
+    t = now_us();
+    mg_wakeup(&b->mgr, b->id, &t, sizeof(t));
+  }
+  return NULL;
+}
+
+static void stop_fn(void *arg) {
+  *(bool *) arg = true;
+}
+
+// Poll for ms milliseconds, return the number of polls. With no timeout the
+// loop only sees the time when woken, so a timer ends it. Its poll is not
+// counted
+static int spin(struct bench *b, int timeout, uint64_t ms) {
+  bool done = false;
+  int n = 0;
+  mg_timer_add(&b->mgr, ms, MG_TIMER_ONCE | MG_TIMER_AUTODELETE, stop_fn,
+               &done);
+  while (!done) mg_mgr_poll(&b->mgr, timeout), n++;
+  return n - 1;
+}
+
+static void run(int timeout, bool timer) {
+  struct bench b;
+  struct mg_connection *c;
+  pthread_t t;
+  int polls;
+  memset(&b, 0, sizeof(b));
+  mg_mgr_init(&b.mgr);
+  mg_wakeup_init(&b.mgr);
+  c = mg_http_listen(&b.mgr, "http://127.0.0.1:0", fn, &b);
+  b.id = c->id;
+  spin(&b, timeout, 100);  // Settle
+  if (timer) {
+    b.start_us = now_us();
+    mg_timer_add(&b.mgr, 250, MG_TIMER_REPEAT, timer_fn, &b);
+  }
+  polls = spin(&b, timeout, 2000);
+  pthread_create(&t, NULL, waker, &b);
+  spin(&b, timeout, 1200);
+  pthread_join(t, NULL);
+  printf("poll(%3d), %-14s %6.1f wakeups/s, wakeup latency %4.0f us",
+         timeout, timer ? "250 ms timer:" : "no timers:", polls / 2.0,
+         b.wakeups ? b.wakeup_us / b.wakeups : -1);
+  if (timer) printf(", timer late by %.2f ms", b.late_us / b.fires / 1000);
+  printf("\n");
+  mg_mgr_free(&b.mgr);
+}
+
+int main(void) {
+  mg_log_set(MG_LL_NONE);
+  run(10, false), run(-1, false), run(10, true), run(-1, true);
+  return 0;
+}
@@ -0,0 +1,2 @@
+// Host stub of the ESP-IDF header, see ../bench_sched.c. Nothing of it is used
+#pragma once
@@ -0,0 +1,12 @@
+// Host stub of the ESP-IDF header, see ../bench_sched.c
+#pragma once
+#include <stdint.h>
+
+#define ESP_MAC_WIFI_STA 0
+
+static inline int esp_read_mac(uint8_t *mac, int type) {
+  int i;
+  for (i = 0; i < 6; i++) mac[i] = (uint8_t) i;
+  (void) type;
+  return 0;
+}
@@ -0,0 +1,83 @@
+// Host stubs of the FreeRTOS calls that main/main.c makes, on pthreads. See
+// ../bench_sched.c
+#pragma once
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define portNUM_PROCESSORS 2
+#define portMAX_DELAY 0xffffffffU
+#define pdFALSE 0
+#define pdTRUE 1
+#define BIT0 1U
+
+typedef pthread_mutex_t *SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+  pthread_mutex_t *m = (pthread_mutex_t *) calloc(1, sizeof(*m));
+  pthread_mutex_init(m, NULL);
+  return m;
+}
+
+#define xSemaphoreTake(m, ticks) pthread_mutex_lock(m)
+#define xSemaphoreGive(m) pthread_mutex_unlock(m)
+
+static inline int xTaskCreatePinnedToCore(void (*fn)(void *), const char *name,
+                                          int stack, void *arg, int prio,
+                                          void *handle, int core) {
+  pthread_t t;
+  (void) name, (void) stack, (void) prio, (void) handle, (void) core;
+  return pthread_create(&t, NULL, (void *(*)(void *))(void (*)(void)) fn,
+                        arg);
+}
+
+#define taskYIELD() sched_yield()
+
+typedef struct {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  unsigned bits;
+} *EventGroupHandle_t;
+
+static inline EventGroupHandle_t xEventGroupCreate(void) {
+  EventGroupHandle_t g = (EventGroupHandle_t) calloc(1, sizeof(*g));
+  pthread_mutex_init(&g->mutex, NULL);
+  pthread_cond_init(&g->cond, NULL);
+  return g;
+}
+
+static inline unsigned xEventGroupSetBits(EventGroupHandle_t g, unsigned b) {
+  pthread_mutex_lock(&g->mutex);
+  g->bits |= b;
+  pthread_cond_broadcast(&g->cond);
+  pthread_mutex_unlock(&g->mutex);
+  return b;
+}
+
+static inline unsigned xEventGroupClearBits(EventGroupHandle_t g, unsigned b) {
+  pthread_mutex_lock(&g->mutex);
+  g->bits &= ~b;
+  pthread_mutex_unlock(&g->mutex);
+  return b;
+}
+
+static inline unsigned xEventGroupGetBits(EventGroupHandle_t g) {
+  unsigned b;
+  pthread_mutex_lock(&g->mutex);
+  b = g->bits;
+  pthread_mutex_unlock(&g->mutex);
+  return b;
+}
+
+// Waits for all of bits, without a timeout
+static inline unsigned xEventGroupWaitBits(EventGroupHandle_t g, unsigned b,
+                                           int clear, int all, unsigned ticks) {
+  unsigned result;
+  (void) clear, (void) all, (void) ticks;
+  pthread_mutex_lock(&g->mutex);
+  while ((g->bits & b) != b) pthread_cond_wait(&g->cond, &g->mutex);
+  result = g->bits;
+  pthread_mutex_unlock(&g->mutex);
+  return result;
+}
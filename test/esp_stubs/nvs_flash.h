@@ -0,0 +1,17 @@
+// Host stub of the ESP-IDF header, see ../bench_sched.c
+#pragma once
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_ERR_NVS_NO_FREE_PAGES 1
+#define ESP_ERR_NVS_NEW_VERSION_FOUND 2
+#define ESP_ERROR_CHECK(x) (void) (x)
+
+static inline esp_err_t nvs_flash_init(void) {
+  return ESP_OK;
+}
+
+static inline esp_err_t nvs_flash_erase(void) {
+  return ESP_OK;
+}
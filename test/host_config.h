@@ -0,0 +1,51 @@
+// Host build of the firmware's Mongoose: the options of
+// ../mongoose/mongoose_config.h, on Linux. Targets may override them with -D
+#define MG_ARCH MG_ARCH_UNIX
+
+#ifndef MG_TLS
+#define MG_TLS MG_TLS_BUILTIN
+#endif
+
+#ifndef MG_ENABLE_PACKED_FS
+#define MG_ENABLE_PACKED_FS 0  // Targets that link a packed fs set it
+#endif
+
+#ifndef MG_ENABLE_POLL
+#define MG_ENABLE_POLL 1
+#endif
+
+#ifndef MG_ENABLE_EPOLL
+#define MG_ENABLE_EPOLL 0  // mongoose.h defaults to epoll on Linux
+#endif
+
+#ifndef MG_IO_SIZE
+#define MG_IO_SIZE 2048
+#endif
+
+#ifndef MG_ENABLE_SLAB
+#define MG_ENABLE_SLAB 1
+#endif
+
+#ifndef MG_ENABLE_IOBUF_POOL
+#define MG_ENABLE_IOBUF_POOL 1
+#endif
+
+#ifndef MG_IOBUF_POOL_BYTES
+#define MG_IOBUF_POOL_BYTES 16384
+#endif
+
+#ifndef MG_ENABLE_IOBUF_RING
+#define MG_ENABLE_IOBUF_RING 1
+#endif
+
+#ifndef MG_ENABLE_SENDQ
+#define MG_ENABLE_SENDQ 1
+#endif
+
+#ifndef MG_CHAN_SIZE
+#define MG_CHAN_SIZE 16
+#endif
+
+#ifndef MG_DATA_SIZE
+#define MG_DATA_SIZE 64
+#endif
@@ -0,0 +1,101 @@
+// JSON documents like the ones the firmware sends and parses, made up here so
+// that the JSON test and benchmark need no data files. The same seed gives
+// the same document
+enum { DOC_SCAN, DOC_FIRMWARE };  // Wi-Fi scan results, firmware list
+
+static uint32_t s_doc_seed = 1;
+
+static uint32_t doc_rnd(void) {
+  s_doc_seed ^= s_doc_seed << 13;
+  s_doc_seed ^= s_doc_seed >> 17;
+  s_doc_seed ^= s_doc_seed << 5;
+  return s_doc_seed;
+}
+
+// n to n + spread random chars of a set, JSON-escaped
+static size_t doc_chars(char *buf, const char *set, size_t n, size_t spread) {
+  size_t i, len = 0, set_len = strlen(set);
+  n += doc_rnd() % (spread + 1);
+  for (i = 0; i < n; i++) {
+    char ch = set[doc_rnd() % set_len];
+    if (ch == '"' || ch == '\\') buf[len++] = '\\';
+    buf[len++] = ch;
+  }
+  return len;
+}
+
+static size_t doc_item(char *buf, int kind, int i) {
+  size_t n;
+  if (kind == DOC_SCAN) {
+    // SSIDs are short and escape-heavy, the worst case for the string scan
+    n = (size_t) sprintf(buf, "{\"ssid\":\"Network-%d ", i);
+    n += doc_chars(buf + n, "abcdefghij \\\"", 4, 24);
+    n += (size_t) sprintf(buf + n,
+                          "\",\"bssid\":\"%02x:%02x:%02x:%02x:%02x:%02x\","
+                          "\"rssi\":%d,\"channel\":%d,\"auth\":\"%s\","
+                          "\"hidden\":%s}",
+                          doc_rnd() & 255, doc_rnd() & 255, doc_rnd() & 255,
+                          doc_rnd() & 255, doc_rnd() & 255, doc_rnd() & 255,
+                          -30 - (int) (doc_rnd() % 66),
+                          1 + (int) (doc_rnd() % 13),
+                          doc_rnd() % 2 ? "wpa2" : "open",
+                          doc_rnd() % 2 ? "true" : "false");
+  } else {
+    n = (size_t) sprintf(buf, "{\"name\":\"fw-%d\",\"sha\":\"", i);
+    n += doc_chars(buf + n, "0123456789abcdef", 64, 0);
+    n += (size_t) sprintf(buf + n, "\",\"note\":\"");
+    n += doc_chars(buf + n, "abcdefghijklmnopqrstuvwxyz ", 80, 80);
+    n += (size_t) sprintf(buf + n, "\"}");
+  }
+  return n;
+}
+
+// Python's json.dumps(indent=2) layout of a compact document
+static size_t doc_pretty(const char *s, size_t len, char *buf) {
+  size_t i, n = 0;
+  int depth = 0, k;
+  bool in_str = false;
+  for (i = 0; i < len; i++) {
+    char ch = s[i];
+    if (in_str) {
+      buf[n++] = ch;
+      if (ch == '\\') buf[n++] = s[++i];
+      if (ch == '"') in_str = false;
+    } else if ((ch == '{' || ch == '[') &&
+               (s[i + 1] == '}' || s[i + 1] == ']')) {
+      buf[n++] = ch, buf[n++] = s[++i];
+    } else if (ch == '{' || ch == '[' || ch == ',') {
+      buf[n++] = ch, buf[n++] = '\n';
+      if (ch != ',') depth++;
+      for (k = 0; k < depth * 2; k++) buf[n++] = ' ';
+    } else if (ch == '}' || ch == ']') {
+      buf[n++] = '\n', depth--;
+      for (k = 0; k < depth * 2; k++) buf[n++] = ' ';
+      buf[n++] = ch;
+    } else {
+      buf[n++] = ch;
+      if (ch == ':') buf[n++] = ' ';
+      if (ch == '"') in_str = true;
+    }
+  }
+  buf[n] = '\0';
+  return n;
+}
+
+// A document of at least size bytes, compact or pretty. Free with free()
+static char *doc_make(int kind, size_t size, bool pretty, size_t *len) {
+  char *s = (char *) malloc(size + 1024), *p;
+  size_t n = (size_t) sprintf(s, "{\"id\":7,\"result\":{\"%s\":[",
+                              kind == DOC_SCAN ? "aps" : "items");
+  int i;
+  for (i = 0; n + 20 < size; i++) {
+    if (i > 0) s[n++] = ',';
+    n += doc_item(s + n, kind, i);
+  }
+  n += (size_t) sprintf(s + n, "],\"last\":\"end\"}}");
+  if (!pretty) return *len = n, s;
+  p = (char *) malloc(n * 4 + 1);
+  *len = doc_pretty(s, n, p);
+  free(s);
+  return p;
+}
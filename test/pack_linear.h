@@ -0,0 +1,18 @@
+// packed_stat() as it was before the perfect hash: a linear scan of the
+// packed files for the name, then another for a directory prefix
+static int is_dir_prefix(const char *prefix, size_t n, const char *path) {
+  return n < strlen(path) && strncmp(prefix, path, n) == 0 &&
+         (n == 0 || path[n] == '/' || path[n - 1] == '/');
+}
+
+static int linear_stat(const char *path) {
+  const char *p;
+  size_t i, n = strlen(path);
+  for (i = 0; (p = mg_unlist(i)) != NULL; i++) {
+    if (strcmp(p, path) == 0) return MG_FS_READ;
+  }
+  for (i = 0; (p = mg_unlist(i)) != NULL; i++) {
+    if (is_dir_prefix(path, n, p)) return MG_FS_DIR;
+  }
+  return 0;
+}
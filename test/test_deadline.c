@@ -0,0 +1,154 @@
+// Connection deadlines: a listener with {1s, 1s, 1s, 2s, 2s} and clients
+// that misbehave in each phase. The accepted connection must be closed by
+// the right class, in time, counted from the client's last byte or from
+// accept. A client that keeps sending requests must be kept open
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static const struct mg_deadlines s_deadlines = {1000, 1000, 1000, 2000, 2000};
+static const char *s_names[] = {"handshake", "header", "body", "idle",
+                                "write"};
+static struct mg_str s_cert, s_key;
+static struct mg_connection *s_conn;  // Accepted connection
+static char s_big[8192];              // Body of /big
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_ACCEPT) {
+    int sndbuf = 4096;  // So that a stalled reader stalls writes soon
+    setsockopt((int) (size_t) c->fd, SOL_SOCKET, SO_SNDBUF, &sndbuf,
+               sizeof(sndbuf));
+    s_conn = c;
+    if (c->fn_data != NULL) {
+      struct mg_tls_opts opts;
+      memset(&opts, 0, sizeof(opts));
+      opts.cert = s_cert, opts.key = s_key;
+      mg_tls_init(c, &opts);
+    }
+  } else if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_message *hm = (struct mg_http_message *) ev_data;
+    bool big = mg_match(hm->uri, mg_str("/big"), NULL);
+    mg_http_reply(c, 200, "", "%s", big ? s_big : "ok");
+  } else if (ev == MG_EV_CLOSE && c == s_conn) {
+    s_conn = NULL;
+  }
+}
+
+static int connect_to(struct mg_mgr *mgr, struct mg_connection *lsn) {
+  struct sockaddr_in sin;
+  int fd = socket(AF_INET, SOCK_STREAM, 0), rcvbuf = 4096;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = lsn->loc.port;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ASSERT(connect(fd, (struct sockaddr *) &sin, sizeof(sin)) == 0);
+  while (s_conn == NULL) mg_mgr_poll(mgr, 10);
+  return fd;
+}
+
+static void send_str(int fd, const char *s) {
+  ASSERT(send(fd, s, strlen(s), 0) == (ssize_t) strlen(s));
+}
+
+// Read a response of a request sent, with the "ok" body
+static void read_ok(struct mg_mgr *mgr, int fd) {
+  char buf[512];
+  size_t n = 0;
+  ssize_t r;
+  while (n < 2 || memcmp(buf + n - 2, "ok", 2) != 0) {
+    mg_mgr_poll(mgr, 10);
+    r = recv(fd, buf + n, sizeof(buf) - n, MSG_DONTWAIT);
+    if (r > 0) n += (size_t) r;
+    ASSERT(r != 0 && n < sizeof(buf));
+  }
+}
+
+enum { SLOWLORIS, BODY, IDLE, HANDSHAKE, WRITE, ACTIVE };
+
+// Run a client, return when the server closed it. The one that is kept
+// open runs for 5 seconds
+static void run(struct mg_mgr *mgr, struct mg_connection *lsn, int test,
+                const char *desc, int cls, unsigned ms) {
+  unsigned long before[MG_DL_CLASSES];
+  uint64_t start, last, end, next;
+  int fd, i, n = 0;
+  memcpy(before, mgr->timeouts, sizeof(before));
+  fd = connect_to(mgr, lsn);
+  start = last = next = mg_millis();
+  end = start + (test == ACTIVE ? 5000 : 10000);
+  if (test == BODY) {
+    send_str(fd, "POST / HTTP/1.1\r\nContent-Length: 100\r\n\r\n0123456789");
+  } else if (test == IDLE) {
+    send_str(fd, "GET / HTTP/1.1\r\n\r\n"), read_ok(mgr, fd);
+  } else if (test == WRITE) {
+    for (i = 0; i < 300; i++) send_str(fd, "GET /big HTTP/1.1\r\n\r\n");
+  }
+  if (test != ACTIVE && test != SLOWLORIS) last = mg_millis();
+  while (s_conn != NULL && mg_millis() < end) {
+    uint64_t now = mg_millis();
+    if (test == SLOWLORIS && now >= next) {
+      static const char req[] = "GET / HTTP/1.1\r\nX-Padding: ";
+      char ch = n < (int) sizeof(req) - 1 ? req[n] : 'a';
+      ASSERT(send(fd, &ch, 1, 0) == 1);
+      if (n++ == 0) last = now;  // Headers are timed from the first byte
+      next = now + 300;
+    } else if (test == ACTIVE && now >= next && now < start + 4000) {
+      send_str(fd, "GET / HTTP/1.1\r\n\r\n"), read_ok(mgr, fd);
+      next = now + 500;
+    }
+    mg_mgr_poll(mgr, 10);
+  }
+  if (test == ACTIVE) {
+    ASSERT(s_conn != NULL);
+    ASSERT(memcmp(before, mgr->timeouts, sizeof(before)) == 0);
+    printf("%-40s kept open\n", desc);
+  } else {
+    uint64_t t = mg_millis() - last;
+    ASSERT(s_conn == NULL);
+    ASSERT(mgr->timeouts[cls] == before[cls] + 1);
+    printf("%-40s closed after %.1f s (%s)\n", desc, t / 1000.0,
+           s_names[cls]);
+    // Write stalls count from the last progress, which the client can't see
+    ASSERT(t + 20 >= ms && (test == WRITE || t <= ms + 300));
+  }
+  close(fd);
+  while (s_conn != NULL) mg_mgr_poll(mgr, 10);
+}
+
+int main(void) {
+  struct mg_mgr mgr;
+  struct mg_connection *http, *https;
+  mg_log_set(MG_LL_NONE);
+  s_cert = mg_file_read(&mg_fs_posix, "../certs/server_cert.pem");
+  s_key = mg_file_read(&mg_fs_posix, "../certs/server_key.pem");
+  ASSERT(s_cert.buf != NULL && s_key.buf != NULL);
+  memset(s_big, 'b', sizeof(s_big) - 1);
+  mg_mgr_init(&mgr);
+  http = mg_http_listen(&mgr, "http://127.0.0.1:0", fn, NULL);
+  https = mg_http_listen(&mgr, "http://127.0.0.1:0", fn, (void *) 1);
+  ASSERT(http != NULL && https != NULL);
+  http->deadlines = https->deadlines = &s_deadlines;
+
+  run(&mgr, http, SLOWLORIS, "slowloris, one header byte per 300 ms",
+      MG_DL_HEADER, 1000);
+  run(&mgr, http, BODY, "Content-Length 100, 10 bytes sent", MG_DL_BODY,
+      1000);
+  run(&mgr, http, IDLE, "keep-alive after one request", MG_DL_IDLE, 2000);
+  run(&mgr, https, HANDSHAKE, "TCP to the TLS port, nothing sent",
+      MG_DL_HANDSHAKE, 1000);
+  run(&mgr, http, WRITE, "300 pipelined downloads, reader stalled",
+      MG_DL_WRITE, 2000);
+  run(&mgr, http, ACTIVE, "a request every 500 ms for 4 s", 0, 0);
+
+  mg_mgr_free(&mgr);
+  mg_free((void *) s_cert.buf), mg_free((void *) s_key.buf);
+  printf("SUCCESS\n");
+  return 0;
+}
@@ -0,0 +1,93 @@
+// mg_json_get() and the tape parser against mongoose.c as it was before the
+// block scans of strings and whitespace (ref_* functions, see the Makefile).
+// Results must be the same on random bytes, on JSON-like text with long
+// strings, and on every prefix of the sample documents. Built once per scan:
+// the compiler's default, MG_ENABLE_JSON_SIMD=0, and -mavx2
+#include "mongoose.h"
+#include "json_docs.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+int ref_mg_json_get(struct mg_str json, const char *path, int *toklen);
+int ref_mg_json_tape_init(struct mg_json_tape *, struct mg_str json,
+                          struct mg_json_tok *toks, size_t max_toks);
+
+static struct mg_json_tok s_toks[2][4096];
+static long s_checks;
+
+static void check(const char *buf, size_t len) {
+  static const char *paths[] = {"$",       "$.a",        "$.a.b",
+                                "$[0]",    "$[1]",       "$.ssid",
+                                "$.a[2].x", "$.result.last", "$[0].a"};
+  struct mg_str json = mg_str_n(buf, len);
+  struct mg_json_tape a, b;
+  size_t i;
+  int n1, n2;
+  for (i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+    int l1 = -7, l2 = -7, r1 = ref_mg_json_get(json, paths[i], &l1),
+        r2 = mg_json_get(json, paths[i], &l2);
+    if (r1 != r2 || l1 != l2) {
+      printf("%s [%.*s]: %d,%d vs %d,%d\n", paths[i], (int) len, buf, r1, l1,
+             r2, l2);
+    }
+    ASSERT(r1 == r2 && l1 == l2);
+    s_checks++;
+  }
+  n1 = ref_mg_json_tape_init(&a, json, s_toks[0], 4096);
+  n2 = mg_json_tape_init(&b, json, s_toks[1], 4096);
+  ASSERT(n1 == n2);
+  if (n1 > 0) {
+    ASSERT(a.n == b.n && a.root == b.root);
+    ASSERT(memcmp(s_toks[0], s_toks[1], sizeof(s_toks[0][0]) * a.n) == 0);
+  }
+  s_checks++;
+}
+
+int main(void) {
+  // Structure, escapes, control and non-ASCII bytes, NUL
+  static const char alpha[] =
+      "\"\"\"\\\\\\abcxyz {}[]:,0123456789-+.eEtrufalsn\b\n\t\r\f\x01\x7f\xc3"
+      "\xa9";
+  static const char *prefixes[] = {"{\"a\":{\"b\":\"", "[\"", "{\"ssid\":\"",
+                                   "{\"a\":[1,2,{\"x\":\"",
+                                   "{\"result\":{\"last\":\""};
+  static char buf[256];
+  size_t i, n, len;
+  int it, k;
+
+  for (it = 0; it < 1000000; it++) {
+    int mode = (int) (doc_rnd() % 3);
+    n = doc_rnd() % 200;
+    if (mode == 0) {  // Random bytes
+      for (i = 0; i < n; i++) buf[i] = alpha[doc_rnd() % sizeof(alpha)];
+    } else {  // An open string of mostly letters, maybe closed
+      const char *p = prefixes[doc_rnd() % 5];
+      for (i = 0; *p != '\0' && i < n; i++) buf[i] = *p++;
+      while (i < n) {
+        uint32_t r = doc_rnd() % 100;
+        buf[i++] = r < 80 ? (char) ('a' + r % 26)
+                          : alpha[doc_rnd() % sizeof(alpha)];
+        if (mode == 2 && r == 99 && i + 3 < n) {
+          buf[i++] = '"', buf[i++] = '}', buf[i++] = '}';
+        }
+      }
+    }
+    check(buf, n);
+  }
+
+  for (k = 0; k < 8; k++) {  // Every few bytes of sample documents
+    char *doc = doc_make(k % 2, k < 4 ? 1024 : 8192, k / 2 % 2, &len);
+    for (n = 0; n <= len; n += 1 + doc_rnd() % 7) check(doc, n);
+    check(doc, len);
+    ASSERT(mg_json_get(mg_str_n(doc, len), "$.result.last", NULL) > 0);
+    free(doc);
+  }
+  printf("SUCCESS %ld checks\n", s_checks);
+  return 0;
+}
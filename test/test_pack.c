@@ -0,0 +1,69 @@
+// Packed filesystem lookup through the generated perfect hash, against the
+// linear scan it replaced. Linked with build/assets_c.c or build/assets_js.c,
+// the same assets packed by tool/pack.c or tool/pack.js
+#include "mongoose.h"
+#include "pack_linear.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static long s_queries;
+
+static void check(const char *path) {
+  size_t size = 0;
+  time_t mtime = 0;
+  int want = linear_stat(path), got = mg_fs_packed.st(path, &size, &mtime);
+  if (got != want) printf("%s: got %d, want %d\n", path, got, want);
+  ASSERT(got == want);
+  if (got == MG_FS_READ) {
+    const char *data = mg_unpack(path, NULL, NULL);
+    ASSERT(data != NULL && strlen(data) == size && mtime > 0);
+  } else {
+    ASSERT(mg_unpack(path, NULL, NULL) == NULL);
+  }
+  s_queries++;
+}
+
+int main(void) {
+  static const char *edge[] = {"",         "/",       "//",       "/assets",
+                               "/assets/", "/assets//", "assets", "/nope",
+                               "/assets/d", "/assets/d0/", "/assets/d0//"};
+  char buf[MG_PATH_MAX];
+  const char *name;
+  size_t i, j, n;
+  uint32_t r = 1;
+
+  for (i = 0; i < sizeof(edge) / sizeof(edge[0]); i++) check(edge[i]);
+  for (i = 0; (name = mg_unlist(i)) != NULL; i++) {
+    n = strlen(name);
+    for (j = 0; j <= n; j++) {  // Every prefix, directories among them
+      mg_snprintf(buf, sizeof(buf), "%.*s", (int) j, name);
+      check(buf);
+    }
+    mg_snprintf(buf, sizeof(buf), "%s.gz", name);
+    check(buf);
+    mg_snprintf(buf, sizeof(buf), "%s/", name);
+    check(buf);
+    mg_snprintf(buf, sizeof(buf), "%.*s/", (int) (strrchr(name, '/') - name),
+                name);
+    check(buf);
+  }
+  ASSERT(i == 500);
+  for (i = 0; i < 4000; i++) {  // Junk, made of the characters of names
+    static const char chars[] = "/ad0123456789f.jsetcx";
+    n = (r = r * 1103515245 + 12345) % 24;
+    for (j = 0; j < n; j++) {
+      buf[j] = chars[(r = r * 1103515245 + 12345) % (sizeof(chars) - 1)];
+    }
+    buf[n] = '\0';
+    check(buf);
+  }
+  printf("%ld queries\n", s_queries);
+  printf("SUCCESS\n");
+  return 0;
+}
@@ -0,0 +1,111 @@
+// mg_vxprintf() with span output against mongoose.c as it was before it, when
+// every char went through the output function (ref_* functions, see the
+// Makefile). Random arguments over formats with literals, padding, precision,
+// %m/%M escapes, numbers and %c/%%. Output must be the same from
+// mg_snprintf() at every buffer size, mg_mprintf(), a per-char callback, and
+// mg_pfn_iobuf with and without alignment
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+size_t ref_mg_xprintf(void (*fn)(char, void *), void *, const char *fmt, ...);
+size_t ref_mg_snprintf(char *, size_t, const char *fmt, ...);
+char *ref_mg_mprintf(const char *fmt, ...);
+size_t ref_mg_print_esc(void (*out)(char, void *), void *arg, va_list *ap);
+void ref_mg_pfn_iobuf(char ch, void *param);
+
+static uint32_t s_seed = 1;
+static char s_acc[4096];
+static size_t s_acc_len;
+static long s_checks;
+
+static uint32_t rnd(void) {
+  s_seed ^= s_seed << 13;
+  s_seed ^= s_seed >> 17;
+  s_seed ^= s_seed << 5;
+  return s_seed;
+}
+
+static void acc(char ch, void *param) {
+  if (s_acc_len < sizeof(s_acc)) s_acc[s_acc_len++] = ch;
+  (void) param;
+}
+
+static void rnd_str(char *buf, size_t max) {
+  static const char set[] = "abc XYZ\"\\\n\t\b\x01\x7f{}%:";
+  size_t i, n = rnd() % max;
+  for (i = 0; i < n; i++) buf[i] = set[rnd() % (sizeof(set) - 1)];
+  buf[n] = '\0';
+}
+
+// Same output from ref_* calls with the ref arguments, parenthesized, and
+// mg_* calls with the rest. CHECK() gives both the same arguments
+#define ARGS(...) __VA_ARGS__
+#define CHECK(...) CHECK2((__VA_ARGS__), __VA_ARGS__)
+#define CHECK2(ref, ...)                                                   \
+  do {                                                                     \
+    char a[600], b[600], *m1, *m2;                                         \
+    struct mg_iobuf io1, io2;                                              \
+    size_t n1, n2, k1, k2, sz, al;                                         \
+    for (sz = 0; sz < 300; sz += 1 + sz / 8) {                             \
+      memset(a, 'Q', sizeof(a)), memset(b, 'Q', sizeof(b));                \
+      n1 = ref_mg_snprintf(sz ? a : NULL, sz, ARGS ref);                   \
+      n2 = mg_snprintf(sz ? b : NULL, sz, __VA_ARGS__);                    \
+      ASSERT(n1 == n2 && memcmp(a, b, sizeof(a)) == 0);                    \
+    }                                                                      \
+    m1 = ref_mg_mprintf(ARGS ref), m2 = mg_mprintf(__VA_ARGS__);           \
+    ASSERT((m1 == NULL) == (m2 == NULL));  /* NULL if empty */             \
+    ASSERT(m1 == NULL || strcmp(m1, m2) == 0);                             \
+    free(m1), mg_free(m2);                                                 \
+    s_acc_len = 0, k1 = ref_mg_xprintf(acc, NULL, ARGS ref);               \
+    memcpy(a, s_acc, n1 = s_acc_len < 600 ? s_acc_len : 600);              \
+    s_acc_len = 0, k2 = mg_xprintf(acc, NULL, __VA_ARGS__);                \
+    ASSERT(k1 == k2 && s_acc_len == k2 && memcmp(a, s_acc, n1) == 0);      \
+    for (al = 0; al <= 64; al += 64) {                                     \
+      memset(&io1, 0, sizeof(io1)), memset(&io2, 0, sizeof(io2));          \
+      io1.align = io2.align = al;                                          \
+      mg_iobuf_add(&io1, 0, "pre", 3), mg_iobuf_add(&io2, 0, "pre", 3);    \
+      k1 = ref_mg_xprintf(ref_mg_pfn_iobuf, &io1, ARGS ref);               \
+      k2 = mg_xprintf(mg_pfn_iobuf, &io2, __VA_ARGS__);                    \
+      ASSERT(k1 == k2 && io1.len == io2.len);                              \
+      ASSERT(memcmp(io1.buf, io2.buf, io1.len) == 0);                      \
+      mg_iobuf_free(&io1), mg_iobuf_free(&io2);                            \
+    }                                                                      \
+    s_checks++;                                                            \
+  } while (0)
+
+int main(void) {
+  char s1[200], s2[200];
+  int it;
+  for (it = 0; it < 10000; it++) {
+    int e = (int) (rnd() % 50), d = (int) rnd() - (int) (rnd() / 2);
+    int w = (int) (rnd() % 20), p = (int) (rnd() % 30);
+    rnd_str(s1, 150), rnd_str(s2, 40);
+    CHECK("plain literal text only, long enough to span blocks");
+    CHECK("%s", "");
+    CHECK("%s", s1);
+    CHECK("%.*s|%-*s|%*s|", p, s1, w, s2, w, s2);
+    // Number formatting changed later, to match libc: zero padding of
+    // negative numbers, and doubles. test_snprintf checks those
+    CHECK("%5d %-5d %05d %x %X %#x %u %ld %lld %c %% %q", d, d, d & 0xffff, d,
+          d, d, d, (long) d, (int64_t) d * 1000003, 'z');
+    CHECK("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+          "Content-Length: %d\r\n\r\n%s",
+          (int) strlen(s1), s1);
+    CHECK("%s%s%s", s2, "", s1);
+    // %m and %M take a printer function: the old one for the old code
+    CHECK2(("{\"a\":%d,\"b\":\"%s\",\"c\":%m}", d, s2, ref_mg_print_esc, 0,
+            s1),
+           "{\"a\":%d,\"b\":\"%s\",\"c\":%m}", d, s2, MG_ESC(s1));
+    CHECK2(("%M and %m", ref_mg_print_esc, e, s1, ref_mg_print_esc, 0, s2),
+           "%M and %m", mg_print_esc, e, s1, mg_print_esc, 0, s2);
+  }
+  printf("SUCCESS %ld checks\n", s_checks);
+  return 0;
+}
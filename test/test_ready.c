@@ -0,0 +1,85 @@
+// Ready list of the poll() build. Idle connections are not visited, and flags
+// set outside of I/O, here from a timer, are acted on while the loop sleeps
+// in mg_mgr_poll(mgr, -1)
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static struct mg_connection *s_conn;  // Accepted connection
+static int s_polls;                   // MG_EV_POLL it got
+static int s_step;                    // Set by the timer
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_ACCEPT) s_conn = c;
+  if (ev == MG_EV_POLL && c == s_conn) s_polls++;
+  if (ev == MG_EV_CLOSE && c == s_conn) s_conn = NULL;
+  (void) ev_data;
+}
+
+static void hung(int sig) {
+  printf("FAILURE: mg_mgr_poll(mgr, -1) did not return\n");
+  exit(sig);
+}
+
+// Flag the accepted connection. Nothing else wakes the loop
+static void timer_fn(void *arg) {
+  int flag = *(int *) arg;
+  if (s_conn != NULL && flag == 1) s_conn->is_closing = 1;
+  if (s_conn != NULL && flag == 2) s_conn->is_draining = 1;
+  if (s_conn != NULL && flag == 3) s_conn->is_polling = 1;
+  s_step++;
+}
+
+static int connect_to(struct mg_mgr *mgr, struct mg_connection *lsn) {
+  struct sockaddr_in sin;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = lsn->loc.port;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ASSERT(connect(fd, (struct sockaddr *) &sin, sizeof(sin)) == 0);
+  while (s_conn == NULL) mg_mgr_poll(mgr, 10);
+  for (int i = 0; i < 10; i++) mg_mgr_poll(mgr, 10);  // Settle
+  s_polls = 0;
+  return fd;
+}
+
+static void test_flag(struct mg_mgr *mgr, struct mg_connection *lsn, int flag) {
+  int fd = connect_to(mgr, lsn), step = s_step;
+  mg_timer_add(mgr, 500, MG_TIMER_ONCE, timer_fn, &flag);
+  alarm(5);
+  if (flag == 0) {  // Idle: no MG_EV_POLL while nothing happens
+    while (s_step == step) mg_mgr_poll(mgr, -1);
+    ASSERT(s_polls == 0);
+  } else if (flag == 3) {  // MG_EV_POLL on every iteration
+    while (s_polls < 3) mg_mgr_poll(mgr, -1);
+    s_conn->is_polling = 0;
+  } else {  // Closed without any I/O on it
+    while (s_conn != NULL) mg_mgr_poll(mgr, -1);
+  }
+  alarm(0);
+  close(fd);
+  while (s_conn != NULL) mg_mgr_poll(mgr, 10);
+}
+
+int main(void) {
+  struct mg_mgr mgr;
+  struct mg_connection *lsn;
+  mg_log_set(MG_LL_NONE);
+  signal(SIGALRM, hung);
+  mg_mgr_init(&mgr);
+  ASSERT((lsn = mg_listen(&mgr, "tcp://127.0.0.1:0", fn, NULL)) != NULL);
+  test_flag(&mgr, lsn, 0);
+  test_flag(&mgr, lsn, 1);
+  test_flag(&mgr, lsn, 2);
+  test_flag(&mgr, lsn, 3);
+  mg_mgr_free(&mgr);
+  printf("SUCCESS\n");
+  return 0;
+}
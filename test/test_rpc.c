@@ -0,0 +1,101 @@
+// RPC dispatch through the method index against a linear reference: the
+// newest handler with the exact name, else the newest matching pattern.
+// Random lists with duplicate names, patterns, the "" handler and deletes
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static uint32_t s_seed = 1;
+static struct mg_rpc *s_called;
+
+static uint32_t rnd(void) {
+  s_seed ^= s_seed << 13;
+  s_seed ^= s_seed >> 17;
+  s_seed ^= s_seed << 5;
+  return s_seed;
+}
+
+// Handlers are told apart by function, for mg_rpc_del()
+static void f0(struct mg_rpc_req *r) {
+  s_called = r->rpc;
+}
+static void f1(struct mg_rpc_req *r) {
+  s_called = r->rpc;
+}
+static void f2(struct mg_rpc_req *r) {
+  s_called = r->rpc;
+}
+static void f3(struct mg_rpc_req *r) {
+  s_called = r->rpc;
+}
+static void (*s_fns[4])(struct mg_rpc_req *) = {f0, f1, f2, f3};
+
+static bool is_pattern(struct mg_str s) {
+  if (s.len == 0) return false;  // Stored with a NULL buf
+  return memchr(s.buf, '*', s.len) != NULL ||
+         memchr(s.buf, '?', s.len) != NULL || memchr(s.buf, '#', s.len) != NULL;
+}
+
+static struct mg_rpc *reference(struct mg_rpc *head, struct mg_str method) {
+  struct mg_rpc *r;
+  for (r = head; r != NULL; r = r->next) {
+    if (!is_pattern(r->method) && mg_strcmp(r->method, method) == 0) return r;
+  }
+  for (r = head; r != NULL; r = r->next) {
+    if (mg_match(method, r->method, NULL)) return r;
+  }
+  return NULL;
+}
+
+int main(void) {
+  static const char *patterns[] = {"a*", "b.?", "#", "x.*.y"};
+  char name[32], frame[80], buf[512];
+  long checks = 0;
+  int round, i, n;
+
+  for (round = 0; round < 300; round++) {
+    struct mg_rpc *head = NULL;
+    n = (int) (rnd() % 400);
+    for (i = 0; i < n; i++) {
+      if (rnd() % 50 == 0) {
+        mg_snprintf(name, sizeof(name), "%s", patterns[rnd() % 4]);
+      } else if (rnd() % 40 == 0) {
+        name[0] = '\0';  // Response handler
+      } else {
+        mg_snprintf(name, sizeof(name), "m%u", rnd() % 300);
+      }
+      mg_rpc_add(&head, mg_str(name), s_fns[rnd() % 4], NULL);
+      if (rnd() % 30 == 0) mg_rpc_del(&head, s_fns[rnd() % 4]);
+    }
+    for (i = 0; i < 500; i++) {
+      struct mg_iobuf io = {(unsigned char *) buf, sizeof(buf), 0, 0, 0};
+      struct mg_rpc_req r;
+      uint32_t k = rnd() % 5;
+      if (k == 0) {
+        mg_snprintf(name, sizeof(name), "a%u", rnd() % 10);
+      } else if (k == 1) {
+        mg_snprintf(name, sizeof(name), "b.%u", rnd() % 20);
+      } else {
+        mg_snprintf(name, sizeof(name), "m%u", rnd() % 330);
+      }
+      mg_snprintf(frame, sizeof(frame), "{\"id\":1,\"method\":\"%s\"}", name);
+      memset(&r, 0, sizeof(r));
+      r.head = &head, r.pfn = mg_pfn_iobuf, r.pfn_data = &io;
+      r.frame = mg_str(frame);
+      s_called = NULL;
+      mg_rpc_process(&r);
+      ASSERT(s_called == reference(head, mg_str(name)));
+      checks++;
+    }
+    mg_rpc_del(&head, NULL);
+    ASSERT(head == NULL);
+  }
+  printf("SUCCESS %ld checks\n", checks);
+  return 0;
+}
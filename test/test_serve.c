@@ -0,0 +1,171 @@
+// Packed assets of main/pack_fs.c served by the fast path, with headers
+// rendered at pack time, and by the generic path, which custom mime_types
+// force. Responses must be the same, but for Vary and Cache-Control, which the
+// generic path only sends with a 304
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+struct resp {
+  int status;
+  char headers[1024];  // Sorted, without Date, Vary and Cache-Control
+  char etag[64];
+  bool vary, cache_control;
+  size_t body_len;
+  uint32_t body_crc;
+};
+
+static struct mg_mgr s_mgr;
+static uint16_t s_port[2];  // Fast path, generic path
+
+static void fn(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_serve_opts opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.root_dir = "/web_root/", opts.fs = &mg_fs_packed;
+    if (c->fn_data != NULL) opts.mime_types = "";  // Not the fast path
+    mg_http_serve_dir(c, (struct mg_http_message *) ev_data, &opts);
+  }
+}
+
+static int cmp(const void *a, const void *b) {
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static void parse(const char *buf, size_t len, bool head, struct resp *r) {
+  struct mg_http_message hm;
+  const char *lines[MG_MAX_HTTP_HEADERS];
+  char tmp[MG_MAX_HTTP_HEADERS][256];
+  size_t i, n = 0, ofs = 0;
+  memset(r, 0, sizeof(*r));
+  ASSERT(mg_http_parse(buf, len, &hm) > 0);
+  r->status = mg_http_status(&hm);
+  for (i = 0; i < MG_MAX_HTTP_HEADERS && hm.headers[i].name.len > 0; i++) {
+    struct mg_http_header *h = &hm.headers[i];
+    if (mg_strcasecmp(h->name, mg_str("Vary")) == 0) {
+      r->vary = true;
+    } else if (mg_strcasecmp(h->name, mg_str("Cache-Control")) == 0) {
+      r->cache_control = true;
+    } else if (mg_strcasecmp(h->name, mg_str("Date")) != 0) {
+      mg_snprintf(tmp[n], sizeof(tmp[n]), "%.*s: %.*s", (int) h->name.len,
+                  h->name.buf, (int) h->value.len, h->value.buf);
+      lines[n] = tmp[n], n++;
+    }
+    if (mg_strcasecmp(h->name, mg_str("Etag")) == 0) {
+      mg_snprintf(r->etag, sizeof(r->etag), "%.*s", (int) h->value.len,
+                  h->value.buf);
+    }
+  }
+  qsort(lines, n, sizeof(lines[0]), cmp);
+  for (i = 0; i < n; i++) {
+    ofs += mg_snprintf(r->headers + ofs, sizeof(r->headers) - ofs, "%s\n",
+                       lines[i]);
+  }
+  if (!head) {
+    r->body_len = hm.body.len;
+    r->body_crc = mg_crc32(0, hm.body.buf, hm.body.len);
+  }
+}
+
+// Send a request, run the loop until the whole response is in
+static void fetch(int which, const char *method, const char *uri,
+                  const char *hdrs, struct resp *r) {
+  struct sockaddr_in sin;
+  struct mg_http_message hm;
+  size_t size = 1 << 20, len = 0;
+  char *buf = (char *) calloc(1, size), req[512];
+  int fd = socket(AF_INET, SOCK_STREAM, 0), n, hlen = 0;
+  long cl = -1;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_port = s_port[which];
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ASSERT(connect(fd, (struct sockaddr *) &sin, sizeof(sin)) == 0);
+  n = mg_snprintf(req, sizeof(req), "%s %s HTTP/1.1\r\nHost: x\r\n%s\r\n",
+                  method, uri, hdrs);
+  ASSERT(send(fd, req, (size_t) n, 0) == n);
+  while (cl < 0 || len < (size_t) hlen + (size_t) cl) {
+    mg_mgr_poll(&s_mgr, 1);
+    if ((n = (int) recv(fd, buf + len, size - len, MSG_DONTWAIT)) > 0) {
+      len += (size_t) n;
+    }
+    if (hlen == 0 && (hlen = mg_http_parse(buf, len, &hm)) > 0) {
+      struct mg_str *h = mg_http_get_header(&hm, "Content-Length");
+      bool empty = strcmp(method, "HEAD") == 0 || mg_http_status(&hm) == 304;
+      cl = empty ? 0 : h == NULL ? 0 : atol(h->buf);
+    }
+  }
+  parse(buf, len, strcmp(method, "HEAD") == 0, r);
+  close(fd);
+  free(buf);
+}
+
+// Same request through both paths
+static struct resp both(const char *method, const char *uri, const char *hdrs) {
+  struct resp fast, generic;
+  fetch(0, method, uri, hdrs, &fast);
+  fetch(1, method, uri, hdrs, &generic);
+  if (strcmp(fast.headers, generic.headers) != 0) {
+    printf("%s %s %s\nfast:\n%sgeneric:\n%s", method, uri, hdrs, fast.headers,
+           generic.headers);
+  }
+  ASSERT(fast.status == generic.status);
+  ASSERT(strcmp(fast.headers, generic.headers) == 0);
+  ASSERT(fast.body_len == generic.body_len);
+  ASSERT(fast.body_crc == generic.body_crc);
+  return fast;
+}
+
+int main(void) {
+  static const char *accept[] = {
+      "", "Accept-Encoding: gzip\r\n", "Accept-Encoding: br, gzip\r\n",
+      "Accept-Encoding: identity\r\n", "Accept-Encoding: deflate\r\n"};
+  const char *uris[8] = {"/", "/index.html", "/nope.js", NULL};
+  char hdrs[256];
+  struct mg_connection *c;
+  const char *name;
+  size_t i, j, k, n = 3;
+  struct resp r;
+
+  mg_log_set(MG_LL_NONE);
+  mg_mgr_init(&s_mgr);
+  ASSERT((c = mg_http_listen(&s_mgr, "http://127.0.0.1:0", fn, NULL)) != 0);
+  s_port[0] = c->loc.port;
+  ASSERT((c = mg_http_listen(&s_mgr, "http://127.0.0.1:0", fn, &s_mgr)) != 0);
+  s_port[1] = c->loc.port;
+  for (i = 0; (name = mg_unlist(i)) != NULL && n < 7; i++) {
+    if (strncmp(name, "/web_root/", 10) != 0) continue;
+    if (strstr(name, ".gz") == NULL && strstr(name, ".br") == NULL) {
+      uris[n++] = name + 9;  // A file, by its URI
+    } else if (strstr(name, ".js.gz") != NULL) {
+      uris[n++] = name + 9;  // A .gz file by its own name
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < sizeof(accept) / sizeof(accept[0]); j++) {
+      r = both("GET", uris[i], accept[j]);
+      both("HEAD", uris[i], accept[j]);
+      if (r.status != 200) continue;
+      mg_snprintf(hdrs, sizeof(hdrs), "%sRange: bytes=10-99\r\n", accept[j]);
+      ASSERT(both("GET", uris[i], hdrs).status == 206);
+      for (k = 0; k < 2; k++) {  // Matching and stale ETag
+        mg_snprintf(hdrs, sizeof(hdrs), "%sIf-None-Match: %s\r\n", accept[j],
+                    k == 0 ? r.etag : "\"1.2\"");
+        ASSERT(both("GET", uris[i], hdrs).status == (k == 0 ? 304 : 200));
+      }
+    }
+  }
+  r = both("GET", "/index.html", "Accept-Encoding: gzip\r\n");
+  ASSERT(r.status == 200 && r.vary && r.cache_control);
+  ASSERT(strstr(r.headers, "Content-Encoding: gzip\n") != NULL);
+  mg_mgr_free(&s_mgr);
+  printf("SUCCESS\n");
+  return 0;
+}
@@ -0,0 +1,149 @@
+// Slab pool soak test. HTTP connections churn through one manager, 1 in 50
+// over TLS, while the app keeps a long-lived string every 25 requests. All
+// pooled objects must be returned, and the heap must not grow with the
+// number of connections. Prints the heap and pool state at the end. Heap
+// blocks are counted by wrappers of calloc() and free(), see the Makefile
+// Usage: test_slab [connections], default 100000
+#include <malloc.h>
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+#define TLS_EVERY 50
+#define KEEP_EVERY 25
+#define INFLIGHT 6  // The firmware serves a handful of clients at once
+
+static const char *s_http = "http://127.0.0.1:8201";
+static const char *s_https = "http://127.0.0.1:8202";
+static struct mg_str s_cert, s_key;
+static int s_started, s_done, s_requests;
+static char *s_keep[8192];
+static int s_nkeep;
+static long s_blocks;  // Live heap blocks
+
+void *__real_calloc(size_t count, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_calloc(size_t count, size_t size) {
+  void *ptr = __real_calloc(count, size);
+  if (ptr != NULL) s_blocks++;
+  return ptr;
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr != NULL) s_blocks--;
+  __real_free(ptr);
+}
+
+static void srv(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_ACCEPT && c->fn_data != NULL) {
+    struct mg_tls_opts opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.cert = s_cert, opts.key = s_key;
+    mg_tls_init(c, &opts);
+  } else if (ev == MG_EV_HTTP_MSG) {
+    struct mg_http_message *hm = (struct mg_http_message *) ev_data;
+    // Long-lived allocations between connections, like sessions
+    if ((s_requests++ % KEEP_EVERY) == 0 && s_nkeep < 8192) {
+      s_keep[s_nkeep++] = mg_mprintf("session-%d", s_requests);
+    }
+    mg_http_reply(c, 200, "", "%.*s", (int) hm->uri.len, hm->uri.buf);
+  }
+}
+
+static void cli(struct mg_connection *c, int ev, void *ev_data) {
+  if (ev == MG_EV_CONNECT) {
+    if (c->fn_data != NULL) {
+      struct mg_tls_opts opts;
+      memset(&opts, 0, sizeof(opts));
+      opts.skip_verification = 1;
+      mg_tls_init(c, &opts);
+    }
+    mg_printf(c, "GET /x/%d HTTP/1.1\r\nConnection: close\r\n\r\n", s_done);
+  } else if (ev == MG_EV_HTTP_MSG) {
+    c->is_closing = 1;
+  } else if (ev == MG_EV_ERROR) {
+    printf("FAILURE: client error: %s\n", (char *) ev_data);
+    exit(1);
+  } else if (ev == MG_EV_CLOSE) {
+    s_done++;
+  }
+}
+
+static void churn(struct mg_mgr *mgr, int n) {
+  int total = s_started + n;
+  while (s_done < total) {
+    while (s_started < total && s_started - s_done < INFLIGHT) {
+      bool tls = (s_started++ % TLS_EVERY) == 0;
+      mg_http_connect(mgr, tls ? s_https : s_http, cli, tls ? (void *) 1 : 0);
+    }
+    mg_mgr_poll(mgr, 50);
+  }
+}
+
+static void unkeep(void) {
+  while (s_nkeep > 0) mg_free(s_keep[--s_nkeep]);
+}
+
+static size_t pools(struct mg_slab_stats *st, size_t max, bool print) {
+  size_t i, n = mg_slab_stats(st, max);
+  for (i = 0; print && i < n; i++) {
+    printf("  pool %4lu x %-3lu used %lu peak %lu fails %lu\n",
+           (unsigned long) st[i].size, (unsigned long) st[i].count,
+           (unsigned long) st[i].used, (unsigned long) st[i].peak,
+           (unsigned long) st[i].fails);
+  }
+  return n;
+}
+
+int main(int argc, char *argv[]) {
+  struct mg_mgr mgr;
+  struct mg_slab_stats st[MG_SLAB_CLASSES];
+  struct mallinfo2 mi;
+  size_t i, n;
+  long base;
+  int total = argc > 1 ? atoi(argv[1]) : 100000;
+
+  mg_log_set(MG_LL_NONE);
+  s_cert = mg_file_read(&mg_fs_posix, "../certs/server_cert.pem");
+  s_key = mg_file_read(&mg_fs_posix, "../certs/server_key.pem");
+  ASSERT(s_cert.buf != NULL && s_key.buf != NULL);
+  mg_mgr_init(&mgr);
+  ASSERT(mg_http_listen(&mgr, s_http, srv, NULL) != NULL);
+  ASSERT(mg_http_listen(&mgr, s_https, srv, (void *) 1) != NULL);
+
+  // Warm up: pools are registered, the heap has its working set
+  churn(&mgr, 1000);
+  unkeep();
+  base = s_blocks;
+
+  churn(&mgr, total);
+  mi = mallinfo2();
+  printf("%d connections: heap arena %lu KB, in use %lu KB, "
+         "free %lu KB in %lu chunks\n",
+         total, (unsigned long) (mi.arena / 1024),
+         (unsigned long) (mi.uordblks / 1024),
+         (unsigned long) (mi.fordblks / 1024), (unsigned long) mi.ordblks);
+  pools(st, MG_SLAB_CLASSES, true);
+  unkeep();
+  // Nothing is left behind by the connections that came and went
+  ASSERT(s_blocks == base);
+
+  mg_mgr_free(&mgr);
+  n = pools(st, MG_SLAB_CLASSES, false);
+  ASSERT(n == 3);  // Connections, TLS contexts, small objects
+  for (i = 0; i < n; i++) ASSERT(st[i].used == 0);
+  mg_free((void *) s_cert.buf);
+  mg_free((void *) s_key.buf);
+  // Pools are never freed. The iobuf pool keeps up to MG_IOBUF_POOL_BYTES
+  ASSERT(s_blocks >= (long) n);
+  ASSERT(s_blocks <= (long) (n + MG_IOBUF_POOL_BYTES / MG_IO_SIZE));
+  printf("SUCCESS\n");
+  return 0;
+}
@@ -0,0 +1,113 @@
+// mg_snprintf() numbers against glibc snprintf(): integers of every width
+// and doubles from random bit patterns, subnormals, exact ties and powers of
+// ten. %f of values above 1e20 is left out: mongoose prints a double into a
+// 40-byte buffer, which cuts %.15f of those
+#include <math.h>
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static uint64_t s_seed = 88172645463325252ULL;
+static long s_checks;
+
+static uint64_t rnd(void) {
+  s_seed ^= s_seed << 13;
+  s_seed ^= s_seed >> 7;
+  s_seed ^= s_seed << 17;
+  return s_seed;
+}
+
+// Random bits of a random width, so that all digit counts come up
+static uint64_t rnd_bits(void) {
+  unsigned bits = (unsigned) (rnd() % 65);
+  return bits == 64 ? rnd() : rnd() & ((1ULL << bits) - 1);
+}
+
+#define CHECK(fmt, ...)                                                   \
+  do {                                                                    \
+    char a[128], b[128];                                                  \
+    int n1 = snprintf(a, sizeof(a), fmt, __VA_ARGS__);                    \
+    size_t n2 = mg_snprintf(b, sizeof(b), fmt, __VA_ARGS__);              \
+    if (n1 < 0 || (size_t) n1 != n2 || strcmp(a, b) != 0) {               \
+      printf("%s: [%s] vs [%s]\n", fmt, a, b);                            \
+    }                                                                     \
+    ASSERT(n1 >= 0 && (size_t) n1 == n2 && strcmp(a, b) == 0);            \
+    s_checks++;                                                           \
+  } while (0)
+
+static void check_int(uint64_t v) {
+  int i = (int) v;
+  long l = (long) v;
+  long long ll = (long long) v;
+  CHECK("%d|%5d|%-7d|%05d|%u", i, i, i, i, (unsigned) i);
+  CHECK("%ld|%lu|%lx", l, (unsigned long) l, (unsigned long) l);
+  CHECK("%lld|%llu|%llx", ll, (unsigned long long) ll,
+        (unsigned long long) ll);
+  CHECK("%012lld|%20llu", ll, (unsigned long long) ll);
+  CHECK("%x|%hd|%hhu", (unsigned) i, (short) i, (unsigned char) i);
+}
+
+static void check_double(double d) {
+  static const char *g_fmts[] = {"%g",   "%.10g", "%.2g", "%.17g",
+                                 "%.0g", "%.1g",  "%-10g", "%.20g"};
+  static const char *f_fmts[] = {"%f",    "%.3f",  "%.1f",  "%.0f",
+                                 "%12.4f", "%.15f", "%08.2f"};
+  size_t i;
+  for (i = 0; i < sizeof(g_fmts) / sizeof(g_fmts[0]); i++) {
+    CHECK(g_fmts[i], d);
+  }
+  if (d < 1e20 && d > -1e20) {
+    for (i = 0; i < sizeof(f_fmts) / sizeof(f_fmts[0]); i++) {
+      CHECK(f_fmts[i], d);
+    }
+  }
+}
+
+int main(void) {
+  static const uint64_t limits[] = {0,
+                                    1,
+                                    (uint64_t) -1,
+                                    0x7fffffff,
+                                    0x80000000,
+                                    0xffffffff,
+                                    0x100000000ULL,
+                                    0x7fffffffffffffffULL,
+                                    0x8000000000000000ULL};
+  static const double specials[] = {0.0, -0.0, 0.5, 1.5, 2.5, 0.125, 0.375,
+                                    1e-320, 4.9e-324, 2.2250738585072014e-308,
+                                    1.7976931348623157e308, 1e23, 9.5, 99.5,
+                                    0.05, 0.25, 1e-5, 123456789012345678.0};
+  size_t i;
+  int k;
+  double d;
+
+  for (i = 0; i < sizeof(limits) / sizeof(limits[0]); i++) {
+    check_int(limits[i]), check_int(limits[i] - 1), check_int(-limits[i]);
+  }
+  for (k = 0; k < 2000000; k++) check_int(rnd_bits());
+
+  for (i = 0; i < sizeof(specials) / sizeof(specials[0]); i++) {
+    check_double(specials[i]), check_double(-specials[i]);
+  }
+  check_double(1.0 / 0.0), check_double(-1.0 / 0.0);
+  for (k = -30; k <= 30; k++) {  // Powers of ten, and just below them
+    d = pow(10, k);
+    check_double(d), check_double(nextafter(d, 0));
+    check_double(d * 0.999999);
+  }
+  for (k = 0; k < 150000; k++) {
+    uint64_t bits = rnd();
+    memcpy(&d, &bits, sizeof(d));
+    if (!isnan(d)) check_double(d);  // Random bit patterns
+    check_double((double) (int64_t) rnd_bits() / 1000);  // Sensor-like
+    check_double((double) (rnd() % 100000) / 64);  // Exact, many ties
+  }
+  printf("SUCCESS %ld checks\n", s_checks);
+  return 0;
+}
@@ -0,0 +1,79 @@
+// JSON tape lookups against mg_json_get(), which scans the text. Both must
+// resolve every path to the same token. The tape rejects malformed documents
+// that mg_json_get() answers from their valid prefix
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+static const char *s_docs[] = {
+    "{\"id\":1,\"method\":\"pwm_config\",\"params\":{\"pin\":4,\"channel\":0,"
+    "\"freq\":5000,\"timer\":0,\"resolution\":13}}",
+    "{\"pins\":[1, 2,3],\"mode\":2,\"pull_up_en\":1,\"pull_down_en\":0,"
+    "\"intr_type\":0}",
+    " { \"a\" : { \"b\" : [ 1 , { \"c\" : true } , [ ] , { } , null ] } , "
+    "\"d\" : \"x\\\"y\" } ",
+    "[1,[2,[3,4]],{\"a\":-1.5e3}]",
+    "42",
+    "\"s\"",
+    "{}",
+    "[]",
+    "{\"a\":[{},[]]}",
+    "{\"ssid\":\"my net\",\"password\":\"p\\u0041ss\"}",
+};
+
+static const char *s_malformed[] = {"{\"a\":1,}", "{\"a\"}", "[1 2]",
+                                    "{\"a\":1}x", ""};
+
+static const char *s_paths[] = {
+    "$",          "$.id",       "$.method",   "$.params",   "$.params.pin",
+    "$.params.resolution",      "$.pins",     "$.pins[0]",  "$.pins[2]",
+    "$.pins[3]",  "$.mode",     "$.intr_type", "$.a",       "$.a.b",
+    "$.a.b[0]",   "$.a.b[1]",   "$.a.b[1].c", "$.a.b[2]",   "$.a.b[3]",
+    "$.a.b[4]",   "$.a.b[5]",   "$.d",        "$[0]",       "$[1]",
+    "$[1][1]",    "$[1][1][1]", "$[2].a",     "$.nope",     "$.a.x",
+    "$[9]",       "$.ssid",     "$.password", "$.a[0]",     "$.a[1]"};
+
+int main(void) {
+  struct mg_json_tok toks[64];
+  struct mg_json_tape t;
+  size_t i, k;
+  char *s;
+
+  for (i = 0; i < sizeof(s_docs) / sizeof(s_docs[0]); i++) {
+    struct mg_str json = mg_str(s_docs[i]);
+    ASSERT(mg_json_tape_init(&t, json, toks, 64) > 0);
+    for (k = 0; k < sizeof(s_paths) / sizeof(s_paths[0]); k++) {
+      struct mg_str a = mg_json_get_tok(json, s_paths[k]);
+      struct mg_str b = mg_json_tape_get_tok(&t, s_paths[k]);
+      if (a.buf != b.buf || a.len != b.len) {
+        printf("%s %s: [%.*s] vs [%.*s]\n", s_docs[i], s_paths[k],
+               (int) a.len, a.buf == NULL ? "" : a.buf, (int) b.len,
+               b.buf == NULL ? "" : b.buf);
+      }
+      ASSERT(a.buf == b.buf && a.len == b.len);
+    }
+  }
+  for (i = 0; i < sizeof(s_malformed) / sizeof(s_malformed[0]); i++) {
+    ASSERT(mg_json_tape_init(&t, mg_str(s_malformed[i]), toks, 64) < 0);
+  }
+
+  // Getters, and a sub-tape rooted at the RPC params
+  ASSERT(mg_json_tape_init(&t, mg_str(s_docs[9]), toks, 64) > 0);
+  ASSERT((s = mg_json_tape_get_str(&t, "$.password")) != NULL);
+  ASSERT(strcmp(s, "pAss") == 0);
+  mg_free(s);
+  ASSERT(mg_json_tape_init(&t, mg_str(s_docs[0]), toks, 64) > 0);
+  t.root = mg_json_tape_find(&t, "$.params");
+  ASSERT(mg_json_tape_get_long(&t, "$.freq", 0) == 5000);
+  ASSERT(mg_json_tape_get_long(&t, "$.id", -1) == -1);
+  // Does not fit
+  ASSERT(mg_json_tape_init(&t, mg_str(s_docs[0]), toks, 5) < 0);
+  printf("SUCCESS\n");
+  return 0;
+}
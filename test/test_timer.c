@@ -0,0 +1,90 @@
+// Timer wheel against the timer list. The same timers are polled by
+// mg_timer_poll() and mg_timer_wheel_poll() at random times, and each timer
+// must fire the same number of times in both
+#include "mongoose.h"
+
+#define ASSERT(expr)                                            \
+  do {                                                          \
+    if (!(expr)) {                                              \
+      printf("FAILURE %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(1);                                                  \
+    }                                                           \
+  } while (0)
+
+#define NTIMERS 3000
+#define NPOLLS 300000
+
+static struct mg_timer s_list[NTIMERS], s_wheel[NTIMERS];
+static unsigned long s_fired[2][NTIMERS];
+static unsigned long s_calls[2];  // Total calls, per implementation
+static uint64_t s_rand = 1;
+
+static uint64_t rnd(uint64_t n) {
+  s_rand ^= s_rand << 13, s_rand ^= s_rand >> 7, s_rand ^= s_rand << 17;
+  return n == 0 ? 0 : s_rand % n;
+}
+
+static void fn(void *arg) {
+  unsigned long *count = (unsigned long *) arg;
+  count[0]++;
+  s_calls[count >= s_fired[1]]++;
+}
+
+// Periods from 1 ms to 11 hours, the longest ones go to the wheel's far list
+static uint64_t period(void) {
+  switch (rnd(4)) {
+    case 0: return 1 + rnd(64);
+    case 1: return 1 + rnd(5000);
+    case 2: return 1 + rnd(600000);
+    default: return 1 + rnd(11 * 3600 * 1000);
+  }
+}
+
+static void arm(struct mg_timer **list, struct mg_timer **staged, int i) {
+  static const unsigned flags[] = {MG_TIMER_ONCE, MG_TIMER_REPEAT,
+                                   MG_TIMER_REPEAT | MG_TIMER_RUN_NOW,
+                                   MG_TIMER_ONCE | MG_TIMER_RUN_NOW};
+  uint64_t ms = period();
+  unsigned f = flags[rnd(4)];
+  mg_timer_init(list, &s_list[i], ms, f, fn, &s_fired[0][i]);
+  mg_timer_init(staged, &s_wheel[i], ms, f, fn, &s_fired[1][i]);
+}
+
+// Mostly short gaps, like a busy loop. Sometimes minutes or hours
+static uint64_t gap(void) {
+  uint64_t r = rnd(1000);
+  return r < 900 ? 1 + rnd(5) : r < 990 ? 1 + rnd(60000) : 1 + rnd(7200000);
+}
+
+int main(void) {
+  struct mg_timer *list = NULL, *staged = NULL;
+  struct mg_timer_wheel wheel;
+  uint64_t now = 1000000, prev;
+  unsigned long calls;
+  int i, n, wait;
+
+  memset(&wheel, 0, sizeof(wheel));
+  for (i = 0; i < NTIMERS; i++) arm(&list, &staged, i);
+
+  for (n = 0; n < NPOLLS; n++) {
+    if (rnd(50) == 0) {  // Cancel and re-arm a few timers
+      for (i = (int) rnd(10); i > 0; i--) {
+        int k = (int) rnd(NTIMERS);
+        mg_timer_free(&list, &s_list[k]);
+        mg_timer_free(&staged, &s_wheel[k]);
+        arm(&list, &staged, k);
+      }
+    }
+    wait = mg_timer_wheel_wait(&wheel, staged, now);
+    prev = now, now += gap(), calls = s_calls[0];
+    mg_timer_poll(&list, now);
+    mg_timer_wheel_poll(&wheel, &staged, now);
+    ASSERT(s_calls[0] == s_calls[1]);
+    // Sleeping for "wait" must not miss a timer
+    if (wait < 0 || now - prev < (uint64_t) wait) ASSERT(s_calls[0] == calls);
+  }
+  for (i = 0; i < NTIMERS; i++) ASSERT(s_fired[0][i] == s_fired[1][i]);
+  printf("%lu calls in %d polls\n", s_calls[0], NPOLLS);
+  printf("SUCCESS\n");
+  return 0;
+}
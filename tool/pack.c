@@ -13,7 +13,7 @@
 //      ./pack file1.data file2.data > fs.c
 //
 //   3. In your application code, you can access files using this function:
-//      const char *mg_unpack(const char *file_name, size_t *size);
+//      const char *mg_unpack(const char *file_name, size_t *size, time_t *);
 //
 //   4. Build your app with fs.c:
 //      cc -o my_app my_app.c fs.c
@@ -25,33 +25,243 @@
 #include <sys/stat.h>
 
 static const char *code =
-    "static int scmp(const char *a, const char *b) {\n"
-    "  while (*a && (*a == *b)) a++, b++;\n"
-    "  return *(const unsigned char *) a - *(const unsigned char *) b;\n"
+    "#define NFILES (sizeof(packed_files) / sizeof(packed_files[0]) - 1)\n"
+    "static uint32_t packed_hash(uint32_t seed, const char *s, size_t n) {\n"
+    "  uint32_t h = seed ? seed : 0x811c9dc5U;\n"
+    "  while (n-- > 0) h = (h ^ (unsigned char) *s++) * 0x01000193U;\n"
+    "  return h ^ (h >> 16);\n"
+    "}\n"
+    "// Return packed_files index, packed_dirs index + NFILES, or -1\n"
+    "static int packed_find(const char *name, size_t n) {\n"
+    "  const size_t nk = sizeof(packed_slots) / sizeof(packed_slots[0]);\n"
+    "  int seed = packed_seeds[packed_hash(0, name, n) % nk], i;\n"
+    "  const char *p;\n"
+    "  if (seed < 0) {\n"
+    "    i = packed_slots[-seed - 1];\n"
+    "  } else {\n"
+    "    i = packed_slots[packed_hash((uint32_t) seed, name, n) % nk];\n"
+    "  }\n"
+    "  p = (size_t) i < NFILES ? packed_files[i].name : packed_dirs[i - NFILES];\n"
+    "  return p != NULL && strncmp(p, name, n) == 0 && p[n] == '\\0' ? i : -1;\n"
     "}\n"
     "const char *mg_unlist(size_t no) {\n"
     "  return packed_files[no].name;\n"
     "}\n"
     "const char *mg_unpack(const char *name, size_t *size, time_t *mtime) {\n"
-    "  const struct packed_file *p;\n"
-    "  for (p = packed_files; p->name != NULL; p++) {\n"
-    "    if (scmp(p->name, name) != 0) continue;\n"
-    "    if (size != NULL) *size = p->size - 1;\n"
-    "    if (mtime != NULL) *mtime = p->mtime;\n"
-    "    return (const char *) p->data;\n"
-    "  }\n"
-    "  return NULL;\n"
+    "  int i = packed_find(name, strlen(name));\n"
+    "  if (i < 0 || (size_t) i >= NFILES) return NULL;\n"
+    "  if (size != NULL) *size = packed_files[i].size - 1;\n"
+    "  if (mtime != NULL) *mtime = packed_files[i].mtime;\n"
+    "  return (const char *) packed_files[i].data;\n"
+    "}\n"
+    "const char *mg_unpack_http(const char *name, size_t *size,\n"
+    "                           const char **etag, const char **headers) {\n"
+    "  int i = packed_find(name, strlen(name));\n"
+    "  if (i < 0 || (size_t) i >= NFILES) return NULL;\n"
+    "  if (size != NULL) *size = packed_files[i].size - 1;\n"
+    "  if (etag != NULL) *etag = packed_files[i].etag;\n"
+    "  if (headers != NULL) *headers = packed_files[i].headers;\n"
+    "  return (const char *) packed_files[i].data;\n"
+    "}\n"
+    "int mg_unpack_dir(const char *name) {\n"
+    "  size_t n = strlen(name);\n"
+    "  if (n > 0 && name[n - 1] == '/') n--;  // \"/dir/\" is the same as \"/dir\"\n"
+    "  return packed_find(name, n) >= (int) NFILES;\n"
     "}\n";
 
+struct entry {
+  char *name;  // Name in the packed filesystem
+  int arg;     // argv index, also the vNNN data array number
+};
+
+// Must match packed_hash() in the generated code
+static unsigned long hash(unsigned long seed, const char *s, size_t n) {
+  unsigned long h = seed ? seed : 0x811c9dc5UL;
+  while (n-- > 0) h = ((h ^ (unsigned char) *s++) * 0x01000193UL) & 0xffffffff;
+  return h ^ (h >> 16);
+}
+
+// Same as s_known_types in mongoose.c
+static const char *mime_types[] = {
+    "html", "text/html; charset=utf-8",
+    "htm", "text/html; charset=utf-8",
+    "css", "text/css; charset=utf-8",
+    "js", "text/javascript; charset=utf-8",
+    "mjs", "text/javascript; charset=utf-8",
+    "gif", "image/gif",
+    "png", "image/png",
+    "jpg", "image/jpeg",
+    "jpeg", "image/jpeg",
+    "woff", "font/woff",
+    "ttf", "font/ttf",
+    "svg", "image/svg+xml",
+    "txt", "text/plain; charset=utf-8",
+    "avi", "video/x-msvideo",
+    "csv", "text/csv",
+    "doc", "application/msword",
+    "exe", "application/octet-stream",
+    "gz", "application/gzip",
+    "ico", "image/x-icon",
+    "json", "application/json",
+    "mov", "video/quicktime",
+    "mp3", "audio/mpeg",
+    "mp4", "video/mp4",
+    "mpeg", "video/mpeg",
+    "pdf", "application/pdf",
+    "shtml", "text/html; charset=utf-8",
+    "tgz", "application/tar-gz",
+    "wav", "audio/wav",
+    "webp", "image/webp",
+    "zip", "application/zip",
+    "3gp", "video/3gpp",
+    NULL,
+};
+
+// Print ETag and 200 response header for serving NAME, as mg_http_serve_file()
+// would send it. NAME.gz and NAME.br are encoded variants of NAME
+static void print_headers(const char *name, unsigned long size,
+                          unsigned long mtime) {
+  size_t i, n = strlen(name);
+  const char *mime = "text/plain; charset=utf-8", *ext, *coding = NULL;
+  if (n > 3 && strcmp(&name[n - 3], ".gz") == 0) {
+    coding = "gzip", n -= 3;
+  } else if (n > 3 && strcmp(&name[n - 3], ".br") == 0) {
+    coding = "br", n -= 3;
+  }
+  for (ext = name + n; ext > name && ext[-1] != '.'; ext--) (void) 0;
+  for (i = 0; mime_types[i] != NULL; i += 2) {
+    if (strlen(mime_types[i]) == (size_t) (name + n - ext) &&
+        strncmp(mime_types[i], ext, (size_t) (name + n - ext)) == 0) {
+      mime = mime_types[i + 1];
+    }
+  }
+  printf("   \"\\\"%lu.%lu\\\"\",\n", mtime, size);
+  printf("%s", "   \"HTTP/1.1 200 OK\\r\\n");
+  printf("Content-Type: %s\\r\\n", mime);
+  printf("Etag: \\\"%lu.%lu\\\"\\r\\n", mtime, size);
+  printf("Content-Length: %lu\\r\\n", size);
+  if (coding != NULL) printf("Content-Encoding: %s\\r\\n", coding);
+  printf("%s", "Vary: Accept-Encoding\\r\\n");
+  printf("%s", "Cache-Control: no-cache\\r\\n\\r\\n\"");
+}
+
+static int ecmp(const void *a, const void *b) {
+  return strcmp(((const struct entry *) a)->name,
+                ((const struct entry *) b)->name);
+}
+
+static int scmp(const void *a, const void *b) {
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static void *xcalloc(size_t n, size_t size) {
+  void *p = calloc(n == 0 ? 1 : n, size);
+  if (p == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  return p;
+}
+
+// Parent directories of all files, without a trailing "/". An empty name is
+// the root. Returns the number of directories
+static size_t list_dirs(const struct entry *e, size_t n, char ***dirs) {
+  size_t i, j, k, nd = 0, max = 0;
+  for (i = 0; i < n; i++) max += strlen(e[i].name);
+  *dirs = (char **) xcalloc(max, sizeof(**dirs));
+  for (i = 0; i < n; i++) {
+    for (j = strlen(e[i].name); j > 0; j--) {
+      if (e[i].name[j - 1] != '/') continue;
+      (*dirs)[nd] = (char *) xcalloc(j, 1);
+      memcpy((*dirs)[nd], e[i].name, j - 1);
+      nd++;
+    }
+  }
+  qsort(*dirs, nd, sizeof(**dirs), scmp);
+  for (i = k = 0; i < nd; i++) {
+    if (k > 0 && strcmp((*dirs)[k - 1], (*dirs)[i]) == 0) {
+      free((*dirs)[i]);
+    } else {
+      (*dirs)[k++] = (*dirs)[i];
+    }
+  }
+  return k;
+}
+
+// Minimal perfect hash, see tool/pack.js for the description
+static void perfect_hash(char **keys, size_t nkeys, long *seeds,
+                         unsigned *slots) {
+  size_t i, j, n = nkeys == 0 ? 1 : nkeys, free_slot = 0, *bucket_len;
+  size_t *order = (size_t *) xcalloc(n, sizeof(*order));
+  size_t *key_bucket = (size_t *) xcalloc(n, sizeof(*key_bucket));
+  size_t *pos = (size_t *) xcalloc(n, sizeof(*pos));
+  char *used = (char *) xcalloc(n, 1);
+  bucket_len = (size_t *) xcalloc(n, sizeof(*bucket_len));
+  for (i = 0; i < nkeys; i++) {
+    key_bucket[i] = hash(0, keys[i], strlen(keys[i])) % n;
+    bucket_len[key_bucket[i]]++;
+  }
+  for (i = 0; i < n; i++) order[i] = i;
+  for (i = 1; i < n; i++) {  // Largest buckets first
+    size_t b = order[i];
+    for (j = i; j > 0 && bucket_len[order[j - 1]] < bucket_len[b]; j--) {
+      order[j] = order[j - 1];
+    }
+    order[j] = b;
+  }
+  for (i = 0; i < n && bucket_len[order[i]] > 0; i++) {
+    size_t b = order[i], k, m = 0;
+    unsigned long seed;
+    if (bucket_len[b] == 1) {
+      for (k = 0; key_bucket[k] != b; k++) (void) 0;
+      while (used[free_slot]) free_slot++;
+      used[free_slot] = 1, slots[free_slot] = (unsigned) k;
+      seeds[b] = -(long) free_slot - 1;
+      continue;
+    }
+    for (seed = 1;; seed++) {
+      if (seed > 0x7fffffffUL) {
+        fprintf(stderr, "Cannot build a perfect hash\n");
+        exit(EXIT_FAILURE);
+      }
+      for (k = m = 0; k < nkeys; k++) {
+        if (key_bucket[k] != b) continue;
+        pos[m] = hash(seed, keys[k], strlen(keys[k])) % n;
+        for (j = 0; j < m && pos[j] != pos[m]; j++) (void) 0;
+        if (used[pos[m]] || j < m) break;
+        m++;
+      }
+      if (m == bucket_len[b]) break;
+    }
+    for (k = m = 0; k < nkeys; k++) {
+      if (key_bucket[k] != b) continue;
+      used[pos[m]] = 1, slots[pos[m]] = (unsigned) k;
+      m++;
+    }
+    seeds[b] = (long) seed;
+  }
+  free(order), free(key_bucket), free(pos), free(used), free(bucket_len);
+}
+
 int main(int argc, char *argv[]) {
   int i, j, ch;
   const char *strip_prefix = "";
+  size_t k, nentries = 0, ndirs, nkeys;
+  struct entry *entries;
+  char **dirs, **keys;
+  long *seeds;
+  unsigned *slots;
+
+  entries = (struct entry *) xcalloc((size_t) argc, sizeof(*entries));
 
   printf("%s", "#include \"mongoose.h\"\n");
   printf("%s", "\n");
   printf("%s", "#if defined(__cplusplus)\nextern \"C\" {\n#endif\n");
   printf("%s", "const char *mg_unlist(size_t no);\n");
   printf("%s", "const char *mg_unpack(const char *, size_t *, time_t *);\n");
+  printf("%s", "const char *mg_unpack_http(const char *, size_t *, "
+               "const char **, const char **);\n");
+  printf("%s", "int mg_unpack_dir(const char *);\n");
   printf("%s", "#if defined(__cplusplus)\n}\n#endif\n\n");
 
   for (i = 1; i < argc; i++) {
@@ -85,27 +295,69 @@ int main(int argc, char *argv[]) {
     }
   }
 
-  printf("%s", "\nstatic const struct packed_file {\n");
-  printf("%s", "  const char *name;\n");
-  printf("%s", "  const unsigned char *data;\n");
-  printf("%s", "  size_t size;\n");
-  printf("%s", "  time_t mtime;\n");
-  printf("%s", "} packed_files[] = {\n");
-
   for (i = 1; i < argc; i++) {
-    struct stat st;
     const char *name = argv[i];
     size_t n = strlen(strip_prefix);
     if (strcmp(argv[i], "-s") == 0) {
       i++;
       continue;
     }
-    stat(argv[i], &st);
     if (strncmp(name, strip_prefix, n) == 0) name += n;
-    printf("  {\"/%s\", v%d, sizeof(v%d), %lu},\n", name, i, i,
-           (unsigned long) st.st_mtime);
+    entries[nentries].name = (char *) xcalloc(strlen(name) + 2, 1);
+    sprintf(entries[nentries].name, "/%s", name);
+    entries[nentries++].arg = i;
+  }
+  // Keep the table sorted, so that mg_unlist() lists directories in order
+  qsort(entries, nentries, sizeof(*entries), ecmp);
+  for (k = 1; k < nentries; k++) {
+    if (strcmp(entries[k - 1].name, entries[k].name) != 0) continue;
+    fprintf(stderr, "Duplicate name: %s\n", entries[k].name);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("%s", "\nstatic const struct packed_file {\n");
+  printf("%s", "  const char *name;\n");
+  printf("%s", "  const unsigned char *data;\n");
+  printf("%s", "  size_t size;\n");
+  printf("%s", "  time_t mtime;\n");
+  printf("%s", "  const char *etag;     // Strong ETag, with quotes\n");
+  printf("%s", "  const char *headers;  // Complete 200 response header\n");
+  printf("%s", "} packed_files[] = {\n");
+  for (k = 0; k < nentries; k++) {
+    struct stat st;
+    stat(argv[entries[k].arg], &st);
+    printf("  {\"%s\", v%d, sizeof(v%d), %lu,\n", entries[k].name,
+           entries[k].arg, entries[k].arg, (unsigned long) st.st_mtime);
+    print_headers(entries[k].name, (unsigned long) st.st_size,
+                  (unsigned long) st.st_mtime);
+    printf("%s", "},\n");
+  }
+  printf("%s", "  {NULL, NULL, 0, 0, NULL, NULL}\n");
+  printf("%s", "};\n\n");
+
+  ndirs = list_dirs(entries, nentries, &dirs);
+  printf("%s", "static const char *packed_dirs[] = {\n");
+  for (k = 0; k < ndirs; k++) printf("  \"%s\",\n", dirs[k]);
+  printf("%s", "  NULL\n");
+  printf("%s", "};\n\n");
+
+  // Files first, then directories, the order packed_find() expects
+  nkeys = nentries + ndirs;
+  keys = (char **) xcalloc(nkeys, sizeof(*keys));
+  for (k = 0; k < nentries; k++) keys[k] = entries[k].name;
+  for (k = 0; k < ndirs; k++) keys[nentries + k] = dirs[k];
+  seeds = (long *) xcalloc(nkeys, sizeof(*seeds));
+  slots = (unsigned *) xcalloc(nkeys, sizeof(*slots));
+  perfect_hash(keys, nkeys, seeds, slots);
+  printf("%s", "// Minimal perfect hash over packed_files and packed_dirs\n");
+  printf("%s", "static const int packed_seeds[] = {");
+  for (k = 0; k < (nkeys == 0 ? 1 : nkeys); k++) {
+    printf("%s%ld", k == 0 ? "" : ",", seeds[k]);
+  }
+  printf("%s", "};\nstatic const unsigned short packed_slots[] = {");
+  for (k = 0; k < (nkeys == 0 ? 1 : nkeys); k++) {
+    printf("%s%u", k == 0 ? "" : ",", slots[k]);
   }
-  printf("%s", "  {NULL, NULL, 0, 0}\n");
   printf("%s", "};\n\n");
   printf("%s", code);
 
@@ -4,35 +4,239 @@
 // Mongoose Network Library, https://github.com/cesanta/mongoose
 //
 // Usage:
-//    node pack.js FILE[:DESTINATION[:gzip]] ...
+//    node pack.js FILE[:DESTINATION[:OPTIONS]] ...
+//
+// OPTIONS is a comma-separated list of variants to store: br, gzip and
+// identity. br and gzip variants are stored as DESTINATION.br and .gz, and
+// only if they are smaller than the file. If nothing else is left, the file
+// itself is stored. Without OPTIONS, the file is stored as is
+//
+// An "immutable" option stores the file under a name with its content hash,
+// like main.1a2b3c4d.js, served with a one year immutable Cache-Control.
+// References to it by name from packed html, css and js files in the same
+// directory are rewritten to the new name
 
+const crypto = require('crypto');
 const fs = require('fs');
 const zlib = require('zlib');
 const argv = process.argv.slice(2);
 
-// Convert each command-line arguments into [ DATA_ARRAY, STRUCT_INITIALIZER ]
-const entries = argv.map(function(filename, i) {
-  const parts = filename.split(':');
-  const stat = fs.statSync(parts[0]);
-  const data = fs.readFileSync(parts[0], null);
-  let bytes = Array.from(data);
-  let destination = (parts[1] || parts[0]).replace(/^\.+[\/\\]*/, '');
-  if (parts[2] == 'gzip') {
-    bytes = Array.from(zlib.gzipSync(data));
-    destination += '.gz';
+// Same as s_known_types in mongoose.c
+const mimeTypes = {
+  html: 'text/html; charset=utf-8', htm: 'text/html; charset=utf-8',
+  css: 'text/css; charset=utf-8', js: 'text/javascript; charset=utf-8',
+  mjs: 'text/javascript; charset=utf-8', gif: 'image/gif', png: 'image/png',
+  jpg: 'image/jpeg', jpeg: 'image/jpeg', woff: 'font/woff', ttf: 'font/ttf',
+  svg: 'image/svg+xml', txt: 'text/plain; charset=utf-8',
+  avi: 'video/x-msvideo', csv: 'text/csv', doc: 'application/msword',
+  exe: 'application/octet-stream', gz: 'application/gzip', ico: 'image/x-icon',
+  json: 'application/json', mov: 'video/quicktime', mp3: 'audio/mpeg',
+  mp4: 'video/mp4', mpeg: 'video/mpeg', pdf: 'application/pdf',
+  shtml: 'text/html; charset=utf-8', tgz: 'application/tar-gz',
+  wav: 'audio/wav', webp: 'image/webp', zip: 'application/zip',
+  '3gp': 'video/3gpp',
+};
+
+// Content codings, and the suffixes of their variants. Same as s_codings in
+// mongoose.c
+const codings = {br: '.br', gzip: '.gz'};
+
+// 200 response header for serving NAME, as mg_http_serve_file() would send
+// it. NAME.gz and NAME.br are encoded variants of NAME
+function httpHeaders(name, size, etag, immutable) {
+  const coding = Object.keys(codings).find(k => name.endsWith(codings[k]));
+  const base = coding ? name.slice(0, -codings[coding].length) : name;
+  const ext = base.substring(base.lastIndexOf('.') + 1);
+  const mime = Object.prototype.hasOwnProperty.call(mimeTypes, ext) ?
+      mimeTypes[ext] : 'text/plain; charset=utf-8';
+  return 'HTTP/1.1 200 OK\r\n' +
+      `Content-Type: ${mime}\r\n` +
+      `Etag: ${etag}\r\n` +
+      `Content-Length: ${size}\r\n` +
+      (coding ? `Content-Encoding: ${coding}\r\n` : '') +
+      'Vary: Accept-Encoding\r\n' +
+      (immutable ? 'Cache-Control: public, max-age=31536000, immutable\r\n' :
+                   'Cache-Control: no-cache\r\n') +
+      '\r\n';
+}
+
+// C string literal
+const cstr = s => JSON.stringify(s);
+
+function compress(coding, data) {
+  if (coding == 'gzip') {
+    return zlib.gzipSync(data, {level: zlib.constants.Z_BEST_COMPRESSION});
+  }
+  return zlib.brotliCompressSync(data, {
+    params: {
+      [zlib.constants.BROTLI_PARAM_QUALITY]: zlib.constants.BROTLI_MAX_QUALITY,
+      [zlib.constants.BROTLI_PARAM_SIZE_HINT]: data.length,
+    },
+  });
+}
+
+// Parse command-line arguments
+const files = argv.map(function(arg) {
+  const parts = arg.split(':');
+  const options = (parts[2] || 'identity').split(',');
+  const destination = (parts[1] || parts[0]).replace(/^\.+[\/\\]*/, '');
+  options.forEach(function(x) {
+    if (x == 'identity' || x == 'immutable' || codings[x]) return;
+    console.error(`Unknown option: ${x}`);
+    process.exit(1);
+  });
+  return {
+    path: parts[0],
+    name: `/${destination}`,
+    referred: `/${destination}`,  // Name before fingerprinting
+    wanted: options.filter(x => x != 'immutable'),
+    immutable: options.includes('immutable'),
+    data: fs.readFileSync(parts[0], null),
+    mtime: parseInt(fs.statSync(parts[0]).mtimeMs / 1000),
+  };
+});
+
+const dirname = name => name.substring(0, name.lastIndexOf('/') + 1);
+const escape = s => s.replace(/[.*+?^${}()|[\]\\]/g, '\\$&');
+
+// Rewrite references to immutable files, then name the file by its content
+// hash if it is immutable itself. Immutable files referencing each other are
+// done depth first, so a change anywhere renames everything that depends on it
+function fingerprint(file, stack) {
+  if (file.digest) return file;
+  if (stack.includes(file)) {
+    console.error(`Circular reference: ${stack.map(x => x.path).join(' ')}`);
+    process.exit(1);
   }
-  
-  // concat(0) appends trailing 0, in order to make any file an asciz string
-  return [
-    `static const unsigned char v${i}[] = {${bytes.concat(0).join(',')}};`,
-    `  {"/${destination}", v${i}, sizeof(v${i}) - 1, ${parseInt(stat.mtimeMs / 1000)}}`,
-  ];
+  const ext = file.name.substring(file.name.lastIndexOf('.') + 1);
+  if (['html', 'htm', 'shtml', 'css', 'js', 'mjs'].includes(ext)) {
+    let text = file.data.toString('binary');
+    files.forEach(function(x) {
+      if (!x.immutable || x == file || dirname(x.name) != dirname(file.name)) {
+        return;
+      }
+      const from = x.referred.substring(dirname(x.referred).length);
+      const re = new RegExp(`(["'(/])${escape(from)}(?=["'?#)])`, 'g');
+      if (!re.test(text)) return;
+      const to = fingerprint(x, stack.concat(file)).name;
+      text = text.replace(re, `$1${to.substring(dirname(to).length)}`);
+    });
+    file.data = Buffer.from(text, 'binary');
+  }
+  file.digest = crypto.createHash('sha256').update(file.data).digest('hex');
+  if (file.immutable) {
+    const base = file.name.substring(dirname(file.name).length);
+    const dot = base.lastIndexOf('.') > 0 ? base.lastIndexOf('.') : base.length;
+    file.name = dirname(file.name) + base.substring(0, dot) + '.' +
+        file.digest.substring(0, 8) + base.substring(dot);
+  }
+  return file;
+}
+files.forEach(x => fingerprint(x, []));
+
+// Convert each file into variants, and each variant into
+// [ NAME, DATA_ARRAY, STRUCT_INITIALIZER ]
+let count = 0;
+const entries = files.flatMap(function(file) {
+  const variants = [];
+  file.wanted.forEach(function(coding) {
+    if (coding == 'identity') return;
+    const bytes = compress(coding, file.data);
+    if (bytes.length < file.data.length) {
+      variants.push([codings[coding], bytes]);
+    }
+  });
+  if (file.wanted.includes('identity') || variants.length == 0) {
+    variants.push(['', file.data]);
+  }
+  return variants.map(function([suffix, bytes]) {
+    const name = `${file.name}${suffix}`, i = count++;
+    // Strong ETag by content, so it survives rebuilds. Variants differ
+    const etag = `"${file.digest.substring(0, 16)}${suffix}"`;
+    const hdrs = httpHeaders(name, bytes.length, etag, file.immutable);
+    // concat(0) appends trailing 0, in order to make any file an asciz string
+    const array = Array.from(bytes).concat(0).join(',');
+    return [
+      name,
+      `static const unsigned char v${i}[] = {${array}};`,
+      `  {"${name}", v${i}, sizeof(v${i}) - 1, ${file.mtime},\n` +
+      `   ${cstr(etag)},\n   ${cstr(hdrs)}}`,
+    ];
+  });
 });
 
+// Keep the table sorted, so that mg_unlist() lists directories in order
+const cmp = (a, b) => Buffer.compare(Buffer.from(a), Buffer.from(b));
+const sorted = entries.slice().sort((a, b) => cmp(a[0], b[0]));
+
+// Every parent directory of a packed file, without a trailing slash.
+// An empty name is the root
+const dirs = new Set();
+sorted.forEach(function(x) {
+  for (let i = x[0].lastIndexOf('/'); i > 0; i = x[0].lastIndexOf('/', i - 1)) {
+    dirs.add(x[0].substring(0, i));
+  }
+  dirs.add('');
+});
+const dirnames = Array.from(dirs).sort(cmp);
+
+// Must match packed_hash() in the generated code: 32-bit FNV-1a,
+// with a non-zero seed replacing the offset basis. Low bits of FNV-1a depend
+// on low bits of the input only, so high bits are folded in
+function hash(seed, name) {
+  let h = seed ? seed : 0x811c9dc5;
+  for (const b of Buffer.from(name)) h = Math.imul(h ^ b, 0x01000193) >>> 0;
+  return (h ^ (h >>> 16)) >>> 0;
+}
+
+// Minimal perfect hash over file and directory names, "hash and displace".
+// Keys go to buckets by hash(0). Largest buckets first, each multi-key bucket
+// gets the first seed that puts all its keys into free slots. A single-key
+// bucket takes any free slot and stores it as -slot - 1
+function perfectHash(keys) {
+  keys.forEach(function(k, i) {
+    if (keys.indexOf(k) == i) return;
+    console.error(`Duplicate name: ${k}`);
+    process.exit(1);
+  });
+  const n = Math.max(keys.length, 1);
+  const seeds = new Array(n).fill(0), slots = new Array(n).fill(0);
+  const used = new Array(n).fill(false);
+  const buckets = Array.from({length: n}, () => []);
+  keys.forEach((k, i) => buckets[hash(0, k) % n].push(i));
+  const order = buckets.map((b, i) => i).sort((a, b) =>
+    buckets[b].length - buckets[a].length);
+  let free = 0;
+  for (const b of order) {
+    const bucket = buckets[b];
+    if (bucket.length == 0) break;
+    if (bucket.length == 1) {
+      while (used[free]) free++;
+      used[free] = true, slots[free] = bucket[0], seeds[b] = -free - 1;
+      continue;
+    }
+    for (let seed = 1;; seed++) {
+      if (seed > 0x7fffffff) {
+        console.error('Cannot build a perfect hash');
+        process.exit(1);
+      }
+      const s = bucket.map(k => hash(seed, keys[k]) % n);
+      if (s.some((x, i) => used[x] || s.indexOf(x) != i)) continue;
+      s.forEach((x, i) => { used[x] = true, slots[x] = bucket[i]; });
+      seeds[b] = seed;
+      break;
+    }
+  }
+  return [seeds, slots];
+}
+
+const [seeds, slots] = perfectHash(sorted.map(x => x[0]).concat(dirnames));
+
 process.stdout.write(`// DO NOT EDIT. This file is generated using this command:
 // ${process.argv.join(' ')}
 
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 
@@ -42,26 +246,56 @@ extern "C" {
 
 const char *mg_unlist(size_t no);
 const char *mg_unpack(const char *, size_t *, time_t *);
+const char *mg_unpack_http(const char *, size_t *, const char **,
+                           const char **);
+int mg_unpack_dir(const char *);
 
 #if defined(__cplusplus)
 }
 #endif
 
-${entries.map(x => x[0]).join('\n\n')}
+${entries.map(x => x[1]).join('\n\n')}
 
 static const struct packed_file {
   const char *name;
   const unsigned char *data;
   size_t size;
   time_t mtime;
+  const char *etag;     // Strong ETag, with quotes
+  const char *headers;  // Complete 200 response header
 } packed_files[] = {
-${entries.map(x => x[1]).join(',\n')},
-  {NULL, NULL, 0, 0}
+${sorted.map(x => x[2]).join(',\n')}${sorted.length ? ',' : ''}
+  {NULL, NULL, 0, 0, NULL, NULL}
+};
+
+static const char *packed_dirs[] = {
+${dirnames.map(x => `  "${x}",`).join('\n')}${dirnames.length ? '\n' : ''}  NULL
 };
 
-static int scmp(const char *a, const char *b) {
-  while (*a && (*a == *b)) a++, b++;
-  return *(const unsigned char *) a - *(const unsigned char *) b;
+#define NFILES (sizeof(packed_files) / sizeof(packed_files[0]) - 1)
+
+// Minimal perfect hash over packed_files and packed_dirs
+static const int packed_seeds[] = {${seeds.join(',')}};
+static const unsigned short packed_slots[] = {${slots.join(',')}};
+
+static uint32_t packed_hash(uint32_t seed, const char *s, size_t n) {
+  uint32_t h = seed ? seed : 0x811c9dc5U;
+  while (n-- > 0) h = (h ^ (unsigned char) *s++) * 0x01000193U;
+  return h ^ (h >> 16);
+}
+
+// Return packed_files index, packed_dirs index + NFILES, or -1
+static int packed_find(const char *name, size_t n) {
+  const size_t nk = sizeof(packed_slots) / sizeof(packed_slots[0]);
+  int seed = packed_seeds[packed_hash(0, name, n) % nk], i;
+  const char *p;
+  if (seed < 0) {
+    i = packed_slots[-seed - 1];
+  } else {
+    i = packed_slots[packed_hash((uint32_t) seed, name, n) % nk];
+  }
+  p = (size_t) i < NFILES ? packed_files[i].name : packed_dirs[i - NFILES];
+  return p != NULL && strncmp(p, name, n) == 0 && p[n] == '\\0' ? i : -1;
 }
 
 const char *mg_unlist(size_t no) {
@@ -69,13 +303,27 @@ const char *mg_unlist(size_t no) {
 }
 
 const char *mg_unpack(const char *name, size_t *size, time_t *mtime) {
-  const struct packed_file *p;
-  for (p = packed_files; p->name != NULL; p++) {
-    if (scmp(p->name, name) != 0) continue;
-    if (size != NULL) *size = p->size;
-    if (mtime != NULL) *mtime = p->mtime;
-    return (const char *) p->data;
-  }
-  return NULL;
-};
+  int i = packed_find(name, strlen(name));
+  if (i < 0 || (size_t) i >= NFILES) return NULL;
+  if (size != NULL) *size = packed_files[i].size;
+  if (mtime != NULL) *mtime = packed_files[i].mtime;
+  return (const char *) packed_files[i].data;
+}
+
+// Pre-rendered response header for a packed file, see httpHeaders()
+const char *mg_unpack_http(const char *name, size_t *size, const char **etag,
+                           const char **headers) {
+  int i = packed_find(name, strlen(name));
+  if (i < 0 || (size_t) i >= NFILES) return NULL;
+  if (size != NULL) *size = packed_files[i].size;
+  if (etag != NULL) *etag = packed_files[i].etag;
+  if (headers != NULL) *headers = packed_files[i].headers;
+  return (const char *) packed_files[i].data;
+}
+
+int mg_unpack_dir(const char *name) {
+  size_t n = strlen(name);
+  if (n > 0 && name[n - 1] == '/') n--;  // "/dir/" is the same as "/dir"
+  return packed_find(name, n) >= (int) NFILES;
+}
 `);